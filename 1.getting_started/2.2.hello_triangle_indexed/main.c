@@ -1,5 +1,13 @@
 #include <glad/glad.h>
-#include <GLFW/glfw3.h>
+
+#define LGL_PLATFORM_IMPLEMENTATION
+#include <lgl_platform.h>
+
+#define LGL_MESH_OPT_IMPLEMENTATION
+#include <lgl_mesh_opt.h>
+
+#define LGL_INDEX_BUFFER_IMPLEMENTATION
+#include <lgl_index_buffer.h>
 
 #include <stdio.h>
 
@@ -19,6 +27,7 @@ const char *fragmentShaderSource = "#version 330 core\n"
 
 void onWindowResize(GLFWwindow *window, int width, int height)
 {
+	(void)window;
 	glViewport(0, 0, width, height);
 }
 
@@ -40,8 +49,12 @@ int main(void)
 		2, 3, 0
 	};
 
+	int vertexCount = 4;
+	lgl_MeshStats statsBefore, statsAfter;
+	lgl_IndexBuffer rectangle = {0};
+
 	int glLoaded = 0;
-	unsigned int VAO, VBO, EBO;
+	unsigned int VAO = 0, VBO = 0, EBO = 0;
 	unsigned int vertexShader, fragmentShader, shaderProgram;
 
 	/* window creation
@@ -117,6 +130,18 @@ int main(void)
 	glDeleteShader(vertexShader);
 	glDeleteShader(fragmentShader);
 
+	/* mesh optimization
+	   ----------------- */
+	vertexCount = lgl_meshOptimize(vertices, vertexCount, 3, indices, 6,
+				       &statsBefore, &statsAfter);
+	lgl_meshPrintStats("rectangle", &statsBefore, &statsAfter);
+
+	/* 4 vertices fit GL_UNSIGNED_BYTE indices */
+	if (!lgl_indexBufferBuild(&rectangle, indices, 6, vertexCount)) {
+		fprintf(stderr, "Failed to build the index buffer\n");
+		goto_defer(-1);
+	}
+
 	/* VAO and buffers
 	   --------------- */
 	glGenVertexArrays(1, &VAO);
@@ -126,11 +151,11 @@ int main(void)
 	glBindVertexArray(VAO);
 
 	glBindBuffer(GL_ARRAY_BUFFER, VBO);
-	glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+	glBufferData(GL_ARRAY_BUFFER, vertexCount * 3 * sizeof(float), vertices,
+		     GL_STATIC_DRAW);
 
 	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-	glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices,
-		     GL_STATIC_DRAW);
+	lgl_indexBufferUpload(&rectangle, GL_STATIC_DRAW);
 	
 	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE,
 			3 * sizeof(float), (void *)0);
@@ -148,7 +173,7 @@ int main(void)
 
 		glUseProgram(shaderProgram);
 		glBindVertexArray(VAO);
-		glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+		lgl_indexBufferDraw(&rectangle);
 
 		glfwSwapBuffers(window);
 		glfwPollEvents();
@@ -158,8 +183,10 @@ int main(void)
 	if (glLoaded) {
 		glDeleteVertexArrays(1, &VAO);
 		glDeleteBuffers(1, &VBO);
+		glDeleteBuffers(1, &EBO);
 		glDeleteProgram(shaderProgram);
 	}
+	lgl_indexBufferFree(&rectangle);
 	glfwTerminate();
 	return exitCode;
 }
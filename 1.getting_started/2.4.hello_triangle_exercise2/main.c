@@ -1,5 +1,7 @@
 #include <glad/glad.h>
-#include <GLFW/glfw3.h>
+
+#define LGL_PLATFORM_IMPLEMENTATION
+#include <lgl_platform.h>
 
 #include <stdio.h>
 
@@ -19,6 +21,7 @@ const char *fragmentShaderSource = "#version 330 core\n"
 
 void onWindowResize(GLFWwindow *window, int width, int height)
 {
+	(void)window;
 	glViewport(0, 0, width, height);
 }
 
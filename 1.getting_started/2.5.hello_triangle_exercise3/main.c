@@ -1,5 +1,10 @@
 #include <glad/glad.h>
-#include <GLFW/glfw3.h>
+
+#define LGL_PLATFORM_IMPLEMENTATION
+#include <lgl_platform.h>
+
+#define LGL_BUFFER_HEAP_IMPLEMENTATION
+#include <lgl_buffer_heap.h>
 
 #include <stdio.h>
 
@@ -25,6 +30,7 @@ const char *fragmentShader2Source = "#version 330 core\n"
 
 void onWindowResize(GLFWwindow *window, int width, int height)
 {
+	(void)window;
 	glViewport(0, 0, width, height);
 }
 
@@ -46,7 +52,10 @@ int main(void)
 		0.5f, 0.5f, 0.0f
 	};
 
-	unsigned int VAO[2], VBO[2];
+	/* both triangles live in one buffer heap and share one VAO */
+	unsigned int VAO = 0;
+	lgl_BufferHeap heap = {0};
+	int triangles[2];
 	unsigned int vertexShader, fragmentShader1, fragmentShader2;
 	unsigned int shaderProgram1, shaderProgram2;
 
@@ -152,26 +161,21 @@ int main(void)
 	glDeleteShader(fragmentShader1);
 	glDeleteShader(fragmentShader2);
 
-	/* VAO and VBO */
-	glGenVertexArrays(2, VAO);
-	glGenBuffers(2, VBO);
-
-	glBindVertexArray(VAO[0]); /* first triangle */
-
-	glBindBuffer(GL_ARRAY_BUFFER, VBO[0]);
-	glBufferData(GL_ARRAY_BUFFER, sizeof(vertices1),
-		     vertices1, GL_STATIC_DRAW);
-
-	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE,
-			      3 * sizeof(float), (void *)0);
-	glEnableVertexAttribArray(0);
+	/* VAO and buffer heap */
+	if (!lgl_bufferHeapInit(&heap, 3 * sizeof(float), 64, 4)) {
+		fprintf(stderr, "Failed to create the buffer heap\n");
+		goto_defer(-1);
+	}
 
-	glBindVertexArray(VAO[1]); /* second triangle */
+	triangles[0] = lgl_bufferHeapAlloc(&heap, 3);
+	triangles[1] = lgl_bufferHeapAlloc(&heap, 3);
+	lgl_bufferHeapUpload(&heap, triangles[0], vertices1, 3);
+	lgl_bufferHeapUpload(&heap, triangles[1], vertices2, 3);
 
-	glBindBuffer(GL_ARRAY_BUFFER, VBO[1]);
-	glBufferData(GL_ARRAY_BUFFER, sizeof(vertices2),
-		     vertices2, GL_STATIC_DRAW);
+	glGenVertexArrays(1, &VAO);
+	glBindVertexArray(VAO);
 
+	glBindBuffer(GL_ARRAY_BUFFER, heap.buffer);
 	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE,
 			      3 * sizeof(float), (void *)0);
 	glEnableVertexAttribArray(0);
@@ -182,13 +186,16 @@ int main(void)
 		glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
 		glClear(GL_COLOR_BUFFER_BIT);
 
+		glBindVertexArray(VAO);
+
+		/* the heap offset is the first vertex of each triangle */
 		glUseProgram(shaderProgram1);
-		glBindVertexArray(VAO[0]);
-		glDrawArrays(GL_TRIANGLES, 0, 3);
+		glDrawArrays(GL_TRIANGLES,
+			     lgl_bufferHeapOffset(&heap, triangles[0]), 3);
 
 		glUseProgram(shaderProgram2);
-		glBindVertexArray(VAO[1]);
-		glDrawArrays(GL_TRIANGLES, 0, 3);
+		glDrawArrays(GL_TRIANGLES,
+			     lgl_bufferHeapOffset(&heap, triangles[1]), 3);
 
 		glfwPollEvents();
 		glfwSwapBuffers(window);
@@ -196,8 +203,8 @@ int main(void)
 
  defer:
 	if (glLoaded) {
-		glDeleteBuffers(2, VBO);
-		glDeleteVertexArrays(2, VAO);
+		lgl_bufferHeapFree(&heap);
+		glDeleteVertexArrays(1, &VAO);
 		glDeleteProgram(shaderProgram1);
 		glDeleteProgram(shaderProgram2);
 	}
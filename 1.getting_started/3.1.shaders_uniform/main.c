@@ -1,8 +1,14 @@
 #include <glad/glad.h>
-#include <GLFW/glfw3.h>
+
+#define LGL_PLATFORM_IMPLEMENTATION
+#include <lgl_platform.h>
+
+#define LGL_GL_TRACE_IMPLEMENTATION
+#include <lgl_gl_trace.h>
 
 #include <math.h>
 #include <stdio.h>
+#include <stdlib.h>
 
 #define goto_defer(value) do { exitCode = (value); goto defer; } while(0)
 
@@ -20,6 +26,7 @@ const char *fragmentShaderSource = "#version 330 core\n"
 
 void onWindowResize(GLFWwindow *window, int width, int height)
 {
+	(void)window;
 	glViewport(0, 0, width, height);
 }
 
@@ -56,6 +63,12 @@ int main(void)
 		goto_defer(-1);
 	}
 	glLoaded = 1;
+
+	/* LGL_GL_TRACE=1 counts every GL call, the report at exit flags the
+	 * redundant glUseProgram and the glGetUniformLocation query in the
+	 * loop; LGL_GL_CAPTURE records them for tools/gl_replay */
+	if (getenv("LGL_GL_TRACE") || getenv("LGL_GL_CAPTURE"))
+		lgl_glTraceInstall();
 	glfwSetFramebufferSizeCallback(window, onWindowResize);
 
 	/* shader creation
@@ -141,6 +154,7 @@ int main(void)
 
 		glfwPollEvents();
 		glfwSwapBuffers(window);
+		lgl_glTraceEndFrame(NULL);
 	}
 
  defer:
@@ -148,6 +162,9 @@ int main(void)
 		glDeleteProgram(shaderProgram);
 		glDeleteBuffers(1, &VBO);
 		glDeleteVertexArrays(1, &VAO);
+
+		lgl_glTracePrint(stdout, 8);
+		lgl_glTraceUninstall();
 	}
 
 	glfwTerminate();
@@ -1,18 +1,25 @@
 #include <glad/glad.h>
-#include <GLFW/glfw3.h>
 
-#define STB_IMAGE_IMPLEMENTATION
-#include <stb_image.h>
+#define LGL_PLATFORM_IMPLEMENTATION
+#include <lgl_platform.h>
+
+#define LGL_STB_IMAGE_IMPLEMENTATION
+#include <lgl_stb_image.h>
 
 #define LGL_SHADER_IMPLEMENTATION
 #include <lgl_shader.h>
 
+#define LGL_PROFILER_IMPLEMENTATION
+#include <lgl_profiler.h>
+
 #include <stdio.h>
+#include <stdlib.h>
 
 #define goto_defer(value) do { exitCode = (value); goto defer; } while (0)
 
 void onWindowResize(GLFWwindow *window, int width, int height)
 {
+	(void)window;
 	glViewport(0, 0, width, height);
 }
 
@@ -28,6 +35,9 @@ int main(void)
 	int texWidth, texHeight, texNrChannels;
 	unsigned char *texData;
 
+	lgl_Profiler profiler;
+	int profiling = 0;
+
 	float vertices[] = {
 		/* positions          colors              texture coords */
 		0.5f,  0.5f, 0.0f,    1.0f, 0.0f, 0.0f,   1.0f, 1.0f, /* top right */
@@ -130,25 +140,45 @@ int main(void)
 	glUseProgram(shaderProgram);
 	glUniform1i(glGetUniformLocation(shaderProgram, "ourTexture"), 0);
 
+	/* profiler, the averages are printed at exit; run with
+	 * LGL_TRACE=trace.json for a Chrome trace of every frame */
+	profiling = 1;
+	if (!lgl_profilerInit(&profiler, getenv("LGL_TRACE"))) goto_defer(-1);
+
 	while (!shouldQuit) {
 		if (glfwWindowShouldClose(window)) shouldQuit = 1;
 
+		lgl_profileBegin(&profiler, "frame");
+
+		lgl_profileBegin(&profiler, "clear");
 		glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
 		glClear(GL_COLOR_BUFFER_BIT);
+		lgl_profileEnd(&profiler);
 
+		lgl_profileBegin(&profiler, "textured quad");
 		glActiveTexture(GL_TEXTURE0);
 		glBindTexture(GL_TEXTURE_2D, texture);
 
 		glUseProgram(shaderProgram);
 		glBindVertexArray(VAO);
 		glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+		lgl_profileEnd(&profiler);
 
+		lgl_profileBegin(&profiler, "swap");
 		glfwPollEvents();
 		glfwSwapBuffers(window);
+		lgl_profileEnd(&profiler);
+
+		lgl_profileEnd(&profiler);
+		lgl_profilerEndFrame(&profiler);
 	}
 
  defer:
 	if (glLoaded) {
+		if (profiling) {
+			lgl_profilerFree(&profiler);
+			lgl_profilerPrint(&profiler, stdout);
+		}
 		glDeleteProgram(shaderProgram);
 		glDeleteTextures(1, &texture);
 		glDeleteVertexArrays(1, &VAO);
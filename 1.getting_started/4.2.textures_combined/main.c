@@ -1,18 +1,31 @@
 #include <glad/glad.h>
-#include <GLFW/glfw3.h>
 
-#define STB_IMAGE_IMPLEMENTATION
-#include <stb_image.h>
+#define LGL_PLATFORM_IMPLEMENTATION
+#include <lgl_platform.h>
+
+/* before stb_image and lgl_shader.h, so their allocations are accounted */
+#define LGL_MEMORY_IMPLEMENTATION
+#include <lgl_memory.h>
+
+#define LGL_STB_IMAGE_IMPLEMENTATION
+#include <lgl_stb_image.h>
 
 #define LGL_SHADER_IMPLEMENTATION
 #include <lgl_shader.h>
 
+#define LGL_DSA_IMPLEMENTATION
+#include <lgl_dsa.h>
+
+#define LGL_VERTEX_LAYOUT_IMPLEMENTATION
+#include <lgl_vertex_layout.h>
+
 #include <stdio.h>
 
 #define goto_defer(value) do { exitCode = (value); goto defer; } while (0)
 
 void onWindowResize(GLFWwindow *window, int width, int height)
 {
+	(void)window;
 	glViewport(0, 0, width, height);
 }
 
@@ -22,7 +35,9 @@ int main(void)
 	GLFWwindow *window = NULL;
 
 	unsigned int vertexShader, fragmentShader, shaderProgram;
-	unsigned int VAO, VBO, EBO;
+	unsigned int VAO = 0, VBO = 0, EBO = 0;
+	lgl_VertexLayout layout;
+	lgl_VaoCache vaoCache = {0};
 
 	unsigned int textures[2];
 	int texWidth, texHeight, texNrChannels;
@@ -63,6 +78,7 @@ int main(void)
 		goto_defer(-1);
 	}
 	glLoaded = 1;
+	lgl_memoryTrackGl();
 	glfwSetFramebufferSizeCallback(window, onWindowResize);
 
 	/* shaders */
@@ -81,31 +97,20 @@ int main(void)
 	glDeleteShader(fragmentShader);
 
 	/* VAO and buffers */
-	glGenVertexArrays(1, &VAO);
-	glGenBuffers(1, &VBO);
-	glGenBuffers(1, &EBO);
-
-	glBindVertexArray(VAO);
-
-	glBindBuffer(GL_ARRAY_BUFFER, VBO);
-	glBufferData(GL_ARRAY_BUFFER, sizeof(vertices),
-		     vertices, GL_STATIC_DRAW);
+	VBO = lgl_createBuffer(sizeof(vertices), vertices, 0);
+	EBO = lgl_createBuffer(sizeof(indices), indices, 0);
 
-	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-	glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices),
-		     indices, GL_STATIC_DRAW);
+	/* offsets and stride follow from the attributes */
+	lgl_vertexLayoutInit(&layout);
+	lgl_vertexLayoutAdd(&layout, 0, 3, GL_FLOAT, GL_FALSE); /* position */
+	lgl_vertexLayoutAdd(&layout, 1, 3, GL_FLOAT, GL_FALSE); /* color */
+	lgl_vertexLayoutAdd(&layout, 2, 2, GL_FLOAT, GL_FALSE); /* texture coord */
 
-	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE,
-			      8 * sizeof(float), (void *)0);
-	glEnableVertexAttribArray(0);
-
-	glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE,
-			      8 * sizeof(float), (void *)(3 * sizeof(float)));
-	glEnableVertexAttribArray(1);
-
-	glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE,
-			      8 * sizeof(float), (void *)(6 * sizeof(float)));
-	glEnableVertexAttribArray(2);
+	if (!lgl_vaoCacheInit(&vaoCache, 1)) {
+		fprintf(stderr, "Failed to allocate the VAO cache\n");
+		goto_defer(-1);
+	}
+	VAO = lgl_vaoCacheBind(&vaoCache, &layout, VBO, 0, EBO);
 
 	/* texture
 	   ******* */
@@ -184,9 +189,14 @@ int main(void)
 	if (glLoaded) {
 		glDeleteProgram(shaderProgram);
 		glDeleteTextures(2, textures);
-		glDeleteVertexArrays(1, &VAO);
+		lgl_vaoCacheFree(&vaoCache);
 		glDeleteBuffers(1, &VBO);
 		glDeleteBuffers(1, &EBO);
+
+		/* everything is released by now */
+		lgl_memoryPrint(stderr);
+		lgl_memoryReportLeaks(stderr);
+		lgl_memoryUntrackGl();
 	}
 	glfwTerminate();
 	return exitCode;
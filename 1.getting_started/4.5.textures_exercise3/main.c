@@ -1,8 +1,10 @@
 #include <glad/glad.h>
-#include <GLFW/glfw3.h>
 
-#define STB_IMAGE_IMPLEMENTATION
-#include <stb_image.h>
+#define LGL_PLATFORM_IMPLEMENTATION
+#include <lgl_platform.h>
+
+#define LGL_STB_IMAGE_IMPLEMENTATION
+#include <lgl_stb_image.h>
 
 #define LGL_SHADER_IMPLEMENTATION
 #include <lgl_shader.h>
@@ -13,6 +15,7 @@
 
 void onWindowResize(GLFWwindow *window, int width, int height)
 {
+	(void)window;
 	glViewport(0, 0, width, height);
 }
 
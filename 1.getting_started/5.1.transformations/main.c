@@ -1,19 +1,29 @@
 #include <glad/glad.h>
-#include <GLFW/glfw3.h>
+
+#define LGL_PLATFORM_IMPLEMENTATION
+#include <lgl_platform.h>
+
 #include <cglm/cglm.h>
 
-#define STB_IMAGE_IMPLEMENTATION
-#include <stb_image.h>
+#define LGL_STB_IMAGE_IMPLEMENTATION
+#include <lgl_stb_image.h>
 
 #define LGL_SHADER_IMPLEMENTATION
 #include <lgl_shader.h>
 
+#define LGL_DSA_IMPLEMENTATION
+#include <lgl_dsa.h>
+
+#define LGL_INDEX_BUFFER_IMPLEMENTATION
+#include <lgl_index_buffer.h>
+
 #include <stdio.h>
 
 #define goto_defer(value) do { exitCode = (value); goto defer; } while(0)
 
 static void onWindowResize(GLFWwindow *window, int width, int height)
 {
+	(void)window;
 	glViewport(0, 0, width, height);
 }
 
@@ -23,9 +33,10 @@ int main(void)
 	GLFWwindow *window = NULL;
 
 	unsigned int vertexShader, fragmentShader, shaderProgram;
-	unsigned int VAO, buffers[2]; /* two buffers - VBO and EBO */
+	unsigned int VAO = 0, buffers[2] = {0}; /* two buffers - VBO and EBO */
+	lgl_IndexBuffer quad = {0};
 
-	unsigned int textures[2];
+	unsigned int textures[2] = {0};
 	int texWidth, texHeight, texNrChannels;
 	unsigned char *texData;
 
@@ -43,6 +54,12 @@ int main(void)
 
 	int transLocation; /* transform uniform location */
 
+	/* the quad's indices in the smallest type that addresses its vertices */
+	if (!lgl_indexBufferBuild(&quad, indices, 6, 4)) {
+		fprintf(stderr, "Failed to build the index buffer\n");
+		goto_defer(-1);
+	}
+
 	glfwInit();
 	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
 	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 6);
@@ -80,70 +97,42 @@ int main(void)
 
 	/* VAO and buffers
 	 *******************/
-	glGenVertexArrays(1, &VAO);
-	glGenBuffers(2, buffers);
-
-	glBindVertexArray(VAO);
-	glBindBuffer(GL_ARRAY_BUFFER, buffers[0]);
-	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers[1]);
+	buffers[0] = lgl_createBuffer(sizeof(vertices), vertices, 0);
+	buffers[1] = lgl_createBuffer(lgl_indexBufferSize(&quad), quad.data, 0);
 
-	glBufferData(GL_ARRAY_BUFFER, sizeof(vertices),
-		     vertices, GL_STATIC_DRAW);
-	glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices),
-		     indices, GL_STATIC_DRAW);
-
-	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE,
-			      5 * sizeof(float), (void *)0);
-	glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE,
-			      5 * sizeof(float), (void *)(3 * sizeof(float)));
-
-	glEnableVertexAttribArray(0);
-	glEnableVertexAttribArray(1);
+	VAO = lgl_createVertexArray();
+	lgl_vertexArrayBuffers(VAO, 0, buffers[0], 0, 5 * sizeof(float),
+			       buffers[1]);
+	lgl_vertexArrayAttrib(VAO, 0, 3, GL_FLOAT, GL_FALSE, 0, 0);
+	lgl_vertexArrayAttrib(VAO, 1, 2, GL_FLOAT, GL_FALSE,
+			      3 * sizeof(float), 0);
 
 	/* texture
 	 ***********/
-	glGenTextures(2, textures);
-
 	/* container texture */
-	glBindTexture(GL_TEXTURE_2D, textures[0]);
-
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
-			GL_LINEAR_MIPMAP_LINEAR);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
 	texData = stbi_load("assets/textures/container.jpg",
 			    &texWidth, &texHeight, &texNrChannels, 0);
 
 	if (texData) {
-		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, texWidth, texHeight, 0,
-			     GL_RGB, GL_UNSIGNED_BYTE, texData);
-		glGenerateMipmap(GL_TEXTURE_2D);
+		textures[0] = lgl_createTexture2D(texWidth, texHeight,
+						  texNrChannels, texData, GL_REPEAT,
+						  GL_LINEAR_MIPMAP_LINEAR, GL_LINEAR);
 		stbi_image_free(texData);
 	} else {
 		fprintf(stderr, "Failed to load texture \"assets/textures/container.jpg\"");
 	}
 
 	/* awesomeface texture */
-	glBindTexture(GL_TEXTURE_2D, textures[1]);
-
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
-			GL_LINEAR_MIPMAP_LINEAR);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
 	texData = stbi_load("assets/textures/awesomeface.png",
 			    &texWidth, &texHeight, &texNrChannels, 0);
 
 	if (texData) {
-		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, texWidth, texHeight, 0,
-			     GL_RGBA, GL_UNSIGNED_BYTE, texData);
-		glGenerateMipmap(GL_TEXTURE_2D);
+		textures[1] = lgl_createTexture2D(texWidth, texHeight,
+						  texNrChannels, texData, GL_REPEAT,
+						  GL_LINEAR_MIPMAP_LINEAR, GL_LINEAR);
 		stbi_image_free(texData);
 	} else {
-		fprintf(stderr, "Failed to load texture \"assets/textures/container.jpg\"");
+		fprintf(stderr, "Failed to load texture \"assets/textures/awesomeface.png\"");
 	}
 
 	/* bind uniforms
@@ -170,16 +159,14 @@ int main(void)
 		glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
 		glClear(GL_COLOR_BUFFER_BIT);
 
-		glActiveTexture(GL_TEXTURE0);
-		glBindTexture(GL_TEXTURE_2D, textures[0]);
-		glActiveTexture(GL_TEXTURE1);
-		glBindTexture(GL_TEXTURE_2D, textures[1]);
+		glBindTextureUnit(0, textures[0]);
+		glBindTextureUnit(1, textures[1]);
 
 		glUseProgram(shaderProgram);
 		glUniformMatrix4fv(transLocation, 1, GL_FALSE, trans[0]);
 
 		glBindVertexArray(VAO);
-		glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+		lgl_indexBufferDraw(&quad);
 
 		glfwPollEvents();
 		glfwSwapBuffers(window);
@@ -192,6 +179,7 @@ int main(void)
 		glDeleteVertexArrays(1, &VAO);
 		glDeleteBuffers(2, buffers);
 	}
+	lgl_indexBufferFree(&quad);
 
 	glfwTerminate();
 	return exitCode;
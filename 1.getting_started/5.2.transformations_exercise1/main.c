@@ -1,19 +1,29 @@
 #include <glad/glad.h>
-#include <GLFW/glfw3.h>
+
+#define LGL_PLATFORM_IMPLEMENTATION
+#include <lgl_platform.h>
+
 #include <cglm/cglm.h>
 
-#define STB_IMAGE_IMPLEMENTATION
-#include <stb_image.h>
+#define LGL_STB_IMAGE_IMPLEMENTATION
+#include <lgl_stb_image.h>
 
 #define LGL_SHADER_IMPLEMENTATION
 #include <lgl_shader.h>
 
+#define LGL_STATE_CACHE_IMPLEMENTATION
+#include <lgl_state_cache.h>
+
+#define LGL_INDEX_BUFFER_IMPLEMENTATION
+#include <lgl_index_buffer.h>
+
 #include <stdio.h>
 
 #define goto_defer(value) do { exitCode = (value); goto defer; } while(0)
 
 static void onWindowResize(GLFWwindow *window, int width, int height)
 {
+	(void)window;
 	glViewport(0, 0, width, height);
 }
 
@@ -24,11 +34,14 @@ int main(void)
 
 	unsigned int vertexShader, fragmentShader, shaderProgram;
 	unsigned int VAO, buffers[2]; /* two buffers - VBO and EBO */
+	lgl_IndexBuffer quad = {0};
 
 	unsigned int textures[2];
 	int texWidth, texHeight, texNrChannels;
 	unsigned char *texData;
 
+	lgl_StateCache state;
+
 	float vertices[] = {
 		/* positions         texture coords */
 		0.5f,  0.5f, 0.0f,    1.0f, 0.0f, /* top right */
@@ -43,6 +56,12 @@ int main(void)
 
 	int transLocation; /* transform uniform location */
 
+	/* the quad's indices in the smallest type that addresses its vertices */
+	if (!lgl_indexBufferBuild(&quad, indices, 6, 4)) {
+		fprintf(stderr, "Failed to build the index buffer\n");
+		goto_defer(-1);
+	}
+
 	glfwInit();
 	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
 	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 6);
@@ -89,8 +108,7 @@ int main(void)
 
 	glBufferData(GL_ARRAY_BUFFER, sizeof(vertices),
 		     vertices, GL_STATIC_DRAW);
-	glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices),
-		     indices, GL_STATIC_DRAW);
+	lgl_indexBufferUpload(&quad, GL_STATIC_DRAW);
 
 	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE,
 			      5 * sizeof(float), (void *)0);
@@ -154,6 +172,9 @@ int main(void)
 	glUniform1i(glGetUniformLocation(shaderProgram, "texture1"), 0);
 	glUniform1i(glGetUniformLocation(shaderProgram, "texture2"), 1);
 
+	/* setup bound things directly, so start from unknown state */
+	lgl_stateInit(&state);
+
 	while (!shouldQuit) {
 		mat4 trans;
 
@@ -170,16 +191,16 @@ int main(void)
 		glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
 		glClear(GL_COLOR_BUFFER_BIT);
 
-		glActiveTexture(GL_TEXTURE0);
-		glBindTexture(GL_TEXTURE_2D, textures[0]);
-		glActiveTexture(GL_TEXTURE1);
-		glBindTexture(GL_TEXTURE_2D, textures[1]);
+		/* only the first frame reaches GL, later ones are dropped */
+		lgl_stateBindTexture(&state, 0, GL_TEXTURE_2D, textures[0]);
+		lgl_stateBindTexture(&state, 1, GL_TEXTURE_2D, textures[1]);
 
-		glUseProgram(shaderProgram);
+		lgl_stateUseProgram(&state, shaderProgram);
 		glUniformMatrix4fv(transLocation, 1, GL_FALSE, trans[0]);
 
-		glBindVertexArray(VAO);
-		glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+		lgl_stateBindVertexArray(&state, VAO);
+		lgl_indexBufferDraw(&quad);
+		lgl_stateEndFrame(&state);
 
 		glfwPollEvents();
 		glfwSwapBuffers(window);
@@ -192,6 +213,7 @@ int main(void)
 		glDeleteVertexArrays(1, &VAO);
 		glDeleteBuffers(2, buffers);
 	}
+	lgl_indexBufferFree(&quad);
 
 	glfwTerminate();
 	return exitCode;
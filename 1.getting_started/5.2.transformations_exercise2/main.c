@@ -1,19 +1,29 @@
 #include <glad/glad.h>
-#include <GLFW/glfw3.h>
+
+#define LGL_PLATFORM_IMPLEMENTATION
+#include <lgl_platform.h>
+
 #include <cglm/cglm.h>
 
-#define STB_IMAGE_IMPLEMENTATION
-#include <stb_image.h>
+#define LGL_STB_IMAGE_IMPLEMENTATION
+#include <lgl_stb_image.h>
 
 #define LGL_SHADER_IMPLEMENTATION
 #include <lgl_shader.h>
 
+#define LGL_INSTANCING_IMPLEMENTATION
+#include <lgl_instancing.h>
+
+#define LGL_INDEX_BUFFER_IMPLEMENTATION
+#include <lgl_index_buffer.h>
+
 #include <stdio.h>
 
 #define goto_defer(value) do { exitCode = (value); goto defer; } while(0)
 
 static void onWindowResize(GLFWwindow *window, int width, int height)
 {
+	(void)window;
 	glViewport(0, 0, width, height);
 }
 
@@ -24,6 +34,7 @@ int main(void)
 
 	unsigned int vertexShader, fragmentShader, shaderProgram;
 	unsigned int VAO, buffers[2]; /* two buffers - VBO and EBO */
+	lgl_IndexBuffer quad = {0};
 
 	unsigned int textures[2];
 	int texWidth, texHeight, texNrChannels;
@@ -41,7 +52,13 @@ int main(void)
 		1, 2, 3
 	};
 
-	int transLocation; /* transform uniform location */
+	lgl_InstanceBuffer containers = {0}; /* one transform per container */
+
+	/* the quad's indices in the smallest type that addresses its vertices */
+	if (!lgl_indexBufferBuild(&quad, indices, 6, 4)) {
+		fprintf(stderr, "Failed to build the index buffer\n");
+		goto_defer(-1);
+	}
 
 	glfwInit();
 	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
@@ -89,8 +106,7 @@ int main(void)
 
 	glBufferData(GL_ARRAY_BUFFER, sizeof(vertices),
 		     vertices, GL_STATIC_DRAW);
-	glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices),
-		     indices, GL_STATIC_DRAW);
+	lgl_indexBufferUpload(&quad, GL_STATIC_DRAW);
 
 	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE,
 			      5 * sizeof(float), (void *)0);
@@ -100,6 +116,13 @@ int main(void)
 	glEnableVertexAttribArray(0);
 	glEnableVertexAttribArray(1);
 
+	/* the transforms are instanced attributes at locations 2 to 5 */
+	if (!lgl_instanceBufferInit(&containers, LGL_INSTANCE_MATRIX, 2)) {
+		fprintf(stderr, "Failed to allocate the instances\n");
+		goto_defer(-1);
+	}
+	lgl_instanceBufferAttach(&containers, 2);
+
 	/* texture
 	 ***********/
 	glGenTextures(2, textures);
@@ -148,8 +171,6 @@ int main(void)
 
 	/* bind uniforms
 	 *****************/
-	transLocation = glGetUniformLocation(shaderProgram, "transform");
-
 	glUseProgram(shaderProgram);
 	glUniform1i(glGetUniformLocation(shaderProgram, "texture1"), 0);
 	glUniform1i(glGetUniformLocation(shaderProgram, "texture2"), 1);
@@ -172,22 +193,25 @@ int main(void)
 		glUseProgram(shaderProgram);
 		glBindVertexArray(VAO);
 
+		lgl_instanceBufferReset(&containers);
+
 		/* first container */
 		glm_mat4_identity(trans);
 		glm_translate(trans, (vec3){0.5f, -0.5f, 0.0f});
 		glm_rotate(trans, (float)glfwGetTime(), (vec3){0.0, 0.0, 1.0});
-
-		glUniformMatrix4fv(transLocation, 1, GL_FALSE, trans[0]);
-		glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+		lgl_instancePushMatrix(&containers, trans);
 
 		/* second container */
 		glm_mat4_identity(trans);
 		glm_translate(trans, (vec3){-0.5f, 0.5f, 0.0f});
 		float scale = (float)sin(glfwGetTime());
 		glm_scale(trans, (vec3){scale, scale, scale});
+		lgl_instancePushMatrix(&containers, trans);
 
-		glUniformMatrix4fv(transLocation, 1, GL_FALSE, trans[0]);
-		glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+		/* both containers in one draw call */
+		lgl_instanceBufferUpload(&containers);
+		lgl_instanceDrawElements(&containers, quad.mode, quad.count,
+					 quad.type);
 
 		glfwPollEvents();
 		glfwSwapBuffers(window);
@@ -199,7 +223,9 @@ int main(void)
 		glDeleteTextures(2, textures);
 		glDeleteVertexArrays(1, &VAO);
 		glDeleteBuffers(2, buffers);
+		lgl_instanceBufferFree(&containers);
 	}
+	lgl_indexBufferFree(&quad);
 
 	glfwTerminate();
 	return exitCode;
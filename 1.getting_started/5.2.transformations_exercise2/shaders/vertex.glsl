@@ -1,13 +1,12 @@
 #version 330 core
 layout (location = 0) in vec3 aPos;
 layout (location = 1) in vec2 aTexCoord;
+layout (location = 2) in mat4 aTransform;
 
 out vec2 TexCoord;
 
-uniform mat4 transform;
-
 void main()
 {
 	TexCoord = aTexCoord;
-	gl_Position = transform * vec4(aPos, 1.0f);
+	gl_Position = aTransform * vec4(aPos, 1.0f);
 }
\ No newline at end of file
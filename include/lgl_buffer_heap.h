@@ -0,0 +1,351 @@
+#ifndef __LGL_BUFFER_HEAP__
+#define __LGL_BUFFER_HEAP__
+
+/* Buffer heap: many small meshes share one large GL buffer instead of a
+ * buffer object each. Space is handed out by a buddy allocator counted in
+ * elements (a vertex of a fixed stride, or an index), so an allocation's
+ * offset is directly the base vertex or first index of a draw and every
+ * mesh can be drawn from the same VAO binding. Allocations are referred
+ * to by handles, which stay valid when lgl_bufferHeapDefragment moves
+ * them to close the holes left by released blocks. */
+
+typedef struct {
+	unsigned int offset;  /* in elements */
+	unsigned int count;   /* elements requested */
+	int level;            /* -1 for an unused handle */
+} lgl_HeapAllocation;
+
+typedef struct {
+	unsigned int buffer;
+	int elementSize;
+	unsigned int capacity;   /* elements, a power of two */
+	unsigned int minBlock;   /* elements of the smallest block */
+	int levelCount;          /* block sizes minBlock << 0 .. levelCount - 1 */
+
+	/* free blocks, linked per level through their first unit */
+	int *freeHead;
+	int *freeNext, *freePrev;
+	signed char *freeLevel;  /* per unit: level of a free block starting here, or -1 */
+
+	lgl_HeapAllocation *allocations;
+	int allocationCount, allocationCapacity;
+	int freeHandle;          /* first unused handle, chained through offset */
+
+	unsigned int usedElements;
+} lgl_BufferHeap;
+
+/* creates a GL buffer of at least `capacity` elements of `elementSize`
+ * bytes, handed out in blocks of at least `minBlock` elements */
+int lgl_bufferHeapInit(lgl_BufferHeap *heap, int elementSize,
+		       unsigned int capacity, unsigned int minBlock);
+
+void lgl_bufferHeapFree(lgl_BufferHeap *heap);
+
+/* returns a handle to `count` elements, or -1 if no block is big enough */
+int lgl_bufferHeapAlloc(lgl_BufferHeap *heap, unsigned int count);
+
+void lgl_bufferHeapRelease(lgl_BufferHeap *heap, int handle);
+
+/* first element of an allocation: the base vertex or first index */
+unsigned int lgl_bufferHeapOffset(const lgl_BufferHeap *heap, int handle);
+
+/* copies `count` elements into an allocation */
+void lgl_bufferHeapUpload(lgl_BufferHeap *heap, int handle,
+			  const void *data, unsigned int count);
+
+/* elements in the largest block that could still be allocated */
+unsigned int lgl_bufferHeapLargestFree(const lgl_BufferHeap *heap);
+
+/* packs every allocation to the start of the buffer, keeping the buffer
+ * object so VAOs stay valid; returns the number of moved allocations */
+int lgl_bufferHeapDefragment(lgl_BufferHeap *heap);
+
+#endif /*__LGL_BUFFER_HEAP__*/
+
+#ifdef LGL_BUFFER_HEAP_IMPLEMENTATION
+
+#include <stdlib.h>
+#include <string.h>
+
+static void lgl__heapPush(lgl_BufferHeap *heap, int unit, int level)
+{
+	heap->freeLevel[unit] = (signed char)level;
+	heap->freePrev[unit] = -1;
+	heap->freeNext[unit] = heap->freeHead[level];
+	if (heap->freeHead[level] >= 0)
+		heap->freePrev[heap->freeHead[level]] = unit;
+	heap->freeHead[level] = unit;
+}
+
+static void lgl__heapUnlink(lgl_BufferHeap *heap, int unit, int level)
+{
+	if (heap->freePrev[unit] >= 0)
+		heap->freeNext[heap->freePrev[unit]] = heap->freeNext[unit];
+	else
+		heap->freeHead[level] = heap->freeNext[unit];
+	if (heap->freeNext[unit] >= 0)
+		heap->freePrev[heap->freeNext[unit]] = heap->freePrev[unit];
+	heap->freeLevel[unit] = -1;
+}
+
+/* resets the allocator to one free block spanning the whole buffer */
+static void lgl__heapReset(lgl_BufferHeap *heap)
+{
+	int i, units = (int)(heap->capacity / heap->minBlock);
+
+	for (i = 0; i < heap->levelCount; i++) heap->freeHead[i] = -1;
+	memset(heap->freeLevel, -1, units);
+	lgl__heapPush(heap, 0, heap->levelCount - 1);
+	heap->usedElements = 0;
+}
+
+/* takes a free block of `level`, splitting bigger ones; returns its unit */
+static int lgl__heapTake(lgl_BufferHeap *heap, int level)
+{
+	int from = level, unit;
+
+	while (from < heap->levelCount && heap->freeHead[from] < 0) from++;
+	if (from == heap->levelCount) return -1;
+
+	unit = heap->freeHead[from];
+	lgl__heapUnlink(heap, unit, from);
+
+	/* keep the lower half, free the upper buddy */
+	while (from > level) {
+		from--;
+		lgl__heapPush(heap, unit + (1 << from), from);
+	}
+
+	return unit;
+}
+
+static void lgl__heapGive(lgl_BufferHeap *heap, int unit, int level)
+{
+	/* merge with the buddy as long as it is free and whole */
+	while (level < heap->levelCount - 1) {
+		int buddy = unit ^ (1 << level);
+
+		if (heap->freeLevel[buddy] != level) break;
+		lgl__heapUnlink(heap, buddy, level);
+		if (buddy < unit) unit = buddy;
+		level++;
+	}
+
+	lgl__heapPush(heap, unit, level);
+}
+
+static int lgl__heapLevelFor(const lgl_BufferHeap *heap, unsigned int count)
+{
+	int level = 0;
+
+	while (level < heap->levelCount && (heap->minBlock << level) < count)
+		level++;
+	return level;
+}
+
+int lgl_bufferHeapInit(lgl_BufferHeap *heap, int elementSize,
+		       unsigned int capacity, unsigned int minBlock)
+{
+	int units;
+
+	memset(heap, 0, sizeof(*heap));
+	heap->elementSize = elementSize;
+	heap->minBlock = minBlock > 0 ? minBlock : 1;
+	heap->freeHandle = -1;
+
+	/* one level per doubling of the block size */
+	heap->levelCount = 1;
+	while ((heap->minBlock << (heap->levelCount - 1)) < capacity)
+		heap->levelCount++;
+	heap->capacity = heap->minBlock << (heap->levelCount - 1);
+	units = (int)(heap->capacity / heap->minBlock);
+
+	heap->freeHead = malloc(sizeof(int) * heap->levelCount);
+	heap->freeNext = malloc(sizeof(int) * units);
+	heap->freePrev = malloc(sizeof(int) * units);
+	heap->freeLevel = malloc(units);
+	if (!heap->freeHead || !heap->freeNext || !heap->freePrev
+	    || !heap->freeLevel) {
+		lgl_bufferHeapFree(heap);
+		return 0;
+	}
+	lgl__heapReset(heap);
+
+	glGenBuffers(1, &heap->buffer);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, heap->buffer);
+	glBufferData(GL_COPY_WRITE_BUFFER,
+		     (GLsizeiptr)heap->capacity * elementSize, NULL,
+		     GL_STATIC_DRAW);
+	return 1;
+}
+
+void lgl_bufferHeapFree(lgl_BufferHeap *heap)
+{
+	if (heap->buffer) glDeleteBuffers(1, &heap->buffer);
+	free(heap->freeHead);
+	free(heap->freeNext);
+	free(heap->freePrev);
+	free(heap->freeLevel);
+	free(heap->allocations);
+	memset(heap, 0, sizeof(*heap));
+}
+
+int lgl_bufferHeapAlloc(lgl_BufferHeap *heap, unsigned int count)
+{
+	lgl_HeapAllocation *allocation;
+	int level = lgl__heapLevelFor(heap, count), unit, handle;
+
+	if (count == 0 || level >= heap->levelCount) return -1;
+
+	/* reserve the handle first, nothing to undo if that fails */
+	if (heap->freeHandle < 0
+	    && heap->allocationCount == heap->allocationCapacity) {
+		int capacity = heap->allocationCapacity ? heap->allocationCapacity * 2 : 64;
+		void *grown = realloc(heap->allocations,
+				      sizeof(*heap->allocations) * capacity);
+
+		if (!grown) return -1;
+		heap->allocations = grown;
+		heap->allocationCapacity = capacity;
+	}
+
+	unit = lgl__heapTake(heap, level);
+	if (unit < 0) return -1;
+
+	if (heap->freeHandle >= 0) {
+		handle = heap->freeHandle;
+		heap->freeHandle = (int)heap->allocations[handle].offset;
+	} else {
+		handle = heap->allocationCount++;
+	}
+
+	allocation = &heap->allocations[handle];
+	allocation->offset = unit * heap->minBlock;
+	allocation->count = count;
+	allocation->level = level;
+	heap->usedElements += heap->minBlock << level;
+	return handle;
+}
+
+void lgl_bufferHeapRelease(lgl_BufferHeap *heap, int handle)
+{
+	lgl_HeapAllocation *allocation;
+
+	if (handle < 0 || handle >= heap->allocationCount) return;
+	allocation = &heap->allocations[handle];
+	if (allocation->level < 0) return;
+
+	lgl__heapGive(heap, (int)(allocation->offset / heap->minBlock),
+		      allocation->level);
+	heap->usedElements -= heap->minBlock << allocation->level;
+
+	allocation->level = -1;
+	allocation->offset = (unsigned int)heap->freeHandle;
+	heap->freeHandle = handle;
+}
+
+unsigned int lgl_bufferHeapOffset(const lgl_BufferHeap *heap, int handle)
+{
+	return heap->allocations[handle].offset;
+}
+
+void lgl_bufferHeapUpload(lgl_BufferHeap *heap, int handle,
+			  const void *data, unsigned int count)
+{
+	const lgl_HeapAllocation *allocation = &heap->allocations[handle];
+
+	if (count > allocation->count) count = allocation->count;
+
+	glBindBuffer(GL_COPY_WRITE_BUFFER, heap->buffer);
+	glBufferSubData(GL_COPY_WRITE_BUFFER,
+			(GLintptr)allocation->offset * heap->elementSize,
+			(GLsizeiptr)count * heap->elementSize, data);
+}
+
+unsigned int lgl_bufferHeapLargestFree(const lgl_BufferHeap *heap)
+{
+	int level;
+
+	for (level = heap->levelCount - 1; level >= 0; level--)
+		if (heap->freeHead[level] >= 0) return heap->minBlock << level;
+	return 0;
+}
+
+static const lgl_HeapAllocation *lgl__heapSortBase;
+
+/* biggest blocks first, then by address */
+static int lgl__heapCompare(const void *a, const void *b)
+{
+	const lgl_HeapAllocation *x = &lgl__heapSortBase[*(const int *)a];
+	const lgl_HeapAllocation *y = &lgl__heapSortBase[*(const int *)b];
+
+	if (x->level != y->level) return y->level - x->level;
+	return x->offset < y->offset ? -1 : x->offset > y->offset;
+}
+
+int lgl_bufferHeapDefragment(lgl_BufferHeap *heap)
+{
+	unsigned int *oldOffsets, end = 0;
+	unsigned int scratch;
+	int *order, live = 0, moved = 0, i;
+
+	order = malloc(sizeof(int) * (heap->allocationCount + 1));
+	oldOffsets = malloc(sizeof(unsigned int) * (heap->allocationCount + 1));
+	if (!order || !oldOffsets) {
+		free(order);
+		free(oldOffsets);
+		return 0;
+	}
+
+	for (i = 0; i < heap->allocationCount; i++) {
+		oldOffsets[i] = heap->allocations[i].offset;
+		if (heap->allocations[i].level >= 0) order[live++] = i;
+	}
+
+	/* placing blocks from the biggest down leaves no holes between them */
+	lgl__heapSortBase = heap->allocations;
+	qsort(order, live, sizeof(int), lgl__heapCompare);
+
+	lgl__heapReset(heap);
+	for (i = 0; i < live; i++) {
+		lgl_HeapAllocation *allocation = &heap->allocations[order[i]];
+		int unit = lgl__heapTake(heap, allocation->level);
+
+		allocation->offset = unit * heap->minBlock;
+		heap->usedElements += heap->minBlock << allocation->level;
+		if (allocation->offset + allocation->count > end)
+			end = allocation->offset + allocation->count;
+		if (allocation->offset != oldOffsets[order[i]]) moved++;
+	}
+
+	/* gather into a scratch buffer, then copy the packed range back */
+	if (moved > 0) {
+		glGenBuffers(1, &scratch);
+		glBindBuffer(GL_COPY_WRITE_BUFFER, scratch);
+		glBufferData(GL_COPY_WRITE_BUFFER, (GLsizeiptr)end * heap->elementSize,
+			     NULL, GL_STREAM_COPY);
+		glBindBuffer(GL_COPY_READ_BUFFER, heap->buffer);
+
+		for (i = 0; i < live; i++) {
+			const lgl_HeapAllocation *allocation =
+				&heap->allocations[order[i]];
+
+			glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER,
+				(GLintptr)oldOffsets[order[i]] * heap->elementSize,
+				(GLintptr)allocation->offset * heap->elementSize,
+				(GLsizeiptr)allocation->count * heap->elementSize);
+		}
+
+		glBindBuffer(GL_COPY_READ_BUFFER, scratch);
+		glBindBuffer(GL_COPY_WRITE_BUFFER, heap->buffer);
+		glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0,
+				    (GLsizeiptr)end * heap->elementSize);
+		glDeleteBuffers(1, &scratch);
+	}
+
+	free(order);
+	free(oldOffsets);
+	return moved;
+}
+
+#endif /*LGL_BUFFER_HEAP_IMPLEMENTATION*/
@@ -0,0 +1,266 @@
+#ifndef __LGL_COMMAND_BUFFER__
+#define __LGL_COMMAND_BUFFER__
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Recorded draw and state commands. Recording is plain memory writes into
+ * a linear, growable buffer with no GL calls, so every worker thread can
+ * fill its own buffer while the thread owning the context replays them in
+ * order with lgl_commandBufferExecute. A command is one header word
+ * (type << 24 | length in words) followed by its arguments as 32-bit
+ * words. Replay goes through an lgl_StateCache when given one, so include
+ * lgl_state_cache.h first. */
+
+enum {
+	LGL_CMD_USE_PROGRAM,
+	LGL_CMD_BIND_TEXTURE,
+	LGL_CMD_BIND_VERTEX_ARRAY,
+	LGL_CMD_ENABLE,
+	LGL_CMD_DISABLE,
+	LGL_CMD_UNIFORM_4F,
+	LGL_CMD_UNIFORM_MATRIX_4F,
+	LGL_CMD_DRAW_ARRAYS,
+	LGL_CMD_DRAW_ELEMENTS
+};
+
+typedef struct {
+	uint32_t *words;
+	size_t count, capacity; /* in words */
+	int failed;             /* a command was dropped for lack of memory;
+				 * later ones are dropped too until reset */
+} lgl_CommandBuffer;
+
+int lgl_commandBufferInit(lgl_CommandBuffer *commands, size_t capacity);
+void lgl_commandBufferFree(lgl_CommandBuffer *commands);
+void lgl_commandBufferReset(lgl_CommandBuffer *commands);
+
+void lgl_cmdUseProgram(lgl_CommandBuffer *commands, unsigned int program);
+void lgl_cmdBindTexture(lgl_CommandBuffer *commands, unsigned int unit,
+			unsigned int target, unsigned int texture);
+void lgl_cmdBindVertexArray(lgl_CommandBuffer *commands, unsigned int vao);
+void lgl_cmdEnable(lgl_CommandBuffer *commands, unsigned int capability);
+void lgl_cmdDisable(lgl_CommandBuffer *commands, unsigned int capability);
+
+/* the values are copied into the buffer */
+void lgl_cmdUniform4f(lgl_CommandBuffer *commands, int location,
+		      const float *value);
+void lgl_cmdUniformMatrix4f(lgl_CommandBuffer *commands, int location,
+			    const float *value);
+
+void lgl_cmdDrawArrays(lgl_CommandBuffer *commands, unsigned int mode,
+		       int first, int count);
+/* `offset` in bytes into the bound index buffer */
+void lgl_cmdDrawElements(lgl_CommandBuffer *commands, unsigned int mode,
+			 int count, unsigned int type, size_t offset);
+
+/* replays the buffer on the GL thread; `state` may be NULL */
+void lgl_commandBufferExecute(const lgl_CommandBuffer *commands,
+			      lgl_StateCache *state);
+
+#endif /*__LGL_COMMAND_BUFFER__*/
+
+#ifdef LGL_COMMAND_BUFFER_IMPLEMENTATION
+
+#include <stdlib.h>
+#include <string.h>
+
+int lgl_commandBufferInit(lgl_CommandBuffer *commands, size_t capacity)
+{
+	memset(commands, 0, sizeof(*commands));
+	if (capacity < 64) capacity = 64;
+
+	commands->words = malloc(capacity * sizeof(*commands->words));
+	if (!commands->words) return 0;
+
+	commands->capacity = capacity;
+	return 1;
+}
+
+void lgl_commandBufferFree(lgl_CommandBuffer *commands)
+{
+	free(commands->words);
+	memset(commands, 0, sizeof(*commands));
+}
+
+void lgl_commandBufferReset(lgl_CommandBuffer *commands)
+{
+	commands->count = 0;
+	commands->failed = 0;
+}
+
+/* reserves a command of `length` argument words, NULL if out of memory
+ * or if an earlier command was dropped, since replaying the rest of the
+ * stream without it would use the wrong state */
+static uint32_t *lgl__cmdPush(lgl_CommandBuffer *commands, uint32_t type,
+			      size_t length)
+{
+	uint32_t *command;
+
+	if (commands->failed) return NULL;
+	if (commands->count + 1 + length > commands->capacity) {
+		size_t capacity = commands->capacity * 2 + 1 + length;
+		uint32_t *words = realloc(commands->words,
+					  capacity * sizeof(*words));
+
+		if (!words) {
+			commands->failed = 1;
+			return NULL;
+		}
+		commands->words = words;
+		commands->capacity = capacity;
+	}
+
+	command = commands->words + commands->count;
+	command[0] = type << 24 | (uint32_t)length;
+	commands->count += 1 + length;
+	return command + 1;
+}
+
+static void lgl__cmdWords1(lgl_CommandBuffer *commands, uint32_t type,
+			   uint32_t a)
+{
+	uint32_t *args = lgl__cmdPush(commands, type, 1);
+
+	if (args) args[0] = a;
+}
+
+void lgl_cmdUseProgram(lgl_CommandBuffer *commands, unsigned int program)
+{
+	lgl__cmdWords1(commands, LGL_CMD_USE_PROGRAM, program);
+}
+
+void lgl_cmdBindTexture(lgl_CommandBuffer *commands, unsigned int unit,
+			unsigned int target, unsigned int texture)
+{
+	uint32_t *args = lgl__cmdPush(commands, LGL_CMD_BIND_TEXTURE, 3);
+
+	if (!args) return;
+	args[0] = unit;
+	args[1] = target;
+	args[2] = texture;
+}
+
+void lgl_cmdBindVertexArray(lgl_CommandBuffer *commands, unsigned int vao)
+{
+	lgl__cmdWords1(commands, LGL_CMD_BIND_VERTEX_ARRAY, vao);
+}
+
+void lgl_cmdEnable(lgl_CommandBuffer *commands, unsigned int capability)
+{
+	lgl__cmdWords1(commands, LGL_CMD_ENABLE, capability);
+}
+
+void lgl_cmdDisable(lgl_CommandBuffer *commands, unsigned int capability)
+{
+	lgl__cmdWords1(commands, LGL_CMD_DISABLE, capability);
+}
+
+void lgl_cmdUniform4f(lgl_CommandBuffer *commands, int location,
+		      const float *value)
+{
+	uint32_t *args = lgl__cmdPush(commands, LGL_CMD_UNIFORM_4F, 5);
+
+	if (!args) return;
+	args[0] = (uint32_t)location;
+	memcpy(args + 1, value, 4 * sizeof(float));
+}
+
+void lgl_cmdUniformMatrix4f(lgl_CommandBuffer *commands, int location,
+			    const float *value)
+{
+	uint32_t *args = lgl__cmdPush(commands, LGL_CMD_UNIFORM_MATRIX_4F, 17);
+
+	if (!args) return;
+	args[0] = (uint32_t)location;
+	memcpy(args + 1, value, 16 * sizeof(float));
+}
+
+void lgl_cmdDrawArrays(lgl_CommandBuffer *commands, unsigned int mode,
+		       int first, int count)
+{
+	uint32_t *args = lgl__cmdPush(commands, LGL_CMD_DRAW_ARRAYS, 3);
+
+	if (!args) return;
+	args[0] = mode;
+	args[1] = (uint32_t)first;
+	args[2] = (uint32_t)count;
+}
+
+void lgl_cmdDrawElements(lgl_CommandBuffer *commands, unsigned int mode,
+			 int count, unsigned int type, size_t offset)
+{
+	uint32_t *args = lgl__cmdPush(commands, LGL_CMD_DRAW_ELEMENTS, 4);
+
+	if (!args) return;
+	args[0] = mode;
+	args[1] = (uint32_t)count;
+	args[2] = type;
+	args[3] = (uint32_t)offset;
+}
+
+void lgl_commandBufferExecute(const lgl_CommandBuffer *commands,
+			      lgl_StateCache *state)
+{
+	const uint32_t *command = commands->words;
+	const uint32_t *end = commands->words + commands->count;
+
+	while (command < end) {
+		const uint32_t *args = command + 1;
+		float values[16];
+
+		switch (command[0] >> 24) {
+		case LGL_CMD_USE_PROGRAM:
+			if (state)
+				lgl_stateUseProgram(state, args[0]);
+			else
+				glUseProgram(args[0]);
+			break;
+		case LGL_CMD_BIND_TEXTURE:
+			if (state) {
+				lgl_stateBindTexture(state, args[0], args[1], args[2]);
+			} else {
+				glActiveTexture(GL_TEXTURE0 + args[0]);
+				glBindTexture(args[1], args[2]);
+			}
+			break;
+		case LGL_CMD_BIND_VERTEX_ARRAY:
+			if (state)
+				lgl_stateBindVertexArray(state, args[0]);
+			else
+				glBindVertexArray(args[0]);
+			break;
+		case LGL_CMD_ENABLE:
+			if (state)
+				lgl_stateEnable(state, args[0]);
+			else
+				glEnable(args[0]);
+			break;
+		case LGL_CMD_DISABLE:
+			if (state)
+				lgl_stateDisable(state, args[0]);
+			else
+				glDisable(args[0]);
+			break;
+		case LGL_CMD_UNIFORM_4F:
+			memcpy(values, args + 1, 4 * sizeof(float));
+			glUniform4fv((int)args[0], 1, values);
+			break;
+		case LGL_CMD_UNIFORM_MATRIX_4F:
+			memcpy(values, args + 1, 16 * sizeof(float));
+			glUniformMatrix4fv((int)args[0], 1, GL_FALSE, values);
+			break;
+		case LGL_CMD_DRAW_ARRAYS:
+			glDrawArrays(args[0], (int)args[1], (int)args[2]);
+			break;
+		case LGL_CMD_DRAW_ELEMENTS:
+			glDrawElements(args[0], (int)args[1], args[2],
+				       (void *)(size_t)args[3]);
+			break;
+		}
+
+		command += 1 + (command[0] & 0xFFFFFF);
+	}
+}
+
+#endif /*LGL_COMMAND_BUFFER_IMPLEMENTATION*/
@@ -0,0 +1,177 @@
+#ifndef __LGL_DSA__
+#define __LGL_DSA__
+
+#include <stddef.h>
+
+/* Direct State Access helpers (GL 4.5+): resources are created and edited
+ * through their names with glCreate*, glNamed* and gl*Texture*, so
+ * nothing has to be bound just to be filled in, and setting up one object
+ * never disturbs the bindings a draw relies on. Every function returns the
+ * new object name, or 0 on failure. */
+
+/* immutable storage; `flags` as for glNamedBufferStorage, e.g. 0 for
+ * static data or GL_DYNAMIC_STORAGE_BIT to allow glNamedBufferSubData */
+unsigned int lgl_createBuffer(size_t size, const void *data, unsigned int flags);
+
+unsigned int lgl_createVertexArray(void);
+
+/* describes and enables one attribute read from `binding`, with the
+ * format call its type needs: float (converted or normalized), integer
+ * or double */
+void lgl_vertexArrayAttrib(unsigned int vao, unsigned int location, int size,
+			   unsigned int type, int normalized,
+			   unsigned int offset, unsigned int binding);
+
+/* attaches a vertex buffer to `binding` and, if not 0, the index buffer */
+void lgl_vertexArrayBuffers(unsigned int vao, unsigned int binding,
+			    unsigned int vbo, size_t offset, int stride,
+			    unsigned int ebo);
+
+/* 8-bit texture with 1 to 4 channels and a full mip chain when
+ * `minFilter` uses mipmaps; `pixels` may be NULL for a render target */
+unsigned int lgl_createTexture2D(int width, int height, int channels,
+				 const void *pixels, unsigned int wrap,
+				 unsigned int minFilter, unsigned int magFilter);
+
+unsigned int lgl_createRenderbuffer(unsigned int internalFormat,
+				    int width, int height);
+
+/* framebuffer with one color texture and an optional depth-stencil
+ * renderbuffer; returns 0 if it is incomplete */
+unsigned int lgl_createFramebuffer(unsigned int colorTexture,
+				   unsigned int depthStencil);
+
+#endif /*__LGL_DSA__*/
+
+#ifdef LGL_DSA_IMPLEMENTATION
+
+#include <stdio.h>
+
+unsigned int lgl_createBuffer(size_t size, const void *data, unsigned int flags)
+{
+	unsigned int buffer = 0;
+
+	glCreateBuffers(1, &buffer);
+	if (buffer) glNamedBufferStorage(buffer, (GLsizeiptr)size, data, flags);
+	return buffer;
+}
+
+unsigned int lgl_createVertexArray(void)
+{
+	unsigned int vao = 0;
+
+	glCreateVertexArrays(1, &vao);
+	return vao;
+}
+
+void lgl_vertexArrayAttrib(unsigned int vao, unsigned int location, int size,
+			   unsigned int type, int normalized,
+			   unsigned int offset, unsigned int binding)
+{
+	glEnableVertexArrayAttrib(vao, location);
+	/* the packed types are only read as floats */
+	if (type == GL_FLOAT || type == GL_HALF_FLOAT || normalized
+	    || type == GL_INT_2_10_10_10_REV
+	    || type == GL_UNSIGNED_INT_2_10_10_10_REV
+	    || type == GL_UNSIGNED_INT_10F_11F_11F_REV)
+		glVertexArrayAttribFormat(vao, location, size, type,
+					  normalized ? GL_TRUE : GL_FALSE, offset);
+	else if (type == GL_DOUBLE)
+		glVertexArrayAttribLFormat(vao, location, size, type, offset);
+	else
+		glVertexArrayAttribIFormat(vao, location, size, type, offset);
+	glVertexArrayAttribBinding(vao, location, binding);
+}
+
+void lgl_vertexArrayBuffers(unsigned int vao, unsigned int binding,
+			    unsigned int vbo, size_t offset, int stride,
+			    unsigned int ebo)
+{
+	glVertexArrayVertexBuffer(vao, binding, vbo, (GLintptr)offset, stride);
+	if (ebo) glVertexArrayElementBuffer(vao, ebo);
+}
+
+unsigned int lgl_createTexture2D(int width, int height, int channels,
+				 const void *pixels, unsigned int wrap,
+				 unsigned int minFilter, unsigned int magFilter)
+{
+	static const unsigned int internalFormats[4] = {
+		GL_R8, GL_RG8, GL_RGB8, GL_RGBA8
+	};
+	static const unsigned int formats[4] = {
+		GL_RED, GL_RG, GL_RGB, GL_RGBA
+	};
+	unsigned int texture = 0;
+	int levels = 1;
+
+	if (channels < 1 || channels > 4) return 0;
+
+	if (minFilter != GL_NEAREST && minFilter != GL_LINEAR) {
+		int size = width > height ? width : height;
+
+		while (size > 1) {
+			size >>= 1;
+			levels++;
+		}
+	}
+
+	glCreateTextures(GL_TEXTURE_2D, 1, &texture);
+	if (!texture) return 0;
+
+	glTextureParameteri(texture, GL_TEXTURE_WRAP_S, wrap);
+	glTextureParameteri(texture, GL_TEXTURE_WRAP_T, wrap);
+	glTextureParameteri(texture, GL_TEXTURE_MIN_FILTER, minFilter);
+	glTextureParameteri(texture, GL_TEXTURE_MAG_FILTER, magFilter);
+	glTextureStorage2D(texture, levels, internalFormats[channels - 1],
+			   width, height);
+
+	if (pixels) {
+		/* rows of 1 and 3 channel images are not 4-byte aligned */
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+		glTextureSubImage2D(texture, 0, 0, 0, width, height,
+				    formats[channels - 1], GL_UNSIGNED_BYTE, pixels);
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+		if (levels > 1) glGenerateTextureMipmap(texture);
+	}
+
+	return texture;
+}
+
+unsigned int lgl_createRenderbuffer(unsigned int internalFormat,
+				    int width, int height)
+{
+	unsigned int renderbuffer = 0;
+
+	glCreateRenderbuffers(1, &renderbuffer);
+	if (renderbuffer)
+		glNamedRenderbufferStorage(renderbuffer, internalFormat,
+					   width, height);
+	return renderbuffer;
+}
+
+unsigned int lgl_createFramebuffer(unsigned int colorTexture,
+				   unsigned int depthStencil)
+{
+	unsigned int framebuffer = 0, status;
+
+	glCreateFramebuffers(1, &framebuffer);
+	if (!framebuffer) return 0;
+
+	glNamedFramebufferTexture(framebuffer, GL_COLOR_ATTACHMENT0,
+				  colorTexture, 0);
+	if (depthStencil)
+		glNamedFramebufferRenderbuffer(framebuffer,
+					       GL_DEPTH_STENCIL_ATTACHMENT,
+					       GL_RENDERBUFFER, depthStencil);
+
+	status = glCheckNamedFramebufferStatus(framebuffer, GL_FRAMEBUFFER);
+	if (status != GL_FRAMEBUFFER_COMPLETE) {
+		fprintf(stderr, "Framebuffer incomplete (0x%x)\n", status);
+		glDeleteFramebuffers(1, &framebuffer);
+		return 0;
+	}
+
+	return framebuffer;
+}
+
+#endif /*LGL_DSA_IMPLEMENTATION*/
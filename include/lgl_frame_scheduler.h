@@ -0,0 +1,112 @@
+#ifndef __LGL_FRAME_SCHEDULER__
+#define __LGL_FRAME_SCHEDULER__
+
+/* Frame pacing with a fence per frame. lgl_frameBegin blocks until few
+ * enough earlier frames are still on the GPU, lgl_frameEnd fences the
+ * frame and flushes it so the GPU starts on it while the CPU goes on to
+ * simulate the next one. Without this the driver decides on its own how
+ * far the CPU may run ahead and where it blocks.
+ *
+ * LGL_FRAME_LATENCY waits for the previous frame before starting a new
+ * one: input is sampled as late as possible but CPU and GPU take turns.
+ * LGL_FRAME_THROUGHPUT lets up to `framesInFlight` frames queue up so both
+ * stay busy, at the cost of that many frames of extra latency. */
+
+#define LGL_FRAMES_MAX 4
+
+enum { LGL_FRAME_LATENCY, LGL_FRAME_THROUGHPUT };
+
+typedef struct {
+	int mode;                /* may be changed between frames */
+	int framesInFlight;      /* for LGL_FRAME_THROUGHPUT, 1 to 3 */
+
+	unsigned long frame;     /* of the frame being built, from 1 */
+	unsigned long completed; /* last frame known to be done on the GPU */
+	void *fences[LGL_FRAMES_MAX]; /* GLsync, by frame % LGL_FRAMES_MAX */
+
+	unsigned long waits;     /* frames that had to wait for the GPU */
+} lgl_FrameScheduler;
+
+void lgl_frameSchedulerInit(lgl_FrameScheduler *frames, int mode,
+			    int framesInFlight);
+void lgl_frameSchedulerFree(lgl_FrameScheduler *frames);
+
+/* waits as the mode requires and returns the number of the new frame;
+ * every frame before `frames->completed` has finished on the GPU */
+unsigned long lgl_frameBegin(lgl_FrameScheduler *frames);
+
+/* call after the frame's last GL command, before swapping */
+void lgl_frameEnd(lgl_FrameScheduler *frames);
+
+#endif /*__LGL_FRAME_SCHEDULER__*/
+
+#ifdef LGL_FRAME_SCHEDULER_IMPLEMENTATION
+
+#include <string.h>
+
+void lgl_frameSchedulerInit(lgl_FrameScheduler *frames, int mode,
+			    int framesInFlight)
+{
+	memset(frames, 0, sizeof(*frames));
+
+	if (framesInFlight < 1) framesInFlight = 1;
+	if (framesInFlight > LGL_FRAMES_MAX - 1)
+		framesInFlight = LGL_FRAMES_MAX - 1;
+
+	frames->mode = mode;
+	frames->framesInFlight = framesInFlight;
+}
+
+void lgl_frameSchedulerFree(lgl_FrameScheduler *frames)
+{
+	int i;
+
+	for (i = 0; i < LGL_FRAMES_MAX; i++)
+		if (frames->fences[i]) glDeleteSync(frames->fences[i]);
+	memset(frames, 0, sizeof(*frames));
+}
+
+unsigned long lgl_frameBegin(lgl_FrameScheduler *frames)
+{
+	unsigned long inFlight = frames->mode == LGL_FRAME_LATENCY
+		? 0 : (unsigned long)frames->framesInFlight;
+	int waited = 0;
+
+	frames->frame++;
+
+	/* the GPU finishes frames in order, so retire the oldest first */
+	while (frames->completed + 1 + inFlight < frames->frame) {
+		unsigned long oldest = frames->completed + 1;
+		GLsync fence = frames->fences[oldest % LGL_FRAMES_MAX];
+
+		if (fence) {
+			/* poll first to count stalls, then block */
+			GLenum status = glClientWaitSync(fence, 0, 0);
+
+			if (status == GL_TIMEOUT_EXPIRED) waited = 1;
+			while (status == GL_TIMEOUT_EXPIRED)
+				status = glClientWaitSync(fence,
+							  GL_SYNC_FLUSH_COMMANDS_BIT,
+							  1000000);
+			glDeleteSync(fence);
+			frames->fences[oldest % LGL_FRAMES_MAX] = NULL;
+		}
+		frames->completed = oldest;
+	}
+
+	if (waited) frames->waits++;
+	return frames->frame;
+}
+
+void lgl_frameEnd(lgl_FrameScheduler *frames)
+{
+	int slot = (int)(frames->frame % LGL_FRAMES_MAX);
+
+	if (frames->fences[slot]) glDeleteSync(frames->fences[slot]);
+	frames->fences[slot] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+	/* get the frame to the GPU now rather than at the next sync point */
+	glFlush();
+}
+
+#endif /*LGL_FRAME_SCHEDULER_IMPLEMENTATION*/
@@ -0,0 +1,675 @@
+#ifndef __LGL_GL_TRACE__
+#define __LGL_GL_TRACE__
+
+#include <stdio.h>
+
+/* GL call interception. glad calls GL through one function pointer per
+ * entry point (glad_glDrawElements, ...); lgl_glTraceInstall points each
+ * of them at a generated wrapper that counts and times the call before
+ * passing it on. On top of that:
+ *
+ *  - state setters (bind, enable, blend/depth state, ...) remember the
+ *    value they set, and setting the same value again counts as redundant;
+ *  - calls that read back from the driver or wait for the GPU (glGet*,
+ *    glIs*, glReadPixels, glFinish, glClientWaitSync, glMapBuffer*, ...)
+ *    count as synchronous and are flagged when made inside the frame loop.
+ *
+ * The wrappers come from tools/gl_trace_gen.py, which writes
+ * lgl_gl_trace_gen.h; rerun it after regenerating glad. Timing uses
+ * clock_gettime, so build with _POSIX_C_SOURCE defined. Calls are
+ * expected on a single thread.
+ *
+ * The wrappers can also capture the calls into a file that
+ * tools/gl_replay plays back, to profile a frame away from the
+ * application. A capture starts at lgl_glTraceInstall, when
+ * LGL_GL_CAPTURE names the file (with LGL_GL_CAPTURE_FRAME, default 1, as
+ * the frame), or at lgl_glTraceCapture right after it, and holds every
+ * call up to the end of that frame. Objects created before install are
+ * not in it, so install right after loading GL. Pointer arguments are stored as the data
+ * they point to, or as offsets while a buffer is bound for them (vertex
+ * attributes, indices, pixel unpack). Writes through mapped buffers are
+ * not seen, and the few calls whose data size is unknown are recorded as
+ * lossy and skipped by the replayer.
+ *
+ * File format, in the byte order of the capturing machine:
+ *
+ *   "LGLGLCAP", u32 version, i32 width, height (the viewport at start),
+ *   i32 GL major, minor version, u32 entry point count, and per entry
+ *   point a u16 name length and the name;
+ *   then per call a u16 entry point, with LGL_GL_CAPTURE_LOSSY set when
+ *   the arguments were not stored, else the arguments in order and the
+ *   return value: scalars as in memory, GLsync as u64, pointers as a u8
+ *   tag (LGL_GL_CAPTURE_NULL, ...) and what the tag says, data padded to
+ *   start at a multiple of 8 bytes in the file;
+ *   after each frame LGL_GL_CAPTURE_FRAME_END and the u32 frame number. */
+
+#define LGL_GL_CAPTURE_VERSION 1
+#define LGL_GL_CAPTURE_LOSSY 0x8000
+#define LGL_GL_CAPTURE_FRAME_END 0xffff
+
+enum {
+	LGL_GL_CAPTURE_NULL,     /* NULL, or a dropped callback */
+	LGL_GL_CAPTURE_OFFSET,   /* u64, an offset into a bound buffer */
+	LGL_GL_CAPTURE_DATA,     /* u32 size, data */
+	LGL_GL_CAPTURE_OUTPUT,   /* u32 size GL writes, 0 if unknown */
+	LGL_GL_CAPTURE_STRINGS,  /* u32 count, per string u32 length and the
+				  * string with its terminating 0 */
+	LGL_GL_CAPTURE_RECORD    /* u32 size, what GL wrote (new names) */
+};
+
+typedef struct {
+	unsigned long calls, redundant, sync;
+	double seconds;           /* inside GL calls */
+} lgl_GlTraceStats;
+
+/* call after gladLoadGL*; returns 0 if already installed */
+int lgl_glTraceInstall(void);
+
+/* puts the real functions back into glad's pointers; while one of them
+ * was hooked again since (lgl_memory.h) and still chains through the
+ * wrappers, the trace stays installed, to be uninstalled after that */
+void lgl_glTraceUninstall(void);
+
+/* call once per frame, after swapping; `frame` (may be NULL) receives
+ * the totals of the frame that ended, whose GL time also goes to the
+ * headless platform's benchmark when lgl_platform.h is included first.
+ * The first frame, which includes setup, is left out of the per-entry
+ * point statistics. */
+void lgl_glTraceEndFrame(lgl_GlTraceStats *frame);
+
+/* the `top` entry points by time spent in them, per frame, followed by
+ * every entry point with redundant or synchronous calls */
+void lgl_glTracePrint(FILE *file, int top);
+
+/* captures every call from install to the end of frame `frame` (counting
+ * lgl_glTraceEndFrame calls since install) into `path`; returns 0 if the
+ * file cannot be written, a capture is running or GL was called since
+ * install, since the capture would miss the state those calls set */
+int lgl_glTraceCapture(const char *path, unsigned long frame);
+
+#endif /*__LGL_GL_TRACE__*/
+
+/* the headless lgl_platform.h implementation includes this one too */
+#if defined(LGL_GL_TRACE_IMPLEMENTATION) \
+	&& !defined(__LGL_GL_TRACE_IMPLEMENTATION__)
+#define __LGL_GL_TRACE_IMPLEMENTATION__
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define LGL__GL_TRACE_STATE_SLOTS 256 /* a power of two */
+#define LGL__GL_TRACE_UNKNOWN (~(GLuint64)0) /* a value nothing sets */
+
+typedef struct {
+	unsigned long calls, redundant, sync;
+	double seconds;
+} lgl__GlTraceCounters;
+
+typedef struct {
+	int used, owner;
+	GLuint64 key, value;
+} lgl__GlTraceState;
+
+static struct {
+	int installed;
+	unsigned long frames;     /* ended, the first one not included */
+	int depth;                /* > 0 inside a wrapped call */
+	unsigned int activeTexture, vertexArray;
+
+	FILE *capture;            /* NULL unless capturing */
+	unsigned long captureFrame, captureOffset;
+	int captureFailed;
+
+	lgl_GlTraceStats frame;
+	lgl__GlTraceCounters *counters; /* by entry point */
+	lgl__GlTraceState states[LGL__GL_TRACE_STATE_SLOTS];
+} lgl__glTrace;
+
+static double lgl__glTraceNow(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (double)now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+static double lgl__glTraceEnter(int index)
+{
+	(void)index;
+	lgl__glTrace.depth++;
+	return lgl__glTraceNow();
+}
+
+/* `sync` is 1 for calls that wait on the driver */
+static void lgl__glTraceLeave(int index, int sync, double start)
+{
+	lgl__GlTraceCounters *counters = &lgl__glTrace.counters[index];
+	double seconds = lgl__glTraceNow() - start;
+
+	/* GL calls made by GL itself, e.g. through a debug callback, are
+	 * already inside the outer call's time */
+	if (--lgl__glTrace.depth) return;
+
+	counters->calls++;
+	counters->seconds += seconds;
+	lgl__glTrace.frame.calls++;
+	lgl__glTrace.frame.seconds += seconds;
+
+	/* setup before the first frame may query all it wants */
+	if (sync && lgl__glTrace.frames) {
+		counters->sync++;
+		lgl__glTrace.frame.sync++;
+	}
+}
+
+/* records `value` for `key` of the state shared by `owner`; returns 1
+ * if it was set already */
+static int lgl__glTraceSet(int owner, GLuint64 key, GLuint64 value)
+{
+	unsigned int hash = (unsigned int)(owner * 31 + key * 2654435761u);
+	int i = (int)(hash & (LGL__GL_TRACE_STATE_SLOTS - 1)), probes;
+	lgl__GlTraceState *state;
+
+	for (probes = 0; probes < LGL__GL_TRACE_STATE_SLOTS; probes++) {
+		state = &lgl__glTrace.states[i];
+		if (!state->used || (state->owner == owner && state->key == key))
+			break;
+		i = (i + 1) & (LGL__GL_TRACE_STATE_SLOTS - 1);
+	}
+	/* full: that much distinct state is not worth tracking */
+	if (probes == LGL__GL_TRACE_STATE_SLOTS) return 0;
+
+	if (state->used && state->value == value) return 1;
+
+	state->used = 1;
+	state->owner = owner;
+	state->key = key;
+	state->value = value;
+	return 0;
+}
+
+/* lgl__glTraceSet for a setter, counting it when redundant */
+static void lgl__glTraceState(int index, int owner, GLuint64 key, GLuint64 value)
+{
+	if (lgl__glTraceSet(owner, key, value)) {
+		lgl__glTrace.counters[index].redundant++;
+		lgl__glTrace.frame.redundant++;
+	}
+}
+
+/* GL_FRAMEBUFFER binds both the read and the draw framebuffer */
+static void lgl__glTraceBindFramebuffer(int index, int owner, GLenum target,
+					GLuint framebuffer)
+{
+	if (target != GL_FRAMEBUFFER) {
+		lgl__glTraceState(index, owner, target, framebuffer);
+		return;
+	}
+	if (lgl__glTraceSet(owner, GL_READ_FRAMEBUFFER, framebuffer)
+	    & lgl__glTraceSet(owner, GL_DRAW_FRAMEBUFFER, framebuffer)) {
+		lgl__glTrace.counters[index].redundant++;
+		lgl__glTrace.frame.redundant++;
+	}
+}
+
+/* deleted objects are unbound and their names reused, so binding one of
+ * `names` again is not redundant; entries are marked unknown rather than
+ * freed, which would break the probe sequences */
+static void lgl__glTraceForget(int owner, GLsizei n, const GLuint *names)
+{
+	int i, j;
+
+	for (i = 0; i < LGL__GL_TRACE_STATE_SLOTS; i++) {
+		lgl__GlTraceState *state = &lgl__glTrace.states[i];
+
+		if (!state->used || state->owner != owner) continue;
+		for (j = 0; j < n; j++)
+			if (state->value == names[j])
+				state->value = LGL__GL_TRACE_UNKNOWN;
+	}
+}
+
+/* also forgets the element buffers of deleted vertex arrays, which
+ * lgl__glTraceSet keys by vertex array under `bufferOwner` */
+static void lgl__glTraceForgetVertexArrays(int bufferOwner, GLsizei n,
+					   const GLuint *arrays)
+{
+	int i, j;
+
+	for (j = 0; j < n; j++)
+		if (arrays[j] == lgl__glTrace.vertexArray)
+			lgl__glTrace.vertexArray = 0;
+
+	for (i = 0; i < LGL__GL_TRACE_STATE_SLOTS; i++) {
+		lgl__GlTraceState *state = &lgl__glTrace.states[i];
+
+		if (!state->used || state->owner != bufferOwner
+		    || (GLenum)state->key != GL_ELEMENT_ARRAY_BUFFER)
+			continue;
+		for (j = 0; j < n; j++)
+			if (state->key >> 32 == arrays[j])
+				state->value = LGL__GL_TRACE_UNKNOWN;
+	}
+}
+
+/* the capture helpers query state past the wrappers; a tentative
+ * definition, lgl_gl_trace_gen.h has the same one */
+static PFNGLGETINTEGERVPROC lgl__glReal_glGetIntegerv;
+
+static void lgl__glCaptureWrite(const void *data, size_t bytes)
+{
+	if (bytes && fwrite(data, 1, bytes, lgl__glTrace.capture) != bytes)
+		lgl__glTrace.captureFailed = 1;
+	lgl__glTrace.captureOffset += (unsigned long)bytes;
+}
+
+static void lgl__glCaptureU32(size_t value)
+{
+	unsigned int u32 = (unsigned int)value;
+
+	lgl__glCaptureWrite(&u32, sizeof(u32));
+}
+
+/* zeros up to the next multiple of 8 bytes in the file */
+static void lgl__glCapturePad(void)
+{
+	static const unsigned char zeros[8] = {0};
+
+	lgl__glCaptureWrite(zeros, (8 - lgl__glTrace.captureOffset % 8) % 8);
+}
+
+static void lgl__glCaptureTag(int tag)
+{
+	unsigned char u8 = (unsigned char)tag;
+
+	lgl__glCaptureWrite(&u8, 1);
+}
+
+static void lgl__glCaptureBegin(int index)
+{
+	unsigned short id = (unsigned short)index;
+
+	lgl__glCaptureWrite(&id, sizeof(id));
+}
+
+static void lgl__glCaptureLossy(int index)
+{
+	lgl__glCaptureBegin(index | LGL_GL_CAPTURE_LOSSY);
+}
+
+static void lgl__glCaptureValue(const void *value, size_t bytes)
+{
+	lgl__glCaptureWrite(value, bytes);
+}
+
+static void lgl__glCaptureSync(const void *sync)
+{
+	GLuint64 id = (GLuint64)(size_t)sync;
+
+	lgl__glCaptureWrite(&id, sizeof(id));
+}
+
+static void lgl__glCaptureSized(int tag, const void *data, size_t bytes)
+{
+	if (!data) {
+		lgl__glCaptureTag(LGL_GL_CAPTURE_NULL);
+		return;
+	}
+	lgl__glCaptureTag(tag);
+	lgl__glCaptureU32(bytes);
+	lgl__glCapturePad();
+	lgl__glCaptureWrite(data, bytes);
+}
+
+static void lgl__glCaptureData(const void *data, size_t bytes)
+{
+	lgl__glCaptureSized(LGL_GL_CAPTURE_DATA, data, bytes);
+}
+
+static void lgl__glCaptureRecord(const void *data, size_t bytes)
+{
+	lgl__glCaptureSized(LGL_GL_CAPTURE_RECORD, data, bytes);
+}
+
+static void lgl__glCaptureOffset(const void *offset)
+{
+	GLuint64 value = (GLuint64)(size_t)offset;
+
+	lgl__glCaptureTag(LGL_GL_CAPTURE_OFFSET);
+	lgl__glCaptureWrite(&value, sizeof(value));
+}
+
+static void lgl__glCaptureOutput(size_t bytes)
+{
+	lgl__glCaptureTag(LGL_GL_CAPTURE_OUTPUT);
+	lgl__glCaptureU32(bytes);
+}
+
+/* pixel data is an offset while a pixel unpack buffer is bound */
+static void lgl__glCaptureUnpack(const void *data, size_t bytes)
+{
+	GLint buffer = 0;
+
+	lgl__glReal_glGetIntegerv(GL_PIXEL_UNPACK_BUFFER_BINDING, &buffer);
+	if (buffer) lgl__glCaptureOffset(data);
+	else lgl__glCaptureData(data, bytes);
+}
+
+static void lgl__glCapturePack(const void *data, size_t bytes)
+{
+	GLint buffer = 0;
+
+	lgl__glReal_glGetIntegerv(GL_PIXEL_PACK_BUFFER_BINDING, &buffer);
+	if (buffer) lgl__glCaptureOffset(data);
+	else lgl__glCaptureOutput(bytes);
+}
+
+static void lgl__glCaptureStrings(GLsizei count, const GLchar *const *strings,
+				  const GLint *lengths)
+{
+	GLsizei i;
+
+	if (!strings) {
+		lgl__glCaptureTag(LGL_GL_CAPTURE_NULL);
+		return;
+	}
+	lgl__glCaptureTag(LGL_GL_CAPTURE_STRINGS);
+	lgl__glCaptureU32((size_t)count);
+	for (i = 0; i < count; i++) {
+		size_t length = lengths && lengths[i] >= 0 ? (size_t)lengths[i]
+			: strlen(strings[i]);
+
+		lgl__glCaptureU32(length);
+		lgl__glCapturePad();
+		lgl__glCaptureWrite(strings[i], length);
+		lgl__glCaptureWrite("", 1);
+	}
+}
+
+/* a string argument with its terminating 0, or `length` bytes */
+static size_t lgl__glCaptureStringBytes(const GLchar *string, GLsizei length)
+{
+	return length >= 0 ? (size_t)length : strlen(string) + 1;
+}
+
+/* values of a glTexParameter*v, glSamplerParameter*v, ... call */
+static size_t lgl__glCaptureParamCount(GLenum pname)
+{
+	switch (pname) {
+	case GL_TEXTURE_BORDER_COLOR:
+	case GL_TEXTURE_SWIZZLE_RGBA:
+	case GL_PATCH_DEFAULT_OUTER_LEVEL:
+		return 4;
+	case GL_PATCH_DEFAULT_INNER_LEVEL:
+		return 2;
+	default:
+		return 1;
+	}
+}
+
+static size_t lgl__glCaptureTexelBytes(GLenum format, GLenum type)
+{
+	size_t components;
+
+	/* packed types hold the whole pixel */
+	switch (type) {
+	case GL_UNSIGNED_BYTE_3_3_2:
+	case GL_UNSIGNED_BYTE_2_3_3_REV:
+		return 1;
+	case GL_UNSIGNED_SHORT_5_6_5:
+	case GL_UNSIGNED_SHORT_5_6_5_REV:
+	case GL_UNSIGNED_SHORT_4_4_4_4:
+	case GL_UNSIGNED_SHORT_4_4_4_4_REV:
+	case GL_UNSIGNED_SHORT_5_5_5_1:
+	case GL_UNSIGNED_SHORT_1_5_5_5_REV:
+		return 2;
+	case GL_UNSIGNED_INT_8_8_8_8:
+	case GL_UNSIGNED_INT_8_8_8_8_REV:
+	case GL_UNSIGNED_INT_10_10_10_2:
+	case GL_UNSIGNED_INT_2_10_10_10_REV:
+	case GL_UNSIGNED_INT_24_8:
+	case GL_UNSIGNED_INT_10F_11F_11F_REV:
+	case GL_UNSIGNED_INT_5_9_9_9_REV:
+		return 4;
+	case GL_FLOAT_32_UNSIGNED_INT_24_8_REV:
+		return 8;
+	}
+
+	switch (format) {
+	case GL_RG:
+	case GL_RG_INTEGER:
+	case GL_DEPTH_STENCIL:
+		components = 2;
+		break;
+	case GL_RGB:
+	case GL_BGR:
+	case GL_RGB_INTEGER:
+	case GL_BGR_INTEGER:
+		components = 3;
+		break;
+	case GL_RGBA:
+	case GL_BGRA:
+	case GL_RGBA_INTEGER:
+	case GL_BGRA_INTEGER:
+		components = 4;
+		break;
+	default:
+		components = 1;
+	}
+
+	switch (type) {
+	case GL_SHORT:
+	case GL_UNSIGNED_SHORT:
+	case GL_HALF_FLOAT:
+		return components * 2;
+	case GL_INT:
+	case GL_UNSIGNED_INT:
+	case GL_FLOAT:
+		return components * 4;
+	default:
+		return components;
+	}
+}
+
+/* bytes GL reads (or with `pack`, writes) for a width x height x depth
+ * image under the current pixel store state */
+static size_t lgl__glCapturePixelBytes(GLsizei width, GLsizei height,
+				       GLsizei depth, GLenum format,
+				       GLenum type, int pack)
+{
+	GLint alignment = 4, rowLength = 0, imageHeight = 0;
+	GLint skipPixels = 0, skipRows = 0, skipImages = 0;
+	size_t texel = lgl__glCaptureTexelBytes(format, type), row, image;
+
+	if (width <= 0 || height <= 0 || depth <= 0) return 0;
+
+	lgl__glReal_glGetIntegerv(pack ? GL_PACK_ALIGNMENT
+				  : GL_UNPACK_ALIGNMENT, &alignment);
+	lgl__glReal_glGetIntegerv(pack ? GL_PACK_ROW_LENGTH
+				  : GL_UNPACK_ROW_LENGTH, &rowLength);
+	lgl__glReal_glGetIntegerv(pack ? GL_PACK_SKIP_PIXELS
+				  : GL_UNPACK_SKIP_PIXELS, &skipPixels);
+	lgl__glReal_glGetIntegerv(pack ? GL_PACK_SKIP_ROWS
+				  : GL_UNPACK_SKIP_ROWS, &skipRows);
+	if (depth > 1) {
+		lgl__glReal_glGetIntegerv(pack ? GL_PACK_IMAGE_HEIGHT
+					  : GL_UNPACK_IMAGE_HEIGHT, &imageHeight);
+		lgl__glReal_glGetIntegerv(pack ? GL_PACK_SKIP_IMAGES
+					  : GL_UNPACK_SKIP_IMAGES, &skipImages);
+	}
+	if (alignment < 1) alignment = 1;
+
+	row = (size_t)(rowLength > 0 ? rowLength : width) * texel;
+	row = (row + alignment - 1) / alignment * alignment;
+	image = row * (size_t)(imageHeight > 0 ? imageHeight : height);
+
+	return (size_t)(skipImages + depth - 1) * image
+		+ (size_t)(skipRows + height - 1) * row
+		+ (size_t)(skipPixels + width) * texel;
+}
+
+#include "lgl_gl_trace_gen.h"
+
+static void lgl__glCaptureClose(void)
+{
+	if (fclose(lgl__glTrace.capture) || lgl__glTrace.captureFailed)
+		fprintf(stderr, "GL capture: write failed\n");
+	else
+		fprintf(stderr, "GL capture: frames 0 to %lu captured\n",
+			lgl__glTrace.captureFrame);
+	lgl__glTrace.capture = NULL;
+}
+
+int lgl_glTraceCapture(const char *path, unsigned long frame)
+{
+	GLint viewport[4] = {0}, version[2] = {0};
+	int i;
+
+	if (!lgl__glTrace.installed || lgl__glTrace.capture
+	    || lgl__glTrace.frames || lgl__glTrace.frame.calls)
+		return 0;
+
+	lgl__glTrace.capture = fopen(path, "wb");
+	if (!lgl__glTrace.capture) {
+		fprintf(stderr, "GL capture: could not write \"%s\"\n", path);
+		return 0;
+	}
+	lgl__glTrace.captureFrame = frame;
+	lgl__glTrace.captureOffset = 0;
+	lgl__glTrace.captureFailed = 0;
+
+	lgl__glReal_glGetIntegerv(GL_VIEWPORT, viewport);
+	lgl__glReal_glGetIntegerv(GL_MAJOR_VERSION, &version[0]);
+	lgl__glReal_glGetIntegerv(GL_MINOR_VERSION, &version[1]);
+
+	lgl__glCaptureWrite("LGLGLCAP", 8);
+	lgl__glCaptureU32(LGL_GL_CAPTURE_VERSION);
+	lgl__glCaptureWrite(&viewport[2], 2 * sizeof(GLint));
+	lgl__glCaptureWrite(version, sizeof(version));
+	lgl__glCaptureU32(LGL__GL_TRACE_COUNT);
+	for (i = 0; i < LGL__GL_TRACE_COUNT; i++) {
+		unsigned short length = (unsigned short)strlen(lgl__glTraceNames[i]);
+
+		lgl__glCaptureWrite(&length, sizeof(length));
+		lgl__glCaptureWrite(lgl__glTraceNames[i], length);
+	}
+	return 1;
+}
+
+int lgl_glTraceInstall(void)
+{
+	if (lgl__glTrace.installed) return 0;
+
+	memset(&lgl__glTrace, 0, sizeof(lgl__glTrace));
+	lgl__glTrace.counters = calloc(LGL__GL_TRACE_COUNT,
+				       sizeof(*lgl__glTrace.counters));
+	if (!lgl__glTrace.counters) return 0;
+
+	lgl__glTraceHook(1);
+	lgl__glTrace.installed = 1;
+
+	if (getenv("LGL_GL_CAPTURE")) {
+		const char *frame = getenv("LGL_GL_CAPTURE_FRAME");
+
+		lgl_glTraceCapture(getenv("LGL_GL_CAPTURE"),
+				   frame ? strtoul(frame, NULL, 10) : 1);
+	}
+	return 1;
+}
+
+void lgl_glTraceUninstall(void)
+{
+	if (!lgl__glTrace.installed) return;
+	if (lgl__glTraceHook(0)) return;
+
+	if (lgl__glTrace.capture) {
+		fprintf(stderr, "GL capture: ended before frame %lu\n",
+			lgl__glTrace.captureFrame);
+		fclose(lgl__glTrace.capture);
+		lgl__glTrace.capture = NULL;
+	}
+	free(lgl__glTrace.counters);
+	lgl__glTrace.counters = NULL;
+	lgl__glTrace.installed = 0;
+}
+
+void lgl_glTraceEndFrame(lgl_GlTraceStats *frame)
+{
+	if (!lgl__glTrace.installed) return;
+
+	if (frame) *frame = lgl__glTrace.frame;
+#if defined(__LGL_PLATFORM__) && defined(LGL_PLATFORM_HEADLESS)
+	lgl_platformBenchGl(lgl__glTrace.frame.seconds);
+#endif
+	memset(&lgl__glTrace.frame, 0, sizeof(lgl__glTrace.frame));
+
+	if (lgl__glTrace.capture) {
+		lgl__glCaptureBegin(LGL_GL_CAPTURE_FRAME_END);
+		lgl__glCaptureU32(lgl__glTrace.frames);
+		if (lgl__glTrace.frames == lgl__glTrace.captureFrame)
+			lgl__glCaptureClose();
+	}
+
+	/* forget the setup */
+	if (!lgl__glTrace.frames)
+		memset(lgl__glTrace.counters, 0,
+		       LGL__GL_TRACE_COUNT * sizeof(*lgl__glTrace.counters));
+	lgl__glTrace.frames++;
+}
+
+static int lgl__glTraceCompare(const void *a, const void *b)
+{
+	double x = lgl__glTrace.counters[*(const int *)a].seconds;
+	double y = lgl__glTrace.counters[*(const int *)b].seconds;
+
+	return (x < y) - (x > y);
+}
+
+static void lgl__glTracePrintRow(FILE *file, int index, double frames)
+{
+	const lgl__GlTraceCounters *counters = &lgl__glTrace.counters[index];
+
+	fprintf(file, "%-36s | %9.1f | %9.3f | %9.1f | %9.1f\n",
+		lgl__glTraceNames[index], counters->calls / frames,
+		counters->seconds * 1e6 / frames,
+		counters->redundant / frames, counters->sync / frames);
+}
+
+void lgl_glTracePrint(FILE *file, int top)
+{
+	int order[LGL__GL_TRACE_COUNT];
+	double frames, seconds = 0.0;
+	unsigned long calls = 0, redundant = 0, sync = 0;
+	int i;
+
+	if (!lgl__glTrace.installed || lgl__glTrace.frames < 2) return;
+	frames = (double)(lgl__glTrace.frames - 1);
+
+	for (i = 0; i < LGL__GL_TRACE_COUNT; i++) {
+		order[i] = i;
+		calls += lgl__glTrace.counters[i].calls;
+		seconds += lgl__glTrace.counters[i].seconds;
+		redundant += lgl__glTrace.counters[i].redundant;
+		sync += lgl__glTrace.counters[i].sync;
+	}
+	qsort(order, LGL__GL_TRACE_COUNT, sizeof(*order), lgl__glTraceCompare);
+
+	fprintf(file, "GL calls per frame over %.0f frames: %.1f calls,"
+		" %.3f ms, %.1f redundant, %.1f synchronous\n", frames,
+		calls / frames, seconds * 1000.0 / frames,
+		redundant / frames, sync / frames);
+	fprintf(file, "%-36s | %9s | %9s | %9s | %9s\n", "entry point",
+		"calls", "us", "redundant", "sync");
+
+	for (i = 0; i < top && i < LGL__GL_TRACE_COUNT; i++)
+		if (lgl__glTrace.counters[order[i]].calls)
+			lgl__glTracePrintRow(file, order[i], frames);
+
+	for (i = top; i < LGL__GL_TRACE_COUNT; i++)
+		if (lgl__glTrace.counters[order[i]].redundant
+		    || lgl__glTrace.counters[order[i]].sync)
+			lgl__glTracePrintRow(file, order[i], frames);
+}
+
+#endif /*LGL_GL_TRACE_IMPLEMENTATION*/
@@ -0,0 +1,18870 @@
+/* Generated by tools/gl_trace_gen.py from the glad header, do not edit.
+ * Included by the implementation of lgl_gl_trace.h. */
+
+#define LGL__GL_TRACE_COUNT 699
+
+#define LGL__GL_ACTIVETEXTURE 65
+#define LGL__GL_BINDBUFFER 91
+#define LGL__GL_BINDFRAMEBUFFER 266
+#define LGL__GL_BINDRENDERBUFFER 260
+#define LGL__GL_BINDSAMPLER 321
+#define LGL__GL_BINDTEXTURE 57
+#define LGL__GL_BINDTEXTUREUNIT 641
+#define LGL__GL_BINDVERTEXARRAY 281
+#define LGL__GL_BLENDEQUATION 82
+#define LGL__GL_BLENDFUNC 25
+#define LGL__GL_CULLFACE 0
+#define LGL__GL_DEPTHFUNC 29
+#define LGL__GL_DEPTHMASK 20
+#define LGL__GL_ENABLE 22
+#define LGL__GL_FRONTFACE 1
+#define LGL__GL_PIXELSTOREI 31
+#define LGL__GL_POLYGONMODE 5
+#define LGL__GL_USEPROGRAM 137
+#define LGL__GL_VIEWPORT 47
+
+static const char *lgl__glTraceNames[LGL__GL_TRACE_COUNT] = {
+	"glCullFace",
+	"glFrontFace",
+	"glHint",
+	"glLineWidth",
+	"glPointSize",
+	"glPolygonMode",
+	"glScissor",
+	"glTexParameterf",
+	"glTexParameterfv",
+	"glTexParameteri",
+	"glTexParameteriv",
+	"glTexImage1D",
+	"glTexImage2D",
+	"glDrawBuffer",
+	"glClear",
+	"glClearColor",
+	"glClearStencil",
+	"glClearDepth",
+	"glStencilMask",
+	"glColorMask",
+	"glDepthMask",
+	"glDisable",
+	"glEnable",
+	"glFinish",
+	"glFlush",
+	"glBlendFunc",
+	"glLogicOp",
+	"glStencilFunc",
+	"glStencilOp",
+	"glDepthFunc",
+	"glPixelStoref",
+	"glPixelStorei",
+	"glReadBuffer",
+	"glReadPixels",
+	"glGetBooleanv",
+	"glGetDoublev",
+	"glGetError",
+	"glGetFloatv",
+	"glGetIntegerv",
+	"glGetString",
+	"glGetTexImage",
+	"glGetTexParameterfv",
+	"glGetTexParameteriv",
+	"glGetTexLevelParameterfv",
+	"glGetTexLevelParameteriv",
+	"glIsEnabled",
+	"glDepthRange",
+	"glViewport",
+	"glDrawArrays",
+	"glDrawElements",
+	"glPolygonOffset",
+	"glCopyTexImage1D",
+	"glCopyTexImage2D",
+	"glCopyTexSubImage1D",
+	"glCopyTexSubImage2D",
+	"glTexSubImage1D",
+	"glTexSubImage2D",
+	"glBindTexture",
+	"glDeleteTextures",
+	"glGenTextures",
+	"glIsTexture",
+	"glDrawRangeElements",
+	"glTexImage3D",
+	"glTexSubImage3D",
+	"glCopyTexSubImage3D",
+	"glActiveTexture",
+	"glSampleCoverage",
+	"glCompressedTexImage3D",
+	"glCompressedTexImage2D",
+	"glCompressedTexImage1D",
+	"glCompressedTexSubImage3D",
+	"glCompressedTexSubImage2D",
+	"glCompressedTexSubImage1D",
+	"glGetCompressedTexImage",
+	"glBlendFuncSeparate",
+	"glMultiDrawArrays",
+	"glMultiDrawElements",
+	"glPointParameterf",
+	"glPointParameterfv",
+	"glPointParameteri",
+	"glPointParameteriv",
+	"glBlendColor",
+	"glBlendEquation",
+	"glGenQueries",
+	"glDeleteQueries",
+	"glIsQuery",
+	"glBeginQuery",
+	"glEndQuery",
+	"glGetQueryiv",
+	"glGetQueryObjectiv",
+	"glGetQueryObjectuiv",
+	"glBindBuffer",
+	"glDeleteBuffers",
+	"glGenBuffers",
+	"glIsBuffer",
+	"glBufferData",
+	"glBufferSubData",
+	"glGetBufferSubData",
+	"glMapBuffer",
+	"glUnmapBuffer",
+	"glGetBufferParameteriv",
+	"glGetBufferPointerv",
+	"glBlendEquationSeparate",
+	"glDrawBuffers",
+	"glStencilOpSeparate",
+	"glStencilFuncSeparate",
+	"glStencilMaskSeparate",
+	"glAttachShader",
+	"glBindAttribLocation",
+	"glCompileShader",
+	"glCreateProgram",
+	"glCreateShader",
+	"glDeleteProgram",
+	"glDeleteShader",
+	"glDetachShader",
+	"glDisableVertexAttribArray",
+	"glEnableVertexAttribArray",
+	"glGetActiveAttrib",
+	"glGetActiveUniform",
+	"glGetAttachedShaders",
+	"glGetAttribLocation",
+	"glGetProgramiv",
+	"glGetProgramInfoLog",
+	"glGetShaderiv",
+	"glGetShaderInfoLog",
+	"glGetShaderSource",
+	"glGetUniformLocation",
+	"glGetUniformfv",
+	"glGetUniformiv",
+	"glGetVertexAttribdv",
+	"glGetVertexAttribfv",
+	"glGetVertexAttribiv",
+	"glGetVertexAttribPointerv",
+	"glIsProgram",
+	"glIsShader",
+	"glLinkProgram",
+	"glShaderSource",
+	"glUseProgram",
+	"glUniform1f",
+	"glUniform2f",
+	"glUniform3f",
+	"glUniform4f",
+	"glUniform1i",
+	"glUniform2i",
+	"glUniform3i",
+	"glUniform4i",
+	"glUniform1fv",
+	"glUniform2fv",
+	"glUniform3fv",
+	"glUniform4fv",
+	"glUniform1iv",
+	"glUniform2iv",
+	"glUniform3iv",
+	"glUniform4iv",
+	"glUniformMatrix2fv",
+	"glUniformMatrix3fv",
+	"glUniformMatrix4fv",
+	"glValidateProgram",
+	"glVertexAttrib1d",
+	"glVertexAttrib1dv",
+	"glVertexAttrib1f",
+	"glVertexAttrib1fv",
+	"glVertexAttrib1s",
+	"glVertexAttrib1sv",
+	"glVertexAttrib2d",
+	"glVertexAttrib2dv",
+	"glVertexAttrib2f",
+	"glVertexAttrib2fv",
+	"glVertexAttrib2s",
+	"glVertexAttrib2sv",
+	"glVertexAttrib3d",
+	"glVertexAttrib3dv",
+	"glVertexAttrib3f",
+	"glVertexAttrib3fv",
+	"glVertexAttrib3s",
+	"glVertexAttrib3sv",
+	"glVertexAttrib4Nbv",
+	"glVertexAttrib4Niv",
+	"glVertexAttrib4Nsv",
+	"glVertexAttrib4Nub",
+	"glVertexAttrib4Nubv",
+	"glVertexAttrib4Nuiv",
+	"glVertexAttrib4Nusv",
+	"glVertexAttrib4bv",
+	"glVertexAttrib4d",
+	"glVertexAttrib4dv",
+	"glVertexAttrib4f",
+	"glVertexAttrib4fv",
+	"glVertexAttrib4iv",
+	"glVertexAttrib4s",
+	"glVertexAttrib4sv",
+	"glVertexAttrib4ubv",
+	"glVertexAttrib4uiv",
+	"glVertexAttrib4usv",
+	"glVertexAttribPointer",
+	"glUniformMatrix2x3fv",
+	"glUniformMatrix3x2fv",
+	"glUniformMatrix2x4fv",
+	"glUniformMatrix4x2fv",
+	"glUniformMatrix3x4fv",
+	"glUniformMatrix4x3fv",
+	"glColorMaski",
+	"glGetBooleani_v",
+	"glGetIntegeri_v",
+	"glEnablei",
+	"glDisablei",
+	"glIsEnabledi",
+	"glBeginTransformFeedback",
+	"glEndTransformFeedback",
+	"glBindBufferRange",
+	"glBindBufferBase",
+	"glTransformFeedbackVaryings",
+	"glGetTransformFeedbackVarying",
+	"glClampColor",
+	"glBeginConditionalRender",
+	"glEndConditionalRender",
+	"glVertexAttribIPointer",
+	"glGetVertexAttribIiv",
+	"glGetVertexAttribIuiv",
+	"glVertexAttribI1i",
+	"glVertexAttribI2i",
+	"glVertexAttribI3i",
+	"glVertexAttribI4i",
+	"glVertexAttribI1ui",
+	"glVertexAttribI2ui",
+	"glVertexAttribI3ui",
+	"glVertexAttribI4ui",
+	"glVertexAttribI1iv",
+	"glVertexAttribI2iv",
+	"glVertexAttribI3iv",
+	"glVertexAttribI4iv",
+	"glVertexAttribI1uiv",
+	"glVertexAttribI2uiv",
+	"glVertexAttribI3uiv",
+	"glVertexAttribI4uiv",
+	"glVertexAttribI4bv",
+	"glVertexAttribI4sv",
+	"glVertexAttribI4ubv",
+	"glVertexAttribI4usv",
+	"glGetUniformuiv",
+	"glBindFragDataLocation",
+	"glGetFragDataLocation",
+	"glUniform1ui",
+	"glUniform2ui",
+	"glUniform3ui",
+	"glUniform4ui",
+	"glUniform1uiv",
+	"glUniform2uiv",
+	"glUniform3uiv",
+	"glUniform4uiv",
+	"glTexParameterIiv",
+	"glTexParameterIuiv",
+	"glGetTexParameterIiv",
+	"glGetTexParameterIuiv",
+	"glClearBufferiv",
+	"glClearBufferuiv",
+	"glClearBufferfv",
+	"glClearBufferfi",
+	"glGetStringi",
+	"glIsRenderbuffer",
+	"glBindRenderbuffer",
+	"glDeleteRenderbuffers",
+	"glGenRenderbuffers",
+	"glRenderbufferStorage",
+	"glGetRenderbufferParameteriv",
+	"glIsFramebuffer",
+	"glBindFramebuffer",
+	"glDeleteFramebuffers",
+	"glGenFramebuffers",
+	"glCheckFramebufferStatus",
+	"glFramebufferTexture1D",
+	"glFramebufferTexture2D",
+	"glFramebufferTexture3D",
+	"glFramebufferRenderbuffer",
+	"glGetFramebufferAttachmentParameteriv",
+	"glGenerateMipmap",
+	"glBlitFramebuffer",
+	"glRenderbufferStorageMultisample",
+	"glFramebufferTextureLayer",
+	"glMapBufferRange",
+	"glFlushMappedBufferRange",
+	"glBindVertexArray",
+	"glDeleteVertexArrays",
+	"glGenVertexArrays",
+	"glIsVertexArray",
+	"glDrawArraysInstanced",
+	"glDrawElementsInstanced",
+	"glTexBuffer",
+	"glPrimitiveRestartIndex",
+	"glCopyBufferSubData",
+	"glGetUniformIndices",
+	"glGetActiveUniformsiv",
+	"glGetActiveUniformName",
+	"glGetUniformBlockIndex",
+	"glGetActiveUniformBlockiv",
+	"glGetActiveUniformBlockName",
+	"glUniformBlockBinding",
+	"glDrawElementsBaseVertex",
+	"glDrawRangeElementsBaseVertex",
+	"glDrawElementsInstancedBaseVertex",
+	"glMultiDrawElementsBaseVertex",
+	"glProvokingVertex",
+	"glFenceSync",
+	"glIsSync",
+	"glDeleteSync",
+	"glClientWaitSync",
+	"glWaitSync",
+	"glGetInteger64v",
+	"glGetSynciv",
+	"glGetInteger64i_v",
+	"glGetBufferParameteri64v",
+	"glFramebufferTexture",
+	"glTexImage2DMultisample",
+	"glTexImage3DMultisample",
+	"glGetMultisamplefv",
+	"glSampleMaski",
+	"glBindFragDataLocationIndexed",
+	"glGetFragDataIndex",
+	"glGenSamplers",
+	"glDeleteSamplers",
+	"glIsSampler",
+	"glBindSampler",
+	"glSamplerParameteri",
+	"glSamplerParameteriv",
+	"glSamplerParameterf",
+	"glSamplerParameterfv",
+	"glSamplerParameterIiv",
+	"glSamplerParameterIuiv",
+	"glGetSamplerParameteriv",
+	"glGetSamplerParameterIiv",
+	"glGetSamplerParameterfv",
+	"glGetSamplerParameterIuiv",
+	"glQueryCounter",
+	"glGetQueryObjecti64v",
+	"glGetQueryObjectui64v",
+	"glVertexAttribDivisor",
+	"glVertexAttribP1ui",
+	"glVertexAttribP1uiv",
+	"glVertexAttribP2ui",
+	"glVertexAttribP2uiv",
+	"glVertexAttribP3ui",
+	"glVertexAttribP3uiv",
+	"glVertexAttribP4ui",
+	"glVertexAttribP4uiv",
+	"glVertexP2ui",
+	"glVertexP2uiv",
+	"glVertexP3ui",
+	"glVertexP3uiv",
+	"glVertexP4ui",
+	"glVertexP4uiv",
+	"glTexCoordP1ui",
+	"glTexCoordP1uiv",
+	"glTexCoordP2ui",
+	"glTexCoordP2uiv",
+	"glTexCoordP3ui",
+	"glTexCoordP3uiv",
+	"glTexCoordP4ui",
+	"glTexCoordP4uiv",
+	"glMultiTexCoordP1ui",
+	"glMultiTexCoordP1uiv",
+	"glMultiTexCoordP2ui",
+	"glMultiTexCoordP2uiv",
+	"glMultiTexCoordP3ui",
+	"glMultiTexCoordP3uiv",
+	"glMultiTexCoordP4ui",
+	"glMultiTexCoordP4uiv",
+	"glNormalP3ui",
+	"glNormalP3uiv",
+	"glColorP3ui",
+	"glColorP3uiv",
+	"glColorP4ui",
+	"glColorP4uiv",
+	"glSecondaryColorP3ui",
+	"glSecondaryColorP3uiv",
+	"glMinSampleShading",
+	"glBlendEquationi",
+	"glBlendEquationSeparatei",
+	"glBlendFunci",
+	"glBlendFuncSeparatei",
+	"glDrawArraysIndirect",
+	"glDrawElementsIndirect",
+	"glUniform1d",
+	"glUniform2d",
+	"glUniform3d",
+	"glUniform4d",
+	"glUniform1dv",
+	"glUniform2dv",
+	"glUniform3dv",
+	"glUniform4dv",
+	"glUniformMatrix2dv",
+	"glUniformMatrix3dv",
+	"glUniformMatrix4dv",
+	"glUniformMatrix2x3dv",
+	"glUniformMatrix2x4dv",
+	"glUniformMatrix3x2dv",
+	"glUniformMatrix3x4dv",
+	"glUniformMatrix4x2dv",
+	"glUniformMatrix4x3dv",
+	"glGetUniformdv",
+	"glGetSubroutineUniformLocation",
+	"glGetSubroutineIndex",
+	"glGetActiveSubroutineUniformiv",
+	"glGetActiveSubroutineUniformName",
+	"glGetActiveSubroutineName",
+	"glUniformSubroutinesuiv",
+	"glGetUniformSubroutineuiv",
+	"glGetProgramStageiv",
+	"glPatchParameteri",
+	"glPatchParameterfv",
+	"glBindTransformFeedback",
+	"glDeleteTransformFeedbacks",
+	"glGenTransformFeedbacks",
+	"glIsTransformFeedback",
+	"glPauseTransformFeedback",
+	"glResumeTransformFeedback",
+	"glDrawTransformFeedback",
+	"glDrawTransformFeedbackStream",
+	"glBeginQueryIndexed",
+	"glEndQueryIndexed",
+	"glGetQueryIndexediv",
+	"glReleaseShaderCompiler",
+	"glShaderBinary",
+	"glGetShaderPrecisionFormat",
+	"glDepthRangef",
+	"glClearDepthf",
+	"glGetProgramBinary",
+	"glProgramBinary",
+	"glProgramParameteri",
+	"glUseProgramStages",
+	"glActiveShaderProgram",
+	"glCreateShaderProgramv",
+	"glBindProgramPipeline",
+	"glDeleteProgramPipelines",
+	"glGenProgramPipelines",
+	"glIsProgramPipeline",
+	"glGetProgramPipelineiv",
+	"glProgramUniform1i",
+	"glProgramUniform1iv",
+	"glProgramUniform1f",
+	"glProgramUniform1fv",
+	"glProgramUniform1d",
+	"glProgramUniform1dv",
+	"glProgramUniform1ui",
+	"glProgramUniform1uiv",
+	"glProgramUniform2i",
+	"glProgramUniform2iv",
+	"glProgramUniform2f",
+	"glProgramUniform2fv",
+	"glProgramUniform2d",
+	"glProgramUniform2dv",
+	"glProgramUniform2ui",
+	"glProgramUniform2uiv",
+	"glProgramUniform3i",
+	"glProgramUniform3iv",
+	"glProgramUniform3f",
+	"glProgramUniform3fv",
+	"glProgramUniform3d",
+	"glProgramUniform3dv",
+	"glProgramUniform3ui",
+	"glProgramUniform3uiv",
+	"glProgramUniform4i",
+	"glProgramUniform4iv",
+	"glProgramUniform4f",
+	"glProgramUniform4fv",
+	"glProgramUniform4d",
+	"glProgramUniform4dv",
+	"glProgramUniform4ui",
+	"glProgramUniform4uiv",
+	"glProgramUniformMatrix2fv",
+	"glProgramUniformMatrix3fv",
+	"glProgramUniformMatrix4fv",
+	"glProgramUniformMatrix2dv",
+	"glProgramUniformMatrix3dv",
+	"glProgramUniformMatrix4dv",
+	"glProgramUniformMatrix2x3fv",
+	"glProgramUniformMatrix3x2fv",
+	"glProgramUniformMatrix2x4fv",
+	"glProgramUniformMatrix4x2fv",
+	"glProgramUniformMatrix3x4fv",
+	"glProgramUniformMatrix4x3fv",
+	"glProgramUniformMatrix2x3dv",
+	"glProgramUniformMatrix3x2dv",
+	"glProgramUniformMatrix2x4dv",
+	"glProgramUniformMatrix4x2dv",
+	"glProgramUniformMatrix3x4dv",
+	"glProgramUniformMatrix4x3dv",
+	"glValidateProgramPipeline",
+	"glGetProgramPipelineInfoLog",
+	"glVertexAttribL1d",
+	"glVertexAttribL2d",
+	"glVertexAttribL3d",
+	"glVertexAttribL4d",
+	"glVertexAttribL1dv",
+	"glVertexAttribL2dv",
+	"glVertexAttribL3dv",
+	"glVertexAttribL4dv",
+	"glVertexAttribLPointer",
+	"glGetVertexAttribLdv",
+	"glViewportArrayv",
+	"glViewportIndexedf",
+	"glViewportIndexedfv",
+	"glScissorArrayv",
+	"glScissorIndexed",
+	"glScissorIndexedv",
+	"glDepthRangeArrayv",
+	"glDepthRangeIndexed",
+	"glGetFloati_v",
+	"glGetDoublei_v",
+	"glDrawArraysInstancedBaseInstance",
+	"glDrawElementsInstancedBaseInstance",
+	"glDrawElementsInstancedBaseVertexBaseInstance",
+	"glGetInternalformativ",
+	"glGetActiveAtomicCounterBufferiv",
+	"glBindImageTexture",
+	"glMemoryBarrier",
+	"glTexStorage1D",
+	"glTexStorage2D",
+	"glTexStorage3D",
+	"glDrawTransformFeedbackInstanced",
+	"glDrawTransformFeedbackStreamInstanced",
+	"glClearBufferData",
+	"glClearBufferSubData",
+	"glDispatchCompute",
+	"glDispatchComputeIndirect",
+	"glCopyImageSubData",
+	"glFramebufferParameteri",
+	"glGetFramebufferParameteriv",
+	"glGetInternalformati64v",
+	"glInvalidateTexSubImage",
+	"glInvalidateTexImage",
+	"glInvalidateBufferSubData",
+	"glInvalidateBufferData",
+	"glInvalidateFramebuffer",
+	"glInvalidateSubFramebuffer",
+	"glMultiDrawArraysIndirect",
+	"glMultiDrawElementsIndirect",
+	"glGetProgramInterfaceiv",
+	"glGetProgramResourceIndex",
+	"glGetProgramResourceName",
+	"glGetProgramResourceiv",
+	"glGetProgramResourceLocation",
+	"glGetProgramResourceLocationIndex",
+	"glShaderStorageBlockBinding",
+	"glTexBufferRange",
+	"glTexStorage2DMultisample",
+	"glTexStorage3DMultisample",
+	"glTextureView",
+	"glBindVertexBuffer",
+	"glVertexAttribFormat",
+	"glVertexAttribIFormat",
+	"glVertexAttribLFormat",
+	"glVertexAttribBinding",
+	"glVertexBindingDivisor",
+	"glDebugMessageControl",
+	"glDebugMessageInsert",
+	"glDebugMessageCallback",
+	"glGetDebugMessageLog",
+	"glPushDebugGroup",
+	"glPopDebugGroup",
+	"glObjectLabel",
+	"glGetObjectLabel",
+	"glObjectPtrLabel",
+	"glGetObjectPtrLabel",
+	"glGetPointerv",
+	"glBufferStorage",
+	"glClearTexImage",
+	"glClearTexSubImage",
+	"glBindBuffersBase",
+	"glBindBuffersRange",
+	"glBindTextures",
+	"glBindSamplers",
+	"glBindImageTextures",
+	"glBindVertexBuffers",
+	"glClipControl",
+	"glCreateTransformFeedbacks",
+	"glTransformFeedbackBufferBase",
+	"glTransformFeedbackBufferRange",
+	"glGetTransformFeedbackiv",
+	"glGetTransformFeedbacki_v",
+	"glGetTransformFeedbacki64_v",
+	"glCreateBuffers",
+	"glNamedBufferStorage",
+	"glNamedBufferData",
+	"glNamedBufferSubData",
+	"glCopyNamedBufferSubData",
+	"glClearNamedBufferData",
+	"glClearNamedBufferSubData",
+	"glMapNamedBuffer",
+	"glMapNamedBufferRange",
+	"glUnmapNamedBuffer",
+	"glFlushMappedNamedBufferRange",
+	"glGetNamedBufferParameteriv",
+	"glGetNamedBufferParameteri64v",
+	"glGetNamedBufferPointerv",
+	"glGetNamedBufferSubData",
+	"glCreateFramebuffers",
+	"glNamedFramebufferRenderbuffer",
+	"glNamedFramebufferParameteri",
+	"glNamedFramebufferTexture",
+	"glNamedFramebufferTextureLayer",
+	"glNamedFramebufferDrawBuffer",
+	"glNamedFramebufferDrawBuffers",
+	"glNamedFramebufferReadBuffer",
+	"glInvalidateNamedFramebufferData",
+	"glInvalidateNamedFramebufferSubData",
+	"glClearNamedFramebufferiv",
+	"glClearNamedFramebufferuiv",
+	"glClearNamedFramebufferfv",
+	"glClearNamedFramebufferfi",
+	"glBlitNamedFramebuffer",
+	"glCheckNamedFramebufferStatus",
+	"glGetNamedFramebufferParameteriv",
+	"glGetNamedFramebufferAttachmentParameteriv",
+	"glCreateRenderbuffers",
+	"glNamedRenderbufferStorage",
+	"glNamedRenderbufferStorageMultisample",
+	"glGetNamedRenderbufferParameteriv",
+	"glCreateTextures",
+	"glTextureBuffer",
+	"glTextureBufferRange",
+	"glTextureStorage1D",
+	"glTextureStorage2D",
+	"glTextureStorage3D",
+	"glTextureStorage2DMultisample",
+	"glTextureStorage3DMultisample",
+	"glTextureSubImage1D",
+	"glTextureSubImage2D",
+	"glTextureSubImage3D",
+	"glCompressedTextureSubImage1D",
+	"glCompressedTextureSubImage2D",
+	"glCompressedTextureSubImage3D",
+	"glCopyTextureSubImage1D",
+	"glCopyTextureSubImage2D",
+	"glCopyTextureSubImage3D",
+	"glTextureParameterf",
+	"glTextureParameterfv",
+	"glTextureParameteri",
+	"glTextureParameterIiv",
+	"glTextureParameterIuiv",
+	"glTextureParameteriv",
+	"glGenerateTextureMipmap",
+	"glBindTextureUnit",
+	"glGetTextureImage",
+	"glGetCompressedTextureImage",
+	"glGetTextureLevelParameterfv",
+	"glGetTextureLevelParameteriv",
+	"glGetTextureParameterfv",
+	"glGetTextureParameterIiv",
+	"glGetTextureParameterIuiv",
+	"glGetTextureParameteriv",
+	"glCreateVertexArrays",
+	"glDisableVertexArrayAttrib",
+	"glEnableVertexArrayAttrib",
+	"glVertexArrayElementBuffer",
+	"glVertexArrayVertexBuffer",
+	"glVertexArrayVertexBuffers",
+	"glVertexArrayAttribBinding",
+	"glVertexArrayAttribFormat",
+	"glVertexArrayAttribIFormat",
+	"glVertexArrayAttribLFormat",
+	"glVertexArrayBindingDivisor",
+	"glGetVertexArrayiv",
+	"glGetVertexArrayIndexediv",
+	"glGetVertexArrayIndexed64iv",
+	"glCreateSamplers",
+	"glCreateProgramPipelines",
+	"glCreateQueries",
+	"glGetQueryBufferObjecti64v",
+	"glGetQueryBufferObjectiv",
+	"glGetQueryBufferObjectui64v",
+	"glGetQueryBufferObjectuiv",
+	"glMemoryBarrierByRegion",
+	"glGetTextureSubImage",
+	"glGetCompressedTextureSubImage",
+	"glGetGraphicsResetStatus",
+	"glGetnCompressedTexImage",
+	"glGetnTexImage",
+	"glGetnUniformdv",
+	"glGetnUniformfv",
+	"glGetnUniformiv",
+	"glGetnUniformuiv",
+	"glReadnPixels",
+	"glGetnMapdv",
+	"glGetnMapfv",
+	"glGetnMapiv",
+	"glGetnPixelMapfv",
+	"glGetnPixelMapuiv",
+	"glGetnPixelMapusv",
+	"glGetnPolygonStipple",
+	"glGetnColorTable",
+	"glGetnConvolutionFilter",
+	"glGetnSeparableFilter",
+	"glGetnHistogram",
+	"glGetnMinmax",
+	"glTextureBarrier",
+	"glSpecializeShader",
+	"glMultiDrawArraysIndirectCount",
+	"glMultiDrawElementsIndirectCount",
+	"glPolygonOffsetClamp",
+};
+
+static PFNGLCULLFACEPROC lgl__glReal_glCullFace;
+static PFNGLFRONTFACEPROC lgl__glReal_glFrontFace;
+static PFNGLHINTPROC lgl__glReal_glHint;
+static PFNGLLINEWIDTHPROC lgl__glReal_glLineWidth;
+static PFNGLPOINTSIZEPROC lgl__glReal_glPointSize;
+static PFNGLPOLYGONMODEPROC lgl__glReal_glPolygonMode;
+static PFNGLSCISSORPROC lgl__glReal_glScissor;
+static PFNGLTEXPARAMETERFPROC lgl__glReal_glTexParameterf;
+static PFNGLTEXPARAMETERFVPROC lgl__glReal_glTexParameterfv;
+static PFNGLTEXPARAMETERIPROC lgl__glReal_glTexParameteri;
+static PFNGLTEXPARAMETERIVPROC lgl__glReal_glTexParameteriv;
+static PFNGLTEXIMAGE1DPROC lgl__glReal_glTexImage1D;
+static PFNGLTEXIMAGE2DPROC lgl__glReal_glTexImage2D;
+static PFNGLDRAWBUFFERPROC lgl__glReal_glDrawBuffer;
+static PFNGLCLEARPROC lgl__glReal_glClear;
+static PFNGLCLEARCOLORPROC lgl__glReal_glClearColor;
+static PFNGLCLEARSTENCILPROC lgl__glReal_glClearStencil;
+static PFNGLCLEARDEPTHPROC lgl__glReal_glClearDepth;
+static PFNGLSTENCILMASKPROC lgl__glReal_glStencilMask;
+static PFNGLCOLORMASKPROC lgl__glReal_glColorMask;
+static PFNGLDEPTHMASKPROC lgl__glReal_glDepthMask;
+static PFNGLDISABLEPROC lgl__glReal_glDisable;
+static PFNGLENABLEPROC lgl__glReal_glEnable;
+static PFNGLFINISHPROC lgl__glReal_glFinish;
+static PFNGLFLUSHPROC lgl__glReal_glFlush;
+static PFNGLBLENDFUNCPROC lgl__glReal_glBlendFunc;
+static PFNGLLOGICOPPROC lgl__glReal_glLogicOp;
+static PFNGLSTENCILFUNCPROC lgl__glReal_glStencilFunc;
+static PFNGLSTENCILOPPROC lgl__glReal_glStencilOp;
+static PFNGLDEPTHFUNCPROC lgl__glReal_glDepthFunc;
+static PFNGLPIXELSTOREFPROC lgl__glReal_glPixelStoref;
+static PFNGLPIXELSTOREIPROC lgl__glReal_glPixelStorei;
+static PFNGLREADBUFFERPROC lgl__glReal_glReadBuffer;
+static PFNGLREADPIXELSPROC lgl__glReal_glReadPixels;
+static PFNGLGETBOOLEANVPROC lgl__glReal_glGetBooleanv;
+static PFNGLGETDOUBLEVPROC lgl__glReal_glGetDoublev;
+static PFNGLGETERRORPROC lgl__glReal_glGetError;
+static PFNGLGETFLOATVPROC lgl__glReal_glGetFloatv;
+static PFNGLGETINTEGERVPROC lgl__glReal_glGetIntegerv;
+static PFNGLGETSTRINGPROC lgl__glReal_glGetString;
+static PFNGLGETTEXIMAGEPROC lgl__glReal_glGetTexImage;
+static PFNGLGETTEXPARAMETERFVPROC lgl__glReal_glGetTexParameterfv;
+static PFNGLGETTEXPARAMETERIVPROC lgl__glReal_glGetTexParameteriv;
+static PFNGLGETTEXLEVELPARAMETERFVPROC lgl__glReal_glGetTexLevelParameterfv;
+static PFNGLGETTEXLEVELPARAMETERIVPROC lgl__glReal_glGetTexLevelParameteriv;
+static PFNGLISENABLEDPROC lgl__glReal_glIsEnabled;
+static PFNGLDEPTHRANGEPROC lgl__glReal_glDepthRange;
+static PFNGLVIEWPORTPROC lgl__glReal_glViewport;
+static PFNGLDRAWARRAYSPROC lgl__glReal_glDrawArrays;
+static PFNGLDRAWELEMENTSPROC lgl__glReal_glDrawElements;
+static PFNGLPOLYGONOFFSETPROC lgl__glReal_glPolygonOffset;
+static PFNGLCOPYTEXIMAGE1DPROC lgl__glReal_glCopyTexImage1D;
+static PFNGLCOPYTEXIMAGE2DPROC lgl__glReal_glCopyTexImage2D;
+static PFNGLCOPYTEXSUBIMAGE1DPROC lgl__glReal_glCopyTexSubImage1D;
+static PFNGLCOPYTEXSUBIMAGE2DPROC lgl__glReal_glCopyTexSubImage2D;
+static PFNGLTEXSUBIMAGE1DPROC lgl__glReal_glTexSubImage1D;
+static PFNGLTEXSUBIMAGE2DPROC lgl__glReal_glTexSubImage2D;
+static PFNGLBINDTEXTUREPROC lgl__glReal_glBindTexture;
+static PFNGLDELETETEXTURESPROC lgl__glReal_glDeleteTextures;
+static PFNGLGENTEXTURESPROC lgl__glReal_glGenTextures;
+static PFNGLISTEXTUREPROC lgl__glReal_glIsTexture;
+static PFNGLDRAWRANGEELEMENTSPROC lgl__glReal_glDrawRangeElements;
+static PFNGLTEXIMAGE3DPROC lgl__glReal_glTexImage3D;
+static PFNGLTEXSUBIMAGE3DPROC lgl__glReal_glTexSubImage3D;
+static PFNGLCOPYTEXSUBIMAGE3DPROC lgl__glReal_glCopyTexSubImage3D;
+static PFNGLACTIVETEXTUREPROC lgl__glReal_glActiveTexture;
+static PFNGLSAMPLECOVERAGEPROC lgl__glReal_glSampleCoverage;
+static PFNGLCOMPRESSEDTEXIMAGE3DPROC lgl__glReal_glCompressedTexImage3D;
+static PFNGLCOMPRESSEDTEXIMAGE2DPROC lgl__glReal_glCompressedTexImage2D;
+static PFNGLCOMPRESSEDTEXIMAGE1DPROC lgl__glReal_glCompressedTexImage1D;
+static PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC lgl__glReal_glCompressedTexSubImage3D;
+static PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC lgl__glReal_glCompressedTexSubImage2D;
+static PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC lgl__glReal_glCompressedTexSubImage1D;
+static PFNGLGETCOMPRESSEDTEXIMAGEPROC lgl__glReal_glGetCompressedTexImage;
+static PFNGLBLENDFUNCSEPARATEPROC lgl__glReal_glBlendFuncSeparate;
+static PFNGLMULTIDRAWARRAYSPROC lgl__glReal_glMultiDrawArrays;
+static PFNGLMULTIDRAWELEMENTSPROC lgl__glReal_glMultiDrawElements;
+static PFNGLPOINTPARAMETERFPROC lgl__glReal_glPointParameterf;
+static PFNGLPOINTPARAMETERFVPROC lgl__glReal_glPointParameterfv;
+static PFNGLPOINTPARAMETERIPROC lgl__glReal_glPointParameteri;
+static PFNGLPOINTPARAMETERIVPROC lgl__glReal_glPointParameteriv;
+static PFNGLBLENDCOLORPROC lgl__glReal_glBlendColor;
+static PFNGLBLENDEQUATIONPROC lgl__glReal_glBlendEquation;
+static PFNGLGENQUERIESPROC lgl__glReal_glGenQueries;
+static PFNGLDELETEQUERIESPROC lgl__glReal_glDeleteQueries;
+static PFNGLISQUERYPROC lgl__glReal_glIsQuery;
+static PFNGLBEGINQUERYPROC lgl__glReal_glBeginQuery;
+static PFNGLENDQUERYPROC lgl__glReal_glEndQuery;
+static PFNGLGETQUERYIVPROC lgl__glReal_glGetQueryiv;
+static PFNGLGETQUERYOBJECTIVPROC lgl__glReal_glGetQueryObjectiv;
+static PFNGLGETQUERYOBJECTUIVPROC lgl__glReal_glGetQueryObjectuiv;
+static PFNGLBINDBUFFERPROC lgl__glReal_glBindBuffer;
+static PFNGLDELETEBUFFERSPROC lgl__glReal_glDeleteBuffers;
+static PFNGLGENBUFFERSPROC lgl__glReal_glGenBuffers;
+static PFNGLISBUFFERPROC lgl__glReal_glIsBuffer;
+static PFNGLBUFFERDATAPROC lgl__glReal_glBufferData;
+static PFNGLBUFFERSUBDATAPROC lgl__glReal_glBufferSubData;
+static PFNGLGETBUFFERSUBDATAPROC lgl__glReal_glGetBufferSubData;
+static PFNGLMAPBUFFERPROC lgl__glReal_glMapBuffer;
+static PFNGLUNMAPBUFFERPROC lgl__glReal_glUnmapBuffer;
+static PFNGLGETBUFFERPARAMETERIVPROC lgl__glReal_glGetBufferParameteriv;
+static PFNGLGETBUFFERPOINTERVPROC lgl__glReal_glGetBufferPointerv;
+static PFNGLBLENDEQUATIONSEPARATEPROC lgl__glReal_glBlendEquationSeparate;
+static PFNGLDRAWBUFFERSPROC lgl__glReal_glDrawBuffers;
+static PFNGLSTENCILOPSEPARATEPROC lgl__glReal_glStencilOpSeparate;
+static PFNGLSTENCILFUNCSEPARATEPROC lgl__glReal_glStencilFuncSeparate;
+static PFNGLSTENCILMASKSEPARATEPROC lgl__glReal_glStencilMaskSeparate;
+static PFNGLATTACHSHADERPROC lgl__glReal_glAttachShader;
+static PFNGLBINDATTRIBLOCATIONPROC lgl__glReal_glBindAttribLocation;
+static PFNGLCOMPILESHADERPROC lgl__glReal_glCompileShader;
+static PFNGLCREATEPROGRAMPROC lgl__glReal_glCreateProgram;
+static PFNGLCREATESHADERPROC lgl__glReal_glCreateShader;
+static PFNGLDELETEPROGRAMPROC lgl__glReal_glDeleteProgram;
+static PFNGLDELETESHADERPROC lgl__glReal_glDeleteShader;
+static PFNGLDETACHSHADERPROC lgl__glReal_glDetachShader;
+static PFNGLDISABLEVERTEXATTRIBARRAYPROC lgl__glReal_glDisableVertexAttribArray;
+static PFNGLENABLEVERTEXATTRIBARRAYPROC lgl__glReal_glEnableVertexAttribArray;
+static PFNGLGETACTIVEATTRIBPROC lgl__glReal_glGetActiveAttrib;
+static PFNGLGETACTIVEUNIFORMPROC lgl__glReal_glGetActiveUniform;
+static PFNGLGETATTACHEDSHADERSPROC lgl__glReal_glGetAttachedShaders;
+static PFNGLGETATTRIBLOCATIONPROC lgl__glReal_glGetAttribLocation;
+static PFNGLGETPROGRAMIVPROC lgl__glReal_glGetProgramiv;
+static PFNGLGETPROGRAMINFOLOGPROC lgl__glReal_glGetProgramInfoLog;
+static PFNGLGETSHADERIVPROC lgl__glReal_glGetShaderiv;
+static PFNGLGETSHADERINFOLOGPROC lgl__glReal_glGetShaderInfoLog;
+static PFNGLGETSHADERSOURCEPROC lgl__glReal_glGetShaderSource;
+static PFNGLGETUNIFORMLOCATIONPROC lgl__glReal_glGetUniformLocation;
+static PFNGLGETUNIFORMFVPROC lgl__glReal_glGetUniformfv;
+static PFNGLGETUNIFORMIVPROC lgl__glReal_glGetUniformiv;
+static PFNGLGETVERTEXATTRIBDVPROC lgl__glReal_glGetVertexAttribdv;
+static PFNGLGETVERTEXATTRIBFVPROC lgl__glReal_glGetVertexAttribfv;
+static PFNGLGETVERTEXATTRIBIVPROC lgl__glReal_glGetVertexAttribiv;
+static PFNGLGETVERTEXATTRIBPOINTERVPROC lgl__glReal_glGetVertexAttribPointerv;
+static PFNGLISPROGRAMPROC lgl__glReal_glIsProgram;
+static PFNGLISSHADERPROC lgl__glReal_glIsShader;
+static PFNGLLINKPROGRAMPROC lgl__glReal_glLinkProgram;
+static PFNGLSHADERSOURCEPROC lgl__glReal_glShaderSource;
+static PFNGLUSEPROGRAMPROC lgl__glReal_glUseProgram;
+static PFNGLUNIFORM1FPROC lgl__glReal_glUniform1f;
+static PFNGLUNIFORM2FPROC lgl__glReal_glUniform2f;
+static PFNGLUNIFORM3FPROC lgl__glReal_glUniform3f;
+static PFNGLUNIFORM4FPROC lgl__glReal_glUniform4f;
+static PFNGLUNIFORM1IPROC lgl__glReal_glUniform1i;
+static PFNGLUNIFORM2IPROC lgl__glReal_glUniform2i;
+static PFNGLUNIFORM3IPROC lgl__glReal_glUniform3i;
+static PFNGLUNIFORM4IPROC lgl__glReal_glUniform4i;
+static PFNGLUNIFORM1FVPROC lgl__glReal_glUniform1fv;
+static PFNGLUNIFORM2FVPROC lgl__glReal_glUniform2fv;
+static PFNGLUNIFORM3FVPROC lgl__glReal_glUniform3fv;
+static PFNGLUNIFORM4FVPROC lgl__glReal_glUniform4fv;
+static PFNGLUNIFORM1IVPROC lgl__glReal_glUniform1iv;
+static PFNGLUNIFORM2IVPROC lgl__glReal_glUniform2iv;
+static PFNGLUNIFORM3IVPROC lgl__glReal_glUniform3iv;
+static PFNGLUNIFORM4IVPROC lgl__glReal_glUniform4iv;
+static PFNGLUNIFORMMATRIX2FVPROC lgl__glReal_glUniformMatrix2fv;
+static PFNGLUNIFORMMATRIX3FVPROC lgl__glReal_glUniformMatrix3fv;
+static PFNGLUNIFORMMATRIX4FVPROC lgl__glReal_glUniformMatrix4fv;
+static PFNGLVALIDATEPROGRAMPROC lgl__glReal_glValidateProgram;
+static PFNGLVERTEXATTRIB1DPROC lgl__glReal_glVertexAttrib1d;
+static PFNGLVERTEXATTRIB1DVPROC lgl__glReal_glVertexAttrib1dv;
+static PFNGLVERTEXATTRIB1FPROC lgl__glReal_glVertexAttrib1f;
+static PFNGLVERTEXATTRIB1FVPROC lgl__glReal_glVertexAttrib1fv;
+static PFNGLVERTEXATTRIB1SPROC lgl__glReal_glVertexAttrib1s;
+static PFNGLVERTEXATTRIB1SVPROC lgl__glReal_glVertexAttrib1sv;
+static PFNGLVERTEXATTRIB2DPROC lgl__glReal_glVertexAttrib2d;
+static PFNGLVERTEXATTRIB2DVPROC lgl__glReal_glVertexAttrib2dv;
+static PFNGLVERTEXATTRIB2FPROC lgl__glReal_glVertexAttrib2f;
+static PFNGLVERTEXATTRIB2FVPROC lgl__glReal_glVertexAttrib2fv;
+static PFNGLVERTEXATTRIB2SPROC lgl__glReal_glVertexAttrib2s;
+static PFNGLVERTEXATTRIB2SVPROC lgl__glReal_glVertexAttrib2sv;
+static PFNGLVERTEXATTRIB3DPROC lgl__glReal_glVertexAttrib3d;
+static PFNGLVERTEXATTRIB3DVPROC lgl__glReal_glVertexAttrib3dv;
+static PFNGLVERTEXATTRIB3FPROC lgl__glReal_glVertexAttrib3f;
+static PFNGLVERTEXATTRIB3FVPROC lgl__glReal_glVertexAttrib3fv;
+static PFNGLVERTEXATTRIB3SPROC lgl__glReal_glVertexAttrib3s;
+static PFNGLVERTEXATTRIB3SVPROC lgl__glReal_glVertexAttrib3sv;
+static PFNGLVERTEXATTRIB4NBVPROC lgl__glReal_glVertexAttrib4Nbv;
+static PFNGLVERTEXATTRIB4NIVPROC lgl__glReal_glVertexAttrib4Niv;
+static PFNGLVERTEXATTRIB4NSVPROC lgl__glReal_glVertexAttrib4Nsv;
+static PFNGLVERTEXATTRIB4NUBPROC lgl__glReal_glVertexAttrib4Nub;
+static PFNGLVERTEXATTRIB4NUBVPROC lgl__glReal_glVertexAttrib4Nubv;
+static PFNGLVERTEXATTRIB4NUIVPROC lgl__glReal_glVertexAttrib4Nuiv;
+static PFNGLVERTEXATTRIB4NUSVPROC lgl__glReal_glVertexAttrib4Nusv;
+static PFNGLVERTEXATTRIB4BVPROC lgl__glReal_glVertexAttrib4bv;
+static PFNGLVERTEXATTRIB4DPROC lgl__glReal_glVertexAttrib4d;
+static PFNGLVERTEXATTRIB4DVPROC lgl__glReal_glVertexAttrib4dv;
+static PFNGLVERTEXATTRIB4FPROC lgl__glReal_glVertexAttrib4f;
+static PFNGLVERTEXATTRIB4FVPROC lgl__glReal_glVertexAttrib4fv;
+static PFNGLVERTEXATTRIB4IVPROC lgl__glReal_glVertexAttrib4iv;
+static PFNGLVERTEXATTRIB4SPROC lgl__glReal_glVertexAttrib4s;
+static PFNGLVERTEXATTRIB4SVPROC lgl__glReal_glVertexAttrib4sv;
+static PFNGLVERTEXATTRIB4UBVPROC lgl__glReal_glVertexAttrib4ubv;
+static PFNGLVERTEXATTRIB4UIVPROC lgl__glReal_glVertexAttrib4uiv;
+static PFNGLVERTEXATTRIB4USVPROC lgl__glReal_glVertexAttrib4usv;
+static PFNGLVERTEXATTRIBPOINTERPROC lgl__glReal_glVertexAttribPointer;
+static PFNGLUNIFORMMATRIX2X3FVPROC lgl__glReal_glUniformMatrix2x3fv;
+static PFNGLUNIFORMMATRIX3X2FVPROC lgl__glReal_glUniformMatrix3x2fv;
+static PFNGLUNIFORMMATRIX2X4FVPROC lgl__glReal_glUniformMatrix2x4fv;
+static PFNGLUNIFORMMATRIX4X2FVPROC lgl__glReal_glUniformMatrix4x2fv;
+static PFNGLUNIFORMMATRIX3X4FVPROC lgl__glReal_glUniformMatrix3x4fv;
+static PFNGLUNIFORMMATRIX4X3FVPROC lgl__glReal_glUniformMatrix4x3fv;
+static PFNGLCOLORMASKIPROC lgl__glReal_glColorMaski;
+static PFNGLGETBOOLEANI_VPROC lgl__glReal_glGetBooleani_v;
+static PFNGLGETINTEGERI_VPROC lgl__glReal_glGetIntegeri_v;
+static PFNGLENABLEIPROC lgl__glReal_glEnablei;
+static PFNGLDISABLEIPROC lgl__glReal_glDisablei;
+static PFNGLISENABLEDIPROC lgl__glReal_glIsEnabledi;
+static PFNGLBEGINTRANSFORMFEEDBACKPROC lgl__glReal_glBeginTransformFeedback;
+static PFNGLENDTRANSFORMFEEDBACKPROC lgl__glReal_glEndTransformFeedback;
+static PFNGLBINDBUFFERRANGEPROC lgl__glReal_glBindBufferRange;
+static PFNGLBINDBUFFERBASEPROC lgl__glReal_glBindBufferBase;
+static PFNGLTRANSFORMFEEDBACKVARYINGSPROC lgl__glReal_glTransformFeedbackVaryings;
+static PFNGLGETTRANSFORMFEEDBACKVARYINGPROC lgl__glReal_glGetTransformFeedbackVarying;
+static PFNGLCLAMPCOLORPROC lgl__glReal_glClampColor;
+static PFNGLBEGINCONDITIONALRENDERPROC lgl__glReal_glBeginConditionalRender;
+static PFNGLENDCONDITIONALRENDERPROC lgl__glReal_glEndConditionalRender;
+static PFNGLVERTEXATTRIBIPOINTERPROC lgl__glReal_glVertexAttribIPointer;
+static PFNGLGETVERTEXATTRIBIIVPROC lgl__glReal_glGetVertexAttribIiv;
+static PFNGLGETVERTEXATTRIBIUIVPROC lgl__glReal_glGetVertexAttribIuiv;
+static PFNGLVERTEXATTRIBI1IPROC lgl__glReal_glVertexAttribI1i;
+static PFNGLVERTEXATTRIBI2IPROC lgl__glReal_glVertexAttribI2i;
+static PFNGLVERTEXATTRIBI3IPROC lgl__glReal_glVertexAttribI3i;
+static PFNGLVERTEXATTRIBI4IPROC lgl__glReal_glVertexAttribI4i;
+static PFNGLVERTEXATTRIBI1UIPROC lgl__glReal_glVertexAttribI1ui;
+static PFNGLVERTEXATTRIBI2UIPROC lgl__glReal_glVertexAttribI2ui;
+static PFNGLVERTEXATTRIBI3UIPROC lgl__glReal_glVertexAttribI3ui;
+static PFNGLVERTEXATTRIBI4UIPROC lgl__glReal_glVertexAttribI4ui;
+static PFNGLVERTEXATTRIBI1IVPROC lgl__glReal_glVertexAttribI1iv;
+static PFNGLVERTEXATTRIBI2IVPROC lgl__glReal_glVertexAttribI2iv;
+static PFNGLVERTEXATTRIBI3IVPROC lgl__glReal_glVertexAttribI3iv;
+static PFNGLVERTEXATTRIBI4IVPROC lgl__glReal_glVertexAttribI4iv;
+static PFNGLVERTEXATTRIBI1UIVPROC lgl__glReal_glVertexAttribI1uiv;
+static PFNGLVERTEXATTRIBI2UIVPROC lgl__glReal_glVertexAttribI2uiv;
+static PFNGLVERTEXATTRIBI3UIVPROC lgl__glReal_glVertexAttribI3uiv;
+static PFNGLVERTEXATTRIBI4UIVPROC lgl__glReal_glVertexAttribI4uiv;
+static PFNGLVERTEXATTRIBI4BVPROC lgl__glReal_glVertexAttribI4bv;
+static PFNGLVERTEXATTRIBI4SVPROC lgl__glReal_glVertexAttribI4sv;
+static PFNGLVERTEXATTRIBI4UBVPROC lgl__glReal_glVertexAttribI4ubv;
+static PFNGLVERTEXATTRIBI4USVPROC lgl__glReal_glVertexAttribI4usv;
+static PFNGLGETUNIFORMUIVPROC lgl__glReal_glGetUniformuiv;
+static PFNGLBINDFRAGDATALOCATIONPROC lgl__glReal_glBindFragDataLocation;
+static PFNGLGETFRAGDATALOCATIONPROC lgl__glReal_glGetFragDataLocation;
+static PFNGLUNIFORM1UIPROC lgl__glReal_glUniform1ui;
+static PFNGLUNIFORM2UIPROC lgl__glReal_glUniform2ui;
+static PFNGLUNIFORM3UIPROC lgl__glReal_glUniform3ui;
+static PFNGLUNIFORM4UIPROC lgl__glReal_glUniform4ui;
+static PFNGLUNIFORM1UIVPROC lgl__glReal_glUniform1uiv;
+static PFNGLUNIFORM2UIVPROC lgl__glReal_glUniform2uiv;
+static PFNGLUNIFORM3UIVPROC lgl__glReal_glUniform3uiv;
+static PFNGLUNIFORM4UIVPROC lgl__glReal_glUniform4uiv;
+static PFNGLTEXPARAMETERIIVPROC lgl__glReal_glTexParameterIiv;
+static PFNGLTEXPARAMETERIUIVPROC lgl__glReal_glTexParameterIuiv;
+static PFNGLGETTEXPARAMETERIIVPROC lgl__glReal_glGetTexParameterIiv;
+static PFNGLGETTEXPARAMETERIUIVPROC lgl__glReal_glGetTexParameterIuiv;
+static PFNGLCLEARBUFFERIVPROC lgl__glReal_glClearBufferiv;
+static PFNGLCLEARBUFFERUIVPROC lgl__glReal_glClearBufferuiv;
+static PFNGLCLEARBUFFERFVPROC lgl__glReal_glClearBufferfv;
+static PFNGLCLEARBUFFERFIPROC lgl__glReal_glClearBufferfi;
+static PFNGLGETSTRINGIPROC lgl__glReal_glGetStringi;
+static PFNGLISRENDERBUFFERPROC lgl__glReal_glIsRenderbuffer;
+static PFNGLBINDRENDERBUFFERPROC lgl__glReal_glBindRenderbuffer;
+static PFNGLDELETERENDERBUFFERSPROC lgl__glReal_glDeleteRenderbuffers;
+static PFNGLGENRENDERBUFFERSPROC lgl__glReal_glGenRenderbuffers;
+static PFNGLRENDERBUFFERSTORAGEPROC lgl__glReal_glRenderbufferStorage;
+static PFNGLGETRENDERBUFFERPARAMETERIVPROC lgl__glReal_glGetRenderbufferParameteriv;
+static PFNGLISFRAMEBUFFERPROC lgl__glReal_glIsFramebuffer;
+static PFNGLBINDFRAMEBUFFERPROC lgl__glReal_glBindFramebuffer;
+static PFNGLDELETEFRAMEBUFFERSPROC lgl__glReal_glDeleteFramebuffers;
+static PFNGLGENFRAMEBUFFERSPROC lgl__glReal_glGenFramebuffers;
+static PFNGLCHECKFRAMEBUFFERSTATUSPROC lgl__glReal_glCheckFramebufferStatus;
+static PFNGLFRAMEBUFFERTEXTURE1DPROC lgl__glReal_glFramebufferTexture1D;
+static PFNGLFRAMEBUFFERTEXTURE2DPROC lgl__glReal_glFramebufferTexture2D;
+static PFNGLFRAMEBUFFERTEXTURE3DPROC lgl__glReal_glFramebufferTexture3D;
+static PFNGLFRAMEBUFFERRENDERBUFFERPROC lgl__glReal_glFramebufferRenderbuffer;
+static PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC lgl__glReal_glGetFramebufferAttachmentParameteriv;
+static PFNGLGENERATEMIPMAPPROC lgl__glReal_glGenerateMipmap;
+static PFNGLBLITFRAMEBUFFERPROC lgl__glReal_glBlitFramebuffer;
+static PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC lgl__glReal_glRenderbufferStorageMultisample;
+static PFNGLFRAMEBUFFERTEXTURELAYERPROC lgl__glReal_glFramebufferTextureLayer;
+static PFNGLMAPBUFFERRANGEPROC lgl__glReal_glMapBufferRange;
+static PFNGLFLUSHMAPPEDBUFFERRANGEPROC lgl__glReal_glFlushMappedBufferRange;
+static PFNGLBINDVERTEXARRAYPROC lgl__glReal_glBindVertexArray;
+static PFNGLDELETEVERTEXARRAYSPROC lgl__glReal_glDeleteVertexArrays;
+static PFNGLGENVERTEXARRAYSPROC lgl__glReal_glGenVertexArrays;
+static PFNGLISVERTEXARRAYPROC lgl__glReal_glIsVertexArray;
+static PFNGLDRAWARRAYSINSTANCEDPROC lgl__glReal_glDrawArraysInstanced;
+static PFNGLDRAWELEMENTSINSTANCEDPROC lgl__glReal_glDrawElementsInstanced;
+static PFNGLTEXBUFFERPROC lgl__glReal_glTexBuffer;
+static PFNGLPRIMITIVERESTARTINDEXPROC lgl__glReal_glPrimitiveRestartIndex;
+static PFNGLCOPYBUFFERSUBDATAPROC lgl__glReal_glCopyBufferSubData;
+static PFNGLGETUNIFORMINDICESPROC lgl__glReal_glGetUniformIndices;
+static PFNGLGETACTIVEUNIFORMSIVPROC lgl__glReal_glGetActiveUniformsiv;
+static PFNGLGETACTIVEUNIFORMNAMEPROC lgl__glReal_glGetActiveUniformName;
+static PFNGLGETUNIFORMBLOCKINDEXPROC lgl__glReal_glGetUniformBlockIndex;
+static PFNGLGETACTIVEUNIFORMBLOCKIVPROC lgl__glReal_glGetActiveUniformBlockiv;
+static PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC lgl__glReal_glGetActiveUniformBlockName;
+static PFNGLUNIFORMBLOCKBINDINGPROC lgl__glReal_glUniformBlockBinding;
+static PFNGLDRAWELEMENTSBASEVERTEXPROC lgl__glReal_glDrawElementsBaseVertex;
+static PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC lgl__glReal_glDrawRangeElementsBaseVertex;
+static PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC lgl__glReal_glDrawElementsInstancedBaseVertex;
+static PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC lgl__glReal_glMultiDrawElementsBaseVertex;
+static PFNGLPROVOKINGVERTEXPROC lgl__glReal_glProvokingVertex;
+static PFNGLFENCESYNCPROC lgl__glReal_glFenceSync;
+static PFNGLISSYNCPROC lgl__glReal_glIsSync;
+static PFNGLDELETESYNCPROC lgl__glReal_glDeleteSync;
+static PFNGLCLIENTWAITSYNCPROC lgl__glReal_glClientWaitSync;
+static PFNGLWAITSYNCPROC lgl__glReal_glWaitSync;
+static PFNGLGETINTEGER64VPROC lgl__glReal_glGetInteger64v;
+static PFNGLGETSYNCIVPROC lgl__glReal_glGetSynciv;
+static PFNGLGETINTEGER64I_VPROC lgl__glReal_glGetInteger64i_v;
+static PFNGLGETBUFFERPARAMETERI64VPROC lgl__glReal_glGetBufferParameteri64v;
+static PFNGLFRAMEBUFFERTEXTUREPROC lgl__glReal_glFramebufferTexture;
+static PFNGLTEXIMAGE2DMULTISAMPLEPROC lgl__glReal_glTexImage2DMultisample;
+static PFNGLTEXIMAGE3DMULTISAMPLEPROC lgl__glReal_glTexImage3DMultisample;
+static PFNGLGETMULTISAMPLEFVPROC lgl__glReal_glGetMultisamplefv;
+static PFNGLSAMPLEMASKIPROC lgl__glReal_glSampleMaski;
+static PFNGLBINDFRAGDATALOCATIONINDEXEDPROC lgl__glReal_glBindFragDataLocationIndexed;
+static PFNGLGETFRAGDATAINDEXPROC lgl__glReal_glGetFragDataIndex;
+static PFNGLGENSAMPLERSPROC lgl__glReal_glGenSamplers;
+static PFNGLDELETESAMPLERSPROC lgl__glReal_glDeleteSamplers;
+static PFNGLISSAMPLERPROC lgl__glReal_glIsSampler;
+static PFNGLBINDSAMPLERPROC lgl__glReal_glBindSampler;
+static PFNGLSAMPLERPARAMETERIPROC lgl__glReal_glSamplerParameteri;
+static PFNGLSAMPLERPARAMETERIVPROC lgl__glReal_glSamplerParameteriv;
+static PFNGLSAMPLERPARAMETERFPROC lgl__glReal_glSamplerParameterf;
+static PFNGLSAMPLERPARAMETERFVPROC lgl__glReal_glSamplerParameterfv;
+static PFNGLSAMPLERPARAMETERIIVPROC lgl__glReal_glSamplerParameterIiv;
+static PFNGLSAMPLERPARAMETERIUIVPROC lgl__glReal_glSamplerParameterIuiv;
+static PFNGLGETSAMPLERPARAMETERIVPROC lgl__glReal_glGetSamplerParameteriv;
+static PFNGLGETSAMPLERPARAMETERIIVPROC lgl__glReal_glGetSamplerParameterIiv;
+static PFNGLGETSAMPLERPARAMETERFVPROC lgl__glReal_glGetSamplerParameterfv;
+static PFNGLGETSAMPLERPARAMETERIUIVPROC lgl__glReal_glGetSamplerParameterIuiv;
+static PFNGLQUERYCOUNTERPROC lgl__glReal_glQueryCounter;
+static PFNGLGETQUERYOBJECTI64VPROC lgl__glReal_glGetQueryObjecti64v;
+static PFNGLGETQUERYOBJECTUI64VPROC lgl__glReal_glGetQueryObjectui64v;
+static PFNGLVERTEXATTRIBDIVISORPROC lgl__glReal_glVertexAttribDivisor;
+static PFNGLVERTEXATTRIBP1UIPROC lgl__glReal_glVertexAttribP1ui;
+static PFNGLVERTEXATTRIBP1UIVPROC lgl__glReal_glVertexAttribP1uiv;
+static PFNGLVERTEXATTRIBP2UIPROC lgl__glReal_glVertexAttribP2ui;
+static PFNGLVERTEXATTRIBP2UIVPROC lgl__glReal_glVertexAttribP2uiv;
+static PFNGLVERTEXATTRIBP3UIPROC lgl__glReal_glVertexAttribP3ui;
+static PFNGLVERTEXATTRIBP3UIVPROC lgl__glReal_glVertexAttribP3uiv;
+static PFNGLVERTEXATTRIBP4UIPROC lgl__glReal_glVertexAttribP4ui;
+static PFNGLVERTEXATTRIBP4UIVPROC lgl__glReal_glVertexAttribP4uiv;
+static PFNGLVERTEXP2UIPROC lgl__glReal_glVertexP2ui;
+static PFNGLVERTEXP2UIVPROC lgl__glReal_glVertexP2uiv;
+static PFNGLVERTEXP3UIPROC lgl__glReal_glVertexP3ui;
+static PFNGLVERTEXP3UIVPROC lgl__glReal_glVertexP3uiv;
+static PFNGLVERTEXP4UIPROC lgl__glReal_glVertexP4ui;
+static PFNGLVERTEXP4UIVPROC lgl__glReal_glVertexP4uiv;
+static PFNGLTEXCOORDP1UIPROC lgl__glReal_glTexCoordP1ui;
+static PFNGLTEXCOORDP1UIVPROC lgl__glReal_glTexCoordP1uiv;
+static PFNGLTEXCOORDP2UIPROC lgl__glReal_glTexCoordP2ui;
+static PFNGLTEXCOORDP2UIVPROC lgl__glReal_glTexCoordP2uiv;
+static PFNGLTEXCOORDP3UIPROC lgl__glReal_glTexCoordP3ui;
+static PFNGLTEXCOORDP3UIVPROC lgl__glReal_glTexCoordP3uiv;
+static PFNGLTEXCOORDP4UIPROC lgl__glReal_glTexCoordP4ui;
+static PFNGLTEXCOORDP4UIVPROC lgl__glReal_glTexCoordP4uiv;
+static PFNGLMULTITEXCOORDP1UIPROC lgl__glReal_glMultiTexCoordP1ui;
+static PFNGLMULTITEXCOORDP1UIVPROC lgl__glReal_glMultiTexCoordP1uiv;
+static PFNGLMULTITEXCOORDP2UIPROC lgl__glReal_glMultiTexCoordP2ui;
+static PFNGLMULTITEXCOORDP2UIVPROC lgl__glReal_glMultiTexCoordP2uiv;
+static PFNGLMULTITEXCOORDP3UIPROC lgl__glReal_glMultiTexCoordP3ui;
+static PFNGLMULTITEXCOORDP3UIVPROC lgl__glReal_glMultiTexCoordP3uiv;
+static PFNGLMULTITEXCOORDP4UIPROC lgl__glReal_glMultiTexCoordP4ui;
+static PFNGLMULTITEXCOORDP4UIVPROC lgl__glReal_glMultiTexCoordP4uiv;
+static PFNGLNORMALP3UIPROC lgl__glReal_glNormalP3ui;
+static PFNGLNORMALP3UIVPROC lgl__glReal_glNormalP3uiv;
+static PFNGLCOLORP3UIPROC lgl__glReal_glColorP3ui;
+static PFNGLCOLORP3UIVPROC lgl__glReal_glColorP3uiv;
+static PFNGLCOLORP4UIPROC lgl__glReal_glColorP4ui;
+static PFNGLCOLORP4UIVPROC lgl__glReal_glColorP4uiv;
+static PFNGLSECONDARYCOLORP3UIPROC lgl__glReal_glSecondaryColorP3ui;
+static PFNGLSECONDARYCOLORP3UIVPROC lgl__glReal_glSecondaryColorP3uiv;
+static PFNGLMINSAMPLESHADINGPROC lgl__glReal_glMinSampleShading;
+static PFNGLBLENDEQUATIONIPROC lgl__glReal_glBlendEquationi;
+static PFNGLBLENDEQUATIONSEPARATEIPROC lgl__glReal_glBlendEquationSeparatei;
+static PFNGLBLENDFUNCIPROC lgl__glReal_glBlendFunci;
+static PFNGLBLENDFUNCSEPARATEIPROC lgl__glReal_glBlendFuncSeparatei;
+static PFNGLDRAWARRAYSINDIRECTPROC lgl__glReal_glDrawArraysIndirect;
+static PFNGLDRAWELEMENTSINDIRECTPROC lgl__glReal_glDrawElementsIndirect;
+static PFNGLUNIFORM1DPROC lgl__glReal_glUniform1d;
+static PFNGLUNIFORM2DPROC lgl__glReal_glUniform2d;
+static PFNGLUNIFORM3DPROC lgl__glReal_glUniform3d;
+static PFNGLUNIFORM4DPROC lgl__glReal_glUniform4d;
+static PFNGLUNIFORM1DVPROC lgl__glReal_glUniform1dv;
+static PFNGLUNIFORM2DVPROC lgl__glReal_glUniform2dv;
+static PFNGLUNIFORM3DVPROC lgl__glReal_glUniform3dv;
+static PFNGLUNIFORM4DVPROC lgl__glReal_glUniform4dv;
+static PFNGLUNIFORMMATRIX2DVPROC lgl__glReal_glUniformMatrix2dv;
+static PFNGLUNIFORMMATRIX3DVPROC lgl__glReal_glUniformMatrix3dv;
+static PFNGLUNIFORMMATRIX4DVPROC lgl__glReal_glUniformMatrix4dv;
+static PFNGLUNIFORMMATRIX2X3DVPROC lgl__glReal_glUniformMatrix2x3dv;
+static PFNGLUNIFORMMATRIX2X4DVPROC lgl__glReal_glUniformMatrix2x4dv;
+static PFNGLUNIFORMMATRIX3X2DVPROC lgl__glReal_glUniformMatrix3x2dv;
+static PFNGLUNIFORMMATRIX3X4DVPROC lgl__glReal_glUniformMatrix3x4dv;
+static PFNGLUNIFORMMATRIX4X2DVPROC lgl__glReal_glUniformMatrix4x2dv;
+static PFNGLUNIFORMMATRIX4X3DVPROC lgl__glReal_glUniformMatrix4x3dv;
+static PFNGLGETUNIFORMDVPROC lgl__glReal_glGetUniformdv;
+static PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC lgl__glReal_glGetSubroutineUniformLocation;
+static PFNGLGETSUBROUTINEINDEXPROC lgl__glReal_glGetSubroutineIndex;
+static PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC lgl__glReal_glGetActiveSubroutineUniformiv;
+static PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC lgl__glReal_glGetActiveSubroutineUniformName;
+static PFNGLGETACTIVESUBROUTINENAMEPROC lgl__glReal_glGetActiveSubroutineName;
+static PFNGLUNIFORMSUBROUTINESUIVPROC lgl__glReal_glUniformSubroutinesuiv;
+static PFNGLGETUNIFORMSUBROUTINEUIVPROC lgl__glReal_glGetUniformSubroutineuiv;
+static PFNGLGETPROGRAMSTAGEIVPROC lgl__glReal_glGetProgramStageiv;
+static PFNGLPATCHPARAMETERIPROC lgl__glReal_glPatchParameteri;
+static PFNGLPATCHPARAMETERFVPROC lgl__glReal_glPatchParameterfv;
+static PFNGLBINDTRANSFORMFEEDBACKPROC lgl__glReal_glBindTransformFeedback;
+static PFNGLDELETETRANSFORMFEEDBACKSPROC lgl__glReal_glDeleteTransformFeedbacks;
+static PFNGLGENTRANSFORMFEEDBACKSPROC lgl__glReal_glGenTransformFeedbacks;
+static PFNGLISTRANSFORMFEEDBACKPROC lgl__glReal_glIsTransformFeedback;
+static PFNGLPAUSETRANSFORMFEEDBACKPROC lgl__glReal_glPauseTransformFeedback;
+static PFNGLRESUMETRANSFORMFEEDBACKPROC lgl__glReal_glResumeTransformFeedback;
+static PFNGLDRAWTRANSFORMFEEDBACKPROC lgl__glReal_glDrawTransformFeedback;
+static PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC lgl__glReal_glDrawTransformFeedbackStream;
+static PFNGLBEGINQUERYINDEXEDPROC lgl__glReal_glBeginQueryIndexed;
+static PFNGLENDQUERYINDEXEDPROC lgl__glReal_glEndQueryIndexed;
+static PFNGLGETQUERYINDEXEDIVPROC lgl__glReal_glGetQueryIndexediv;
+static PFNGLRELEASESHADERCOMPILERPROC lgl__glReal_glReleaseShaderCompiler;
+static PFNGLSHADERBINARYPROC lgl__glReal_glShaderBinary;
+static PFNGLGETSHADERPRECISIONFORMATPROC lgl__glReal_glGetShaderPrecisionFormat;
+static PFNGLDEPTHRANGEFPROC lgl__glReal_glDepthRangef;
+static PFNGLCLEARDEPTHFPROC lgl__glReal_glClearDepthf;
+static PFNGLGETPROGRAMBINARYPROC lgl__glReal_glGetProgramBinary;
+static PFNGLPROGRAMBINARYPROC lgl__glReal_glProgramBinary;
+static PFNGLPROGRAMPARAMETERIPROC lgl__glReal_glProgramParameteri;
+static PFNGLUSEPROGRAMSTAGESPROC lgl__glReal_glUseProgramStages;
+static PFNGLACTIVESHADERPROGRAMPROC lgl__glReal_glActiveShaderProgram;
+static PFNGLCREATESHADERPROGRAMVPROC lgl__glReal_glCreateShaderProgramv;
+static PFNGLBINDPROGRAMPIPELINEPROC lgl__glReal_glBindProgramPipeline;
+static PFNGLDELETEPROGRAMPIPELINESPROC lgl__glReal_glDeleteProgramPipelines;
+static PFNGLGENPROGRAMPIPELINESPROC lgl__glReal_glGenProgramPipelines;
+static PFNGLISPROGRAMPIPELINEPROC lgl__glReal_glIsProgramPipeline;
+static PFNGLGETPROGRAMPIPELINEIVPROC lgl__glReal_glGetProgramPipelineiv;
+static PFNGLPROGRAMUNIFORM1IPROC lgl__glReal_glProgramUniform1i;
+static PFNGLPROGRAMUNIFORM1IVPROC lgl__glReal_glProgramUniform1iv;
+static PFNGLPROGRAMUNIFORM1FPROC lgl__glReal_glProgramUniform1f;
+static PFNGLPROGRAMUNIFORM1FVPROC lgl__glReal_glProgramUniform1fv;
+static PFNGLPROGRAMUNIFORM1DPROC lgl__glReal_glProgramUniform1d;
+static PFNGLPROGRAMUNIFORM1DVPROC lgl__glReal_glProgramUniform1dv;
+static PFNGLPROGRAMUNIFORM1UIPROC lgl__glReal_glProgramUniform1ui;
+static PFNGLPROGRAMUNIFORM1UIVPROC lgl__glReal_glProgramUniform1uiv;
+static PFNGLPROGRAMUNIFORM2IPROC lgl__glReal_glProgramUniform2i;
+static PFNGLPROGRAMUNIFORM2IVPROC lgl__glReal_glProgramUniform2iv;
+static PFNGLPROGRAMUNIFORM2FPROC lgl__glReal_glProgramUniform2f;
+static PFNGLPROGRAMUNIFORM2FVPROC lgl__glReal_glProgramUniform2fv;
+static PFNGLPROGRAMUNIFORM2DPROC lgl__glReal_glProgramUniform2d;
+static PFNGLPROGRAMUNIFORM2DVPROC lgl__glReal_glProgramUniform2dv;
+static PFNGLPROGRAMUNIFORM2UIPROC lgl__glReal_glProgramUniform2ui;
+static PFNGLPROGRAMUNIFORM2UIVPROC lgl__glReal_glProgramUniform2uiv;
+static PFNGLPROGRAMUNIFORM3IPROC lgl__glReal_glProgramUniform3i;
+static PFNGLPROGRAMUNIFORM3IVPROC lgl__glReal_glProgramUniform3iv;
+static PFNGLPROGRAMUNIFORM3FPROC lgl__glReal_glProgramUniform3f;
+static PFNGLPROGRAMUNIFORM3FVPROC lgl__glReal_glProgramUniform3fv;
+static PFNGLPROGRAMUNIFORM3DPROC lgl__glReal_glProgramUniform3d;
+static PFNGLPROGRAMUNIFORM3DVPROC lgl__glReal_glProgramUniform3dv;
+static PFNGLPROGRAMUNIFORM3UIPROC lgl__glReal_glProgramUniform3ui;
+static PFNGLPROGRAMUNIFORM3UIVPROC lgl__glReal_glProgramUniform3uiv;
+static PFNGLPROGRAMUNIFORM4IPROC lgl__glReal_glProgramUniform4i;
+static PFNGLPROGRAMUNIFORM4IVPROC lgl__glReal_glProgramUniform4iv;
+static PFNGLPROGRAMUNIFORM4FPROC lgl__glReal_glProgramUniform4f;
+static PFNGLPROGRAMUNIFORM4FVPROC lgl__glReal_glProgramUniform4fv;
+static PFNGLPROGRAMUNIFORM4DPROC lgl__glReal_glProgramUniform4d;
+static PFNGLPROGRAMUNIFORM4DVPROC lgl__glReal_glProgramUniform4dv;
+static PFNGLPROGRAMUNIFORM4UIPROC lgl__glReal_glProgramUniform4ui;
+static PFNGLPROGRAMUNIFORM4UIVPROC lgl__glReal_glProgramUniform4uiv;
+static PFNGLPROGRAMUNIFORMMATRIX2FVPROC lgl__glReal_glProgramUniformMatrix2fv;
+static PFNGLPROGRAMUNIFORMMATRIX3FVPROC lgl__glReal_glProgramUniformMatrix3fv;
+static PFNGLPROGRAMUNIFORMMATRIX4FVPROC lgl__glReal_glProgramUniformMatrix4fv;
+static PFNGLPROGRAMUNIFORMMATRIX2DVPROC lgl__glReal_glProgramUniformMatrix2dv;
+static PFNGLPROGRAMUNIFORMMATRIX3DVPROC lgl__glReal_glProgramUniformMatrix3dv;
+static PFNGLPROGRAMUNIFORMMATRIX4DVPROC lgl__glReal_glProgramUniformMatrix4dv;
+static PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC lgl__glReal_glProgramUniformMatrix2x3fv;
+static PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC lgl__glReal_glProgramUniformMatrix3x2fv;
+static PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC lgl__glReal_glProgramUniformMatrix2x4fv;
+static PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC lgl__glReal_glProgramUniformMatrix4x2fv;
+static PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC lgl__glReal_glProgramUniformMatrix3x4fv;
+static PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC lgl__glReal_glProgramUniformMatrix4x3fv;
+static PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC lgl__glReal_glProgramUniformMatrix2x3dv;
+static PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC lgl__glReal_glProgramUniformMatrix3x2dv;
+static PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC lgl__glReal_glProgramUniformMatrix2x4dv;
+static PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC lgl__glReal_glProgramUniformMatrix4x2dv;
+static PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC lgl__glReal_glProgramUniformMatrix3x4dv;
+static PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC lgl__glReal_glProgramUniformMatrix4x3dv;
+static PFNGLVALIDATEPROGRAMPIPELINEPROC lgl__glReal_glValidateProgramPipeline;
+static PFNGLGETPROGRAMPIPELINEINFOLOGPROC lgl__glReal_glGetProgramPipelineInfoLog;
+static PFNGLVERTEXATTRIBL1DPROC lgl__glReal_glVertexAttribL1d;
+static PFNGLVERTEXATTRIBL2DPROC lgl__glReal_glVertexAttribL2d;
+static PFNGLVERTEXATTRIBL3DPROC lgl__glReal_glVertexAttribL3d;
+static PFNGLVERTEXATTRIBL4DPROC lgl__glReal_glVertexAttribL4d;
+static PFNGLVERTEXATTRIBL1DVPROC lgl__glReal_glVertexAttribL1dv;
+static PFNGLVERTEXATTRIBL2DVPROC lgl__glReal_glVertexAttribL2dv;
+static PFNGLVERTEXATTRIBL3DVPROC lgl__glReal_glVertexAttribL3dv;
+static PFNGLVERTEXATTRIBL4DVPROC lgl__glReal_glVertexAttribL4dv;
+static PFNGLVERTEXATTRIBLPOINTERPROC lgl__glReal_glVertexAttribLPointer;
+static PFNGLGETVERTEXATTRIBLDVPROC lgl__glReal_glGetVertexAttribLdv;
+static PFNGLVIEWPORTARRAYVPROC lgl__glReal_glViewportArrayv;
+static PFNGLVIEWPORTINDEXEDFPROC lgl__glReal_glViewportIndexedf;
+static PFNGLVIEWPORTINDEXEDFVPROC lgl__glReal_glViewportIndexedfv;
+static PFNGLSCISSORARRAYVPROC lgl__glReal_glScissorArrayv;
+static PFNGLSCISSORINDEXEDPROC lgl__glReal_glScissorIndexed;
+static PFNGLSCISSORINDEXEDVPROC lgl__glReal_glScissorIndexedv;
+static PFNGLDEPTHRANGEARRAYVPROC lgl__glReal_glDepthRangeArrayv;
+static PFNGLDEPTHRANGEINDEXEDPROC lgl__glReal_glDepthRangeIndexed;
+static PFNGLGETFLOATI_VPROC lgl__glReal_glGetFloati_v;
+static PFNGLGETDOUBLEI_VPROC lgl__glReal_glGetDoublei_v;
+static PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC lgl__glReal_glDrawArraysInstancedBaseInstance;
+static PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC lgl__glReal_glDrawElementsInstancedBaseInstance;
+static PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC lgl__glReal_glDrawElementsInstancedBaseVertexBaseInstance;
+static PFNGLGETINTERNALFORMATIVPROC lgl__glReal_glGetInternalformativ;
+static PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC lgl__glReal_glGetActiveAtomicCounterBufferiv;
+static PFNGLBINDIMAGETEXTUREPROC lgl__glReal_glBindImageTexture;
+static PFNGLMEMORYBARRIERPROC lgl__glReal_glMemoryBarrier;
+static PFNGLTEXSTORAGE1DPROC lgl__glReal_glTexStorage1D;
+static PFNGLTEXSTORAGE2DPROC lgl__glReal_glTexStorage2D;
+static PFNGLTEXSTORAGE3DPROC lgl__glReal_glTexStorage3D;
+static PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC lgl__glReal_glDrawTransformFeedbackInstanced;
+static PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC lgl__glReal_glDrawTransformFeedbackStreamInstanced;
+static PFNGLCLEARBUFFERDATAPROC lgl__glReal_glClearBufferData;
+static PFNGLCLEARBUFFERSUBDATAPROC lgl__glReal_glClearBufferSubData;
+static PFNGLDISPATCHCOMPUTEPROC lgl__glReal_glDispatchCompute;
+static PFNGLDISPATCHCOMPUTEINDIRECTPROC lgl__glReal_glDispatchComputeIndirect;
+static PFNGLCOPYIMAGESUBDATAPROC lgl__glReal_glCopyImageSubData;
+static PFNGLFRAMEBUFFERPARAMETERIPROC lgl__glReal_glFramebufferParameteri;
+static PFNGLGETFRAMEBUFFERPARAMETERIVPROC lgl__glReal_glGetFramebufferParameteriv;
+static PFNGLGETINTERNALFORMATI64VPROC lgl__glReal_glGetInternalformati64v;
+static PFNGLINVALIDATETEXSUBIMAGEPROC lgl__glReal_glInvalidateTexSubImage;
+static PFNGLINVALIDATETEXIMAGEPROC lgl__glReal_glInvalidateTexImage;
+static PFNGLINVALIDATEBUFFERSUBDATAPROC lgl__glReal_glInvalidateBufferSubData;
+static PFNGLINVALIDATEBUFFERDATAPROC lgl__glReal_glInvalidateBufferData;
+static PFNGLINVALIDATEFRAMEBUFFERPROC lgl__glReal_glInvalidateFramebuffer;
+static PFNGLINVALIDATESUBFRAMEBUFFERPROC lgl__glReal_glInvalidateSubFramebuffer;
+static PFNGLMULTIDRAWARRAYSINDIRECTPROC lgl__glReal_glMultiDrawArraysIndirect;
+static PFNGLMULTIDRAWELEMENTSINDIRECTPROC lgl__glReal_glMultiDrawElementsIndirect;
+static PFNGLGETPROGRAMINTERFACEIVPROC lgl__glReal_glGetProgramInterfaceiv;
+static PFNGLGETPROGRAMRESOURCEINDEXPROC lgl__glReal_glGetProgramResourceIndex;
+static PFNGLGETPROGRAMRESOURCENAMEPROC lgl__glReal_glGetProgramResourceName;
+static PFNGLGETPROGRAMRESOURCEIVPROC lgl__glReal_glGetProgramResourceiv;
+static PFNGLGETPROGRAMRESOURCELOCATIONPROC lgl__glReal_glGetProgramResourceLocation;
+static PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC lgl__glReal_glGetProgramResourceLocationIndex;
+static PFNGLSHADERSTORAGEBLOCKBINDINGPROC lgl__glReal_glShaderStorageBlockBinding;
+static PFNGLTEXBUFFERRANGEPROC lgl__glReal_glTexBufferRange;
+static PFNGLTEXSTORAGE2DMULTISAMPLEPROC lgl__glReal_glTexStorage2DMultisample;
+static PFNGLTEXSTORAGE3DMULTISAMPLEPROC lgl__glReal_glTexStorage3DMultisample;
+static PFNGLTEXTUREVIEWPROC lgl__glReal_glTextureView;
+static PFNGLBINDVERTEXBUFFERPROC lgl__glReal_glBindVertexBuffer;
+static PFNGLVERTEXATTRIBFORMATPROC lgl__glReal_glVertexAttribFormat;
+static PFNGLVERTEXATTRIBIFORMATPROC lgl__glReal_glVertexAttribIFormat;
+static PFNGLVERTEXATTRIBLFORMATPROC lgl__glReal_glVertexAttribLFormat;
+static PFNGLVERTEXATTRIBBINDINGPROC lgl__glReal_glVertexAttribBinding;
+static PFNGLVERTEXBINDINGDIVISORPROC lgl__glReal_glVertexBindingDivisor;
+static PFNGLDEBUGMESSAGECONTROLPROC lgl__glReal_glDebugMessageControl;
+static PFNGLDEBUGMESSAGEINSERTPROC lgl__glReal_glDebugMessageInsert;
+static PFNGLDEBUGMESSAGECALLBACKPROC lgl__glReal_glDebugMessageCallback;
+static PFNGLGETDEBUGMESSAGELOGPROC lgl__glReal_glGetDebugMessageLog;
+static PFNGLPUSHDEBUGGROUPPROC lgl__glReal_glPushDebugGroup;
+static PFNGLPOPDEBUGGROUPPROC lgl__glReal_glPopDebugGroup;
+static PFNGLOBJECTLABELPROC lgl__glReal_glObjectLabel;
+static PFNGLGETOBJECTLABELPROC lgl__glReal_glGetObjectLabel;
+static PFNGLOBJECTPTRLABELPROC lgl__glReal_glObjectPtrLabel;
+static PFNGLGETOBJECTPTRLABELPROC lgl__glReal_glGetObjectPtrLabel;
+static PFNGLGETPOINTERVPROC lgl__glReal_glGetPointerv;
+static PFNGLBUFFERSTORAGEPROC lgl__glReal_glBufferStorage;
+static PFNGLCLEARTEXIMAGEPROC lgl__glReal_glClearTexImage;
+static PFNGLCLEARTEXSUBIMAGEPROC lgl__glReal_glClearTexSubImage;
+static PFNGLBINDBUFFERSBASEPROC lgl__glReal_glBindBuffersBase;
+static PFNGLBINDBUFFERSRANGEPROC lgl__glReal_glBindBuffersRange;
+static PFNGLBINDTEXTURESPROC lgl__glReal_glBindTextures;
+static PFNGLBINDSAMPLERSPROC lgl__glReal_glBindSamplers;
+static PFNGLBINDIMAGETEXTURESPROC lgl__glReal_glBindImageTextures;
+static PFNGLBINDVERTEXBUFFERSPROC lgl__glReal_glBindVertexBuffers;
+static PFNGLCLIPCONTROLPROC lgl__glReal_glClipControl;
+static PFNGLCREATETRANSFORMFEEDBACKSPROC lgl__glReal_glCreateTransformFeedbacks;
+static PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC lgl__glReal_glTransformFeedbackBufferBase;
+static PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC lgl__glReal_glTransformFeedbackBufferRange;
+static PFNGLGETTRANSFORMFEEDBACKIVPROC lgl__glReal_glGetTransformFeedbackiv;
+static PFNGLGETTRANSFORMFEEDBACKI_VPROC lgl__glReal_glGetTransformFeedbacki_v;
+static PFNGLGETTRANSFORMFEEDBACKI64_VPROC lgl__glReal_glGetTransformFeedbacki64_v;
+static PFNGLCREATEBUFFERSPROC lgl__glReal_glCreateBuffers;
+static PFNGLNAMEDBUFFERSTORAGEPROC lgl__glReal_glNamedBufferStorage;
+static PFNGLNAMEDBUFFERDATAPROC lgl__glReal_glNamedBufferData;
+static PFNGLNAMEDBUFFERSUBDATAPROC lgl__glReal_glNamedBufferSubData;
+static PFNGLCOPYNAMEDBUFFERSUBDATAPROC lgl__glReal_glCopyNamedBufferSubData;
+static PFNGLCLEARNAMEDBUFFERDATAPROC lgl__glReal_glClearNamedBufferData;
+static PFNGLCLEARNAMEDBUFFERSUBDATAPROC lgl__glReal_glClearNamedBufferSubData;
+static PFNGLMAPNAMEDBUFFERPROC lgl__glReal_glMapNamedBuffer;
+static PFNGLMAPNAMEDBUFFERRANGEPROC lgl__glReal_glMapNamedBufferRange;
+static PFNGLUNMAPNAMEDBUFFERPROC lgl__glReal_glUnmapNamedBuffer;
+static PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC lgl__glReal_glFlushMappedNamedBufferRange;
+static PFNGLGETNAMEDBUFFERPARAMETERIVPROC lgl__glReal_glGetNamedBufferParameteriv;
+static PFNGLGETNAMEDBUFFERPARAMETERI64VPROC lgl__glReal_glGetNamedBufferParameteri64v;
+static PFNGLGETNAMEDBUFFERPOINTERVPROC lgl__glReal_glGetNamedBufferPointerv;
+static PFNGLGETNAMEDBUFFERSUBDATAPROC lgl__glReal_glGetNamedBufferSubData;
+static PFNGLCREATEFRAMEBUFFERSPROC lgl__glReal_glCreateFramebuffers;
+static PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC lgl__glReal_glNamedFramebufferRenderbuffer;
+static PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC lgl__glReal_glNamedFramebufferParameteri;
+static PFNGLNAMEDFRAMEBUFFERTEXTUREPROC lgl__glReal_glNamedFramebufferTexture;
+static PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC lgl__glReal_glNamedFramebufferTextureLayer;
+static PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC lgl__glReal_glNamedFramebufferDrawBuffer;
+static PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC lgl__glReal_glNamedFramebufferDrawBuffers;
+static PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC lgl__glReal_glNamedFramebufferReadBuffer;
+static PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC lgl__glReal_glInvalidateNamedFramebufferData;
+static PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC lgl__glReal_glInvalidateNamedFramebufferSubData;
+static PFNGLCLEARNAMEDFRAMEBUFFERIVPROC lgl__glReal_glClearNamedFramebufferiv;
+static PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC lgl__glReal_glClearNamedFramebufferuiv;
+static PFNGLCLEARNAMEDFRAMEBUFFERFVPROC lgl__glReal_glClearNamedFramebufferfv;
+static PFNGLCLEARNAMEDFRAMEBUFFERFIPROC lgl__glReal_glClearNamedFramebufferfi;
+static PFNGLBLITNAMEDFRAMEBUFFERPROC lgl__glReal_glBlitNamedFramebuffer;
+static PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC lgl__glReal_glCheckNamedFramebufferStatus;
+static PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC lgl__glReal_glGetNamedFramebufferParameteriv;
+static PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC lgl__glReal_glGetNamedFramebufferAttachmentParameteriv;
+static PFNGLCREATERENDERBUFFERSPROC lgl__glReal_glCreateRenderbuffers;
+static PFNGLNAMEDRENDERBUFFERSTORAGEPROC lgl__glReal_glNamedRenderbufferStorage;
+static PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC lgl__glReal_glNamedRenderbufferStorageMultisample;
+static PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC lgl__glReal_glGetNamedRenderbufferParameteriv;
+static PFNGLCREATETEXTURESPROC lgl__glReal_glCreateTextures;
+static PFNGLTEXTUREBUFFERPROC lgl__glReal_glTextureBuffer;
+static PFNGLTEXTUREBUFFERRANGEPROC lgl__glReal_glTextureBufferRange;
+static PFNGLTEXTURESTORAGE1DPROC lgl__glReal_glTextureStorage1D;
+static PFNGLTEXTURESTORAGE2DPROC lgl__glReal_glTextureStorage2D;
+static PFNGLTEXTURESTORAGE3DPROC lgl__glReal_glTextureStorage3D;
+static PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC lgl__glReal_glTextureStorage2DMultisample;
+static PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC lgl__glReal_glTextureStorage3DMultisample;
+static PFNGLTEXTURESUBIMAGE1DPROC lgl__glReal_glTextureSubImage1D;
+static PFNGLTEXTURESUBIMAGE2DPROC lgl__glReal_glTextureSubImage2D;
+static PFNGLTEXTURESUBIMAGE3DPROC lgl__glReal_glTextureSubImage3D;
+static PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC lgl__glReal_glCompressedTextureSubImage1D;
+static PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC lgl__glReal_glCompressedTextureSubImage2D;
+static PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC lgl__glReal_glCompressedTextureSubImage3D;
+static PFNGLCOPYTEXTURESUBIMAGE1DPROC lgl__glReal_glCopyTextureSubImage1D;
+static PFNGLCOPYTEXTURESUBIMAGE2DPROC lgl__glReal_glCopyTextureSubImage2D;
+static PFNGLCOPYTEXTURESUBIMAGE3DPROC lgl__glReal_glCopyTextureSubImage3D;
+static PFNGLTEXTUREPARAMETERFPROC lgl__glReal_glTextureParameterf;
+static PFNGLTEXTUREPARAMETERFVPROC lgl__glReal_glTextureParameterfv;
+static PFNGLTEXTUREPARAMETERIPROC lgl__glReal_glTextureParameteri;
+static PFNGLTEXTUREPARAMETERIIVPROC lgl__glReal_glTextureParameterIiv;
+static PFNGLTEXTUREPARAMETERIUIVPROC lgl__glReal_glTextureParameterIuiv;
+static PFNGLTEXTUREPARAMETERIVPROC lgl__glReal_glTextureParameteriv;
+static PFNGLGENERATETEXTUREMIPMAPPROC lgl__glReal_glGenerateTextureMipmap;
+static PFNGLBINDTEXTUREUNITPROC lgl__glReal_glBindTextureUnit;
+static PFNGLGETTEXTUREIMAGEPROC lgl__glReal_glGetTextureImage;
+static PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC lgl__glReal_glGetCompressedTextureImage;
+static PFNGLGETTEXTURELEVELPARAMETERFVPROC lgl__glReal_glGetTextureLevelParameterfv;
+static PFNGLGETTEXTURELEVELPARAMETERIVPROC lgl__glReal_glGetTextureLevelParameteriv;
+static PFNGLGETTEXTUREPARAMETERFVPROC lgl__glReal_glGetTextureParameterfv;
+static PFNGLGETTEXTUREPARAMETERIIVPROC lgl__glReal_glGetTextureParameterIiv;
+static PFNGLGETTEXTUREPARAMETERIUIVPROC lgl__glReal_glGetTextureParameterIuiv;
+static PFNGLGETTEXTUREPARAMETERIVPROC lgl__glReal_glGetTextureParameteriv;
+static PFNGLCREATEVERTEXARRAYSPROC lgl__glReal_glCreateVertexArrays;
+static PFNGLDISABLEVERTEXARRAYATTRIBPROC lgl__glReal_glDisableVertexArrayAttrib;
+static PFNGLENABLEVERTEXARRAYATTRIBPROC lgl__glReal_glEnableVertexArrayAttrib;
+static PFNGLVERTEXARRAYELEMENTBUFFERPROC lgl__glReal_glVertexArrayElementBuffer;
+static PFNGLVERTEXARRAYVERTEXBUFFERPROC lgl__glReal_glVertexArrayVertexBuffer;
+static PFNGLVERTEXARRAYVERTEXBUFFERSPROC lgl__glReal_glVertexArrayVertexBuffers;
+static PFNGLVERTEXARRAYATTRIBBINDINGPROC lgl__glReal_glVertexArrayAttribBinding;
+static PFNGLVERTEXARRAYATTRIBFORMATPROC lgl__glReal_glVertexArrayAttribFormat;
+static PFNGLVERTEXARRAYATTRIBIFORMATPROC lgl__glReal_glVertexArrayAttribIFormat;
+static PFNGLVERTEXARRAYATTRIBLFORMATPROC lgl__glReal_glVertexArrayAttribLFormat;
+static PFNGLVERTEXARRAYBINDINGDIVISORPROC lgl__glReal_glVertexArrayBindingDivisor;
+static PFNGLGETVERTEXARRAYIVPROC lgl__glReal_glGetVertexArrayiv;
+static PFNGLGETVERTEXARRAYINDEXEDIVPROC lgl__glReal_glGetVertexArrayIndexediv;
+static PFNGLGETVERTEXARRAYINDEXED64IVPROC lgl__glReal_glGetVertexArrayIndexed64iv;
+static PFNGLCREATESAMPLERSPROC lgl__glReal_glCreateSamplers;
+static PFNGLCREATEPROGRAMPIPELINESPROC lgl__glReal_glCreateProgramPipelines;
+static PFNGLCREATEQUERIESPROC lgl__glReal_glCreateQueries;
+static PFNGLGETQUERYBUFFEROBJECTI64VPROC lgl__glReal_glGetQueryBufferObjecti64v;
+static PFNGLGETQUERYBUFFEROBJECTIVPROC lgl__glReal_glGetQueryBufferObjectiv;
+static PFNGLGETQUERYBUFFEROBJECTUI64VPROC lgl__glReal_glGetQueryBufferObjectui64v;
+static PFNGLGETQUERYBUFFEROBJECTUIVPROC lgl__glReal_glGetQueryBufferObjectuiv;
+static PFNGLMEMORYBARRIERBYREGIONPROC lgl__glReal_glMemoryBarrierByRegion;
+static PFNGLGETTEXTURESUBIMAGEPROC lgl__glReal_glGetTextureSubImage;
+static PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC lgl__glReal_glGetCompressedTextureSubImage;
+static PFNGLGETGRAPHICSRESETSTATUSPROC lgl__glReal_glGetGraphicsResetStatus;
+static PFNGLGETNCOMPRESSEDTEXIMAGEPROC lgl__glReal_glGetnCompressedTexImage;
+static PFNGLGETNTEXIMAGEPROC lgl__glReal_glGetnTexImage;
+static PFNGLGETNUNIFORMDVPROC lgl__glReal_glGetnUniformdv;
+static PFNGLGETNUNIFORMFVPROC lgl__glReal_glGetnUniformfv;
+static PFNGLGETNUNIFORMIVPROC lgl__glReal_glGetnUniformiv;
+static PFNGLGETNUNIFORMUIVPROC lgl__glReal_glGetnUniformuiv;
+static PFNGLREADNPIXELSPROC lgl__glReal_glReadnPixels;
+static PFNGLGETNMAPDVPROC lgl__glReal_glGetnMapdv;
+static PFNGLGETNMAPFVPROC lgl__glReal_glGetnMapfv;
+static PFNGLGETNMAPIVPROC lgl__glReal_glGetnMapiv;
+static PFNGLGETNPIXELMAPFVPROC lgl__glReal_glGetnPixelMapfv;
+static PFNGLGETNPIXELMAPUIVPROC lgl__glReal_glGetnPixelMapuiv;
+static PFNGLGETNPIXELMAPUSVPROC lgl__glReal_glGetnPixelMapusv;
+static PFNGLGETNPOLYGONSTIPPLEPROC lgl__glReal_glGetnPolygonStipple;
+static PFNGLGETNCOLORTABLEPROC lgl__glReal_glGetnColorTable;
+static PFNGLGETNCONVOLUTIONFILTERPROC lgl__glReal_glGetnConvolutionFilter;
+static PFNGLGETNSEPARABLEFILTERPROC lgl__glReal_glGetnSeparableFilter;
+static PFNGLGETNHISTOGRAMPROC lgl__glReal_glGetnHistogram;
+static PFNGLGETNMINMAXPROC lgl__glReal_glGetnMinmax;
+static PFNGLTEXTUREBARRIERPROC lgl__glReal_glTextureBarrier;
+static PFNGLSPECIALIZESHADERPROC lgl__glReal_glSpecializeShader;
+static PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC lgl__glReal_glMultiDrawArraysIndirectCount;
+static PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC lgl__glReal_glMultiDrawElementsIndirectCount;
+static PFNGLPOLYGONOFFSETCLAMPPROC lgl__glReal_glPolygonOffsetClamp;
+
+static void lgl__glCapture_glCullFace(GLenum mode)
+{
+	lgl__glCaptureBegin(0);
+	lgl__glCaptureValue(&mode, sizeof(mode));
+}
+
+static void lgl__glCapture_glFrontFace(GLenum mode)
+{
+	lgl__glCaptureBegin(1);
+	lgl__glCaptureValue(&mode, sizeof(mode));
+}
+
+static void lgl__glCapture_glHint(GLenum target, GLenum mode)
+{
+	lgl__glCaptureBegin(2);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&mode, sizeof(mode));
+}
+
+static void lgl__glCapture_glLineWidth(GLfloat width)
+{
+	lgl__glCaptureBegin(3);
+	lgl__glCaptureValue(&width, sizeof(width));
+}
+
+static void lgl__glCapture_glPointSize(GLfloat size)
+{
+	lgl__glCaptureBegin(4);
+	lgl__glCaptureValue(&size, sizeof(size));
+}
+
+static void lgl__glCapture_glPolygonMode(GLenum face, GLenum mode)
+{
+	lgl__glCaptureBegin(5);
+	lgl__glCaptureValue(&face, sizeof(face));
+	lgl__glCaptureValue(&mode, sizeof(mode));
+}
+
+static void lgl__glCapture_glScissor(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+	lgl__glCaptureBegin(6);
+	lgl__glCaptureValue(&x, sizeof(x));
+	lgl__glCaptureValue(&y, sizeof(y));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&height, sizeof(height));
+}
+
+static void lgl__glCapture_glTexParameterf(GLenum target, GLenum pname, GLfloat param)
+{
+	lgl__glCaptureBegin(7);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	lgl__glCaptureValue(&param, sizeof(param));
+}
+
+static void lgl__glCapture_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params)
+{
+	lgl__glCaptureBegin(8);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	lgl__glCaptureData(params, params ? (size_t)(lgl__glCaptureParamCount(pname) * sizeof(*params)) : 0);
+}
+
+static void lgl__glCapture_glTexParameteri(GLenum target, GLenum pname, GLint param)
+{
+	lgl__glCaptureBegin(9);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	lgl__glCaptureValue(&param, sizeof(param));
+}
+
+static void lgl__glCapture_glTexParameteriv(GLenum target, GLenum pname, const GLint *params)
+{
+	lgl__glCaptureBegin(10);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	lgl__glCaptureData(params, params ? (size_t)(lgl__glCaptureParamCount(pname) * sizeof(*params)) : 0);
+}
+
+static void lgl__glCapture_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+	lgl__glCaptureBegin(11);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&level, sizeof(level));
+	lgl__glCaptureValue(&internalformat, sizeof(internalformat));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&border, sizeof(border));
+	lgl__glCaptureValue(&format, sizeof(format));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureUnpack(pixels, (size_t)(lgl__glCapturePixelBytes(width, 1, 1, format, type, 0)));
+}
+
+static void lgl__glCapture_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+	lgl__glCaptureBegin(12);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&level, sizeof(level));
+	lgl__glCaptureValue(&internalformat, sizeof(internalformat));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&height, sizeof(height));
+	lgl__glCaptureValue(&border, sizeof(border));
+	lgl__glCaptureValue(&format, sizeof(format));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureUnpack(pixels, (size_t)(lgl__glCapturePixelBytes(width, height, 1, format, type, 0)));
+}
+
+static void lgl__glCapture_glDrawBuffer(GLenum buf)
+{
+	lgl__glCaptureBegin(13);
+	lgl__glCaptureValue(&buf, sizeof(buf));
+}
+
+static void lgl__glCapture_glClear(GLbitfield mask)
+{
+	lgl__glCaptureBegin(14);
+	lgl__glCaptureValue(&mask, sizeof(mask));
+}
+
+static void lgl__glCapture_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+	lgl__glCaptureBegin(15);
+	lgl__glCaptureValue(&red, sizeof(red));
+	lgl__glCaptureValue(&green, sizeof(green));
+	lgl__glCaptureValue(&blue, sizeof(blue));
+	lgl__glCaptureValue(&alpha, sizeof(alpha));
+}
+
+static void lgl__glCapture_glClearStencil(GLint s)
+{
+	lgl__glCaptureBegin(16);
+	lgl__glCaptureValue(&s, sizeof(s));
+}
+
+static void lgl__glCapture_glClearDepth(GLdouble depth)
+{
+	lgl__glCaptureBegin(17);
+	lgl__glCaptureValue(&depth, sizeof(depth));
+}
+
+static void lgl__glCapture_glStencilMask(GLuint mask)
+{
+	lgl__glCaptureBegin(18);
+	lgl__glCaptureValue(&mask, sizeof(mask));
+}
+
+static void lgl__glCapture_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)
+{
+	lgl__glCaptureBegin(19);
+	lgl__glCaptureValue(&red, sizeof(red));
+	lgl__glCaptureValue(&green, sizeof(green));
+	lgl__glCaptureValue(&blue, sizeof(blue));
+	lgl__glCaptureValue(&alpha, sizeof(alpha));
+}
+
+static void lgl__glCapture_glDepthMask(GLboolean flag)
+{
+	lgl__glCaptureBegin(20);
+	lgl__glCaptureValue(&flag, sizeof(flag));
+}
+
+static void lgl__glCapture_glDisable(GLenum cap)
+{
+	lgl__glCaptureBegin(21);
+	lgl__glCaptureValue(&cap, sizeof(cap));
+}
+
+static void lgl__glCapture_glEnable(GLenum cap)
+{
+	lgl__glCaptureBegin(22);
+	lgl__glCaptureValue(&cap, sizeof(cap));
+}
+
+static void lgl__glCapture_glFinish(void)
+{
+	lgl__glCaptureBegin(23);
+}
+
+static void lgl__glCapture_glFlush(void)
+{
+	lgl__glCaptureBegin(24);
+}
+
+static void lgl__glCapture_glBlendFunc(GLenum sfactor, GLenum dfactor)
+{
+	lgl__glCaptureBegin(25);
+	lgl__glCaptureValue(&sfactor, sizeof(sfactor));
+	lgl__glCaptureValue(&dfactor, sizeof(dfactor));
+}
+
+static void lgl__glCapture_glLogicOp(GLenum opcode)
+{
+	lgl__glCaptureBegin(26);
+	lgl__glCaptureValue(&opcode, sizeof(opcode));
+}
+
+static void lgl__glCapture_glStencilFunc(GLenum func, GLint ref, GLuint mask)
+{
+	lgl__glCaptureBegin(27);
+	lgl__glCaptureValue(&func, sizeof(func));
+	lgl__glCaptureValue(&ref, sizeof(ref));
+	lgl__glCaptureValue(&mask, sizeof(mask));
+}
+
+static void lgl__glCapture_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass)
+{
+	lgl__glCaptureBegin(28);
+	lgl__glCaptureValue(&fail, sizeof(fail));
+	lgl__glCaptureValue(&zfail, sizeof(zfail));
+	lgl__glCaptureValue(&zpass, sizeof(zpass));
+}
+
+static void lgl__glCapture_glDepthFunc(GLenum func)
+{
+	lgl__glCaptureBegin(29);
+	lgl__glCaptureValue(&func, sizeof(func));
+}
+
+static void lgl__glCapture_glPixelStoref(GLenum pname, GLfloat param)
+{
+	lgl__glCaptureBegin(30);
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	lgl__glCaptureValue(&param, sizeof(param));
+}
+
+static void lgl__glCapture_glPixelStorei(GLenum pname, GLint param)
+{
+	lgl__glCaptureBegin(31);
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	lgl__glCaptureValue(&param, sizeof(param));
+}
+
+static void lgl__glCapture_glReadBuffer(GLenum src)
+{
+	lgl__glCaptureBegin(32);
+	lgl__glCaptureValue(&src, sizeof(src));
+}
+
+static void lgl__glCapture_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels)
+{
+	lgl__glCaptureBegin(33);
+	lgl__glCaptureValue(&x, sizeof(x));
+	lgl__glCaptureValue(&y, sizeof(y));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&height, sizeof(height));
+	lgl__glCaptureValue(&format, sizeof(format));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCapturePack(pixels, (size_t)(lgl__glCapturePixelBytes(width, height, 1, format, type, 1)));
+}
+
+static void lgl__glCapture_glGetBooleanv(GLenum pname, GLboolean *data)
+{
+	lgl__glCaptureBegin(34);
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)data;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetDoublev(GLenum pname, GLdouble *data)
+{
+	lgl__glCaptureBegin(35);
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)data;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetError(GLenum lgl__result)
+{
+	lgl__glCaptureBegin(36);
+	lgl__glCaptureValue(&lgl__result, sizeof(lgl__result));
+}
+
+static void lgl__glCapture_glGetFloatv(GLenum pname, GLfloat *data)
+{
+	lgl__glCaptureBegin(37);
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)data;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetIntegerv(GLenum pname, GLint *data)
+{
+	lgl__glCaptureBegin(38);
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)data;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetString(GLenum name, const GLubyte * lgl__result)
+{
+	lgl__glCaptureBegin(39);
+	lgl__glCaptureValue(&name, sizeof(name));
+	(void)lgl__result;
+}
+
+static void lgl__glCapture_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels)
+{
+	(void)target;
+	(void)level;
+	(void)format;
+	(void)type;
+	(void)pixels;
+	lgl__glCaptureLossy(40);
+}
+
+static void lgl__glCapture_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat *params)
+{
+	lgl__glCaptureBegin(41);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetTexParameteriv(GLenum target, GLenum pname, GLint *params)
+{
+	lgl__glCaptureBegin(42);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params)
+{
+	lgl__glCaptureBegin(43);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&level, sizeof(level));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params)
+{
+	lgl__glCaptureBegin(44);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&level, sizeof(level));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glIsEnabled(GLenum cap, GLboolean lgl__result)
+{
+	lgl__glCaptureBegin(45);
+	lgl__glCaptureValue(&cap, sizeof(cap));
+	lgl__glCaptureValue(&lgl__result, sizeof(lgl__result));
+}
+
+static void lgl__glCapture_glDepthRange(GLdouble n, GLdouble f)
+{
+	lgl__glCaptureBegin(46);
+	lgl__glCaptureValue(&n, sizeof(n));
+	lgl__glCaptureValue(&f, sizeof(f));
+}
+
+static void lgl__glCapture_glViewport(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+	lgl__glCaptureBegin(47);
+	lgl__glCaptureValue(&x, sizeof(x));
+	lgl__glCaptureValue(&y, sizeof(y));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&height, sizeof(height));
+}
+
+static void lgl__glCapture_glDrawArrays(GLenum mode, GLint first, GLsizei count)
+{
+	lgl__glCaptureBegin(48);
+	lgl__glCaptureValue(&mode, sizeof(mode));
+	lgl__glCaptureValue(&first, sizeof(first));
+	lgl__glCaptureValue(&count, sizeof(count));
+}
+
+static void lgl__glCapture_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices)
+{
+	lgl__glCaptureBegin(49);
+	lgl__glCaptureValue(&mode, sizeof(mode));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureOffset(indices);
+}
+
+static void lgl__glCapture_glPolygonOffset(GLfloat factor, GLfloat units)
+{
+	lgl__glCaptureBegin(50);
+	lgl__glCaptureValue(&factor, sizeof(factor));
+	lgl__glCaptureValue(&units, sizeof(units));
+}
+
+static void lgl__glCapture_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border)
+{
+	lgl__glCaptureBegin(51);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&level, sizeof(level));
+	lgl__glCaptureValue(&internalformat, sizeof(internalformat));
+	lgl__glCaptureValue(&x, sizeof(x));
+	lgl__glCaptureValue(&y, sizeof(y));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&border, sizeof(border));
+}
+
+static void lgl__glCapture_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border)
+{
+	lgl__glCaptureBegin(52);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&level, sizeof(level));
+	lgl__glCaptureValue(&internalformat, sizeof(internalformat));
+	lgl__glCaptureValue(&x, sizeof(x));
+	lgl__glCaptureValue(&y, sizeof(y));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&height, sizeof(height));
+	lgl__glCaptureValue(&border, sizeof(border));
+}
+
+static void lgl__glCapture_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width)
+{
+	lgl__glCaptureBegin(53);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&level, sizeof(level));
+	lgl__glCaptureValue(&xoffset, sizeof(xoffset));
+	lgl__glCaptureValue(&x, sizeof(x));
+	lgl__glCaptureValue(&y, sizeof(y));
+	lgl__glCaptureValue(&width, sizeof(width));
+}
+
+static void lgl__glCapture_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+	lgl__glCaptureBegin(54);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&level, sizeof(level));
+	lgl__glCaptureValue(&xoffset, sizeof(xoffset));
+	lgl__glCaptureValue(&yoffset, sizeof(yoffset));
+	lgl__glCaptureValue(&x, sizeof(x));
+	lgl__glCaptureValue(&y, sizeof(y));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&height, sizeof(height));
+}
+
+static void lgl__glCapture_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels)
+{
+	lgl__glCaptureBegin(55);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&level, sizeof(level));
+	lgl__glCaptureValue(&xoffset, sizeof(xoffset));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&format, sizeof(format));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureUnpack(pixels, (size_t)(lgl__glCapturePixelBytes(width, 1, 1, format, type, 0)));
+}
+
+static void lgl__glCapture_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels)
+{
+	lgl__glCaptureBegin(56);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&level, sizeof(level));
+	lgl__glCaptureValue(&xoffset, sizeof(xoffset));
+	lgl__glCaptureValue(&yoffset, sizeof(yoffset));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&height, sizeof(height));
+	lgl__glCaptureValue(&format, sizeof(format));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureUnpack(pixels, (size_t)(lgl__glCapturePixelBytes(width, height, 1, format, type, 0)));
+}
+
+static void lgl__glCapture_glBindTexture(GLenum target, GLuint texture)
+{
+	lgl__glCaptureBegin(57);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&texture, sizeof(texture));
+}
+
+static void lgl__glCapture_glDeleteTextures(GLsizei n, const GLuint *textures)
+{
+	lgl__glCaptureBegin(58);
+	lgl__glCaptureValue(&n, sizeof(n));
+	lgl__glCaptureData(textures, textures ? (size_t)(n * sizeof(*textures)) : 0);
+}
+
+static void lgl__glCapture_glGenTextures(GLsizei n, GLuint *textures)
+{
+	lgl__glCaptureBegin(59);
+	lgl__glCaptureValue(&n, sizeof(n));
+	lgl__glCaptureRecord(textures, (size_t)(n * sizeof(GLuint)));
+}
+
+static void lgl__glCapture_glIsTexture(GLuint texture, GLboolean lgl__result)
+{
+	lgl__glCaptureBegin(60);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&lgl__result, sizeof(lgl__result));
+}
+
+static void lgl__glCapture_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices)
+{
+	lgl__glCaptureBegin(61);
+	lgl__glCaptureValue(&mode, sizeof(mode));
+	lgl__glCaptureValue(&start, sizeof(start));
+	lgl__glCaptureValue(&end, sizeof(end));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureOffset(indices);
+}
+
+static void lgl__glCapture_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+	lgl__glCaptureBegin(62);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&level, sizeof(level));
+	lgl__glCaptureValue(&internalformat, sizeof(internalformat));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&height, sizeof(height));
+	lgl__glCaptureValue(&depth, sizeof(depth));
+	lgl__glCaptureValue(&border, sizeof(border));
+	lgl__glCaptureValue(&format, sizeof(format));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureUnpack(pixels, (size_t)(lgl__glCapturePixelBytes(width, height, depth, format, type, 0)));
+}
+
+static void lgl__glCapture_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels)
+{
+	lgl__glCaptureBegin(63);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&level, sizeof(level));
+	lgl__glCaptureValue(&xoffset, sizeof(xoffset));
+	lgl__glCaptureValue(&yoffset, sizeof(yoffset));
+	lgl__glCaptureValue(&zoffset, sizeof(zoffset));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&height, sizeof(height));
+	lgl__glCaptureValue(&depth, sizeof(depth));
+	lgl__glCaptureValue(&format, sizeof(format));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureUnpack(pixels, (size_t)(lgl__glCapturePixelBytes(width, height, depth, format, type, 0)));
+}
+
+static void lgl__glCapture_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+	lgl__glCaptureBegin(64);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&level, sizeof(level));
+	lgl__glCaptureValue(&xoffset, sizeof(xoffset));
+	lgl__glCaptureValue(&yoffset, sizeof(yoffset));
+	lgl__glCaptureValue(&zoffset, sizeof(zoffset));
+	lgl__glCaptureValue(&x, sizeof(x));
+	lgl__glCaptureValue(&y, sizeof(y));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&height, sizeof(height));
+}
+
+static void lgl__glCapture_glActiveTexture(GLenum texture)
+{
+	lgl__glCaptureBegin(65);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+}
+
+static void lgl__glCapture_glSampleCoverage(GLfloat value, GLboolean invert)
+{
+	lgl__glCaptureBegin(66);
+	lgl__glCaptureValue(&value, sizeof(value));
+	lgl__glCaptureValue(&invert, sizeof(invert));
+}
+
+static void lgl__glCapture_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data)
+{
+	lgl__glCaptureBegin(67);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&level, sizeof(level));
+	lgl__glCaptureValue(&internalformat, sizeof(internalformat));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&height, sizeof(height));
+	lgl__glCaptureValue(&depth, sizeof(depth));
+	lgl__glCaptureValue(&border, sizeof(border));
+	lgl__glCaptureValue(&imageSize, sizeof(imageSize));
+	lgl__glCaptureUnpack(data, (size_t)(imageSize));
+}
+
+static void lgl__glCapture_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data)
+{
+	lgl__glCaptureBegin(68);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&level, sizeof(level));
+	lgl__glCaptureValue(&internalformat, sizeof(internalformat));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&height, sizeof(height));
+	lgl__glCaptureValue(&border, sizeof(border));
+	lgl__glCaptureValue(&imageSize, sizeof(imageSize));
+	lgl__glCaptureUnpack(data, (size_t)(imageSize));
+}
+
+static void lgl__glCapture_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data)
+{
+	lgl__glCaptureBegin(69);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&level, sizeof(level));
+	lgl__glCaptureValue(&internalformat, sizeof(internalformat));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&border, sizeof(border));
+	lgl__glCaptureValue(&imageSize, sizeof(imageSize));
+	lgl__glCaptureUnpack(data, (size_t)(imageSize));
+}
+
+static void lgl__glCapture_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data)
+{
+	lgl__glCaptureBegin(70);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&level, sizeof(level));
+	lgl__glCaptureValue(&xoffset, sizeof(xoffset));
+	lgl__glCaptureValue(&yoffset, sizeof(yoffset));
+	lgl__glCaptureValue(&zoffset, sizeof(zoffset));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&height, sizeof(height));
+	lgl__glCaptureValue(&depth, sizeof(depth));
+	lgl__glCaptureValue(&format, sizeof(format));
+	lgl__glCaptureValue(&imageSize, sizeof(imageSize));
+	lgl__glCaptureUnpack(data, (size_t)(imageSize));
+}
+
+static void lgl__glCapture_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data)
+{
+	lgl__glCaptureBegin(71);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&level, sizeof(level));
+	lgl__glCaptureValue(&xoffset, sizeof(xoffset));
+	lgl__glCaptureValue(&yoffset, sizeof(yoffset));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&height, sizeof(height));
+	lgl__glCaptureValue(&format, sizeof(format));
+	lgl__glCaptureValue(&imageSize, sizeof(imageSize));
+	lgl__glCaptureUnpack(data, (size_t)(imageSize));
+}
+
+static void lgl__glCapture_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data)
+{
+	lgl__glCaptureBegin(72);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&level, sizeof(level));
+	lgl__glCaptureValue(&xoffset, sizeof(xoffset));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&format, sizeof(format));
+	lgl__glCaptureValue(&imageSize, sizeof(imageSize));
+	lgl__glCaptureUnpack(data, (size_t)(imageSize));
+}
+
+static void lgl__glCapture_glGetCompressedTexImage(GLenum target, GLint level, void *img)
+{
+	(void)target;
+	(void)level;
+	(void)img;
+	lgl__glCaptureLossy(73);
+}
+
+static void lgl__glCapture_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)
+{
+	lgl__glCaptureBegin(74);
+	lgl__glCaptureValue(&sfactorRGB, sizeof(sfactorRGB));
+	lgl__glCaptureValue(&dfactorRGB, sizeof(dfactorRGB));
+	lgl__glCaptureValue(&sfactorAlpha, sizeof(sfactorAlpha));
+	lgl__glCaptureValue(&dfactorAlpha, sizeof(dfactorAlpha));
+}
+
+static void lgl__glCapture_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount)
+{
+	lgl__glCaptureBegin(75);
+	lgl__glCaptureValue(&mode, sizeof(mode));
+	lgl__glCaptureData(first, first ? (size_t)(drawcount * sizeof(*first)) : 0);
+	lgl__glCaptureData(count, count ? (size_t)(drawcount * sizeof(*count)) : 0);
+	lgl__glCaptureValue(&drawcount, sizeof(drawcount));
+}
+
+static void lgl__glCapture_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount)
+{
+	lgl__glCaptureBegin(76);
+	lgl__glCaptureValue(&mode, sizeof(mode));
+	lgl__glCaptureData(count, count ? (size_t)(drawcount * sizeof(*count)) : 0);
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureData(indices, indices ? (size_t)(drawcount * sizeof(void *)) : 0);
+	lgl__glCaptureValue(&drawcount, sizeof(drawcount));
+}
+
+static void lgl__glCapture_glPointParameterf(GLenum pname, GLfloat param)
+{
+	lgl__glCaptureBegin(77);
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	lgl__glCaptureValue(&param, sizeof(param));
+}
+
+static void lgl__glCapture_glPointParameterfv(GLenum pname, const GLfloat *params)
+{
+	lgl__glCaptureBegin(78);
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	lgl__glCaptureData(params, params ? (size_t)(lgl__glCaptureParamCount(pname) * sizeof(*params)) : 0);
+}
+
+static void lgl__glCapture_glPointParameteri(GLenum pname, GLint param)
+{
+	lgl__glCaptureBegin(79);
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	lgl__glCaptureValue(&param, sizeof(param));
+}
+
+static void lgl__glCapture_glPointParameteriv(GLenum pname, const GLint *params)
+{
+	lgl__glCaptureBegin(80);
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	lgl__glCaptureData(params, params ? (size_t)(lgl__glCaptureParamCount(pname) * sizeof(*params)) : 0);
+}
+
+static void lgl__glCapture_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+	lgl__glCaptureBegin(81);
+	lgl__glCaptureValue(&red, sizeof(red));
+	lgl__glCaptureValue(&green, sizeof(green));
+	lgl__glCaptureValue(&blue, sizeof(blue));
+	lgl__glCaptureValue(&alpha, sizeof(alpha));
+}
+
+static void lgl__glCapture_glBlendEquation(GLenum mode)
+{
+	lgl__glCaptureBegin(82);
+	lgl__glCaptureValue(&mode, sizeof(mode));
+}
+
+static void lgl__glCapture_glGenQueries(GLsizei n, GLuint *ids)
+{
+	lgl__glCaptureBegin(83);
+	lgl__glCaptureValue(&n, sizeof(n));
+	lgl__glCaptureRecord(ids, (size_t)(n * sizeof(GLuint)));
+}
+
+static void lgl__glCapture_glDeleteQueries(GLsizei n, const GLuint *ids)
+{
+	lgl__glCaptureBegin(84);
+	lgl__glCaptureValue(&n, sizeof(n));
+	lgl__glCaptureData(ids, ids ? (size_t)(n * sizeof(*ids)) : 0);
+}
+
+static void lgl__glCapture_glIsQuery(GLuint id, GLboolean lgl__result)
+{
+	lgl__glCaptureBegin(85);
+	lgl__glCaptureValue(&id, sizeof(id));
+	lgl__glCaptureValue(&lgl__result, sizeof(lgl__result));
+}
+
+static void lgl__glCapture_glBeginQuery(GLenum target, GLuint id)
+{
+	lgl__glCaptureBegin(86);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&id, sizeof(id));
+}
+
+static void lgl__glCapture_glEndQuery(GLenum target)
+{
+	lgl__glCaptureBegin(87);
+	lgl__glCaptureValue(&target, sizeof(target));
+}
+
+static void lgl__glCapture_glGetQueryiv(GLenum target, GLenum pname, GLint *params)
+{
+	lgl__glCaptureBegin(88);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params)
+{
+	lgl__glCaptureBegin(89);
+	lgl__glCaptureValue(&id, sizeof(id));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params)
+{
+	lgl__glCaptureBegin(90);
+	lgl__glCaptureValue(&id, sizeof(id));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glBindBuffer(GLenum target, GLuint buffer)
+{
+	lgl__glCaptureBegin(91);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&buffer, sizeof(buffer));
+}
+
+static void lgl__glCapture_glDeleteBuffers(GLsizei n, const GLuint *buffers)
+{
+	lgl__glCaptureBegin(92);
+	lgl__glCaptureValue(&n, sizeof(n));
+	lgl__glCaptureData(buffers, buffers ? (size_t)(n * sizeof(*buffers)) : 0);
+}
+
+static void lgl__glCapture_glGenBuffers(GLsizei n, GLuint *buffers)
+{
+	lgl__glCaptureBegin(93);
+	lgl__glCaptureValue(&n, sizeof(n));
+	lgl__glCaptureRecord(buffers, (size_t)(n * sizeof(GLuint)));
+}
+
+static void lgl__glCapture_glIsBuffer(GLuint buffer, GLboolean lgl__result)
+{
+	lgl__glCaptureBegin(94);
+	lgl__glCaptureValue(&buffer, sizeof(buffer));
+	lgl__glCaptureValue(&lgl__result, sizeof(lgl__result));
+}
+
+static void lgl__glCapture_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage)
+{
+	lgl__glCaptureBegin(95);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&size, sizeof(size));
+	lgl__glCaptureData(data, data ? (size_t)(size) : 0);
+	lgl__glCaptureValue(&usage, sizeof(usage));
+}
+
+static void lgl__glCapture_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data)
+{
+	lgl__glCaptureBegin(96);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&offset, sizeof(offset));
+	lgl__glCaptureValue(&size, sizeof(size));
+	lgl__glCaptureData(data, data ? (size_t)(size) : 0);
+}
+
+static void lgl__glCapture_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data)
+{
+	lgl__glCaptureBegin(97);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&offset, sizeof(offset));
+	lgl__glCaptureValue(&size, sizeof(size));
+	(void)data;
+	lgl__glCaptureOutput((size_t)(size));
+}
+
+static void lgl__glCapture_glMapBuffer(GLenum target, GLenum access, void * lgl__result)
+{
+	lgl__glCaptureBegin(98);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&access, sizeof(access));
+	(void)lgl__result;
+}
+
+static void lgl__glCapture_glUnmapBuffer(GLenum target, GLboolean lgl__result)
+{
+	lgl__glCaptureBegin(99);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&lgl__result, sizeof(lgl__result));
+}
+
+static void lgl__glCapture_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params)
+{
+	lgl__glCaptureBegin(100);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetBufferPointerv(GLenum target, GLenum pname, void **params)
+{
+	lgl__glCaptureBegin(101);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha)
+{
+	lgl__glCaptureBegin(102);
+	lgl__glCaptureValue(&modeRGB, sizeof(modeRGB));
+	lgl__glCaptureValue(&modeAlpha, sizeof(modeAlpha));
+}
+
+static void lgl__glCapture_glDrawBuffers(GLsizei n, const GLenum *bufs)
+{
+	lgl__glCaptureBegin(103);
+	lgl__glCaptureValue(&n, sizeof(n));
+	lgl__glCaptureData(bufs, bufs ? (size_t)(n * sizeof(*bufs)) : 0);
+}
+
+static void lgl__glCapture_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass)
+{
+	lgl__glCaptureBegin(104);
+	lgl__glCaptureValue(&face, sizeof(face));
+	lgl__glCaptureValue(&sfail, sizeof(sfail));
+	lgl__glCaptureValue(&dpfail, sizeof(dpfail));
+	lgl__glCaptureValue(&dppass, sizeof(dppass));
+}
+
+static void lgl__glCapture_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask)
+{
+	lgl__glCaptureBegin(105);
+	lgl__glCaptureValue(&face, sizeof(face));
+	lgl__glCaptureValue(&func, sizeof(func));
+	lgl__glCaptureValue(&ref, sizeof(ref));
+	lgl__glCaptureValue(&mask, sizeof(mask));
+}
+
+static void lgl__glCapture_glStencilMaskSeparate(GLenum face, GLuint mask)
+{
+	lgl__glCaptureBegin(106);
+	lgl__glCaptureValue(&face, sizeof(face));
+	lgl__glCaptureValue(&mask, sizeof(mask));
+}
+
+static void lgl__glCapture_glAttachShader(GLuint program, GLuint shader)
+{
+	lgl__glCaptureBegin(107);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&shader, sizeof(shader));
+}
+
+static void lgl__glCapture_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name)
+{
+	lgl__glCaptureBegin(108);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureData(name, name ? (size_t)(lgl__glCaptureStringBytes(name, -1)) : 0);
+}
+
+static void lgl__glCapture_glCompileShader(GLuint shader)
+{
+	lgl__glCaptureBegin(109);
+	lgl__glCaptureValue(&shader, sizeof(shader));
+}
+
+static void lgl__glCapture_glCreateProgram(GLuint lgl__result)
+{
+	lgl__glCaptureBegin(110);
+	lgl__glCaptureValue(&lgl__result, sizeof(lgl__result));
+}
+
+static void lgl__glCapture_glCreateShader(GLenum type, GLuint lgl__result)
+{
+	lgl__glCaptureBegin(111);
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureValue(&lgl__result, sizeof(lgl__result));
+}
+
+static void lgl__glCapture_glDeleteProgram(GLuint program)
+{
+	lgl__glCaptureBegin(112);
+	lgl__glCaptureValue(&program, sizeof(program));
+}
+
+static void lgl__glCapture_glDeleteShader(GLuint shader)
+{
+	lgl__glCaptureBegin(113);
+	lgl__glCaptureValue(&shader, sizeof(shader));
+}
+
+static void lgl__glCapture_glDetachShader(GLuint program, GLuint shader)
+{
+	lgl__glCaptureBegin(114);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&shader, sizeof(shader));
+}
+
+static void lgl__glCapture_glDisableVertexAttribArray(GLuint index)
+{
+	lgl__glCaptureBegin(115);
+	lgl__glCaptureValue(&index, sizeof(index));
+}
+
+static void lgl__glCapture_glEnableVertexAttribArray(GLuint index)
+{
+	lgl__glCaptureBegin(116);
+	lgl__glCaptureValue(&index, sizeof(index));
+}
+
+static void lgl__glCapture_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name)
+{
+	lgl__glCaptureBegin(117);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&bufSize, sizeof(bufSize));
+	(void)length;
+	lgl__glCaptureOutput((size_t)(sizeof(*length)));
+	(void)size;
+	lgl__glCaptureOutput((size_t)(bufSize * sizeof(*size)));
+	(void)type;
+	lgl__glCaptureOutput((size_t)(bufSize * sizeof(*type)));
+	(void)name;
+	lgl__glCaptureOutput((size_t)(bufSize * sizeof(*name)));
+}
+
+static void lgl__glCapture_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name)
+{
+	lgl__glCaptureBegin(118);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&bufSize, sizeof(bufSize));
+	(void)length;
+	lgl__glCaptureOutput((size_t)(sizeof(*length)));
+	(void)size;
+	lgl__glCaptureOutput((size_t)(bufSize * sizeof(*size)));
+	(void)type;
+	lgl__glCaptureOutput((size_t)(bufSize * sizeof(*type)));
+	(void)name;
+	lgl__glCaptureOutput((size_t)(bufSize * sizeof(*name)));
+}
+
+static void lgl__glCapture_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders)
+{
+	lgl__glCaptureBegin(119);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&maxCount, sizeof(maxCount));
+	(void)count;
+	lgl__glCaptureOutput((size_t)(0));
+	(void)shaders;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetAttribLocation(GLuint program, const GLchar *name, GLint lgl__result)
+{
+	lgl__glCaptureBegin(120);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureData(name, name ? (size_t)(lgl__glCaptureStringBytes(name, -1)) : 0);
+	lgl__glCaptureValue(&lgl__result, sizeof(lgl__result));
+}
+
+static void lgl__glCapture_glGetProgramiv(GLuint program, GLenum pname, GLint *params)
+{
+	lgl__glCaptureBegin(121);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+	lgl__glCaptureBegin(122);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&bufSize, sizeof(bufSize));
+	(void)length;
+	lgl__glCaptureOutput((size_t)(sizeof(*length)));
+	(void)infoLog;
+	lgl__glCaptureOutput((size_t)(bufSize * sizeof(*infoLog)));
+}
+
+static void lgl__glCapture_glGetShaderiv(GLuint shader, GLenum pname, GLint *params)
+{
+	lgl__glCaptureBegin(123);
+	lgl__glCaptureValue(&shader, sizeof(shader));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+	lgl__glCaptureBegin(124);
+	lgl__glCaptureValue(&shader, sizeof(shader));
+	lgl__glCaptureValue(&bufSize, sizeof(bufSize));
+	(void)length;
+	lgl__glCaptureOutput((size_t)(sizeof(*length)));
+	(void)infoLog;
+	lgl__glCaptureOutput((size_t)(bufSize * sizeof(*infoLog)));
+}
+
+static void lgl__glCapture_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source)
+{
+	lgl__glCaptureBegin(125);
+	lgl__glCaptureValue(&shader, sizeof(shader));
+	lgl__glCaptureValue(&bufSize, sizeof(bufSize));
+	(void)length;
+	lgl__glCaptureOutput((size_t)(sizeof(*length)));
+	(void)source;
+	lgl__glCaptureOutput((size_t)(bufSize * sizeof(*source)));
+}
+
+static void lgl__glCapture_glGetUniformLocation(GLuint program, const GLchar *name, GLint lgl__result)
+{
+	lgl__glCaptureBegin(126);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureData(name, name ? (size_t)(lgl__glCaptureStringBytes(name, -1)) : 0);
+	lgl__glCaptureValue(&lgl__result, sizeof(lgl__result));
+}
+
+static void lgl__glCapture_glGetUniformfv(GLuint program, GLint location, GLfloat *params)
+{
+	lgl__glCaptureBegin(127);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetUniformiv(GLuint program, GLint location, GLint *params)
+{
+	lgl__glCaptureBegin(128);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params)
+{
+	lgl__glCaptureBegin(129);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params)
+{
+	lgl__glCaptureBegin(130);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params)
+{
+	lgl__glCaptureBegin(131);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer)
+{
+	lgl__glCaptureBegin(132);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)pointer;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glIsProgram(GLuint program, GLboolean lgl__result)
+{
+	lgl__glCaptureBegin(133);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&lgl__result, sizeof(lgl__result));
+}
+
+static void lgl__glCapture_glIsShader(GLuint shader, GLboolean lgl__result)
+{
+	lgl__glCaptureBegin(134);
+	lgl__glCaptureValue(&shader, sizeof(shader));
+	lgl__glCaptureValue(&lgl__result, sizeof(lgl__result));
+}
+
+static void lgl__glCapture_glLinkProgram(GLuint program)
+{
+	lgl__glCaptureBegin(135);
+	lgl__glCaptureValue(&program, sizeof(program));
+}
+
+static void lgl__glCapture_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length)
+{
+	lgl__glCaptureBegin(136);
+	lgl__glCaptureValue(&shader, sizeof(shader));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureStrings(count, string, length);
+	(void)length;
+	lgl__glCaptureData(NULL, 0);
+}
+
+static void lgl__glCapture_glUseProgram(GLuint program)
+{
+	lgl__glCaptureBegin(137);
+	lgl__glCaptureValue(&program, sizeof(program));
+}
+
+static void lgl__glCapture_glUniform1f(GLint location, GLfloat v0)
+{
+	lgl__glCaptureBegin(138);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&v0, sizeof(v0));
+}
+
+static void lgl__glCapture_glUniform2f(GLint location, GLfloat v0, GLfloat v1)
+{
+	lgl__glCaptureBegin(139);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&v0, sizeof(v0));
+	lgl__glCaptureValue(&v1, sizeof(v1));
+}
+
+static void lgl__glCapture_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+{
+	lgl__glCaptureBegin(140);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&v0, sizeof(v0));
+	lgl__glCaptureValue(&v1, sizeof(v1));
+	lgl__glCaptureValue(&v2, sizeof(v2));
+}
+
+static void lgl__glCapture_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+{
+	lgl__glCaptureBegin(141);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&v0, sizeof(v0));
+	lgl__glCaptureValue(&v1, sizeof(v1));
+	lgl__glCaptureValue(&v2, sizeof(v2));
+	lgl__glCaptureValue(&v3, sizeof(v3));
+}
+
+static void lgl__glCapture_glUniform1i(GLint location, GLint v0)
+{
+	lgl__glCaptureBegin(142);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&v0, sizeof(v0));
+}
+
+static void lgl__glCapture_glUniform2i(GLint location, GLint v0, GLint v1)
+{
+	lgl__glCaptureBegin(143);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&v0, sizeof(v0));
+	lgl__glCaptureValue(&v1, sizeof(v1));
+}
+
+static void lgl__glCapture_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2)
+{
+	lgl__glCaptureBegin(144);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&v0, sizeof(v0));
+	lgl__glCaptureValue(&v1, sizeof(v1));
+	lgl__glCaptureValue(&v2, sizeof(v2));
+}
+
+static void lgl__glCapture_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+{
+	lgl__glCaptureBegin(145);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&v0, sizeof(v0));
+	lgl__glCaptureValue(&v1, sizeof(v1));
+	lgl__glCaptureValue(&v2, sizeof(v2));
+	lgl__glCaptureValue(&v3, sizeof(v3));
+}
+
+static void lgl__glCapture_glUniform1fv(GLint location, GLsizei count, const GLfloat *value)
+{
+	lgl__glCaptureBegin(146);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureData(value, value ? (size_t)(count * 1 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glUniform2fv(GLint location, GLsizei count, const GLfloat *value)
+{
+	lgl__glCaptureBegin(147);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureData(value, value ? (size_t)(count * 2 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glUniform3fv(GLint location, GLsizei count, const GLfloat *value)
+{
+	lgl__glCaptureBegin(148);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureData(value, value ? (size_t)(count * 3 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glUniform4fv(GLint location, GLsizei count, const GLfloat *value)
+{
+	lgl__glCaptureBegin(149);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureData(value, value ? (size_t)(count * 4 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glUniform1iv(GLint location, GLsizei count, const GLint *value)
+{
+	lgl__glCaptureBegin(150);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureData(value, value ? (size_t)(count * 1 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glUniform2iv(GLint location, GLsizei count, const GLint *value)
+{
+	lgl__glCaptureBegin(151);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureData(value, value ? (size_t)(count * 2 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glUniform3iv(GLint location, GLsizei count, const GLint *value)
+{
+	lgl__glCaptureBegin(152);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureData(value, value ? (size_t)(count * 3 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glUniform4iv(GLint location, GLsizei count, const GLint *value)
+{
+	lgl__glCaptureBegin(153);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureData(value, value ? (size_t)(count * 4 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	lgl__glCaptureBegin(154);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureValue(&transpose, sizeof(transpose));
+	lgl__glCaptureData(value, value ? (size_t)(count * 2 * 2 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	lgl__glCaptureBegin(155);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureValue(&transpose, sizeof(transpose));
+	lgl__glCaptureData(value, value ? (size_t)(count * 3 * 3 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	lgl__glCaptureBegin(156);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureValue(&transpose, sizeof(transpose));
+	lgl__glCaptureData(value, value ? (size_t)(count * 4 * 4 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glValidateProgram(GLuint program)
+{
+	lgl__glCaptureBegin(157);
+	lgl__glCaptureValue(&program, sizeof(program));
+}
+
+static void lgl__glCapture_glVertexAttrib1d(GLuint index, GLdouble x)
+{
+	lgl__glCaptureBegin(158);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&x, sizeof(x));
+}
+
+static void lgl__glCapture_glVertexAttrib1dv(GLuint index, const GLdouble *v)
+{
+	lgl__glCaptureBegin(159);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureData(v, v ? (size_t)(1 * sizeof(*v)) : 0);
+}
+
+static void lgl__glCapture_glVertexAttrib1f(GLuint index, GLfloat x)
+{
+	lgl__glCaptureBegin(160);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&x, sizeof(x));
+}
+
+static void lgl__glCapture_glVertexAttrib1fv(GLuint index, const GLfloat *v)
+{
+	lgl__glCaptureBegin(161);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureData(v, v ? (size_t)(1 * sizeof(*v)) : 0);
+}
+
+static void lgl__glCapture_glVertexAttrib1s(GLuint index, GLshort x)
+{
+	lgl__glCaptureBegin(162);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&x, sizeof(x));
+}
+
+static void lgl__glCapture_glVertexAttrib1sv(GLuint index, const GLshort *v)
+{
+	lgl__glCaptureBegin(163);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureData(v, v ? (size_t)(1 * sizeof(*v)) : 0);
+}
+
+static void lgl__glCapture_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y)
+{
+	lgl__glCaptureBegin(164);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&x, sizeof(x));
+	lgl__glCaptureValue(&y, sizeof(y));
+}
+
+static void lgl__glCapture_glVertexAttrib2dv(GLuint index, const GLdouble *v)
+{
+	lgl__glCaptureBegin(165);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureData(v, v ? (size_t)(2 * sizeof(*v)) : 0);
+}
+
+static void lgl__glCapture_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y)
+{
+	lgl__glCaptureBegin(166);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&x, sizeof(x));
+	lgl__glCaptureValue(&y, sizeof(y));
+}
+
+static void lgl__glCapture_glVertexAttrib2fv(GLuint index, const GLfloat *v)
+{
+	lgl__glCaptureBegin(167);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureData(v, v ? (size_t)(2 * sizeof(*v)) : 0);
+}
+
+static void lgl__glCapture_glVertexAttrib2s(GLuint index, GLshort x, GLshort y)
+{
+	lgl__glCaptureBegin(168);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&x, sizeof(x));
+	lgl__glCaptureValue(&y, sizeof(y));
+}
+
+static void lgl__glCapture_glVertexAttrib2sv(GLuint index, const GLshort *v)
+{
+	lgl__glCaptureBegin(169);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureData(v, v ? (size_t)(2 * sizeof(*v)) : 0);
+}
+
+static void lgl__glCapture_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z)
+{
+	lgl__glCaptureBegin(170);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&x, sizeof(x));
+	lgl__glCaptureValue(&y, sizeof(y));
+	lgl__glCaptureValue(&z, sizeof(z));
+}
+
+static void lgl__glCapture_glVertexAttrib3dv(GLuint index, const GLdouble *v)
+{
+	lgl__glCaptureBegin(171);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureData(v, v ? (size_t)(3 * sizeof(*v)) : 0);
+}
+
+static void lgl__glCapture_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z)
+{
+	lgl__glCaptureBegin(172);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&x, sizeof(x));
+	lgl__glCaptureValue(&y, sizeof(y));
+	lgl__glCaptureValue(&z, sizeof(z));
+}
+
+static void lgl__glCapture_glVertexAttrib3fv(GLuint index, const GLfloat *v)
+{
+	lgl__glCaptureBegin(173);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureData(v, v ? (size_t)(3 * sizeof(*v)) : 0);
+}
+
+static void lgl__glCapture_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z)
+{
+	lgl__glCaptureBegin(174);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&x, sizeof(x));
+	lgl__glCaptureValue(&y, sizeof(y));
+	lgl__glCaptureValue(&z, sizeof(z));
+}
+
+static void lgl__glCapture_glVertexAttrib3sv(GLuint index, const GLshort *v)
+{
+	lgl__glCaptureBegin(175);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureData(v, v ? (size_t)(3 * sizeof(*v)) : 0);
+}
+
+static void lgl__glCapture_glVertexAttrib4Nbv(GLuint index, const GLbyte *v)
+{
+	lgl__glCaptureBegin(176);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureData(v, v ? (size_t)(4 * sizeof(*v)) : 0);
+}
+
+static void lgl__glCapture_glVertexAttrib4Niv(GLuint index, const GLint *v)
+{
+	lgl__glCaptureBegin(177);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureData(v, v ? (size_t)(4 * sizeof(*v)) : 0);
+}
+
+static void lgl__glCapture_glVertexAttrib4Nsv(GLuint index, const GLshort *v)
+{
+	lgl__glCaptureBegin(178);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureData(v, v ? (size_t)(4 * sizeof(*v)) : 0);
+}
+
+static void lgl__glCapture_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w)
+{
+	lgl__glCaptureBegin(179);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&x, sizeof(x));
+	lgl__glCaptureValue(&y, sizeof(y));
+	lgl__glCaptureValue(&z, sizeof(z));
+	lgl__glCaptureValue(&w, sizeof(w));
+}
+
+static void lgl__glCapture_glVertexAttrib4Nubv(GLuint index, const GLubyte *v)
+{
+	lgl__glCaptureBegin(180);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureData(v, v ? (size_t)(4 * sizeof(*v)) : 0);
+}
+
+static void lgl__glCapture_glVertexAttrib4Nuiv(GLuint index, const GLuint *v)
+{
+	lgl__glCaptureBegin(181);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureData(v, v ? (size_t)(4 * sizeof(*v)) : 0);
+}
+
+static void lgl__glCapture_glVertexAttrib4Nusv(GLuint index, const GLushort *v)
+{
+	lgl__glCaptureBegin(182);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureData(v, v ? (size_t)(4 * sizeof(*v)) : 0);
+}
+
+static void lgl__glCapture_glVertexAttrib4bv(GLuint index, const GLbyte *v)
+{
+	lgl__glCaptureBegin(183);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureData(v, v ? (size_t)(4 * sizeof(*v)) : 0);
+}
+
+static void lgl__glCapture_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+	lgl__glCaptureBegin(184);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&x, sizeof(x));
+	lgl__glCaptureValue(&y, sizeof(y));
+	lgl__glCaptureValue(&z, sizeof(z));
+	lgl__glCaptureValue(&w, sizeof(w));
+}
+
+static void lgl__glCapture_glVertexAttrib4dv(GLuint index, const GLdouble *v)
+{
+	lgl__glCaptureBegin(185);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureData(v, v ? (size_t)(4 * sizeof(*v)) : 0);
+}
+
+static void lgl__glCapture_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+	lgl__glCaptureBegin(186);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&x, sizeof(x));
+	lgl__glCaptureValue(&y, sizeof(y));
+	lgl__glCaptureValue(&z, sizeof(z));
+	lgl__glCaptureValue(&w, sizeof(w));
+}
+
+static void lgl__glCapture_glVertexAttrib4fv(GLuint index, const GLfloat *v)
+{
+	lgl__glCaptureBegin(187);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureData(v, v ? (size_t)(4 * sizeof(*v)) : 0);
+}
+
+static void lgl__glCapture_glVertexAttrib4iv(GLuint index, const GLint *v)
+{
+	lgl__glCaptureBegin(188);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureData(v, v ? (size_t)(4 * sizeof(*v)) : 0);
+}
+
+static void lgl__glCapture_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)
+{
+	lgl__glCaptureBegin(189);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&x, sizeof(x));
+	lgl__glCaptureValue(&y, sizeof(y));
+	lgl__glCaptureValue(&z, sizeof(z));
+	lgl__glCaptureValue(&w, sizeof(w));
+}
+
+static void lgl__glCapture_glVertexAttrib4sv(GLuint index, const GLshort *v)
+{
+	lgl__glCaptureBegin(190);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureData(v, v ? (size_t)(4 * sizeof(*v)) : 0);
+}
+
+static void lgl__glCapture_glVertexAttrib4ubv(GLuint index, const GLubyte *v)
+{
+	lgl__glCaptureBegin(191);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureData(v, v ? (size_t)(4 * sizeof(*v)) : 0);
+}
+
+static void lgl__glCapture_glVertexAttrib4uiv(GLuint index, const GLuint *v)
+{
+	lgl__glCaptureBegin(192);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureData(v, v ? (size_t)(4 * sizeof(*v)) : 0);
+}
+
+static void lgl__glCapture_glVertexAttrib4usv(GLuint index, const GLushort *v)
+{
+	lgl__glCaptureBegin(193);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureData(v, v ? (size_t)(4 * sizeof(*v)) : 0);
+}
+
+static void lgl__glCapture_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer)
+{
+	lgl__glCaptureBegin(194);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&size, sizeof(size));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureValue(&normalized, sizeof(normalized));
+	lgl__glCaptureValue(&stride, sizeof(stride));
+	lgl__glCaptureOffset(pointer);
+}
+
+static void lgl__glCapture_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	lgl__glCaptureBegin(195);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureValue(&transpose, sizeof(transpose));
+	lgl__glCaptureData(value, value ? (size_t)(count * 2 * 3 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	lgl__glCaptureBegin(196);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureValue(&transpose, sizeof(transpose));
+	lgl__glCaptureData(value, value ? (size_t)(count * 3 * 2 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	lgl__glCaptureBegin(197);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureValue(&transpose, sizeof(transpose));
+	lgl__glCaptureData(value, value ? (size_t)(count * 2 * 4 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	lgl__glCaptureBegin(198);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureValue(&transpose, sizeof(transpose));
+	lgl__glCaptureData(value, value ? (size_t)(count * 4 * 2 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	lgl__glCaptureBegin(199);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureValue(&transpose, sizeof(transpose));
+	lgl__glCaptureData(value, value ? (size_t)(count * 3 * 4 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	lgl__glCaptureBegin(200);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureValue(&transpose, sizeof(transpose));
+	lgl__glCaptureData(value, value ? (size_t)(count * 4 * 3 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a)
+{
+	lgl__glCaptureBegin(201);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&r, sizeof(r));
+	lgl__glCaptureValue(&g, sizeof(g));
+	lgl__glCaptureValue(&b, sizeof(b));
+	lgl__glCaptureValue(&a, sizeof(a));
+}
+
+static void lgl__glCapture_glGetBooleani_v(GLenum target, GLuint index, GLboolean *data)
+{
+	lgl__glCaptureBegin(202);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&index, sizeof(index));
+	(void)data;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetIntegeri_v(GLenum target, GLuint index, GLint *data)
+{
+	lgl__glCaptureBegin(203);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&index, sizeof(index));
+	(void)data;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glEnablei(GLenum target, GLuint index)
+{
+	lgl__glCaptureBegin(204);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&index, sizeof(index));
+}
+
+static void lgl__glCapture_glDisablei(GLenum target, GLuint index)
+{
+	lgl__glCaptureBegin(205);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&index, sizeof(index));
+}
+
+static void lgl__glCapture_glIsEnabledi(GLenum target, GLuint index, GLboolean lgl__result)
+{
+	lgl__glCaptureBegin(206);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&lgl__result, sizeof(lgl__result));
+}
+
+static void lgl__glCapture_glBeginTransformFeedback(GLenum primitiveMode)
+{
+	lgl__glCaptureBegin(207);
+	lgl__glCaptureValue(&primitiveMode, sizeof(primitiveMode));
+}
+
+static void lgl__glCapture_glEndTransformFeedback(void)
+{
+	lgl__glCaptureBegin(208);
+}
+
+static void lgl__glCapture_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+	lgl__glCaptureBegin(209);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&buffer, sizeof(buffer));
+	lgl__glCaptureValue(&offset, sizeof(offset));
+	lgl__glCaptureValue(&size, sizeof(size));
+}
+
+static void lgl__glCapture_glBindBufferBase(GLenum target, GLuint index, GLuint buffer)
+{
+	lgl__glCaptureBegin(210);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&buffer, sizeof(buffer));
+}
+
+static void lgl__glCapture_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode)
+{
+	lgl__glCaptureBegin(211);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureStrings(count, varyings, NULL);
+	lgl__glCaptureValue(&bufferMode, sizeof(bufferMode));
+}
+
+static void lgl__glCapture_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name)
+{
+	lgl__glCaptureBegin(212);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&bufSize, sizeof(bufSize));
+	(void)length;
+	lgl__glCaptureOutput((size_t)(sizeof(*length)));
+	(void)size;
+	lgl__glCaptureOutput((size_t)(bufSize * sizeof(*size)));
+	(void)type;
+	lgl__glCaptureOutput((size_t)(bufSize * sizeof(*type)));
+	(void)name;
+	lgl__glCaptureOutput((size_t)(bufSize * sizeof(*name)));
+}
+
+static void lgl__glCapture_glClampColor(GLenum target, GLenum clamp)
+{
+	lgl__glCaptureBegin(213);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&clamp, sizeof(clamp));
+}
+
+static void lgl__glCapture_glBeginConditionalRender(GLuint id, GLenum mode)
+{
+	lgl__glCaptureBegin(214);
+	lgl__glCaptureValue(&id, sizeof(id));
+	lgl__glCaptureValue(&mode, sizeof(mode));
+}
+
+static void lgl__glCapture_glEndConditionalRender(void)
+{
+	lgl__glCaptureBegin(215);
+}
+
+static void lgl__glCapture_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer)
+{
+	lgl__glCaptureBegin(216);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&size, sizeof(size));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureValue(&stride, sizeof(stride));
+	lgl__glCaptureOffset(pointer);
+}
+
+static void lgl__glCapture_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params)
+{
+	lgl__glCaptureBegin(217);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params)
+{
+	lgl__glCaptureBegin(218);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glVertexAttribI1i(GLuint index, GLint x)
+{
+	lgl__glCaptureBegin(219);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&x, sizeof(x));
+}
+
+static void lgl__glCapture_glVertexAttribI2i(GLuint index, GLint x, GLint y)
+{
+	lgl__glCaptureBegin(220);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&x, sizeof(x));
+	lgl__glCaptureValue(&y, sizeof(y));
+}
+
+static void lgl__glCapture_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z)
+{
+	lgl__glCaptureBegin(221);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&x, sizeof(x));
+	lgl__glCaptureValue(&y, sizeof(y));
+	lgl__glCaptureValue(&z, sizeof(z));
+}
+
+static void lgl__glCapture_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w)
+{
+	lgl__glCaptureBegin(222);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&x, sizeof(x));
+	lgl__glCaptureValue(&y, sizeof(y));
+	lgl__glCaptureValue(&z, sizeof(z));
+	lgl__glCaptureValue(&w, sizeof(w));
+}
+
+static void lgl__glCapture_glVertexAttribI1ui(GLuint index, GLuint x)
+{
+	lgl__glCaptureBegin(223);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&x, sizeof(x));
+}
+
+static void lgl__glCapture_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y)
+{
+	lgl__glCaptureBegin(224);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&x, sizeof(x));
+	lgl__glCaptureValue(&y, sizeof(y));
+}
+
+static void lgl__glCapture_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z)
+{
+	lgl__glCaptureBegin(225);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&x, sizeof(x));
+	lgl__glCaptureValue(&y, sizeof(y));
+	lgl__glCaptureValue(&z, sizeof(z));
+}
+
+static void lgl__glCapture_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w)
+{
+	lgl__glCaptureBegin(226);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&x, sizeof(x));
+	lgl__glCaptureValue(&y, sizeof(y));
+	lgl__glCaptureValue(&z, sizeof(z));
+	lgl__glCaptureValue(&w, sizeof(w));
+}
+
+static void lgl__glCapture_glVertexAttribI1iv(GLuint index, const GLint *v)
+{
+	lgl__glCaptureBegin(227);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureData(v, v ? (size_t)(1 * sizeof(*v)) : 0);
+}
+
+static void lgl__glCapture_glVertexAttribI2iv(GLuint index, const GLint *v)
+{
+	lgl__glCaptureBegin(228);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureData(v, v ? (size_t)(2 * sizeof(*v)) : 0);
+}
+
+static void lgl__glCapture_glVertexAttribI3iv(GLuint index, const GLint *v)
+{
+	lgl__glCaptureBegin(229);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureData(v, v ? (size_t)(3 * sizeof(*v)) : 0);
+}
+
+static void lgl__glCapture_glVertexAttribI4iv(GLuint index, const GLint *v)
+{
+	lgl__glCaptureBegin(230);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureData(v, v ? (size_t)(4 * sizeof(*v)) : 0);
+}
+
+static void lgl__glCapture_glVertexAttribI1uiv(GLuint index, const GLuint *v)
+{
+	lgl__glCaptureBegin(231);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureData(v, v ? (size_t)(1 * sizeof(*v)) : 0);
+}
+
+static void lgl__glCapture_glVertexAttribI2uiv(GLuint index, const GLuint *v)
+{
+	lgl__glCaptureBegin(232);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureData(v, v ? (size_t)(2 * sizeof(*v)) : 0);
+}
+
+static void lgl__glCapture_glVertexAttribI3uiv(GLuint index, const GLuint *v)
+{
+	lgl__glCaptureBegin(233);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureData(v, v ? (size_t)(3 * sizeof(*v)) : 0);
+}
+
+static void lgl__glCapture_glVertexAttribI4uiv(GLuint index, const GLuint *v)
+{
+	lgl__glCaptureBegin(234);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureData(v, v ? (size_t)(4 * sizeof(*v)) : 0);
+}
+
+static void lgl__glCapture_glVertexAttribI4bv(GLuint index, const GLbyte *v)
+{
+	lgl__glCaptureBegin(235);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureData(v, v ? (size_t)(4 * sizeof(*v)) : 0);
+}
+
+static void lgl__glCapture_glVertexAttribI4sv(GLuint index, const GLshort *v)
+{
+	lgl__glCaptureBegin(236);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureData(v, v ? (size_t)(4 * sizeof(*v)) : 0);
+}
+
+static void lgl__glCapture_glVertexAttribI4ubv(GLuint index, const GLubyte *v)
+{
+	lgl__glCaptureBegin(237);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureData(v, v ? (size_t)(4 * sizeof(*v)) : 0);
+}
+
+static void lgl__glCapture_glVertexAttribI4usv(GLuint index, const GLushort *v)
+{
+	lgl__glCaptureBegin(238);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureData(v, v ? (size_t)(4 * sizeof(*v)) : 0);
+}
+
+static void lgl__glCapture_glGetUniformuiv(GLuint program, GLint location, GLuint *params)
+{
+	lgl__glCaptureBegin(239);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name)
+{
+	lgl__glCaptureBegin(240);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&color, sizeof(color));
+	lgl__glCaptureData(name, name ? (size_t)(lgl__glCaptureStringBytes(name, -1)) : 0);
+}
+
+static void lgl__glCapture_glGetFragDataLocation(GLuint program, const GLchar *name, GLint lgl__result)
+{
+	lgl__glCaptureBegin(241);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureData(name, name ? (size_t)(lgl__glCaptureStringBytes(name, -1)) : 0);
+	lgl__glCaptureValue(&lgl__result, sizeof(lgl__result));
+}
+
+static void lgl__glCapture_glUniform1ui(GLint location, GLuint v0)
+{
+	lgl__glCaptureBegin(242);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&v0, sizeof(v0));
+}
+
+static void lgl__glCapture_glUniform2ui(GLint location, GLuint v0, GLuint v1)
+{
+	lgl__glCaptureBegin(243);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&v0, sizeof(v0));
+	lgl__glCaptureValue(&v1, sizeof(v1));
+}
+
+static void lgl__glCapture_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2)
+{
+	lgl__glCaptureBegin(244);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&v0, sizeof(v0));
+	lgl__glCaptureValue(&v1, sizeof(v1));
+	lgl__glCaptureValue(&v2, sizeof(v2));
+}
+
+static void lgl__glCapture_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
+{
+	lgl__glCaptureBegin(245);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&v0, sizeof(v0));
+	lgl__glCaptureValue(&v1, sizeof(v1));
+	lgl__glCaptureValue(&v2, sizeof(v2));
+	lgl__glCaptureValue(&v3, sizeof(v3));
+}
+
+static void lgl__glCapture_glUniform1uiv(GLint location, GLsizei count, const GLuint *value)
+{
+	lgl__glCaptureBegin(246);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureData(value, value ? (size_t)(count * 1 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glUniform2uiv(GLint location, GLsizei count, const GLuint *value)
+{
+	lgl__glCaptureBegin(247);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureData(value, value ? (size_t)(count * 2 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glUniform3uiv(GLint location, GLsizei count, const GLuint *value)
+{
+	lgl__glCaptureBegin(248);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureData(value, value ? (size_t)(count * 3 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glUniform4uiv(GLint location, GLsizei count, const GLuint *value)
+{
+	lgl__glCaptureBegin(249);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureData(value, value ? (size_t)(count * 4 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params)
+{
+	lgl__glCaptureBegin(250);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	lgl__glCaptureData(params, params ? (size_t)(lgl__glCaptureParamCount(pname) * sizeof(*params)) : 0);
+}
+
+static void lgl__glCapture_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params)
+{
+	lgl__glCaptureBegin(251);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	lgl__glCaptureData(params, params ? (size_t)(lgl__glCaptureParamCount(pname) * sizeof(*params)) : 0);
+}
+
+static void lgl__glCapture_glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params)
+{
+	lgl__glCaptureBegin(252);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params)
+{
+	lgl__glCaptureBegin(253);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value)
+{
+	lgl__glCaptureBegin(254);
+	lgl__glCaptureValue(&buffer, sizeof(buffer));
+	lgl__glCaptureValue(&drawbuffer, sizeof(drawbuffer));
+	lgl__glCaptureData(value, value ? (size_t)((buffer == GL_COLOR ? 4 : 1) * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value)
+{
+	lgl__glCaptureBegin(255);
+	lgl__glCaptureValue(&buffer, sizeof(buffer));
+	lgl__glCaptureValue(&drawbuffer, sizeof(drawbuffer));
+	lgl__glCaptureData(value, value ? (size_t)((buffer == GL_COLOR ? 4 : 1) * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value)
+{
+	lgl__glCaptureBegin(256);
+	lgl__glCaptureValue(&buffer, sizeof(buffer));
+	lgl__glCaptureValue(&drawbuffer, sizeof(drawbuffer));
+	lgl__glCaptureData(value, value ? (size_t)((buffer == GL_COLOR ? 4 : 1) * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil)
+{
+	lgl__glCaptureBegin(257);
+	lgl__glCaptureValue(&buffer, sizeof(buffer));
+	lgl__glCaptureValue(&drawbuffer, sizeof(drawbuffer));
+	lgl__glCaptureValue(&depth, sizeof(depth));
+	lgl__glCaptureValue(&stencil, sizeof(stencil));
+}
+
+static void lgl__glCapture_glGetStringi(GLenum name, GLuint index, const GLubyte * lgl__result)
+{
+	lgl__glCaptureBegin(258);
+	lgl__glCaptureValue(&name, sizeof(name));
+	lgl__glCaptureValue(&index, sizeof(index));
+	(void)lgl__result;
+}
+
+static void lgl__glCapture_glIsRenderbuffer(GLuint renderbuffer, GLboolean lgl__result)
+{
+	lgl__glCaptureBegin(259);
+	lgl__glCaptureValue(&renderbuffer, sizeof(renderbuffer));
+	lgl__glCaptureValue(&lgl__result, sizeof(lgl__result));
+}
+
+static void lgl__glCapture_glBindRenderbuffer(GLenum target, GLuint renderbuffer)
+{
+	lgl__glCaptureBegin(260);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&renderbuffer, sizeof(renderbuffer));
+}
+
+static void lgl__glCapture_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers)
+{
+	lgl__glCaptureBegin(261);
+	lgl__glCaptureValue(&n, sizeof(n));
+	lgl__glCaptureData(renderbuffers, renderbuffers ? (size_t)(n * sizeof(*renderbuffers)) : 0);
+}
+
+static void lgl__glCapture_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers)
+{
+	lgl__glCaptureBegin(262);
+	lgl__glCaptureValue(&n, sizeof(n));
+	lgl__glCaptureRecord(renderbuffers, (size_t)(n * sizeof(GLuint)));
+}
+
+static void lgl__glCapture_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height)
+{
+	lgl__glCaptureBegin(263);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&internalformat, sizeof(internalformat));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&height, sizeof(height));
+}
+
+static void lgl__glCapture_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params)
+{
+	lgl__glCaptureBegin(264);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glIsFramebuffer(GLuint framebuffer, GLboolean lgl__result)
+{
+	lgl__glCaptureBegin(265);
+	lgl__glCaptureValue(&framebuffer, sizeof(framebuffer));
+	lgl__glCaptureValue(&lgl__result, sizeof(lgl__result));
+}
+
+static void lgl__glCapture_glBindFramebuffer(GLenum target, GLuint framebuffer)
+{
+	lgl__glCaptureBegin(266);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&framebuffer, sizeof(framebuffer));
+}
+
+static void lgl__glCapture_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers)
+{
+	lgl__glCaptureBegin(267);
+	lgl__glCaptureValue(&n, sizeof(n));
+	lgl__glCaptureData(framebuffers, framebuffers ? (size_t)(n * sizeof(*framebuffers)) : 0);
+}
+
+static void lgl__glCapture_glGenFramebuffers(GLsizei n, GLuint *framebuffers)
+{
+	lgl__glCaptureBegin(268);
+	lgl__glCaptureValue(&n, sizeof(n));
+	lgl__glCaptureRecord(framebuffers, (size_t)(n * sizeof(GLuint)));
+}
+
+static void lgl__glCapture_glCheckFramebufferStatus(GLenum target, GLenum lgl__result)
+{
+	lgl__glCaptureBegin(269);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&lgl__result, sizeof(lgl__result));
+}
+
+static void lgl__glCapture_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+	lgl__glCaptureBegin(270);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&attachment, sizeof(attachment));
+	lgl__glCaptureValue(&textarget, sizeof(textarget));
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&level, sizeof(level));
+}
+
+static void lgl__glCapture_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+	lgl__glCaptureBegin(271);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&attachment, sizeof(attachment));
+	lgl__glCaptureValue(&textarget, sizeof(textarget));
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&level, sizeof(level));
+}
+
+static void lgl__glCapture_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset)
+{
+	lgl__glCaptureBegin(272);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&attachment, sizeof(attachment));
+	lgl__glCaptureValue(&textarget, sizeof(textarget));
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&level, sizeof(level));
+	lgl__glCaptureValue(&zoffset, sizeof(zoffset));
+}
+
+static void lgl__glCapture_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
+{
+	lgl__glCaptureBegin(273);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&attachment, sizeof(attachment));
+	lgl__glCaptureValue(&renderbuffertarget, sizeof(renderbuffertarget));
+	lgl__glCaptureValue(&renderbuffer, sizeof(renderbuffer));
+}
+
+static void lgl__glCapture_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params)
+{
+	lgl__glCaptureBegin(274);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&attachment, sizeof(attachment));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGenerateMipmap(GLenum target)
+{
+	lgl__glCaptureBegin(275);
+	lgl__glCaptureValue(&target, sizeof(target));
+}
+
+static void lgl__glCapture_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)
+{
+	lgl__glCaptureBegin(276);
+	lgl__glCaptureValue(&srcX0, sizeof(srcX0));
+	lgl__glCaptureValue(&srcY0, sizeof(srcY0));
+	lgl__glCaptureValue(&srcX1, sizeof(srcX1));
+	lgl__glCaptureValue(&srcY1, sizeof(srcY1));
+	lgl__glCaptureValue(&dstX0, sizeof(dstX0));
+	lgl__glCaptureValue(&dstY0, sizeof(dstY0));
+	lgl__glCaptureValue(&dstX1, sizeof(dstX1));
+	lgl__glCaptureValue(&dstY1, sizeof(dstY1));
+	lgl__glCaptureValue(&mask, sizeof(mask));
+	lgl__glCaptureValue(&filter, sizeof(filter));
+}
+
+static void lgl__glCapture_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)
+{
+	lgl__glCaptureBegin(277);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&samples, sizeof(samples));
+	lgl__glCaptureValue(&internalformat, sizeof(internalformat));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&height, sizeof(height));
+}
+
+static void lgl__glCapture_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer)
+{
+	lgl__glCaptureBegin(278);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&attachment, sizeof(attachment));
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&level, sizeof(level));
+	lgl__glCaptureValue(&layer, sizeof(layer));
+}
+
+static void lgl__glCapture_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access, void * lgl__result)
+{
+	lgl__glCaptureBegin(279);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&offset, sizeof(offset));
+	lgl__glCaptureValue(&length, sizeof(length));
+	lgl__glCaptureValue(&access, sizeof(access));
+	(void)lgl__result;
+}
+
+static void lgl__glCapture_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length)
+{
+	lgl__glCaptureBegin(280);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&offset, sizeof(offset));
+	lgl__glCaptureValue(&length, sizeof(length));
+}
+
+static void lgl__glCapture_glBindVertexArray(GLuint array)
+{
+	lgl__glCaptureBegin(281);
+	lgl__glCaptureValue(&array, sizeof(array));
+}
+
+static void lgl__glCapture_glDeleteVertexArrays(GLsizei n, const GLuint *arrays)
+{
+	lgl__glCaptureBegin(282);
+	lgl__glCaptureValue(&n, sizeof(n));
+	lgl__glCaptureData(arrays, arrays ? (size_t)(n * sizeof(*arrays)) : 0);
+}
+
+static void lgl__glCapture_glGenVertexArrays(GLsizei n, GLuint *arrays)
+{
+	lgl__glCaptureBegin(283);
+	lgl__glCaptureValue(&n, sizeof(n));
+	lgl__glCaptureRecord(arrays, (size_t)(n * sizeof(GLuint)));
+}
+
+static void lgl__glCapture_glIsVertexArray(GLuint array, GLboolean lgl__result)
+{
+	lgl__glCaptureBegin(284);
+	lgl__glCaptureValue(&array, sizeof(array));
+	lgl__glCaptureValue(&lgl__result, sizeof(lgl__result));
+}
+
+static void lgl__glCapture_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount)
+{
+	lgl__glCaptureBegin(285);
+	lgl__glCaptureValue(&mode, sizeof(mode));
+	lgl__glCaptureValue(&first, sizeof(first));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureValue(&instancecount, sizeof(instancecount));
+}
+
+static void lgl__glCapture_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount)
+{
+	lgl__glCaptureBegin(286);
+	lgl__glCaptureValue(&mode, sizeof(mode));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureOffset(indices);
+	lgl__glCaptureValue(&instancecount, sizeof(instancecount));
+}
+
+static void lgl__glCapture_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer)
+{
+	lgl__glCaptureBegin(287);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&internalformat, sizeof(internalformat));
+	lgl__glCaptureValue(&buffer, sizeof(buffer));
+}
+
+static void lgl__glCapture_glPrimitiveRestartIndex(GLuint index)
+{
+	lgl__glCaptureBegin(288);
+	lgl__glCaptureValue(&index, sizeof(index));
+}
+
+static void lgl__glCapture_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
+{
+	lgl__glCaptureBegin(289);
+	lgl__glCaptureValue(&readTarget, sizeof(readTarget));
+	lgl__glCaptureValue(&writeTarget, sizeof(writeTarget));
+	lgl__glCaptureValue(&readOffset, sizeof(readOffset));
+	lgl__glCaptureValue(&writeOffset, sizeof(writeOffset));
+	lgl__glCaptureValue(&size, sizeof(size));
+}
+
+static void lgl__glCapture_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices)
+{
+	lgl__glCaptureBegin(290);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&uniformCount, sizeof(uniformCount));
+	lgl__glCaptureStrings(uniformCount, uniformNames, NULL);
+	(void)uniformIndices;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params)
+{
+	lgl__glCaptureBegin(291);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&uniformCount, sizeof(uniformCount));
+	lgl__glCaptureData(uniformIndices, uniformIndices ? (size_t)(uniformCount * sizeof(*uniformIndices)) : 0);
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName)
+{
+	lgl__glCaptureBegin(292);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&uniformIndex, sizeof(uniformIndex));
+	lgl__glCaptureValue(&bufSize, sizeof(bufSize));
+	(void)length;
+	lgl__glCaptureOutput((size_t)(sizeof(*length)));
+	(void)uniformName;
+	lgl__glCaptureOutput((size_t)(bufSize * sizeof(*uniformName)));
+}
+
+static void lgl__glCapture_glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName, GLuint lgl__result)
+{
+	lgl__glCaptureBegin(293);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureData(uniformBlockName, uniformBlockName ? (size_t)(lgl__glCaptureStringBytes(uniformBlockName, -1)) : 0);
+	lgl__glCaptureValue(&lgl__result, sizeof(lgl__result));
+}
+
+static void lgl__glCapture_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params)
+{
+	lgl__glCaptureBegin(294);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&uniformBlockIndex, sizeof(uniformBlockIndex));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName)
+{
+	lgl__glCaptureBegin(295);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&uniformBlockIndex, sizeof(uniformBlockIndex));
+	lgl__glCaptureValue(&bufSize, sizeof(bufSize));
+	(void)length;
+	lgl__glCaptureOutput((size_t)(sizeof(*length)));
+	(void)uniformBlockName;
+	lgl__glCaptureOutput((size_t)(bufSize * sizeof(*uniformBlockName)));
+}
+
+static void lgl__glCapture_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding)
+{
+	lgl__glCaptureBegin(296);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&uniformBlockIndex, sizeof(uniformBlockIndex));
+	lgl__glCaptureValue(&uniformBlockBinding, sizeof(uniformBlockBinding));
+}
+
+static void lgl__glCapture_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex)
+{
+	lgl__glCaptureBegin(297);
+	lgl__glCaptureValue(&mode, sizeof(mode));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureOffset(indices);
+	lgl__glCaptureValue(&basevertex, sizeof(basevertex));
+}
+
+static void lgl__glCapture_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex)
+{
+	lgl__glCaptureBegin(298);
+	lgl__glCaptureValue(&mode, sizeof(mode));
+	lgl__glCaptureValue(&start, sizeof(start));
+	lgl__glCaptureValue(&end, sizeof(end));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureOffset(indices);
+	lgl__glCaptureValue(&basevertex, sizeof(basevertex));
+}
+
+static void lgl__glCapture_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex)
+{
+	lgl__glCaptureBegin(299);
+	lgl__glCaptureValue(&mode, sizeof(mode));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureOffset(indices);
+	lgl__glCaptureValue(&instancecount, sizeof(instancecount));
+	lgl__glCaptureValue(&basevertex, sizeof(basevertex));
+}
+
+static void lgl__glCapture_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex)
+{
+	lgl__glCaptureBegin(300);
+	lgl__glCaptureValue(&mode, sizeof(mode));
+	lgl__glCaptureData(count, count ? (size_t)(drawcount * sizeof(*count)) : 0);
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureData(indices, indices ? (size_t)(drawcount * sizeof(void *)) : 0);
+	lgl__glCaptureValue(&drawcount, sizeof(drawcount));
+	lgl__glCaptureData(basevertex, basevertex ? (size_t)(drawcount * sizeof(*basevertex)) : 0);
+}
+
+static void lgl__glCapture_glProvokingVertex(GLenum mode)
+{
+	lgl__glCaptureBegin(301);
+	lgl__glCaptureValue(&mode, sizeof(mode));
+}
+
+static void lgl__glCapture_glFenceSync(GLenum condition, GLbitfield flags, GLsync lgl__result)
+{
+	lgl__glCaptureBegin(302);
+	lgl__glCaptureValue(&condition, sizeof(condition));
+	lgl__glCaptureValue(&flags, sizeof(flags));
+	lgl__glCaptureSync(lgl__result);
+}
+
+static void lgl__glCapture_glIsSync(GLsync sync, GLboolean lgl__result)
+{
+	lgl__glCaptureBegin(303);
+	lgl__glCaptureSync(sync);
+	lgl__glCaptureValue(&lgl__result, sizeof(lgl__result));
+}
+
+static void lgl__glCapture_glDeleteSync(GLsync sync)
+{
+	lgl__glCaptureBegin(304);
+	lgl__glCaptureSync(sync);
+}
+
+static void lgl__glCapture_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout, GLenum lgl__result)
+{
+	lgl__glCaptureBegin(305);
+	lgl__glCaptureSync(sync);
+	lgl__glCaptureValue(&flags, sizeof(flags));
+	lgl__glCaptureValue(&timeout, sizeof(timeout));
+	lgl__glCaptureValue(&lgl__result, sizeof(lgl__result));
+}
+
+static void lgl__glCapture_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+	lgl__glCaptureBegin(306);
+	lgl__glCaptureSync(sync);
+	lgl__glCaptureValue(&flags, sizeof(flags));
+	lgl__glCaptureValue(&timeout, sizeof(timeout));
+}
+
+static void lgl__glCapture_glGetInteger64v(GLenum pname, GLint64 *data)
+{
+	lgl__glCaptureBegin(307);
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)data;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values)
+{
+	lgl__glCaptureBegin(308);
+	lgl__glCaptureSync(sync);
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	lgl__glCaptureValue(&count, sizeof(count));
+	(void)length;
+	lgl__glCaptureOutput((size_t)(sizeof(*length)));
+	(void)values;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data)
+{
+	lgl__glCaptureBegin(309);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&index, sizeof(index));
+	(void)data;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params)
+{
+	lgl__glCaptureBegin(310);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level)
+{
+	lgl__glCaptureBegin(311);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&attachment, sizeof(attachment));
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&level, sizeof(level));
+}
+
+static void lgl__glCapture_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
+{
+	lgl__glCaptureBegin(312);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&samples, sizeof(samples));
+	lgl__glCaptureValue(&internalformat, sizeof(internalformat));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&height, sizeof(height));
+	lgl__glCaptureValue(&fixedsamplelocations, sizeof(fixedsamplelocations));
+}
+
+static void lgl__glCapture_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
+{
+	lgl__glCaptureBegin(313);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&samples, sizeof(samples));
+	lgl__glCaptureValue(&internalformat, sizeof(internalformat));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&height, sizeof(height));
+	lgl__glCaptureValue(&depth, sizeof(depth));
+	lgl__glCaptureValue(&fixedsamplelocations, sizeof(fixedsamplelocations));
+}
+
+static void lgl__glCapture_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val)
+{
+	lgl__glCaptureBegin(314);
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	lgl__glCaptureValue(&index, sizeof(index));
+	(void)val;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glSampleMaski(GLuint maskNumber, GLbitfield mask)
+{
+	lgl__glCaptureBegin(315);
+	lgl__glCaptureValue(&maskNumber, sizeof(maskNumber));
+	lgl__glCaptureValue(&mask, sizeof(mask));
+}
+
+static void lgl__glCapture_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name)
+{
+	lgl__glCaptureBegin(316);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&colorNumber, sizeof(colorNumber));
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureData(name, name ? (size_t)(lgl__glCaptureStringBytes(name, -1)) : 0);
+}
+
+static void lgl__glCapture_glGetFragDataIndex(GLuint program, const GLchar *name, GLint lgl__result)
+{
+	lgl__glCaptureBegin(317);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureData(name, name ? (size_t)(lgl__glCaptureStringBytes(name, -1)) : 0);
+	lgl__glCaptureValue(&lgl__result, sizeof(lgl__result));
+}
+
+static void lgl__glCapture_glGenSamplers(GLsizei count, GLuint *samplers)
+{
+	lgl__glCaptureBegin(318);
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureRecord(samplers, (size_t)(count * sizeof(GLuint)));
+}
+
+static void lgl__glCapture_glDeleteSamplers(GLsizei count, const GLuint *samplers)
+{
+	lgl__glCaptureBegin(319);
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureData(samplers, samplers ? (size_t)(count * sizeof(*samplers)) : 0);
+}
+
+static void lgl__glCapture_glIsSampler(GLuint sampler, GLboolean lgl__result)
+{
+	lgl__glCaptureBegin(320);
+	lgl__glCaptureValue(&sampler, sizeof(sampler));
+	lgl__glCaptureValue(&lgl__result, sizeof(lgl__result));
+}
+
+static void lgl__glCapture_glBindSampler(GLuint unit, GLuint sampler)
+{
+	lgl__glCaptureBegin(321);
+	lgl__glCaptureValue(&unit, sizeof(unit));
+	lgl__glCaptureValue(&sampler, sizeof(sampler));
+}
+
+static void lgl__glCapture_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param)
+{
+	lgl__glCaptureBegin(322);
+	lgl__glCaptureValue(&sampler, sizeof(sampler));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	lgl__glCaptureValue(&param, sizeof(param));
+}
+
+static void lgl__glCapture_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param)
+{
+	lgl__glCaptureBegin(323);
+	lgl__glCaptureValue(&sampler, sizeof(sampler));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	lgl__glCaptureData(param, param ? (size_t)(lgl__glCaptureParamCount(pname) * sizeof(*param)) : 0);
+}
+
+static void lgl__glCapture_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param)
+{
+	lgl__glCaptureBegin(324);
+	lgl__glCaptureValue(&sampler, sizeof(sampler));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	lgl__glCaptureValue(&param, sizeof(param));
+}
+
+static void lgl__glCapture_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param)
+{
+	lgl__glCaptureBegin(325);
+	lgl__glCaptureValue(&sampler, sizeof(sampler));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	lgl__glCaptureData(param, param ? (size_t)(lgl__glCaptureParamCount(pname) * sizeof(*param)) : 0);
+}
+
+static void lgl__glCapture_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param)
+{
+	lgl__glCaptureBegin(326);
+	lgl__glCaptureValue(&sampler, sizeof(sampler));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	lgl__glCaptureData(param, param ? (size_t)(lgl__glCaptureParamCount(pname) * sizeof(*param)) : 0);
+}
+
+static void lgl__glCapture_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param)
+{
+	lgl__glCaptureBegin(327);
+	lgl__glCaptureValue(&sampler, sizeof(sampler));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	lgl__glCaptureData(param, param ? (size_t)(lgl__glCaptureParamCount(pname) * sizeof(*param)) : 0);
+}
+
+static void lgl__glCapture_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params)
+{
+	lgl__glCaptureBegin(328);
+	lgl__glCaptureValue(&sampler, sizeof(sampler));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params)
+{
+	lgl__glCaptureBegin(329);
+	lgl__glCaptureValue(&sampler, sizeof(sampler));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params)
+{
+	lgl__glCaptureBegin(330);
+	lgl__glCaptureValue(&sampler, sizeof(sampler));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params)
+{
+	lgl__glCaptureBegin(331);
+	lgl__glCaptureValue(&sampler, sizeof(sampler));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glQueryCounter(GLuint id, GLenum target)
+{
+	lgl__glCaptureBegin(332);
+	lgl__glCaptureValue(&id, sizeof(id));
+	lgl__glCaptureValue(&target, sizeof(target));
+}
+
+static void lgl__glCapture_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params)
+{
+	lgl__glCaptureBegin(333);
+	lgl__glCaptureValue(&id, sizeof(id));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params)
+{
+	lgl__glCaptureBegin(334);
+	lgl__glCaptureValue(&id, sizeof(id));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glVertexAttribDivisor(GLuint index, GLuint divisor)
+{
+	lgl__glCaptureBegin(335);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&divisor, sizeof(divisor));
+}
+
+static void lgl__glCapture_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+	lgl__glCaptureBegin(336);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureValue(&normalized, sizeof(normalized));
+	lgl__glCaptureValue(&value, sizeof(value));
+}
+
+static void lgl__glCapture_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+{
+	lgl__glCaptureBegin(337);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureValue(&normalized, sizeof(normalized));
+	lgl__glCaptureData(value, value ? (size_t)(sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+	lgl__glCaptureBegin(338);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureValue(&normalized, sizeof(normalized));
+	lgl__glCaptureValue(&value, sizeof(value));
+}
+
+static void lgl__glCapture_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+{
+	lgl__glCaptureBegin(339);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureValue(&normalized, sizeof(normalized));
+	lgl__glCaptureData(value, value ? (size_t)(sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+	lgl__glCaptureBegin(340);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureValue(&normalized, sizeof(normalized));
+	lgl__glCaptureValue(&value, sizeof(value));
+}
+
+static void lgl__glCapture_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+{
+	lgl__glCaptureBegin(341);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureValue(&normalized, sizeof(normalized));
+	lgl__glCaptureData(value, value ? (size_t)(sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+	lgl__glCaptureBegin(342);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureValue(&normalized, sizeof(normalized));
+	lgl__glCaptureValue(&value, sizeof(value));
+}
+
+static void lgl__glCapture_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+{
+	lgl__glCaptureBegin(343);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureValue(&normalized, sizeof(normalized));
+	lgl__glCaptureData(value, value ? (size_t)(sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glVertexP2ui(GLenum type, GLuint value)
+{
+	lgl__glCaptureBegin(344);
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureValue(&value, sizeof(value));
+}
+
+static void lgl__glCapture_glVertexP2uiv(GLenum type, const GLuint *value)
+{
+	lgl__glCaptureBegin(345);
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureData(value, value ? (size_t)(sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glVertexP3ui(GLenum type, GLuint value)
+{
+	lgl__glCaptureBegin(346);
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureValue(&value, sizeof(value));
+}
+
+static void lgl__glCapture_glVertexP3uiv(GLenum type, const GLuint *value)
+{
+	lgl__glCaptureBegin(347);
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureData(value, value ? (size_t)(sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glVertexP4ui(GLenum type, GLuint value)
+{
+	lgl__glCaptureBegin(348);
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureValue(&value, sizeof(value));
+}
+
+static void lgl__glCapture_glVertexP4uiv(GLenum type, const GLuint *value)
+{
+	lgl__glCaptureBegin(349);
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureData(value, value ? (size_t)(sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glTexCoordP1ui(GLenum type, GLuint coords)
+{
+	lgl__glCaptureBegin(350);
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureValue(&coords, sizeof(coords));
+}
+
+static void lgl__glCapture_glTexCoordP1uiv(GLenum type, const GLuint *coords)
+{
+	lgl__glCaptureBegin(351);
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureData(coords, coords ? (size_t)(sizeof(*coords)) : 0);
+}
+
+static void lgl__glCapture_glTexCoordP2ui(GLenum type, GLuint coords)
+{
+	lgl__glCaptureBegin(352);
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureValue(&coords, sizeof(coords));
+}
+
+static void lgl__glCapture_glTexCoordP2uiv(GLenum type, const GLuint *coords)
+{
+	lgl__glCaptureBegin(353);
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureData(coords, coords ? (size_t)(sizeof(*coords)) : 0);
+}
+
+static void lgl__glCapture_glTexCoordP3ui(GLenum type, GLuint coords)
+{
+	lgl__glCaptureBegin(354);
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureValue(&coords, sizeof(coords));
+}
+
+static void lgl__glCapture_glTexCoordP3uiv(GLenum type, const GLuint *coords)
+{
+	lgl__glCaptureBegin(355);
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureData(coords, coords ? (size_t)(sizeof(*coords)) : 0);
+}
+
+static void lgl__glCapture_glTexCoordP4ui(GLenum type, GLuint coords)
+{
+	lgl__glCaptureBegin(356);
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureValue(&coords, sizeof(coords));
+}
+
+static void lgl__glCapture_glTexCoordP4uiv(GLenum type, const GLuint *coords)
+{
+	lgl__glCaptureBegin(357);
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureData(coords, coords ? (size_t)(sizeof(*coords)) : 0);
+}
+
+static void lgl__glCapture_glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords)
+{
+	lgl__glCaptureBegin(358);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureValue(&coords, sizeof(coords));
+}
+
+static void lgl__glCapture_glMultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint *coords)
+{
+	lgl__glCaptureBegin(359);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureData(coords, coords ? (size_t)(sizeof(*coords)) : 0);
+}
+
+static void lgl__glCapture_glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords)
+{
+	lgl__glCaptureBegin(360);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureValue(&coords, sizeof(coords));
+}
+
+static void lgl__glCapture_glMultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint *coords)
+{
+	lgl__glCaptureBegin(361);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureData(coords, coords ? (size_t)(sizeof(*coords)) : 0);
+}
+
+static void lgl__glCapture_glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords)
+{
+	lgl__glCaptureBegin(362);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureValue(&coords, sizeof(coords));
+}
+
+static void lgl__glCapture_glMultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint *coords)
+{
+	lgl__glCaptureBegin(363);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureData(coords, coords ? (size_t)(sizeof(*coords)) : 0);
+}
+
+static void lgl__glCapture_glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords)
+{
+	lgl__glCaptureBegin(364);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureValue(&coords, sizeof(coords));
+}
+
+static void lgl__glCapture_glMultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint *coords)
+{
+	lgl__glCaptureBegin(365);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureData(coords, coords ? (size_t)(sizeof(*coords)) : 0);
+}
+
+static void lgl__glCapture_glNormalP3ui(GLenum type, GLuint coords)
+{
+	lgl__glCaptureBegin(366);
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureValue(&coords, sizeof(coords));
+}
+
+static void lgl__glCapture_glNormalP3uiv(GLenum type, const GLuint *coords)
+{
+	lgl__glCaptureBegin(367);
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureData(coords, coords ? (size_t)(sizeof(*coords)) : 0);
+}
+
+static void lgl__glCapture_glColorP3ui(GLenum type, GLuint color)
+{
+	lgl__glCaptureBegin(368);
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureValue(&color, sizeof(color));
+}
+
+static void lgl__glCapture_glColorP3uiv(GLenum type, const GLuint *color)
+{
+	lgl__glCaptureBegin(369);
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureData(color, color ? (size_t)(sizeof(*color)) : 0);
+}
+
+static void lgl__glCapture_glColorP4ui(GLenum type, GLuint color)
+{
+	lgl__glCaptureBegin(370);
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureValue(&color, sizeof(color));
+}
+
+static void lgl__glCapture_glColorP4uiv(GLenum type, const GLuint *color)
+{
+	lgl__glCaptureBegin(371);
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureData(color, color ? (size_t)(sizeof(*color)) : 0);
+}
+
+static void lgl__glCapture_glSecondaryColorP3ui(GLenum type, GLuint color)
+{
+	lgl__glCaptureBegin(372);
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureValue(&color, sizeof(color));
+}
+
+static void lgl__glCapture_glSecondaryColorP3uiv(GLenum type, const GLuint *color)
+{
+	lgl__glCaptureBegin(373);
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureData(color, color ? (size_t)(sizeof(*color)) : 0);
+}
+
+static void lgl__glCapture_glMinSampleShading(GLfloat value)
+{
+	lgl__glCaptureBegin(374);
+	lgl__glCaptureValue(&value, sizeof(value));
+}
+
+static void lgl__glCapture_glBlendEquationi(GLuint buf, GLenum mode)
+{
+	lgl__glCaptureBegin(375);
+	lgl__glCaptureValue(&buf, sizeof(buf));
+	lgl__glCaptureValue(&mode, sizeof(mode));
+}
+
+static void lgl__glCapture_glBlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum modeAlpha)
+{
+	lgl__glCaptureBegin(376);
+	lgl__glCaptureValue(&buf, sizeof(buf));
+	lgl__glCaptureValue(&modeRGB, sizeof(modeRGB));
+	lgl__glCaptureValue(&modeAlpha, sizeof(modeAlpha));
+}
+
+static void lgl__glCapture_glBlendFunci(GLuint buf, GLenum src, GLenum dst)
+{
+	lgl__glCaptureBegin(377);
+	lgl__glCaptureValue(&buf, sizeof(buf));
+	lgl__glCaptureValue(&src, sizeof(src));
+	lgl__glCaptureValue(&dst, sizeof(dst));
+}
+
+static void lgl__glCapture_glBlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
+{
+	lgl__glCaptureBegin(378);
+	lgl__glCaptureValue(&buf, sizeof(buf));
+	lgl__glCaptureValue(&srcRGB, sizeof(srcRGB));
+	lgl__glCaptureValue(&dstRGB, sizeof(dstRGB));
+	lgl__glCaptureValue(&srcAlpha, sizeof(srcAlpha));
+	lgl__glCaptureValue(&dstAlpha, sizeof(dstAlpha));
+}
+
+static void lgl__glCapture_glDrawArraysIndirect(GLenum mode, const void *indirect)
+{
+	lgl__glCaptureBegin(379);
+	lgl__glCaptureValue(&mode, sizeof(mode));
+	lgl__glCaptureOffset(indirect);
+}
+
+static void lgl__glCapture_glDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect)
+{
+	lgl__glCaptureBegin(380);
+	lgl__glCaptureValue(&mode, sizeof(mode));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureOffset(indirect);
+}
+
+static void lgl__glCapture_glUniform1d(GLint location, GLdouble x)
+{
+	lgl__glCaptureBegin(381);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&x, sizeof(x));
+}
+
+static void lgl__glCapture_glUniform2d(GLint location, GLdouble x, GLdouble y)
+{
+	lgl__glCaptureBegin(382);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&x, sizeof(x));
+	lgl__glCaptureValue(&y, sizeof(y));
+}
+
+static void lgl__glCapture_glUniform3d(GLint location, GLdouble x, GLdouble y, GLdouble z)
+{
+	lgl__glCaptureBegin(383);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&x, sizeof(x));
+	lgl__glCaptureValue(&y, sizeof(y));
+	lgl__glCaptureValue(&z, sizeof(z));
+}
+
+static void lgl__glCapture_glUniform4d(GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+	lgl__glCaptureBegin(384);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&x, sizeof(x));
+	lgl__glCaptureValue(&y, sizeof(y));
+	lgl__glCaptureValue(&z, sizeof(z));
+	lgl__glCaptureValue(&w, sizeof(w));
+}
+
+static void lgl__glCapture_glUniform1dv(GLint location, GLsizei count, const GLdouble *value)
+{
+	lgl__glCaptureBegin(385);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureData(value, value ? (size_t)(count * 1 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glUniform2dv(GLint location, GLsizei count, const GLdouble *value)
+{
+	lgl__glCaptureBegin(386);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureData(value, value ? (size_t)(count * 2 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glUniform3dv(GLint location, GLsizei count, const GLdouble *value)
+{
+	lgl__glCaptureBegin(387);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureData(value, value ? (size_t)(count * 3 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glUniform4dv(GLint location, GLsizei count, const GLdouble *value)
+{
+	lgl__glCaptureBegin(388);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureData(value, value ? (size_t)(count * 4 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glUniformMatrix2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	lgl__glCaptureBegin(389);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureValue(&transpose, sizeof(transpose));
+	lgl__glCaptureData(value, value ? (size_t)(count * 2 * 2 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glUniformMatrix3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	lgl__glCaptureBegin(390);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureValue(&transpose, sizeof(transpose));
+	lgl__glCaptureData(value, value ? (size_t)(count * 3 * 3 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glUniformMatrix4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	lgl__glCaptureBegin(391);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureValue(&transpose, sizeof(transpose));
+	lgl__glCaptureData(value, value ? (size_t)(count * 4 * 4 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glUniformMatrix2x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	lgl__glCaptureBegin(392);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureValue(&transpose, sizeof(transpose));
+	lgl__glCaptureData(value, value ? (size_t)(count * 2 * 3 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glUniformMatrix2x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	lgl__glCaptureBegin(393);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureValue(&transpose, sizeof(transpose));
+	lgl__glCaptureData(value, value ? (size_t)(count * 2 * 4 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glUniformMatrix3x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	lgl__glCaptureBegin(394);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureValue(&transpose, sizeof(transpose));
+	lgl__glCaptureData(value, value ? (size_t)(count * 3 * 2 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glUniformMatrix3x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	lgl__glCaptureBegin(395);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureValue(&transpose, sizeof(transpose));
+	lgl__glCaptureData(value, value ? (size_t)(count * 3 * 4 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glUniformMatrix4x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	lgl__glCaptureBegin(396);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureValue(&transpose, sizeof(transpose));
+	lgl__glCaptureData(value, value ? (size_t)(count * 4 * 2 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glUniformMatrix4x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	lgl__glCaptureBegin(397);
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureValue(&transpose, sizeof(transpose));
+	lgl__glCaptureData(value, value ? (size_t)(count * 4 * 3 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glGetUniformdv(GLuint program, GLint location, GLdouble *params)
+{
+	lgl__glCaptureBegin(398);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetSubroutineUniformLocation(GLuint program, GLenum shadertype, const GLchar *name, GLint lgl__result)
+{
+	lgl__glCaptureBegin(399);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&shadertype, sizeof(shadertype));
+	lgl__glCaptureData(name, name ? (size_t)(lgl__glCaptureStringBytes(name, -1)) : 0);
+	lgl__glCaptureValue(&lgl__result, sizeof(lgl__result));
+}
+
+static void lgl__glCapture_glGetSubroutineIndex(GLuint program, GLenum shadertype, const GLchar *name, GLuint lgl__result)
+{
+	lgl__glCaptureBegin(400);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&shadertype, sizeof(shadertype));
+	lgl__glCaptureData(name, name ? (size_t)(lgl__glCaptureStringBytes(name, -1)) : 0);
+	lgl__glCaptureValue(&lgl__result, sizeof(lgl__result));
+}
+
+static void lgl__glCapture_glGetActiveSubroutineUniformiv(GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint *values)
+{
+	lgl__glCaptureBegin(401);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&shadertype, sizeof(shadertype));
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)values;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetActiveSubroutineUniformName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name)
+{
+	lgl__glCaptureBegin(402);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&shadertype, sizeof(shadertype));
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&bufSize, sizeof(bufSize));
+	(void)length;
+	lgl__glCaptureOutput((size_t)(sizeof(*length)));
+	(void)name;
+	lgl__glCaptureOutput((size_t)(bufSize * sizeof(*name)));
+}
+
+static void lgl__glCapture_glGetActiveSubroutineName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name)
+{
+	lgl__glCaptureBegin(403);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&shadertype, sizeof(shadertype));
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&bufSize, sizeof(bufSize));
+	(void)length;
+	lgl__glCaptureOutput((size_t)(sizeof(*length)));
+	(void)name;
+	lgl__glCaptureOutput((size_t)(bufSize * sizeof(*name)));
+}
+
+static void lgl__glCapture_glUniformSubroutinesuiv(GLenum shadertype, GLsizei count, const GLuint *indices)
+{
+	lgl__glCaptureBegin(404);
+	lgl__glCaptureValue(&shadertype, sizeof(shadertype));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureData(indices, indices ? (size_t)(count * sizeof(*indices)) : 0);
+}
+
+static void lgl__glCapture_glGetUniformSubroutineuiv(GLenum shadertype, GLint location, GLuint *params)
+{
+	lgl__glCaptureBegin(405);
+	lgl__glCaptureValue(&shadertype, sizeof(shadertype));
+	lgl__glCaptureValue(&location, sizeof(location));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetProgramStageiv(GLuint program, GLenum shadertype, GLenum pname, GLint *values)
+{
+	lgl__glCaptureBegin(406);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&shadertype, sizeof(shadertype));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)values;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glPatchParameteri(GLenum pname, GLint value)
+{
+	lgl__glCaptureBegin(407);
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	lgl__glCaptureValue(&value, sizeof(value));
+}
+
+static void lgl__glCapture_glPatchParameterfv(GLenum pname, const GLfloat *values)
+{
+	lgl__glCaptureBegin(408);
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	lgl__glCaptureData(values, values ? (size_t)(lgl__glCaptureParamCount(pname) * sizeof(*values)) : 0);
+}
+
+static void lgl__glCapture_glBindTransformFeedback(GLenum target, GLuint id)
+{
+	lgl__glCaptureBegin(409);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&id, sizeof(id));
+}
+
+static void lgl__glCapture_glDeleteTransformFeedbacks(GLsizei n, const GLuint *ids)
+{
+	lgl__glCaptureBegin(410);
+	lgl__glCaptureValue(&n, sizeof(n));
+	lgl__glCaptureData(ids, ids ? (size_t)(n * sizeof(*ids)) : 0);
+}
+
+static void lgl__glCapture_glGenTransformFeedbacks(GLsizei n, GLuint *ids)
+{
+	lgl__glCaptureBegin(411);
+	lgl__glCaptureValue(&n, sizeof(n));
+	lgl__glCaptureRecord(ids, (size_t)(n * sizeof(GLuint)));
+}
+
+static void lgl__glCapture_glIsTransformFeedback(GLuint id, GLboolean lgl__result)
+{
+	lgl__glCaptureBegin(412);
+	lgl__glCaptureValue(&id, sizeof(id));
+	lgl__glCaptureValue(&lgl__result, sizeof(lgl__result));
+}
+
+static void lgl__glCapture_glPauseTransformFeedback(void)
+{
+	lgl__glCaptureBegin(413);
+}
+
+static void lgl__glCapture_glResumeTransformFeedback(void)
+{
+	lgl__glCaptureBegin(414);
+}
+
+static void lgl__glCapture_glDrawTransformFeedback(GLenum mode, GLuint id)
+{
+	lgl__glCaptureBegin(415);
+	lgl__glCaptureValue(&mode, sizeof(mode));
+	lgl__glCaptureValue(&id, sizeof(id));
+}
+
+static void lgl__glCapture_glDrawTransformFeedbackStream(GLenum mode, GLuint id, GLuint stream)
+{
+	lgl__glCaptureBegin(416);
+	lgl__glCaptureValue(&mode, sizeof(mode));
+	lgl__glCaptureValue(&id, sizeof(id));
+	lgl__glCaptureValue(&stream, sizeof(stream));
+}
+
+static void lgl__glCapture_glBeginQueryIndexed(GLenum target, GLuint index, GLuint id)
+{
+	lgl__glCaptureBegin(417);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&id, sizeof(id));
+}
+
+static void lgl__glCapture_glEndQueryIndexed(GLenum target, GLuint index)
+{
+	lgl__glCaptureBegin(418);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&index, sizeof(index));
+}
+
+static void lgl__glCapture_glGetQueryIndexediv(GLenum target, GLuint index, GLenum pname, GLint *params)
+{
+	lgl__glCaptureBegin(419);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glReleaseShaderCompiler(void)
+{
+	lgl__glCaptureBegin(420);
+}
+
+static void lgl__glCapture_glShaderBinary(GLsizei count, const GLuint *shaders, GLenum binaryFormat, const void *binary, GLsizei length)
+{
+	lgl__glCaptureBegin(421);
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureData(shaders, shaders ? (size_t)(count * sizeof(*shaders)) : 0);
+	lgl__glCaptureValue(&binaryFormat, sizeof(binaryFormat));
+	lgl__glCaptureData(binary, binary ? (size_t)(length) : 0);
+	lgl__glCaptureValue(&length, sizeof(length));
+}
+
+static void lgl__glCapture_glGetShaderPrecisionFormat(GLenum shadertype, GLenum precisiontype, GLint *range, GLint *precision)
+{
+	lgl__glCaptureBegin(422);
+	lgl__glCaptureValue(&shadertype, sizeof(shadertype));
+	lgl__glCaptureValue(&precisiontype, sizeof(precisiontype));
+	(void)range;
+	lgl__glCaptureOutput((size_t)(0));
+	(void)precision;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glDepthRangef(GLfloat n, GLfloat f)
+{
+	lgl__glCaptureBegin(423);
+	lgl__glCaptureValue(&n, sizeof(n));
+	lgl__glCaptureValue(&f, sizeof(f));
+}
+
+static void lgl__glCapture_glClearDepthf(GLfloat d)
+{
+	lgl__glCaptureBegin(424);
+	lgl__glCaptureValue(&d, sizeof(d));
+}
+
+static void lgl__glCapture_glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary)
+{
+	lgl__glCaptureBegin(425);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&bufSize, sizeof(bufSize));
+	(void)length;
+	lgl__glCaptureOutput((size_t)(sizeof(*length)));
+	(void)binaryFormat;
+	lgl__glCaptureOutput((size_t)(bufSize * sizeof(*binaryFormat)));
+	(void)binary;
+	lgl__glCaptureOutput((size_t)(bufSize));
+}
+
+static void lgl__glCapture_glProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length)
+{
+	lgl__glCaptureBegin(426);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&binaryFormat, sizeof(binaryFormat));
+	lgl__glCaptureData(binary, binary ? (size_t)(length) : 0);
+	lgl__glCaptureValue(&length, sizeof(length));
+}
+
+static void lgl__glCapture_glProgramParameteri(GLuint program, GLenum pname, GLint value)
+{
+	lgl__glCaptureBegin(427);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	lgl__glCaptureValue(&value, sizeof(value));
+}
+
+static void lgl__glCapture_glUseProgramStages(GLuint pipeline, GLbitfield stages, GLuint program)
+{
+	lgl__glCaptureBegin(428);
+	lgl__glCaptureValue(&pipeline, sizeof(pipeline));
+	lgl__glCaptureValue(&stages, sizeof(stages));
+	lgl__glCaptureValue(&program, sizeof(program));
+}
+
+static void lgl__glCapture_glActiveShaderProgram(GLuint pipeline, GLuint program)
+{
+	lgl__glCaptureBegin(429);
+	lgl__glCaptureValue(&pipeline, sizeof(pipeline));
+	lgl__glCaptureValue(&program, sizeof(program));
+}
+
+static void lgl__glCapture_glCreateShaderProgramv(GLenum type, GLsizei count, const GLchar *const*strings, GLuint lgl__result)
+{
+	lgl__glCaptureBegin(430);
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureStrings(count, strings, NULL);
+	lgl__glCaptureValue(&lgl__result, sizeof(lgl__result));
+}
+
+static void lgl__glCapture_glBindProgramPipeline(GLuint pipeline)
+{
+	lgl__glCaptureBegin(431);
+	lgl__glCaptureValue(&pipeline, sizeof(pipeline));
+}
+
+static void lgl__glCapture_glDeleteProgramPipelines(GLsizei n, const GLuint *pipelines)
+{
+	lgl__glCaptureBegin(432);
+	lgl__glCaptureValue(&n, sizeof(n));
+	lgl__glCaptureData(pipelines, pipelines ? (size_t)(n * sizeof(*pipelines)) : 0);
+}
+
+static void lgl__glCapture_glGenProgramPipelines(GLsizei n, GLuint *pipelines)
+{
+	lgl__glCaptureBegin(433);
+	lgl__glCaptureValue(&n, sizeof(n));
+	lgl__glCaptureRecord(pipelines, (size_t)(n * sizeof(GLuint)));
+}
+
+static void lgl__glCapture_glIsProgramPipeline(GLuint pipeline, GLboolean lgl__result)
+{
+	lgl__glCaptureBegin(434);
+	lgl__glCaptureValue(&pipeline, sizeof(pipeline));
+	lgl__glCaptureValue(&lgl__result, sizeof(lgl__result));
+}
+
+static void lgl__glCapture_glGetProgramPipelineiv(GLuint pipeline, GLenum pname, GLint *params)
+{
+	lgl__glCaptureBegin(435);
+	lgl__glCaptureValue(&pipeline, sizeof(pipeline));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glProgramUniform1i(GLuint program, GLint location, GLint v0)
+{
+	lgl__glCaptureBegin(436);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&v0, sizeof(v0));
+}
+
+static void lgl__glCapture_glProgramUniform1iv(GLuint program, GLint location, GLsizei count, const GLint *value)
+{
+	lgl__glCaptureBegin(437);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureData(value, value ? (size_t)(count * 1 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glProgramUniform1f(GLuint program, GLint location, GLfloat v0)
+{
+	lgl__glCaptureBegin(438);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&v0, sizeof(v0));
+}
+
+static void lgl__glCapture_glProgramUniform1fv(GLuint program, GLint location, GLsizei count, const GLfloat *value)
+{
+	lgl__glCaptureBegin(439);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureData(value, value ? (size_t)(count * 1 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glProgramUniform1d(GLuint program, GLint location, GLdouble v0)
+{
+	lgl__glCaptureBegin(440);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&v0, sizeof(v0));
+}
+
+static void lgl__glCapture_glProgramUniform1dv(GLuint program, GLint location, GLsizei count, const GLdouble *value)
+{
+	lgl__glCaptureBegin(441);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureData(value, value ? (size_t)(count * 1 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glProgramUniform1ui(GLuint program, GLint location, GLuint v0)
+{
+	lgl__glCaptureBegin(442);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&v0, sizeof(v0));
+}
+
+static void lgl__glCapture_glProgramUniform1uiv(GLuint program, GLint location, GLsizei count, const GLuint *value)
+{
+	lgl__glCaptureBegin(443);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureData(value, value ? (size_t)(count * 1 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glProgramUniform2i(GLuint program, GLint location, GLint v0, GLint v1)
+{
+	lgl__glCaptureBegin(444);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&v0, sizeof(v0));
+	lgl__glCaptureValue(&v1, sizeof(v1));
+}
+
+static void lgl__glCapture_glProgramUniform2iv(GLuint program, GLint location, GLsizei count, const GLint *value)
+{
+	lgl__glCaptureBegin(445);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureData(value, value ? (size_t)(count * 2 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glProgramUniform2f(GLuint program, GLint location, GLfloat v0, GLfloat v1)
+{
+	lgl__glCaptureBegin(446);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&v0, sizeof(v0));
+	lgl__glCaptureValue(&v1, sizeof(v1));
+}
+
+static void lgl__glCapture_glProgramUniform2fv(GLuint program, GLint location, GLsizei count, const GLfloat *value)
+{
+	lgl__glCaptureBegin(447);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureData(value, value ? (size_t)(count * 2 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glProgramUniform2d(GLuint program, GLint location, GLdouble v0, GLdouble v1)
+{
+	lgl__glCaptureBegin(448);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&v0, sizeof(v0));
+	lgl__glCaptureValue(&v1, sizeof(v1));
+}
+
+static void lgl__glCapture_glProgramUniform2dv(GLuint program, GLint location, GLsizei count, const GLdouble *value)
+{
+	lgl__glCaptureBegin(449);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureData(value, value ? (size_t)(count * 2 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glProgramUniform2ui(GLuint program, GLint location, GLuint v0, GLuint v1)
+{
+	lgl__glCaptureBegin(450);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&v0, sizeof(v0));
+	lgl__glCaptureValue(&v1, sizeof(v1));
+}
+
+static void lgl__glCapture_glProgramUniform2uiv(GLuint program, GLint location, GLsizei count, const GLuint *value)
+{
+	lgl__glCaptureBegin(451);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureData(value, value ? (size_t)(count * 2 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glProgramUniform3i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2)
+{
+	lgl__glCaptureBegin(452);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&v0, sizeof(v0));
+	lgl__glCaptureValue(&v1, sizeof(v1));
+	lgl__glCaptureValue(&v2, sizeof(v2));
+}
+
+static void lgl__glCapture_glProgramUniform3iv(GLuint program, GLint location, GLsizei count, const GLint *value)
+{
+	lgl__glCaptureBegin(453);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureData(value, value ? (size_t)(count * 3 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glProgramUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+{
+	lgl__glCaptureBegin(454);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&v0, sizeof(v0));
+	lgl__glCaptureValue(&v1, sizeof(v1));
+	lgl__glCaptureValue(&v2, sizeof(v2));
+}
+
+static void lgl__glCapture_glProgramUniform3fv(GLuint program, GLint location, GLsizei count, const GLfloat *value)
+{
+	lgl__glCaptureBegin(455);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureData(value, value ? (size_t)(count * 3 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glProgramUniform3d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2)
+{
+	lgl__glCaptureBegin(456);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&v0, sizeof(v0));
+	lgl__glCaptureValue(&v1, sizeof(v1));
+	lgl__glCaptureValue(&v2, sizeof(v2));
+}
+
+static void lgl__glCapture_glProgramUniform3dv(GLuint program, GLint location, GLsizei count, const GLdouble *value)
+{
+	lgl__glCaptureBegin(457);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureData(value, value ? (size_t)(count * 3 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glProgramUniform3ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2)
+{
+	lgl__glCaptureBegin(458);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&v0, sizeof(v0));
+	lgl__glCaptureValue(&v1, sizeof(v1));
+	lgl__glCaptureValue(&v2, sizeof(v2));
+}
+
+static void lgl__glCapture_glProgramUniform3uiv(GLuint program, GLint location, GLsizei count, const GLuint *value)
+{
+	lgl__glCaptureBegin(459);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureData(value, value ? (size_t)(count * 3 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glProgramUniform4i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+{
+	lgl__glCaptureBegin(460);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&v0, sizeof(v0));
+	lgl__glCaptureValue(&v1, sizeof(v1));
+	lgl__glCaptureValue(&v2, sizeof(v2));
+	lgl__glCaptureValue(&v3, sizeof(v3));
+}
+
+static void lgl__glCapture_glProgramUniform4iv(GLuint program, GLint location, GLsizei count, const GLint *value)
+{
+	lgl__glCaptureBegin(461);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureData(value, value ? (size_t)(count * 4 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glProgramUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+{
+	lgl__glCaptureBegin(462);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&v0, sizeof(v0));
+	lgl__glCaptureValue(&v1, sizeof(v1));
+	lgl__glCaptureValue(&v2, sizeof(v2));
+	lgl__glCaptureValue(&v3, sizeof(v3));
+}
+
+static void lgl__glCapture_glProgramUniform4fv(GLuint program, GLint location, GLsizei count, const GLfloat *value)
+{
+	lgl__glCaptureBegin(463);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureData(value, value ? (size_t)(count * 4 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glProgramUniform4d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3)
+{
+	lgl__glCaptureBegin(464);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&v0, sizeof(v0));
+	lgl__glCaptureValue(&v1, sizeof(v1));
+	lgl__glCaptureValue(&v2, sizeof(v2));
+	lgl__glCaptureValue(&v3, sizeof(v3));
+}
+
+static void lgl__glCapture_glProgramUniform4dv(GLuint program, GLint location, GLsizei count, const GLdouble *value)
+{
+	lgl__glCaptureBegin(465);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureData(value, value ? (size_t)(count * 4 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glProgramUniform4ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
+{
+	lgl__glCaptureBegin(466);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&v0, sizeof(v0));
+	lgl__glCaptureValue(&v1, sizeof(v1));
+	lgl__glCaptureValue(&v2, sizeof(v2));
+	lgl__glCaptureValue(&v3, sizeof(v3));
+}
+
+static void lgl__glCapture_glProgramUniform4uiv(GLuint program, GLint location, GLsizei count, const GLuint *value)
+{
+	lgl__glCaptureBegin(467);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureData(value, value ? (size_t)(count * 4 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glProgramUniformMatrix2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	lgl__glCaptureBegin(468);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureValue(&transpose, sizeof(transpose));
+	lgl__glCaptureData(value, value ? (size_t)(count * 2 * 2 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glProgramUniformMatrix3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	lgl__glCaptureBegin(469);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureValue(&transpose, sizeof(transpose));
+	lgl__glCaptureData(value, value ? (size_t)(count * 3 * 3 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glProgramUniformMatrix4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	lgl__glCaptureBegin(470);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureValue(&transpose, sizeof(transpose));
+	lgl__glCaptureData(value, value ? (size_t)(count * 4 * 4 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glProgramUniformMatrix2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	lgl__glCaptureBegin(471);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureValue(&transpose, sizeof(transpose));
+	lgl__glCaptureData(value, value ? (size_t)(count * 2 * 2 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glProgramUniformMatrix3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	lgl__glCaptureBegin(472);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureValue(&transpose, sizeof(transpose));
+	lgl__glCaptureData(value, value ? (size_t)(count * 3 * 3 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glProgramUniformMatrix4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	lgl__glCaptureBegin(473);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureValue(&transpose, sizeof(transpose));
+	lgl__glCaptureData(value, value ? (size_t)(count * 4 * 4 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glProgramUniformMatrix2x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	lgl__glCaptureBegin(474);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureValue(&transpose, sizeof(transpose));
+	lgl__glCaptureData(value, value ? (size_t)(count * 2 * 3 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glProgramUniformMatrix3x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	lgl__glCaptureBegin(475);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureValue(&transpose, sizeof(transpose));
+	lgl__glCaptureData(value, value ? (size_t)(count * 3 * 2 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glProgramUniformMatrix2x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	lgl__glCaptureBegin(476);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureValue(&transpose, sizeof(transpose));
+	lgl__glCaptureData(value, value ? (size_t)(count * 2 * 4 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glProgramUniformMatrix4x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	lgl__glCaptureBegin(477);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureValue(&transpose, sizeof(transpose));
+	lgl__glCaptureData(value, value ? (size_t)(count * 4 * 2 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glProgramUniformMatrix3x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	lgl__glCaptureBegin(478);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureValue(&transpose, sizeof(transpose));
+	lgl__glCaptureData(value, value ? (size_t)(count * 3 * 4 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glProgramUniformMatrix4x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	lgl__glCaptureBegin(479);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureValue(&transpose, sizeof(transpose));
+	lgl__glCaptureData(value, value ? (size_t)(count * 4 * 3 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glProgramUniformMatrix2x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	lgl__glCaptureBegin(480);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureValue(&transpose, sizeof(transpose));
+	lgl__glCaptureData(value, value ? (size_t)(count * 2 * 3 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glProgramUniformMatrix3x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	lgl__glCaptureBegin(481);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureValue(&transpose, sizeof(transpose));
+	lgl__glCaptureData(value, value ? (size_t)(count * 3 * 2 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glProgramUniformMatrix2x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	lgl__glCaptureBegin(482);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureValue(&transpose, sizeof(transpose));
+	lgl__glCaptureData(value, value ? (size_t)(count * 2 * 4 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glProgramUniformMatrix4x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	lgl__glCaptureBegin(483);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureValue(&transpose, sizeof(transpose));
+	lgl__glCaptureData(value, value ? (size_t)(count * 4 * 2 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glProgramUniformMatrix3x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	lgl__glCaptureBegin(484);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureValue(&transpose, sizeof(transpose));
+	lgl__glCaptureData(value, value ? (size_t)(count * 3 * 4 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glProgramUniformMatrix4x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	lgl__glCaptureBegin(485);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureValue(&transpose, sizeof(transpose));
+	lgl__glCaptureData(value, value ? (size_t)(count * 4 * 3 * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glValidateProgramPipeline(GLuint pipeline)
+{
+	lgl__glCaptureBegin(486);
+	lgl__glCaptureValue(&pipeline, sizeof(pipeline));
+}
+
+static void lgl__glCapture_glGetProgramPipelineInfoLog(GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+	lgl__glCaptureBegin(487);
+	lgl__glCaptureValue(&pipeline, sizeof(pipeline));
+	lgl__glCaptureValue(&bufSize, sizeof(bufSize));
+	(void)length;
+	lgl__glCaptureOutput((size_t)(sizeof(*length)));
+	(void)infoLog;
+	lgl__glCaptureOutput((size_t)(bufSize * sizeof(*infoLog)));
+}
+
+static void lgl__glCapture_glVertexAttribL1d(GLuint index, GLdouble x)
+{
+	lgl__glCaptureBegin(488);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&x, sizeof(x));
+}
+
+static void lgl__glCapture_glVertexAttribL2d(GLuint index, GLdouble x, GLdouble y)
+{
+	lgl__glCaptureBegin(489);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&x, sizeof(x));
+	lgl__glCaptureValue(&y, sizeof(y));
+}
+
+static void lgl__glCapture_glVertexAttribL3d(GLuint index, GLdouble x, GLdouble y, GLdouble z)
+{
+	lgl__glCaptureBegin(490);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&x, sizeof(x));
+	lgl__glCaptureValue(&y, sizeof(y));
+	lgl__glCaptureValue(&z, sizeof(z));
+}
+
+static void lgl__glCapture_glVertexAttribL4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+	lgl__glCaptureBegin(491);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&x, sizeof(x));
+	lgl__glCaptureValue(&y, sizeof(y));
+	lgl__glCaptureValue(&z, sizeof(z));
+	lgl__glCaptureValue(&w, sizeof(w));
+}
+
+static void lgl__glCapture_glVertexAttribL1dv(GLuint index, const GLdouble *v)
+{
+	lgl__glCaptureBegin(492);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureData(v, v ? (size_t)(1 * sizeof(*v)) : 0);
+}
+
+static void lgl__glCapture_glVertexAttribL2dv(GLuint index, const GLdouble *v)
+{
+	lgl__glCaptureBegin(493);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureData(v, v ? (size_t)(2 * sizeof(*v)) : 0);
+}
+
+static void lgl__glCapture_glVertexAttribL3dv(GLuint index, const GLdouble *v)
+{
+	lgl__glCaptureBegin(494);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureData(v, v ? (size_t)(3 * sizeof(*v)) : 0);
+}
+
+static void lgl__glCapture_glVertexAttribL4dv(GLuint index, const GLdouble *v)
+{
+	lgl__glCaptureBegin(495);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureData(v, v ? (size_t)(4 * sizeof(*v)) : 0);
+}
+
+static void lgl__glCapture_glVertexAttribLPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer)
+{
+	lgl__glCaptureBegin(496);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&size, sizeof(size));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureValue(&stride, sizeof(stride));
+	lgl__glCaptureOffset(pointer);
+}
+
+static void lgl__glCapture_glGetVertexAttribLdv(GLuint index, GLenum pname, GLdouble *params)
+{
+	lgl__glCaptureBegin(497);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glViewportArrayv(GLuint first, GLsizei count, const GLfloat *v)
+{
+	lgl__glCaptureBegin(498);
+	lgl__glCaptureValue(&first, sizeof(first));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureData(v, v ? (size_t)(count * 4 * sizeof(*v)) : 0);
+}
+
+static void lgl__glCapture_glViewportIndexedf(GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h)
+{
+	lgl__glCaptureBegin(499);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&x, sizeof(x));
+	lgl__glCaptureValue(&y, sizeof(y));
+	lgl__glCaptureValue(&w, sizeof(w));
+	lgl__glCaptureValue(&h, sizeof(h));
+}
+
+static void lgl__glCapture_glViewportIndexedfv(GLuint index, const GLfloat *v)
+{
+	lgl__glCaptureBegin(500);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureData(v, v ? (size_t)(4 * sizeof(*v)) : 0);
+}
+
+static void lgl__glCapture_glScissorArrayv(GLuint first, GLsizei count, const GLint *v)
+{
+	lgl__glCaptureBegin(501);
+	lgl__glCaptureValue(&first, sizeof(first));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureData(v, v ? (size_t)(count * 4 * sizeof(*v)) : 0);
+}
+
+static void lgl__glCapture_glScissorIndexed(GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height)
+{
+	lgl__glCaptureBegin(502);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&left, sizeof(left));
+	lgl__glCaptureValue(&bottom, sizeof(bottom));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&height, sizeof(height));
+}
+
+static void lgl__glCapture_glScissorIndexedv(GLuint index, const GLint *v)
+{
+	lgl__glCaptureBegin(503);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureData(v, v ? (size_t)(4 * sizeof(*v)) : 0);
+}
+
+static void lgl__glCapture_glDepthRangeArrayv(GLuint first, GLsizei count, const GLdouble *v)
+{
+	lgl__glCaptureBegin(504);
+	lgl__glCaptureValue(&first, sizeof(first));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureData(v, v ? (size_t)(count * 2 * sizeof(*v)) : 0);
+}
+
+static void lgl__glCapture_glDepthRangeIndexed(GLuint index, GLdouble n, GLdouble f)
+{
+	lgl__glCaptureBegin(505);
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&n, sizeof(n));
+	lgl__glCaptureValue(&f, sizeof(f));
+}
+
+static void lgl__glCapture_glGetFloati_v(GLenum target, GLuint index, GLfloat *data)
+{
+	lgl__glCaptureBegin(506);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&index, sizeof(index));
+	(void)data;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetDoublei_v(GLenum target, GLuint index, GLdouble *data)
+{
+	lgl__glCaptureBegin(507);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&index, sizeof(index));
+	(void)data;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glDrawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance)
+{
+	lgl__glCaptureBegin(508);
+	lgl__glCaptureValue(&mode, sizeof(mode));
+	lgl__glCaptureValue(&first, sizeof(first));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureValue(&instancecount, sizeof(instancecount));
+	lgl__glCaptureValue(&baseinstance, sizeof(baseinstance));
+}
+
+static void lgl__glCapture_glDrawElementsInstancedBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance)
+{
+	lgl__glCaptureBegin(509);
+	lgl__glCaptureValue(&mode, sizeof(mode));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureOffset(indices);
+	lgl__glCaptureValue(&instancecount, sizeof(instancecount));
+	lgl__glCaptureValue(&baseinstance, sizeof(baseinstance));
+}
+
+static void lgl__glCapture_glDrawElementsInstancedBaseVertexBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance)
+{
+	lgl__glCaptureBegin(510);
+	lgl__glCaptureValue(&mode, sizeof(mode));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureOffset(indices);
+	lgl__glCaptureValue(&instancecount, sizeof(instancecount));
+	lgl__glCaptureValue(&basevertex, sizeof(basevertex));
+	lgl__glCaptureValue(&baseinstance, sizeof(baseinstance));
+}
+
+static void lgl__glCapture_glGetInternalformativ(GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint *params)
+{
+	lgl__glCaptureBegin(511);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&internalformat, sizeof(internalformat));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	lgl__glCaptureValue(&count, sizeof(count));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetActiveAtomicCounterBufferiv(GLuint program, GLuint bufferIndex, GLenum pname, GLint *params)
+{
+	lgl__glCaptureBegin(512);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&bufferIndex, sizeof(bufferIndex));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glBindImageTexture(GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format)
+{
+	lgl__glCaptureBegin(513);
+	lgl__glCaptureValue(&unit, sizeof(unit));
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&level, sizeof(level));
+	lgl__glCaptureValue(&layered, sizeof(layered));
+	lgl__glCaptureValue(&layer, sizeof(layer));
+	lgl__glCaptureValue(&access, sizeof(access));
+	lgl__glCaptureValue(&format, sizeof(format));
+}
+
+static void lgl__glCapture_glMemoryBarrier(GLbitfield barriers)
+{
+	lgl__glCaptureBegin(514);
+	lgl__glCaptureValue(&barriers, sizeof(barriers));
+}
+
+static void lgl__glCapture_glTexStorage1D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width)
+{
+	lgl__glCaptureBegin(515);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&levels, sizeof(levels));
+	lgl__glCaptureValue(&internalformat, sizeof(internalformat));
+	lgl__glCaptureValue(&width, sizeof(width));
+}
+
+static void lgl__glCapture_glTexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height)
+{
+	lgl__glCaptureBegin(516);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&levels, sizeof(levels));
+	lgl__glCaptureValue(&internalformat, sizeof(internalformat));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&height, sizeof(height));
+}
+
+static void lgl__glCapture_glTexStorage3D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth)
+{
+	lgl__glCaptureBegin(517);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&levels, sizeof(levels));
+	lgl__glCaptureValue(&internalformat, sizeof(internalformat));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&height, sizeof(height));
+	lgl__glCaptureValue(&depth, sizeof(depth));
+}
+
+static void lgl__glCapture_glDrawTransformFeedbackInstanced(GLenum mode, GLuint id, GLsizei instancecount)
+{
+	lgl__glCaptureBegin(518);
+	lgl__glCaptureValue(&mode, sizeof(mode));
+	lgl__glCaptureValue(&id, sizeof(id));
+	lgl__glCaptureValue(&instancecount, sizeof(instancecount));
+}
+
+static void lgl__glCapture_glDrawTransformFeedbackStreamInstanced(GLenum mode, GLuint id, GLuint stream, GLsizei instancecount)
+{
+	lgl__glCaptureBegin(519);
+	lgl__glCaptureValue(&mode, sizeof(mode));
+	lgl__glCaptureValue(&id, sizeof(id));
+	lgl__glCaptureValue(&stream, sizeof(stream));
+	lgl__glCaptureValue(&instancecount, sizeof(instancecount));
+}
+
+static void lgl__glCapture_glClearBufferData(GLenum target, GLenum internalformat, GLenum format, GLenum type, const void *data)
+{
+	lgl__glCaptureBegin(520);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&internalformat, sizeof(internalformat));
+	lgl__glCaptureValue(&format, sizeof(format));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureData(data, data ? (size_t)(lgl__glCaptureTexelBytes(format, type)) : 0);
+}
+
+static void lgl__glCapture_glClearBufferSubData(GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data)
+{
+	lgl__glCaptureBegin(521);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&internalformat, sizeof(internalformat));
+	lgl__glCaptureValue(&offset, sizeof(offset));
+	lgl__glCaptureValue(&size, sizeof(size));
+	lgl__glCaptureValue(&format, sizeof(format));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureData(data, data ? (size_t)(lgl__glCaptureTexelBytes(format, type)) : 0);
+}
+
+static void lgl__glCapture_glDispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z)
+{
+	lgl__glCaptureBegin(522);
+	lgl__glCaptureValue(&num_groups_x, sizeof(num_groups_x));
+	lgl__glCaptureValue(&num_groups_y, sizeof(num_groups_y));
+	lgl__glCaptureValue(&num_groups_z, sizeof(num_groups_z));
+}
+
+static void lgl__glCapture_glDispatchComputeIndirect(GLintptr indirect)
+{
+	lgl__glCaptureBegin(523);
+	lgl__glCaptureValue(&indirect, sizeof(indirect));
+}
+
+static void lgl__glCapture_glCopyImageSubData(GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth)
+{
+	lgl__glCaptureBegin(524);
+	lgl__glCaptureValue(&srcName, sizeof(srcName));
+	lgl__glCaptureValue(&srcTarget, sizeof(srcTarget));
+	lgl__glCaptureValue(&srcLevel, sizeof(srcLevel));
+	lgl__glCaptureValue(&srcX, sizeof(srcX));
+	lgl__glCaptureValue(&srcY, sizeof(srcY));
+	lgl__glCaptureValue(&srcZ, sizeof(srcZ));
+	lgl__glCaptureValue(&dstName, sizeof(dstName));
+	lgl__glCaptureValue(&dstTarget, sizeof(dstTarget));
+	lgl__glCaptureValue(&dstLevel, sizeof(dstLevel));
+	lgl__glCaptureValue(&dstX, sizeof(dstX));
+	lgl__glCaptureValue(&dstY, sizeof(dstY));
+	lgl__glCaptureValue(&dstZ, sizeof(dstZ));
+	lgl__glCaptureValue(&srcWidth, sizeof(srcWidth));
+	lgl__glCaptureValue(&srcHeight, sizeof(srcHeight));
+	lgl__glCaptureValue(&srcDepth, sizeof(srcDepth));
+}
+
+static void lgl__glCapture_glFramebufferParameteri(GLenum target, GLenum pname, GLint param)
+{
+	lgl__glCaptureBegin(525);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	lgl__glCaptureValue(&param, sizeof(param));
+}
+
+static void lgl__glCapture_glGetFramebufferParameteriv(GLenum target, GLenum pname, GLint *params)
+{
+	lgl__glCaptureBegin(526);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetInternalformati64v(GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint64 *params)
+{
+	lgl__glCaptureBegin(527);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&internalformat, sizeof(internalformat));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	lgl__glCaptureValue(&count, sizeof(count));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glInvalidateTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth)
+{
+	lgl__glCaptureBegin(528);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&level, sizeof(level));
+	lgl__glCaptureValue(&xoffset, sizeof(xoffset));
+	lgl__glCaptureValue(&yoffset, sizeof(yoffset));
+	lgl__glCaptureValue(&zoffset, sizeof(zoffset));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&height, sizeof(height));
+	lgl__glCaptureValue(&depth, sizeof(depth));
+}
+
+static void lgl__glCapture_glInvalidateTexImage(GLuint texture, GLint level)
+{
+	lgl__glCaptureBegin(529);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&level, sizeof(level));
+}
+
+static void lgl__glCapture_glInvalidateBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr length)
+{
+	lgl__glCaptureBegin(530);
+	lgl__glCaptureValue(&buffer, sizeof(buffer));
+	lgl__glCaptureValue(&offset, sizeof(offset));
+	lgl__glCaptureValue(&length, sizeof(length));
+}
+
+static void lgl__glCapture_glInvalidateBufferData(GLuint buffer)
+{
+	lgl__glCaptureBegin(531);
+	lgl__glCaptureValue(&buffer, sizeof(buffer));
+}
+
+static void lgl__glCapture_glInvalidateFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments)
+{
+	lgl__glCaptureBegin(532);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&numAttachments, sizeof(numAttachments));
+	lgl__glCaptureData(attachments, attachments ? (size_t)(numAttachments * sizeof(*attachments)) : 0);
+}
+
+static void lgl__glCapture_glInvalidateSubFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+	lgl__glCaptureBegin(533);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&numAttachments, sizeof(numAttachments));
+	lgl__glCaptureData(attachments, attachments ? (size_t)(numAttachments * sizeof(*attachments)) : 0);
+	lgl__glCaptureValue(&x, sizeof(x));
+	lgl__glCaptureValue(&y, sizeof(y));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&height, sizeof(height));
+}
+
+static void lgl__glCapture_glMultiDrawArraysIndirect(GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride)
+{
+	lgl__glCaptureBegin(534);
+	lgl__glCaptureValue(&mode, sizeof(mode));
+	lgl__glCaptureOffset(indirect);
+	lgl__glCaptureValue(&drawcount, sizeof(drawcount));
+	lgl__glCaptureValue(&stride, sizeof(stride));
+}
+
+static void lgl__glCapture_glMultiDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride)
+{
+	lgl__glCaptureBegin(535);
+	lgl__glCaptureValue(&mode, sizeof(mode));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureOffset(indirect);
+	lgl__glCaptureValue(&drawcount, sizeof(drawcount));
+	lgl__glCaptureValue(&stride, sizeof(stride));
+}
+
+static void lgl__glCapture_glGetProgramInterfaceiv(GLuint program, GLenum programInterface, GLenum pname, GLint *params)
+{
+	lgl__glCaptureBegin(536);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&programInterface, sizeof(programInterface));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetProgramResourceIndex(GLuint program, GLenum programInterface, const GLchar *name, GLuint lgl__result)
+{
+	lgl__glCaptureBegin(537);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&programInterface, sizeof(programInterface));
+	lgl__glCaptureData(name, name ? (size_t)(lgl__glCaptureStringBytes(name, -1)) : 0);
+	lgl__glCaptureValue(&lgl__result, sizeof(lgl__result));
+}
+
+static void lgl__glCapture_glGetProgramResourceName(GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name)
+{
+	lgl__glCaptureBegin(538);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&programInterface, sizeof(programInterface));
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&bufSize, sizeof(bufSize));
+	(void)length;
+	lgl__glCaptureOutput((size_t)(sizeof(*length)));
+	(void)name;
+	lgl__glCaptureOutput((size_t)(bufSize * sizeof(*name)));
+}
+
+static void lgl__glCapture_glGetProgramResourceiv(GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum *props, GLsizei count, GLsizei *length, GLint *params)
+{
+	lgl__glCaptureBegin(539);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&programInterface, sizeof(programInterface));
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&propCount, sizeof(propCount));
+	lgl__glCaptureData(props, props ? (size_t)(propCount * sizeof(*props)) : 0);
+	lgl__glCaptureValue(&count, sizeof(count));
+	(void)length;
+	lgl__glCaptureOutput((size_t)(sizeof(*length)));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetProgramResourceLocation(GLuint program, GLenum programInterface, const GLchar *name, GLint lgl__result)
+{
+	lgl__glCaptureBegin(540);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&programInterface, sizeof(programInterface));
+	lgl__glCaptureData(name, name ? (size_t)(lgl__glCaptureStringBytes(name, -1)) : 0);
+	lgl__glCaptureValue(&lgl__result, sizeof(lgl__result));
+}
+
+static void lgl__glCapture_glGetProgramResourceLocationIndex(GLuint program, GLenum programInterface, const GLchar *name, GLint lgl__result)
+{
+	lgl__glCaptureBegin(541);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&programInterface, sizeof(programInterface));
+	lgl__glCaptureData(name, name ? (size_t)(lgl__glCaptureStringBytes(name, -1)) : 0);
+	lgl__glCaptureValue(&lgl__result, sizeof(lgl__result));
+}
+
+static void lgl__glCapture_glShaderStorageBlockBinding(GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding)
+{
+	lgl__glCaptureBegin(542);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&storageBlockIndex, sizeof(storageBlockIndex));
+	lgl__glCaptureValue(&storageBlockBinding, sizeof(storageBlockBinding));
+}
+
+static void lgl__glCapture_glTexBufferRange(GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+	lgl__glCaptureBegin(543);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&internalformat, sizeof(internalformat));
+	lgl__glCaptureValue(&buffer, sizeof(buffer));
+	lgl__glCaptureValue(&offset, sizeof(offset));
+	lgl__glCaptureValue(&size, sizeof(size));
+}
+
+static void lgl__glCapture_glTexStorage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
+{
+	lgl__glCaptureBegin(544);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&samples, sizeof(samples));
+	lgl__glCaptureValue(&internalformat, sizeof(internalformat));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&height, sizeof(height));
+	lgl__glCaptureValue(&fixedsamplelocations, sizeof(fixedsamplelocations));
+}
+
+static void lgl__glCapture_glTexStorage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
+{
+	lgl__glCaptureBegin(545);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&samples, sizeof(samples));
+	lgl__glCaptureValue(&internalformat, sizeof(internalformat));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&height, sizeof(height));
+	lgl__glCaptureValue(&depth, sizeof(depth));
+	lgl__glCaptureValue(&fixedsamplelocations, sizeof(fixedsamplelocations));
+}
+
+static void lgl__glCapture_glTextureView(GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers)
+{
+	lgl__glCaptureBegin(546);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&origtexture, sizeof(origtexture));
+	lgl__glCaptureValue(&internalformat, sizeof(internalformat));
+	lgl__glCaptureValue(&minlevel, sizeof(minlevel));
+	lgl__glCaptureValue(&numlevels, sizeof(numlevels));
+	lgl__glCaptureValue(&minlayer, sizeof(minlayer));
+	lgl__glCaptureValue(&numlayers, sizeof(numlayers));
+}
+
+static void lgl__glCapture_glBindVertexBuffer(GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride)
+{
+	lgl__glCaptureBegin(547);
+	lgl__glCaptureValue(&bindingindex, sizeof(bindingindex));
+	lgl__glCaptureValue(&buffer, sizeof(buffer));
+	lgl__glCaptureValue(&offset, sizeof(offset));
+	lgl__glCaptureValue(&stride, sizeof(stride));
+}
+
+static void lgl__glCapture_glVertexAttribFormat(GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset)
+{
+	lgl__glCaptureBegin(548);
+	lgl__glCaptureValue(&attribindex, sizeof(attribindex));
+	lgl__glCaptureValue(&size, sizeof(size));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureValue(&normalized, sizeof(normalized));
+	lgl__glCaptureValue(&relativeoffset, sizeof(relativeoffset));
+}
+
+static void lgl__glCapture_glVertexAttribIFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+	lgl__glCaptureBegin(549);
+	lgl__glCaptureValue(&attribindex, sizeof(attribindex));
+	lgl__glCaptureValue(&size, sizeof(size));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureValue(&relativeoffset, sizeof(relativeoffset));
+}
+
+static void lgl__glCapture_glVertexAttribLFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+	lgl__glCaptureBegin(550);
+	lgl__glCaptureValue(&attribindex, sizeof(attribindex));
+	lgl__glCaptureValue(&size, sizeof(size));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureValue(&relativeoffset, sizeof(relativeoffset));
+}
+
+static void lgl__glCapture_glVertexAttribBinding(GLuint attribindex, GLuint bindingindex)
+{
+	lgl__glCaptureBegin(551);
+	lgl__glCaptureValue(&attribindex, sizeof(attribindex));
+	lgl__glCaptureValue(&bindingindex, sizeof(bindingindex));
+}
+
+static void lgl__glCapture_glVertexBindingDivisor(GLuint bindingindex, GLuint divisor)
+{
+	lgl__glCaptureBegin(552);
+	lgl__glCaptureValue(&bindingindex, sizeof(bindingindex));
+	lgl__glCaptureValue(&divisor, sizeof(divisor));
+}
+
+static void lgl__glCapture_glDebugMessageControl(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled)
+{
+	lgl__glCaptureBegin(553);
+	lgl__glCaptureValue(&source, sizeof(source));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureValue(&severity, sizeof(severity));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureData(ids, ids ? (size_t)(count * sizeof(*ids)) : 0);
+	lgl__glCaptureValue(&enabled, sizeof(enabled));
+}
+
+static void lgl__glCapture_glDebugMessageInsert(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf)
+{
+	lgl__glCaptureBegin(554);
+	lgl__glCaptureValue(&source, sizeof(source));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureValue(&id, sizeof(id));
+	lgl__glCaptureValue(&severity, sizeof(severity));
+	lgl__glCaptureValue(&length, sizeof(length));
+	lgl__glCaptureData(buf, buf ? (size_t)(lgl__glCaptureStringBytes(buf, length)) : 0);
+}
+
+static void lgl__glCapture_glDebugMessageCallback(GLDEBUGPROC callback, const void *userParam)
+{
+	lgl__glCaptureBegin(555);
+	(void)callback;
+	lgl__glCaptureData(NULL, 0);
+	(void)userParam;
+	lgl__glCaptureData(NULL, 0);
+}
+
+static void lgl__glCapture_glGetDebugMessageLog(GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog, GLuint lgl__result)
+{
+	lgl__glCaptureBegin(556);
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureValue(&bufSize, sizeof(bufSize));
+	(void)sources;
+	lgl__glCaptureOutput((size_t)(bufSize * sizeof(*sources)));
+	(void)types;
+	lgl__glCaptureOutput((size_t)(bufSize * sizeof(*types)));
+	(void)ids;
+	lgl__glCaptureOutput((size_t)(bufSize * sizeof(*ids)));
+	(void)severities;
+	lgl__glCaptureOutput((size_t)(bufSize * sizeof(*severities)));
+	(void)lengths;
+	lgl__glCaptureOutput((size_t)(bufSize * sizeof(*lengths)));
+	(void)messageLog;
+	lgl__glCaptureOutput((size_t)(bufSize * sizeof(*messageLog)));
+	lgl__glCaptureValue(&lgl__result, sizeof(lgl__result));
+}
+
+static void lgl__glCapture_glPushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar *message)
+{
+	lgl__glCaptureBegin(557);
+	lgl__glCaptureValue(&source, sizeof(source));
+	lgl__glCaptureValue(&id, sizeof(id));
+	lgl__glCaptureValue(&length, sizeof(length));
+	lgl__glCaptureData(message, message ? (size_t)(lgl__glCaptureStringBytes(message, length)) : 0);
+}
+
+static void lgl__glCapture_glPopDebugGroup(void)
+{
+	lgl__glCaptureBegin(558);
+}
+
+static void lgl__glCapture_glObjectLabel(GLenum identifier, GLuint name, GLsizei length, const GLchar *label)
+{
+	lgl__glCaptureBegin(559);
+	lgl__glCaptureValue(&identifier, sizeof(identifier));
+	lgl__glCaptureValue(&name, sizeof(name));
+	lgl__glCaptureValue(&length, sizeof(length));
+	lgl__glCaptureData(label, label ? (size_t)(lgl__glCaptureStringBytes(label, length)) : 0);
+}
+
+static void lgl__glCapture_glGetObjectLabel(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label)
+{
+	lgl__glCaptureBegin(560);
+	lgl__glCaptureValue(&identifier, sizeof(identifier));
+	lgl__glCaptureValue(&name, sizeof(name));
+	lgl__glCaptureValue(&bufSize, sizeof(bufSize));
+	(void)length;
+	lgl__glCaptureOutput((size_t)(sizeof(*length)));
+	(void)label;
+	lgl__glCaptureOutput((size_t)(bufSize * sizeof(*label)));
+}
+
+static void lgl__glCapture_glObjectPtrLabel(const void *ptr, GLsizei length, const GLchar *label)
+{
+	lgl__glCaptureBegin(561);
+	lgl__glCaptureSync(ptr);
+	lgl__glCaptureValue(&length, sizeof(length));
+	lgl__glCaptureData(label, label ? (size_t)(lgl__glCaptureStringBytes(label, length)) : 0);
+}
+
+static void lgl__glCapture_glGetObjectPtrLabel(const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label)
+{
+	lgl__glCaptureBegin(562);
+	lgl__glCaptureSync(ptr);
+	lgl__glCaptureValue(&bufSize, sizeof(bufSize));
+	(void)length;
+	lgl__glCaptureOutput((size_t)(sizeof(*length)));
+	(void)label;
+	lgl__glCaptureOutput((size_t)(bufSize * sizeof(*label)));
+}
+
+static void lgl__glCapture_glGetPointerv(GLenum pname, void **params)
+{
+	lgl__glCaptureBegin(563);
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glBufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags)
+{
+	lgl__glCaptureBegin(564);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&size, sizeof(size));
+	lgl__glCaptureData(data, data ? (size_t)(size) : 0);
+	lgl__glCaptureValue(&flags, sizeof(flags));
+}
+
+static void lgl__glCapture_glClearTexImage(GLuint texture, GLint level, GLenum format, GLenum type, const void *data)
+{
+	lgl__glCaptureBegin(565);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&level, sizeof(level));
+	lgl__glCaptureValue(&format, sizeof(format));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureData(data, data ? (size_t)(lgl__glCaptureTexelBytes(format, type)) : 0);
+}
+
+static void lgl__glCapture_glClearTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *data)
+{
+	lgl__glCaptureBegin(566);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&level, sizeof(level));
+	lgl__glCaptureValue(&xoffset, sizeof(xoffset));
+	lgl__glCaptureValue(&yoffset, sizeof(yoffset));
+	lgl__glCaptureValue(&zoffset, sizeof(zoffset));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&height, sizeof(height));
+	lgl__glCaptureValue(&depth, sizeof(depth));
+	lgl__glCaptureValue(&format, sizeof(format));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureData(data, data ? (size_t)(lgl__glCaptureTexelBytes(format, type)) : 0);
+}
+
+static void lgl__glCapture_glBindBuffersBase(GLenum target, GLuint first, GLsizei count, const GLuint *buffers)
+{
+	lgl__glCaptureBegin(567);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&first, sizeof(first));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureData(buffers, buffers ? (size_t)(count * sizeof(*buffers)) : 0);
+}
+
+static void lgl__glCapture_glBindBuffersRange(GLenum target, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizeiptr *sizes)
+{
+	lgl__glCaptureBegin(568);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&first, sizeof(first));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureData(buffers, buffers ? (size_t)(count * sizeof(*buffers)) : 0);
+	lgl__glCaptureData(offsets, offsets ? (size_t)(count * sizeof(*offsets)) : 0);
+	lgl__glCaptureData(sizes, sizes ? (size_t)(count * sizeof(*sizes)) : 0);
+}
+
+static void lgl__glCapture_glBindTextures(GLuint first, GLsizei count, const GLuint *textures)
+{
+	lgl__glCaptureBegin(569);
+	lgl__glCaptureValue(&first, sizeof(first));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureData(textures, textures ? (size_t)(count * sizeof(*textures)) : 0);
+}
+
+static void lgl__glCapture_glBindSamplers(GLuint first, GLsizei count, const GLuint *samplers)
+{
+	lgl__glCaptureBegin(570);
+	lgl__glCaptureValue(&first, sizeof(first));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureData(samplers, samplers ? (size_t)(count * sizeof(*samplers)) : 0);
+}
+
+static void lgl__glCapture_glBindImageTextures(GLuint first, GLsizei count, const GLuint *textures)
+{
+	lgl__glCaptureBegin(571);
+	lgl__glCaptureValue(&first, sizeof(first));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureData(textures, textures ? (size_t)(count * sizeof(*textures)) : 0);
+}
+
+static void lgl__glCapture_glBindVertexBuffers(GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides)
+{
+	lgl__glCaptureBegin(572);
+	lgl__glCaptureValue(&first, sizeof(first));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureData(buffers, buffers ? (size_t)(count * sizeof(*buffers)) : 0);
+	lgl__glCaptureData(offsets, offsets ? (size_t)(count * sizeof(*offsets)) : 0);
+	lgl__glCaptureData(strides, strides ? (size_t)(count * sizeof(*strides)) : 0);
+}
+
+static void lgl__glCapture_glClipControl(GLenum origin, GLenum depth)
+{
+	lgl__glCaptureBegin(573);
+	lgl__glCaptureValue(&origin, sizeof(origin));
+	lgl__glCaptureValue(&depth, sizeof(depth));
+}
+
+static void lgl__glCapture_glCreateTransformFeedbacks(GLsizei n, GLuint *ids)
+{
+	lgl__glCaptureBegin(574);
+	lgl__glCaptureValue(&n, sizeof(n));
+	lgl__glCaptureRecord(ids, (size_t)(n * sizeof(GLuint)));
+}
+
+static void lgl__glCapture_glTransformFeedbackBufferBase(GLuint xfb, GLuint index, GLuint buffer)
+{
+	lgl__glCaptureBegin(575);
+	lgl__glCaptureValue(&xfb, sizeof(xfb));
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&buffer, sizeof(buffer));
+}
+
+static void lgl__glCapture_glTransformFeedbackBufferRange(GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+	lgl__glCaptureBegin(576);
+	lgl__glCaptureValue(&xfb, sizeof(xfb));
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&buffer, sizeof(buffer));
+	lgl__glCaptureValue(&offset, sizeof(offset));
+	lgl__glCaptureValue(&size, sizeof(size));
+}
+
+static void lgl__glCapture_glGetTransformFeedbackiv(GLuint xfb, GLenum pname, GLint *param)
+{
+	lgl__glCaptureBegin(577);
+	lgl__glCaptureValue(&xfb, sizeof(xfb));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)param;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetTransformFeedbacki_v(GLuint xfb, GLenum pname, GLuint index, GLint *param)
+{
+	lgl__glCaptureBegin(578);
+	lgl__glCaptureValue(&xfb, sizeof(xfb));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	lgl__glCaptureValue(&index, sizeof(index));
+	(void)param;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetTransformFeedbacki64_v(GLuint xfb, GLenum pname, GLuint index, GLint64 *param)
+{
+	lgl__glCaptureBegin(579);
+	lgl__glCaptureValue(&xfb, sizeof(xfb));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	lgl__glCaptureValue(&index, sizeof(index));
+	(void)param;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glCreateBuffers(GLsizei n, GLuint *buffers)
+{
+	lgl__glCaptureBegin(580);
+	lgl__glCaptureValue(&n, sizeof(n));
+	lgl__glCaptureRecord(buffers, (size_t)(n * sizeof(GLuint)));
+}
+
+static void lgl__glCapture_glNamedBufferStorage(GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags)
+{
+	lgl__glCaptureBegin(581);
+	lgl__glCaptureValue(&buffer, sizeof(buffer));
+	lgl__glCaptureValue(&size, sizeof(size));
+	lgl__glCaptureData(data, data ? (size_t)(size) : 0);
+	lgl__glCaptureValue(&flags, sizeof(flags));
+}
+
+static void lgl__glCapture_glNamedBufferData(GLuint buffer, GLsizeiptr size, const void *data, GLenum usage)
+{
+	lgl__glCaptureBegin(582);
+	lgl__glCaptureValue(&buffer, sizeof(buffer));
+	lgl__glCaptureValue(&size, sizeof(size));
+	lgl__glCaptureData(data, data ? (size_t)(size) : 0);
+	lgl__glCaptureValue(&usage, sizeof(usage));
+}
+
+static void lgl__glCapture_glNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data)
+{
+	lgl__glCaptureBegin(583);
+	lgl__glCaptureValue(&buffer, sizeof(buffer));
+	lgl__glCaptureValue(&offset, sizeof(offset));
+	lgl__glCaptureValue(&size, sizeof(size));
+	lgl__glCaptureData(data, data ? (size_t)(size) : 0);
+}
+
+static void lgl__glCapture_glCopyNamedBufferSubData(GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
+{
+	lgl__glCaptureBegin(584);
+	lgl__glCaptureValue(&readBuffer, sizeof(readBuffer));
+	lgl__glCaptureValue(&writeBuffer, sizeof(writeBuffer));
+	lgl__glCaptureValue(&readOffset, sizeof(readOffset));
+	lgl__glCaptureValue(&writeOffset, sizeof(writeOffset));
+	lgl__glCaptureValue(&size, sizeof(size));
+}
+
+static void lgl__glCapture_glClearNamedBufferData(GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data)
+{
+	lgl__glCaptureBegin(585);
+	lgl__glCaptureValue(&buffer, sizeof(buffer));
+	lgl__glCaptureValue(&internalformat, sizeof(internalformat));
+	lgl__glCaptureValue(&format, sizeof(format));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureData(data, data ? (size_t)(lgl__glCaptureTexelBytes(format, type)) : 0);
+}
+
+static void lgl__glCapture_glClearNamedBufferSubData(GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data)
+{
+	lgl__glCaptureBegin(586);
+	lgl__glCaptureValue(&buffer, sizeof(buffer));
+	lgl__glCaptureValue(&internalformat, sizeof(internalformat));
+	lgl__glCaptureValue(&offset, sizeof(offset));
+	lgl__glCaptureValue(&size, sizeof(size));
+	lgl__glCaptureValue(&format, sizeof(format));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureData(data, data ? (size_t)(lgl__glCaptureTexelBytes(format, type)) : 0);
+}
+
+static void lgl__glCapture_glMapNamedBuffer(GLuint buffer, GLenum access, void * lgl__result)
+{
+	lgl__glCaptureBegin(587);
+	lgl__glCaptureValue(&buffer, sizeof(buffer));
+	lgl__glCaptureValue(&access, sizeof(access));
+	(void)lgl__result;
+}
+
+static void lgl__glCapture_glMapNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access, void * lgl__result)
+{
+	lgl__glCaptureBegin(588);
+	lgl__glCaptureValue(&buffer, sizeof(buffer));
+	lgl__glCaptureValue(&offset, sizeof(offset));
+	lgl__glCaptureValue(&length, sizeof(length));
+	lgl__glCaptureValue(&access, sizeof(access));
+	(void)lgl__result;
+}
+
+static void lgl__glCapture_glUnmapNamedBuffer(GLuint buffer, GLboolean lgl__result)
+{
+	lgl__glCaptureBegin(589);
+	lgl__glCaptureValue(&buffer, sizeof(buffer));
+	lgl__glCaptureValue(&lgl__result, sizeof(lgl__result));
+}
+
+static void lgl__glCapture_glFlushMappedNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length)
+{
+	lgl__glCaptureBegin(590);
+	lgl__glCaptureValue(&buffer, sizeof(buffer));
+	lgl__glCaptureValue(&offset, sizeof(offset));
+	lgl__glCaptureValue(&length, sizeof(length));
+}
+
+static void lgl__glCapture_glGetNamedBufferParameteriv(GLuint buffer, GLenum pname, GLint *params)
+{
+	lgl__glCaptureBegin(591);
+	lgl__glCaptureValue(&buffer, sizeof(buffer));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetNamedBufferParameteri64v(GLuint buffer, GLenum pname, GLint64 *params)
+{
+	lgl__glCaptureBegin(592);
+	lgl__glCaptureValue(&buffer, sizeof(buffer));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetNamedBufferPointerv(GLuint buffer, GLenum pname, void **params)
+{
+	lgl__glCaptureBegin(593);
+	lgl__glCaptureValue(&buffer, sizeof(buffer));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, void *data)
+{
+	lgl__glCaptureBegin(594);
+	lgl__glCaptureValue(&buffer, sizeof(buffer));
+	lgl__glCaptureValue(&offset, sizeof(offset));
+	lgl__glCaptureValue(&size, sizeof(size));
+	(void)data;
+	lgl__glCaptureOutput((size_t)(size));
+}
+
+static void lgl__glCapture_glCreateFramebuffers(GLsizei n, GLuint *framebuffers)
+{
+	lgl__glCaptureBegin(595);
+	lgl__glCaptureValue(&n, sizeof(n));
+	lgl__glCaptureRecord(framebuffers, (size_t)(n * sizeof(GLuint)));
+}
+
+static void lgl__glCapture_glNamedFramebufferRenderbuffer(GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
+{
+	lgl__glCaptureBegin(596);
+	lgl__glCaptureValue(&framebuffer, sizeof(framebuffer));
+	lgl__glCaptureValue(&attachment, sizeof(attachment));
+	lgl__glCaptureValue(&renderbuffertarget, sizeof(renderbuffertarget));
+	lgl__glCaptureValue(&renderbuffer, sizeof(renderbuffer));
+}
+
+static void lgl__glCapture_glNamedFramebufferParameteri(GLuint framebuffer, GLenum pname, GLint param)
+{
+	lgl__glCaptureBegin(597);
+	lgl__glCaptureValue(&framebuffer, sizeof(framebuffer));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	lgl__glCaptureValue(&param, sizeof(param));
+}
+
+static void lgl__glCapture_glNamedFramebufferTexture(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level)
+{
+	lgl__glCaptureBegin(598);
+	lgl__glCaptureValue(&framebuffer, sizeof(framebuffer));
+	lgl__glCaptureValue(&attachment, sizeof(attachment));
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&level, sizeof(level));
+}
+
+static void lgl__glCapture_glNamedFramebufferTextureLayer(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer)
+{
+	lgl__glCaptureBegin(599);
+	lgl__glCaptureValue(&framebuffer, sizeof(framebuffer));
+	lgl__glCaptureValue(&attachment, sizeof(attachment));
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&level, sizeof(level));
+	lgl__glCaptureValue(&layer, sizeof(layer));
+}
+
+static void lgl__glCapture_glNamedFramebufferDrawBuffer(GLuint framebuffer, GLenum buf)
+{
+	lgl__glCaptureBegin(600);
+	lgl__glCaptureValue(&framebuffer, sizeof(framebuffer));
+	lgl__glCaptureValue(&buf, sizeof(buf));
+}
+
+static void lgl__glCapture_glNamedFramebufferDrawBuffers(GLuint framebuffer, GLsizei n, const GLenum *bufs)
+{
+	lgl__glCaptureBegin(601);
+	lgl__glCaptureValue(&framebuffer, sizeof(framebuffer));
+	lgl__glCaptureValue(&n, sizeof(n));
+	lgl__glCaptureData(bufs, bufs ? (size_t)(n * sizeof(*bufs)) : 0);
+}
+
+static void lgl__glCapture_glNamedFramebufferReadBuffer(GLuint framebuffer, GLenum src)
+{
+	lgl__glCaptureBegin(602);
+	lgl__glCaptureValue(&framebuffer, sizeof(framebuffer));
+	lgl__glCaptureValue(&src, sizeof(src));
+}
+
+static void lgl__glCapture_glInvalidateNamedFramebufferData(GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments)
+{
+	lgl__glCaptureBegin(603);
+	lgl__glCaptureValue(&framebuffer, sizeof(framebuffer));
+	lgl__glCaptureValue(&numAttachments, sizeof(numAttachments));
+	lgl__glCaptureData(attachments, attachments ? (size_t)(numAttachments * sizeof(*attachments)) : 0);
+}
+
+static void lgl__glCapture_glInvalidateNamedFramebufferSubData(GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+	lgl__glCaptureBegin(604);
+	lgl__glCaptureValue(&framebuffer, sizeof(framebuffer));
+	lgl__glCaptureValue(&numAttachments, sizeof(numAttachments));
+	lgl__glCaptureData(attachments, attachments ? (size_t)(numAttachments * sizeof(*attachments)) : 0);
+	lgl__glCaptureValue(&x, sizeof(x));
+	lgl__glCaptureValue(&y, sizeof(y));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&height, sizeof(height));
+}
+
+static void lgl__glCapture_glClearNamedFramebufferiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLint *value)
+{
+	lgl__glCaptureBegin(605);
+	lgl__glCaptureValue(&framebuffer, sizeof(framebuffer));
+	lgl__glCaptureValue(&buffer, sizeof(buffer));
+	lgl__glCaptureValue(&drawbuffer, sizeof(drawbuffer));
+	lgl__glCaptureData(value, value ? (size_t)((buffer == GL_COLOR ? 4 : 1) * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glClearNamedFramebufferuiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLuint *value)
+{
+	lgl__glCaptureBegin(606);
+	lgl__glCaptureValue(&framebuffer, sizeof(framebuffer));
+	lgl__glCaptureValue(&buffer, sizeof(buffer));
+	lgl__glCaptureValue(&drawbuffer, sizeof(drawbuffer));
+	lgl__glCaptureData(value, value ? (size_t)((buffer == GL_COLOR ? 4 : 1) * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glClearNamedFramebufferfv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat *value)
+{
+	lgl__glCaptureBegin(607);
+	lgl__glCaptureValue(&framebuffer, sizeof(framebuffer));
+	lgl__glCaptureValue(&buffer, sizeof(buffer));
+	lgl__glCaptureValue(&drawbuffer, sizeof(drawbuffer));
+	lgl__glCaptureData(value, value ? (size_t)((buffer == GL_COLOR ? 4 : 1) * sizeof(*value)) : 0);
+}
+
+static void lgl__glCapture_glClearNamedFramebufferfi(GLuint framebuffer, GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil)
+{
+	lgl__glCaptureBegin(608);
+	lgl__glCaptureValue(&framebuffer, sizeof(framebuffer));
+	lgl__glCaptureValue(&buffer, sizeof(buffer));
+	lgl__glCaptureValue(&drawbuffer, sizeof(drawbuffer));
+	lgl__glCaptureValue(&depth, sizeof(depth));
+	lgl__glCaptureValue(&stencil, sizeof(stencil));
+}
+
+static void lgl__glCapture_glBlitNamedFramebuffer(GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)
+{
+	lgl__glCaptureBegin(609);
+	lgl__glCaptureValue(&readFramebuffer, sizeof(readFramebuffer));
+	lgl__glCaptureValue(&drawFramebuffer, sizeof(drawFramebuffer));
+	lgl__glCaptureValue(&srcX0, sizeof(srcX0));
+	lgl__glCaptureValue(&srcY0, sizeof(srcY0));
+	lgl__glCaptureValue(&srcX1, sizeof(srcX1));
+	lgl__glCaptureValue(&srcY1, sizeof(srcY1));
+	lgl__glCaptureValue(&dstX0, sizeof(dstX0));
+	lgl__glCaptureValue(&dstY0, sizeof(dstY0));
+	lgl__glCaptureValue(&dstX1, sizeof(dstX1));
+	lgl__glCaptureValue(&dstY1, sizeof(dstY1));
+	lgl__glCaptureValue(&mask, sizeof(mask));
+	lgl__glCaptureValue(&filter, sizeof(filter));
+}
+
+static void lgl__glCapture_glCheckNamedFramebufferStatus(GLuint framebuffer, GLenum target, GLenum lgl__result)
+{
+	lgl__glCaptureBegin(610);
+	lgl__glCaptureValue(&framebuffer, sizeof(framebuffer));
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&lgl__result, sizeof(lgl__result));
+}
+
+static void lgl__glCapture_glGetNamedFramebufferParameteriv(GLuint framebuffer, GLenum pname, GLint *param)
+{
+	lgl__glCaptureBegin(611);
+	lgl__glCaptureValue(&framebuffer, sizeof(framebuffer));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)param;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetNamedFramebufferAttachmentParameteriv(GLuint framebuffer, GLenum attachment, GLenum pname, GLint *params)
+{
+	lgl__glCaptureBegin(612);
+	lgl__glCaptureValue(&framebuffer, sizeof(framebuffer));
+	lgl__glCaptureValue(&attachment, sizeof(attachment));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glCreateRenderbuffers(GLsizei n, GLuint *renderbuffers)
+{
+	lgl__glCaptureBegin(613);
+	lgl__glCaptureValue(&n, sizeof(n));
+	lgl__glCaptureRecord(renderbuffers, (size_t)(n * sizeof(GLuint)));
+}
+
+static void lgl__glCapture_glNamedRenderbufferStorage(GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height)
+{
+	lgl__glCaptureBegin(614);
+	lgl__glCaptureValue(&renderbuffer, sizeof(renderbuffer));
+	lgl__glCaptureValue(&internalformat, sizeof(internalformat));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&height, sizeof(height));
+}
+
+static void lgl__glCapture_glNamedRenderbufferStorageMultisample(GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)
+{
+	lgl__glCaptureBegin(615);
+	lgl__glCaptureValue(&renderbuffer, sizeof(renderbuffer));
+	lgl__glCaptureValue(&samples, sizeof(samples));
+	lgl__glCaptureValue(&internalformat, sizeof(internalformat));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&height, sizeof(height));
+}
+
+static void lgl__glCapture_glGetNamedRenderbufferParameteriv(GLuint renderbuffer, GLenum pname, GLint *params)
+{
+	lgl__glCaptureBegin(616);
+	lgl__glCaptureValue(&renderbuffer, sizeof(renderbuffer));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glCreateTextures(GLenum target, GLsizei n, GLuint *textures)
+{
+	lgl__glCaptureBegin(617);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&n, sizeof(n));
+	lgl__glCaptureRecord(textures, (size_t)(n * sizeof(GLuint)));
+}
+
+static void lgl__glCapture_glTextureBuffer(GLuint texture, GLenum internalformat, GLuint buffer)
+{
+	lgl__glCaptureBegin(618);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&internalformat, sizeof(internalformat));
+	lgl__glCaptureValue(&buffer, sizeof(buffer));
+}
+
+static void lgl__glCapture_glTextureBufferRange(GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+	lgl__glCaptureBegin(619);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&internalformat, sizeof(internalformat));
+	lgl__glCaptureValue(&buffer, sizeof(buffer));
+	lgl__glCaptureValue(&offset, sizeof(offset));
+	lgl__glCaptureValue(&size, sizeof(size));
+}
+
+static void lgl__glCapture_glTextureStorage1D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width)
+{
+	lgl__glCaptureBegin(620);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&levels, sizeof(levels));
+	lgl__glCaptureValue(&internalformat, sizeof(internalformat));
+	lgl__glCaptureValue(&width, sizeof(width));
+}
+
+static void lgl__glCapture_glTextureStorage2D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height)
+{
+	lgl__glCaptureBegin(621);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&levels, sizeof(levels));
+	lgl__glCaptureValue(&internalformat, sizeof(internalformat));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&height, sizeof(height));
+}
+
+static void lgl__glCapture_glTextureStorage3D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth)
+{
+	lgl__glCaptureBegin(622);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&levels, sizeof(levels));
+	lgl__glCaptureValue(&internalformat, sizeof(internalformat));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&height, sizeof(height));
+	lgl__glCaptureValue(&depth, sizeof(depth));
+}
+
+static void lgl__glCapture_glTextureStorage2DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
+{
+	lgl__glCaptureBegin(623);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&samples, sizeof(samples));
+	lgl__glCaptureValue(&internalformat, sizeof(internalformat));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&height, sizeof(height));
+	lgl__glCaptureValue(&fixedsamplelocations, sizeof(fixedsamplelocations));
+}
+
+static void lgl__glCapture_glTextureStorage3DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
+{
+	lgl__glCaptureBegin(624);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&samples, sizeof(samples));
+	lgl__glCaptureValue(&internalformat, sizeof(internalformat));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&height, sizeof(height));
+	lgl__glCaptureValue(&depth, sizeof(depth));
+	lgl__glCaptureValue(&fixedsamplelocations, sizeof(fixedsamplelocations));
+}
+
+static void lgl__glCapture_glTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels)
+{
+	lgl__glCaptureBegin(625);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&level, sizeof(level));
+	lgl__glCaptureValue(&xoffset, sizeof(xoffset));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&format, sizeof(format));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureUnpack(pixels, (size_t)(lgl__glCapturePixelBytes(width, 1, 1, format, type, 0)));
+}
+
+static void lgl__glCapture_glTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels)
+{
+	lgl__glCaptureBegin(626);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&level, sizeof(level));
+	lgl__glCaptureValue(&xoffset, sizeof(xoffset));
+	lgl__glCaptureValue(&yoffset, sizeof(yoffset));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&height, sizeof(height));
+	lgl__glCaptureValue(&format, sizeof(format));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureUnpack(pixels, (size_t)(lgl__glCapturePixelBytes(width, height, 1, format, type, 0)));
+}
+
+static void lgl__glCapture_glTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels)
+{
+	lgl__glCaptureBegin(627);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&level, sizeof(level));
+	lgl__glCaptureValue(&xoffset, sizeof(xoffset));
+	lgl__glCaptureValue(&yoffset, sizeof(yoffset));
+	lgl__glCaptureValue(&zoffset, sizeof(zoffset));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&height, sizeof(height));
+	lgl__glCaptureValue(&depth, sizeof(depth));
+	lgl__glCaptureValue(&format, sizeof(format));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureUnpack(pixels, (size_t)(lgl__glCapturePixelBytes(width, height, depth, format, type, 0)));
+}
+
+static void lgl__glCapture_glCompressedTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data)
+{
+	lgl__glCaptureBegin(628);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&level, sizeof(level));
+	lgl__glCaptureValue(&xoffset, sizeof(xoffset));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&format, sizeof(format));
+	lgl__glCaptureValue(&imageSize, sizeof(imageSize));
+	lgl__glCaptureUnpack(data, (size_t)(imageSize));
+}
+
+static void lgl__glCapture_glCompressedTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data)
+{
+	lgl__glCaptureBegin(629);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&level, sizeof(level));
+	lgl__glCaptureValue(&xoffset, sizeof(xoffset));
+	lgl__glCaptureValue(&yoffset, sizeof(yoffset));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&height, sizeof(height));
+	lgl__glCaptureValue(&format, sizeof(format));
+	lgl__glCaptureValue(&imageSize, sizeof(imageSize));
+	lgl__glCaptureUnpack(data, (size_t)(imageSize));
+}
+
+static void lgl__glCapture_glCompressedTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data)
+{
+	lgl__glCaptureBegin(630);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&level, sizeof(level));
+	lgl__glCaptureValue(&xoffset, sizeof(xoffset));
+	lgl__glCaptureValue(&yoffset, sizeof(yoffset));
+	lgl__glCaptureValue(&zoffset, sizeof(zoffset));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&height, sizeof(height));
+	lgl__glCaptureValue(&depth, sizeof(depth));
+	lgl__glCaptureValue(&format, sizeof(format));
+	lgl__glCaptureValue(&imageSize, sizeof(imageSize));
+	lgl__glCaptureUnpack(data, (size_t)(imageSize));
+}
+
+static void lgl__glCapture_glCopyTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width)
+{
+	lgl__glCaptureBegin(631);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&level, sizeof(level));
+	lgl__glCaptureValue(&xoffset, sizeof(xoffset));
+	lgl__glCaptureValue(&x, sizeof(x));
+	lgl__glCaptureValue(&y, sizeof(y));
+	lgl__glCaptureValue(&width, sizeof(width));
+}
+
+static void lgl__glCapture_glCopyTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+	lgl__glCaptureBegin(632);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&level, sizeof(level));
+	lgl__glCaptureValue(&xoffset, sizeof(xoffset));
+	lgl__glCaptureValue(&yoffset, sizeof(yoffset));
+	lgl__glCaptureValue(&x, sizeof(x));
+	lgl__glCaptureValue(&y, sizeof(y));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&height, sizeof(height));
+}
+
+static void lgl__glCapture_glCopyTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+	lgl__glCaptureBegin(633);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&level, sizeof(level));
+	lgl__glCaptureValue(&xoffset, sizeof(xoffset));
+	lgl__glCaptureValue(&yoffset, sizeof(yoffset));
+	lgl__glCaptureValue(&zoffset, sizeof(zoffset));
+	lgl__glCaptureValue(&x, sizeof(x));
+	lgl__glCaptureValue(&y, sizeof(y));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&height, sizeof(height));
+}
+
+static void lgl__glCapture_glTextureParameterf(GLuint texture, GLenum pname, GLfloat param)
+{
+	lgl__glCaptureBegin(634);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	lgl__glCaptureValue(&param, sizeof(param));
+}
+
+static void lgl__glCapture_glTextureParameterfv(GLuint texture, GLenum pname, const GLfloat *param)
+{
+	lgl__glCaptureBegin(635);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	lgl__glCaptureData(param, param ? (size_t)(lgl__glCaptureParamCount(pname) * sizeof(*param)) : 0);
+}
+
+static void lgl__glCapture_glTextureParameteri(GLuint texture, GLenum pname, GLint param)
+{
+	lgl__glCaptureBegin(636);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	lgl__glCaptureValue(&param, sizeof(param));
+}
+
+static void lgl__glCapture_glTextureParameterIiv(GLuint texture, GLenum pname, const GLint *params)
+{
+	lgl__glCaptureBegin(637);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	lgl__glCaptureData(params, params ? (size_t)(lgl__glCaptureParamCount(pname) * sizeof(*params)) : 0);
+}
+
+static void lgl__glCapture_glTextureParameterIuiv(GLuint texture, GLenum pname, const GLuint *params)
+{
+	lgl__glCaptureBegin(638);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	lgl__glCaptureData(params, params ? (size_t)(lgl__glCaptureParamCount(pname) * sizeof(*params)) : 0);
+}
+
+static void lgl__glCapture_glTextureParameteriv(GLuint texture, GLenum pname, const GLint *param)
+{
+	lgl__glCaptureBegin(639);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	lgl__glCaptureData(param, param ? (size_t)(lgl__glCaptureParamCount(pname) * sizeof(*param)) : 0);
+}
+
+static void lgl__glCapture_glGenerateTextureMipmap(GLuint texture)
+{
+	lgl__glCaptureBegin(640);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+}
+
+static void lgl__glCapture_glBindTextureUnit(GLuint unit, GLuint texture)
+{
+	lgl__glCaptureBegin(641);
+	lgl__glCaptureValue(&unit, sizeof(unit));
+	lgl__glCaptureValue(&texture, sizeof(texture));
+}
+
+static void lgl__glCapture_glGetTextureImage(GLuint texture, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels)
+{
+	lgl__glCaptureBegin(642);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&level, sizeof(level));
+	lgl__glCaptureValue(&format, sizeof(format));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureValue(&bufSize, sizeof(bufSize));
+	lgl__glCapturePack(pixels, (size_t)(bufSize));
+}
+
+static void lgl__glCapture_glGetCompressedTextureImage(GLuint texture, GLint level, GLsizei bufSize, void *pixels)
+{
+	lgl__glCaptureBegin(643);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&level, sizeof(level));
+	lgl__glCaptureValue(&bufSize, sizeof(bufSize));
+	lgl__glCapturePack(pixels, (size_t)(bufSize));
+}
+
+static void lgl__glCapture_glGetTextureLevelParameterfv(GLuint texture, GLint level, GLenum pname, GLfloat *params)
+{
+	lgl__glCaptureBegin(644);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&level, sizeof(level));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetTextureLevelParameteriv(GLuint texture, GLint level, GLenum pname, GLint *params)
+{
+	lgl__glCaptureBegin(645);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&level, sizeof(level));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetTextureParameterfv(GLuint texture, GLenum pname, GLfloat *params)
+{
+	lgl__glCaptureBegin(646);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetTextureParameterIiv(GLuint texture, GLenum pname, GLint *params)
+{
+	lgl__glCaptureBegin(647);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetTextureParameterIuiv(GLuint texture, GLenum pname, GLuint *params)
+{
+	lgl__glCaptureBegin(648);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetTextureParameteriv(GLuint texture, GLenum pname, GLint *params)
+{
+	lgl__glCaptureBegin(649);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glCreateVertexArrays(GLsizei n, GLuint *arrays)
+{
+	lgl__glCaptureBegin(650);
+	lgl__glCaptureValue(&n, sizeof(n));
+	lgl__glCaptureRecord(arrays, (size_t)(n * sizeof(GLuint)));
+}
+
+static void lgl__glCapture_glDisableVertexArrayAttrib(GLuint vaobj, GLuint index)
+{
+	lgl__glCaptureBegin(651);
+	lgl__glCaptureValue(&vaobj, sizeof(vaobj));
+	lgl__glCaptureValue(&index, sizeof(index));
+}
+
+static void lgl__glCapture_glEnableVertexArrayAttrib(GLuint vaobj, GLuint index)
+{
+	lgl__glCaptureBegin(652);
+	lgl__glCaptureValue(&vaobj, sizeof(vaobj));
+	lgl__glCaptureValue(&index, sizeof(index));
+}
+
+static void lgl__glCapture_glVertexArrayElementBuffer(GLuint vaobj, GLuint buffer)
+{
+	lgl__glCaptureBegin(653);
+	lgl__glCaptureValue(&vaobj, sizeof(vaobj));
+	lgl__glCaptureValue(&buffer, sizeof(buffer));
+}
+
+static void lgl__glCapture_glVertexArrayVertexBuffer(GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride)
+{
+	lgl__glCaptureBegin(654);
+	lgl__glCaptureValue(&vaobj, sizeof(vaobj));
+	lgl__glCaptureValue(&bindingindex, sizeof(bindingindex));
+	lgl__glCaptureValue(&buffer, sizeof(buffer));
+	lgl__glCaptureValue(&offset, sizeof(offset));
+	lgl__glCaptureValue(&stride, sizeof(stride));
+}
+
+static void lgl__glCapture_glVertexArrayVertexBuffers(GLuint vaobj, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides)
+{
+	lgl__glCaptureBegin(655);
+	lgl__glCaptureValue(&vaobj, sizeof(vaobj));
+	lgl__glCaptureValue(&first, sizeof(first));
+	lgl__glCaptureValue(&count, sizeof(count));
+	lgl__glCaptureData(buffers, buffers ? (size_t)(count * sizeof(*buffers)) : 0);
+	lgl__glCaptureData(offsets, offsets ? (size_t)(count * sizeof(*offsets)) : 0);
+	lgl__glCaptureData(strides, strides ? (size_t)(count * sizeof(*strides)) : 0);
+}
+
+static void lgl__glCapture_glVertexArrayAttribBinding(GLuint vaobj, GLuint attribindex, GLuint bindingindex)
+{
+	lgl__glCaptureBegin(656);
+	lgl__glCaptureValue(&vaobj, sizeof(vaobj));
+	lgl__glCaptureValue(&attribindex, sizeof(attribindex));
+	lgl__glCaptureValue(&bindingindex, sizeof(bindingindex));
+}
+
+static void lgl__glCapture_glVertexArrayAttribFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset)
+{
+	lgl__glCaptureBegin(657);
+	lgl__glCaptureValue(&vaobj, sizeof(vaobj));
+	lgl__glCaptureValue(&attribindex, sizeof(attribindex));
+	lgl__glCaptureValue(&size, sizeof(size));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureValue(&normalized, sizeof(normalized));
+	lgl__glCaptureValue(&relativeoffset, sizeof(relativeoffset));
+}
+
+static void lgl__glCapture_glVertexArrayAttribIFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+	lgl__glCaptureBegin(658);
+	lgl__glCaptureValue(&vaobj, sizeof(vaobj));
+	lgl__glCaptureValue(&attribindex, sizeof(attribindex));
+	lgl__glCaptureValue(&size, sizeof(size));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureValue(&relativeoffset, sizeof(relativeoffset));
+}
+
+static void lgl__glCapture_glVertexArrayAttribLFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+	lgl__glCaptureBegin(659);
+	lgl__glCaptureValue(&vaobj, sizeof(vaobj));
+	lgl__glCaptureValue(&attribindex, sizeof(attribindex));
+	lgl__glCaptureValue(&size, sizeof(size));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureValue(&relativeoffset, sizeof(relativeoffset));
+}
+
+static void lgl__glCapture_glVertexArrayBindingDivisor(GLuint vaobj, GLuint bindingindex, GLuint divisor)
+{
+	lgl__glCaptureBegin(660);
+	lgl__glCaptureValue(&vaobj, sizeof(vaobj));
+	lgl__glCaptureValue(&bindingindex, sizeof(bindingindex));
+	lgl__glCaptureValue(&divisor, sizeof(divisor));
+}
+
+static void lgl__glCapture_glGetVertexArrayiv(GLuint vaobj, GLenum pname, GLint *param)
+{
+	lgl__glCaptureBegin(661);
+	lgl__glCaptureValue(&vaobj, sizeof(vaobj));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)param;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetVertexArrayIndexediv(GLuint vaobj, GLuint index, GLenum pname, GLint *param)
+{
+	lgl__glCaptureBegin(662);
+	lgl__glCaptureValue(&vaobj, sizeof(vaobj));
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)param;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetVertexArrayIndexed64iv(GLuint vaobj, GLuint index, GLenum pname, GLint64 *param)
+{
+	lgl__glCaptureBegin(663);
+	lgl__glCaptureValue(&vaobj, sizeof(vaobj));
+	lgl__glCaptureValue(&index, sizeof(index));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	(void)param;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glCreateSamplers(GLsizei n, GLuint *samplers)
+{
+	lgl__glCaptureBegin(664);
+	lgl__glCaptureValue(&n, sizeof(n));
+	lgl__glCaptureRecord(samplers, (size_t)(n * sizeof(GLuint)));
+}
+
+static void lgl__glCapture_glCreateProgramPipelines(GLsizei n, GLuint *pipelines)
+{
+	lgl__glCaptureBegin(665);
+	lgl__glCaptureValue(&n, sizeof(n));
+	lgl__glCaptureRecord(pipelines, (size_t)(n * sizeof(GLuint)));
+}
+
+static void lgl__glCapture_glCreateQueries(GLenum target, GLsizei n, GLuint *ids)
+{
+	lgl__glCaptureBegin(666);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&n, sizeof(n));
+	lgl__glCaptureRecord(ids, (size_t)(n * sizeof(GLuint)));
+}
+
+static void lgl__glCapture_glGetQueryBufferObjecti64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+	lgl__glCaptureBegin(667);
+	lgl__glCaptureValue(&id, sizeof(id));
+	lgl__glCaptureValue(&buffer, sizeof(buffer));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	lgl__glCaptureValue(&offset, sizeof(offset));
+}
+
+static void lgl__glCapture_glGetQueryBufferObjectiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+	lgl__glCaptureBegin(668);
+	lgl__glCaptureValue(&id, sizeof(id));
+	lgl__glCaptureValue(&buffer, sizeof(buffer));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	lgl__glCaptureValue(&offset, sizeof(offset));
+}
+
+static void lgl__glCapture_glGetQueryBufferObjectui64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+	lgl__glCaptureBegin(669);
+	lgl__glCaptureValue(&id, sizeof(id));
+	lgl__glCaptureValue(&buffer, sizeof(buffer));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	lgl__glCaptureValue(&offset, sizeof(offset));
+}
+
+static void lgl__glCapture_glGetQueryBufferObjectuiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+	lgl__glCaptureBegin(670);
+	lgl__glCaptureValue(&id, sizeof(id));
+	lgl__glCaptureValue(&buffer, sizeof(buffer));
+	lgl__glCaptureValue(&pname, sizeof(pname));
+	lgl__glCaptureValue(&offset, sizeof(offset));
+}
+
+static void lgl__glCapture_glMemoryBarrierByRegion(GLbitfield barriers)
+{
+	lgl__glCaptureBegin(671);
+	lgl__glCaptureValue(&barriers, sizeof(barriers));
+}
+
+static void lgl__glCapture_glGetTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, GLsizei bufSize, void *pixels)
+{
+	lgl__glCaptureBegin(672);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&level, sizeof(level));
+	lgl__glCaptureValue(&xoffset, sizeof(xoffset));
+	lgl__glCaptureValue(&yoffset, sizeof(yoffset));
+	lgl__glCaptureValue(&zoffset, sizeof(zoffset));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&height, sizeof(height));
+	lgl__glCaptureValue(&depth, sizeof(depth));
+	lgl__glCaptureValue(&format, sizeof(format));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureValue(&bufSize, sizeof(bufSize));
+	lgl__glCapturePack(pixels, (size_t)(bufSize));
+}
+
+static void lgl__glCapture_glGetCompressedTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei bufSize, void *pixels)
+{
+	lgl__glCaptureBegin(673);
+	lgl__glCaptureValue(&texture, sizeof(texture));
+	lgl__glCaptureValue(&level, sizeof(level));
+	lgl__glCaptureValue(&xoffset, sizeof(xoffset));
+	lgl__glCaptureValue(&yoffset, sizeof(yoffset));
+	lgl__glCaptureValue(&zoffset, sizeof(zoffset));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&height, sizeof(height));
+	lgl__glCaptureValue(&depth, sizeof(depth));
+	lgl__glCaptureValue(&bufSize, sizeof(bufSize));
+	lgl__glCapturePack(pixels, (size_t)(bufSize));
+}
+
+static void lgl__glCapture_glGetGraphicsResetStatus(GLenum lgl__result)
+{
+	lgl__glCaptureBegin(674);
+	lgl__glCaptureValue(&lgl__result, sizeof(lgl__result));
+}
+
+static void lgl__glCapture_glGetnCompressedTexImage(GLenum target, GLint lod, GLsizei bufSize, void *pixels)
+{
+	lgl__glCaptureBegin(675);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&lod, sizeof(lod));
+	lgl__glCaptureValue(&bufSize, sizeof(bufSize));
+	lgl__glCapturePack(pixels, (size_t)(bufSize));
+}
+
+static void lgl__glCapture_glGetnTexImage(GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels)
+{
+	lgl__glCaptureBegin(676);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&level, sizeof(level));
+	lgl__glCaptureValue(&format, sizeof(format));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureValue(&bufSize, sizeof(bufSize));
+	lgl__glCapturePack(pixels, (size_t)(bufSize));
+}
+
+static void lgl__glCapture_glGetnUniformdv(GLuint program, GLint location, GLsizei bufSize, GLdouble *params)
+{
+	lgl__glCaptureBegin(677);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&bufSize, sizeof(bufSize));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(bufSize * sizeof(*params)));
+}
+
+static void lgl__glCapture_glGetnUniformfv(GLuint program, GLint location, GLsizei bufSize, GLfloat *params)
+{
+	lgl__glCaptureBegin(678);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&bufSize, sizeof(bufSize));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(bufSize * sizeof(*params)));
+}
+
+static void lgl__glCapture_glGetnUniformiv(GLuint program, GLint location, GLsizei bufSize, GLint *params)
+{
+	lgl__glCaptureBegin(679);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&bufSize, sizeof(bufSize));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(bufSize * sizeof(*params)));
+}
+
+static void lgl__glCapture_glGetnUniformuiv(GLuint program, GLint location, GLsizei bufSize, GLuint *params)
+{
+	lgl__glCaptureBegin(680);
+	lgl__glCaptureValue(&program, sizeof(program));
+	lgl__glCaptureValue(&location, sizeof(location));
+	lgl__glCaptureValue(&bufSize, sizeof(bufSize));
+	(void)params;
+	lgl__glCaptureOutput((size_t)(bufSize * sizeof(*params)));
+}
+
+static void lgl__glCapture_glReadnPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data)
+{
+	lgl__glCaptureBegin(681);
+	lgl__glCaptureValue(&x, sizeof(x));
+	lgl__glCaptureValue(&y, sizeof(y));
+	lgl__glCaptureValue(&width, sizeof(width));
+	lgl__glCaptureValue(&height, sizeof(height));
+	lgl__glCaptureValue(&format, sizeof(format));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureValue(&bufSize, sizeof(bufSize));
+	lgl__glCapturePack(data, (size_t)(bufSize));
+}
+
+static void lgl__glCapture_glGetnMapdv(GLenum target, GLenum query, GLsizei bufSize, GLdouble *v)
+{
+	lgl__glCaptureBegin(682);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&query, sizeof(query));
+	lgl__glCaptureValue(&bufSize, sizeof(bufSize));
+	(void)v;
+	lgl__glCaptureOutput((size_t)(bufSize * sizeof(*v)));
+}
+
+static void lgl__glCapture_glGetnMapfv(GLenum target, GLenum query, GLsizei bufSize, GLfloat *v)
+{
+	lgl__glCaptureBegin(683);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&query, sizeof(query));
+	lgl__glCaptureValue(&bufSize, sizeof(bufSize));
+	(void)v;
+	lgl__glCaptureOutput((size_t)(bufSize * sizeof(*v)));
+}
+
+static void lgl__glCapture_glGetnMapiv(GLenum target, GLenum query, GLsizei bufSize, GLint *v)
+{
+	lgl__glCaptureBegin(684);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&query, sizeof(query));
+	lgl__glCaptureValue(&bufSize, sizeof(bufSize));
+	(void)v;
+	lgl__glCaptureOutput((size_t)(bufSize * sizeof(*v)));
+}
+
+static void lgl__glCapture_glGetnPixelMapfv(GLenum map, GLsizei bufSize, GLfloat *values)
+{
+	lgl__glCaptureBegin(685);
+	lgl__glCaptureValue(&map, sizeof(map));
+	lgl__glCaptureValue(&bufSize, sizeof(bufSize));
+	(void)values;
+	lgl__glCaptureOutput((size_t)(bufSize * sizeof(*values)));
+}
+
+static void lgl__glCapture_glGetnPixelMapuiv(GLenum map, GLsizei bufSize, GLuint *values)
+{
+	lgl__glCaptureBegin(686);
+	lgl__glCaptureValue(&map, sizeof(map));
+	lgl__glCaptureValue(&bufSize, sizeof(bufSize));
+	(void)values;
+	lgl__glCaptureOutput((size_t)(bufSize * sizeof(*values)));
+}
+
+static void lgl__glCapture_glGetnPixelMapusv(GLenum map, GLsizei bufSize, GLushort *values)
+{
+	lgl__glCaptureBegin(687);
+	lgl__glCaptureValue(&map, sizeof(map));
+	lgl__glCaptureValue(&bufSize, sizeof(bufSize));
+	(void)values;
+	lgl__glCaptureOutput((size_t)(bufSize * sizeof(*values)));
+}
+
+static void lgl__glCapture_glGetnPolygonStipple(GLsizei bufSize, GLubyte *pattern)
+{
+	lgl__glCaptureBegin(688);
+	lgl__glCaptureValue(&bufSize, sizeof(bufSize));
+	(void)pattern;
+	lgl__glCaptureOutput((size_t)(bufSize * sizeof(*pattern)));
+}
+
+static void lgl__glCapture_glGetnColorTable(GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *table)
+{
+	lgl__glCaptureBegin(689);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&format, sizeof(format));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureValue(&bufSize, sizeof(bufSize));
+	(void)table;
+	lgl__glCaptureOutput((size_t)(bufSize));
+}
+
+static void lgl__glCapture_glGetnConvolutionFilter(GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *image)
+{
+	lgl__glCaptureBegin(690);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&format, sizeof(format));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureValue(&bufSize, sizeof(bufSize));
+	(void)image;
+	lgl__glCaptureOutput((size_t)(bufSize));
+}
+
+static void lgl__glCapture_glGetnSeparableFilter(GLenum target, GLenum format, GLenum type, GLsizei rowBufSize, void *row, GLsizei columnBufSize, void *column, void *span)
+{
+	lgl__glCaptureBegin(691);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&format, sizeof(format));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureValue(&rowBufSize, sizeof(rowBufSize));
+	(void)row;
+	lgl__glCaptureOutput((size_t)(0));
+	lgl__glCaptureValue(&columnBufSize, sizeof(columnBufSize));
+	(void)column;
+	lgl__glCaptureOutput((size_t)(0));
+	(void)span;
+	lgl__glCaptureOutput((size_t)(0));
+}
+
+static void lgl__glCapture_glGetnHistogram(GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values)
+{
+	lgl__glCaptureBegin(692);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&reset, sizeof(reset));
+	lgl__glCaptureValue(&format, sizeof(format));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureValue(&bufSize, sizeof(bufSize));
+	(void)values;
+	lgl__glCaptureOutput((size_t)(bufSize));
+}
+
+static void lgl__glCapture_glGetnMinmax(GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values)
+{
+	lgl__glCaptureBegin(693);
+	lgl__glCaptureValue(&target, sizeof(target));
+	lgl__glCaptureValue(&reset, sizeof(reset));
+	lgl__glCaptureValue(&format, sizeof(format));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureValue(&bufSize, sizeof(bufSize));
+	(void)values;
+	lgl__glCaptureOutput((size_t)(bufSize));
+}
+
+static void lgl__glCapture_glTextureBarrier(void)
+{
+	lgl__glCaptureBegin(694);
+}
+
+static void lgl__glCapture_glSpecializeShader(GLuint shader, const GLchar *pEntryPoint, GLuint numSpecializationConstants, const GLuint *pConstantIndex, const GLuint *pConstantValue)
+{
+	lgl__glCaptureBegin(695);
+	lgl__glCaptureValue(&shader, sizeof(shader));
+	lgl__glCaptureData(pEntryPoint, pEntryPoint ? (size_t)(lgl__glCaptureStringBytes(pEntryPoint, -1)) : 0);
+	lgl__glCaptureValue(&numSpecializationConstants, sizeof(numSpecializationConstants));
+	lgl__glCaptureData(pConstantIndex, pConstantIndex ? (size_t)(numSpecializationConstants * sizeof(*pConstantIndex)) : 0);
+	lgl__glCaptureData(pConstantValue, pConstantValue ? (size_t)(numSpecializationConstants * sizeof(*pConstantValue)) : 0);
+}
+
+static void lgl__glCapture_glMultiDrawArraysIndirectCount(GLenum mode, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride)
+{
+	lgl__glCaptureBegin(696);
+	lgl__glCaptureValue(&mode, sizeof(mode));
+	lgl__glCaptureOffset(indirect);
+	lgl__glCaptureValue(&drawcount, sizeof(drawcount));
+	lgl__glCaptureValue(&maxdrawcount, sizeof(maxdrawcount));
+	lgl__glCaptureValue(&stride, sizeof(stride));
+}
+
+static void lgl__glCapture_glMultiDrawElementsIndirectCount(GLenum mode, GLenum type, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride)
+{
+	lgl__glCaptureBegin(697);
+	lgl__glCaptureValue(&mode, sizeof(mode));
+	lgl__glCaptureValue(&type, sizeof(type));
+	lgl__glCaptureOffset(indirect);
+	lgl__glCaptureValue(&drawcount, sizeof(drawcount));
+	lgl__glCaptureValue(&maxdrawcount, sizeof(maxdrawcount));
+	lgl__glCaptureValue(&stride, sizeof(stride));
+}
+
+static void lgl__glCapture_glPolygonOffsetClamp(GLfloat factor, GLfloat units, GLfloat clamp)
+{
+	lgl__glCaptureBegin(698);
+	lgl__glCaptureValue(&factor, sizeof(factor));
+	lgl__glCaptureValue(&units, sizeof(units));
+	lgl__glCaptureValue(&clamp, sizeof(clamp));
+}
+
+static void APIENTRY lgl__glTrace_glCullFace(GLenum mode)
+{
+	double lgl__start = lgl__glTraceEnter(0);
+
+	lgl__glTraceState(0, LGL__GL_CULLFACE, 0, mode);
+	lgl__glReal_glCullFace(mode);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glCullFace(mode);
+	lgl__glTraceLeave(0, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glFrontFace(GLenum mode)
+{
+	double lgl__start = lgl__glTraceEnter(1);
+
+	lgl__glTraceState(1, LGL__GL_FRONTFACE, 0, mode);
+	lgl__glReal_glFrontFace(mode);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glFrontFace(mode);
+	lgl__glTraceLeave(1, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glHint(GLenum target, GLenum mode)
+{
+	double lgl__start = lgl__glTraceEnter(2);
+
+	lgl__glReal_glHint(target, mode);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glHint(target, mode);
+	lgl__glTraceLeave(2, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glLineWidth(GLfloat width)
+{
+	double lgl__start = lgl__glTraceEnter(3);
+
+	lgl__glReal_glLineWidth(width);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glLineWidth(width);
+	lgl__glTraceLeave(3, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glPointSize(GLfloat size)
+{
+	double lgl__start = lgl__glTraceEnter(4);
+
+	lgl__glReal_glPointSize(size);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glPointSize(size);
+	lgl__glTraceLeave(4, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glPolygonMode(GLenum face, GLenum mode)
+{
+	double lgl__start = lgl__glTraceEnter(5);
+
+	lgl__glTraceState(5, LGL__GL_POLYGONMODE, face, mode);
+	lgl__glReal_glPolygonMode(face, mode);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glPolygonMode(face, mode);
+	lgl__glTraceLeave(5, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glScissor(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+	double lgl__start = lgl__glTraceEnter(6);
+
+	lgl__glReal_glScissor(x, y, width, height);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glScissor(x, y, width, height);
+	lgl__glTraceLeave(6, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTexParameterf(GLenum target, GLenum pname, GLfloat param)
+{
+	double lgl__start = lgl__glTraceEnter(7);
+
+	lgl__glReal_glTexParameterf(target, pname, param);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTexParameterf(target, pname, param);
+	lgl__glTraceLeave(7, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params)
+{
+	double lgl__start = lgl__glTraceEnter(8);
+
+	lgl__glReal_glTexParameterfv(target, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTexParameterfv(target, pname, params);
+	lgl__glTraceLeave(8, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTexParameteri(GLenum target, GLenum pname, GLint param)
+{
+	double lgl__start = lgl__glTraceEnter(9);
+
+	lgl__glReal_glTexParameteri(target, pname, param);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTexParameteri(target, pname, param);
+	lgl__glTraceLeave(9, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTexParameteriv(GLenum target, GLenum pname, const GLint *params)
+{
+	double lgl__start = lgl__glTraceEnter(10);
+
+	lgl__glReal_glTexParameteriv(target, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTexParameteriv(target, pname, params);
+	lgl__glTraceLeave(10, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+	double lgl__start = lgl__glTraceEnter(11);
+
+	lgl__glReal_glTexImage1D(target, level, internalformat, width, border, format, type, pixels);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTexImage1D(target, level, internalformat, width, border, format, type, pixels);
+	lgl__glTraceLeave(11, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+	double lgl__start = lgl__glTraceEnter(12);
+
+	lgl__glReal_glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+	lgl__glTraceLeave(12, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glDrawBuffer(GLenum buf)
+{
+	double lgl__start = lgl__glTraceEnter(13);
+
+	lgl__glReal_glDrawBuffer(buf);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glDrawBuffer(buf);
+	lgl__glTraceLeave(13, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glClear(GLbitfield mask)
+{
+	double lgl__start = lgl__glTraceEnter(14);
+
+	lgl__glReal_glClear(mask);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glClear(mask);
+	lgl__glTraceLeave(14, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+	double lgl__start = lgl__glTraceEnter(15);
+
+	lgl__glReal_glClearColor(red, green, blue, alpha);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glClearColor(red, green, blue, alpha);
+	lgl__glTraceLeave(15, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glClearStencil(GLint s)
+{
+	double lgl__start = lgl__glTraceEnter(16);
+
+	lgl__glReal_glClearStencil(s);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glClearStencil(s);
+	lgl__glTraceLeave(16, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glClearDepth(GLdouble depth)
+{
+	double lgl__start = lgl__glTraceEnter(17);
+
+	lgl__glReal_glClearDepth(depth);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glClearDepth(depth);
+	lgl__glTraceLeave(17, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glStencilMask(GLuint mask)
+{
+	double lgl__start = lgl__glTraceEnter(18);
+
+	lgl__glReal_glStencilMask(mask);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glStencilMask(mask);
+	lgl__glTraceLeave(18, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)
+{
+	double lgl__start = lgl__glTraceEnter(19);
+
+	lgl__glReal_glColorMask(red, green, blue, alpha);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glColorMask(red, green, blue, alpha);
+	lgl__glTraceLeave(19, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glDepthMask(GLboolean flag)
+{
+	double lgl__start = lgl__glTraceEnter(20);
+
+	lgl__glTraceState(20, LGL__GL_DEPTHMASK, 0, flag);
+	lgl__glReal_glDepthMask(flag);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glDepthMask(flag);
+	lgl__glTraceLeave(20, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glDisable(GLenum cap)
+{
+	double lgl__start = lgl__glTraceEnter(21);
+
+	lgl__glTraceState(21, LGL__GL_ENABLE, cap, 0);
+	lgl__glReal_glDisable(cap);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glDisable(cap);
+	lgl__glTraceLeave(21, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glEnable(GLenum cap)
+{
+	double lgl__start = lgl__glTraceEnter(22);
+
+	lgl__glTraceState(22, LGL__GL_ENABLE, cap, 1);
+	lgl__glReal_glEnable(cap);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glEnable(cap);
+	lgl__glTraceLeave(22, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glFinish(void)
+{
+	double lgl__start = lgl__glTraceEnter(23);
+
+	lgl__glReal_glFinish();
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glFinish();
+	lgl__glTraceLeave(23, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glFlush(void)
+{
+	double lgl__start = lgl__glTraceEnter(24);
+
+	lgl__glReal_glFlush();
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glFlush();
+	lgl__glTraceLeave(24, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glBlendFunc(GLenum sfactor, GLenum dfactor)
+{
+	double lgl__start = lgl__glTraceEnter(25);
+
+	lgl__glTraceState(25, LGL__GL_BLENDFUNC, 0, (GLuint64)sfactor << 32 | dfactor);
+	lgl__glReal_glBlendFunc(sfactor, dfactor);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glBlendFunc(sfactor, dfactor);
+	lgl__glTraceLeave(25, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glLogicOp(GLenum opcode)
+{
+	double lgl__start = lgl__glTraceEnter(26);
+
+	lgl__glReal_glLogicOp(opcode);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glLogicOp(opcode);
+	lgl__glTraceLeave(26, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glStencilFunc(GLenum func, GLint ref, GLuint mask)
+{
+	double lgl__start = lgl__glTraceEnter(27);
+
+	lgl__glReal_glStencilFunc(func, ref, mask);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glStencilFunc(func, ref, mask);
+	lgl__glTraceLeave(27, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass)
+{
+	double lgl__start = lgl__glTraceEnter(28);
+
+	lgl__glReal_glStencilOp(fail, zfail, zpass);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glStencilOp(fail, zfail, zpass);
+	lgl__glTraceLeave(28, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glDepthFunc(GLenum func)
+{
+	double lgl__start = lgl__glTraceEnter(29);
+
+	lgl__glTraceState(29, LGL__GL_DEPTHFUNC, 0, func);
+	lgl__glReal_glDepthFunc(func);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glDepthFunc(func);
+	lgl__glTraceLeave(29, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glPixelStoref(GLenum pname, GLfloat param)
+{
+	double lgl__start = lgl__glTraceEnter(30);
+
+	lgl__glReal_glPixelStoref(pname, param);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glPixelStoref(pname, param);
+	lgl__glTraceLeave(30, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glPixelStorei(GLenum pname, GLint param)
+{
+	double lgl__start = lgl__glTraceEnter(31);
+
+	lgl__glTraceState(31, LGL__GL_PIXELSTOREI, pname, (GLuint)param);
+	lgl__glReal_glPixelStorei(pname, param);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glPixelStorei(pname, param);
+	lgl__glTraceLeave(31, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glReadBuffer(GLenum src)
+{
+	double lgl__start = lgl__glTraceEnter(32);
+
+	lgl__glReal_glReadBuffer(src);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glReadBuffer(src);
+	lgl__glTraceLeave(32, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels)
+{
+	double lgl__start = lgl__glTraceEnter(33);
+
+	lgl__glReal_glReadPixels(x, y, width, height, format, type, pixels);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glReadPixels(x, y, width, height, format, type, pixels);
+	lgl__glTraceLeave(33, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetBooleanv(GLenum pname, GLboolean *data)
+{
+	double lgl__start = lgl__glTraceEnter(34);
+
+	lgl__glReal_glGetBooleanv(pname, data);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetBooleanv(pname, data);
+	lgl__glTraceLeave(34, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetDoublev(GLenum pname, GLdouble *data)
+{
+	double lgl__start = lgl__glTraceEnter(35);
+
+	lgl__glReal_glGetDoublev(pname, data);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetDoublev(pname, data);
+	lgl__glTraceLeave(35, 1, lgl__start);
+}
+
+static GLenum APIENTRY lgl__glTrace_glGetError(void)
+{
+	GLenum lgl__result;
+	double lgl__start = lgl__glTraceEnter(36);
+
+	lgl__result = lgl__glReal_glGetError();
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetError(lgl__result);
+	lgl__glTraceLeave(36, 1, lgl__start);
+	return lgl__result;
+}
+
+static void APIENTRY lgl__glTrace_glGetFloatv(GLenum pname, GLfloat *data)
+{
+	double lgl__start = lgl__glTraceEnter(37);
+
+	lgl__glReal_glGetFloatv(pname, data);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetFloatv(pname, data);
+	lgl__glTraceLeave(37, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetIntegerv(GLenum pname, GLint *data)
+{
+	double lgl__start = lgl__glTraceEnter(38);
+
+	lgl__glReal_glGetIntegerv(pname, data);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetIntegerv(pname, data);
+	lgl__glTraceLeave(38, 1, lgl__start);
+}
+
+static const GLubyte * APIENTRY lgl__glTrace_glGetString(GLenum name)
+{
+	const GLubyte * lgl__result;
+	double lgl__start = lgl__glTraceEnter(39);
+
+	lgl__result = lgl__glReal_glGetString(name);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetString(name, lgl__result);
+	lgl__glTraceLeave(39, 1, lgl__start);
+	return lgl__result;
+}
+
+static void APIENTRY lgl__glTrace_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels)
+{
+	double lgl__start = lgl__glTraceEnter(40);
+
+	lgl__glReal_glGetTexImage(target, level, format, type, pixels);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetTexImage(target, level, format, type, pixels);
+	lgl__glTraceLeave(40, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat *params)
+{
+	double lgl__start = lgl__glTraceEnter(41);
+
+	lgl__glReal_glGetTexParameterfv(target, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetTexParameterfv(target, pname, params);
+	lgl__glTraceLeave(41, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetTexParameteriv(GLenum target, GLenum pname, GLint *params)
+{
+	double lgl__start = lgl__glTraceEnter(42);
+
+	lgl__glReal_glGetTexParameteriv(target, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetTexParameteriv(target, pname, params);
+	lgl__glTraceLeave(42, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params)
+{
+	double lgl__start = lgl__glTraceEnter(43);
+
+	lgl__glReal_glGetTexLevelParameterfv(target, level, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetTexLevelParameterfv(target, level, pname, params);
+	lgl__glTraceLeave(43, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params)
+{
+	double lgl__start = lgl__glTraceEnter(44);
+
+	lgl__glReal_glGetTexLevelParameteriv(target, level, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetTexLevelParameteriv(target, level, pname, params);
+	lgl__glTraceLeave(44, 1, lgl__start);
+}
+
+static GLboolean APIENTRY lgl__glTrace_glIsEnabled(GLenum cap)
+{
+	GLboolean lgl__result;
+	double lgl__start = lgl__glTraceEnter(45);
+
+	lgl__result = lgl__glReal_glIsEnabled(cap);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glIsEnabled(cap, lgl__result);
+	lgl__glTraceLeave(45, 1, lgl__start);
+	return lgl__result;
+}
+
+static void APIENTRY lgl__glTrace_glDepthRange(GLdouble n, GLdouble f)
+{
+	double lgl__start = lgl__glTraceEnter(46);
+
+	lgl__glReal_glDepthRange(n, f);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glDepthRange(n, f);
+	lgl__glTraceLeave(46, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glViewport(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+	double lgl__start = lgl__glTraceEnter(47);
+
+	lgl__glTraceState(47, LGL__GL_VIEWPORT, 0, (GLuint64)(x & 0xffff) << 48 | (GLuint64)(y & 0xffff) << 32 | (GLuint64)(width & 0xffff) << 16 | (height & 0xffff));
+	lgl__glReal_glViewport(x, y, width, height);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glViewport(x, y, width, height);
+	lgl__glTraceLeave(47, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glDrawArrays(GLenum mode, GLint first, GLsizei count)
+{
+	double lgl__start = lgl__glTraceEnter(48);
+
+	lgl__glReal_glDrawArrays(mode, first, count);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glDrawArrays(mode, first, count);
+	lgl__glTraceLeave(48, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices)
+{
+	double lgl__start = lgl__glTraceEnter(49);
+
+	lgl__glReal_glDrawElements(mode, count, type, indices);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glDrawElements(mode, count, type, indices);
+	lgl__glTraceLeave(49, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glPolygonOffset(GLfloat factor, GLfloat units)
+{
+	double lgl__start = lgl__glTraceEnter(50);
+
+	lgl__glReal_glPolygonOffset(factor, units);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glPolygonOffset(factor, units);
+	lgl__glTraceLeave(50, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border)
+{
+	double lgl__start = lgl__glTraceEnter(51);
+
+	lgl__glReal_glCopyTexImage1D(target, level, internalformat, x, y, width, border);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glCopyTexImage1D(target, level, internalformat, x, y, width, border);
+	lgl__glTraceLeave(51, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border)
+{
+	double lgl__start = lgl__glTraceEnter(52);
+
+	lgl__glReal_glCopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glCopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+	lgl__glTraceLeave(52, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width)
+{
+	double lgl__start = lgl__glTraceEnter(53);
+
+	lgl__glReal_glCopyTexSubImage1D(target, level, xoffset, x, y, width);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glCopyTexSubImage1D(target, level, xoffset, x, y, width);
+	lgl__glTraceLeave(53, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+	double lgl__start = lgl__glTraceEnter(54);
+
+	lgl__glReal_glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+	lgl__glTraceLeave(54, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels)
+{
+	double lgl__start = lgl__glTraceEnter(55);
+
+	lgl__glReal_glTexSubImage1D(target, level, xoffset, width, format, type, pixels);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTexSubImage1D(target, level, xoffset, width, format, type, pixels);
+	lgl__glTraceLeave(55, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels)
+{
+	double lgl__start = lgl__glTraceEnter(56);
+
+	lgl__glReal_glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+	lgl__glTraceLeave(56, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glBindTexture(GLenum target, GLuint texture)
+{
+	double lgl__start = lgl__glTraceEnter(57);
+
+	lgl__glTraceState(57, LGL__GL_BINDTEXTURE, (GLuint64)lgl__glTrace.activeTexture << 32 | target, texture);
+	lgl__glReal_glBindTexture(target, texture);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glBindTexture(target, texture);
+	lgl__glTraceLeave(57, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glDeleteTextures(GLsizei n, const GLuint *textures)
+{
+	double lgl__start = lgl__glTraceEnter(58);
+
+	lgl__glTraceForget(LGL__GL_BINDTEXTURE, n, textures);
+	lgl__glTraceForget(LGL__GL_BINDTEXTUREUNIT, n, textures);
+	lgl__glReal_glDeleteTextures(n, textures);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glDeleteTextures(n, textures);
+	lgl__glTraceLeave(58, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGenTextures(GLsizei n, GLuint *textures)
+{
+	double lgl__start = lgl__glTraceEnter(59);
+
+	lgl__glReal_glGenTextures(n, textures);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGenTextures(n, textures);
+	lgl__glTraceLeave(59, 0, lgl__start);
+}
+
+static GLboolean APIENTRY lgl__glTrace_glIsTexture(GLuint texture)
+{
+	GLboolean lgl__result;
+	double lgl__start = lgl__glTraceEnter(60);
+
+	lgl__result = lgl__glReal_glIsTexture(texture);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glIsTexture(texture, lgl__result);
+	lgl__glTraceLeave(60, 1, lgl__start);
+	return lgl__result;
+}
+
+static void APIENTRY lgl__glTrace_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices)
+{
+	double lgl__start = lgl__glTraceEnter(61);
+
+	lgl__glReal_glDrawRangeElements(mode, start, end, count, type, indices);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glDrawRangeElements(mode, start, end, count, type, indices);
+	lgl__glTraceLeave(61, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+	double lgl__start = lgl__glTraceEnter(62);
+
+	lgl__glReal_glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+	lgl__glTraceLeave(62, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels)
+{
+	double lgl__start = lgl__glTraceEnter(63);
+
+	lgl__glReal_glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+	lgl__glTraceLeave(63, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+	double lgl__start = lgl__glTraceEnter(64);
+
+	lgl__glReal_glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+	lgl__glTraceLeave(64, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glActiveTexture(GLenum texture)
+{
+	double lgl__start = lgl__glTraceEnter(65);
+
+	lgl__glTraceState(65, LGL__GL_ACTIVETEXTURE, 0, texture);
+	lgl__glTrace.activeTexture = texture - GL_TEXTURE0;
+	lgl__glReal_glActiveTexture(texture);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glActiveTexture(texture);
+	lgl__glTraceLeave(65, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glSampleCoverage(GLfloat value, GLboolean invert)
+{
+	double lgl__start = lgl__glTraceEnter(66);
+
+	lgl__glReal_glSampleCoverage(value, invert);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glSampleCoverage(value, invert);
+	lgl__glTraceLeave(66, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data)
+{
+	double lgl__start = lgl__glTraceEnter(67);
+
+	lgl__glReal_glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+	lgl__glTraceLeave(67, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data)
+{
+	double lgl__start = lgl__glTraceEnter(68);
+
+	lgl__glReal_glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+	lgl__glTraceLeave(68, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data)
+{
+	double lgl__start = lgl__glTraceEnter(69);
+
+	lgl__glReal_glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+	lgl__glTraceLeave(69, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data)
+{
+	double lgl__start = lgl__glTraceEnter(70);
+
+	lgl__glReal_glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+	lgl__glTraceLeave(70, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data)
+{
+	double lgl__start = lgl__glTraceEnter(71);
+
+	lgl__glReal_glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+	lgl__glTraceLeave(71, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data)
+{
+	double lgl__start = lgl__glTraceEnter(72);
+
+	lgl__glReal_glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+	lgl__glTraceLeave(72, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetCompressedTexImage(GLenum target, GLint level, void *img)
+{
+	double lgl__start = lgl__glTraceEnter(73);
+
+	lgl__glReal_glGetCompressedTexImage(target, level, img);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetCompressedTexImage(target, level, img);
+	lgl__glTraceLeave(73, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)
+{
+	double lgl__start = lgl__glTraceEnter(74);
+
+	lgl__glReal_glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+	lgl__glTraceLeave(74, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount)
+{
+	double lgl__start = lgl__glTraceEnter(75);
+
+	lgl__glReal_glMultiDrawArrays(mode, first, count, drawcount);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glMultiDrawArrays(mode, first, count, drawcount);
+	lgl__glTraceLeave(75, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount)
+{
+	double lgl__start = lgl__glTraceEnter(76);
+
+	lgl__glReal_glMultiDrawElements(mode, count, type, indices, drawcount);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glMultiDrawElements(mode, count, type, indices, drawcount);
+	lgl__glTraceLeave(76, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glPointParameterf(GLenum pname, GLfloat param)
+{
+	double lgl__start = lgl__glTraceEnter(77);
+
+	lgl__glReal_glPointParameterf(pname, param);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glPointParameterf(pname, param);
+	lgl__glTraceLeave(77, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glPointParameterfv(GLenum pname, const GLfloat *params)
+{
+	double lgl__start = lgl__glTraceEnter(78);
+
+	lgl__glReal_glPointParameterfv(pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glPointParameterfv(pname, params);
+	lgl__glTraceLeave(78, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glPointParameteri(GLenum pname, GLint param)
+{
+	double lgl__start = lgl__glTraceEnter(79);
+
+	lgl__glReal_glPointParameteri(pname, param);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glPointParameteri(pname, param);
+	lgl__glTraceLeave(79, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glPointParameteriv(GLenum pname, const GLint *params)
+{
+	double lgl__start = lgl__glTraceEnter(80);
+
+	lgl__glReal_glPointParameteriv(pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glPointParameteriv(pname, params);
+	lgl__glTraceLeave(80, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+	double lgl__start = lgl__glTraceEnter(81);
+
+	lgl__glReal_glBlendColor(red, green, blue, alpha);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glBlendColor(red, green, blue, alpha);
+	lgl__glTraceLeave(81, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glBlendEquation(GLenum mode)
+{
+	double lgl__start = lgl__glTraceEnter(82);
+
+	lgl__glTraceState(82, LGL__GL_BLENDEQUATION, 0, mode);
+	lgl__glReal_glBlendEquation(mode);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glBlendEquation(mode);
+	lgl__glTraceLeave(82, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGenQueries(GLsizei n, GLuint *ids)
+{
+	double lgl__start = lgl__glTraceEnter(83);
+
+	lgl__glReal_glGenQueries(n, ids);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGenQueries(n, ids);
+	lgl__glTraceLeave(83, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glDeleteQueries(GLsizei n, const GLuint *ids)
+{
+	double lgl__start = lgl__glTraceEnter(84);
+
+	lgl__glReal_glDeleteQueries(n, ids);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glDeleteQueries(n, ids);
+	lgl__glTraceLeave(84, 0, lgl__start);
+}
+
+static GLboolean APIENTRY lgl__glTrace_glIsQuery(GLuint id)
+{
+	GLboolean lgl__result;
+	double lgl__start = lgl__glTraceEnter(85);
+
+	lgl__result = lgl__glReal_glIsQuery(id);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glIsQuery(id, lgl__result);
+	lgl__glTraceLeave(85, 1, lgl__start);
+	return lgl__result;
+}
+
+static void APIENTRY lgl__glTrace_glBeginQuery(GLenum target, GLuint id)
+{
+	double lgl__start = lgl__glTraceEnter(86);
+
+	lgl__glReal_glBeginQuery(target, id);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glBeginQuery(target, id);
+	lgl__glTraceLeave(86, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glEndQuery(GLenum target)
+{
+	double lgl__start = lgl__glTraceEnter(87);
+
+	lgl__glReal_glEndQuery(target);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glEndQuery(target);
+	lgl__glTraceLeave(87, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetQueryiv(GLenum target, GLenum pname, GLint *params)
+{
+	double lgl__start = lgl__glTraceEnter(88);
+
+	lgl__glReal_glGetQueryiv(target, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetQueryiv(target, pname, params);
+	lgl__glTraceLeave(88, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params)
+{
+	double lgl__start = lgl__glTraceEnter(89);
+
+	lgl__glReal_glGetQueryObjectiv(id, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetQueryObjectiv(id, pname, params);
+	lgl__glTraceLeave(89, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params)
+{
+	double lgl__start = lgl__glTraceEnter(90);
+
+	lgl__glReal_glGetQueryObjectuiv(id, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetQueryObjectuiv(id, pname, params);
+	lgl__glTraceLeave(90, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glBindBuffer(GLenum target, GLuint buffer)
+{
+	double lgl__start = lgl__glTraceEnter(91);
+
+	lgl__glTraceState(91, LGL__GL_BINDBUFFER, target == GL_ELEMENT_ARRAY_BUFFER ? (GLuint64)lgl__glTrace.vertexArray << 32 | target : target, buffer);
+	lgl__glReal_glBindBuffer(target, buffer);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glBindBuffer(target, buffer);
+	lgl__glTraceLeave(91, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glDeleteBuffers(GLsizei n, const GLuint *buffers)
+{
+	double lgl__start = lgl__glTraceEnter(92);
+
+	lgl__glTraceForget(LGL__GL_BINDBUFFER, n, buffers);
+	lgl__glReal_glDeleteBuffers(n, buffers);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glDeleteBuffers(n, buffers);
+	lgl__glTraceLeave(92, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGenBuffers(GLsizei n, GLuint *buffers)
+{
+	double lgl__start = lgl__glTraceEnter(93);
+
+	lgl__glReal_glGenBuffers(n, buffers);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGenBuffers(n, buffers);
+	lgl__glTraceLeave(93, 0, lgl__start);
+}
+
+static GLboolean APIENTRY lgl__glTrace_glIsBuffer(GLuint buffer)
+{
+	GLboolean lgl__result;
+	double lgl__start = lgl__glTraceEnter(94);
+
+	lgl__result = lgl__glReal_glIsBuffer(buffer);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glIsBuffer(buffer, lgl__result);
+	lgl__glTraceLeave(94, 1, lgl__start);
+	return lgl__result;
+}
+
+static void APIENTRY lgl__glTrace_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage)
+{
+	double lgl__start = lgl__glTraceEnter(95);
+
+	lgl__glReal_glBufferData(target, size, data, usage);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glBufferData(target, size, data, usage);
+	lgl__glTraceLeave(95, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data)
+{
+	double lgl__start = lgl__glTraceEnter(96);
+
+	lgl__glReal_glBufferSubData(target, offset, size, data);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glBufferSubData(target, offset, size, data);
+	lgl__glTraceLeave(96, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data)
+{
+	double lgl__start = lgl__glTraceEnter(97);
+
+	lgl__glReal_glGetBufferSubData(target, offset, size, data);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetBufferSubData(target, offset, size, data);
+	lgl__glTraceLeave(97, 1, lgl__start);
+}
+
+static void * APIENTRY lgl__glTrace_glMapBuffer(GLenum target, GLenum access)
+{
+	void * lgl__result;
+	double lgl__start = lgl__glTraceEnter(98);
+
+	lgl__result = lgl__glReal_glMapBuffer(target, access);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glMapBuffer(target, access, lgl__result);
+	lgl__glTraceLeave(98, 1, lgl__start);
+	return lgl__result;
+}
+
+static GLboolean APIENTRY lgl__glTrace_glUnmapBuffer(GLenum target)
+{
+	GLboolean lgl__result;
+	double lgl__start = lgl__glTraceEnter(99);
+
+	lgl__result = lgl__glReal_glUnmapBuffer(target);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUnmapBuffer(target, lgl__result);
+	lgl__glTraceLeave(99, 0, lgl__start);
+	return lgl__result;
+}
+
+static void APIENTRY lgl__glTrace_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params)
+{
+	double lgl__start = lgl__glTraceEnter(100);
+
+	lgl__glReal_glGetBufferParameteriv(target, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetBufferParameteriv(target, pname, params);
+	lgl__glTraceLeave(100, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetBufferPointerv(GLenum target, GLenum pname, void **params)
+{
+	double lgl__start = lgl__glTraceEnter(101);
+
+	lgl__glReal_glGetBufferPointerv(target, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetBufferPointerv(target, pname, params);
+	lgl__glTraceLeave(101, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha)
+{
+	double lgl__start = lgl__glTraceEnter(102);
+
+	lgl__glReal_glBlendEquationSeparate(modeRGB, modeAlpha);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glBlendEquationSeparate(modeRGB, modeAlpha);
+	lgl__glTraceLeave(102, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glDrawBuffers(GLsizei n, const GLenum *bufs)
+{
+	double lgl__start = lgl__glTraceEnter(103);
+
+	lgl__glReal_glDrawBuffers(n, bufs);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glDrawBuffers(n, bufs);
+	lgl__glTraceLeave(103, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass)
+{
+	double lgl__start = lgl__glTraceEnter(104);
+
+	lgl__glReal_glStencilOpSeparate(face, sfail, dpfail, dppass);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glStencilOpSeparate(face, sfail, dpfail, dppass);
+	lgl__glTraceLeave(104, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask)
+{
+	double lgl__start = lgl__glTraceEnter(105);
+
+	lgl__glReal_glStencilFuncSeparate(face, func, ref, mask);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glStencilFuncSeparate(face, func, ref, mask);
+	lgl__glTraceLeave(105, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glStencilMaskSeparate(GLenum face, GLuint mask)
+{
+	double lgl__start = lgl__glTraceEnter(106);
+
+	lgl__glReal_glStencilMaskSeparate(face, mask);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glStencilMaskSeparate(face, mask);
+	lgl__glTraceLeave(106, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glAttachShader(GLuint program, GLuint shader)
+{
+	double lgl__start = lgl__glTraceEnter(107);
+
+	lgl__glReal_glAttachShader(program, shader);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glAttachShader(program, shader);
+	lgl__glTraceLeave(107, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name)
+{
+	double lgl__start = lgl__glTraceEnter(108);
+
+	lgl__glReal_glBindAttribLocation(program, index, name);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glBindAttribLocation(program, index, name);
+	lgl__glTraceLeave(108, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glCompileShader(GLuint shader)
+{
+	double lgl__start = lgl__glTraceEnter(109);
+
+	lgl__glReal_glCompileShader(shader);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glCompileShader(shader);
+	lgl__glTraceLeave(109, 0, lgl__start);
+}
+
+static GLuint APIENTRY lgl__glTrace_glCreateProgram(void)
+{
+	GLuint lgl__result;
+	double lgl__start = lgl__glTraceEnter(110);
+
+	lgl__result = lgl__glReal_glCreateProgram();
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glCreateProgram(lgl__result);
+	lgl__glTraceLeave(110, 0, lgl__start);
+	return lgl__result;
+}
+
+static GLuint APIENTRY lgl__glTrace_glCreateShader(GLenum type)
+{
+	GLuint lgl__result;
+	double lgl__start = lgl__glTraceEnter(111);
+
+	lgl__result = lgl__glReal_glCreateShader(type);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glCreateShader(type, lgl__result);
+	lgl__glTraceLeave(111, 0, lgl__start);
+	return lgl__result;
+}
+
+static void APIENTRY lgl__glTrace_glDeleteProgram(GLuint program)
+{
+	double lgl__start = lgl__glTraceEnter(112);
+
+	lgl__glTraceForget(LGL__GL_USEPROGRAM, 1, &program);
+	lgl__glReal_glDeleteProgram(program);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glDeleteProgram(program);
+	lgl__glTraceLeave(112, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glDeleteShader(GLuint shader)
+{
+	double lgl__start = lgl__glTraceEnter(113);
+
+	lgl__glReal_glDeleteShader(shader);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glDeleteShader(shader);
+	lgl__glTraceLeave(113, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glDetachShader(GLuint program, GLuint shader)
+{
+	double lgl__start = lgl__glTraceEnter(114);
+
+	lgl__glReal_glDetachShader(program, shader);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glDetachShader(program, shader);
+	lgl__glTraceLeave(114, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glDisableVertexAttribArray(GLuint index)
+{
+	double lgl__start = lgl__glTraceEnter(115);
+
+	lgl__glReal_glDisableVertexAttribArray(index);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glDisableVertexAttribArray(index);
+	lgl__glTraceLeave(115, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glEnableVertexAttribArray(GLuint index)
+{
+	double lgl__start = lgl__glTraceEnter(116);
+
+	lgl__glReal_glEnableVertexAttribArray(index);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glEnableVertexAttribArray(index);
+	lgl__glTraceLeave(116, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name)
+{
+	double lgl__start = lgl__glTraceEnter(117);
+
+	lgl__glReal_glGetActiveAttrib(program, index, bufSize, length, size, type, name);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetActiveAttrib(program, index, bufSize, length, size, type, name);
+	lgl__glTraceLeave(117, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name)
+{
+	double lgl__start = lgl__glTraceEnter(118);
+
+	lgl__glReal_glGetActiveUniform(program, index, bufSize, length, size, type, name);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetActiveUniform(program, index, bufSize, length, size, type, name);
+	lgl__glTraceLeave(118, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders)
+{
+	double lgl__start = lgl__glTraceEnter(119);
+
+	lgl__glReal_glGetAttachedShaders(program, maxCount, count, shaders);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetAttachedShaders(program, maxCount, count, shaders);
+	lgl__glTraceLeave(119, 1, lgl__start);
+}
+
+static GLint APIENTRY lgl__glTrace_glGetAttribLocation(GLuint program, const GLchar *name)
+{
+	GLint lgl__result;
+	double lgl__start = lgl__glTraceEnter(120);
+
+	lgl__result = lgl__glReal_glGetAttribLocation(program, name);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetAttribLocation(program, name, lgl__result);
+	lgl__glTraceLeave(120, 1, lgl__start);
+	return lgl__result;
+}
+
+static void APIENTRY lgl__glTrace_glGetProgramiv(GLuint program, GLenum pname, GLint *params)
+{
+	double lgl__start = lgl__glTraceEnter(121);
+
+	lgl__glReal_glGetProgramiv(program, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetProgramiv(program, pname, params);
+	lgl__glTraceLeave(121, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+	double lgl__start = lgl__glTraceEnter(122);
+
+	lgl__glReal_glGetProgramInfoLog(program, bufSize, length, infoLog);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetProgramInfoLog(program, bufSize, length, infoLog);
+	lgl__glTraceLeave(122, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetShaderiv(GLuint shader, GLenum pname, GLint *params)
+{
+	double lgl__start = lgl__glTraceEnter(123);
+
+	lgl__glReal_glGetShaderiv(shader, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetShaderiv(shader, pname, params);
+	lgl__glTraceLeave(123, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+	double lgl__start = lgl__glTraceEnter(124);
+
+	lgl__glReal_glGetShaderInfoLog(shader, bufSize, length, infoLog);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetShaderInfoLog(shader, bufSize, length, infoLog);
+	lgl__glTraceLeave(124, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source)
+{
+	double lgl__start = lgl__glTraceEnter(125);
+
+	lgl__glReal_glGetShaderSource(shader, bufSize, length, source);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetShaderSource(shader, bufSize, length, source);
+	lgl__glTraceLeave(125, 1, lgl__start);
+}
+
+static GLint APIENTRY lgl__glTrace_glGetUniformLocation(GLuint program, const GLchar *name)
+{
+	GLint lgl__result;
+	double lgl__start = lgl__glTraceEnter(126);
+
+	lgl__result = lgl__glReal_glGetUniformLocation(program, name);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetUniformLocation(program, name, lgl__result);
+	lgl__glTraceLeave(126, 1, lgl__start);
+	return lgl__result;
+}
+
+static void APIENTRY lgl__glTrace_glGetUniformfv(GLuint program, GLint location, GLfloat *params)
+{
+	double lgl__start = lgl__glTraceEnter(127);
+
+	lgl__glReal_glGetUniformfv(program, location, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetUniformfv(program, location, params);
+	lgl__glTraceLeave(127, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetUniformiv(GLuint program, GLint location, GLint *params)
+{
+	double lgl__start = lgl__glTraceEnter(128);
+
+	lgl__glReal_glGetUniformiv(program, location, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetUniformiv(program, location, params);
+	lgl__glTraceLeave(128, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params)
+{
+	double lgl__start = lgl__glTraceEnter(129);
+
+	lgl__glReal_glGetVertexAttribdv(index, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetVertexAttribdv(index, pname, params);
+	lgl__glTraceLeave(129, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params)
+{
+	double lgl__start = lgl__glTraceEnter(130);
+
+	lgl__glReal_glGetVertexAttribfv(index, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetVertexAttribfv(index, pname, params);
+	lgl__glTraceLeave(130, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params)
+{
+	double lgl__start = lgl__glTraceEnter(131);
+
+	lgl__glReal_glGetVertexAttribiv(index, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetVertexAttribiv(index, pname, params);
+	lgl__glTraceLeave(131, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer)
+{
+	double lgl__start = lgl__glTraceEnter(132);
+
+	lgl__glReal_glGetVertexAttribPointerv(index, pname, pointer);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetVertexAttribPointerv(index, pname, pointer);
+	lgl__glTraceLeave(132, 1, lgl__start);
+}
+
+static GLboolean APIENTRY lgl__glTrace_glIsProgram(GLuint program)
+{
+	GLboolean lgl__result;
+	double lgl__start = lgl__glTraceEnter(133);
+
+	lgl__result = lgl__glReal_glIsProgram(program);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glIsProgram(program, lgl__result);
+	lgl__glTraceLeave(133, 1, lgl__start);
+	return lgl__result;
+}
+
+static GLboolean APIENTRY lgl__glTrace_glIsShader(GLuint shader)
+{
+	GLboolean lgl__result;
+	double lgl__start = lgl__glTraceEnter(134);
+
+	lgl__result = lgl__glReal_glIsShader(shader);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glIsShader(shader, lgl__result);
+	lgl__glTraceLeave(134, 1, lgl__start);
+	return lgl__result;
+}
+
+static void APIENTRY lgl__glTrace_glLinkProgram(GLuint program)
+{
+	double lgl__start = lgl__glTraceEnter(135);
+
+	lgl__glReal_glLinkProgram(program);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glLinkProgram(program);
+	lgl__glTraceLeave(135, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length)
+{
+	double lgl__start = lgl__glTraceEnter(136);
+
+	lgl__glReal_glShaderSource(shader, count, string, length);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glShaderSource(shader, count, string, length);
+	lgl__glTraceLeave(136, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUseProgram(GLuint program)
+{
+	double lgl__start = lgl__glTraceEnter(137);
+
+	lgl__glTraceState(137, LGL__GL_USEPROGRAM, 0, program);
+	lgl__glReal_glUseProgram(program);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUseProgram(program);
+	lgl__glTraceLeave(137, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniform1f(GLint location, GLfloat v0)
+{
+	double lgl__start = lgl__glTraceEnter(138);
+
+	lgl__glReal_glUniform1f(location, v0);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniform1f(location, v0);
+	lgl__glTraceLeave(138, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniform2f(GLint location, GLfloat v0, GLfloat v1)
+{
+	double lgl__start = lgl__glTraceEnter(139);
+
+	lgl__glReal_glUniform2f(location, v0, v1);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniform2f(location, v0, v1);
+	lgl__glTraceLeave(139, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+{
+	double lgl__start = lgl__glTraceEnter(140);
+
+	lgl__glReal_glUniform3f(location, v0, v1, v2);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniform3f(location, v0, v1, v2);
+	lgl__glTraceLeave(140, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+{
+	double lgl__start = lgl__glTraceEnter(141);
+
+	lgl__glReal_glUniform4f(location, v0, v1, v2, v3);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniform4f(location, v0, v1, v2, v3);
+	lgl__glTraceLeave(141, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniform1i(GLint location, GLint v0)
+{
+	double lgl__start = lgl__glTraceEnter(142);
+
+	lgl__glReal_glUniform1i(location, v0);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniform1i(location, v0);
+	lgl__glTraceLeave(142, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniform2i(GLint location, GLint v0, GLint v1)
+{
+	double lgl__start = lgl__glTraceEnter(143);
+
+	lgl__glReal_glUniform2i(location, v0, v1);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniform2i(location, v0, v1);
+	lgl__glTraceLeave(143, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2)
+{
+	double lgl__start = lgl__glTraceEnter(144);
+
+	lgl__glReal_glUniform3i(location, v0, v1, v2);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniform3i(location, v0, v1, v2);
+	lgl__glTraceLeave(144, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+{
+	double lgl__start = lgl__glTraceEnter(145);
+
+	lgl__glReal_glUniform4i(location, v0, v1, v2, v3);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniform4i(location, v0, v1, v2, v3);
+	lgl__glTraceLeave(145, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniform1fv(GLint location, GLsizei count, const GLfloat *value)
+{
+	double lgl__start = lgl__glTraceEnter(146);
+
+	lgl__glReal_glUniform1fv(location, count, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniform1fv(location, count, value);
+	lgl__glTraceLeave(146, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniform2fv(GLint location, GLsizei count, const GLfloat *value)
+{
+	double lgl__start = lgl__glTraceEnter(147);
+
+	lgl__glReal_glUniform2fv(location, count, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniform2fv(location, count, value);
+	lgl__glTraceLeave(147, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniform3fv(GLint location, GLsizei count, const GLfloat *value)
+{
+	double lgl__start = lgl__glTraceEnter(148);
+
+	lgl__glReal_glUniform3fv(location, count, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniform3fv(location, count, value);
+	lgl__glTraceLeave(148, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniform4fv(GLint location, GLsizei count, const GLfloat *value)
+{
+	double lgl__start = lgl__glTraceEnter(149);
+
+	lgl__glReal_glUniform4fv(location, count, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniform4fv(location, count, value);
+	lgl__glTraceLeave(149, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniform1iv(GLint location, GLsizei count, const GLint *value)
+{
+	double lgl__start = lgl__glTraceEnter(150);
+
+	lgl__glReal_glUniform1iv(location, count, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniform1iv(location, count, value);
+	lgl__glTraceLeave(150, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniform2iv(GLint location, GLsizei count, const GLint *value)
+{
+	double lgl__start = lgl__glTraceEnter(151);
+
+	lgl__glReal_glUniform2iv(location, count, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniform2iv(location, count, value);
+	lgl__glTraceLeave(151, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniform3iv(GLint location, GLsizei count, const GLint *value)
+{
+	double lgl__start = lgl__glTraceEnter(152);
+
+	lgl__glReal_glUniform3iv(location, count, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniform3iv(location, count, value);
+	lgl__glTraceLeave(152, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniform4iv(GLint location, GLsizei count, const GLint *value)
+{
+	double lgl__start = lgl__glTraceEnter(153);
+
+	lgl__glReal_glUniform4iv(location, count, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniform4iv(location, count, value);
+	lgl__glTraceLeave(153, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	double lgl__start = lgl__glTraceEnter(154);
+
+	lgl__glReal_glUniformMatrix2fv(location, count, transpose, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniformMatrix2fv(location, count, transpose, value);
+	lgl__glTraceLeave(154, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	double lgl__start = lgl__glTraceEnter(155);
+
+	lgl__glReal_glUniformMatrix3fv(location, count, transpose, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniformMatrix3fv(location, count, transpose, value);
+	lgl__glTraceLeave(155, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	double lgl__start = lgl__glTraceEnter(156);
+
+	lgl__glReal_glUniformMatrix4fv(location, count, transpose, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniformMatrix4fv(location, count, transpose, value);
+	lgl__glTraceLeave(156, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glValidateProgram(GLuint program)
+{
+	double lgl__start = lgl__glTraceEnter(157);
+
+	lgl__glReal_glValidateProgram(program);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glValidateProgram(program);
+	lgl__glTraceLeave(157, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttrib1d(GLuint index, GLdouble x)
+{
+	double lgl__start = lgl__glTraceEnter(158);
+
+	lgl__glReal_glVertexAttrib1d(index, x);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttrib1d(index, x);
+	lgl__glTraceLeave(158, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttrib1dv(GLuint index, const GLdouble *v)
+{
+	double lgl__start = lgl__glTraceEnter(159);
+
+	lgl__glReal_glVertexAttrib1dv(index, v);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttrib1dv(index, v);
+	lgl__glTraceLeave(159, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttrib1f(GLuint index, GLfloat x)
+{
+	double lgl__start = lgl__glTraceEnter(160);
+
+	lgl__glReal_glVertexAttrib1f(index, x);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttrib1f(index, x);
+	lgl__glTraceLeave(160, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttrib1fv(GLuint index, const GLfloat *v)
+{
+	double lgl__start = lgl__glTraceEnter(161);
+
+	lgl__glReal_glVertexAttrib1fv(index, v);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttrib1fv(index, v);
+	lgl__glTraceLeave(161, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttrib1s(GLuint index, GLshort x)
+{
+	double lgl__start = lgl__glTraceEnter(162);
+
+	lgl__glReal_glVertexAttrib1s(index, x);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttrib1s(index, x);
+	lgl__glTraceLeave(162, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttrib1sv(GLuint index, const GLshort *v)
+{
+	double lgl__start = lgl__glTraceEnter(163);
+
+	lgl__glReal_glVertexAttrib1sv(index, v);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttrib1sv(index, v);
+	lgl__glTraceLeave(163, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y)
+{
+	double lgl__start = lgl__glTraceEnter(164);
+
+	lgl__glReal_glVertexAttrib2d(index, x, y);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttrib2d(index, x, y);
+	lgl__glTraceLeave(164, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttrib2dv(GLuint index, const GLdouble *v)
+{
+	double lgl__start = lgl__glTraceEnter(165);
+
+	lgl__glReal_glVertexAttrib2dv(index, v);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttrib2dv(index, v);
+	lgl__glTraceLeave(165, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y)
+{
+	double lgl__start = lgl__glTraceEnter(166);
+
+	lgl__glReal_glVertexAttrib2f(index, x, y);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttrib2f(index, x, y);
+	lgl__glTraceLeave(166, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttrib2fv(GLuint index, const GLfloat *v)
+{
+	double lgl__start = lgl__glTraceEnter(167);
+
+	lgl__glReal_glVertexAttrib2fv(index, v);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttrib2fv(index, v);
+	lgl__glTraceLeave(167, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttrib2s(GLuint index, GLshort x, GLshort y)
+{
+	double lgl__start = lgl__glTraceEnter(168);
+
+	lgl__glReal_glVertexAttrib2s(index, x, y);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttrib2s(index, x, y);
+	lgl__glTraceLeave(168, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttrib2sv(GLuint index, const GLshort *v)
+{
+	double lgl__start = lgl__glTraceEnter(169);
+
+	lgl__glReal_glVertexAttrib2sv(index, v);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttrib2sv(index, v);
+	lgl__glTraceLeave(169, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z)
+{
+	double lgl__start = lgl__glTraceEnter(170);
+
+	lgl__glReal_glVertexAttrib3d(index, x, y, z);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttrib3d(index, x, y, z);
+	lgl__glTraceLeave(170, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttrib3dv(GLuint index, const GLdouble *v)
+{
+	double lgl__start = lgl__glTraceEnter(171);
+
+	lgl__glReal_glVertexAttrib3dv(index, v);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttrib3dv(index, v);
+	lgl__glTraceLeave(171, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z)
+{
+	double lgl__start = lgl__glTraceEnter(172);
+
+	lgl__glReal_glVertexAttrib3f(index, x, y, z);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttrib3f(index, x, y, z);
+	lgl__glTraceLeave(172, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttrib3fv(GLuint index, const GLfloat *v)
+{
+	double lgl__start = lgl__glTraceEnter(173);
+
+	lgl__glReal_glVertexAttrib3fv(index, v);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttrib3fv(index, v);
+	lgl__glTraceLeave(173, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z)
+{
+	double lgl__start = lgl__glTraceEnter(174);
+
+	lgl__glReal_glVertexAttrib3s(index, x, y, z);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttrib3s(index, x, y, z);
+	lgl__glTraceLeave(174, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttrib3sv(GLuint index, const GLshort *v)
+{
+	double lgl__start = lgl__glTraceEnter(175);
+
+	lgl__glReal_glVertexAttrib3sv(index, v);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttrib3sv(index, v);
+	lgl__glTraceLeave(175, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttrib4Nbv(GLuint index, const GLbyte *v)
+{
+	double lgl__start = lgl__glTraceEnter(176);
+
+	lgl__glReal_glVertexAttrib4Nbv(index, v);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttrib4Nbv(index, v);
+	lgl__glTraceLeave(176, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttrib4Niv(GLuint index, const GLint *v)
+{
+	double lgl__start = lgl__glTraceEnter(177);
+
+	lgl__glReal_glVertexAttrib4Niv(index, v);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttrib4Niv(index, v);
+	lgl__glTraceLeave(177, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttrib4Nsv(GLuint index, const GLshort *v)
+{
+	double lgl__start = lgl__glTraceEnter(178);
+
+	lgl__glReal_glVertexAttrib4Nsv(index, v);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttrib4Nsv(index, v);
+	lgl__glTraceLeave(178, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w)
+{
+	double lgl__start = lgl__glTraceEnter(179);
+
+	lgl__glReal_glVertexAttrib4Nub(index, x, y, z, w);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttrib4Nub(index, x, y, z, w);
+	lgl__glTraceLeave(179, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttrib4Nubv(GLuint index, const GLubyte *v)
+{
+	double lgl__start = lgl__glTraceEnter(180);
+
+	lgl__glReal_glVertexAttrib4Nubv(index, v);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttrib4Nubv(index, v);
+	lgl__glTraceLeave(180, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttrib4Nuiv(GLuint index, const GLuint *v)
+{
+	double lgl__start = lgl__glTraceEnter(181);
+
+	lgl__glReal_glVertexAttrib4Nuiv(index, v);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttrib4Nuiv(index, v);
+	lgl__glTraceLeave(181, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttrib4Nusv(GLuint index, const GLushort *v)
+{
+	double lgl__start = lgl__glTraceEnter(182);
+
+	lgl__glReal_glVertexAttrib4Nusv(index, v);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttrib4Nusv(index, v);
+	lgl__glTraceLeave(182, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttrib4bv(GLuint index, const GLbyte *v)
+{
+	double lgl__start = lgl__glTraceEnter(183);
+
+	lgl__glReal_glVertexAttrib4bv(index, v);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttrib4bv(index, v);
+	lgl__glTraceLeave(183, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+	double lgl__start = lgl__glTraceEnter(184);
+
+	lgl__glReal_glVertexAttrib4d(index, x, y, z, w);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttrib4d(index, x, y, z, w);
+	lgl__glTraceLeave(184, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttrib4dv(GLuint index, const GLdouble *v)
+{
+	double lgl__start = lgl__glTraceEnter(185);
+
+	lgl__glReal_glVertexAttrib4dv(index, v);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttrib4dv(index, v);
+	lgl__glTraceLeave(185, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+	double lgl__start = lgl__glTraceEnter(186);
+
+	lgl__glReal_glVertexAttrib4f(index, x, y, z, w);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttrib4f(index, x, y, z, w);
+	lgl__glTraceLeave(186, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttrib4fv(GLuint index, const GLfloat *v)
+{
+	double lgl__start = lgl__glTraceEnter(187);
+
+	lgl__glReal_glVertexAttrib4fv(index, v);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttrib4fv(index, v);
+	lgl__glTraceLeave(187, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttrib4iv(GLuint index, const GLint *v)
+{
+	double lgl__start = lgl__glTraceEnter(188);
+
+	lgl__glReal_glVertexAttrib4iv(index, v);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttrib4iv(index, v);
+	lgl__glTraceLeave(188, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)
+{
+	double lgl__start = lgl__glTraceEnter(189);
+
+	lgl__glReal_glVertexAttrib4s(index, x, y, z, w);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttrib4s(index, x, y, z, w);
+	lgl__glTraceLeave(189, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttrib4sv(GLuint index, const GLshort *v)
+{
+	double lgl__start = lgl__glTraceEnter(190);
+
+	lgl__glReal_glVertexAttrib4sv(index, v);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttrib4sv(index, v);
+	lgl__glTraceLeave(190, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttrib4ubv(GLuint index, const GLubyte *v)
+{
+	double lgl__start = lgl__glTraceEnter(191);
+
+	lgl__glReal_glVertexAttrib4ubv(index, v);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttrib4ubv(index, v);
+	lgl__glTraceLeave(191, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttrib4uiv(GLuint index, const GLuint *v)
+{
+	double lgl__start = lgl__glTraceEnter(192);
+
+	lgl__glReal_glVertexAttrib4uiv(index, v);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttrib4uiv(index, v);
+	lgl__glTraceLeave(192, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttrib4usv(GLuint index, const GLushort *v)
+{
+	double lgl__start = lgl__glTraceEnter(193);
+
+	lgl__glReal_glVertexAttrib4usv(index, v);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttrib4usv(index, v);
+	lgl__glTraceLeave(193, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer)
+{
+	double lgl__start = lgl__glTraceEnter(194);
+
+	lgl__glReal_glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+	lgl__glTraceLeave(194, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	double lgl__start = lgl__glTraceEnter(195);
+
+	lgl__glReal_glUniformMatrix2x3fv(location, count, transpose, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniformMatrix2x3fv(location, count, transpose, value);
+	lgl__glTraceLeave(195, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	double lgl__start = lgl__glTraceEnter(196);
+
+	lgl__glReal_glUniformMatrix3x2fv(location, count, transpose, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniformMatrix3x2fv(location, count, transpose, value);
+	lgl__glTraceLeave(196, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	double lgl__start = lgl__glTraceEnter(197);
+
+	lgl__glReal_glUniformMatrix2x4fv(location, count, transpose, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniformMatrix2x4fv(location, count, transpose, value);
+	lgl__glTraceLeave(197, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	double lgl__start = lgl__glTraceEnter(198);
+
+	lgl__glReal_glUniformMatrix4x2fv(location, count, transpose, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniformMatrix4x2fv(location, count, transpose, value);
+	lgl__glTraceLeave(198, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	double lgl__start = lgl__glTraceEnter(199);
+
+	lgl__glReal_glUniformMatrix3x4fv(location, count, transpose, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniformMatrix3x4fv(location, count, transpose, value);
+	lgl__glTraceLeave(199, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	double lgl__start = lgl__glTraceEnter(200);
+
+	lgl__glReal_glUniformMatrix4x3fv(location, count, transpose, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniformMatrix4x3fv(location, count, transpose, value);
+	lgl__glTraceLeave(200, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a)
+{
+	double lgl__start = lgl__glTraceEnter(201);
+
+	lgl__glReal_glColorMaski(index, r, g, b, a);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glColorMaski(index, r, g, b, a);
+	lgl__glTraceLeave(201, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetBooleani_v(GLenum target, GLuint index, GLboolean *data)
+{
+	double lgl__start = lgl__glTraceEnter(202);
+
+	lgl__glReal_glGetBooleani_v(target, index, data);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetBooleani_v(target, index, data);
+	lgl__glTraceLeave(202, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetIntegeri_v(GLenum target, GLuint index, GLint *data)
+{
+	double lgl__start = lgl__glTraceEnter(203);
+
+	lgl__glReal_glGetIntegeri_v(target, index, data);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetIntegeri_v(target, index, data);
+	lgl__glTraceLeave(203, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glEnablei(GLenum target, GLuint index)
+{
+	double lgl__start = lgl__glTraceEnter(204);
+
+	lgl__glReal_glEnablei(target, index);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glEnablei(target, index);
+	lgl__glTraceLeave(204, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glDisablei(GLenum target, GLuint index)
+{
+	double lgl__start = lgl__glTraceEnter(205);
+
+	lgl__glReal_glDisablei(target, index);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glDisablei(target, index);
+	lgl__glTraceLeave(205, 0, lgl__start);
+}
+
+static GLboolean APIENTRY lgl__glTrace_glIsEnabledi(GLenum target, GLuint index)
+{
+	GLboolean lgl__result;
+	double lgl__start = lgl__glTraceEnter(206);
+
+	lgl__result = lgl__glReal_glIsEnabledi(target, index);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glIsEnabledi(target, index, lgl__result);
+	lgl__glTraceLeave(206, 1, lgl__start);
+	return lgl__result;
+}
+
+static void APIENTRY lgl__glTrace_glBeginTransformFeedback(GLenum primitiveMode)
+{
+	double lgl__start = lgl__glTraceEnter(207);
+
+	lgl__glReal_glBeginTransformFeedback(primitiveMode);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glBeginTransformFeedback(primitiveMode);
+	lgl__glTraceLeave(207, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glEndTransformFeedback(void)
+{
+	double lgl__start = lgl__glTraceEnter(208);
+
+	lgl__glReal_glEndTransformFeedback();
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glEndTransformFeedback();
+	lgl__glTraceLeave(208, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+	double lgl__start = lgl__glTraceEnter(209);
+
+	lgl__glTraceSet(LGL__GL_BINDBUFFER, target, buffer);
+	lgl__glReal_glBindBufferRange(target, index, buffer, offset, size);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glBindBufferRange(target, index, buffer, offset, size);
+	lgl__glTraceLeave(209, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glBindBufferBase(GLenum target, GLuint index, GLuint buffer)
+{
+	double lgl__start = lgl__glTraceEnter(210);
+
+	lgl__glTraceSet(LGL__GL_BINDBUFFER, target, buffer);
+	lgl__glReal_glBindBufferBase(target, index, buffer);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glBindBufferBase(target, index, buffer);
+	lgl__glTraceLeave(210, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode)
+{
+	double lgl__start = lgl__glTraceEnter(211);
+
+	lgl__glReal_glTransformFeedbackVaryings(program, count, varyings, bufferMode);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTransformFeedbackVaryings(program, count, varyings, bufferMode);
+	lgl__glTraceLeave(211, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name)
+{
+	double lgl__start = lgl__glTraceEnter(212);
+
+	lgl__glReal_glGetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+	lgl__glTraceLeave(212, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glClampColor(GLenum target, GLenum clamp)
+{
+	double lgl__start = lgl__glTraceEnter(213);
+
+	lgl__glReal_glClampColor(target, clamp);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glClampColor(target, clamp);
+	lgl__glTraceLeave(213, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glBeginConditionalRender(GLuint id, GLenum mode)
+{
+	double lgl__start = lgl__glTraceEnter(214);
+
+	lgl__glReal_glBeginConditionalRender(id, mode);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glBeginConditionalRender(id, mode);
+	lgl__glTraceLeave(214, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glEndConditionalRender(void)
+{
+	double lgl__start = lgl__glTraceEnter(215);
+
+	lgl__glReal_glEndConditionalRender();
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glEndConditionalRender();
+	lgl__glTraceLeave(215, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer)
+{
+	double lgl__start = lgl__glTraceEnter(216);
+
+	lgl__glReal_glVertexAttribIPointer(index, size, type, stride, pointer);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttribIPointer(index, size, type, stride, pointer);
+	lgl__glTraceLeave(216, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params)
+{
+	double lgl__start = lgl__glTraceEnter(217);
+
+	lgl__glReal_glGetVertexAttribIiv(index, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetVertexAttribIiv(index, pname, params);
+	lgl__glTraceLeave(217, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params)
+{
+	double lgl__start = lgl__glTraceEnter(218);
+
+	lgl__glReal_glGetVertexAttribIuiv(index, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetVertexAttribIuiv(index, pname, params);
+	lgl__glTraceLeave(218, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttribI1i(GLuint index, GLint x)
+{
+	double lgl__start = lgl__glTraceEnter(219);
+
+	lgl__glReal_glVertexAttribI1i(index, x);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttribI1i(index, x);
+	lgl__glTraceLeave(219, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttribI2i(GLuint index, GLint x, GLint y)
+{
+	double lgl__start = lgl__glTraceEnter(220);
+
+	lgl__glReal_glVertexAttribI2i(index, x, y);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttribI2i(index, x, y);
+	lgl__glTraceLeave(220, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z)
+{
+	double lgl__start = lgl__glTraceEnter(221);
+
+	lgl__glReal_glVertexAttribI3i(index, x, y, z);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttribI3i(index, x, y, z);
+	lgl__glTraceLeave(221, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w)
+{
+	double lgl__start = lgl__glTraceEnter(222);
+
+	lgl__glReal_glVertexAttribI4i(index, x, y, z, w);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttribI4i(index, x, y, z, w);
+	lgl__glTraceLeave(222, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttribI1ui(GLuint index, GLuint x)
+{
+	double lgl__start = lgl__glTraceEnter(223);
+
+	lgl__glReal_glVertexAttribI1ui(index, x);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttribI1ui(index, x);
+	lgl__glTraceLeave(223, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y)
+{
+	double lgl__start = lgl__glTraceEnter(224);
+
+	lgl__glReal_glVertexAttribI2ui(index, x, y);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttribI2ui(index, x, y);
+	lgl__glTraceLeave(224, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z)
+{
+	double lgl__start = lgl__glTraceEnter(225);
+
+	lgl__glReal_glVertexAttribI3ui(index, x, y, z);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttribI3ui(index, x, y, z);
+	lgl__glTraceLeave(225, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w)
+{
+	double lgl__start = lgl__glTraceEnter(226);
+
+	lgl__glReal_glVertexAttribI4ui(index, x, y, z, w);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttribI4ui(index, x, y, z, w);
+	lgl__glTraceLeave(226, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttribI1iv(GLuint index, const GLint *v)
+{
+	double lgl__start = lgl__glTraceEnter(227);
+
+	lgl__glReal_glVertexAttribI1iv(index, v);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttribI1iv(index, v);
+	lgl__glTraceLeave(227, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttribI2iv(GLuint index, const GLint *v)
+{
+	double lgl__start = lgl__glTraceEnter(228);
+
+	lgl__glReal_glVertexAttribI2iv(index, v);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttribI2iv(index, v);
+	lgl__glTraceLeave(228, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttribI3iv(GLuint index, const GLint *v)
+{
+	double lgl__start = lgl__glTraceEnter(229);
+
+	lgl__glReal_glVertexAttribI3iv(index, v);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttribI3iv(index, v);
+	lgl__glTraceLeave(229, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttribI4iv(GLuint index, const GLint *v)
+{
+	double lgl__start = lgl__glTraceEnter(230);
+
+	lgl__glReal_glVertexAttribI4iv(index, v);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttribI4iv(index, v);
+	lgl__glTraceLeave(230, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttribI1uiv(GLuint index, const GLuint *v)
+{
+	double lgl__start = lgl__glTraceEnter(231);
+
+	lgl__glReal_glVertexAttribI1uiv(index, v);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttribI1uiv(index, v);
+	lgl__glTraceLeave(231, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttribI2uiv(GLuint index, const GLuint *v)
+{
+	double lgl__start = lgl__glTraceEnter(232);
+
+	lgl__glReal_glVertexAttribI2uiv(index, v);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttribI2uiv(index, v);
+	lgl__glTraceLeave(232, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttribI3uiv(GLuint index, const GLuint *v)
+{
+	double lgl__start = lgl__glTraceEnter(233);
+
+	lgl__glReal_glVertexAttribI3uiv(index, v);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttribI3uiv(index, v);
+	lgl__glTraceLeave(233, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttribI4uiv(GLuint index, const GLuint *v)
+{
+	double lgl__start = lgl__glTraceEnter(234);
+
+	lgl__glReal_glVertexAttribI4uiv(index, v);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttribI4uiv(index, v);
+	lgl__glTraceLeave(234, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttribI4bv(GLuint index, const GLbyte *v)
+{
+	double lgl__start = lgl__glTraceEnter(235);
+
+	lgl__glReal_glVertexAttribI4bv(index, v);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttribI4bv(index, v);
+	lgl__glTraceLeave(235, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttribI4sv(GLuint index, const GLshort *v)
+{
+	double lgl__start = lgl__glTraceEnter(236);
+
+	lgl__glReal_glVertexAttribI4sv(index, v);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttribI4sv(index, v);
+	lgl__glTraceLeave(236, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttribI4ubv(GLuint index, const GLubyte *v)
+{
+	double lgl__start = lgl__glTraceEnter(237);
+
+	lgl__glReal_glVertexAttribI4ubv(index, v);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttribI4ubv(index, v);
+	lgl__glTraceLeave(237, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttribI4usv(GLuint index, const GLushort *v)
+{
+	double lgl__start = lgl__glTraceEnter(238);
+
+	lgl__glReal_glVertexAttribI4usv(index, v);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttribI4usv(index, v);
+	lgl__glTraceLeave(238, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetUniformuiv(GLuint program, GLint location, GLuint *params)
+{
+	double lgl__start = lgl__glTraceEnter(239);
+
+	lgl__glReal_glGetUniformuiv(program, location, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetUniformuiv(program, location, params);
+	lgl__glTraceLeave(239, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name)
+{
+	double lgl__start = lgl__glTraceEnter(240);
+
+	lgl__glReal_glBindFragDataLocation(program, color, name);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glBindFragDataLocation(program, color, name);
+	lgl__glTraceLeave(240, 0, lgl__start);
+}
+
+static GLint APIENTRY lgl__glTrace_glGetFragDataLocation(GLuint program, const GLchar *name)
+{
+	GLint lgl__result;
+	double lgl__start = lgl__glTraceEnter(241);
+
+	lgl__result = lgl__glReal_glGetFragDataLocation(program, name);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetFragDataLocation(program, name, lgl__result);
+	lgl__glTraceLeave(241, 1, lgl__start);
+	return lgl__result;
+}
+
+static void APIENTRY lgl__glTrace_glUniform1ui(GLint location, GLuint v0)
+{
+	double lgl__start = lgl__glTraceEnter(242);
+
+	lgl__glReal_glUniform1ui(location, v0);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniform1ui(location, v0);
+	lgl__glTraceLeave(242, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniform2ui(GLint location, GLuint v0, GLuint v1)
+{
+	double lgl__start = lgl__glTraceEnter(243);
+
+	lgl__glReal_glUniform2ui(location, v0, v1);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniform2ui(location, v0, v1);
+	lgl__glTraceLeave(243, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2)
+{
+	double lgl__start = lgl__glTraceEnter(244);
+
+	lgl__glReal_glUniform3ui(location, v0, v1, v2);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniform3ui(location, v0, v1, v2);
+	lgl__glTraceLeave(244, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
+{
+	double lgl__start = lgl__glTraceEnter(245);
+
+	lgl__glReal_glUniform4ui(location, v0, v1, v2, v3);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniform4ui(location, v0, v1, v2, v3);
+	lgl__glTraceLeave(245, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniform1uiv(GLint location, GLsizei count, const GLuint *value)
+{
+	double lgl__start = lgl__glTraceEnter(246);
+
+	lgl__glReal_glUniform1uiv(location, count, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniform1uiv(location, count, value);
+	lgl__glTraceLeave(246, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniform2uiv(GLint location, GLsizei count, const GLuint *value)
+{
+	double lgl__start = lgl__glTraceEnter(247);
+
+	lgl__glReal_glUniform2uiv(location, count, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniform2uiv(location, count, value);
+	lgl__glTraceLeave(247, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniform3uiv(GLint location, GLsizei count, const GLuint *value)
+{
+	double lgl__start = lgl__glTraceEnter(248);
+
+	lgl__glReal_glUniform3uiv(location, count, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniform3uiv(location, count, value);
+	lgl__glTraceLeave(248, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniform4uiv(GLint location, GLsizei count, const GLuint *value)
+{
+	double lgl__start = lgl__glTraceEnter(249);
+
+	lgl__glReal_glUniform4uiv(location, count, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniform4uiv(location, count, value);
+	lgl__glTraceLeave(249, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params)
+{
+	double lgl__start = lgl__glTraceEnter(250);
+
+	lgl__glReal_glTexParameterIiv(target, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTexParameterIiv(target, pname, params);
+	lgl__glTraceLeave(250, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params)
+{
+	double lgl__start = lgl__glTraceEnter(251);
+
+	lgl__glReal_glTexParameterIuiv(target, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTexParameterIuiv(target, pname, params);
+	lgl__glTraceLeave(251, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params)
+{
+	double lgl__start = lgl__glTraceEnter(252);
+
+	lgl__glReal_glGetTexParameterIiv(target, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetTexParameterIiv(target, pname, params);
+	lgl__glTraceLeave(252, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params)
+{
+	double lgl__start = lgl__glTraceEnter(253);
+
+	lgl__glReal_glGetTexParameterIuiv(target, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetTexParameterIuiv(target, pname, params);
+	lgl__glTraceLeave(253, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value)
+{
+	double lgl__start = lgl__glTraceEnter(254);
+
+	lgl__glReal_glClearBufferiv(buffer, drawbuffer, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glClearBufferiv(buffer, drawbuffer, value);
+	lgl__glTraceLeave(254, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value)
+{
+	double lgl__start = lgl__glTraceEnter(255);
+
+	lgl__glReal_glClearBufferuiv(buffer, drawbuffer, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glClearBufferuiv(buffer, drawbuffer, value);
+	lgl__glTraceLeave(255, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value)
+{
+	double lgl__start = lgl__glTraceEnter(256);
+
+	lgl__glReal_glClearBufferfv(buffer, drawbuffer, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glClearBufferfv(buffer, drawbuffer, value);
+	lgl__glTraceLeave(256, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil)
+{
+	double lgl__start = lgl__glTraceEnter(257);
+
+	lgl__glReal_glClearBufferfi(buffer, drawbuffer, depth, stencil);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glClearBufferfi(buffer, drawbuffer, depth, stencil);
+	lgl__glTraceLeave(257, 0, lgl__start);
+}
+
+static const GLubyte * APIENTRY lgl__glTrace_glGetStringi(GLenum name, GLuint index)
+{
+	const GLubyte * lgl__result;
+	double lgl__start = lgl__glTraceEnter(258);
+
+	lgl__result = lgl__glReal_glGetStringi(name, index);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetStringi(name, index, lgl__result);
+	lgl__glTraceLeave(258, 1, lgl__start);
+	return lgl__result;
+}
+
+static GLboolean APIENTRY lgl__glTrace_glIsRenderbuffer(GLuint renderbuffer)
+{
+	GLboolean lgl__result;
+	double lgl__start = lgl__glTraceEnter(259);
+
+	lgl__result = lgl__glReal_glIsRenderbuffer(renderbuffer);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glIsRenderbuffer(renderbuffer, lgl__result);
+	lgl__glTraceLeave(259, 1, lgl__start);
+	return lgl__result;
+}
+
+static void APIENTRY lgl__glTrace_glBindRenderbuffer(GLenum target, GLuint renderbuffer)
+{
+	double lgl__start = lgl__glTraceEnter(260);
+
+	lgl__glTraceState(260, LGL__GL_BINDRENDERBUFFER, target, renderbuffer);
+	lgl__glReal_glBindRenderbuffer(target, renderbuffer);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glBindRenderbuffer(target, renderbuffer);
+	lgl__glTraceLeave(260, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers)
+{
+	double lgl__start = lgl__glTraceEnter(261);
+
+	lgl__glTraceForget(LGL__GL_BINDRENDERBUFFER, n, renderbuffers);
+	lgl__glReal_glDeleteRenderbuffers(n, renderbuffers);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glDeleteRenderbuffers(n, renderbuffers);
+	lgl__glTraceLeave(261, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers)
+{
+	double lgl__start = lgl__glTraceEnter(262);
+
+	lgl__glReal_glGenRenderbuffers(n, renderbuffers);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGenRenderbuffers(n, renderbuffers);
+	lgl__glTraceLeave(262, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height)
+{
+	double lgl__start = lgl__glTraceEnter(263);
+
+	lgl__glReal_glRenderbufferStorage(target, internalformat, width, height);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glRenderbufferStorage(target, internalformat, width, height);
+	lgl__glTraceLeave(263, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params)
+{
+	double lgl__start = lgl__glTraceEnter(264);
+
+	lgl__glReal_glGetRenderbufferParameteriv(target, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetRenderbufferParameteriv(target, pname, params);
+	lgl__glTraceLeave(264, 1, lgl__start);
+}
+
+static GLboolean APIENTRY lgl__glTrace_glIsFramebuffer(GLuint framebuffer)
+{
+	GLboolean lgl__result;
+	double lgl__start = lgl__glTraceEnter(265);
+
+	lgl__result = lgl__glReal_glIsFramebuffer(framebuffer);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glIsFramebuffer(framebuffer, lgl__result);
+	lgl__glTraceLeave(265, 1, lgl__start);
+	return lgl__result;
+}
+
+static void APIENTRY lgl__glTrace_glBindFramebuffer(GLenum target, GLuint framebuffer)
+{
+	double lgl__start = lgl__glTraceEnter(266);
+
+	lgl__glTraceBindFramebuffer(266, LGL__GL_BINDFRAMEBUFFER, target, framebuffer);
+	lgl__glReal_glBindFramebuffer(target, framebuffer);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glBindFramebuffer(target, framebuffer);
+	lgl__glTraceLeave(266, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers)
+{
+	double lgl__start = lgl__glTraceEnter(267);
+
+	lgl__glTraceForget(LGL__GL_BINDFRAMEBUFFER, n, framebuffers);
+	lgl__glReal_glDeleteFramebuffers(n, framebuffers);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glDeleteFramebuffers(n, framebuffers);
+	lgl__glTraceLeave(267, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGenFramebuffers(GLsizei n, GLuint *framebuffers)
+{
+	double lgl__start = lgl__glTraceEnter(268);
+
+	lgl__glReal_glGenFramebuffers(n, framebuffers);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGenFramebuffers(n, framebuffers);
+	lgl__glTraceLeave(268, 0, lgl__start);
+}
+
+static GLenum APIENTRY lgl__glTrace_glCheckFramebufferStatus(GLenum target)
+{
+	GLenum lgl__result;
+	double lgl__start = lgl__glTraceEnter(269);
+
+	lgl__result = lgl__glReal_glCheckFramebufferStatus(target);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glCheckFramebufferStatus(target, lgl__result);
+	lgl__glTraceLeave(269, 1, lgl__start);
+	return lgl__result;
+}
+
+static void APIENTRY lgl__glTrace_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+	double lgl__start = lgl__glTraceEnter(270);
+
+	lgl__glReal_glFramebufferTexture1D(target, attachment, textarget, texture, level);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glFramebufferTexture1D(target, attachment, textarget, texture, level);
+	lgl__glTraceLeave(270, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+	double lgl__start = lgl__glTraceEnter(271);
+
+	lgl__glReal_glFramebufferTexture2D(target, attachment, textarget, texture, level);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glFramebufferTexture2D(target, attachment, textarget, texture, level);
+	lgl__glTraceLeave(271, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset)
+{
+	double lgl__start = lgl__glTraceEnter(272);
+
+	lgl__glReal_glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+	lgl__glTraceLeave(272, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
+{
+	double lgl__start = lgl__glTraceEnter(273);
+
+	lgl__glReal_glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+	lgl__glTraceLeave(273, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params)
+{
+	double lgl__start = lgl__glTraceEnter(274);
+
+	lgl__glReal_glGetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+	lgl__glTraceLeave(274, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGenerateMipmap(GLenum target)
+{
+	double lgl__start = lgl__glTraceEnter(275);
+
+	lgl__glReal_glGenerateMipmap(target);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGenerateMipmap(target);
+	lgl__glTraceLeave(275, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)
+{
+	double lgl__start = lgl__glTraceEnter(276);
+
+	lgl__glReal_glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+	lgl__glTraceLeave(276, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)
+{
+	double lgl__start = lgl__glTraceEnter(277);
+
+	lgl__glReal_glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+	lgl__glTraceLeave(277, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer)
+{
+	double lgl__start = lgl__glTraceEnter(278);
+
+	lgl__glReal_glFramebufferTextureLayer(target, attachment, texture, level, layer);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glFramebufferTextureLayer(target, attachment, texture, level, layer);
+	lgl__glTraceLeave(278, 0, lgl__start);
+}
+
+static void * APIENTRY lgl__glTrace_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+	void * lgl__result;
+	double lgl__start = lgl__glTraceEnter(279);
+
+	lgl__result = lgl__glReal_glMapBufferRange(target, offset, length, access);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glMapBufferRange(target, offset, length, access, lgl__result);
+	lgl__glTraceLeave(279, 1, lgl__start);
+	return lgl__result;
+}
+
+static void APIENTRY lgl__glTrace_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length)
+{
+	double lgl__start = lgl__glTraceEnter(280);
+
+	lgl__glReal_glFlushMappedBufferRange(target, offset, length);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glFlushMappedBufferRange(target, offset, length);
+	lgl__glTraceLeave(280, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glBindVertexArray(GLuint array)
+{
+	double lgl__start = lgl__glTraceEnter(281);
+
+	lgl__glTraceState(281, LGL__GL_BINDVERTEXARRAY, 0, array);
+	lgl__glTrace.vertexArray = array;
+	lgl__glReal_glBindVertexArray(array);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glBindVertexArray(array);
+	lgl__glTraceLeave(281, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glDeleteVertexArrays(GLsizei n, const GLuint *arrays)
+{
+	double lgl__start = lgl__glTraceEnter(282);
+
+	lgl__glTraceForget(LGL__GL_BINDVERTEXARRAY, n, arrays);
+	lgl__glTraceForgetVertexArrays(LGL__GL_BINDBUFFER, n, arrays);
+	lgl__glReal_glDeleteVertexArrays(n, arrays);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glDeleteVertexArrays(n, arrays);
+	lgl__glTraceLeave(282, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGenVertexArrays(GLsizei n, GLuint *arrays)
+{
+	double lgl__start = lgl__glTraceEnter(283);
+
+	lgl__glReal_glGenVertexArrays(n, arrays);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGenVertexArrays(n, arrays);
+	lgl__glTraceLeave(283, 0, lgl__start);
+}
+
+static GLboolean APIENTRY lgl__glTrace_glIsVertexArray(GLuint array)
+{
+	GLboolean lgl__result;
+	double lgl__start = lgl__glTraceEnter(284);
+
+	lgl__result = lgl__glReal_glIsVertexArray(array);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glIsVertexArray(array, lgl__result);
+	lgl__glTraceLeave(284, 1, lgl__start);
+	return lgl__result;
+}
+
+static void APIENTRY lgl__glTrace_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount)
+{
+	double lgl__start = lgl__glTraceEnter(285);
+
+	lgl__glReal_glDrawArraysInstanced(mode, first, count, instancecount);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glDrawArraysInstanced(mode, first, count, instancecount);
+	lgl__glTraceLeave(285, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount)
+{
+	double lgl__start = lgl__glTraceEnter(286);
+
+	lgl__glReal_glDrawElementsInstanced(mode, count, type, indices, instancecount);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glDrawElementsInstanced(mode, count, type, indices, instancecount);
+	lgl__glTraceLeave(286, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer)
+{
+	double lgl__start = lgl__glTraceEnter(287);
+
+	lgl__glReal_glTexBuffer(target, internalformat, buffer);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTexBuffer(target, internalformat, buffer);
+	lgl__glTraceLeave(287, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glPrimitiveRestartIndex(GLuint index)
+{
+	double lgl__start = lgl__glTraceEnter(288);
+
+	lgl__glReal_glPrimitiveRestartIndex(index);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glPrimitiveRestartIndex(index);
+	lgl__glTraceLeave(288, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
+{
+	double lgl__start = lgl__glTraceEnter(289);
+
+	lgl__glReal_glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+	lgl__glTraceLeave(289, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices)
+{
+	double lgl__start = lgl__glTraceEnter(290);
+
+	lgl__glReal_glGetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+	lgl__glTraceLeave(290, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params)
+{
+	double lgl__start = lgl__glTraceEnter(291);
+
+	lgl__glReal_glGetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+	lgl__glTraceLeave(291, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName)
+{
+	double lgl__start = lgl__glTraceEnter(292);
+
+	lgl__glReal_glGetActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+	lgl__glTraceLeave(292, 1, lgl__start);
+}
+
+static GLuint APIENTRY lgl__glTrace_glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName)
+{
+	GLuint lgl__result;
+	double lgl__start = lgl__glTraceEnter(293);
+
+	lgl__result = lgl__glReal_glGetUniformBlockIndex(program, uniformBlockName);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetUniformBlockIndex(program, uniformBlockName, lgl__result);
+	lgl__glTraceLeave(293, 1, lgl__start);
+	return lgl__result;
+}
+
+static void APIENTRY lgl__glTrace_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params)
+{
+	double lgl__start = lgl__glTraceEnter(294);
+
+	lgl__glReal_glGetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+	lgl__glTraceLeave(294, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName)
+{
+	double lgl__start = lgl__glTraceEnter(295);
+
+	lgl__glReal_glGetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+	lgl__glTraceLeave(295, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding)
+{
+	double lgl__start = lgl__glTraceEnter(296);
+
+	lgl__glReal_glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+	lgl__glTraceLeave(296, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex)
+{
+	double lgl__start = lgl__glTraceEnter(297);
+
+	lgl__glReal_glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+	lgl__glTraceLeave(297, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex)
+{
+	double lgl__start = lgl__glTraceEnter(298);
+
+	lgl__glReal_glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+	lgl__glTraceLeave(298, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex)
+{
+	double lgl__start = lgl__glTraceEnter(299);
+
+	lgl__glReal_glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+	lgl__glTraceLeave(299, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex)
+{
+	double lgl__start = lgl__glTraceEnter(300);
+
+	lgl__glReal_glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+	lgl__glTraceLeave(300, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProvokingVertex(GLenum mode)
+{
+	double lgl__start = lgl__glTraceEnter(301);
+
+	lgl__glReal_glProvokingVertex(mode);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProvokingVertex(mode);
+	lgl__glTraceLeave(301, 0, lgl__start);
+}
+
+static GLsync APIENTRY lgl__glTrace_glFenceSync(GLenum condition, GLbitfield flags)
+{
+	GLsync lgl__result;
+	double lgl__start = lgl__glTraceEnter(302);
+
+	lgl__result = lgl__glReal_glFenceSync(condition, flags);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glFenceSync(condition, flags, lgl__result);
+	lgl__glTraceLeave(302, 0, lgl__start);
+	return lgl__result;
+}
+
+static GLboolean APIENTRY lgl__glTrace_glIsSync(GLsync sync)
+{
+	GLboolean lgl__result;
+	double lgl__start = lgl__glTraceEnter(303);
+
+	lgl__result = lgl__glReal_glIsSync(sync);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glIsSync(sync, lgl__result);
+	lgl__glTraceLeave(303, 1, lgl__start);
+	return lgl__result;
+}
+
+static void APIENTRY lgl__glTrace_glDeleteSync(GLsync sync)
+{
+	double lgl__start = lgl__glTraceEnter(304);
+
+	lgl__glReal_glDeleteSync(sync);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glDeleteSync(sync);
+	lgl__glTraceLeave(304, 0, lgl__start);
+}
+
+static GLenum APIENTRY lgl__glTrace_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+	GLenum lgl__result;
+	double lgl__start = lgl__glTraceEnter(305);
+
+	lgl__result = lgl__glReal_glClientWaitSync(sync, flags, timeout);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glClientWaitSync(sync, flags, timeout, lgl__result);
+	lgl__glTraceLeave(305, 1, lgl__start);
+	return lgl__result;
+}
+
+static void APIENTRY lgl__glTrace_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+	double lgl__start = lgl__glTraceEnter(306);
+
+	lgl__glReal_glWaitSync(sync, flags, timeout);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glWaitSync(sync, flags, timeout);
+	lgl__glTraceLeave(306, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetInteger64v(GLenum pname, GLint64 *data)
+{
+	double lgl__start = lgl__glTraceEnter(307);
+
+	lgl__glReal_glGetInteger64v(pname, data);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetInteger64v(pname, data);
+	lgl__glTraceLeave(307, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values)
+{
+	double lgl__start = lgl__glTraceEnter(308);
+
+	lgl__glReal_glGetSynciv(sync, pname, count, length, values);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetSynciv(sync, pname, count, length, values);
+	lgl__glTraceLeave(308, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data)
+{
+	double lgl__start = lgl__glTraceEnter(309);
+
+	lgl__glReal_glGetInteger64i_v(target, index, data);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetInteger64i_v(target, index, data);
+	lgl__glTraceLeave(309, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params)
+{
+	double lgl__start = lgl__glTraceEnter(310);
+
+	lgl__glReal_glGetBufferParameteri64v(target, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetBufferParameteri64v(target, pname, params);
+	lgl__glTraceLeave(310, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level)
+{
+	double lgl__start = lgl__glTraceEnter(311);
+
+	lgl__glReal_glFramebufferTexture(target, attachment, texture, level);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glFramebufferTexture(target, attachment, texture, level);
+	lgl__glTraceLeave(311, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
+{
+	double lgl__start = lgl__glTraceEnter(312);
+
+	lgl__glReal_glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+	lgl__glTraceLeave(312, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
+{
+	double lgl__start = lgl__glTraceEnter(313);
+
+	lgl__glReal_glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+	lgl__glTraceLeave(313, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val)
+{
+	double lgl__start = lgl__glTraceEnter(314);
+
+	lgl__glReal_glGetMultisamplefv(pname, index, val);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetMultisamplefv(pname, index, val);
+	lgl__glTraceLeave(314, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glSampleMaski(GLuint maskNumber, GLbitfield mask)
+{
+	double lgl__start = lgl__glTraceEnter(315);
+
+	lgl__glReal_glSampleMaski(maskNumber, mask);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glSampleMaski(maskNumber, mask);
+	lgl__glTraceLeave(315, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name)
+{
+	double lgl__start = lgl__glTraceEnter(316);
+
+	lgl__glReal_glBindFragDataLocationIndexed(program, colorNumber, index, name);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glBindFragDataLocationIndexed(program, colorNumber, index, name);
+	lgl__glTraceLeave(316, 0, lgl__start);
+}
+
+static GLint APIENTRY lgl__glTrace_glGetFragDataIndex(GLuint program, const GLchar *name)
+{
+	GLint lgl__result;
+	double lgl__start = lgl__glTraceEnter(317);
+
+	lgl__result = lgl__glReal_glGetFragDataIndex(program, name);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetFragDataIndex(program, name, lgl__result);
+	lgl__glTraceLeave(317, 1, lgl__start);
+	return lgl__result;
+}
+
+static void APIENTRY lgl__glTrace_glGenSamplers(GLsizei count, GLuint *samplers)
+{
+	double lgl__start = lgl__glTraceEnter(318);
+
+	lgl__glReal_glGenSamplers(count, samplers);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGenSamplers(count, samplers);
+	lgl__glTraceLeave(318, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glDeleteSamplers(GLsizei count, const GLuint *samplers)
+{
+	double lgl__start = lgl__glTraceEnter(319);
+
+	lgl__glTraceForget(LGL__GL_BINDSAMPLER, count, samplers);
+	lgl__glReal_glDeleteSamplers(count, samplers);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glDeleteSamplers(count, samplers);
+	lgl__glTraceLeave(319, 0, lgl__start);
+}
+
+static GLboolean APIENTRY lgl__glTrace_glIsSampler(GLuint sampler)
+{
+	GLboolean lgl__result;
+	double lgl__start = lgl__glTraceEnter(320);
+
+	lgl__result = lgl__glReal_glIsSampler(sampler);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glIsSampler(sampler, lgl__result);
+	lgl__glTraceLeave(320, 1, lgl__start);
+	return lgl__result;
+}
+
+static void APIENTRY lgl__glTrace_glBindSampler(GLuint unit, GLuint sampler)
+{
+	double lgl__start = lgl__glTraceEnter(321);
+
+	lgl__glTraceState(321, LGL__GL_BINDSAMPLER, unit, sampler);
+	lgl__glReal_glBindSampler(unit, sampler);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glBindSampler(unit, sampler);
+	lgl__glTraceLeave(321, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param)
+{
+	double lgl__start = lgl__glTraceEnter(322);
+
+	lgl__glReal_glSamplerParameteri(sampler, pname, param);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glSamplerParameteri(sampler, pname, param);
+	lgl__glTraceLeave(322, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param)
+{
+	double lgl__start = lgl__glTraceEnter(323);
+
+	lgl__glReal_glSamplerParameteriv(sampler, pname, param);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glSamplerParameteriv(sampler, pname, param);
+	lgl__glTraceLeave(323, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param)
+{
+	double lgl__start = lgl__glTraceEnter(324);
+
+	lgl__glReal_glSamplerParameterf(sampler, pname, param);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glSamplerParameterf(sampler, pname, param);
+	lgl__glTraceLeave(324, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param)
+{
+	double lgl__start = lgl__glTraceEnter(325);
+
+	lgl__glReal_glSamplerParameterfv(sampler, pname, param);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glSamplerParameterfv(sampler, pname, param);
+	lgl__glTraceLeave(325, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param)
+{
+	double lgl__start = lgl__glTraceEnter(326);
+
+	lgl__glReal_glSamplerParameterIiv(sampler, pname, param);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glSamplerParameterIiv(sampler, pname, param);
+	lgl__glTraceLeave(326, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param)
+{
+	double lgl__start = lgl__glTraceEnter(327);
+
+	lgl__glReal_glSamplerParameterIuiv(sampler, pname, param);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glSamplerParameterIuiv(sampler, pname, param);
+	lgl__glTraceLeave(327, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params)
+{
+	double lgl__start = lgl__glTraceEnter(328);
+
+	lgl__glReal_glGetSamplerParameteriv(sampler, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetSamplerParameteriv(sampler, pname, params);
+	lgl__glTraceLeave(328, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params)
+{
+	double lgl__start = lgl__glTraceEnter(329);
+
+	lgl__glReal_glGetSamplerParameterIiv(sampler, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetSamplerParameterIiv(sampler, pname, params);
+	lgl__glTraceLeave(329, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params)
+{
+	double lgl__start = lgl__glTraceEnter(330);
+
+	lgl__glReal_glGetSamplerParameterfv(sampler, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetSamplerParameterfv(sampler, pname, params);
+	lgl__glTraceLeave(330, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params)
+{
+	double lgl__start = lgl__glTraceEnter(331);
+
+	lgl__glReal_glGetSamplerParameterIuiv(sampler, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetSamplerParameterIuiv(sampler, pname, params);
+	lgl__glTraceLeave(331, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glQueryCounter(GLuint id, GLenum target)
+{
+	double lgl__start = lgl__glTraceEnter(332);
+
+	lgl__glReal_glQueryCounter(id, target);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glQueryCounter(id, target);
+	lgl__glTraceLeave(332, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params)
+{
+	double lgl__start = lgl__glTraceEnter(333);
+
+	lgl__glReal_glGetQueryObjecti64v(id, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetQueryObjecti64v(id, pname, params);
+	lgl__glTraceLeave(333, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params)
+{
+	double lgl__start = lgl__glTraceEnter(334);
+
+	lgl__glReal_glGetQueryObjectui64v(id, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetQueryObjectui64v(id, pname, params);
+	lgl__glTraceLeave(334, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttribDivisor(GLuint index, GLuint divisor)
+{
+	double lgl__start = lgl__glTraceEnter(335);
+
+	lgl__glReal_glVertexAttribDivisor(index, divisor);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttribDivisor(index, divisor);
+	lgl__glTraceLeave(335, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+	double lgl__start = lgl__glTraceEnter(336);
+
+	lgl__glReal_glVertexAttribP1ui(index, type, normalized, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttribP1ui(index, type, normalized, value);
+	lgl__glTraceLeave(336, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+{
+	double lgl__start = lgl__glTraceEnter(337);
+
+	lgl__glReal_glVertexAttribP1uiv(index, type, normalized, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttribP1uiv(index, type, normalized, value);
+	lgl__glTraceLeave(337, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+	double lgl__start = lgl__glTraceEnter(338);
+
+	lgl__glReal_glVertexAttribP2ui(index, type, normalized, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttribP2ui(index, type, normalized, value);
+	lgl__glTraceLeave(338, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+{
+	double lgl__start = lgl__glTraceEnter(339);
+
+	lgl__glReal_glVertexAttribP2uiv(index, type, normalized, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttribP2uiv(index, type, normalized, value);
+	lgl__glTraceLeave(339, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+	double lgl__start = lgl__glTraceEnter(340);
+
+	lgl__glReal_glVertexAttribP3ui(index, type, normalized, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttribP3ui(index, type, normalized, value);
+	lgl__glTraceLeave(340, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+{
+	double lgl__start = lgl__glTraceEnter(341);
+
+	lgl__glReal_glVertexAttribP3uiv(index, type, normalized, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttribP3uiv(index, type, normalized, value);
+	lgl__glTraceLeave(341, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+	double lgl__start = lgl__glTraceEnter(342);
+
+	lgl__glReal_glVertexAttribP4ui(index, type, normalized, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttribP4ui(index, type, normalized, value);
+	lgl__glTraceLeave(342, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+{
+	double lgl__start = lgl__glTraceEnter(343);
+
+	lgl__glReal_glVertexAttribP4uiv(index, type, normalized, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttribP4uiv(index, type, normalized, value);
+	lgl__glTraceLeave(343, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexP2ui(GLenum type, GLuint value)
+{
+	double lgl__start = lgl__glTraceEnter(344);
+
+	lgl__glReal_glVertexP2ui(type, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexP2ui(type, value);
+	lgl__glTraceLeave(344, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexP2uiv(GLenum type, const GLuint *value)
+{
+	double lgl__start = lgl__glTraceEnter(345);
+
+	lgl__glReal_glVertexP2uiv(type, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexP2uiv(type, value);
+	lgl__glTraceLeave(345, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexP3ui(GLenum type, GLuint value)
+{
+	double lgl__start = lgl__glTraceEnter(346);
+
+	lgl__glReal_glVertexP3ui(type, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexP3ui(type, value);
+	lgl__glTraceLeave(346, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexP3uiv(GLenum type, const GLuint *value)
+{
+	double lgl__start = lgl__glTraceEnter(347);
+
+	lgl__glReal_glVertexP3uiv(type, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexP3uiv(type, value);
+	lgl__glTraceLeave(347, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexP4ui(GLenum type, GLuint value)
+{
+	double lgl__start = lgl__glTraceEnter(348);
+
+	lgl__glReal_glVertexP4ui(type, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexP4ui(type, value);
+	lgl__glTraceLeave(348, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexP4uiv(GLenum type, const GLuint *value)
+{
+	double lgl__start = lgl__glTraceEnter(349);
+
+	lgl__glReal_glVertexP4uiv(type, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexP4uiv(type, value);
+	lgl__glTraceLeave(349, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTexCoordP1ui(GLenum type, GLuint coords)
+{
+	double lgl__start = lgl__glTraceEnter(350);
+
+	lgl__glReal_glTexCoordP1ui(type, coords);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTexCoordP1ui(type, coords);
+	lgl__glTraceLeave(350, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTexCoordP1uiv(GLenum type, const GLuint *coords)
+{
+	double lgl__start = lgl__glTraceEnter(351);
+
+	lgl__glReal_glTexCoordP1uiv(type, coords);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTexCoordP1uiv(type, coords);
+	lgl__glTraceLeave(351, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTexCoordP2ui(GLenum type, GLuint coords)
+{
+	double lgl__start = lgl__glTraceEnter(352);
+
+	lgl__glReal_glTexCoordP2ui(type, coords);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTexCoordP2ui(type, coords);
+	lgl__glTraceLeave(352, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTexCoordP2uiv(GLenum type, const GLuint *coords)
+{
+	double lgl__start = lgl__glTraceEnter(353);
+
+	lgl__glReal_glTexCoordP2uiv(type, coords);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTexCoordP2uiv(type, coords);
+	lgl__glTraceLeave(353, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTexCoordP3ui(GLenum type, GLuint coords)
+{
+	double lgl__start = lgl__glTraceEnter(354);
+
+	lgl__glReal_glTexCoordP3ui(type, coords);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTexCoordP3ui(type, coords);
+	lgl__glTraceLeave(354, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTexCoordP3uiv(GLenum type, const GLuint *coords)
+{
+	double lgl__start = lgl__glTraceEnter(355);
+
+	lgl__glReal_glTexCoordP3uiv(type, coords);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTexCoordP3uiv(type, coords);
+	lgl__glTraceLeave(355, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTexCoordP4ui(GLenum type, GLuint coords)
+{
+	double lgl__start = lgl__glTraceEnter(356);
+
+	lgl__glReal_glTexCoordP4ui(type, coords);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTexCoordP4ui(type, coords);
+	lgl__glTraceLeave(356, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTexCoordP4uiv(GLenum type, const GLuint *coords)
+{
+	double lgl__start = lgl__glTraceEnter(357);
+
+	lgl__glReal_glTexCoordP4uiv(type, coords);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTexCoordP4uiv(type, coords);
+	lgl__glTraceLeave(357, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords)
+{
+	double lgl__start = lgl__glTraceEnter(358);
+
+	lgl__glReal_glMultiTexCoordP1ui(texture, type, coords);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glMultiTexCoordP1ui(texture, type, coords);
+	lgl__glTraceLeave(358, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glMultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint *coords)
+{
+	double lgl__start = lgl__glTraceEnter(359);
+
+	lgl__glReal_glMultiTexCoordP1uiv(texture, type, coords);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glMultiTexCoordP1uiv(texture, type, coords);
+	lgl__glTraceLeave(359, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords)
+{
+	double lgl__start = lgl__glTraceEnter(360);
+
+	lgl__glReal_glMultiTexCoordP2ui(texture, type, coords);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glMultiTexCoordP2ui(texture, type, coords);
+	lgl__glTraceLeave(360, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glMultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint *coords)
+{
+	double lgl__start = lgl__glTraceEnter(361);
+
+	lgl__glReal_glMultiTexCoordP2uiv(texture, type, coords);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glMultiTexCoordP2uiv(texture, type, coords);
+	lgl__glTraceLeave(361, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords)
+{
+	double lgl__start = lgl__glTraceEnter(362);
+
+	lgl__glReal_glMultiTexCoordP3ui(texture, type, coords);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glMultiTexCoordP3ui(texture, type, coords);
+	lgl__glTraceLeave(362, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glMultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint *coords)
+{
+	double lgl__start = lgl__glTraceEnter(363);
+
+	lgl__glReal_glMultiTexCoordP3uiv(texture, type, coords);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glMultiTexCoordP3uiv(texture, type, coords);
+	lgl__glTraceLeave(363, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords)
+{
+	double lgl__start = lgl__glTraceEnter(364);
+
+	lgl__glReal_glMultiTexCoordP4ui(texture, type, coords);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glMultiTexCoordP4ui(texture, type, coords);
+	lgl__glTraceLeave(364, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glMultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint *coords)
+{
+	double lgl__start = lgl__glTraceEnter(365);
+
+	lgl__glReal_glMultiTexCoordP4uiv(texture, type, coords);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glMultiTexCoordP4uiv(texture, type, coords);
+	lgl__glTraceLeave(365, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glNormalP3ui(GLenum type, GLuint coords)
+{
+	double lgl__start = lgl__glTraceEnter(366);
+
+	lgl__glReal_glNormalP3ui(type, coords);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glNormalP3ui(type, coords);
+	lgl__glTraceLeave(366, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glNormalP3uiv(GLenum type, const GLuint *coords)
+{
+	double lgl__start = lgl__glTraceEnter(367);
+
+	lgl__glReal_glNormalP3uiv(type, coords);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glNormalP3uiv(type, coords);
+	lgl__glTraceLeave(367, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glColorP3ui(GLenum type, GLuint color)
+{
+	double lgl__start = lgl__glTraceEnter(368);
+
+	lgl__glReal_glColorP3ui(type, color);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glColorP3ui(type, color);
+	lgl__glTraceLeave(368, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glColorP3uiv(GLenum type, const GLuint *color)
+{
+	double lgl__start = lgl__glTraceEnter(369);
+
+	lgl__glReal_glColorP3uiv(type, color);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glColorP3uiv(type, color);
+	lgl__glTraceLeave(369, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glColorP4ui(GLenum type, GLuint color)
+{
+	double lgl__start = lgl__glTraceEnter(370);
+
+	lgl__glReal_glColorP4ui(type, color);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glColorP4ui(type, color);
+	lgl__glTraceLeave(370, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glColorP4uiv(GLenum type, const GLuint *color)
+{
+	double lgl__start = lgl__glTraceEnter(371);
+
+	lgl__glReal_glColorP4uiv(type, color);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glColorP4uiv(type, color);
+	lgl__glTraceLeave(371, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glSecondaryColorP3ui(GLenum type, GLuint color)
+{
+	double lgl__start = lgl__glTraceEnter(372);
+
+	lgl__glReal_glSecondaryColorP3ui(type, color);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glSecondaryColorP3ui(type, color);
+	lgl__glTraceLeave(372, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glSecondaryColorP3uiv(GLenum type, const GLuint *color)
+{
+	double lgl__start = lgl__glTraceEnter(373);
+
+	lgl__glReal_glSecondaryColorP3uiv(type, color);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glSecondaryColorP3uiv(type, color);
+	lgl__glTraceLeave(373, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glMinSampleShading(GLfloat value)
+{
+	double lgl__start = lgl__glTraceEnter(374);
+
+	lgl__glReal_glMinSampleShading(value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glMinSampleShading(value);
+	lgl__glTraceLeave(374, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glBlendEquationi(GLuint buf, GLenum mode)
+{
+	double lgl__start = lgl__glTraceEnter(375);
+
+	lgl__glReal_glBlendEquationi(buf, mode);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glBlendEquationi(buf, mode);
+	lgl__glTraceLeave(375, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glBlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum modeAlpha)
+{
+	double lgl__start = lgl__glTraceEnter(376);
+
+	lgl__glReal_glBlendEquationSeparatei(buf, modeRGB, modeAlpha);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glBlendEquationSeparatei(buf, modeRGB, modeAlpha);
+	lgl__glTraceLeave(376, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glBlendFunci(GLuint buf, GLenum src, GLenum dst)
+{
+	double lgl__start = lgl__glTraceEnter(377);
+
+	lgl__glReal_glBlendFunci(buf, src, dst);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glBlendFunci(buf, src, dst);
+	lgl__glTraceLeave(377, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glBlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
+{
+	double lgl__start = lgl__glTraceEnter(378);
+
+	lgl__glReal_glBlendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glBlendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+	lgl__glTraceLeave(378, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glDrawArraysIndirect(GLenum mode, const void *indirect)
+{
+	double lgl__start = lgl__glTraceEnter(379);
+
+	lgl__glReal_glDrawArraysIndirect(mode, indirect);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glDrawArraysIndirect(mode, indirect);
+	lgl__glTraceLeave(379, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect)
+{
+	double lgl__start = lgl__glTraceEnter(380);
+
+	lgl__glReal_glDrawElementsIndirect(mode, type, indirect);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glDrawElementsIndirect(mode, type, indirect);
+	lgl__glTraceLeave(380, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniform1d(GLint location, GLdouble x)
+{
+	double lgl__start = lgl__glTraceEnter(381);
+
+	lgl__glReal_glUniform1d(location, x);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniform1d(location, x);
+	lgl__glTraceLeave(381, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniform2d(GLint location, GLdouble x, GLdouble y)
+{
+	double lgl__start = lgl__glTraceEnter(382);
+
+	lgl__glReal_glUniform2d(location, x, y);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniform2d(location, x, y);
+	lgl__glTraceLeave(382, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniform3d(GLint location, GLdouble x, GLdouble y, GLdouble z)
+{
+	double lgl__start = lgl__glTraceEnter(383);
+
+	lgl__glReal_glUniform3d(location, x, y, z);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniform3d(location, x, y, z);
+	lgl__glTraceLeave(383, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniform4d(GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+	double lgl__start = lgl__glTraceEnter(384);
+
+	lgl__glReal_glUniform4d(location, x, y, z, w);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniform4d(location, x, y, z, w);
+	lgl__glTraceLeave(384, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniform1dv(GLint location, GLsizei count, const GLdouble *value)
+{
+	double lgl__start = lgl__glTraceEnter(385);
+
+	lgl__glReal_glUniform1dv(location, count, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniform1dv(location, count, value);
+	lgl__glTraceLeave(385, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniform2dv(GLint location, GLsizei count, const GLdouble *value)
+{
+	double lgl__start = lgl__glTraceEnter(386);
+
+	lgl__glReal_glUniform2dv(location, count, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniform2dv(location, count, value);
+	lgl__glTraceLeave(386, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniform3dv(GLint location, GLsizei count, const GLdouble *value)
+{
+	double lgl__start = lgl__glTraceEnter(387);
+
+	lgl__glReal_glUniform3dv(location, count, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniform3dv(location, count, value);
+	lgl__glTraceLeave(387, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniform4dv(GLint location, GLsizei count, const GLdouble *value)
+{
+	double lgl__start = lgl__glTraceEnter(388);
+
+	lgl__glReal_glUniform4dv(location, count, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniform4dv(location, count, value);
+	lgl__glTraceLeave(388, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniformMatrix2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	double lgl__start = lgl__glTraceEnter(389);
+
+	lgl__glReal_glUniformMatrix2dv(location, count, transpose, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniformMatrix2dv(location, count, transpose, value);
+	lgl__glTraceLeave(389, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniformMatrix3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	double lgl__start = lgl__glTraceEnter(390);
+
+	lgl__glReal_glUniformMatrix3dv(location, count, transpose, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniformMatrix3dv(location, count, transpose, value);
+	lgl__glTraceLeave(390, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniformMatrix4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	double lgl__start = lgl__glTraceEnter(391);
+
+	lgl__glReal_glUniformMatrix4dv(location, count, transpose, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniformMatrix4dv(location, count, transpose, value);
+	lgl__glTraceLeave(391, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniformMatrix2x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	double lgl__start = lgl__glTraceEnter(392);
+
+	lgl__glReal_glUniformMatrix2x3dv(location, count, transpose, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniformMatrix2x3dv(location, count, transpose, value);
+	lgl__glTraceLeave(392, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniformMatrix2x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	double lgl__start = lgl__glTraceEnter(393);
+
+	lgl__glReal_glUniformMatrix2x4dv(location, count, transpose, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniformMatrix2x4dv(location, count, transpose, value);
+	lgl__glTraceLeave(393, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniformMatrix3x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	double lgl__start = lgl__glTraceEnter(394);
+
+	lgl__glReal_glUniformMatrix3x2dv(location, count, transpose, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniformMatrix3x2dv(location, count, transpose, value);
+	lgl__glTraceLeave(394, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniformMatrix3x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	double lgl__start = lgl__glTraceEnter(395);
+
+	lgl__glReal_glUniformMatrix3x4dv(location, count, transpose, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniformMatrix3x4dv(location, count, transpose, value);
+	lgl__glTraceLeave(395, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniformMatrix4x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	double lgl__start = lgl__glTraceEnter(396);
+
+	lgl__glReal_glUniformMatrix4x2dv(location, count, transpose, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniformMatrix4x2dv(location, count, transpose, value);
+	lgl__glTraceLeave(396, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniformMatrix4x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	double lgl__start = lgl__glTraceEnter(397);
+
+	lgl__glReal_glUniformMatrix4x3dv(location, count, transpose, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniformMatrix4x3dv(location, count, transpose, value);
+	lgl__glTraceLeave(397, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetUniformdv(GLuint program, GLint location, GLdouble *params)
+{
+	double lgl__start = lgl__glTraceEnter(398);
+
+	lgl__glReal_glGetUniformdv(program, location, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetUniformdv(program, location, params);
+	lgl__glTraceLeave(398, 1, lgl__start);
+}
+
+static GLint APIENTRY lgl__glTrace_glGetSubroutineUniformLocation(GLuint program, GLenum shadertype, const GLchar *name)
+{
+	GLint lgl__result;
+	double lgl__start = lgl__glTraceEnter(399);
+
+	lgl__result = lgl__glReal_glGetSubroutineUniformLocation(program, shadertype, name);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetSubroutineUniformLocation(program, shadertype, name, lgl__result);
+	lgl__glTraceLeave(399, 1, lgl__start);
+	return lgl__result;
+}
+
+static GLuint APIENTRY lgl__glTrace_glGetSubroutineIndex(GLuint program, GLenum shadertype, const GLchar *name)
+{
+	GLuint lgl__result;
+	double lgl__start = lgl__glTraceEnter(400);
+
+	lgl__result = lgl__glReal_glGetSubroutineIndex(program, shadertype, name);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetSubroutineIndex(program, shadertype, name, lgl__result);
+	lgl__glTraceLeave(400, 1, lgl__start);
+	return lgl__result;
+}
+
+static void APIENTRY lgl__glTrace_glGetActiveSubroutineUniformiv(GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint *values)
+{
+	double lgl__start = lgl__glTraceEnter(401);
+
+	lgl__glReal_glGetActiveSubroutineUniformiv(program, shadertype, index, pname, values);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetActiveSubroutineUniformiv(program, shadertype, index, pname, values);
+	lgl__glTraceLeave(401, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetActiveSubroutineUniformName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name)
+{
+	double lgl__start = lgl__glTraceEnter(402);
+
+	lgl__glReal_glGetActiveSubroutineUniformName(program, shadertype, index, bufSize, length, name);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetActiveSubroutineUniformName(program, shadertype, index, bufSize, length, name);
+	lgl__glTraceLeave(402, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetActiveSubroutineName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name)
+{
+	double lgl__start = lgl__glTraceEnter(403);
+
+	lgl__glReal_glGetActiveSubroutineName(program, shadertype, index, bufSize, length, name);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetActiveSubroutineName(program, shadertype, index, bufSize, length, name);
+	lgl__glTraceLeave(403, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUniformSubroutinesuiv(GLenum shadertype, GLsizei count, const GLuint *indices)
+{
+	double lgl__start = lgl__glTraceEnter(404);
+
+	lgl__glReal_glUniformSubroutinesuiv(shadertype, count, indices);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUniformSubroutinesuiv(shadertype, count, indices);
+	lgl__glTraceLeave(404, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetUniformSubroutineuiv(GLenum shadertype, GLint location, GLuint *params)
+{
+	double lgl__start = lgl__glTraceEnter(405);
+
+	lgl__glReal_glGetUniformSubroutineuiv(shadertype, location, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetUniformSubroutineuiv(shadertype, location, params);
+	lgl__glTraceLeave(405, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetProgramStageiv(GLuint program, GLenum shadertype, GLenum pname, GLint *values)
+{
+	double lgl__start = lgl__glTraceEnter(406);
+
+	lgl__glReal_glGetProgramStageiv(program, shadertype, pname, values);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetProgramStageiv(program, shadertype, pname, values);
+	lgl__glTraceLeave(406, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glPatchParameteri(GLenum pname, GLint value)
+{
+	double lgl__start = lgl__glTraceEnter(407);
+
+	lgl__glReal_glPatchParameteri(pname, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glPatchParameteri(pname, value);
+	lgl__glTraceLeave(407, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glPatchParameterfv(GLenum pname, const GLfloat *values)
+{
+	double lgl__start = lgl__glTraceEnter(408);
+
+	lgl__glReal_glPatchParameterfv(pname, values);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glPatchParameterfv(pname, values);
+	lgl__glTraceLeave(408, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glBindTransformFeedback(GLenum target, GLuint id)
+{
+	double lgl__start = lgl__glTraceEnter(409);
+
+	lgl__glReal_glBindTransformFeedback(target, id);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glBindTransformFeedback(target, id);
+	lgl__glTraceLeave(409, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glDeleteTransformFeedbacks(GLsizei n, const GLuint *ids)
+{
+	double lgl__start = lgl__glTraceEnter(410);
+
+	lgl__glReal_glDeleteTransformFeedbacks(n, ids);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glDeleteTransformFeedbacks(n, ids);
+	lgl__glTraceLeave(410, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGenTransformFeedbacks(GLsizei n, GLuint *ids)
+{
+	double lgl__start = lgl__glTraceEnter(411);
+
+	lgl__glReal_glGenTransformFeedbacks(n, ids);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGenTransformFeedbacks(n, ids);
+	lgl__glTraceLeave(411, 0, lgl__start);
+}
+
+static GLboolean APIENTRY lgl__glTrace_glIsTransformFeedback(GLuint id)
+{
+	GLboolean lgl__result;
+	double lgl__start = lgl__glTraceEnter(412);
+
+	lgl__result = lgl__glReal_glIsTransformFeedback(id);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glIsTransformFeedback(id, lgl__result);
+	lgl__glTraceLeave(412, 1, lgl__start);
+	return lgl__result;
+}
+
+static void APIENTRY lgl__glTrace_glPauseTransformFeedback(void)
+{
+	double lgl__start = lgl__glTraceEnter(413);
+
+	lgl__glReal_glPauseTransformFeedback();
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glPauseTransformFeedback();
+	lgl__glTraceLeave(413, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glResumeTransformFeedback(void)
+{
+	double lgl__start = lgl__glTraceEnter(414);
+
+	lgl__glReal_glResumeTransformFeedback();
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glResumeTransformFeedback();
+	lgl__glTraceLeave(414, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glDrawTransformFeedback(GLenum mode, GLuint id)
+{
+	double lgl__start = lgl__glTraceEnter(415);
+
+	lgl__glReal_glDrawTransformFeedback(mode, id);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glDrawTransformFeedback(mode, id);
+	lgl__glTraceLeave(415, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glDrawTransformFeedbackStream(GLenum mode, GLuint id, GLuint stream)
+{
+	double lgl__start = lgl__glTraceEnter(416);
+
+	lgl__glReal_glDrawTransformFeedbackStream(mode, id, stream);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glDrawTransformFeedbackStream(mode, id, stream);
+	lgl__glTraceLeave(416, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glBeginQueryIndexed(GLenum target, GLuint index, GLuint id)
+{
+	double lgl__start = lgl__glTraceEnter(417);
+
+	lgl__glReal_glBeginQueryIndexed(target, index, id);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glBeginQueryIndexed(target, index, id);
+	lgl__glTraceLeave(417, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glEndQueryIndexed(GLenum target, GLuint index)
+{
+	double lgl__start = lgl__glTraceEnter(418);
+
+	lgl__glReal_glEndQueryIndexed(target, index);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glEndQueryIndexed(target, index);
+	lgl__glTraceLeave(418, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetQueryIndexediv(GLenum target, GLuint index, GLenum pname, GLint *params)
+{
+	double lgl__start = lgl__glTraceEnter(419);
+
+	lgl__glReal_glGetQueryIndexediv(target, index, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetQueryIndexediv(target, index, pname, params);
+	lgl__glTraceLeave(419, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glReleaseShaderCompiler(void)
+{
+	double lgl__start = lgl__glTraceEnter(420);
+
+	lgl__glReal_glReleaseShaderCompiler();
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glReleaseShaderCompiler();
+	lgl__glTraceLeave(420, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glShaderBinary(GLsizei count, const GLuint *shaders, GLenum binaryFormat, const void *binary, GLsizei length)
+{
+	double lgl__start = lgl__glTraceEnter(421);
+
+	lgl__glReal_glShaderBinary(count, shaders, binaryFormat, binary, length);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glShaderBinary(count, shaders, binaryFormat, binary, length);
+	lgl__glTraceLeave(421, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetShaderPrecisionFormat(GLenum shadertype, GLenum precisiontype, GLint *range, GLint *precision)
+{
+	double lgl__start = lgl__glTraceEnter(422);
+
+	lgl__glReal_glGetShaderPrecisionFormat(shadertype, precisiontype, range, precision);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetShaderPrecisionFormat(shadertype, precisiontype, range, precision);
+	lgl__glTraceLeave(422, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glDepthRangef(GLfloat n, GLfloat f)
+{
+	double lgl__start = lgl__glTraceEnter(423);
+
+	lgl__glReal_glDepthRangef(n, f);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glDepthRangef(n, f);
+	lgl__glTraceLeave(423, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glClearDepthf(GLfloat d)
+{
+	double lgl__start = lgl__glTraceEnter(424);
+
+	lgl__glReal_glClearDepthf(d);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glClearDepthf(d);
+	lgl__glTraceLeave(424, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary)
+{
+	double lgl__start = lgl__glTraceEnter(425);
+
+	lgl__glReal_glGetProgramBinary(program, bufSize, length, binaryFormat, binary);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetProgramBinary(program, bufSize, length, binaryFormat, binary);
+	lgl__glTraceLeave(425, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length)
+{
+	double lgl__start = lgl__glTraceEnter(426);
+
+	lgl__glReal_glProgramBinary(program, binaryFormat, binary, length);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramBinary(program, binaryFormat, binary, length);
+	lgl__glTraceLeave(426, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramParameteri(GLuint program, GLenum pname, GLint value)
+{
+	double lgl__start = lgl__glTraceEnter(427);
+
+	lgl__glReal_glProgramParameteri(program, pname, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramParameteri(program, pname, value);
+	lgl__glTraceLeave(427, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glUseProgramStages(GLuint pipeline, GLbitfield stages, GLuint program)
+{
+	double lgl__start = lgl__glTraceEnter(428);
+
+	lgl__glReal_glUseProgramStages(pipeline, stages, program);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUseProgramStages(pipeline, stages, program);
+	lgl__glTraceLeave(428, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glActiveShaderProgram(GLuint pipeline, GLuint program)
+{
+	double lgl__start = lgl__glTraceEnter(429);
+
+	lgl__glReal_glActiveShaderProgram(pipeline, program);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glActiveShaderProgram(pipeline, program);
+	lgl__glTraceLeave(429, 0, lgl__start);
+}
+
+static GLuint APIENTRY lgl__glTrace_glCreateShaderProgramv(GLenum type, GLsizei count, const GLchar *const*strings)
+{
+	GLuint lgl__result;
+	double lgl__start = lgl__glTraceEnter(430);
+
+	lgl__result = lgl__glReal_glCreateShaderProgramv(type, count, strings);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glCreateShaderProgramv(type, count, strings, lgl__result);
+	lgl__glTraceLeave(430, 0, lgl__start);
+	return lgl__result;
+}
+
+static void APIENTRY lgl__glTrace_glBindProgramPipeline(GLuint pipeline)
+{
+	double lgl__start = lgl__glTraceEnter(431);
+
+	lgl__glReal_glBindProgramPipeline(pipeline);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glBindProgramPipeline(pipeline);
+	lgl__glTraceLeave(431, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glDeleteProgramPipelines(GLsizei n, const GLuint *pipelines)
+{
+	double lgl__start = lgl__glTraceEnter(432);
+
+	lgl__glReal_glDeleteProgramPipelines(n, pipelines);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glDeleteProgramPipelines(n, pipelines);
+	lgl__glTraceLeave(432, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGenProgramPipelines(GLsizei n, GLuint *pipelines)
+{
+	double lgl__start = lgl__glTraceEnter(433);
+
+	lgl__glReal_glGenProgramPipelines(n, pipelines);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGenProgramPipelines(n, pipelines);
+	lgl__glTraceLeave(433, 0, lgl__start);
+}
+
+static GLboolean APIENTRY lgl__glTrace_glIsProgramPipeline(GLuint pipeline)
+{
+	GLboolean lgl__result;
+	double lgl__start = lgl__glTraceEnter(434);
+
+	lgl__result = lgl__glReal_glIsProgramPipeline(pipeline);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glIsProgramPipeline(pipeline, lgl__result);
+	lgl__glTraceLeave(434, 1, lgl__start);
+	return lgl__result;
+}
+
+static void APIENTRY lgl__glTrace_glGetProgramPipelineiv(GLuint pipeline, GLenum pname, GLint *params)
+{
+	double lgl__start = lgl__glTraceEnter(435);
+
+	lgl__glReal_glGetProgramPipelineiv(pipeline, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetProgramPipelineiv(pipeline, pname, params);
+	lgl__glTraceLeave(435, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniform1i(GLuint program, GLint location, GLint v0)
+{
+	double lgl__start = lgl__glTraceEnter(436);
+
+	lgl__glReal_glProgramUniform1i(program, location, v0);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniform1i(program, location, v0);
+	lgl__glTraceLeave(436, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniform1iv(GLuint program, GLint location, GLsizei count, const GLint *value)
+{
+	double lgl__start = lgl__glTraceEnter(437);
+
+	lgl__glReal_glProgramUniform1iv(program, location, count, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniform1iv(program, location, count, value);
+	lgl__glTraceLeave(437, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniform1f(GLuint program, GLint location, GLfloat v0)
+{
+	double lgl__start = lgl__glTraceEnter(438);
+
+	lgl__glReal_glProgramUniform1f(program, location, v0);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniform1f(program, location, v0);
+	lgl__glTraceLeave(438, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniform1fv(GLuint program, GLint location, GLsizei count, const GLfloat *value)
+{
+	double lgl__start = lgl__glTraceEnter(439);
+
+	lgl__glReal_glProgramUniform1fv(program, location, count, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniform1fv(program, location, count, value);
+	lgl__glTraceLeave(439, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniform1d(GLuint program, GLint location, GLdouble v0)
+{
+	double lgl__start = lgl__glTraceEnter(440);
+
+	lgl__glReal_glProgramUniform1d(program, location, v0);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniform1d(program, location, v0);
+	lgl__glTraceLeave(440, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniform1dv(GLuint program, GLint location, GLsizei count, const GLdouble *value)
+{
+	double lgl__start = lgl__glTraceEnter(441);
+
+	lgl__glReal_glProgramUniform1dv(program, location, count, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniform1dv(program, location, count, value);
+	lgl__glTraceLeave(441, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniform1ui(GLuint program, GLint location, GLuint v0)
+{
+	double lgl__start = lgl__glTraceEnter(442);
+
+	lgl__glReal_glProgramUniform1ui(program, location, v0);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniform1ui(program, location, v0);
+	lgl__glTraceLeave(442, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniform1uiv(GLuint program, GLint location, GLsizei count, const GLuint *value)
+{
+	double lgl__start = lgl__glTraceEnter(443);
+
+	lgl__glReal_glProgramUniform1uiv(program, location, count, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniform1uiv(program, location, count, value);
+	lgl__glTraceLeave(443, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniform2i(GLuint program, GLint location, GLint v0, GLint v1)
+{
+	double lgl__start = lgl__glTraceEnter(444);
+
+	lgl__glReal_glProgramUniform2i(program, location, v0, v1);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniform2i(program, location, v0, v1);
+	lgl__glTraceLeave(444, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniform2iv(GLuint program, GLint location, GLsizei count, const GLint *value)
+{
+	double lgl__start = lgl__glTraceEnter(445);
+
+	lgl__glReal_glProgramUniform2iv(program, location, count, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniform2iv(program, location, count, value);
+	lgl__glTraceLeave(445, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniform2f(GLuint program, GLint location, GLfloat v0, GLfloat v1)
+{
+	double lgl__start = lgl__glTraceEnter(446);
+
+	lgl__glReal_glProgramUniform2f(program, location, v0, v1);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniform2f(program, location, v0, v1);
+	lgl__glTraceLeave(446, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniform2fv(GLuint program, GLint location, GLsizei count, const GLfloat *value)
+{
+	double lgl__start = lgl__glTraceEnter(447);
+
+	lgl__glReal_glProgramUniform2fv(program, location, count, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniform2fv(program, location, count, value);
+	lgl__glTraceLeave(447, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniform2d(GLuint program, GLint location, GLdouble v0, GLdouble v1)
+{
+	double lgl__start = lgl__glTraceEnter(448);
+
+	lgl__glReal_glProgramUniform2d(program, location, v0, v1);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniform2d(program, location, v0, v1);
+	lgl__glTraceLeave(448, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniform2dv(GLuint program, GLint location, GLsizei count, const GLdouble *value)
+{
+	double lgl__start = lgl__glTraceEnter(449);
+
+	lgl__glReal_glProgramUniform2dv(program, location, count, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniform2dv(program, location, count, value);
+	lgl__glTraceLeave(449, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniform2ui(GLuint program, GLint location, GLuint v0, GLuint v1)
+{
+	double lgl__start = lgl__glTraceEnter(450);
+
+	lgl__glReal_glProgramUniform2ui(program, location, v0, v1);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniform2ui(program, location, v0, v1);
+	lgl__glTraceLeave(450, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniform2uiv(GLuint program, GLint location, GLsizei count, const GLuint *value)
+{
+	double lgl__start = lgl__glTraceEnter(451);
+
+	lgl__glReal_glProgramUniform2uiv(program, location, count, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniform2uiv(program, location, count, value);
+	lgl__glTraceLeave(451, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniform3i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2)
+{
+	double lgl__start = lgl__glTraceEnter(452);
+
+	lgl__glReal_glProgramUniform3i(program, location, v0, v1, v2);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniform3i(program, location, v0, v1, v2);
+	lgl__glTraceLeave(452, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniform3iv(GLuint program, GLint location, GLsizei count, const GLint *value)
+{
+	double lgl__start = lgl__glTraceEnter(453);
+
+	lgl__glReal_glProgramUniform3iv(program, location, count, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniform3iv(program, location, count, value);
+	lgl__glTraceLeave(453, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+{
+	double lgl__start = lgl__glTraceEnter(454);
+
+	lgl__glReal_glProgramUniform3f(program, location, v0, v1, v2);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniform3f(program, location, v0, v1, v2);
+	lgl__glTraceLeave(454, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniform3fv(GLuint program, GLint location, GLsizei count, const GLfloat *value)
+{
+	double lgl__start = lgl__glTraceEnter(455);
+
+	lgl__glReal_glProgramUniform3fv(program, location, count, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniform3fv(program, location, count, value);
+	lgl__glTraceLeave(455, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniform3d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2)
+{
+	double lgl__start = lgl__glTraceEnter(456);
+
+	lgl__glReal_glProgramUniform3d(program, location, v0, v1, v2);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniform3d(program, location, v0, v1, v2);
+	lgl__glTraceLeave(456, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniform3dv(GLuint program, GLint location, GLsizei count, const GLdouble *value)
+{
+	double lgl__start = lgl__glTraceEnter(457);
+
+	lgl__glReal_glProgramUniform3dv(program, location, count, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniform3dv(program, location, count, value);
+	lgl__glTraceLeave(457, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniform3ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2)
+{
+	double lgl__start = lgl__glTraceEnter(458);
+
+	lgl__glReal_glProgramUniform3ui(program, location, v0, v1, v2);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniform3ui(program, location, v0, v1, v2);
+	lgl__glTraceLeave(458, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniform3uiv(GLuint program, GLint location, GLsizei count, const GLuint *value)
+{
+	double lgl__start = lgl__glTraceEnter(459);
+
+	lgl__glReal_glProgramUniform3uiv(program, location, count, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniform3uiv(program, location, count, value);
+	lgl__glTraceLeave(459, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniform4i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+{
+	double lgl__start = lgl__glTraceEnter(460);
+
+	lgl__glReal_glProgramUniform4i(program, location, v0, v1, v2, v3);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniform4i(program, location, v0, v1, v2, v3);
+	lgl__glTraceLeave(460, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniform4iv(GLuint program, GLint location, GLsizei count, const GLint *value)
+{
+	double lgl__start = lgl__glTraceEnter(461);
+
+	lgl__glReal_glProgramUniform4iv(program, location, count, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniform4iv(program, location, count, value);
+	lgl__glTraceLeave(461, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+{
+	double lgl__start = lgl__glTraceEnter(462);
+
+	lgl__glReal_glProgramUniform4f(program, location, v0, v1, v2, v3);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniform4f(program, location, v0, v1, v2, v3);
+	lgl__glTraceLeave(462, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniform4fv(GLuint program, GLint location, GLsizei count, const GLfloat *value)
+{
+	double lgl__start = lgl__glTraceEnter(463);
+
+	lgl__glReal_glProgramUniform4fv(program, location, count, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniform4fv(program, location, count, value);
+	lgl__glTraceLeave(463, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniform4d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3)
+{
+	double lgl__start = lgl__glTraceEnter(464);
+
+	lgl__glReal_glProgramUniform4d(program, location, v0, v1, v2, v3);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniform4d(program, location, v0, v1, v2, v3);
+	lgl__glTraceLeave(464, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniform4dv(GLuint program, GLint location, GLsizei count, const GLdouble *value)
+{
+	double lgl__start = lgl__glTraceEnter(465);
+
+	lgl__glReal_glProgramUniform4dv(program, location, count, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniform4dv(program, location, count, value);
+	lgl__glTraceLeave(465, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniform4ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
+{
+	double lgl__start = lgl__glTraceEnter(466);
+
+	lgl__glReal_glProgramUniform4ui(program, location, v0, v1, v2, v3);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniform4ui(program, location, v0, v1, v2, v3);
+	lgl__glTraceLeave(466, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniform4uiv(GLuint program, GLint location, GLsizei count, const GLuint *value)
+{
+	double lgl__start = lgl__glTraceEnter(467);
+
+	lgl__glReal_glProgramUniform4uiv(program, location, count, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniform4uiv(program, location, count, value);
+	lgl__glTraceLeave(467, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniformMatrix2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	double lgl__start = lgl__glTraceEnter(468);
+
+	lgl__glReal_glProgramUniformMatrix2fv(program, location, count, transpose, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniformMatrix2fv(program, location, count, transpose, value);
+	lgl__glTraceLeave(468, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniformMatrix3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	double lgl__start = lgl__glTraceEnter(469);
+
+	lgl__glReal_glProgramUniformMatrix3fv(program, location, count, transpose, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniformMatrix3fv(program, location, count, transpose, value);
+	lgl__glTraceLeave(469, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniformMatrix4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	double lgl__start = lgl__glTraceEnter(470);
+
+	lgl__glReal_glProgramUniformMatrix4fv(program, location, count, transpose, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniformMatrix4fv(program, location, count, transpose, value);
+	lgl__glTraceLeave(470, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniformMatrix2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	double lgl__start = lgl__glTraceEnter(471);
+
+	lgl__glReal_glProgramUniformMatrix2dv(program, location, count, transpose, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniformMatrix2dv(program, location, count, transpose, value);
+	lgl__glTraceLeave(471, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniformMatrix3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	double lgl__start = lgl__glTraceEnter(472);
+
+	lgl__glReal_glProgramUniformMatrix3dv(program, location, count, transpose, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniformMatrix3dv(program, location, count, transpose, value);
+	lgl__glTraceLeave(472, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniformMatrix4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	double lgl__start = lgl__glTraceEnter(473);
+
+	lgl__glReal_glProgramUniformMatrix4dv(program, location, count, transpose, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniformMatrix4dv(program, location, count, transpose, value);
+	lgl__glTraceLeave(473, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniformMatrix2x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	double lgl__start = lgl__glTraceEnter(474);
+
+	lgl__glReal_glProgramUniformMatrix2x3fv(program, location, count, transpose, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniformMatrix2x3fv(program, location, count, transpose, value);
+	lgl__glTraceLeave(474, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniformMatrix3x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	double lgl__start = lgl__glTraceEnter(475);
+
+	lgl__glReal_glProgramUniformMatrix3x2fv(program, location, count, transpose, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniformMatrix3x2fv(program, location, count, transpose, value);
+	lgl__glTraceLeave(475, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniformMatrix2x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	double lgl__start = lgl__glTraceEnter(476);
+
+	lgl__glReal_glProgramUniformMatrix2x4fv(program, location, count, transpose, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniformMatrix2x4fv(program, location, count, transpose, value);
+	lgl__glTraceLeave(476, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniformMatrix4x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	double lgl__start = lgl__glTraceEnter(477);
+
+	lgl__glReal_glProgramUniformMatrix4x2fv(program, location, count, transpose, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniformMatrix4x2fv(program, location, count, transpose, value);
+	lgl__glTraceLeave(477, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniformMatrix3x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	double lgl__start = lgl__glTraceEnter(478);
+
+	lgl__glReal_glProgramUniformMatrix3x4fv(program, location, count, transpose, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniformMatrix3x4fv(program, location, count, transpose, value);
+	lgl__glTraceLeave(478, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniformMatrix4x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	double lgl__start = lgl__glTraceEnter(479);
+
+	lgl__glReal_glProgramUniformMatrix4x3fv(program, location, count, transpose, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniformMatrix4x3fv(program, location, count, transpose, value);
+	lgl__glTraceLeave(479, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniformMatrix2x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	double lgl__start = lgl__glTraceEnter(480);
+
+	lgl__glReal_glProgramUniformMatrix2x3dv(program, location, count, transpose, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniformMatrix2x3dv(program, location, count, transpose, value);
+	lgl__glTraceLeave(480, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniformMatrix3x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	double lgl__start = lgl__glTraceEnter(481);
+
+	lgl__glReal_glProgramUniformMatrix3x2dv(program, location, count, transpose, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniformMatrix3x2dv(program, location, count, transpose, value);
+	lgl__glTraceLeave(481, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniformMatrix2x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	double lgl__start = lgl__glTraceEnter(482);
+
+	lgl__glReal_glProgramUniformMatrix2x4dv(program, location, count, transpose, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniformMatrix2x4dv(program, location, count, transpose, value);
+	lgl__glTraceLeave(482, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniformMatrix4x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	double lgl__start = lgl__glTraceEnter(483);
+
+	lgl__glReal_glProgramUniformMatrix4x2dv(program, location, count, transpose, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniformMatrix4x2dv(program, location, count, transpose, value);
+	lgl__glTraceLeave(483, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniformMatrix3x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	double lgl__start = lgl__glTraceEnter(484);
+
+	lgl__glReal_glProgramUniformMatrix3x4dv(program, location, count, transpose, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniformMatrix3x4dv(program, location, count, transpose, value);
+	lgl__glTraceLeave(484, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glProgramUniformMatrix4x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	double lgl__start = lgl__glTraceEnter(485);
+
+	lgl__glReal_glProgramUniformMatrix4x3dv(program, location, count, transpose, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glProgramUniformMatrix4x3dv(program, location, count, transpose, value);
+	lgl__glTraceLeave(485, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glValidateProgramPipeline(GLuint pipeline)
+{
+	double lgl__start = lgl__glTraceEnter(486);
+
+	lgl__glReal_glValidateProgramPipeline(pipeline);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glValidateProgramPipeline(pipeline);
+	lgl__glTraceLeave(486, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetProgramPipelineInfoLog(GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+	double lgl__start = lgl__glTraceEnter(487);
+
+	lgl__glReal_glGetProgramPipelineInfoLog(pipeline, bufSize, length, infoLog);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetProgramPipelineInfoLog(pipeline, bufSize, length, infoLog);
+	lgl__glTraceLeave(487, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttribL1d(GLuint index, GLdouble x)
+{
+	double lgl__start = lgl__glTraceEnter(488);
+
+	lgl__glReal_glVertexAttribL1d(index, x);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttribL1d(index, x);
+	lgl__glTraceLeave(488, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttribL2d(GLuint index, GLdouble x, GLdouble y)
+{
+	double lgl__start = lgl__glTraceEnter(489);
+
+	lgl__glReal_glVertexAttribL2d(index, x, y);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttribL2d(index, x, y);
+	lgl__glTraceLeave(489, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttribL3d(GLuint index, GLdouble x, GLdouble y, GLdouble z)
+{
+	double lgl__start = lgl__glTraceEnter(490);
+
+	lgl__glReal_glVertexAttribL3d(index, x, y, z);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttribL3d(index, x, y, z);
+	lgl__glTraceLeave(490, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttribL4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+	double lgl__start = lgl__glTraceEnter(491);
+
+	lgl__glReal_glVertexAttribL4d(index, x, y, z, w);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttribL4d(index, x, y, z, w);
+	lgl__glTraceLeave(491, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttribL1dv(GLuint index, const GLdouble *v)
+{
+	double lgl__start = lgl__glTraceEnter(492);
+
+	lgl__glReal_glVertexAttribL1dv(index, v);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttribL1dv(index, v);
+	lgl__glTraceLeave(492, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttribL2dv(GLuint index, const GLdouble *v)
+{
+	double lgl__start = lgl__glTraceEnter(493);
+
+	lgl__glReal_glVertexAttribL2dv(index, v);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttribL2dv(index, v);
+	lgl__glTraceLeave(493, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttribL3dv(GLuint index, const GLdouble *v)
+{
+	double lgl__start = lgl__glTraceEnter(494);
+
+	lgl__glReal_glVertexAttribL3dv(index, v);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttribL3dv(index, v);
+	lgl__glTraceLeave(494, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttribL4dv(GLuint index, const GLdouble *v)
+{
+	double lgl__start = lgl__glTraceEnter(495);
+
+	lgl__glReal_glVertexAttribL4dv(index, v);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttribL4dv(index, v);
+	lgl__glTraceLeave(495, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttribLPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer)
+{
+	double lgl__start = lgl__glTraceEnter(496);
+
+	lgl__glReal_glVertexAttribLPointer(index, size, type, stride, pointer);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttribLPointer(index, size, type, stride, pointer);
+	lgl__glTraceLeave(496, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetVertexAttribLdv(GLuint index, GLenum pname, GLdouble *params)
+{
+	double lgl__start = lgl__glTraceEnter(497);
+
+	lgl__glReal_glGetVertexAttribLdv(index, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetVertexAttribLdv(index, pname, params);
+	lgl__glTraceLeave(497, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glViewportArrayv(GLuint first, GLsizei count, const GLfloat *v)
+{
+	double lgl__start = lgl__glTraceEnter(498);
+
+	lgl__glReal_glViewportArrayv(first, count, v);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glViewportArrayv(first, count, v);
+	lgl__glTraceLeave(498, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glViewportIndexedf(GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h)
+{
+	double lgl__start = lgl__glTraceEnter(499);
+
+	lgl__glReal_glViewportIndexedf(index, x, y, w, h);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glViewportIndexedf(index, x, y, w, h);
+	lgl__glTraceLeave(499, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glViewportIndexedfv(GLuint index, const GLfloat *v)
+{
+	double lgl__start = lgl__glTraceEnter(500);
+
+	lgl__glReal_glViewportIndexedfv(index, v);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glViewportIndexedfv(index, v);
+	lgl__glTraceLeave(500, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glScissorArrayv(GLuint first, GLsizei count, const GLint *v)
+{
+	double lgl__start = lgl__glTraceEnter(501);
+
+	lgl__glReal_glScissorArrayv(first, count, v);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glScissorArrayv(first, count, v);
+	lgl__glTraceLeave(501, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glScissorIndexed(GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height)
+{
+	double lgl__start = lgl__glTraceEnter(502);
+
+	lgl__glReal_glScissorIndexed(index, left, bottom, width, height);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glScissorIndexed(index, left, bottom, width, height);
+	lgl__glTraceLeave(502, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glScissorIndexedv(GLuint index, const GLint *v)
+{
+	double lgl__start = lgl__glTraceEnter(503);
+
+	lgl__glReal_glScissorIndexedv(index, v);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glScissorIndexedv(index, v);
+	lgl__glTraceLeave(503, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glDepthRangeArrayv(GLuint first, GLsizei count, const GLdouble *v)
+{
+	double lgl__start = lgl__glTraceEnter(504);
+
+	lgl__glReal_glDepthRangeArrayv(first, count, v);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glDepthRangeArrayv(first, count, v);
+	lgl__glTraceLeave(504, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glDepthRangeIndexed(GLuint index, GLdouble n, GLdouble f)
+{
+	double lgl__start = lgl__glTraceEnter(505);
+
+	lgl__glReal_glDepthRangeIndexed(index, n, f);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glDepthRangeIndexed(index, n, f);
+	lgl__glTraceLeave(505, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetFloati_v(GLenum target, GLuint index, GLfloat *data)
+{
+	double lgl__start = lgl__glTraceEnter(506);
+
+	lgl__glReal_glGetFloati_v(target, index, data);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetFloati_v(target, index, data);
+	lgl__glTraceLeave(506, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetDoublei_v(GLenum target, GLuint index, GLdouble *data)
+{
+	double lgl__start = lgl__glTraceEnter(507);
+
+	lgl__glReal_glGetDoublei_v(target, index, data);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetDoublei_v(target, index, data);
+	lgl__glTraceLeave(507, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glDrawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance)
+{
+	double lgl__start = lgl__glTraceEnter(508);
+
+	lgl__glReal_glDrawArraysInstancedBaseInstance(mode, first, count, instancecount, baseinstance);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glDrawArraysInstancedBaseInstance(mode, first, count, instancecount, baseinstance);
+	lgl__glTraceLeave(508, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glDrawElementsInstancedBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance)
+{
+	double lgl__start = lgl__glTraceEnter(509);
+
+	lgl__glReal_glDrawElementsInstancedBaseInstance(mode, count, type, indices, instancecount, baseinstance);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glDrawElementsInstancedBaseInstance(mode, count, type, indices, instancecount, baseinstance);
+	lgl__glTraceLeave(509, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glDrawElementsInstancedBaseVertexBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance)
+{
+	double lgl__start = lgl__glTraceEnter(510);
+
+	lgl__glReal_glDrawElementsInstancedBaseVertexBaseInstance(mode, count, type, indices, instancecount, basevertex, baseinstance);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glDrawElementsInstancedBaseVertexBaseInstance(mode, count, type, indices, instancecount, basevertex, baseinstance);
+	lgl__glTraceLeave(510, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetInternalformativ(GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint *params)
+{
+	double lgl__start = lgl__glTraceEnter(511);
+
+	lgl__glReal_glGetInternalformativ(target, internalformat, pname, count, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetInternalformativ(target, internalformat, pname, count, params);
+	lgl__glTraceLeave(511, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetActiveAtomicCounterBufferiv(GLuint program, GLuint bufferIndex, GLenum pname, GLint *params)
+{
+	double lgl__start = lgl__glTraceEnter(512);
+
+	lgl__glReal_glGetActiveAtomicCounterBufferiv(program, bufferIndex, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetActiveAtomicCounterBufferiv(program, bufferIndex, pname, params);
+	lgl__glTraceLeave(512, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glBindImageTexture(GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format)
+{
+	double lgl__start = lgl__glTraceEnter(513);
+
+	lgl__glReal_glBindImageTexture(unit, texture, level, layered, layer, access, format);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glBindImageTexture(unit, texture, level, layered, layer, access, format);
+	lgl__glTraceLeave(513, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glMemoryBarrier(GLbitfield barriers)
+{
+	double lgl__start = lgl__glTraceEnter(514);
+
+	lgl__glReal_glMemoryBarrier(barriers);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glMemoryBarrier(barriers);
+	lgl__glTraceLeave(514, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTexStorage1D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width)
+{
+	double lgl__start = lgl__glTraceEnter(515);
+
+	lgl__glReal_glTexStorage1D(target, levels, internalformat, width);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTexStorage1D(target, levels, internalformat, width);
+	lgl__glTraceLeave(515, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height)
+{
+	double lgl__start = lgl__glTraceEnter(516);
+
+	lgl__glReal_glTexStorage2D(target, levels, internalformat, width, height);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTexStorage2D(target, levels, internalformat, width, height);
+	lgl__glTraceLeave(516, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTexStorage3D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth)
+{
+	double lgl__start = lgl__glTraceEnter(517);
+
+	lgl__glReal_glTexStorage3D(target, levels, internalformat, width, height, depth);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTexStorage3D(target, levels, internalformat, width, height, depth);
+	lgl__glTraceLeave(517, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glDrawTransformFeedbackInstanced(GLenum mode, GLuint id, GLsizei instancecount)
+{
+	double lgl__start = lgl__glTraceEnter(518);
+
+	lgl__glReal_glDrawTransformFeedbackInstanced(mode, id, instancecount);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glDrawTransformFeedbackInstanced(mode, id, instancecount);
+	lgl__glTraceLeave(518, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glDrawTransformFeedbackStreamInstanced(GLenum mode, GLuint id, GLuint stream, GLsizei instancecount)
+{
+	double lgl__start = lgl__glTraceEnter(519);
+
+	lgl__glReal_glDrawTransformFeedbackStreamInstanced(mode, id, stream, instancecount);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glDrawTransformFeedbackStreamInstanced(mode, id, stream, instancecount);
+	lgl__glTraceLeave(519, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glClearBufferData(GLenum target, GLenum internalformat, GLenum format, GLenum type, const void *data)
+{
+	double lgl__start = lgl__glTraceEnter(520);
+
+	lgl__glReal_glClearBufferData(target, internalformat, format, type, data);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glClearBufferData(target, internalformat, format, type, data);
+	lgl__glTraceLeave(520, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glClearBufferSubData(GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data)
+{
+	double lgl__start = lgl__glTraceEnter(521);
+
+	lgl__glReal_glClearBufferSubData(target, internalformat, offset, size, format, type, data);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glClearBufferSubData(target, internalformat, offset, size, format, type, data);
+	lgl__glTraceLeave(521, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glDispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z)
+{
+	double lgl__start = lgl__glTraceEnter(522);
+
+	lgl__glReal_glDispatchCompute(num_groups_x, num_groups_y, num_groups_z);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glDispatchCompute(num_groups_x, num_groups_y, num_groups_z);
+	lgl__glTraceLeave(522, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glDispatchComputeIndirect(GLintptr indirect)
+{
+	double lgl__start = lgl__glTraceEnter(523);
+
+	lgl__glReal_glDispatchComputeIndirect(indirect);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glDispatchComputeIndirect(indirect);
+	lgl__glTraceLeave(523, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glCopyImageSubData(GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth)
+{
+	double lgl__start = lgl__glTraceEnter(524);
+
+	lgl__glReal_glCopyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glCopyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+	lgl__glTraceLeave(524, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glFramebufferParameteri(GLenum target, GLenum pname, GLint param)
+{
+	double lgl__start = lgl__glTraceEnter(525);
+
+	lgl__glReal_glFramebufferParameteri(target, pname, param);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glFramebufferParameteri(target, pname, param);
+	lgl__glTraceLeave(525, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetFramebufferParameteriv(GLenum target, GLenum pname, GLint *params)
+{
+	double lgl__start = lgl__glTraceEnter(526);
+
+	lgl__glReal_glGetFramebufferParameteriv(target, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetFramebufferParameteriv(target, pname, params);
+	lgl__glTraceLeave(526, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetInternalformati64v(GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint64 *params)
+{
+	double lgl__start = lgl__glTraceEnter(527);
+
+	lgl__glReal_glGetInternalformati64v(target, internalformat, pname, count, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetInternalformati64v(target, internalformat, pname, count, params);
+	lgl__glTraceLeave(527, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glInvalidateTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth)
+{
+	double lgl__start = lgl__glTraceEnter(528);
+
+	lgl__glReal_glInvalidateTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glInvalidateTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth);
+	lgl__glTraceLeave(528, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glInvalidateTexImage(GLuint texture, GLint level)
+{
+	double lgl__start = lgl__glTraceEnter(529);
+
+	lgl__glReal_glInvalidateTexImage(texture, level);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glInvalidateTexImage(texture, level);
+	lgl__glTraceLeave(529, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glInvalidateBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr length)
+{
+	double lgl__start = lgl__glTraceEnter(530);
+
+	lgl__glReal_glInvalidateBufferSubData(buffer, offset, length);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glInvalidateBufferSubData(buffer, offset, length);
+	lgl__glTraceLeave(530, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glInvalidateBufferData(GLuint buffer)
+{
+	double lgl__start = lgl__glTraceEnter(531);
+
+	lgl__glReal_glInvalidateBufferData(buffer);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glInvalidateBufferData(buffer);
+	lgl__glTraceLeave(531, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glInvalidateFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments)
+{
+	double lgl__start = lgl__glTraceEnter(532);
+
+	lgl__glReal_glInvalidateFramebuffer(target, numAttachments, attachments);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glInvalidateFramebuffer(target, numAttachments, attachments);
+	lgl__glTraceLeave(532, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glInvalidateSubFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+	double lgl__start = lgl__glTraceEnter(533);
+
+	lgl__glReal_glInvalidateSubFramebuffer(target, numAttachments, attachments, x, y, width, height);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glInvalidateSubFramebuffer(target, numAttachments, attachments, x, y, width, height);
+	lgl__glTraceLeave(533, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glMultiDrawArraysIndirect(GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride)
+{
+	double lgl__start = lgl__glTraceEnter(534);
+
+	lgl__glReal_glMultiDrawArraysIndirect(mode, indirect, drawcount, stride);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glMultiDrawArraysIndirect(mode, indirect, drawcount, stride);
+	lgl__glTraceLeave(534, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glMultiDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride)
+{
+	double lgl__start = lgl__glTraceEnter(535);
+
+	lgl__glReal_glMultiDrawElementsIndirect(mode, type, indirect, drawcount, stride);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glMultiDrawElementsIndirect(mode, type, indirect, drawcount, stride);
+	lgl__glTraceLeave(535, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetProgramInterfaceiv(GLuint program, GLenum programInterface, GLenum pname, GLint *params)
+{
+	double lgl__start = lgl__glTraceEnter(536);
+
+	lgl__glReal_glGetProgramInterfaceiv(program, programInterface, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetProgramInterfaceiv(program, programInterface, pname, params);
+	lgl__glTraceLeave(536, 1, lgl__start);
+}
+
+static GLuint APIENTRY lgl__glTrace_glGetProgramResourceIndex(GLuint program, GLenum programInterface, const GLchar *name)
+{
+	GLuint lgl__result;
+	double lgl__start = lgl__glTraceEnter(537);
+
+	lgl__result = lgl__glReal_glGetProgramResourceIndex(program, programInterface, name);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetProgramResourceIndex(program, programInterface, name, lgl__result);
+	lgl__glTraceLeave(537, 1, lgl__start);
+	return lgl__result;
+}
+
+static void APIENTRY lgl__glTrace_glGetProgramResourceName(GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name)
+{
+	double lgl__start = lgl__glTraceEnter(538);
+
+	lgl__glReal_glGetProgramResourceName(program, programInterface, index, bufSize, length, name);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetProgramResourceName(program, programInterface, index, bufSize, length, name);
+	lgl__glTraceLeave(538, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetProgramResourceiv(GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum *props, GLsizei count, GLsizei *length, GLint *params)
+{
+	double lgl__start = lgl__glTraceEnter(539);
+
+	lgl__glReal_glGetProgramResourceiv(program, programInterface, index, propCount, props, count, length, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetProgramResourceiv(program, programInterface, index, propCount, props, count, length, params);
+	lgl__glTraceLeave(539, 1, lgl__start);
+}
+
+static GLint APIENTRY lgl__glTrace_glGetProgramResourceLocation(GLuint program, GLenum programInterface, const GLchar *name)
+{
+	GLint lgl__result;
+	double lgl__start = lgl__glTraceEnter(540);
+
+	lgl__result = lgl__glReal_glGetProgramResourceLocation(program, programInterface, name);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetProgramResourceLocation(program, programInterface, name, lgl__result);
+	lgl__glTraceLeave(540, 1, lgl__start);
+	return lgl__result;
+}
+
+static GLint APIENTRY lgl__glTrace_glGetProgramResourceLocationIndex(GLuint program, GLenum programInterface, const GLchar *name)
+{
+	GLint lgl__result;
+	double lgl__start = lgl__glTraceEnter(541);
+
+	lgl__result = lgl__glReal_glGetProgramResourceLocationIndex(program, programInterface, name);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetProgramResourceLocationIndex(program, programInterface, name, lgl__result);
+	lgl__glTraceLeave(541, 1, lgl__start);
+	return lgl__result;
+}
+
+static void APIENTRY lgl__glTrace_glShaderStorageBlockBinding(GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding)
+{
+	double lgl__start = lgl__glTraceEnter(542);
+
+	lgl__glReal_glShaderStorageBlockBinding(program, storageBlockIndex, storageBlockBinding);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glShaderStorageBlockBinding(program, storageBlockIndex, storageBlockBinding);
+	lgl__glTraceLeave(542, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTexBufferRange(GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+	double lgl__start = lgl__glTraceEnter(543);
+
+	lgl__glReal_glTexBufferRange(target, internalformat, buffer, offset, size);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTexBufferRange(target, internalformat, buffer, offset, size);
+	lgl__glTraceLeave(543, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTexStorage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
+{
+	double lgl__start = lgl__glTraceEnter(544);
+
+	lgl__glReal_glTexStorage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTexStorage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+	lgl__glTraceLeave(544, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTexStorage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
+{
+	double lgl__start = lgl__glTraceEnter(545);
+
+	lgl__glReal_glTexStorage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTexStorage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+	lgl__glTraceLeave(545, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTextureView(GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers)
+{
+	double lgl__start = lgl__glTraceEnter(546);
+
+	lgl__glReal_glTextureView(texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTextureView(texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
+	lgl__glTraceLeave(546, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glBindVertexBuffer(GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride)
+{
+	double lgl__start = lgl__glTraceEnter(547);
+
+	lgl__glReal_glBindVertexBuffer(bindingindex, buffer, offset, stride);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glBindVertexBuffer(bindingindex, buffer, offset, stride);
+	lgl__glTraceLeave(547, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttribFormat(GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset)
+{
+	double lgl__start = lgl__glTraceEnter(548);
+
+	lgl__glReal_glVertexAttribFormat(attribindex, size, type, normalized, relativeoffset);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttribFormat(attribindex, size, type, normalized, relativeoffset);
+	lgl__glTraceLeave(548, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttribIFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+	double lgl__start = lgl__glTraceEnter(549);
+
+	lgl__glReal_glVertexAttribIFormat(attribindex, size, type, relativeoffset);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttribIFormat(attribindex, size, type, relativeoffset);
+	lgl__glTraceLeave(549, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttribLFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+	double lgl__start = lgl__glTraceEnter(550);
+
+	lgl__glReal_glVertexAttribLFormat(attribindex, size, type, relativeoffset);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttribLFormat(attribindex, size, type, relativeoffset);
+	lgl__glTraceLeave(550, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexAttribBinding(GLuint attribindex, GLuint bindingindex)
+{
+	double lgl__start = lgl__glTraceEnter(551);
+
+	lgl__glReal_glVertexAttribBinding(attribindex, bindingindex);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexAttribBinding(attribindex, bindingindex);
+	lgl__glTraceLeave(551, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexBindingDivisor(GLuint bindingindex, GLuint divisor)
+{
+	double lgl__start = lgl__glTraceEnter(552);
+
+	lgl__glReal_glVertexBindingDivisor(bindingindex, divisor);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexBindingDivisor(bindingindex, divisor);
+	lgl__glTraceLeave(552, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glDebugMessageControl(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled)
+{
+	double lgl__start = lgl__glTraceEnter(553);
+
+	lgl__glReal_glDebugMessageControl(source, type, severity, count, ids, enabled);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glDebugMessageControl(source, type, severity, count, ids, enabled);
+	lgl__glTraceLeave(553, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glDebugMessageInsert(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf)
+{
+	double lgl__start = lgl__glTraceEnter(554);
+
+	lgl__glReal_glDebugMessageInsert(source, type, id, severity, length, buf);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glDebugMessageInsert(source, type, id, severity, length, buf);
+	lgl__glTraceLeave(554, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glDebugMessageCallback(GLDEBUGPROC callback, const void *userParam)
+{
+	double lgl__start = lgl__glTraceEnter(555);
+
+	lgl__glReal_glDebugMessageCallback(callback, userParam);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glDebugMessageCallback(callback, userParam);
+	lgl__glTraceLeave(555, 0, lgl__start);
+}
+
+static GLuint APIENTRY lgl__glTrace_glGetDebugMessageLog(GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog)
+{
+	GLuint lgl__result;
+	double lgl__start = lgl__glTraceEnter(556);
+
+	lgl__result = lgl__glReal_glGetDebugMessageLog(count, bufSize, sources, types, ids, severities, lengths, messageLog);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetDebugMessageLog(count, bufSize, sources, types, ids, severities, lengths, messageLog, lgl__result);
+	lgl__glTraceLeave(556, 1, lgl__start);
+	return lgl__result;
+}
+
+static void APIENTRY lgl__glTrace_glPushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar *message)
+{
+	double lgl__start = lgl__glTraceEnter(557);
+
+	lgl__glReal_glPushDebugGroup(source, id, length, message);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glPushDebugGroup(source, id, length, message);
+	lgl__glTraceLeave(557, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glPopDebugGroup(void)
+{
+	double lgl__start = lgl__glTraceEnter(558);
+
+	lgl__glReal_glPopDebugGroup();
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glPopDebugGroup();
+	lgl__glTraceLeave(558, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glObjectLabel(GLenum identifier, GLuint name, GLsizei length, const GLchar *label)
+{
+	double lgl__start = lgl__glTraceEnter(559);
+
+	lgl__glReal_glObjectLabel(identifier, name, length, label);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glObjectLabel(identifier, name, length, label);
+	lgl__glTraceLeave(559, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetObjectLabel(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label)
+{
+	double lgl__start = lgl__glTraceEnter(560);
+
+	lgl__glReal_glGetObjectLabel(identifier, name, bufSize, length, label);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetObjectLabel(identifier, name, bufSize, length, label);
+	lgl__glTraceLeave(560, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glObjectPtrLabel(const void *ptr, GLsizei length, const GLchar *label)
+{
+	double lgl__start = lgl__glTraceEnter(561);
+
+	lgl__glReal_glObjectPtrLabel(ptr, length, label);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glObjectPtrLabel(ptr, length, label);
+	lgl__glTraceLeave(561, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetObjectPtrLabel(const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label)
+{
+	double lgl__start = lgl__glTraceEnter(562);
+
+	lgl__glReal_glGetObjectPtrLabel(ptr, bufSize, length, label);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetObjectPtrLabel(ptr, bufSize, length, label);
+	lgl__glTraceLeave(562, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetPointerv(GLenum pname, void **params)
+{
+	double lgl__start = lgl__glTraceEnter(563);
+
+	lgl__glReal_glGetPointerv(pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetPointerv(pname, params);
+	lgl__glTraceLeave(563, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glBufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags)
+{
+	double lgl__start = lgl__glTraceEnter(564);
+
+	lgl__glReal_glBufferStorage(target, size, data, flags);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glBufferStorage(target, size, data, flags);
+	lgl__glTraceLeave(564, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glClearTexImage(GLuint texture, GLint level, GLenum format, GLenum type, const void *data)
+{
+	double lgl__start = lgl__glTraceEnter(565);
+
+	lgl__glReal_glClearTexImage(texture, level, format, type, data);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glClearTexImage(texture, level, format, type, data);
+	lgl__glTraceLeave(565, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glClearTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *data)
+{
+	double lgl__start = lgl__glTraceEnter(566);
+
+	lgl__glReal_glClearTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glClearTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data);
+	lgl__glTraceLeave(566, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glBindBuffersBase(GLenum target, GLuint first, GLsizei count, const GLuint *buffers)
+{
+	double lgl__start = lgl__glTraceEnter(567);
+
+	lgl__glReal_glBindBuffersBase(target, first, count, buffers);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glBindBuffersBase(target, first, count, buffers);
+	lgl__glTraceLeave(567, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glBindBuffersRange(GLenum target, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizeiptr *sizes)
+{
+	double lgl__start = lgl__glTraceEnter(568);
+
+	lgl__glReal_glBindBuffersRange(target, first, count, buffers, offsets, sizes);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glBindBuffersRange(target, first, count, buffers, offsets, sizes);
+	lgl__glTraceLeave(568, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glBindTextures(GLuint first, GLsizei count, const GLuint *textures)
+{
+	double lgl__start = lgl__glTraceEnter(569);
+
+	lgl__glReal_glBindTextures(first, count, textures);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glBindTextures(first, count, textures);
+	lgl__glTraceLeave(569, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glBindSamplers(GLuint first, GLsizei count, const GLuint *samplers)
+{
+	double lgl__start = lgl__glTraceEnter(570);
+
+	lgl__glReal_glBindSamplers(first, count, samplers);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glBindSamplers(first, count, samplers);
+	lgl__glTraceLeave(570, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glBindImageTextures(GLuint first, GLsizei count, const GLuint *textures)
+{
+	double lgl__start = lgl__glTraceEnter(571);
+
+	lgl__glReal_glBindImageTextures(first, count, textures);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glBindImageTextures(first, count, textures);
+	lgl__glTraceLeave(571, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glBindVertexBuffers(GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides)
+{
+	double lgl__start = lgl__glTraceEnter(572);
+
+	lgl__glReal_glBindVertexBuffers(first, count, buffers, offsets, strides);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glBindVertexBuffers(first, count, buffers, offsets, strides);
+	lgl__glTraceLeave(572, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glClipControl(GLenum origin, GLenum depth)
+{
+	double lgl__start = lgl__glTraceEnter(573);
+
+	lgl__glReal_glClipControl(origin, depth);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glClipControl(origin, depth);
+	lgl__glTraceLeave(573, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glCreateTransformFeedbacks(GLsizei n, GLuint *ids)
+{
+	double lgl__start = lgl__glTraceEnter(574);
+
+	lgl__glReal_glCreateTransformFeedbacks(n, ids);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glCreateTransformFeedbacks(n, ids);
+	lgl__glTraceLeave(574, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTransformFeedbackBufferBase(GLuint xfb, GLuint index, GLuint buffer)
+{
+	double lgl__start = lgl__glTraceEnter(575);
+
+	lgl__glReal_glTransformFeedbackBufferBase(xfb, index, buffer);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTransformFeedbackBufferBase(xfb, index, buffer);
+	lgl__glTraceLeave(575, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTransformFeedbackBufferRange(GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+	double lgl__start = lgl__glTraceEnter(576);
+
+	lgl__glReal_glTransformFeedbackBufferRange(xfb, index, buffer, offset, size);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTransformFeedbackBufferRange(xfb, index, buffer, offset, size);
+	lgl__glTraceLeave(576, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetTransformFeedbackiv(GLuint xfb, GLenum pname, GLint *param)
+{
+	double lgl__start = lgl__glTraceEnter(577);
+
+	lgl__glReal_glGetTransformFeedbackiv(xfb, pname, param);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetTransformFeedbackiv(xfb, pname, param);
+	lgl__glTraceLeave(577, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetTransformFeedbacki_v(GLuint xfb, GLenum pname, GLuint index, GLint *param)
+{
+	double lgl__start = lgl__glTraceEnter(578);
+
+	lgl__glReal_glGetTransformFeedbacki_v(xfb, pname, index, param);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetTransformFeedbacki_v(xfb, pname, index, param);
+	lgl__glTraceLeave(578, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetTransformFeedbacki64_v(GLuint xfb, GLenum pname, GLuint index, GLint64 *param)
+{
+	double lgl__start = lgl__glTraceEnter(579);
+
+	lgl__glReal_glGetTransformFeedbacki64_v(xfb, pname, index, param);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetTransformFeedbacki64_v(xfb, pname, index, param);
+	lgl__glTraceLeave(579, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glCreateBuffers(GLsizei n, GLuint *buffers)
+{
+	double lgl__start = lgl__glTraceEnter(580);
+
+	lgl__glReal_glCreateBuffers(n, buffers);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glCreateBuffers(n, buffers);
+	lgl__glTraceLeave(580, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glNamedBufferStorage(GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags)
+{
+	double lgl__start = lgl__glTraceEnter(581);
+
+	lgl__glReal_glNamedBufferStorage(buffer, size, data, flags);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glNamedBufferStorage(buffer, size, data, flags);
+	lgl__glTraceLeave(581, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glNamedBufferData(GLuint buffer, GLsizeiptr size, const void *data, GLenum usage)
+{
+	double lgl__start = lgl__glTraceEnter(582);
+
+	lgl__glReal_glNamedBufferData(buffer, size, data, usage);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glNamedBufferData(buffer, size, data, usage);
+	lgl__glTraceLeave(582, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data)
+{
+	double lgl__start = lgl__glTraceEnter(583);
+
+	lgl__glReal_glNamedBufferSubData(buffer, offset, size, data);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glNamedBufferSubData(buffer, offset, size, data);
+	lgl__glTraceLeave(583, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glCopyNamedBufferSubData(GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
+{
+	double lgl__start = lgl__glTraceEnter(584);
+
+	lgl__glReal_glCopyNamedBufferSubData(readBuffer, writeBuffer, readOffset, writeOffset, size);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glCopyNamedBufferSubData(readBuffer, writeBuffer, readOffset, writeOffset, size);
+	lgl__glTraceLeave(584, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glClearNamedBufferData(GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data)
+{
+	double lgl__start = lgl__glTraceEnter(585);
+
+	lgl__glReal_glClearNamedBufferData(buffer, internalformat, format, type, data);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glClearNamedBufferData(buffer, internalformat, format, type, data);
+	lgl__glTraceLeave(585, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glClearNamedBufferSubData(GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data)
+{
+	double lgl__start = lgl__glTraceEnter(586);
+
+	lgl__glReal_glClearNamedBufferSubData(buffer, internalformat, offset, size, format, type, data);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glClearNamedBufferSubData(buffer, internalformat, offset, size, format, type, data);
+	lgl__glTraceLeave(586, 0, lgl__start);
+}
+
+static void * APIENTRY lgl__glTrace_glMapNamedBuffer(GLuint buffer, GLenum access)
+{
+	void * lgl__result;
+	double lgl__start = lgl__glTraceEnter(587);
+
+	lgl__result = lgl__glReal_glMapNamedBuffer(buffer, access);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glMapNamedBuffer(buffer, access, lgl__result);
+	lgl__glTraceLeave(587, 1, lgl__start);
+	return lgl__result;
+}
+
+static void * APIENTRY lgl__glTrace_glMapNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+	void * lgl__result;
+	double lgl__start = lgl__glTraceEnter(588);
+
+	lgl__result = lgl__glReal_glMapNamedBufferRange(buffer, offset, length, access);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glMapNamedBufferRange(buffer, offset, length, access, lgl__result);
+	lgl__glTraceLeave(588, 1, lgl__start);
+	return lgl__result;
+}
+
+static GLboolean APIENTRY lgl__glTrace_glUnmapNamedBuffer(GLuint buffer)
+{
+	GLboolean lgl__result;
+	double lgl__start = lgl__glTraceEnter(589);
+
+	lgl__result = lgl__glReal_glUnmapNamedBuffer(buffer);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glUnmapNamedBuffer(buffer, lgl__result);
+	lgl__glTraceLeave(589, 0, lgl__start);
+	return lgl__result;
+}
+
+static void APIENTRY lgl__glTrace_glFlushMappedNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length)
+{
+	double lgl__start = lgl__glTraceEnter(590);
+
+	lgl__glReal_glFlushMappedNamedBufferRange(buffer, offset, length);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glFlushMappedNamedBufferRange(buffer, offset, length);
+	lgl__glTraceLeave(590, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetNamedBufferParameteriv(GLuint buffer, GLenum pname, GLint *params)
+{
+	double lgl__start = lgl__glTraceEnter(591);
+
+	lgl__glReal_glGetNamedBufferParameteriv(buffer, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetNamedBufferParameteriv(buffer, pname, params);
+	lgl__glTraceLeave(591, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetNamedBufferParameteri64v(GLuint buffer, GLenum pname, GLint64 *params)
+{
+	double lgl__start = lgl__glTraceEnter(592);
+
+	lgl__glReal_glGetNamedBufferParameteri64v(buffer, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetNamedBufferParameteri64v(buffer, pname, params);
+	lgl__glTraceLeave(592, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetNamedBufferPointerv(GLuint buffer, GLenum pname, void **params)
+{
+	double lgl__start = lgl__glTraceEnter(593);
+
+	lgl__glReal_glGetNamedBufferPointerv(buffer, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetNamedBufferPointerv(buffer, pname, params);
+	lgl__glTraceLeave(593, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, void *data)
+{
+	double lgl__start = lgl__glTraceEnter(594);
+
+	lgl__glReal_glGetNamedBufferSubData(buffer, offset, size, data);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetNamedBufferSubData(buffer, offset, size, data);
+	lgl__glTraceLeave(594, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glCreateFramebuffers(GLsizei n, GLuint *framebuffers)
+{
+	double lgl__start = lgl__glTraceEnter(595);
+
+	lgl__glReal_glCreateFramebuffers(n, framebuffers);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glCreateFramebuffers(n, framebuffers);
+	lgl__glTraceLeave(595, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glNamedFramebufferRenderbuffer(GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
+{
+	double lgl__start = lgl__glTraceEnter(596);
+
+	lgl__glReal_glNamedFramebufferRenderbuffer(framebuffer, attachment, renderbuffertarget, renderbuffer);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glNamedFramebufferRenderbuffer(framebuffer, attachment, renderbuffertarget, renderbuffer);
+	lgl__glTraceLeave(596, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glNamedFramebufferParameteri(GLuint framebuffer, GLenum pname, GLint param)
+{
+	double lgl__start = lgl__glTraceEnter(597);
+
+	lgl__glReal_glNamedFramebufferParameteri(framebuffer, pname, param);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glNamedFramebufferParameteri(framebuffer, pname, param);
+	lgl__glTraceLeave(597, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glNamedFramebufferTexture(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level)
+{
+	double lgl__start = lgl__glTraceEnter(598);
+
+	lgl__glReal_glNamedFramebufferTexture(framebuffer, attachment, texture, level);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glNamedFramebufferTexture(framebuffer, attachment, texture, level);
+	lgl__glTraceLeave(598, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glNamedFramebufferTextureLayer(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer)
+{
+	double lgl__start = lgl__glTraceEnter(599);
+
+	lgl__glReal_glNamedFramebufferTextureLayer(framebuffer, attachment, texture, level, layer);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glNamedFramebufferTextureLayer(framebuffer, attachment, texture, level, layer);
+	lgl__glTraceLeave(599, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glNamedFramebufferDrawBuffer(GLuint framebuffer, GLenum buf)
+{
+	double lgl__start = lgl__glTraceEnter(600);
+
+	lgl__glReal_glNamedFramebufferDrawBuffer(framebuffer, buf);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glNamedFramebufferDrawBuffer(framebuffer, buf);
+	lgl__glTraceLeave(600, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glNamedFramebufferDrawBuffers(GLuint framebuffer, GLsizei n, const GLenum *bufs)
+{
+	double lgl__start = lgl__glTraceEnter(601);
+
+	lgl__glReal_glNamedFramebufferDrawBuffers(framebuffer, n, bufs);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glNamedFramebufferDrawBuffers(framebuffer, n, bufs);
+	lgl__glTraceLeave(601, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glNamedFramebufferReadBuffer(GLuint framebuffer, GLenum src)
+{
+	double lgl__start = lgl__glTraceEnter(602);
+
+	lgl__glReal_glNamedFramebufferReadBuffer(framebuffer, src);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glNamedFramebufferReadBuffer(framebuffer, src);
+	lgl__glTraceLeave(602, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glInvalidateNamedFramebufferData(GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments)
+{
+	double lgl__start = lgl__glTraceEnter(603);
+
+	lgl__glReal_glInvalidateNamedFramebufferData(framebuffer, numAttachments, attachments);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glInvalidateNamedFramebufferData(framebuffer, numAttachments, attachments);
+	lgl__glTraceLeave(603, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glInvalidateNamedFramebufferSubData(GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+	double lgl__start = lgl__glTraceEnter(604);
+
+	lgl__glReal_glInvalidateNamedFramebufferSubData(framebuffer, numAttachments, attachments, x, y, width, height);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glInvalidateNamedFramebufferSubData(framebuffer, numAttachments, attachments, x, y, width, height);
+	lgl__glTraceLeave(604, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glClearNamedFramebufferiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLint *value)
+{
+	double lgl__start = lgl__glTraceEnter(605);
+
+	lgl__glReal_glClearNamedFramebufferiv(framebuffer, buffer, drawbuffer, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glClearNamedFramebufferiv(framebuffer, buffer, drawbuffer, value);
+	lgl__glTraceLeave(605, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glClearNamedFramebufferuiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLuint *value)
+{
+	double lgl__start = lgl__glTraceEnter(606);
+
+	lgl__glReal_glClearNamedFramebufferuiv(framebuffer, buffer, drawbuffer, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glClearNamedFramebufferuiv(framebuffer, buffer, drawbuffer, value);
+	lgl__glTraceLeave(606, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glClearNamedFramebufferfv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat *value)
+{
+	double lgl__start = lgl__glTraceEnter(607);
+
+	lgl__glReal_glClearNamedFramebufferfv(framebuffer, buffer, drawbuffer, value);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glClearNamedFramebufferfv(framebuffer, buffer, drawbuffer, value);
+	lgl__glTraceLeave(607, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glClearNamedFramebufferfi(GLuint framebuffer, GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil)
+{
+	double lgl__start = lgl__glTraceEnter(608);
+
+	lgl__glReal_glClearNamedFramebufferfi(framebuffer, buffer, drawbuffer, depth, stencil);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glClearNamedFramebufferfi(framebuffer, buffer, drawbuffer, depth, stencil);
+	lgl__glTraceLeave(608, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glBlitNamedFramebuffer(GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)
+{
+	double lgl__start = lgl__glTraceEnter(609);
+
+	lgl__glReal_glBlitNamedFramebuffer(readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glBlitNamedFramebuffer(readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+	lgl__glTraceLeave(609, 0, lgl__start);
+}
+
+static GLenum APIENTRY lgl__glTrace_glCheckNamedFramebufferStatus(GLuint framebuffer, GLenum target)
+{
+	GLenum lgl__result;
+	double lgl__start = lgl__glTraceEnter(610);
+
+	lgl__result = lgl__glReal_glCheckNamedFramebufferStatus(framebuffer, target);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glCheckNamedFramebufferStatus(framebuffer, target, lgl__result);
+	lgl__glTraceLeave(610, 1, lgl__start);
+	return lgl__result;
+}
+
+static void APIENTRY lgl__glTrace_glGetNamedFramebufferParameteriv(GLuint framebuffer, GLenum pname, GLint *param)
+{
+	double lgl__start = lgl__glTraceEnter(611);
+
+	lgl__glReal_glGetNamedFramebufferParameteriv(framebuffer, pname, param);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetNamedFramebufferParameteriv(framebuffer, pname, param);
+	lgl__glTraceLeave(611, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetNamedFramebufferAttachmentParameteriv(GLuint framebuffer, GLenum attachment, GLenum pname, GLint *params)
+{
+	double lgl__start = lgl__glTraceEnter(612);
+
+	lgl__glReal_glGetNamedFramebufferAttachmentParameteriv(framebuffer, attachment, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetNamedFramebufferAttachmentParameteriv(framebuffer, attachment, pname, params);
+	lgl__glTraceLeave(612, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glCreateRenderbuffers(GLsizei n, GLuint *renderbuffers)
+{
+	double lgl__start = lgl__glTraceEnter(613);
+
+	lgl__glReal_glCreateRenderbuffers(n, renderbuffers);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glCreateRenderbuffers(n, renderbuffers);
+	lgl__glTraceLeave(613, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glNamedRenderbufferStorage(GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height)
+{
+	double lgl__start = lgl__glTraceEnter(614);
+
+	lgl__glReal_glNamedRenderbufferStorage(renderbuffer, internalformat, width, height);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glNamedRenderbufferStorage(renderbuffer, internalformat, width, height);
+	lgl__glTraceLeave(614, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glNamedRenderbufferStorageMultisample(GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)
+{
+	double lgl__start = lgl__glTraceEnter(615);
+
+	lgl__glReal_glNamedRenderbufferStorageMultisample(renderbuffer, samples, internalformat, width, height);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glNamedRenderbufferStorageMultisample(renderbuffer, samples, internalformat, width, height);
+	lgl__glTraceLeave(615, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetNamedRenderbufferParameteriv(GLuint renderbuffer, GLenum pname, GLint *params)
+{
+	double lgl__start = lgl__glTraceEnter(616);
+
+	lgl__glReal_glGetNamedRenderbufferParameteriv(renderbuffer, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetNamedRenderbufferParameteriv(renderbuffer, pname, params);
+	lgl__glTraceLeave(616, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glCreateTextures(GLenum target, GLsizei n, GLuint *textures)
+{
+	double lgl__start = lgl__glTraceEnter(617);
+
+	lgl__glReal_glCreateTextures(target, n, textures);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glCreateTextures(target, n, textures);
+	lgl__glTraceLeave(617, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTextureBuffer(GLuint texture, GLenum internalformat, GLuint buffer)
+{
+	double lgl__start = lgl__glTraceEnter(618);
+
+	lgl__glReal_glTextureBuffer(texture, internalformat, buffer);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTextureBuffer(texture, internalformat, buffer);
+	lgl__glTraceLeave(618, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTextureBufferRange(GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+	double lgl__start = lgl__glTraceEnter(619);
+
+	lgl__glReal_glTextureBufferRange(texture, internalformat, buffer, offset, size);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTextureBufferRange(texture, internalformat, buffer, offset, size);
+	lgl__glTraceLeave(619, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTextureStorage1D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width)
+{
+	double lgl__start = lgl__glTraceEnter(620);
+
+	lgl__glReal_glTextureStorage1D(texture, levels, internalformat, width);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTextureStorage1D(texture, levels, internalformat, width);
+	lgl__glTraceLeave(620, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTextureStorage2D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height)
+{
+	double lgl__start = lgl__glTraceEnter(621);
+
+	lgl__glReal_glTextureStorage2D(texture, levels, internalformat, width, height);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTextureStorage2D(texture, levels, internalformat, width, height);
+	lgl__glTraceLeave(621, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTextureStorage3D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth)
+{
+	double lgl__start = lgl__glTraceEnter(622);
+
+	lgl__glReal_glTextureStorage3D(texture, levels, internalformat, width, height, depth);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTextureStorage3D(texture, levels, internalformat, width, height, depth);
+	lgl__glTraceLeave(622, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTextureStorage2DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
+{
+	double lgl__start = lgl__glTraceEnter(623);
+
+	lgl__glReal_glTextureStorage2DMultisample(texture, samples, internalformat, width, height, fixedsamplelocations);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTextureStorage2DMultisample(texture, samples, internalformat, width, height, fixedsamplelocations);
+	lgl__glTraceLeave(623, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTextureStorage3DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
+{
+	double lgl__start = lgl__glTraceEnter(624);
+
+	lgl__glReal_glTextureStorage3DMultisample(texture, samples, internalformat, width, height, depth, fixedsamplelocations);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTextureStorage3DMultisample(texture, samples, internalformat, width, height, depth, fixedsamplelocations);
+	lgl__glTraceLeave(624, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels)
+{
+	double lgl__start = lgl__glTraceEnter(625);
+
+	lgl__glReal_glTextureSubImage1D(texture, level, xoffset, width, format, type, pixels);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTextureSubImage1D(texture, level, xoffset, width, format, type, pixels);
+	lgl__glTraceLeave(625, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels)
+{
+	double lgl__start = lgl__glTraceEnter(626);
+
+	lgl__glReal_glTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, type, pixels);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, type, pixels);
+	lgl__glTraceLeave(626, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels)
+{
+	double lgl__start = lgl__glTraceEnter(627);
+
+	lgl__glReal_glTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+	lgl__glTraceLeave(627, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glCompressedTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data)
+{
+	double lgl__start = lgl__glTraceEnter(628);
+
+	lgl__glReal_glCompressedTextureSubImage1D(texture, level, xoffset, width, format, imageSize, data);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glCompressedTextureSubImage1D(texture, level, xoffset, width, format, imageSize, data);
+	lgl__glTraceLeave(628, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glCompressedTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data)
+{
+	double lgl__start = lgl__glTraceEnter(629);
+
+	lgl__glReal_glCompressedTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, imageSize, data);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glCompressedTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, imageSize, data);
+	lgl__glTraceLeave(629, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glCompressedTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data)
+{
+	double lgl__start = lgl__glTraceEnter(630);
+
+	lgl__glReal_glCompressedTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glCompressedTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+	lgl__glTraceLeave(630, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glCopyTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width)
+{
+	double lgl__start = lgl__glTraceEnter(631);
+
+	lgl__glReal_glCopyTextureSubImage1D(texture, level, xoffset, x, y, width);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glCopyTextureSubImage1D(texture, level, xoffset, x, y, width);
+	lgl__glTraceLeave(631, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glCopyTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+	double lgl__start = lgl__glTraceEnter(632);
+
+	lgl__glReal_glCopyTextureSubImage2D(texture, level, xoffset, yoffset, x, y, width, height);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glCopyTextureSubImage2D(texture, level, xoffset, yoffset, x, y, width, height);
+	lgl__glTraceLeave(632, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glCopyTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+	double lgl__start = lgl__glTraceEnter(633);
+
+	lgl__glReal_glCopyTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, x, y, width, height);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glCopyTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, x, y, width, height);
+	lgl__glTraceLeave(633, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTextureParameterf(GLuint texture, GLenum pname, GLfloat param)
+{
+	double lgl__start = lgl__glTraceEnter(634);
+
+	lgl__glReal_glTextureParameterf(texture, pname, param);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTextureParameterf(texture, pname, param);
+	lgl__glTraceLeave(634, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTextureParameterfv(GLuint texture, GLenum pname, const GLfloat *param)
+{
+	double lgl__start = lgl__glTraceEnter(635);
+
+	lgl__glReal_glTextureParameterfv(texture, pname, param);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTextureParameterfv(texture, pname, param);
+	lgl__glTraceLeave(635, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTextureParameteri(GLuint texture, GLenum pname, GLint param)
+{
+	double lgl__start = lgl__glTraceEnter(636);
+
+	lgl__glReal_glTextureParameteri(texture, pname, param);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTextureParameteri(texture, pname, param);
+	lgl__glTraceLeave(636, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTextureParameterIiv(GLuint texture, GLenum pname, const GLint *params)
+{
+	double lgl__start = lgl__glTraceEnter(637);
+
+	lgl__glReal_glTextureParameterIiv(texture, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTextureParameterIiv(texture, pname, params);
+	lgl__glTraceLeave(637, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTextureParameterIuiv(GLuint texture, GLenum pname, const GLuint *params)
+{
+	double lgl__start = lgl__glTraceEnter(638);
+
+	lgl__glReal_glTextureParameterIuiv(texture, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTextureParameterIuiv(texture, pname, params);
+	lgl__glTraceLeave(638, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTextureParameteriv(GLuint texture, GLenum pname, const GLint *param)
+{
+	double lgl__start = lgl__glTraceEnter(639);
+
+	lgl__glReal_glTextureParameteriv(texture, pname, param);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTextureParameteriv(texture, pname, param);
+	lgl__glTraceLeave(639, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGenerateTextureMipmap(GLuint texture)
+{
+	double lgl__start = lgl__glTraceEnter(640);
+
+	lgl__glReal_glGenerateTextureMipmap(texture);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGenerateTextureMipmap(texture);
+	lgl__glTraceLeave(640, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glBindTextureUnit(GLuint unit, GLuint texture)
+{
+	double lgl__start = lgl__glTraceEnter(641);
+
+	lgl__glTraceState(641, LGL__GL_BINDTEXTUREUNIT, unit, texture);
+	lgl__glReal_glBindTextureUnit(unit, texture);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glBindTextureUnit(unit, texture);
+	lgl__glTraceLeave(641, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetTextureImage(GLuint texture, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels)
+{
+	double lgl__start = lgl__glTraceEnter(642);
+
+	lgl__glReal_glGetTextureImage(texture, level, format, type, bufSize, pixels);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetTextureImage(texture, level, format, type, bufSize, pixels);
+	lgl__glTraceLeave(642, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetCompressedTextureImage(GLuint texture, GLint level, GLsizei bufSize, void *pixels)
+{
+	double lgl__start = lgl__glTraceEnter(643);
+
+	lgl__glReal_glGetCompressedTextureImage(texture, level, bufSize, pixels);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetCompressedTextureImage(texture, level, bufSize, pixels);
+	lgl__glTraceLeave(643, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetTextureLevelParameterfv(GLuint texture, GLint level, GLenum pname, GLfloat *params)
+{
+	double lgl__start = lgl__glTraceEnter(644);
+
+	lgl__glReal_glGetTextureLevelParameterfv(texture, level, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetTextureLevelParameterfv(texture, level, pname, params);
+	lgl__glTraceLeave(644, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetTextureLevelParameteriv(GLuint texture, GLint level, GLenum pname, GLint *params)
+{
+	double lgl__start = lgl__glTraceEnter(645);
+
+	lgl__glReal_glGetTextureLevelParameteriv(texture, level, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetTextureLevelParameteriv(texture, level, pname, params);
+	lgl__glTraceLeave(645, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetTextureParameterfv(GLuint texture, GLenum pname, GLfloat *params)
+{
+	double lgl__start = lgl__glTraceEnter(646);
+
+	lgl__glReal_glGetTextureParameterfv(texture, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetTextureParameterfv(texture, pname, params);
+	lgl__glTraceLeave(646, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetTextureParameterIiv(GLuint texture, GLenum pname, GLint *params)
+{
+	double lgl__start = lgl__glTraceEnter(647);
+
+	lgl__glReal_glGetTextureParameterIiv(texture, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetTextureParameterIiv(texture, pname, params);
+	lgl__glTraceLeave(647, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetTextureParameterIuiv(GLuint texture, GLenum pname, GLuint *params)
+{
+	double lgl__start = lgl__glTraceEnter(648);
+
+	lgl__glReal_glGetTextureParameterIuiv(texture, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetTextureParameterIuiv(texture, pname, params);
+	lgl__glTraceLeave(648, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetTextureParameteriv(GLuint texture, GLenum pname, GLint *params)
+{
+	double lgl__start = lgl__glTraceEnter(649);
+
+	lgl__glReal_glGetTextureParameteriv(texture, pname, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetTextureParameteriv(texture, pname, params);
+	lgl__glTraceLeave(649, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glCreateVertexArrays(GLsizei n, GLuint *arrays)
+{
+	double lgl__start = lgl__glTraceEnter(650);
+
+	lgl__glReal_glCreateVertexArrays(n, arrays);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glCreateVertexArrays(n, arrays);
+	lgl__glTraceLeave(650, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glDisableVertexArrayAttrib(GLuint vaobj, GLuint index)
+{
+	double lgl__start = lgl__glTraceEnter(651);
+
+	lgl__glReal_glDisableVertexArrayAttrib(vaobj, index);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glDisableVertexArrayAttrib(vaobj, index);
+	lgl__glTraceLeave(651, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glEnableVertexArrayAttrib(GLuint vaobj, GLuint index)
+{
+	double lgl__start = lgl__glTraceEnter(652);
+
+	lgl__glReal_glEnableVertexArrayAttrib(vaobj, index);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glEnableVertexArrayAttrib(vaobj, index);
+	lgl__glTraceLeave(652, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexArrayElementBuffer(GLuint vaobj, GLuint buffer)
+{
+	double lgl__start = lgl__glTraceEnter(653);
+
+	lgl__glTraceSet(LGL__GL_BINDBUFFER, (GLuint64)vaobj << 32 | GL_ELEMENT_ARRAY_BUFFER, buffer);
+	lgl__glReal_glVertexArrayElementBuffer(vaobj, buffer);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexArrayElementBuffer(vaobj, buffer);
+	lgl__glTraceLeave(653, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexArrayVertexBuffer(GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride)
+{
+	double lgl__start = lgl__glTraceEnter(654);
+
+	lgl__glReal_glVertexArrayVertexBuffer(vaobj, bindingindex, buffer, offset, stride);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexArrayVertexBuffer(vaobj, bindingindex, buffer, offset, stride);
+	lgl__glTraceLeave(654, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexArrayVertexBuffers(GLuint vaobj, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides)
+{
+	double lgl__start = lgl__glTraceEnter(655);
+
+	lgl__glReal_glVertexArrayVertexBuffers(vaobj, first, count, buffers, offsets, strides);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexArrayVertexBuffers(vaobj, first, count, buffers, offsets, strides);
+	lgl__glTraceLeave(655, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexArrayAttribBinding(GLuint vaobj, GLuint attribindex, GLuint bindingindex)
+{
+	double lgl__start = lgl__glTraceEnter(656);
+
+	lgl__glReal_glVertexArrayAttribBinding(vaobj, attribindex, bindingindex);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexArrayAttribBinding(vaobj, attribindex, bindingindex);
+	lgl__glTraceLeave(656, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexArrayAttribFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset)
+{
+	double lgl__start = lgl__glTraceEnter(657);
+
+	lgl__glReal_glVertexArrayAttribFormat(vaobj, attribindex, size, type, normalized, relativeoffset);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexArrayAttribFormat(vaobj, attribindex, size, type, normalized, relativeoffset);
+	lgl__glTraceLeave(657, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexArrayAttribIFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+	double lgl__start = lgl__glTraceEnter(658);
+
+	lgl__glReal_glVertexArrayAttribIFormat(vaobj, attribindex, size, type, relativeoffset);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexArrayAttribIFormat(vaobj, attribindex, size, type, relativeoffset);
+	lgl__glTraceLeave(658, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexArrayAttribLFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+	double lgl__start = lgl__glTraceEnter(659);
+
+	lgl__glReal_glVertexArrayAttribLFormat(vaobj, attribindex, size, type, relativeoffset);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexArrayAttribLFormat(vaobj, attribindex, size, type, relativeoffset);
+	lgl__glTraceLeave(659, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glVertexArrayBindingDivisor(GLuint vaobj, GLuint bindingindex, GLuint divisor)
+{
+	double lgl__start = lgl__glTraceEnter(660);
+
+	lgl__glReal_glVertexArrayBindingDivisor(vaobj, bindingindex, divisor);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glVertexArrayBindingDivisor(vaobj, bindingindex, divisor);
+	lgl__glTraceLeave(660, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetVertexArrayiv(GLuint vaobj, GLenum pname, GLint *param)
+{
+	double lgl__start = lgl__glTraceEnter(661);
+
+	lgl__glReal_glGetVertexArrayiv(vaobj, pname, param);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetVertexArrayiv(vaobj, pname, param);
+	lgl__glTraceLeave(661, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetVertexArrayIndexediv(GLuint vaobj, GLuint index, GLenum pname, GLint *param)
+{
+	double lgl__start = lgl__glTraceEnter(662);
+
+	lgl__glReal_glGetVertexArrayIndexediv(vaobj, index, pname, param);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetVertexArrayIndexediv(vaobj, index, pname, param);
+	lgl__glTraceLeave(662, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetVertexArrayIndexed64iv(GLuint vaobj, GLuint index, GLenum pname, GLint64 *param)
+{
+	double lgl__start = lgl__glTraceEnter(663);
+
+	lgl__glReal_glGetVertexArrayIndexed64iv(vaobj, index, pname, param);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetVertexArrayIndexed64iv(vaobj, index, pname, param);
+	lgl__glTraceLeave(663, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glCreateSamplers(GLsizei n, GLuint *samplers)
+{
+	double lgl__start = lgl__glTraceEnter(664);
+
+	lgl__glReal_glCreateSamplers(n, samplers);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glCreateSamplers(n, samplers);
+	lgl__glTraceLeave(664, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glCreateProgramPipelines(GLsizei n, GLuint *pipelines)
+{
+	double lgl__start = lgl__glTraceEnter(665);
+
+	lgl__glReal_glCreateProgramPipelines(n, pipelines);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glCreateProgramPipelines(n, pipelines);
+	lgl__glTraceLeave(665, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glCreateQueries(GLenum target, GLsizei n, GLuint *ids)
+{
+	double lgl__start = lgl__glTraceEnter(666);
+
+	lgl__glReal_glCreateQueries(target, n, ids);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glCreateQueries(target, n, ids);
+	lgl__glTraceLeave(666, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetQueryBufferObjecti64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+	double lgl__start = lgl__glTraceEnter(667);
+
+	lgl__glReal_glGetQueryBufferObjecti64v(id, buffer, pname, offset);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetQueryBufferObjecti64v(id, buffer, pname, offset);
+	lgl__glTraceLeave(667, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetQueryBufferObjectiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+	double lgl__start = lgl__glTraceEnter(668);
+
+	lgl__glReal_glGetQueryBufferObjectiv(id, buffer, pname, offset);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetQueryBufferObjectiv(id, buffer, pname, offset);
+	lgl__glTraceLeave(668, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetQueryBufferObjectui64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+	double lgl__start = lgl__glTraceEnter(669);
+
+	lgl__glReal_glGetQueryBufferObjectui64v(id, buffer, pname, offset);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetQueryBufferObjectui64v(id, buffer, pname, offset);
+	lgl__glTraceLeave(669, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetQueryBufferObjectuiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+	double lgl__start = lgl__glTraceEnter(670);
+
+	lgl__glReal_glGetQueryBufferObjectuiv(id, buffer, pname, offset);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetQueryBufferObjectuiv(id, buffer, pname, offset);
+	lgl__glTraceLeave(670, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glMemoryBarrierByRegion(GLbitfield barriers)
+{
+	double lgl__start = lgl__glTraceEnter(671);
+
+	lgl__glReal_glMemoryBarrierByRegion(barriers);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glMemoryBarrierByRegion(barriers);
+	lgl__glTraceLeave(671, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, GLsizei bufSize, void *pixels)
+{
+	double lgl__start = lgl__glTraceEnter(672);
+
+	lgl__glReal_glGetTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels);
+	lgl__glTraceLeave(672, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetCompressedTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei bufSize, void *pixels)
+{
+	double lgl__start = lgl__glTraceEnter(673);
+
+	lgl__glReal_glGetCompressedTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetCompressedTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels);
+	lgl__glTraceLeave(673, 1, lgl__start);
+}
+
+static GLenum APIENTRY lgl__glTrace_glGetGraphicsResetStatus(void)
+{
+	GLenum lgl__result;
+	double lgl__start = lgl__glTraceEnter(674);
+
+	lgl__result = lgl__glReal_glGetGraphicsResetStatus();
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetGraphicsResetStatus(lgl__result);
+	lgl__glTraceLeave(674, 1, lgl__start);
+	return lgl__result;
+}
+
+static void APIENTRY lgl__glTrace_glGetnCompressedTexImage(GLenum target, GLint lod, GLsizei bufSize, void *pixels)
+{
+	double lgl__start = lgl__glTraceEnter(675);
+
+	lgl__glReal_glGetnCompressedTexImage(target, lod, bufSize, pixels);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetnCompressedTexImage(target, lod, bufSize, pixels);
+	lgl__glTraceLeave(675, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetnTexImage(GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels)
+{
+	double lgl__start = lgl__glTraceEnter(676);
+
+	lgl__glReal_glGetnTexImage(target, level, format, type, bufSize, pixels);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetnTexImage(target, level, format, type, bufSize, pixels);
+	lgl__glTraceLeave(676, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetnUniformdv(GLuint program, GLint location, GLsizei bufSize, GLdouble *params)
+{
+	double lgl__start = lgl__glTraceEnter(677);
+
+	lgl__glReal_glGetnUniformdv(program, location, bufSize, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetnUniformdv(program, location, bufSize, params);
+	lgl__glTraceLeave(677, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetnUniformfv(GLuint program, GLint location, GLsizei bufSize, GLfloat *params)
+{
+	double lgl__start = lgl__glTraceEnter(678);
+
+	lgl__glReal_glGetnUniformfv(program, location, bufSize, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetnUniformfv(program, location, bufSize, params);
+	lgl__glTraceLeave(678, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetnUniformiv(GLuint program, GLint location, GLsizei bufSize, GLint *params)
+{
+	double lgl__start = lgl__glTraceEnter(679);
+
+	lgl__glReal_glGetnUniformiv(program, location, bufSize, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetnUniformiv(program, location, bufSize, params);
+	lgl__glTraceLeave(679, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetnUniformuiv(GLuint program, GLint location, GLsizei bufSize, GLuint *params)
+{
+	double lgl__start = lgl__glTraceEnter(680);
+
+	lgl__glReal_glGetnUniformuiv(program, location, bufSize, params);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetnUniformuiv(program, location, bufSize, params);
+	lgl__glTraceLeave(680, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glReadnPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data)
+{
+	double lgl__start = lgl__glTraceEnter(681);
+
+	lgl__glReal_glReadnPixels(x, y, width, height, format, type, bufSize, data);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glReadnPixels(x, y, width, height, format, type, bufSize, data);
+	lgl__glTraceLeave(681, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetnMapdv(GLenum target, GLenum query, GLsizei bufSize, GLdouble *v)
+{
+	double lgl__start = lgl__glTraceEnter(682);
+
+	lgl__glReal_glGetnMapdv(target, query, bufSize, v);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetnMapdv(target, query, bufSize, v);
+	lgl__glTraceLeave(682, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetnMapfv(GLenum target, GLenum query, GLsizei bufSize, GLfloat *v)
+{
+	double lgl__start = lgl__glTraceEnter(683);
+
+	lgl__glReal_glGetnMapfv(target, query, bufSize, v);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetnMapfv(target, query, bufSize, v);
+	lgl__glTraceLeave(683, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetnMapiv(GLenum target, GLenum query, GLsizei bufSize, GLint *v)
+{
+	double lgl__start = lgl__glTraceEnter(684);
+
+	lgl__glReal_glGetnMapiv(target, query, bufSize, v);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetnMapiv(target, query, bufSize, v);
+	lgl__glTraceLeave(684, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetnPixelMapfv(GLenum map, GLsizei bufSize, GLfloat *values)
+{
+	double lgl__start = lgl__glTraceEnter(685);
+
+	lgl__glReal_glGetnPixelMapfv(map, bufSize, values);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetnPixelMapfv(map, bufSize, values);
+	lgl__glTraceLeave(685, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetnPixelMapuiv(GLenum map, GLsizei bufSize, GLuint *values)
+{
+	double lgl__start = lgl__glTraceEnter(686);
+
+	lgl__glReal_glGetnPixelMapuiv(map, bufSize, values);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetnPixelMapuiv(map, bufSize, values);
+	lgl__glTraceLeave(686, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetnPixelMapusv(GLenum map, GLsizei bufSize, GLushort *values)
+{
+	double lgl__start = lgl__glTraceEnter(687);
+
+	lgl__glReal_glGetnPixelMapusv(map, bufSize, values);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetnPixelMapusv(map, bufSize, values);
+	lgl__glTraceLeave(687, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetnPolygonStipple(GLsizei bufSize, GLubyte *pattern)
+{
+	double lgl__start = lgl__glTraceEnter(688);
+
+	lgl__glReal_glGetnPolygonStipple(bufSize, pattern);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetnPolygonStipple(bufSize, pattern);
+	lgl__glTraceLeave(688, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetnColorTable(GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *table)
+{
+	double lgl__start = lgl__glTraceEnter(689);
+
+	lgl__glReal_glGetnColorTable(target, format, type, bufSize, table);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetnColorTable(target, format, type, bufSize, table);
+	lgl__glTraceLeave(689, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetnConvolutionFilter(GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *image)
+{
+	double lgl__start = lgl__glTraceEnter(690);
+
+	lgl__glReal_glGetnConvolutionFilter(target, format, type, bufSize, image);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetnConvolutionFilter(target, format, type, bufSize, image);
+	lgl__glTraceLeave(690, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetnSeparableFilter(GLenum target, GLenum format, GLenum type, GLsizei rowBufSize, void *row, GLsizei columnBufSize, void *column, void *span)
+{
+	double lgl__start = lgl__glTraceEnter(691);
+
+	lgl__glReal_glGetnSeparableFilter(target, format, type, rowBufSize, row, columnBufSize, column, span);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetnSeparableFilter(target, format, type, rowBufSize, row, columnBufSize, column, span);
+	lgl__glTraceLeave(691, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetnHistogram(GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values)
+{
+	double lgl__start = lgl__glTraceEnter(692);
+
+	lgl__glReal_glGetnHistogram(target, reset, format, type, bufSize, values);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetnHistogram(target, reset, format, type, bufSize, values);
+	lgl__glTraceLeave(692, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glGetnMinmax(GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values)
+{
+	double lgl__start = lgl__glTraceEnter(693);
+
+	lgl__glReal_glGetnMinmax(target, reset, format, type, bufSize, values);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glGetnMinmax(target, reset, format, type, bufSize, values);
+	lgl__glTraceLeave(693, 1, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glTextureBarrier(void)
+{
+	double lgl__start = lgl__glTraceEnter(694);
+
+	lgl__glReal_glTextureBarrier();
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glTextureBarrier();
+	lgl__glTraceLeave(694, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glSpecializeShader(GLuint shader, const GLchar *pEntryPoint, GLuint numSpecializationConstants, const GLuint *pConstantIndex, const GLuint *pConstantValue)
+{
+	double lgl__start = lgl__glTraceEnter(695);
+
+	lgl__glReal_glSpecializeShader(shader, pEntryPoint, numSpecializationConstants, pConstantIndex, pConstantValue);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glSpecializeShader(shader, pEntryPoint, numSpecializationConstants, pConstantIndex, pConstantValue);
+	lgl__glTraceLeave(695, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glMultiDrawArraysIndirectCount(GLenum mode, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride)
+{
+	double lgl__start = lgl__glTraceEnter(696);
+
+	lgl__glReal_glMultiDrawArraysIndirectCount(mode, indirect, drawcount, maxdrawcount, stride);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glMultiDrawArraysIndirectCount(mode, indirect, drawcount, maxdrawcount, stride);
+	lgl__glTraceLeave(696, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glMultiDrawElementsIndirectCount(GLenum mode, GLenum type, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride)
+{
+	double lgl__start = lgl__glTraceEnter(697);
+
+	lgl__glReal_glMultiDrawElementsIndirectCount(mode, type, indirect, drawcount, maxdrawcount, stride);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glMultiDrawElementsIndirectCount(mode, type, indirect, drawcount, maxdrawcount, stride);
+	lgl__glTraceLeave(697, 0, lgl__start);
+}
+
+static void APIENTRY lgl__glTrace_glPolygonOffsetClamp(GLfloat factor, GLfloat units, GLfloat clamp)
+{
+	double lgl__start = lgl__glTraceEnter(698);
+
+	lgl__glReal_glPolygonOffsetClamp(factor, units, clamp);
+	if (lgl__glTrace.capture && lgl__glTrace.depth == 1)
+		lgl__glCapture_glPolygonOffsetClamp(factor, units, clamp);
+	lgl__glTraceLeave(698, 0, lgl__start);
+}
+
+/* swaps the wrappers into glad's pointers, or the real functions back where
+ * the pointers still hold the wrappers; returns how many were hooked again
+ * since, and still chain through them */
+static int lgl__glTraceHook(int install)
+{
+	int left = 0;
+
+	if (install) {
+		lgl__glReal_glCullFace = glad_glCullFace;
+		if (glad_glCullFace) glad_glCullFace = lgl__glTrace_glCullFace;
+		lgl__glReal_glFrontFace = glad_glFrontFace;
+		if (glad_glFrontFace) glad_glFrontFace = lgl__glTrace_glFrontFace;
+		lgl__glReal_glHint = glad_glHint;
+		if (glad_glHint) glad_glHint = lgl__glTrace_glHint;
+		lgl__glReal_glLineWidth = glad_glLineWidth;
+		if (glad_glLineWidth) glad_glLineWidth = lgl__glTrace_glLineWidth;
+		lgl__glReal_glPointSize = glad_glPointSize;
+		if (glad_glPointSize) glad_glPointSize = lgl__glTrace_glPointSize;
+		lgl__glReal_glPolygonMode = glad_glPolygonMode;
+		if (glad_glPolygonMode) glad_glPolygonMode = lgl__glTrace_glPolygonMode;
+		lgl__glReal_glScissor = glad_glScissor;
+		if (glad_glScissor) glad_glScissor = lgl__glTrace_glScissor;
+		lgl__glReal_glTexParameterf = glad_glTexParameterf;
+		if (glad_glTexParameterf) glad_glTexParameterf = lgl__glTrace_glTexParameterf;
+		lgl__glReal_glTexParameterfv = glad_glTexParameterfv;
+		if (glad_glTexParameterfv) glad_glTexParameterfv = lgl__glTrace_glTexParameterfv;
+		lgl__glReal_glTexParameteri = glad_glTexParameteri;
+		if (glad_glTexParameteri) glad_glTexParameteri = lgl__glTrace_glTexParameteri;
+		lgl__glReal_glTexParameteriv = glad_glTexParameteriv;
+		if (glad_glTexParameteriv) glad_glTexParameteriv = lgl__glTrace_glTexParameteriv;
+		lgl__glReal_glTexImage1D = glad_glTexImage1D;
+		if (glad_glTexImage1D) glad_glTexImage1D = lgl__glTrace_glTexImage1D;
+		lgl__glReal_glTexImage2D = glad_glTexImage2D;
+		if (glad_glTexImage2D) glad_glTexImage2D = lgl__glTrace_glTexImage2D;
+		lgl__glReal_glDrawBuffer = glad_glDrawBuffer;
+		if (glad_glDrawBuffer) glad_glDrawBuffer = lgl__glTrace_glDrawBuffer;
+		lgl__glReal_glClear = glad_glClear;
+		if (glad_glClear) glad_glClear = lgl__glTrace_glClear;
+		lgl__glReal_glClearColor = glad_glClearColor;
+		if (glad_glClearColor) glad_glClearColor = lgl__glTrace_glClearColor;
+		lgl__glReal_glClearStencil = glad_glClearStencil;
+		if (glad_glClearStencil) glad_glClearStencil = lgl__glTrace_glClearStencil;
+		lgl__glReal_glClearDepth = glad_glClearDepth;
+		if (glad_glClearDepth) glad_glClearDepth = lgl__glTrace_glClearDepth;
+		lgl__glReal_glStencilMask = glad_glStencilMask;
+		if (glad_glStencilMask) glad_glStencilMask = lgl__glTrace_glStencilMask;
+		lgl__glReal_glColorMask = glad_glColorMask;
+		if (glad_glColorMask) glad_glColorMask = lgl__glTrace_glColorMask;
+		lgl__glReal_glDepthMask = glad_glDepthMask;
+		if (glad_glDepthMask) glad_glDepthMask = lgl__glTrace_glDepthMask;
+		lgl__glReal_glDisable = glad_glDisable;
+		if (glad_glDisable) glad_glDisable = lgl__glTrace_glDisable;
+		lgl__glReal_glEnable = glad_glEnable;
+		if (glad_glEnable) glad_glEnable = lgl__glTrace_glEnable;
+		lgl__glReal_glFinish = glad_glFinish;
+		if (glad_glFinish) glad_glFinish = lgl__glTrace_glFinish;
+		lgl__glReal_glFlush = glad_glFlush;
+		if (glad_glFlush) glad_glFlush = lgl__glTrace_glFlush;
+		lgl__glReal_glBlendFunc = glad_glBlendFunc;
+		if (glad_glBlendFunc) glad_glBlendFunc = lgl__glTrace_glBlendFunc;
+		lgl__glReal_glLogicOp = glad_glLogicOp;
+		if (glad_glLogicOp) glad_glLogicOp = lgl__glTrace_glLogicOp;
+		lgl__glReal_glStencilFunc = glad_glStencilFunc;
+		if (glad_glStencilFunc) glad_glStencilFunc = lgl__glTrace_glStencilFunc;
+		lgl__glReal_glStencilOp = glad_glStencilOp;
+		if (glad_glStencilOp) glad_glStencilOp = lgl__glTrace_glStencilOp;
+		lgl__glReal_glDepthFunc = glad_glDepthFunc;
+		if (glad_glDepthFunc) glad_glDepthFunc = lgl__glTrace_glDepthFunc;
+		lgl__glReal_glPixelStoref = glad_glPixelStoref;
+		if (glad_glPixelStoref) glad_glPixelStoref = lgl__glTrace_glPixelStoref;
+		lgl__glReal_glPixelStorei = glad_glPixelStorei;
+		if (glad_glPixelStorei) glad_glPixelStorei = lgl__glTrace_glPixelStorei;
+		lgl__glReal_glReadBuffer = glad_glReadBuffer;
+		if (glad_glReadBuffer) glad_glReadBuffer = lgl__glTrace_glReadBuffer;
+		lgl__glReal_glReadPixels = glad_glReadPixels;
+		if (glad_glReadPixels) glad_glReadPixels = lgl__glTrace_glReadPixels;
+		lgl__glReal_glGetBooleanv = glad_glGetBooleanv;
+		if (glad_glGetBooleanv) glad_glGetBooleanv = lgl__glTrace_glGetBooleanv;
+		lgl__glReal_glGetDoublev = glad_glGetDoublev;
+		if (glad_glGetDoublev) glad_glGetDoublev = lgl__glTrace_glGetDoublev;
+		lgl__glReal_glGetError = glad_glGetError;
+		if (glad_glGetError) glad_glGetError = lgl__glTrace_glGetError;
+		lgl__glReal_glGetFloatv = glad_glGetFloatv;
+		if (glad_glGetFloatv) glad_glGetFloatv = lgl__glTrace_glGetFloatv;
+		lgl__glReal_glGetIntegerv = glad_glGetIntegerv;
+		if (glad_glGetIntegerv) glad_glGetIntegerv = lgl__glTrace_glGetIntegerv;
+		lgl__glReal_glGetString = glad_glGetString;
+		if (glad_glGetString) glad_glGetString = lgl__glTrace_glGetString;
+		lgl__glReal_glGetTexImage = glad_glGetTexImage;
+		if (glad_glGetTexImage) glad_glGetTexImage = lgl__glTrace_glGetTexImage;
+		lgl__glReal_glGetTexParameterfv = glad_glGetTexParameterfv;
+		if (glad_glGetTexParameterfv) glad_glGetTexParameterfv = lgl__glTrace_glGetTexParameterfv;
+		lgl__glReal_glGetTexParameteriv = glad_glGetTexParameteriv;
+		if (glad_glGetTexParameteriv) glad_glGetTexParameteriv = lgl__glTrace_glGetTexParameteriv;
+		lgl__glReal_glGetTexLevelParameterfv = glad_glGetTexLevelParameterfv;
+		if (glad_glGetTexLevelParameterfv) glad_glGetTexLevelParameterfv = lgl__glTrace_glGetTexLevelParameterfv;
+		lgl__glReal_glGetTexLevelParameteriv = glad_glGetTexLevelParameteriv;
+		if (glad_glGetTexLevelParameteriv) glad_glGetTexLevelParameteriv = lgl__glTrace_glGetTexLevelParameteriv;
+		lgl__glReal_glIsEnabled = glad_glIsEnabled;
+		if (glad_glIsEnabled) glad_glIsEnabled = lgl__glTrace_glIsEnabled;
+		lgl__glReal_glDepthRange = glad_glDepthRange;
+		if (glad_glDepthRange) glad_glDepthRange = lgl__glTrace_glDepthRange;
+		lgl__glReal_glViewport = glad_glViewport;
+		if (glad_glViewport) glad_glViewport = lgl__glTrace_glViewport;
+		lgl__glReal_glDrawArrays = glad_glDrawArrays;
+		if (glad_glDrawArrays) glad_glDrawArrays = lgl__glTrace_glDrawArrays;
+		lgl__glReal_glDrawElements = glad_glDrawElements;
+		if (glad_glDrawElements) glad_glDrawElements = lgl__glTrace_glDrawElements;
+		lgl__glReal_glPolygonOffset = glad_glPolygonOffset;
+		if (glad_glPolygonOffset) glad_glPolygonOffset = lgl__glTrace_glPolygonOffset;
+		lgl__glReal_glCopyTexImage1D = glad_glCopyTexImage1D;
+		if (glad_glCopyTexImage1D) glad_glCopyTexImage1D = lgl__glTrace_glCopyTexImage1D;
+		lgl__glReal_glCopyTexImage2D = glad_glCopyTexImage2D;
+		if (glad_glCopyTexImage2D) glad_glCopyTexImage2D = lgl__glTrace_glCopyTexImage2D;
+		lgl__glReal_glCopyTexSubImage1D = glad_glCopyTexSubImage1D;
+		if (glad_glCopyTexSubImage1D) glad_glCopyTexSubImage1D = lgl__glTrace_glCopyTexSubImage1D;
+		lgl__glReal_glCopyTexSubImage2D = glad_glCopyTexSubImage2D;
+		if (glad_glCopyTexSubImage2D) glad_glCopyTexSubImage2D = lgl__glTrace_glCopyTexSubImage2D;
+		lgl__glReal_glTexSubImage1D = glad_glTexSubImage1D;
+		if (glad_glTexSubImage1D) glad_glTexSubImage1D = lgl__glTrace_glTexSubImage1D;
+		lgl__glReal_glTexSubImage2D = glad_glTexSubImage2D;
+		if (glad_glTexSubImage2D) glad_glTexSubImage2D = lgl__glTrace_glTexSubImage2D;
+		lgl__glReal_glBindTexture = glad_glBindTexture;
+		if (glad_glBindTexture) glad_glBindTexture = lgl__glTrace_glBindTexture;
+		lgl__glReal_glDeleteTextures = glad_glDeleteTextures;
+		if (glad_glDeleteTextures) glad_glDeleteTextures = lgl__glTrace_glDeleteTextures;
+		lgl__glReal_glGenTextures = glad_glGenTextures;
+		if (glad_glGenTextures) glad_glGenTextures = lgl__glTrace_glGenTextures;
+		lgl__glReal_glIsTexture = glad_glIsTexture;
+		if (glad_glIsTexture) glad_glIsTexture = lgl__glTrace_glIsTexture;
+		lgl__glReal_glDrawRangeElements = glad_glDrawRangeElements;
+		if (glad_glDrawRangeElements) glad_glDrawRangeElements = lgl__glTrace_glDrawRangeElements;
+		lgl__glReal_glTexImage3D = glad_glTexImage3D;
+		if (glad_glTexImage3D) glad_glTexImage3D = lgl__glTrace_glTexImage3D;
+		lgl__glReal_glTexSubImage3D = glad_glTexSubImage3D;
+		if (glad_glTexSubImage3D) glad_glTexSubImage3D = lgl__glTrace_glTexSubImage3D;
+		lgl__glReal_glCopyTexSubImage3D = glad_glCopyTexSubImage3D;
+		if (glad_glCopyTexSubImage3D) glad_glCopyTexSubImage3D = lgl__glTrace_glCopyTexSubImage3D;
+		lgl__glReal_glActiveTexture = glad_glActiveTexture;
+		if (glad_glActiveTexture) glad_glActiveTexture = lgl__glTrace_glActiveTexture;
+		lgl__glReal_glSampleCoverage = glad_glSampleCoverage;
+		if (glad_glSampleCoverage) glad_glSampleCoverage = lgl__glTrace_glSampleCoverage;
+		lgl__glReal_glCompressedTexImage3D = glad_glCompressedTexImage3D;
+		if (glad_glCompressedTexImage3D) glad_glCompressedTexImage3D = lgl__glTrace_glCompressedTexImage3D;
+		lgl__glReal_glCompressedTexImage2D = glad_glCompressedTexImage2D;
+		if (glad_glCompressedTexImage2D) glad_glCompressedTexImage2D = lgl__glTrace_glCompressedTexImage2D;
+		lgl__glReal_glCompressedTexImage1D = glad_glCompressedTexImage1D;
+		if (glad_glCompressedTexImage1D) glad_glCompressedTexImage1D = lgl__glTrace_glCompressedTexImage1D;
+		lgl__glReal_glCompressedTexSubImage3D = glad_glCompressedTexSubImage3D;
+		if (glad_glCompressedTexSubImage3D) glad_glCompressedTexSubImage3D = lgl__glTrace_glCompressedTexSubImage3D;
+		lgl__glReal_glCompressedTexSubImage2D = glad_glCompressedTexSubImage2D;
+		if (glad_glCompressedTexSubImage2D) glad_glCompressedTexSubImage2D = lgl__glTrace_glCompressedTexSubImage2D;
+		lgl__glReal_glCompressedTexSubImage1D = glad_glCompressedTexSubImage1D;
+		if (glad_glCompressedTexSubImage1D) glad_glCompressedTexSubImage1D = lgl__glTrace_glCompressedTexSubImage1D;
+		lgl__glReal_glGetCompressedTexImage = glad_glGetCompressedTexImage;
+		if (glad_glGetCompressedTexImage) glad_glGetCompressedTexImage = lgl__glTrace_glGetCompressedTexImage;
+		lgl__glReal_glBlendFuncSeparate = glad_glBlendFuncSeparate;
+		if (glad_glBlendFuncSeparate) glad_glBlendFuncSeparate = lgl__glTrace_glBlendFuncSeparate;
+		lgl__glReal_glMultiDrawArrays = glad_glMultiDrawArrays;
+		if (glad_glMultiDrawArrays) glad_glMultiDrawArrays = lgl__glTrace_glMultiDrawArrays;
+		lgl__glReal_glMultiDrawElements = glad_glMultiDrawElements;
+		if (glad_glMultiDrawElements) glad_glMultiDrawElements = lgl__glTrace_glMultiDrawElements;
+		lgl__glReal_glPointParameterf = glad_glPointParameterf;
+		if (glad_glPointParameterf) glad_glPointParameterf = lgl__glTrace_glPointParameterf;
+		lgl__glReal_glPointParameterfv = glad_glPointParameterfv;
+		if (glad_glPointParameterfv) glad_glPointParameterfv = lgl__glTrace_glPointParameterfv;
+		lgl__glReal_glPointParameteri = glad_glPointParameteri;
+		if (glad_glPointParameteri) glad_glPointParameteri = lgl__glTrace_glPointParameteri;
+		lgl__glReal_glPointParameteriv = glad_glPointParameteriv;
+		if (glad_glPointParameteriv) glad_glPointParameteriv = lgl__glTrace_glPointParameteriv;
+		lgl__glReal_glBlendColor = glad_glBlendColor;
+		if (glad_glBlendColor) glad_glBlendColor = lgl__glTrace_glBlendColor;
+		lgl__glReal_glBlendEquation = glad_glBlendEquation;
+		if (glad_glBlendEquation) glad_glBlendEquation = lgl__glTrace_glBlendEquation;
+		lgl__glReal_glGenQueries = glad_glGenQueries;
+		if (glad_glGenQueries) glad_glGenQueries = lgl__glTrace_glGenQueries;
+		lgl__glReal_glDeleteQueries = glad_glDeleteQueries;
+		if (glad_glDeleteQueries) glad_glDeleteQueries = lgl__glTrace_glDeleteQueries;
+		lgl__glReal_glIsQuery = glad_glIsQuery;
+		if (glad_glIsQuery) glad_glIsQuery = lgl__glTrace_glIsQuery;
+		lgl__glReal_glBeginQuery = glad_glBeginQuery;
+		if (glad_glBeginQuery) glad_glBeginQuery = lgl__glTrace_glBeginQuery;
+		lgl__glReal_glEndQuery = glad_glEndQuery;
+		if (glad_glEndQuery) glad_glEndQuery = lgl__glTrace_glEndQuery;
+		lgl__glReal_glGetQueryiv = glad_glGetQueryiv;
+		if (glad_glGetQueryiv) glad_glGetQueryiv = lgl__glTrace_glGetQueryiv;
+		lgl__glReal_glGetQueryObjectiv = glad_glGetQueryObjectiv;
+		if (glad_glGetQueryObjectiv) glad_glGetQueryObjectiv = lgl__glTrace_glGetQueryObjectiv;
+		lgl__glReal_glGetQueryObjectuiv = glad_glGetQueryObjectuiv;
+		if (glad_glGetQueryObjectuiv) glad_glGetQueryObjectuiv = lgl__glTrace_glGetQueryObjectuiv;
+		lgl__glReal_glBindBuffer = glad_glBindBuffer;
+		if (glad_glBindBuffer) glad_glBindBuffer = lgl__glTrace_glBindBuffer;
+		lgl__glReal_glDeleteBuffers = glad_glDeleteBuffers;
+		if (glad_glDeleteBuffers) glad_glDeleteBuffers = lgl__glTrace_glDeleteBuffers;
+		lgl__glReal_glGenBuffers = glad_glGenBuffers;
+		if (glad_glGenBuffers) glad_glGenBuffers = lgl__glTrace_glGenBuffers;
+		lgl__glReal_glIsBuffer = glad_glIsBuffer;
+		if (glad_glIsBuffer) glad_glIsBuffer = lgl__glTrace_glIsBuffer;
+		lgl__glReal_glBufferData = glad_glBufferData;
+		if (glad_glBufferData) glad_glBufferData = lgl__glTrace_glBufferData;
+		lgl__glReal_glBufferSubData = glad_glBufferSubData;
+		if (glad_glBufferSubData) glad_glBufferSubData = lgl__glTrace_glBufferSubData;
+		lgl__glReal_glGetBufferSubData = glad_glGetBufferSubData;
+		if (glad_glGetBufferSubData) glad_glGetBufferSubData = lgl__glTrace_glGetBufferSubData;
+		lgl__glReal_glMapBuffer = glad_glMapBuffer;
+		if (glad_glMapBuffer) glad_glMapBuffer = lgl__glTrace_glMapBuffer;
+		lgl__glReal_glUnmapBuffer = glad_glUnmapBuffer;
+		if (glad_glUnmapBuffer) glad_glUnmapBuffer = lgl__glTrace_glUnmapBuffer;
+		lgl__glReal_glGetBufferParameteriv = glad_glGetBufferParameteriv;
+		if (glad_glGetBufferParameteriv) glad_glGetBufferParameteriv = lgl__glTrace_glGetBufferParameteriv;
+		lgl__glReal_glGetBufferPointerv = glad_glGetBufferPointerv;
+		if (glad_glGetBufferPointerv) glad_glGetBufferPointerv = lgl__glTrace_glGetBufferPointerv;
+		lgl__glReal_glBlendEquationSeparate = glad_glBlendEquationSeparate;
+		if (glad_glBlendEquationSeparate) glad_glBlendEquationSeparate = lgl__glTrace_glBlendEquationSeparate;
+		lgl__glReal_glDrawBuffers = glad_glDrawBuffers;
+		if (glad_glDrawBuffers) glad_glDrawBuffers = lgl__glTrace_glDrawBuffers;
+		lgl__glReal_glStencilOpSeparate = glad_glStencilOpSeparate;
+		if (glad_glStencilOpSeparate) glad_glStencilOpSeparate = lgl__glTrace_glStencilOpSeparate;
+		lgl__glReal_glStencilFuncSeparate = glad_glStencilFuncSeparate;
+		if (glad_glStencilFuncSeparate) glad_glStencilFuncSeparate = lgl__glTrace_glStencilFuncSeparate;
+		lgl__glReal_glStencilMaskSeparate = glad_glStencilMaskSeparate;
+		if (glad_glStencilMaskSeparate) glad_glStencilMaskSeparate = lgl__glTrace_glStencilMaskSeparate;
+		lgl__glReal_glAttachShader = glad_glAttachShader;
+		if (glad_glAttachShader) glad_glAttachShader = lgl__glTrace_glAttachShader;
+		lgl__glReal_glBindAttribLocation = glad_glBindAttribLocation;
+		if (glad_glBindAttribLocation) glad_glBindAttribLocation = lgl__glTrace_glBindAttribLocation;
+		lgl__glReal_glCompileShader = glad_glCompileShader;
+		if (glad_glCompileShader) glad_glCompileShader = lgl__glTrace_glCompileShader;
+		lgl__glReal_glCreateProgram = glad_glCreateProgram;
+		if (glad_glCreateProgram) glad_glCreateProgram = lgl__glTrace_glCreateProgram;
+		lgl__glReal_glCreateShader = glad_glCreateShader;
+		if (glad_glCreateShader) glad_glCreateShader = lgl__glTrace_glCreateShader;
+		lgl__glReal_glDeleteProgram = glad_glDeleteProgram;
+		if (glad_glDeleteProgram) glad_glDeleteProgram = lgl__glTrace_glDeleteProgram;
+		lgl__glReal_glDeleteShader = glad_glDeleteShader;
+		if (glad_glDeleteShader) glad_glDeleteShader = lgl__glTrace_glDeleteShader;
+		lgl__glReal_glDetachShader = glad_glDetachShader;
+		if (glad_glDetachShader) glad_glDetachShader = lgl__glTrace_glDetachShader;
+		lgl__glReal_glDisableVertexAttribArray = glad_glDisableVertexAttribArray;
+		if (glad_glDisableVertexAttribArray) glad_glDisableVertexAttribArray = lgl__glTrace_glDisableVertexAttribArray;
+		lgl__glReal_glEnableVertexAttribArray = glad_glEnableVertexAttribArray;
+		if (glad_glEnableVertexAttribArray) glad_glEnableVertexAttribArray = lgl__glTrace_glEnableVertexAttribArray;
+		lgl__glReal_glGetActiveAttrib = glad_glGetActiveAttrib;
+		if (glad_glGetActiveAttrib) glad_glGetActiveAttrib = lgl__glTrace_glGetActiveAttrib;
+		lgl__glReal_glGetActiveUniform = glad_glGetActiveUniform;
+		if (glad_glGetActiveUniform) glad_glGetActiveUniform = lgl__glTrace_glGetActiveUniform;
+		lgl__glReal_glGetAttachedShaders = glad_glGetAttachedShaders;
+		if (glad_glGetAttachedShaders) glad_glGetAttachedShaders = lgl__glTrace_glGetAttachedShaders;
+		lgl__glReal_glGetAttribLocation = glad_glGetAttribLocation;
+		if (glad_glGetAttribLocation) glad_glGetAttribLocation = lgl__glTrace_glGetAttribLocation;
+		lgl__glReal_glGetProgramiv = glad_glGetProgramiv;
+		if (glad_glGetProgramiv) glad_glGetProgramiv = lgl__glTrace_glGetProgramiv;
+		lgl__glReal_glGetProgramInfoLog = glad_glGetProgramInfoLog;
+		if (glad_glGetProgramInfoLog) glad_glGetProgramInfoLog = lgl__glTrace_glGetProgramInfoLog;
+		lgl__glReal_glGetShaderiv = glad_glGetShaderiv;
+		if (glad_glGetShaderiv) glad_glGetShaderiv = lgl__glTrace_glGetShaderiv;
+		lgl__glReal_glGetShaderInfoLog = glad_glGetShaderInfoLog;
+		if (glad_glGetShaderInfoLog) glad_glGetShaderInfoLog = lgl__glTrace_glGetShaderInfoLog;
+		lgl__glReal_glGetShaderSource = glad_glGetShaderSource;
+		if (glad_glGetShaderSource) glad_glGetShaderSource = lgl__glTrace_glGetShaderSource;
+		lgl__glReal_glGetUniformLocation = glad_glGetUniformLocation;
+		if (glad_glGetUniformLocation) glad_glGetUniformLocation = lgl__glTrace_glGetUniformLocation;
+		lgl__glReal_glGetUniformfv = glad_glGetUniformfv;
+		if (glad_glGetUniformfv) glad_glGetUniformfv = lgl__glTrace_glGetUniformfv;
+		lgl__glReal_glGetUniformiv = glad_glGetUniformiv;
+		if (glad_glGetUniformiv) glad_glGetUniformiv = lgl__glTrace_glGetUniformiv;
+		lgl__glReal_glGetVertexAttribdv = glad_glGetVertexAttribdv;
+		if (glad_glGetVertexAttribdv) glad_glGetVertexAttribdv = lgl__glTrace_glGetVertexAttribdv;
+		lgl__glReal_glGetVertexAttribfv = glad_glGetVertexAttribfv;
+		if (glad_glGetVertexAttribfv) glad_glGetVertexAttribfv = lgl__glTrace_glGetVertexAttribfv;
+		lgl__glReal_glGetVertexAttribiv = glad_glGetVertexAttribiv;
+		if (glad_glGetVertexAttribiv) glad_glGetVertexAttribiv = lgl__glTrace_glGetVertexAttribiv;
+		lgl__glReal_glGetVertexAttribPointerv = glad_glGetVertexAttribPointerv;
+		if (glad_glGetVertexAttribPointerv) glad_glGetVertexAttribPointerv = lgl__glTrace_glGetVertexAttribPointerv;
+		lgl__glReal_glIsProgram = glad_glIsProgram;
+		if (glad_glIsProgram) glad_glIsProgram = lgl__glTrace_glIsProgram;
+		lgl__glReal_glIsShader = glad_glIsShader;
+		if (glad_glIsShader) glad_glIsShader = lgl__glTrace_glIsShader;
+		lgl__glReal_glLinkProgram = glad_glLinkProgram;
+		if (glad_glLinkProgram) glad_glLinkProgram = lgl__glTrace_glLinkProgram;
+		lgl__glReal_glShaderSource = glad_glShaderSource;
+		if (glad_glShaderSource) glad_glShaderSource = lgl__glTrace_glShaderSource;
+		lgl__glReal_glUseProgram = glad_glUseProgram;
+		if (glad_glUseProgram) glad_glUseProgram = lgl__glTrace_glUseProgram;
+		lgl__glReal_glUniform1f = glad_glUniform1f;
+		if (glad_glUniform1f) glad_glUniform1f = lgl__glTrace_glUniform1f;
+		lgl__glReal_glUniform2f = glad_glUniform2f;
+		if (glad_glUniform2f) glad_glUniform2f = lgl__glTrace_glUniform2f;
+		lgl__glReal_glUniform3f = glad_glUniform3f;
+		if (glad_glUniform3f) glad_glUniform3f = lgl__glTrace_glUniform3f;
+		lgl__glReal_glUniform4f = glad_glUniform4f;
+		if (glad_glUniform4f) glad_glUniform4f = lgl__glTrace_glUniform4f;
+		lgl__glReal_glUniform1i = glad_glUniform1i;
+		if (glad_glUniform1i) glad_glUniform1i = lgl__glTrace_glUniform1i;
+		lgl__glReal_glUniform2i = glad_glUniform2i;
+		if (glad_glUniform2i) glad_glUniform2i = lgl__glTrace_glUniform2i;
+		lgl__glReal_glUniform3i = glad_glUniform3i;
+		if (glad_glUniform3i) glad_glUniform3i = lgl__glTrace_glUniform3i;
+		lgl__glReal_glUniform4i = glad_glUniform4i;
+		if (glad_glUniform4i) glad_glUniform4i = lgl__glTrace_glUniform4i;
+		lgl__glReal_glUniform1fv = glad_glUniform1fv;
+		if (glad_glUniform1fv) glad_glUniform1fv = lgl__glTrace_glUniform1fv;
+		lgl__glReal_glUniform2fv = glad_glUniform2fv;
+		if (glad_glUniform2fv) glad_glUniform2fv = lgl__glTrace_glUniform2fv;
+		lgl__glReal_glUniform3fv = glad_glUniform3fv;
+		if (glad_glUniform3fv) glad_glUniform3fv = lgl__glTrace_glUniform3fv;
+		lgl__glReal_glUniform4fv = glad_glUniform4fv;
+		if (glad_glUniform4fv) glad_glUniform4fv = lgl__glTrace_glUniform4fv;
+		lgl__glReal_glUniform1iv = glad_glUniform1iv;
+		if (glad_glUniform1iv) glad_glUniform1iv = lgl__glTrace_glUniform1iv;
+		lgl__glReal_glUniform2iv = glad_glUniform2iv;
+		if (glad_glUniform2iv) glad_glUniform2iv = lgl__glTrace_glUniform2iv;
+		lgl__glReal_glUniform3iv = glad_glUniform3iv;
+		if (glad_glUniform3iv) glad_glUniform3iv = lgl__glTrace_glUniform3iv;
+		lgl__glReal_glUniform4iv = glad_glUniform4iv;
+		if (glad_glUniform4iv) glad_glUniform4iv = lgl__glTrace_glUniform4iv;
+		lgl__glReal_glUniformMatrix2fv = glad_glUniformMatrix2fv;
+		if (glad_glUniformMatrix2fv) glad_glUniformMatrix2fv = lgl__glTrace_glUniformMatrix2fv;
+		lgl__glReal_glUniformMatrix3fv = glad_glUniformMatrix3fv;
+		if (glad_glUniformMatrix3fv) glad_glUniformMatrix3fv = lgl__glTrace_glUniformMatrix3fv;
+		lgl__glReal_glUniformMatrix4fv = glad_glUniformMatrix4fv;
+		if (glad_glUniformMatrix4fv) glad_glUniformMatrix4fv = lgl__glTrace_glUniformMatrix4fv;
+		lgl__glReal_glValidateProgram = glad_glValidateProgram;
+		if (glad_glValidateProgram) glad_glValidateProgram = lgl__glTrace_glValidateProgram;
+		lgl__glReal_glVertexAttrib1d = glad_glVertexAttrib1d;
+		if (glad_glVertexAttrib1d) glad_glVertexAttrib1d = lgl__glTrace_glVertexAttrib1d;
+		lgl__glReal_glVertexAttrib1dv = glad_glVertexAttrib1dv;
+		if (glad_glVertexAttrib1dv) glad_glVertexAttrib1dv = lgl__glTrace_glVertexAttrib1dv;
+		lgl__glReal_glVertexAttrib1f = glad_glVertexAttrib1f;
+		if (glad_glVertexAttrib1f) glad_glVertexAttrib1f = lgl__glTrace_glVertexAttrib1f;
+		lgl__glReal_glVertexAttrib1fv = glad_glVertexAttrib1fv;
+		if (glad_glVertexAttrib1fv) glad_glVertexAttrib1fv = lgl__glTrace_glVertexAttrib1fv;
+		lgl__glReal_glVertexAttrib1s = glad_glVertexAttrib1s;
+		if (glad_glVertexAttrib1s) glad_glVertexAttrib1s = lgl__glTrace_glVertexAttrib1s;
+		lgl__glReal_glVertexAttrib1sv = glad_glVertexAttrib1sv;
+		if (glad_glVertexAttrib1sv) glad_glVertexAttrib1sv = lgl__glTrace_glVertexAttrib1sv;
+		lgl__glReal_glVertexAttrib2d = glad_glVertexAttrib2d;
+		if (glad_glVertexAttrib2d) glad_glVertexAttrib2d = lgl__glTrace_glVertexAttrib2d;
+		lgl__glReal_glVertexAttrib2dv = glad_glVertexAttrib2dv;
+		if (glad_glVertexAttrib2dv) glad_glVertexAttrib2dv = lgl__glTrace_glVertexAttrib2dv;
+		lgl__glReal_glVertexAttrib2f = glad_glVertexAttrib2f;
+		if (glad_glVertexAttrib2f) glad_glVertexAttrib2f = lgl__glTrace_glVertexAttrib2f;
+		lgl__glReal_glVertexAttrib2fv = glad_glVertexAttrib2fv;
+		if (glad_glVertexAttrib2fv) glad_glVertexAttrib2fv = lgl__glTrace_glVertexAttrib2fv;
+		lgl__glReal_glVertexAttrib2s = glad_glVertexAttrib2s;
+		if (glad_glVertexAttrib2s) glad_glVertexAttrib2s = lgl__glTrace_glVertexAttrib2s;
+		lgl__glReal_glVertexAttrib2sv = glad_glVertexAttrib2sv;
+		if (glad_glVertexAttrib2sv) glad_glVertexAttrib2sv = lgl__glTrace_glVertexAttrib2sv;
+		lgl__glReal_glVertexAttrib3d = glad_glVertexAttrib3d;
+		if (glad_glVertexAttrib3d) glad_glVertexAttrib3d = lgl__glTrace_glVertexAttrib3d;
+		lgl__glReal_glVertexAttrib3dv = glad_glVertexAttrib3dv;
+		if (glad_glVertexAttrib3dv) glad_glVertexAttrib3dv = lgl__glTrace_glVertexAttrib3dv;
+		lgl__glReal_glVertexAttrib3f = glad_glVertexAttrib3f;
+		if (glad_glVertexAttrib3f) glad_glVertexAttrib3f = lgl__glTrace_glVertexAttrib3f;
+		lgl__glReal_glVertexAttrib3fv = glad_glVertexAttrib3fv;
+		if (glad_glVertexAttrib3fv) glad_glVertexAttrib3fv = lgl__glTrace_glVertexAttrib3fv;
+		lgl__glReal_glVertexAttrib3s = glad_glVertexAttrib3s;
+		if (glad_glVertexAttrib3s) glad_glVertexAttrib3s = lgl__glTrace_glVertexAttrib3s;
+		lgl__glReal_glVertexAttrib3sv = glad_glVertexAttrib3sv;
+		if (glad_glVertexAttrib3sv) glad_glVertexAttrib3sv = lgl__glTrace_glVertexAttrib3sv;
+		lgl__glReal_glVertexAttrib4Nbv = glad_glVertexAttrib4Nbv;
+		if (glad_glVertexAttrib4Nbv) glad_glVertexAttrib4Nbv = lgl__glTrace_glVertexAttrib4Nbv;
+		lgl__glReal_glVertexAttrib4Niv = glad_glVertexAttrib4Niv;
+		if (glad_glVertexAttrib4Niv) glad_glVertexAttrib4Niv = lgl__glTrace_glVertexAttrib4Niv;
+		lgl__glReal_glVertexAttrib4Nsv = glad_glVertexAttrib4Nsv;
+		if (glad_glVertexAttrib4Nsv) glad_glVertexAttrib4Nsv = lgl__glTrace_glVertexAttrib4Nsv;
+		lgl__glReal_glVertexAttrib4Nub = glad_glVertexAttrib4Nub;
+		if (glad_glVertexAttrib4Nub) glad_glVertexAttrib4Nub = lgl__glTrace_glVertexAttrib4Nub;
+		lgl__glReal_glVertexAttrib4Nubv = glad_glVertexAttrib4Nubv;
+		if (glad_glVertexAttrib4Nubv) glad_glVertexAttrib4Nubv = lgl__glTrace_glVertexAttrib4Nubv;
+		lgl__glReal_glVertexAttrib4Nuiv = glad_glVertexAttrib4Nuiv;
+		if (glad_glVertexAttrib4Nuiv) glad_glVertexAttrib4Nuiv = lgl__glTrace_glVertexAttrib4Nuiv;
+		lgl__glReal_glVertexAttrib4Nusv = glad_glVertexAttrib4Nusv;
+		if (glad_glVertexAttrib4Nusv) glad_glVertexAttrib4Nusv = lgl__glTrace_glVertexAttrib4Nusv;
+		lgl__glReal_glVertexAttrib4bv = glad_glVertexAttrib4bv;
+		if (glad_glVertexAttrib4bv) glad_glVertexAttrib4bv = lgl__glTrace_glVertexAttrib4bv;
+		lgl__glReal_glVertexAttrib4d = glad_glVertexAttrib4d;
+		if (glad_glVertexAttrib4d) glad_glVertexAttrib4d = lgl__glTrace_glVertexAttrib4d;
+		lgl__glReal_glVertexAttrib4dv = glad_glVertexAttrib4dv;
+		if (glad_glVertexAttrib4dv) glad_glVertexAttrib4dv = lgl__glTrace_glVertexAttrib4dv;
+		lgl__glReal_glVertexAttrib4f = glad_glVertexAttrib4f;
+		if (glad_glVertexAttrib4f) glad_glVertexAttrib4f = lgl__glTrace_glVertexAttrib4f;
+		lgl__glReal_glVertexAttrib4fv = glad_glVertexAttrib4fv;
+		if (glad_glVertexAttrib4fv) glad_glVertexAttrib4fv = lgl__glTrace_glVertexAttrib4fv;
+		lgl__glReal_glVertexAttrib4iv = glad_glVertexAttrib4iv;
+		if (glad_glVertexAttrib4iv) glad_glVertexAttrib4iv = lgl__glTrace_glVertexAttrib4iv;
+		lgl__glReal_glVertexAttrib4s = glad_glVertexAttrib4s;
+		if (glad_glVertexAttrib4s) glad_glVertexAttrib4s = lgl__glTrace_glVertexAttrib4s;
+		lgl__glReal_glVertexAttrib4sv = glad_glVertexAttrib4sv;
+		if (glad_glVertexAttrib4sv) glad_glVertexAttrib4sv = lgl__glTrace_glVertexAttrib4sv;
+		lgl__glReal_glVertexAttrib4ubv = glad_glVertexAttrib4ubv;
+		if (glad_glVertexAttrib4ubv) glad_glVertexAttrib4ubv = lgl__glTrace_glVertexAttrib4ubv;
+		lgl__glReal_glVertexAttrib4uiv = glad_glVertexAttrib4uiv;
+		if (glad_glVertexAttrib4uiv) glad_glVertexAttrib4uiv = lgl__glTrace_glVertexAttrib4uiv;
+		lgl__glReal_glVertexAttrib4usv = glad_glVertexAttrib4usv;
+		if (glad_glVertexAttrib4usv) glad_glVertexAttrib4usv = lgl__glTrace_glVertexAttrib4usv;
+		lgl__glReal_glVertexAttribPointer = glad_glVertexAttribPointer;
+		if (glad_glVertexAttribPointer) glad_glVertexAttribPointer = lgl__glTrace_glVertexAttribPointer;
+		lgl__glReal_glUniformMatrix2x3fv = glad_glUniformMatrix2x3fv;
+		if (glad_glUniformMatrix2x3fv) glad_glUniformMatrix2x3fv = lgl__glTrace_glUniformMatrix2x3fv;
+		lgl__glReal_glUniformMatrix3x2fv = glad_glUniformMatrix3x2fv;
+		if (glad_glUniformMatrix3x2fv) glad_glUniformMatrix3x2fv = lgl__glTrace_glUniformMatrix3x2fv;
+		lgl__glReal_glUniformMatrix2x4fv = glad_glUniformMatrix2x4fv;
+		if (glad_glUniformMatrix2x4fv) glad_glUniformMatrix2x4fv = lgl__glTrace_glUniformMatrix2x4fv;
+		lgl__glReal_glUniformMatrix4x2fv = glad_glUniformMatrix4x2fv;
+		if (glad_glUniformMatrix4x2fv) glad_glUniformMatrix4x2fv = lgl__glTrace_glUniformMatrix4x2fv;
+		lgl__glReal_glUniformMatrix3x4fv = glad_glUniformMatrix3x4fv;
+		if (glad_glUniformMatrix3x4fv) glad_glUniformMatrix3x4fv = lgl__glTrace_glUniformMatrix3x4fv;
+		lgl__glReal_glUniformMatrix4x3fv = glad_glUniformMatrix4x3fv;
+		if (glad_glUniformMatrix4x3fv) glad_glUniformMatrix4x3fv = lgl__glTrace_glUniformMatrix4x3fv;
+		lgl__glReal_glColorMaski = glad_glColorMaski;
+		if (glad_glColorMaski) glad_glColorMaski = lgl__glTrace_glColorMaski;
+		lgl__glReal_glGetBooleani_v = glad_glGetBooleani_v;
+		if (glad_glGetBooleani_v) glad_glGetBooleani_v = lgl__glTrace_glGetBooleani_v;
+		lgl__glReal_glGetIntegeri_v = glad_glGetIntegeri_v;
+		if (glad_glGetIntegeri_v) glad_glGetIntegeri_v = lgl__glTrace_glGetIntegeri_v;
+		lgl__glReal_glEnablei = glad_glEnablei;
+		if (glad_glEnablei) glad_glEnablei = lgl__glTrace_glEnablei;
+		lgl__glReal_glDisablei = glad_glDisablei;
+		if (glad_glDisablei) glad_glDisablei = lgl__glTrace_glDisablei;
+		lgl__glReal_glIsEnabledi = glad_glIsEnabledi;
+		if (glad_glIsEnabledi) glad_glIsEnabledi = lgl__glTrace_glIsEnabledi;
+		lgl__glReal_glBeginTransformFeedback = glad_glBeginTransformFeedback;
+		if (glad_glBeginTransformFeedback) glad_glBeginTransformFeedback = lgl__glTrace_glBeginTransformFeedback;
+		lgl__glReal_glEndTransformFeedback = glad_glEndTransformFeedback;
+		if (glad_glEndTransformFeedback) glad_glEndTransformFeedback = lgl__glTrace_glEndTransformFeedback;
+		lgl__glReal_glBindBufferRange = glad_glBindBufferRange;
+		if (glad_glBindBufferRange) glad_glBindBufferRange = lgl__glTrace_glBindBufferRange;
+		lgl__glReal_glBindBufferBase = glad_glBindBufferBase;
+		if (glad_glBindBufferBase) glad_glBindBufferBase = lgl__glTrace_glBindBufferBase;
+		lgl__glReal_glTransformFeedbackVaryings = glad_glTransformFeedbackVaryings;
+		if (glad_glTransformFeedbackVaryings) glad_glTransformFeedbackVaryings = lgl__glTrace_glTransformFeedbackVaryings;
+		lgl__glReal_glGetTransformFeedbackVarying = glad_glGetTransformFeedbackVarying;
+		if (glad_glGetTransformFeedbackVarying) glad_glGetTransformFeedbackVarying = lgl__glTrace_glGetTransformFeedbackVarying;
+		lgl__glReal_glClampColor = glad_glClampColor;
+		if (glad_glClampColor) glad_glClampColor = lgl__glTrace_glClampColor;
+		lgl__glReal_glBeginConditionalRender = glad_glBeginConditionalRender;
+		if (glad_glBeginConditionalRender) glad_glBeginConditionalRender = lgl__glTrace_glBeginConditionalRender;
+		lgl__glReal_glEndConditionalRender = glad_glEndConditionalRender;
+		if (glad_glEndConditionalRender) glad_glEndConditionalRender = lgl__glTrace_glEndConditionalRender;
+		lgl__glReal_glVertexAttribIPointer = glad_glVertexAttribIPointer;
+		if (glad_glVertexAttribIPointer) glad_glVertexAttribIPointer = lgl__glTrace_glVertexAttribIPointer;
+		lgl__glReal_glGetVertexAttribIiv = glad_glGetVertexAttribIiv;
+		if (glad_glGetVertexAttribIiv) glad_glGetVertexAttribIiv = lgl__glTrace_glGetVertexAttribIiv;
+		lgl__glReal_glGetVertexAttribIuiv = glad_glGetVertexAttribIuiv;
+		if (glad_glGetVertexAttribIuiv) glad_glGetVertexAttribIuiv = lgl__glTrace_glGetVertexAttribIuiv;
+		lgl__glReal_glVertexAttribI1i = glad_glVertexAttribI1i;
+		if (glad_glVertexAttribI1i) glad_glVertexAttribI1i = lgl__glTrace_glVertexAttribI1i;
+		lgl__glReal_glVertexAttribI2i = glad_glVertexAttribI2i;
+		if (glad_glVertexAttribI2i) glad_glVertexAttribI2i = lgl__glTrace_glVertexAttribI2i;
+		lgl__glReal_glVertexAttribI3i = glad_glVertexAttribI3i;
+		if (glad_glVertexAttribI3i) glad_glVertexAttribI3i = lgl__glTrace_glVertexAttribI3i;
+		lgl__glReal_glVertexAttribI4i = glad_glVertexAttribI4i;
+		if (glad_glVertexAttribI4i) glad_glVertexAttribI4i = lgl__glTrace_glVertexAttribI4i;
+		lgl__glReal_glVertexAttribI1ui = glad_glVertexAttribI1ui;
+		if (glad_glVertexAttribI1ui) glad_glVertexAttribI1ui = lgl__glTrace_glVertexAttribI1ui;
+		lgl__glReal_glVertexAttribI2ui = glad_glVertexAttribI2ui;
+		if (glad_glVertexAttribI2ui) glad_glVertexAttribI2ui = lgl__glTrace_glVertexAttribI2ui;
+		lgl__glReal_glVertexAttribI3ui = glad_glVertexAttribI3ui;
+		if (glad_glVertexAttribI3ui) glad_glVertexAttribI3ui = lgl__glTrace_glVertexAttribI3ui;
+		lgl__glReal_glVertexAttribI4ui = glad_glVertexAttribI4ui;
+		if (glad_glVertexAttribI4ui) glad_glVertexAttribI4ui = lgl__glTrace_glVertexAttribI4ui;
+		lgl__glReal_glVertexAttribI1iv = glad_glVertexAttribI1iv;
+		if (glad_glVertexAttribI1iv) glad_glVertexAttribI1iv = lgl__glTrace_glVertexAttribI1iv;
+		lgl__glReal_glVertexAttribI2iv = glad_glVertexAttribI2iv;
+		if (glad_glVertexAttribI2iv) glad_glVertexAttribI2iv = lgl__glTrace_glVertexAttribI2iv;
+		lgl__glReal_glVertexAttribI3iv = glad_glVertexAttribI3iv;
+		if (glad_glVertexAttribI3iv) glad_glVertexAttribI3iv = lgl__glTrace_glVertexAttribI3iv;
+		lgl__glReal_glVertexAttribI4iv = glad_glVertexAttribI4iv;
+		if (glad_glVertexAttribI4iv) glad_glVertexAttribI4iv = lgl__glTrace_glVertexAttribI4iv;
+		lgl__glReal_glVertexAttribI1uiv = glad_glVertexAttribI1uiv;
+		if (glad_glVertexAttribI1uiv) glad_glVertexAttribI1uiv = lgl__glTrace_glVertexAttribI1uiv;
+		lgl__glReal_glVertexAttribI2uiv = glad_glVertexAttribI2uiv;
+		if (glad_glVertexAttribI2uiv) glad_glVertexAttribI2uiv = lgl__glTrace_glVertexAttribI2uiv;
+		lgl__glReal_glVertexAttribI3uiv = glad_glVertexAttribI3uiv;
+		if (glad_glVertexAttribI3uiv) glad_glVertexAttribI3uiv = lgl__glTrace_glVertexAttribI3uiv;
+		lgl__glReal_glVertexAttribI4uiv = glad_glVertexAttribI4uiv;
+		if (glad_glVertexAttribI4uiv) glad_glVertexAttribI4uiv = lgl__glTrace_glVertexAttribI4uiv;
+		lgl__glReal_glVertexAttribI4bv = glad_glVertexAttribI4bv;
+		if (glad_glVertexAttribI4bv) glad_glVertexAttribI4bv = lgl__glTrace_glVertexAttribI4bv;
+		lgl__glReal_glVertexAttribI4sv = glad_glVertexAttribI4sv;
+		if (glad_glVertexAttribI4sv) glad_glVertexAttribI4sv = lgl__glTrace_glVertexAttribI4sv;
+		lgl__glReal_glVertexAttribI4ubv = glad_glVertexAttribI4ubv;
+		if (glad_glVertexAttribI4ubv) glad_glVertexAttribI4ubv = lgl__glTrace_glVertexAttribI4ubv;
+		lgl__glReal_glVertexAttribI4usv = glad_glVertexAttribI4usv;
+		if (glad_glVertexAttribI4usv) glad_glVertexAttribI4usv = lgl__glTrace_glVertexAttribI4usv;
+		lgl__glReal_glGetUniformuiv = glad_glGetUniformuiv;
+		if (glad_glGetUniformuiv) glad_glGetUniformuiv = lgl__glTrace_glGetUniformuiv;
+		lgl__glReal_glBindFragDataLocation = glad_glBindFragDataLocation;
+		if (glad_glBindFragDataLocation) glad_glBindFragDataLocation = lgl__glTrace_glBindFragDataLocation;
+		lgl__glReal_glGetFragDataLocation = glad_glGetFragDataLocation;
+		if (glad_glGetFragDataLocation) glad_glGetFragDataLocation = lgl__glTrace_glGetFragDataLocation;
+		lgl__glReal_glUniform1ui = glad_glUniform1ui;
+		if (glad_glUniform1ui) glad_glUniform1ui = lgl__glTrace_glUniform1ui;
+		lgl__glReal_glUniform2ui = glad_glUniform2ui;
+		if (glad_glUniform2ui) glad_glUniform2ui = lgl__glTrace_glUniform2ui;
+		lgl__glReal_glUniform3ui = glad_glUniform3ui;
+		if (glad_glUniform3ui) glad_glUniform3ui = lgl__glTrace_glUniform3ui;
+		lgl__glReal_glUniform4ui = glad_glUniform4ui;
+		if (glad_glUniform4ui) glad_glUniform4ui = lgl__glTrace_glUniform4ui;
+		lgl__glReal_glUniform1uiv = glad_glUniform1uiv;
+		if (glad_glUniform1uiv) glad_glUniform1uiv = lgl__glTrace_glUniform1uiv;
+		lgl__glReal_glUniform2uiv = glad_glUniform2uiv;
+		if (glad_glUniform2uiv) glad_glUniform2uiv = lgl__glTrace_glUniform2uiv;
+		lgl__glReal_glUniform3uiv = glad_glUniform3uiv;
+		if (glad_glUniform3uiv) glad_glUniform3uiv = lgl__glTrace_glUniform3uiv;
+		lgl__glReal_glUniform4uiv = glad_glUniform4uiv;
+		if (glad_glUniform4uiv) glad_glUniform4uiv = lgl__glTrace_glUniform4uiv;
+		lgl__glReal_glTexParameterIiv = glad_glTexParameterIiv;
+		if (glad_glTexParameterIiv) glad_glTexParameterIiv = lgl__glTrace_glTexParameterIiv;
+		lgl__glReal_glTexParameterIuiv = glad_glTexParameterIuiv;
+		if (glad_glTexParameterIuiv) glad_glTexParameterIuiv = lgl__glTrace_glTexParameterIuiv;
+		lgl__glReal_glGetTexParameterIiv = glad_glGetTexParameterIiv;
+		if (glad_glGetTexParameterIiv) glad_glGetTexParameterIiv = lgl__glTrace_glGetTexParameterIiv;
+		lgl__glReal_glGetTexParameterIuiv = glad_glGetTexParameterIuiv;
+		if (glad_glGetTexParameterIuiv) glad_glGetTexParameterIuiv = lgl__glTrace_glGetTexParameterIuiv;
+		lgl__glReal_glClearBufferiv = glad_glClearBufferiv;
+		if (glad_glClearBufferiv) glad_glClearBufferiv = lgl__glTrace_glClearBufferiv;
+		lgl__glReal_glClearBufferuiv = glad_glClearBufferuiv;
+		if (glad_glClearBufferuiv) glad_glClearBufferuiv = lgl__glTrace_glClearBufferuiv;
+		lgl__glReal_glClearBufferfv = glad_glClearBufferfv;
+		if (glad_glClearBufferfv) glad_glClearBufferfv = lgl__glTrace_glClearBufferfv;
+		lgl__glReal_glClearBufferfi = glad_glClearBufferfi;
+		if (glad_glClearBufferfi) glad_glClearBufferfi = lgl__glTrace_glClearBufferfi;
+		lgl__glReal_glGetStringi = glad_glGetStringi;
+		if (glad_glGetStringi) glad_glGetStringi = lgl__glTrace_glGetStringi;
+		lgl__glReal_glIsRenderbuffer = glad_glIsRenderbuffer;
+		if (glad_glIsRenderbuffer) glad_glIsRenderbuffer = lgl__glTrace_glIsRenderbuffer;
+		lgl__glReal_glBindRenderbuffer = glad_glBindRenderbuffer;
+		if (glad_glBindRenderbuffer) glad_glBindRenderbuffer = lgl__glTrace_glBindRenderbuffer;
+		lgl__glReal_glDeleteRenderbuffers = glad_glDeleteRenderbuffers;
+		if (glad_glDeleteRenderbuffers) glad_glDeleteRenderbuffers = lgl__glTrace_glDeleteRenderbuffers;
+		lgl__glReal_glGenRenderbuffers = glad_glGenRenderbuffers;
+		if (glad_glGenRenderbuffers) glad_glGenRenderbuffers = lgl__glTrace_glGenRenderbuffers;
+		lgl__glReal_glRenderbufferStorage = glad_glRenderbufferStorage;
+		if (glad_glRenderbufferStorage) glad_glRenderbufferStorage = lgl__glTrace_glRenderbufferStorage;
+		lgl__glReal_glGetRenderbufferParameteriv = glad_glGetRenderbufferParameteriv;
+		if (glad_glGetRenderbufferParameteriv) glad_glGetRenderbufferParameteriv = lgl__glTrace_glGetRenderbufferParameteriv;
+		lgl__glReal_glIsFramebuffer = glad_glIsFramebuffer;
+		if (glad_glIsFramebuffer) glad_glIsFramebuffer = lgl__glTrace_glIsFramebuffer;
+		lgl__glReal_glBindFramebuffer = glad_glBindFramebuffer;
+		if (glad_glBindFramebuffer) glad_glBindFramebuffer = lgl__glTrace_glBindFramebuffer;
+		lgl__glReal_glDeleteFramebuffers = glad_glDeleteFramebuffers;
+		if (glad_glDeleteFramebuffers) glad_glDeleteFramebuffers = lgl__glTrace_glDeleteFramebuffers;
+		lgl__glReal_glGenFramebuffers = glad_glGenFramebuffers;
+		if (glad_glGenFramebuffers) glad_glGenFramebuffers = lgl__glTrace_glGenFramebuffers;
+		lgl__glReal_glCheckFramebufferStatus = glad_glCheckFramebufferStatus;
+		if (glad_glCheckFramebufferStatus) glad_glCheckFramebufferStatus = lgl__glTrace_glCheckFramebufferStatus;
+		lgl__glReal_glFramebufferTexture1D = glad_glFramebufferTexture1D;
+		if (glad_glFramebufferTexture1D) glad_glFramebufferTexture1D = lgl__glTrace_glFramebufferTexture1D;
+		lgl__glReal_glFramebufferTexture2D = glad_glFramebufferTexture2D;
+		if (glad_glFramebufferTexture2D) glad_glFramebufferTexture2D = lgl__glTrace_glFramebufferTexture2D;
+		lgl__glReal_glFramebufferTexture3D = glad_glFramebufferTexture3D;
+		if (glad_glFramebufferTexture3D) glad_glFramebufferTexture3D = lgl__glTrace_glFramebufferTexture3D;
+		lgl__glReal_glFramebufferRenderbuffer = glad_glFramebufferRenderbuffer;
+		if (glad_glFramebufferRenderbuffer) glad_glFramebufferRenderbuffer = lgl__glTrace_glFramebufferRenderbuffer;
+		lgl__glReal_glGetFramebufferAttachmentParameteriv = glad_glGetFramebufferAttachmentParameteriv;
+		if (glad_glGetFramebufferAttachmentParameteriv) glad_glGetFramebufferAttachmentParameteriv = lgl__glTrace_glGetFramebufferAttachmentParameteriv;
+		lgl__glReal_glGenerateMipmap = glad_glGenerateMipmap;
+		if (glad_glGenerateMipmap) glad_glGenerateMipmap = lgl__glTrace_glGenerateMipmap;
+		lgl__glReal_glBlitFramebuffer = glad_glBlitFramebuffer;
+		if (glad_glBlitFramebuffer) glad_glBlitFramebuffer = lgl__glTrace_glBlitFramebuffer;
+		lgl__glReal_glRenderbufferStorageMultisample = glad_glRenderbufferStorageMultisample;
+		if (glad_glRenderbufferStorageMultisample) glad_glRenderbufferStorageMultisample = lgl__glTrace_glRenderbufferStorageMultisample;
+		lgl__glReal_glFramebufferTextureLayer = glad_glFramebufferTextureLayer;
+		if (glad_glFramebufferTextureLayer) glad_glFramebufferTextureLayer = lgl__glTrace_glFramebufferTextureLayer;
+		lgl__glReal_glMapBufferRange = glad_glMapBufferRange;
+		if (glad_glMapBufferRange) glad_glMapBufferRange = lgl__glTrace_glMapBufferRange;
+		lgl__glReal_glFlushMappedBufferRange = glad_glFlushMappedBufferRange;
+		if (glad_glFlushMappedBufferRange) glad_glFlushMappedBufferRange = lgl__glTrace_glFlushMappedBufferRange;
+		lgl__glReal_glBindVertexArray = glad_glBindVertexArray;
+		if (glad_glBindVertexArray) glad_glBindVertexArray = lgl__glTrace_glBindVertexArray;
+		lgl__glReal_glDeleteVertexArrays = glad_glDeleteVertexArrays;
+		if (glad_glDeleteVertexArrays) glad_glDeleteVertexArrays = lgl__glTrace_glDeleteVertexArrays;
+		lgl__glReal_glGenVertexArrays = glad_glGenVertexArrays;
+		if (glad_glGenVertexArrays) glad_glGenVertexArrays = lgl__glTrace_glGenVertexArrays;
+		lgl__glReal_glIsVertexArray = glad_glIsVertexArray;
+		if (glad_glIsVertexArray) glad_glIsVertexArray = lgl__glTrace_glIsVertexArray;
+		lgl__glReal_glDrawArraysInstanced = glad_glDrawArraysInstanced;
+		if (glad_glDrawArraysInstanced) glad_glDrawArraysInstanced = lgl__glTrace_glDrawArraysInstanced;
+		lgl__glReal_glDrawElementsInstanced = glad_glDrawElementsInstanced;
+		if (glad_glDrawElementsInstanced) glad_glDrawElementsInstanced = lgl__glTrace_glDrawElementsInstanced;
+		lgl__glReal_glTexBuffer = glad_glTexBuffer;
+		if (glad_glTexBuffer) glad_glTexBuffer = lgl__glTrace_glTexBuffer;
+		lgl__glReal_glPrimitiveRestartIndex = glad_glPrimitiveRestartIndex;
+		if (glad_glPrimitiveRestartIndex) glad_glPrimitiveRestartIndex = lgl__glTrace_glPrimitiveRestartIndex;
+		lgl__glReal_glCopyBufferSubData = glad_glCopyBufferSubData;
+		if (glad_glCopyBufferSubData) glad_glCopyBufferSubData = lgl__glTrace_glCopyBufferSubData;
+		lgl__glReal_glGetUniformIndices = glad_glGetUniformIndices;
+		if (glad_glGetUniformIndices) glad_glGetUniformIndices = lgl__glTrace_glGetUniformIndices;
+		lgl__glReal_glGetActiveUniformsiv = glad_glGetActiveUniformsiv;
+		if (glad_glGetActiveUniformsiv) glad_glGetActiveUniformsiv = lgl__glTrace_glGetActiveUniformsiv;
+		lgl__glReal_glGetActiveUniformName = glad_glGetActiveUniformName;
+		if (glad_glGetActiveUniformName) glad_glGetActiveUniformName = lgl__glTrace_glGetActiveUniformName;
+		lgl__glReal_glGetUniformBlockIndex = glad_glGetUniformBlockIndex;
+		if (glad_glGetUniformBlockIndex) glad_glGetUniformBlockIndex = lgl__glTrace_glGetUniformBlockIndex;
+		lgl__glReal_glGetActiveUniformBlockiv = glad_glGetActiveUniformBlockiv;
+		if (glad_glGetActiveUniformBlockiv) glad_glGetActiveUniformBlockiv = lgl__glTrace_glGetActiveUniformBlockiv;
+		lgl__glReal_glGetActiveUniformBlockName = glad_glGetActiveUniformBlockName;
+		if (glad_glGetActiveUniformBlockName) glad_glGetActiveUniformBlockName = lgl__glTrace_glGetActiveUniformBlockName;
+		lgl__glReal_glUniformBlockBinding = glad_glUniformBlockBinding;
+		if (glad_glUniformBlockBinding) glad_glUniformBlockBinding = lgl__glTrace_glUniformBlockBinding;
+		lgl__glReal_glDrawElementsBaseVertex = glad_glDrawElementsBaseVertex;
+		if (glad_glDrawElementsBaseVertex) glad_glDrawElementsBaseVertex = lgl__glTrace_glDrawElementsBaseVertex;
+		lgl__glReal_glDrawRangeElementsBaseVertex = glad_glDrawRangeElementsBaseVertex;
+		if (glad_glDrawRangeElementsBaseVertex) glad_glDrawRangeElementsBaseVertex = lgl__glTrace_glDrawRangeElementsBaseVertex;
+		lgl__glReal_glDrawElementsInstancedBaseVertex = glad_glDrawElementsInstancedBaseVertex;
+		if (glad_glDrawElementsInstancedBaseVertex) glad_glDrawElementsInstancedBaseVertex = lgl__glTrace_glDrawElementsInstancedBaseVertex;
+		lgl__glReal_glMultiDrawElementsBaseVertex = glad_glMultiDrawElementsBaseVertex;
+		if (glad_glMultiDrawElementsBaseVertex) glad_glMultiDrawElementsBaseVertex = lgl__glTrace_glMultiDrawElementsBaseVertex;
+		lgl__glReal_glProvokingVertex = glad_glProvokingVertex;
+		if (glad_glProvokingVertex) glad_glProvokingVertex = lgl__glTrace_glProvokingVertex;
+		lgl__glReal_glFenceSync = glad_glFenceSync;
+		if (glad_glFenceSync) glad_glFenceSync = lgl__glTrace_glFenceSync;
+		lgl__glReal_glIsSync = glad_glIsSync;
+		if (glad_glIsSync) glad_glIsSync = lgl__glTrace_glIsSync;
+		lgl__glReal_glDeleteSync = glad_glDeleteSync;
+		if (glad_glDeleteSync) glad_glDeleteSync = lgl__glTrace_glDeleteSync;
+		lgl__glReal_glClientWaitSync = glad_glClientWaitSync;
+		if (glad_glClientWaitSync) glad_glClientWaitSync = lgl__glTrace_glClientWaitSync;
+		lgl__glReal_glWaitSync = glad_glWaitSync;
+		if (glad_glWaitSync) glad_glWaitSync = lgl__glTrace_glWaitSync;
+		lgl__glReal_glGetInteger64v = glad_glGetInteger64v;
+		if (glad_glGetInteger64v) glad_glGetInteger64v = lgl__glTrace_glGetInteger64v;
+		lgl__glReal_glGetSynciv = glad_glGetSynciv;
+		if (glad_glGetSynciv) glad_glGetSynciv = lgl__glTrace_glGetSynciv;
+		lgl__glReal_glGetInteger64i_v = glad_glGetInteger64i_v;
+		if (glad_glGetInteger64i_v) glad_glGetInteger64i_v = lgl__glTrace_glGetInteger64i_v;
+		lgl__glReal_glGetBufferParameteri64v = glad_glGetBufferParameteri64v;
+		if (glad_glGetBufferParameteri64v) glad_glGetBufferParameteri64v = lgl__glTrace_glGetBufferParameteri64v;
+		lgl__glReal_glFramebufferTexture = glad_glFramebufferTexture;
+		if (glad_glFramebufferTexture) glad_glFramebufferTexture = lgl__glTrace_glFramebufferTexture;
+		lgl__glReal_glTexImage2DMultisample = glad_glTexImage2DMultisample;
+		if (glad_glTexImage2DMultisample) glad_glTexImage2DMultisample = lgl__glTrace_glTexImage2DMultisample;
+		lgl__glReal_glTexImage3DMultisample = glad_glTexImage3DMultisample;
+		if (glad_glTexImage3DMultisample) glad_glTexImage3DMultisample = lgl__glTrace_glTexImage3DMultisample;
+		lgl__glReal_glGetMultisamplefv = glad_glGetMultisamplefv;
+		if (glad_glGetMultisamplefv) glad_glGetMultisamplefv = lgl__glTrace_glGetMultisamplefv;
+		lgl__glReal_glSampleMaski = glad_glSampleMaski;
+		if (glad_glSampleMaski) glad_glSampleMaski = lgl__glTrace_glSampleMaski;
+		lgl__glReal_glBindFragDataLocationIndexed = glad_glBindFragDataLocationIndexed;
+		if (glad_glBindFragDataLocationIndexed) glad_glBindFragDataLocationIndexed = lgl__glTrace_glBindFragDataLocationIndexed;
+		lgl__glReal_glGetFragDataIndex = glad_glGetFragDataIndex;
+		if (glad_glGetFragDataIndex) glad_glGetFragDataIndex = lgl__glTrace_glGetFragDataIndex;
+		lgl__glReal_glGenSamplers = glad_glGenSamplers;
+		if (glad_glGenSamplers) glad_glGenSamplers = lgl__glTrace_glGenSamplers;
+		lgl__glReal_glDeleteSamplers = glad_glDeleteSamplers;
+		if (glad_glDeleteSamplers) glad_glDeleteSamplers = lgl__glTrace_glDeleteSamplers;
+		lgl__glReal_glIsSampler = glad_glIsSampler;
+		if (glad_glIsSampler) glad_glIsSampler = lgl__glTrace_glIsSampler;
+		lgl__glReal_glBindSampler = glad_glBindSampler;
+		if (glad_glBindSampler) glad_glBindSampler = lgl__glTrace_glBindSampler;
+		lgl__glReal_glSamplerParameteri = glad_glSamplerParameteri;
+		if (glad_glSamplerParameteri) glad_glSamplerParameteri = lgl__glTrace_glSamplerParameteri;
+		lgl__glReal_glSamplerParameteriv = glad_glSamplerParameteriv;
+		if (glad_glSamplerParameteriv) glad_glSamplerParameteriv = lgl__glTrace_glSamplerParameteriv;
+		lgl__glReal_glSamplerParameterf = glad_glSamplerParameterf;
+		if (glad_glSamplerParameterf) glad_glSamplerParameterf = lgl__glTrace_glSamplerParameterf;
+		lgl__glReal_glSamplerParameterfv = glad_glSamplerParameterfv;
+		if (glad_glSamplerParameterfv) glad_glSamplerParameterfv = lgl__glTrace_glSamplerParameterfv;
+		lgl__glReal_glSamplerParameterIiv = glad_glSamplerParameterIiv;
+		if (glad_glSamplerParameterIiv) glad_glSamplerParameterIiv = lgl__glTrace_glSamplerParameterIiv;
+		lgl__glReal_glSamplerParameterIuiv = glad_glSamplerParameterIuiv;
+		if (glad_glSamplerParameterIuiv) glad_glSamplerParameterIuiv = lgl__glTrace_glSamplerParameterIuiv;
+		lgl__glReal_glGetSamplerParameteriv = glad_glGetSamplerParameteriv;
+		if (glad_glGetSamplerParameteriv) glad_glGetSamplerParameteriv = lgl__glTrace_glGetSamplerParameteriv;
+		lgl__glReal_glGetSamplerParameterIiv = glad_glGetSamplerParameterIiv;
+		if (glad_glGetSamplerParameterIiv) glad_glGetSamplerParameterIiv = lgl__glTrace_glGetSamplerParameterIiv;
+		lgl__glReal_glGetSamplerParameterfv = glad_glGetSamplerParameterfv;
+		if (glad_glGetSamplerParameterfv) glad_glGetSamplerParameterfv = lgl__glTrace_glGetSamplerParameterfv;
+		lgl__glReal_glGetSamplerParameterIuiv = glad_glGetSamplerParameterIuiv;
+		if (glad_glGetSamplerParameterIuiv) glad_glGetSamplerParameterIuiv = lgl__glTrace_glGetSamplerParameterIuiv;
+		lgl__glReal_glQueryCounter = glad_glQueryCounter;
+		if (glad_glQueryCounter) glad_glQueryCounter = lgl__glTrace_glQueryCounter;
+		lgl__glReal_glGetQueryObjecti64v = glad_glGetQueryObjecti64v;
+		if (glad_glGetQueryObjecti64v) glad_glGetQueryObjecti64v = lgl__glTrace_glGetQueryObjecti64v;
+		lgl__glReal_glGetQueryObjectui64v = glad_glGetQueryObjectui64v;
+		if (glad_glGetQueryObjectui64v) glad_glGetQueryObjectui64v = lgl__glTrace_glGetQueryObjectui64v;
+		lgl__glReal_glVertexAttribDivisor = glad_glVertexAttribDivisor;
+		if (glad_glVertexAttribDivisor) glad_glVertexAttribDivisor = lgl__glTrace_glVertexAttribDivisor;
+		lgl__glReal_glVertexAttribP1ui = glad_glVertexAttribP1ui;
+		if (glad_glVertexAttribP1ui) glad_glVertexAttribP1ui = lgl__glTrace_glVertexAttribP1ui;
+		lgl__glReal_glVertexAttribP1uiv = glad_glVertexAttribP1uiv;
+		if (glad_glVertexAttribP1uiv) glad_glVertexAttribP1uiv = lgl__glTrace_glVertexAttribP1uiv;
+		lgl__glReal_glVertexAttribP2ui = glad_glVertexAttribP2ui;
+		if (glad_glVertexAttribP2ui) glad_glVertexAttribP2ui = lgl__glTrace_glVertexAttribP2ui;
+		lgl__glReal_glVertexAttribP2uiv = glad_glVertexAttribP2uiv;
+		if (glad_glVertexAttribP2uiv) glad_glVertexAttribP2uiv = lgl__glTrace_glVertexAttribP2uiv;
+		lgl__glReal_glVertexAttribP3ui = glad_glVertexAttribP3ui;
+		if (glad_glVertexAttribP3ui) glad_glVertexAttribP3ui = lgl__glTrace_glVertexAttribP3ui;
+		lgl__glReal_glVertexAttribP3uiv = glad_glVertexAttribP3uiv;
+		if (glad_glVertexAttribP3uiv) glad_glVertexAttribP3uiv = lgl__glTrace_glVertexAttribP3uiv;
+		lgl__glReal_glVertexAttribP4ui = glad_glVertexAttribP4ui;
+		if (glad_glVertexAttribP4ui) glad_glVertexAttribP4ui = lgl__glTrace_glVertexAttribP4ui;
+		lgl__glReal_glVertexAttribP4uiv = glad_glVertexAttribP4uiv;
+		if (glad_glVertexAttribP4uiv) glad_glVertexAttribP4uiv = lgl__glTrace_glVertexAttribP4uiv;
+		lgl__glReal_glVertexP2ui = glad_glVertexP2ui;
+		if (glad_glVertexP2ui) glad_glVertexP2ui = lgl__glTrace_glVertexP2ui;
+		lgl__glReal_glVertexP2uiv = glad_glVertexP2uiv;
+		if (glad_glVertexP2uiv) glad_glVertexP2uiv = lgl__glTrace_glVertexP2uiv;
+		lgl__glReal_glVertexP3ui = glad_glVertexP3ui;
+		if (glad_glVertexP3ui) glad_glVertexP3ui = lgl__glTrace_glVertexP3ui;
+		lgl__glReal_glVertexP3uiv = glad_glVertexP3uiv;
+		if (glad_glVertexP3uiv) glad_glVertexP3uiv = lgl__glTrace_glVertexP3uiv;
+		lgl__glReal_glVertexP4ui = glad_glVertexP4ui;
+		if (glad_glVertexP4ui) glad_glVertexP4ui = lgl__glTrace_glVertexP4ui;
+		lgl__glReal_glVertexP4uiv = glad_glVertexP4uiv;
+		if (glad_glVertexP4uiv) glad_glVertexP4uiv = lgl__glTrace_glVertexP4uiv;
+		lgl__glReal_glTexCoordP1ui = glad_glTexCoordP1ui;
+		if (glad_glTexCoordP1ui) glad_glTexCoordP1ui = lgl__glTrace_glTexCoordP1ui;
+		lgl__glReal_glTexCoordP1uiv = glad_glTexCoordP1uiv;
+		if (glad_glTexCoordP1uiv) glad_glTexCoordP1uiv = lgl__glTrace_glTexCoordP1uiv;
+		lgl__glReal_glTexCoordP2ui = glad_glTexCoordP2ui;
+		if (glad_glTexCoordP2ui) glad_glTexCoordP2ui = lgl__glTrace_glTexCoordP2ui;
+		lgl__glReal_glTexCoordP2uiv = glad_glTexCoordP2uiv;
+		if (glad_glTexCoordP2uiv) glad_glTexCoordP2uiv = lgl__glTrace_glTexCoordP2uiv;
+		lgl__glReal_glTexCoordP3ui = glad_glTexCoordP3ui;
+		if (glad_glTexCoordP3ui) glad_glTexCoordP3ui = lgl__glTrace_glTexCoordP3ui;
+		lgl__glReal_glTexCoordP3uiv = glad_glTexCoordP3uiv;
+		if (glad_glTexCoordP3uiv) glad_glTexCoordP3uiv = lgl__glTrace_glTexCoordP3uiv;
+		lgl__glReal_glTexCoordP4ui = glad_glTexCoordP4ui;
+		if (glad_glTexCoordP4ui) glad_glTexCoordP4ui = lgl__glTrace_glTexCoordP4ui;
+		lgl__glReal_glTexCoordP4uiv = glad_glTexCoordP4uiv;
+		if (glad_glTexCoordP4uiv) glad_glTexCoordP4uiv = lgl__glTrace_glTexCoordP4uiv;
+		lgl__glReal_glMultiTexCoordP1ui = glad_glMultiTexCoordP1ui;
+		if (glad_glMultiTexCoordP1ui) glad_glMultiTexCoordP1ui = lgl__glTrace_glMultiTexCoordP1ui;
+		lgl__glReal_glMultiTexCoordP1uiv = glad_glMultiTexCoordP1uiv;
+		if (glad_glMultiTexCoordP1uiv) glad_glMultiTexCoordP1uiv = lgl__glTrace_glMultiTexCoordP1uiv;
+		lgl__glReal_glMultiTexCoordP2ui = glad_glMultiTexCoordP2ui;
+		if (glad_glMultiTexCoordP2ui) glad_glMultiTexCoordP2ui = lgl__glTrace_glMultiTexCoordP2ui;
+		lgl__glReal_glMultiTexCoordP2uiv = glad_glMultiTexCoordP2uiv;
+		if (glad_glMultiTexCoordP2uiv) glad_glMultiTexCoordP2uiv = lgl__glTrace_glMultiTexCoordP2uiv;
+		lgl__glReal_glMultiTexCoordP3ui = glad_glMultiTexCoordP3ui;
+		if (glad_glMultiTexCoordP3ui) glad_glMultiTexCoordP3ui = lgl__glTrace_glMultiTexCoordP3ui;
+		lgl__glReal_glMultiTexCoordP3uiv = glad_glMultiTexCoordP3uiv;
+		if (glad_glMultiTexCoordP3uiv) glad_glMultiTexCoordP3uiv = lgl__glTrace_glMultiTexCoordP3uiv;
+		lgl__glReal_glMultiTexCoordP4ui = glad_glMultiTexCoordP4ui;
+		if (glad_glMultiTexCoordP4ui) glad_glMultiTexCoordP4ui = lgl__glTrace_glMultiTexCoordP4ui;
+		lgl__glReal_glMultiTexCoordP4uiv = glad_glMultiTexCoordP4uiv;
+		if (glad_glMultiTexCoordP4uiv) glad_glMultiTexCoordP4uiv = lgl__glTrace_glMultiTexCoordP4uiv;
+		lgl__glReal_glNormalP3ui = glad_glNormalP3ui;
+		if (glad_glNormalP3ui) glad_glNormalP3ui = lgl__glTrace_glNormalP3ui;
+		lgl__glReal_glNormalP3uiv = glad_glNormalP3uiv;
+		if (glad_glNormalP3uiv) glad_glNormalP3uiv = lgl__glTrace_glNormalP3uiv;
+		lgl__glReal_glColorP3ui = glad_glColorP3ui;
+		if (glad_glColorP3ui) glad_glColorP3ui = lgl__glTrace_glColorP3ui;
+		lgl__glReal_glColorP3uiv = glad_glColorP3uiv;
+		if (glad_glColorP3uiv) glad_glColorP3uiv = lgl__glTrace_glColorP3uiv;
+		lgl__glReal_glColorP4ui = glad_glColorP4ui;
+		if (glad_glColorP4ui) glad_glColorP4ui = lgl__glTrace_glColorP4ui;
+		lgl__glReal_glColorP4uiv = glad_glColorP4uiv;
+		if (glad_glColorP4uiv) glad_glColorP4uiv = lgl__glTrace_glColorP4uiv;
+		lgl__glReal_glSecondaryColorP3ui = glad_glSecondaryColorP3ui;
+		if (glad_glSecondaryColorP3ui) glad_glSecondaryColorP3ui = lgl__glTrace_glSecondaryColorP3ui;
+		lgl__glReal_glSecondaryColorP3uiv = glad_glSecondaryColorP3uiv;
+		if (glad_glSecondaryColorP3uiv) glad_glSecondaryColorP3uiv = lgl__glTrace_glSecondaryColorP3uiv;
+		lgl__glReal_glMinSampleShading = glad_glMinSampleShading;
+		if (glad_glMinSampleShading) glad_glMinSampleShading = lgl__glTrace_glMinSampleShading;
+		lgl__glReal_glBlendEquationi = glad_glBlendEquationi;
+		if (glad_glBlendEquationi) glad_glBlendEquationi = lgl__glTrace_glBlendEquationi;
+		lgl__glReal_glBlendEquationSeparatei = glad_glBlendEquationSeparatei;
+		if (glad_glBlendEquationSeparatei) glad_glBlendEquationSeparatei = lgl__glTrace_glBlendEquationSeparatei;
+		lgl__glReal_glBlendFunci = glad_glBlendFunci;
+		if (glad_glBlendFunci) glad_glBlendFunci = lgl__glTrace_glBlendFunci;
+		lgl__glReal_glBlendFuncSeparatei = glad_glBlendFuncSeparatei;
+		if (glad_glBlendFuncSeparatei) glad_glBlendFuncSeparatei = lgl__glTrace_glBlendFuncSeparatei;
+		lgl__glReal_glDrawArraysIndirect = glad_glDrawArraysIndirect;
+		if (glad_glDrawArraysIndirect) glad_glDrawArraysIndirect = lgl__glTrace_glDrawArraysIndirect;
+		lgl__glReal_glDrawElementsIndirect = glad_glDrawElementsIndirect;
+		if (glad_glDrawElementsIndirect) glad_glDrawElementsIndirect = lgl__glTrace_glDrawElementsIndirect;
+		lgl__glReal_glUniform1d = glad_glUniform1d;
+		if (glad_glUniform1d) glad_glUniform1d = lgl__glTrace_glUniform1d;
+		lgl__glReal_glUniform2d = glad_glUniform2d;
+		if (glad_glUniform2d) glad_glUniform2d = lgl__glTrace_glUniform2d;
+		lgl__glReal_glUniform3d = glad_glUniform3d;
+		if (glad_glUniform3d) glad_glUniform3d = lgl__glTrace_glUniform3d;
+		lgl__glReal_glUniform4d = glad_glUniform4d;
+		if (glad_glUniform4d) glad_glUniform4d = lgl__glTrace_glUniform4d;
+		lgl__glReal_glUniform1dv = glad_glUniform1dv;
+		if (glad_glUniform1dv) glad_glUniform1dv = lgl__glTrace_glUniform1dv;
+		lgl__glReal_glUniform2dv = glad_glUniform2dv;
+		if (glad_glUniform2dv) glad_glUniform2dv = lgl__glTrace_glUniform2dv;
+		lgl__glReal_glUniform3dv = glad_glUniform3dv;
+		if (glad_glUniform3dv) glad_glUniform3dv = lgl__glTrace_glUniform3dv;
+		lgl__glReal_glUniform4dv = glad_glUniform4dv;
+		if (glad_glUniform4dv) glad_glUniform4dv = lgl__glTrace_glUniform4dv;
+		lgl__glReal_glUniformMatrix2dv = glad_glUniformMatrix2dv;
+		if (glad_glUniformMatrix2dv) glad_glUniformMatrix2dv = lgl__glTrace_glUniformMatrix2dv;
+		lgl__glReal_glUniformMatrix3dv = glad_glUniformMatrix3dv;
+		if (glad_glUniformMatrix3dv) glad_glUniformMatrix3dv = lgl__glTrace_glUniformMatrix3dv;
+		lgl__glReal_glUniformMatrix4dv = glad_glUniformMatrix4dv;
+		if (glad_glUniformMatrix4dv) glad_glUniformMatrix4dv = lgl__glTrace_glUniformMatrix4dv;
+		lgl__glReal_glUniformMatrix2x3dv = glad_glUniformMatrix2x3dv;
+		if (glad_glUniformMatrix2x3dv) glad_glUniformMatrix2x3dv = lgl__glTrace_glUniformMatrix2x3dv;
+		lgl__glReal_glUniformMatrix2x4dv = glad_glUniformMatrix2x4dv;
+		if (glad_glUniformMatrix2x4dv) glad_glUniformMatrix2x4dv = lgl__glTrace_glUniformMatrix2x4dv;
+		lgl__glReal_glUniformMatrix3x2dv = glad_glUniformMatrix3x2dv;
+		if (glad_glUniformMatrix3x2dv) glad_glUniformMatrix3x2dv = lgl__glTrace_glUniformMatrix3x2dv;
+		lgl__glReal_glUniformMatrix3x4dv = glad_glUniformMatrix3x4dv;
+		if (glad_glUniformMatrix3x4dv) glad_glUniformMatrix3x4dv = lgl__glTrace_glUniformMatrix3x4dv;
+		lgl__glReal_glUniformMatrix4x2dv = glad_glUniformMatrix4x2dv;
+		if (glad_glUniformMatrix4x2dv) glad_glUniformMatrix4x2dv = lgl__glTrace_glUniformMatrix4x2dv;
+		lgl__glReal_glUniformMatrix4x3dv = glad_glUniformMatrix4x3dv;
+		if (glad_glUniformMatrix4x3dv) glad_glUniformMatrix4x3dv = lgl__glTrace_glUniformMatrix4x3dv;
+		lgl__glReal_glGetUniformdv = glad_glGetUniformdv;
+		if (glad_glGetUniformdv) glad_glGetUniformdv = lgl__glTrace_glGetUniformdv;
+		lgl__glReal_glGetSubroutineUniformLocation = glad_glGetSubroutineUniformLocation;
+		if (glad_glGetSubroutineUniformLocation) glad_glGetSubroutineUniformLocation = lgl__glTrace_glGetSubroutineUniformLocation;
+		lgl__glReal_glGetSubroutineIndex = glad_glGetSubroutineIndex;
+		if (glad_glGetSubroutineIndex) glad_glGetSubroutineIndex = lgl__glTrace_glGetSubroutineIndex;
+		lgl__glReal_glGetActiveSubroutineUniformiv = glad_glGetActiveSubroutineUniformiv;
+		if (glad_glGetActiveSubroutineUniformiv) glad_glGetActiveSubroutineUniformiv = lgl__glTrace_glGetActiveSubroutineUniformiv;
+		lgl__glReal_glGetActiveSubroutineUniformName = glad_glGetActiveSubroutineUniformName;
+		if (glad_glGetActiveSubroutineUniformName) glad_glGetActiveSubroutineUniformName = lgl__glTrace_glGetActiveSubroutineUniformName;
+		lgl__glReal_glGetActiveSubroutineName = glad_glGetActiveSubroutineName;
+		if (glad_glGetActiveSubroutineName) glad_glGetActiveSubroutineName = lgl__glTrace_glGetActiveSubroutineName;
+		lgl__glReal_glUniformSubroutinesuiv = glad_glUniformSubroutinesuiv;
+		if (glad_glUniformSubroutinesuiv) glad_glUniformSubroutinesuiv = lgl__glTrace_glUniformSubroutinesuiv;
+		lgl__glReal_glGetUniformSubroutineuiv = glad_glGetUniformSubroutineuiv;
+		if (glad_glGetUniformSubroutineuiv) glad_glGetUniformSubroutineuiv = lgl__glTrace_glGetUniformSubroutineuiv;
+		lgl__glReal_glGetProgramStageiv = glad_glGetProgramStageiv;
+		if (glad_glGetProgramStageiv) glad_glGetProgramStageiv = lgl__glTrace_glGetProgramStageiv;
+		lgl__glReal_glPatchParameteri = glad_glPatchParameteri;
+		if (glad_glPatchParameteri) glad_glPatchParameteri = lgl__glTrace_glPatchParameteri;
+		lgl__glReal_glPatchParameterfv = glad_glPatchParameterfv;
+		if (glad_glPatchParameterfv) glad_glPatchParameterfv = lgl__glTrace_glPatchParameterfv;
+		lgl__glReal_glBindTransformFeedback = glad_glBindTransformFeedback;
+		if (glad_glBindTransformFeedback) glad_glBindTransformFeedback = lgl__glTrace_glBindTransformFeedback;
+		lgl__glReal_glDeleteTransformFeedbacks = glad_glDeleteTransformFeedbacks;
+		if (glad_glDeleteTransformFeedbacks) glad_glDeleteTransformFeedbacks = lgl__glTrace_glDeleteTransformFeedbacks;
+		lgl__glReal_glGenTransformFeedbacks = glad_glGenTransformFeedbacks;
+		if (glad_glGenTransformFeedbacks) glad_glGenTransformFeedbacks = lgl__glTrace_glGenTransformFeedbacks;
+		lgl__glReal_glIsTransformFeedback = glad_glIsTransformFeedback;
+		if (glad_glIsTransformFeedback) glad_glIsTransformFeedback = lgl__glTrace_glIsTransformFeedback;
+		lgl__glReal_glPauseTransformFeedback = glad_glPauseTransformFeedback;
+		if (glad_glPauseTransformFeedback) glad_glPauseTransformFeedback = lgl__glTrace_glPauseTransformFeedback;
+		lgl__glReal_glResumeTransformFeedback = glad_glResumeTransformFeedback;
+		if (glad_glResumeTransformFeedback) glad_glResumeTransformFeedback = lgl__glTrace_glResumeTransformFeedback;
+		lgl__glReal_glDrawTransformFeedback = glad_glDrawTransformFeedback;
+		if (glad_glDrawTransformFeedback) glad_glDrawTransformFeedback = lgl__glTrace_glDrawTransformFeedback;
+		lgl__glReal_glDrawTransformFeedbackStream = glad_glDrawTransformFeedbackStream;
+		if (glad_glDrawTransformFeedbackStream) glad_glDrawTransformFeedbackStream = lgl__glTrace_glDrawTransformFeedbackStream;
+		lgl__glReal_glBeginQueryIndexed = glad_glBeginQueryIndexed;
+		if (glad_glBeginQueryIndexed) glad_glBeginQueryIndexed = lgl__glTrace_glBeginQueryIndexed;
+		lgl__glReal_glEndQueryIndexed = glad_glEndQueryIndexed;
+		if (glad_glEndQueryIndexed) glad_glEndQueryIndexed = lgl__glTrace_glEndQueryIndexed;
+		lgl__glReal_glGetQueryIndexediv = glad_glGetQueryIndexediv;
+		if (glad_glGetQueryIndexediv) glad_glGetQueryIndexediv = lgl__glTrace_glGetQueryIndexediv;
+		lgl__glReal_glReleaseShaderCompiler = glad_glReleaseShaderCompiler;
+		if (glad_glReleaseShaderCompiler) glad_glReleaseShaderCompiler = lgl__glTrace_glReleaseShaderCompiler;
+		lgl__glReal_glShaderBinary = glad_glShaderBinary;
+		if (glad_glShaderBinary) glad_glShaderBinary = lgl__glTrace_glShaderBinary;
+		lgl__glReal_glGetShaderPrecisionFormat = glad_glGetShaderPrecisionFormat;
+		if (glad_glGetShaderPrecisionFormat) glad_glGetShaderPrecisionFormat = lgl__glTrace_glGetShaderPrecisionFormat;
+		lgl__glReal_glDepthRangef = glad_glDepthRangef;
+		if (glad_glDepthRangef) glad_glDepthRangef = lgl__glTrace_glDepthRangef;
+		lgl__glReal_glClearDepthf = glad_glClearDepthf;
+		if (glad_glClearDepthf) glad_glClearDepthf = lgl__glTrace_glClearDepthf;
+		lgl__glReal_glGetProgramBinary = glad_glGetProgramBinary;
+		if (glad_glGetProgramBinary) glad_glGetProgramBinary = lgl__glTrace_glGetProgramBinary;
+		lgl__glReal_glProgramBinary = glad_glProgramBinary;
+		if (glad_glProgramBinary) glad_glProgramBinary = lgl__glTrace_glProgramBinary;
+		lgl__glReal_glProgramParameteri = glad_glProgramParameteri;
+		if (glad_glProgramParameteri) glad_glProgramParameteri = lgl__glTrace_glProgramParameteri;
+		lgl__glReal_glUseProgramStages = glad_glUseProgramStages;
+		if (glad_glUseProgramStages) glad_glUseProgramStages = lgl__glTrace_glUseProgramStages;
+		lgl__glReal_glActiveShaderProgram = glad_glActiveShaderProgram;
+		if (glad_glActiveShaderProgram) glad_glActiveShaderProgram = lgl__glTrace_glActiveShaderProgram;
+		lgl__glReal_glCreateShaderProgramv = glad_glCreateShaderProgramv;
+		if (glad_glCreateShaderProgramv) glad_glCreateShaderProgramv = lgl__glTrace_glCreateShaderProgramv;
+		lgl__glReal_glBindProgramPipeline = glad_glBindProgramPipeline;
+		if (glad_glBindProgramPipeline) glad_glBindProgramPipeline = lgl__glTrace_glBindProgramPipeline;
+		lgl__glReal_glDeleteProgramPipelines = glad_glDeleteProgramPipelines;
+		if (glad_glDeleteProgramPipelines) glad_glDeleteProgramPipelines = lgl__glTrace_glDeleteProgramPipelines;
+		lgl__glReal_glGenProgramPipelines = glad_glGenProgramPipelines;
+		if (glad_glGenProgramPipelines) glad_glGenProgramPipelines = lgl__glTrace_glGenProgramPipelines;
+		lgl__glReal_glIsProgramPipeline = glad_glIsProgramPipeline;
+		if (glad_glIsProgramPipeline) glad_glIsProgramPipeline = lgl__glTrace_glIsProgramPipeline;
+		lgl__glReal_glGetProgramPipelineiv = glad_glGetProgramPipelineiv;
+		if (glad_glGetProgramPipelineiv) glad_glGetProgramPipelineiv = lgl__glTrace_glGetProgramPipelineiv;
+		lgl__glReal_glProgramUniform1i = glad_glProgramUniform1i;
+		if (glad_glProgramUniform1i) glad_glProgramUniform1i = lgl__glTrace_glProgramUniform1i;
+		lgl__glReal_glProgramUniform1iv = glad_glProgramUniform1iv;
+		if (glad_glProgramUniform1iv) glad_glProgramUniform1iv = lgl__glTrace_glProgramUniform1iv;
+		lgl__glReal_glProgramUniform1f = glad_glProgramUniform1f;
+		if (glad_glProgramUniform1f) glad_glProgramUniform1f = lgl__glTrace_glProgramUniform1f;
+		lgl__glReal_glProgramUniform1fv = glad_glProgramUniform1fv;
+		if (glad_glProgramUniform1fv) glad_glProgramUniform1fv = lgl__glTrace_glProgramUniform1fv;
+		lgl__glReal_glProgramUniform1d = glad_glProgramUniform1d;
+		if (glad_glProgramUniform1d) glad_glProgramUniform1d = lgl__glTrace_glProgramUniform1d;
+		lgl__glReal_glProgramUniform1dv = glad_glProgramUniform1dv;
+		if (glad_glProgramUniform1dv) glad_glProgramUniform1dv = lgl__glTrace_glProgramUniform1dv;
+		lgl__glReal_glProgramUniform1ui = glad_glProgramUniform1ui;
+		if (glad_glProgramUniform1ui) glad_glProgramUniform1ui = lgl__glTrace_glProgramUniform1ui;
+		lgl__glReal_glProgramUniform1uiv = glad_glProgramUniform1uiv;
+		if (glad_glProgramUniform1uiv) glad_glProgramUniform1uiv = lgl__glTrace_glProgramUniform1uiv;
+		lgl__glReal_glProgramUniform2i = glad_glProgramUniform2i;
+		if (glad_glProgramUniform2i) glad_glProgramUniform2i = lgl__glTrace_glProgramUniform2i;
+		lgl__glReal_glProgramUniform2iv = glad_glProgramUniform2iv;
+		if (glad_glProgramUniform2iv) glad_glProgramUniform2iv = lgl__glTrace_glProgramUniform2iv;
+		lgl__glReal_glProgramUniform2f = glad_glProgramUniform2f;
+		if (glad_glProgramUniform2f) glad_glProgramUniform2f = lgl__glTrace_glProgramUniform2f;
+		lgl__glReal_glProgramUniform2fv = glad_glProgramUniform2fv;
+		if (glad_glProgramUniform2fv) glad_glProgramUniform2fv = lgl__glTrace_glProgramUniform2fv;
+		lgl__glReal_glProgramUniform2d = glad_glProgramUniform2d;
+		if (glad_glProgramUniform2d) glad_glProgramUniform2d = lgl__glTrace_glProgramUniform2d;
+		lgl__glReal_glProgramUniform2dv = glad_glProgramUniform2dv;
+		if (glad_glProgramUniform2dv) glad_glProgramUniform2dv = lgl__glTrace_glProgramUniform2dv;
+		lgl__glReal_glProgramUniform2ui = glad_glProgramUniform2ui;
+		if (glad_glProgramUniform2ui) glad_glProgramUniform2ui = lgl__glTrace_glProgramUniform2ui;
+		lgl__glReal_glProgramUniform2uiv = glad_glProgramUniform2uiv;
+		if (glad_glProgramUniform2uiv) glad_glProgramUniform2uiv = lgl__glTrace_glProgramUniform2uiv;
+		lgl__glReal_glProgramUniform3i = glad_glProgramUniform3i;
+		if (glad_glProgramUniform3i) glad_glProgramUniform3i = lgl__glTrace_glProgramUniform3i;
+		lgl__glReal_glProgramUniform3iv = glad_glProgramUniform3iv;
+		if (glad_glProgramUniform3iv) glad_glProgramUniform3iv = lgl__glTrace_glProgramUniform3iv;
+		lgl__glReal_glProgramUniform3f = glad_glProgramUniform3f;
+		if (glad_glProgramUniform3f) glad_glProgramUniform3f = lgl__glTrace_glProgramUniform3f;
+		lgl__glReal_glProgramUniform3fv = glad_glProgramUniform3fv;
+		if (glad_glProgramUniform3fv) glad_glProgramUniform3fv = lgl__glTrace_glProgramUniform3fv;
+		lgl__glReal_glProgramUniform3d = glad_glProgramUniform3d;
+		if (glad_glProgramUniform3d) glad_glProgramUniform3d = lgl__glTrace_glProgramUniform3d;
+		lgl__glReal_glProgramUniform3dv = glad_glProgramUniform3dv;
+		if (glad_glProgramUniform3dv) glad_glProgramUniform3dv = lgl__glTrace_glProgramUniform3dv;
+		lgl__glReal_glProgramUniform3ui = glad_glProgramUniform3ui;
+		if (glad_glProgramUniform3ui) glad_glProgramUniform3ui = lgl__glTrace_glProgramUniform3ui;
+		lgl__glReal_glProgramUniform3uiv = glad_glProgramUniform3uiv;
+		if (glad_glProgramUniform3uiv) glad_glProgramUniform3uiv = lgl__glTrace_glProgramUniform3uiv;
+		lgl__glReal_glProgramUniform4i = glad_glProgramUniform4i;
+		if (glad_glProgramUniform4i) glad_glProgramUniform4i = lgl__glTrace_glProgramUniform4i;
+		lgl__glReal_glProgramUniform4iv = glad_glProgramUniform4iv;
+		if (glad_glProgramUniform4iv) glad_glProgramUniform4iv = lgl__glTrace_glProgramUniform4iv;
+		lgl__glReal_glProgramUniform4f = glad_glProgramUniform4f;
+		if (glad_glProgramUniform4f) glad_glProgramUniform4f = lgl__glTrace_glProgramUniform4f;
+		lgl__glReal_glProgramUniform4fv = glad_glProgramUniform4fv;
+		if (glad_glProgramUniform4fv) glad_glProgramUniform4fv = lgl__glTrace_glProgramUniform4fv;
+		lgl__glReal_glProgramUniform4d = glad_glProgramUniform4d;
+		if (glad_glProgramUniform4d) glad_glProgramUniform4d = lgl__glTrace_glProgramUniform4d;
+		lgl__glReal_glProgramUniform4dv = glad_glProgramUniform4dv;
+		if (glad_glProgramUniform4dv) glad_glProgramUniform4dv = lgl__glTrace_glProgramUniform4dv;
+		lgl__glReal_glProgramUniform4ui = glad_glProgramUniform4ui;
+		if (glad_glProgramUniform4ui) glad_glProgramUniform4ui = lgl__glTrace_glProgramUniform4ui;
+		lgl__glReal_glProgramUniform4uiv = glad_glProgramUniform4uiv;
+		if (glad_glProgramUniform4uiv) glad_glProgramUniform4uiv = lgl__glTrace_glProgramUniform4uiv;
+		lgl__glReal_glProgramUniformMatrix2fv = glad_glProgramUniformMatrix2fv;
+		if (glad_glProgramUniformMatrix2fv) glad_glProgramUniformMatrix2fv = lgl__glTrace_glProgramUniformMatrix2fv;
+		lgl__glReal_glProgramUniformMatrix3fv = glad_glProgramUniformMatrix3fv;
+		if (glad_glProgramUniformMatrix3fv) glad_glProgramUniformMatrix3fv = lgl__glTrace_glProgramUniformMatrix3fv;
+		lgl__glReal_glProgramUniformMatrix4fv = glad_glProgramUniformMatrix4fv;
+		if (glad_glProgramUniformMatrix4fv) glad_glProgramUniformMatrix4fv = lgl__glTrace_glProgramUniformMatrix4fv;
+		lgl__glReal_glProgramUniformMatrix2dv = glad_glProgramUniformMatrix2dv;
+		if (glad_glProgramUniformMatrix2dv) glad_glProgramUniformMatrix2dv = lgl__glTrace_glProgramUniformMatrix2dv;
+		lgl__glReal_glProgramUniformMatrix3dv = glad_glProgramUniformMatrix3dv;
+		if (glad_glProgramUniformMatrix3dv) glad_glProgramUniformMatrix3dv = lgl__glTrace_glProgramUniformMatrix3dv;
+		lgl__glReal_glProgramUniformMatrix4dv = glad_glProgramUniformMatrix4dv;
+		if (glad_glProgramUniformMatrix4dv) glad_glProgramUniformMatrix4dv = lgl__glTrace_glProgramUniformMatrix4dv;
+		lgl__glReal_glProgramUniformMatrix2x3fv = glad_glProgramUniformMatrix2x3fv;
+		if (glad_glProgramUniformMatrix2x3fv) glad_glProgramUniformMatrix2x3fv = lgl__glTrace_glProgramUniformMatrix2x3fv;
+		lgl__glReal_glProgramUniformMatrix3x2fv = glad_glProgramUniformMatrix3x2fv;
+		if (glad_glProgramUniformMatrix3x2fv) glad_glProgramUniformMatrix3x2fv = lgl__glTrace_glProgramUniformMatrix3x2fv;
+		lgl__glReal_glProgramUniformMatrix2x4fv = glad_glProgramUniformMatrix2x4fv;
+		if (glad_glProgramUniformMatrix2x4fv) glad_glProgramUniformMatrix2x4fv = lgl__glTrace_glProgramUniformMatrix2x4fv;
+		lgl__glReal_glProgramUniformMatrix4x2fv = glad_glProgramUniformMatrix4x2fv;
+		if (glad_glProgramUniformMatrix4x2fv) glad_glProgramUniformMatrix4x2fv = lgl__glTrace_glProgramUniformMatrix4x2fv;
+		lgl__glReal_glProgramUniformMatrix3x4fv = glad_glProgramUniformMatrix3x4fv;
+		if (glad_glProgramUniformMatrix3x4fv) glad_glProgramUniformMatrix3x4fv = lgl__glTrace_glProgramUniformMatrix3x4fv;
+		lgl__glReal_glProgramUniformMatrix4x3fv = glad_glProgramUniformMatrix4x3fv;
+		if (glad_glProgramUniformMatrix4x3fv) glad_glProgramUniformMatrix4x3fv = lgl__glTrace_glProgramUniformMatrix4x3fv;
+		lgl__glReal_glProgramUniformMatrix2x3dv = glad_glProgramUniformMatrix2x3dv;
+		if (glad_glProgramUniformMatrix2x3dv) glad_glProgramUniformMatrix2x3dv = lgl__glTrace_glProgramUniformMatrix2x3dv;
+		lgl__glReal_glProgramUniformMatrix3x2dv = glad_glProgramUniformMatrix3x2dv;
+		if (glad_glProgramUniformMatrix3x2dv) glad_glProgramUniformMatrix3x2dv = lgl__glTrace_glProgramUniformMatrix3x2dv;
+		lgl__glReal_glProgramUniformMatrix2x4dv = glad_glProgramUniformMatrix2x4dv;
+		if (glad_glProgramUniformMatrix2x4dv) glad_glProgramUniformMatrix2x4dv = lgl__glTrace_glProgramUniformMatrix2x4dv;
+		lgl__glReal_glProgramUniformMatrix4x2dv = glad_glProgramUniformMatrix4x2dv;
+		if (glad_glProgramUniformMatrix4x2dv) glad_glProgramUniformMatrix4x2dv = lgl__glTrace_glProgramUniformMatrix4x2dv;
+		lgl__glReal_glProgramUniformMatrix3x4dv = glad_glProgramUniformMatrix3x4dv;
+		if (glad_glProgramUniformMatrix3x4dv) glad_glProgramUniformMatrix3x4dv = lgl__glTrace_glProgramUniformMatrix3x4dv;
+		lgl__glReal_glProgramUniformMatrix4x3dv = glad_glProgramUniformMatrix4x3dv;
+		if (glad_glProgramUniformMatrix4x3dv) glad_glProgramUniformMatrix4x3dv = lgl__glTrace_glProgramUniformMatrix4x3dv;
+		lgl__glReal_glValidateProgramPipeline = glad_glValidateProgramPipeline;
+		if (glad_glValidateProgramPipeline) glad_glValidateProgramPipeline = lgl__glTrace_glValidateProgramPipeline;
+		lgl__glReal_glGetProgramPipelineInfoLog = glad_glGetProgramPipelineInfoLog;
+		if (glad_glGetProgramPipelineInfoLog) glad_glGetProgramPipelineInfoLog = lgl__glTrace_glGetProgramPipelineInfoLog;
+		lgl__glReal_glVertexAttribL1d = glad_glVertexAttribL1d;
+		if (glad_glVertexAttribL1d) glad_glVertexAttribL1d = lgl__glTrace_glVertexAttribL1d;
+		lgl__glReal_glVertexAttribL2d = glad_glVertexAttribL2d;
+		if (glad_glVertexAttribL2d) glad_glVertexAttribL2d = lgl__glTrace_glVertexAttribL2d;
+		lgl__glReal_glVertexAttribL3d = glad_glVertexAttribL3d;
+		if (glad_glVertexAttribL3d) glad_glVertexAttribL3d = lgl__glTrace_glVertexAttribL3d;
+		lgl__glReal_glVertexAttribL4d = glad_glVertexAttribL4d;
+		if (glad_glVertexAttribL4d) glad_glVertexAttribL4d = lgl__glTrace_glVertexAttribL4d;
+		lgl__glReal_glVertexAttribL1dv = glad_glVertexAttribL1dv;
+		if (glad_glVertexAttribL1dv) glad_glVertexAttribL1dv = lgl__glTrace_glVertexAttribL1dv;
+		lgl__glReal_glVertexAttribL2dv = glad_glVertexAttribL2dv;
+		if (glad_glVertexAttribL2dv) glad_glVertexAttribL2dv = lgl__glTrace_glVertexAttribL2dv;
+		lgl__glReal_glVertexAttribL3dv = glad_glVertexAttribL3dv;
+		if (glad_glVertexAttribL3dv) glad_glVertexAttribL3dv = lgl__glTrace_glVertexAttribL3dv;
+		lgl__glReal_glVertexAttribL4dv = glad_glVertexAttribL4dv;
+		if (glad_glVertexAttribL4dv) glad_glVertexAttribL4dv = lgl__glTrace_glVertexAttribL4dv;
+		lgl__glReal_glVertexAttribLPointer = glad_glVertexAttribLPointer;
+		if (glad_glVertexAttribLPointer) glad_glVertexAttribLPointer = lgl__glTrace_glVertexAttribLPointer;
+		lgl__glReal_glGetVertexAttribLdv = glad_glGetVertexAttribLdv;
+		if (glad_glGetVertexAttribLdv) glad_glGetVertexAttribLdv = lgl__glTrace_glGetVertexAttribLdv;
+		lgl__glReal_glViewportArrayv = glad_glViewportArrayv;
+		if (glad_glViewportArrayv) glad_glViewportArrayv = lgl__glTrace_glViewportArrayv;
+		lgl__glReal_glViewportIndexedf = glad_glViewportIndexedf;
+		if (glad_glViewportIndexedf) glad_glViewportIndexedf = lgl__glTrace_glViewportIndexedf;
+		lgl__glReal_glViewportIndexedfv = glad_glViewportIndexedfv;
+		if (glad_glViewportIndexedfv) glad_glViewportIndexedfv = lgl__glTrace_glViewportIndexedfv;
+		lgl__glReal_glScissorArrayv = glad_glScissorArrayv;
+		if (glad_glScissorArrayv) glad_glScissorArrayv = lgl__glTrace_glScissorArrayv;
+		lgl__glReal_glScissorIndexed = glad_glScissorIndexed;
+		if (glad_glScissorIndexed) glad_glScissorIndexed = lgl__glTrace_glScissorIndexed;
+		lgl__glReal_glScissorIndexedv = glad_glScissorIndexedv;
+		if (glad_glScissorIndexedv) glad_glScissorIndexedv = lgl__glTrace_glScissorIndexedv;
+		lgl__glReal_glDepthRangeArrayv = glad_glDepthRangeArrayv;
+		if (glad_glDepthRangeArrayv) glad_glDepthRangeArrayv = lgl__glTrace_glDepthRangeArrayv;
+		lgl__glReal_glDepthRangeIndexed = glad_glDepthRangeIndexed;
+		if (glad_glDepthRangeIndexed) glad_glDepthRangeIndexed = lgl__glTrace_glDepthRangeIndexed;
+		lgl__glReal_glGetFloati_v = glad_glGetFloati_v;
+		if (glad_glGetFloati_v) glad_glGetFloati_v = lgl__glTrace_glGetFloati_v;
+		lgl__glReal_glGetDoublei_v = glad_glGetDoublei_v;
+		if (glad_glGetDoublei_v) glad_glGetDoublei_v = lgl__glTrace_glGetDoublei_v;
+		lgl__glReal_glDrawArraysInstancedBaseInstance = glad_glDrawArraysInstancedBaseInstance;
+		if (glad_glDrawArraysInstancedBaseInstance) glad_glDrawArraysInstancedBaseInstance = lgl__glTrace_glDrawArraysInstancedBaseInstance;
+		lgl__glReal_glDrawElementsInstancedBaseInstance = glad_glDrawElementsInstancedBaseInstance;
+		if (glad_glDrawElementsInstancedBaseInstance) glad_glDrawElementsInstancedBaseInstance = lgl__glTrace_glDrawElementsInstancedBaseInstance;
+		lgl__glReal_glDrawElementsInstancedBaseVertexBaseInstance = glad_glDrawElementsInstancedBaseVertexBaseInstance;
+		if (glad_glDrawElementsInstancedBaseVertexBaseInstance) glad_glDrawElementsInstancedBaseVertexBaseInstance = lgl__glTrace_glDrawElementsInstancedBaseVertexBaseInstance;
+		lgl__glReal_glGetInternalformativ = glad_glGetInternalformativ;
+		if (glad_glGetInternalformativ) glad_glGetInternalformativ = lgl__glTrace_glGetInternalformativ;
+		lgl__glReal_glGetActiveAtomicCounterBufferiv = glad_glGetActiveAtomicCounterBufferiv;
+		if (glad_glGetActiveAtomicCounterBufferiv) glad_glGetActiveAtomicCounterBufferiv = lgl__glTrace_glGetActiveAtomicCounterBufferiv;
+		lgl__glReal_glBindImageTexture = glad_glBindImageTexture;
+		if (glad_glBindImageTexture) glad_glBindImageTexture = lgl__glTrace_glBindImageTexture;
+		lgl__glReal_glMemoryBarrier = glad_glMemoryBarrier;
+		if (glad_glMemoryBarrier) glad_glMemoryBarrier = lgl__glTrace_glMemoryBarrier;
+		lgl__glReal_glTexStorage1D = glad_glTexStorage1D;
+		if (glad_glTexStorage1D) glad_glTexStorage1D = lgl__glTrace_glTexStorage1D;
+		lgl__glReal_glTexStorage2D = glad_glTexStorage2D;
+		if (glad_glTexStorage2D) glad_glTexStorage2D = lgl__glTrace_glTexStorage2D;
+		lgl__glReal_glTexStorage3D = glad_glTexStorage3D;
+		if (glad_glTexStorage3D) glad_glTexStorage3D = lgl__glTrace_glTexStorage3D;
+		lgl__glReal_glDrawTransformFeedbackInstanced = glad_glDrawTransformFeedbackInstanced;
+		if (glad_glDrawTransformFeedbackInstanced) glad_glDrawTransformFeedbackInstanced = lgl__glTrace_glDrawTransformFeedbackInstanced;
+		lgl__glReal_glDrawTransformFeedbackStreamInstanced = glad_glDrawTransformFeedbackStreamInstanced;
+		if (glad_glDrawTransformFeedbackStreamInstanced) glad_glDrawTransformFeedbackStreamInstanced = lgl__glTrace_glDrawTransformFeedbackStreamInstanced;
+		lgl__glReal_glClearBufferData = glad_glClearBufferData;
+		if (glad_glClearBufferData) glad_glClearBufferData = lgl__glTrace_glClearBufferData;
+		lgl__glReal_glClearBufferSubData = glad_glClearBufferSubData;
+		if (glad_glClearBufferSubData) glad_glClearBufferSubData = lgl__glTrace_glClearBufferSubData;
+		lgl__glReal_glDispatchCompute = glad_glDispatchCompute;
+		if (glad_glDispatchCompute) glad_glDispatchCompute = lgl__glTrace_glDispatchCompute;
+		lgl__glReal_glDispatchComputeIndirect = glad_glDispatchComputeIndirect;
+		if (glad_glDispatchComputeIndirect) glad_glDispatchComputeIndirect = lgl__glTrace_glDispatchComputeIndirect;
+		lgl__glReal_glCopyImageSubData = glad_glCopyImageSubData;
+		if (glad_glCopyImageSubData) glad_glCopyImageSubData = lgl__glTrace_glCopyImageSubData;
+		lgl__glReal_glFramebufferParameteri = glad_glFramebufferParameteri;
+		if (glad_glFramebufferParameteri) glad_glFramebufferParameteri = lgl__glTrace_glFramebufferParameteri;
+		lgl__glReal_glGetFramebufferParameteriv = glad_glGetFramebufferParameteriv;
+		if (glad_glGetFramebufferParameteriv) glad_glGetFramebufferParameteriv = lgl__glTrace_glGetFramebufferParameteriv;
+		lgl__glReal_glGetInternalformati64v = glad_glGetInternalformati64v;
+		if (glad_glGetInternalformati64v) glad_glGetInternalformati64v = lgl__glTrace_glGetInternalformati64v;
+		lgl__glReal_glInvalidateTexSubImage = glad_glInvalidateTexSubImage;
+		if (glad_glInvalidateTexSubImage) glad_glInvalidateTexSubImage = lgl__glTrace_glInvalidateTexSubImage;
+		lgl__glReal_glInvalidateTexImage = glad_glInvalidateTexImage;
+		if (glad_glInvalidateTexImage) glad_glInvalidateTexImage = lgl__glTrace_glInvalidateTexImage;
+		lgl__glReal_glInvalidateBufferSubData = glad_glInvalidateBufferSubData;
+		if (glad_glInvalidateBufferSubData) glad_glInvalidateBufferSubData = lgl__glTrace_glInvalidateBufferSubData;
+		lgl__glReal_glInvalidateBufferData = glad_glInvalidateBufferData;
+		if (glad_glInvalidateBufferData) glad_glInvalidateBufferData = lgl__glTrace_glInvalidateBufferData;
+		lgl__glReal_glInvalidateFramebuffer = glad_glInvalidateFramebuffer;
+		if (glad_glInvalidateFramebuffer) glad_glInvalidateFramebuffer = lgl__glTrace_glInvalidateFramebuffer;
+		lgl__glReal_glInvalidateSubFramebuffer = glad_glInvalidateSubFramebuffer;
+		if (glad_glInvalidateSubFramebuffer) glad_glInvalidateSubFramebuffer = lgl__glTrace_glInvalidateSubFramebuffer;
+		lgl__glReal_glMultiDrawArraysIndirect = glad_glMultiDrawArraysIndirect;
+		if (glad_glMultiDrawArraysIndirect) glad_glMultiDrawArraysIndirect = lgl__glTrace_glMultiDrawArraysIndirect;
+		lgl__glReal_glMultiDrawElementsIndirect = glad_glMultiDrawElementsIndirect;
+		if (glad_glMultiDrawElementsIndirect) glad_glMultiDrawElementsIndirect = lgl__glTrace_glMultiDrawElementsIndirect;
+		lgl__glReal_glGetProgramInterfaceiv = glad_glGetProgramInterfaceiv;
+		if (glad_glGetProgramInterfaceiv) glad_glGetProgramInterfaceiv = lgl__glTrace_glGetProgramInterfaceiv;
+		lgl__glReal_glGetProgramResourceIndex = glad_glGetProgramResourceIndex;
+		if (glad_glGetProgramResourceIndex) glad_glGetProgramResourceIndex = lgl__glTrace_glGetProgramResourceIndex;
+		lgl__glReal_glGetProgramResourceName = glad_glGetProgramResourceName;
+		if (glad_glGetProgramResourceName) glad_glGetProgramResourceName = lgl__glTrace_glGetProgramResourceName;
+		lgl__glReal_glGetProgramResourceiv = glad_glGetProgramResourceiv;
+		if (glad_glGetProgramResourceiv) glad_glGetProgramResourceiv = lgl__glTrace_glGetProgramResourceiv;
+		lgl__glReal_glGetProgramResourceLocation = glad_glGetProgramResourceLocation;
+		if (glad_glGetProgramResourceLocation) glad_glGetProgramResourceLocation = lgl__glTrace_glGetProgramResourceLocation;
+		lgl__glReal_glGetProgramResourceLocationIndex = glad_glGetProgramResourceLocationIndex;
+		if (glad_glGetProgramResourceLocationIndex) glad_glGetProgramResourceLocationIndex = lgl__glTrace_glGetProgramResourceLocationIndex;
+		lgl__glReal_glShaderStorageBlockBinding = glad_glShaderStorageBlockBinding;
+		if (glad_glShaderStorageBlockBinding) glad_glShaderStorageBlockBinding = lgl__glTrace_glShaderStorageBlockBinding;
+		lgl__glReal_glTexBufferRange = glad_glTexBufferRange;
+		if (glad_glTexBufferRange) glad_glTexBufferRange = lgl__glTrace_glTexBufferRange;
+		lgl__glReal_glTexStorage2DMultisample = glad_glTexStorage2DMultisample;
+		if (glad_glTexStorage2DMultisample) glad_glTexStorage2DMultisample = lgl__glTrace_glTexStorage2DMultisample;
+		lgl__glReal_glTexStorage3DMultisample = glad_glTexStorage3DMultisample;
+		if (glad_glTexStorage3DMultisample) glad_glTexStorage3DMultisample = lgl__glTrace_glTexStorage3DMultisample;
+		lgl__glReal_glTextureView = glad_glTextureView;
+		if (glad_glTextureView) glad_glTextureView = lgl__glTrace_glTextureView;
+		lgl__glReal_glBindVertexBuffer = glad_glBindVertexBuffer;
+		if (glad_glBindVertexBuffer) glad_glBindVertexBuffer = lgl__glTrace_glBindVertexBuffer;
+		lgl__glReal_glVertexAttribFormat = glad_glVertexAttribFormat;
+		if (glad_glVertexAttribFormat) glad_glVertexAttribFormat = lgl__glTrace_glVertexAttribFormat;
+		lgl__glReal_glVertexAttribIFormat = glad_glVertexAttribIFormat;
+		if (glad_glVertexAttribIFormat) glad_glVertexAttribIFormat = lgl__glTrace_glVertexAttribIFormat;
+		lgl__glReal_glVertexAttribLFormat = glad_glVertexAttribLFormat;
+		if (glad_glVertexAttribLFormat) glad_glVertexAttribLFormat = lgl__glTrace_glVertexAttribLFormat;
+		lgl__glReal_glVertexAttribBinding = glad_glVertexAttribBinding;
+		if (glad_glVertexAttribBinding) glad_glVertexAttribBinding = lgl__glTrace_glVertexAttribBinding;
+		lgl__glReal_glVertexBindingDivisor = glad_glVertexBindingDivisor;
+		if (glad_glVertexBindingDivisor) glad_glVertexBindingDivisor = lgl__glTrace_glVertexBindingDivisor;
+		lgl__glReal_glDebugMessageControl = glad_glDebugMessageControl;
+		if (glad_glDebugMessageControl) glad_glDebugMessageControl = lgl__glTrace_glDebugMessageControl;
+		lgl__glReal_glDebugMessageInsert = glad_glDebugMessageInsert;
+		if (glad_glDebugMessageInsert) glad_glDebugMessageInsert = lgl__glTrace_glDebugMessageInsert;
+		lgl__glReal_glDebugMessageCallback = glad_glDebugMessageCallback;
+		if (glad_glDebugMessageCallback) glad_glDebugMessageCallback = lgl__glTrace_glDebugMessageCallback;
+		lgl__glReal_glGetDebugMessageLog = glad_glGetDebugMessageLog;
+		if (glad_glGetDebugMessageLog) glad_glGetDebugMessageLog = lgl__glTrace_glGetDebugMessageLog;
+		lgl__glReal_glPushDebugGroup = glad_glPushDebugGroup;
+		if (glad_glPushDebugGroup) glad_glPushDebugGroup = lgl__glTrace_glPushDebugGroup;
+		lgl__glReal_glPopDebugGroup = glad_glPopDebugGroup;
+		if (glad_glPopDebugGroup) glad_glPopDebugGroup = lgl__glTrace_glPopDebugGroup;
+		lgl__glReal_glObjectLabel = glad_glObjectLabel;
+		if (glad_glObjectLabel) glad_glObjectLabel = lgl__glTrace_glObjectLabel;
+		lgl__glReal_glGetObjectLabel = glad_glGetObjectLabel;
+		if (glad_glGetObjectLabel) glad_glGetObjectLabel = lgl__glTrace_glGetObjectLabel;
+		lgl__glReal_glObjectPtrLabel = glad_glObjectPtrLabel;
+		if (glad_glObjectPtrLabel) glad_glObjectPtrLabel = lgl__glTrace_glObjectPtrLabel;
+		lgl__glReal_glGetObjectPtrLabel = glad_glGetObjectPtrLabel;
+		if (glad_glGetObjectPtrLabel) glad_glGetObjectPtrLabel = lgl__glTrace_glGetObjectPtrLabel;
+		lgl__glReal_glGetPointerv = glad_glGetPointerv;
+		if (glad_glGetPointerv) glad_glGetPointerv = lgl__glTrace_glGetPointerv;
+		lgl__glReal_glBufferStorage = glad_glBufferStorage;
+		if (glad_glBufferStorage) glad_glBufferStorage = lgl__glTrace_glBufferStorage;
+		lgl__glReal_glClearTexImage = glad_glClearTexImage;
+		if (glad_glClearTexImage) glad_glClearTexImage = lgl__glTrace_glClearTexImage;
+		lgl__glReal_glClearTexSubImage = glad_glClearTexSubImage;
+		if (glad_glClearTexSubImage) glad_glClearTexSubImage = lgl__glTrace_glClearTexSubImage;
+		lgl__glReal_glBindBuffersBase = glad_glBindBuffersBase;
+		if (glad_glBindBuffersBase) glad_glBindBuffersBase = lgl__glTrace_glBindBuffersBase;
+		lgl__glReal_glBindBuffersRange = glad_glBindBuffersRange;
+		if (glad_glBindBuffersRange) glad_glBindBuffersRange = lgl__glTrace_glBindBuffersRange;
+		lgl__glReal_glBindTextures = glad_glBindTextures;
+		if (glad_glBindTextures) glad_glBindTextures = lgl__glTrace_glBindTextures;
+		lgl__glReal_glBindSamplers = glad_glBindSamplers;
+		if (glad_glBindSamplers) glad_glBindSamplers = lgl__glTrace_glBindSamplers;
+		lgl__glReal_glBindImageTextures = glad_glBindImageTextures;
+		if (glad_glBindImageTextures) glad_glBindImageTextures = lgl__glTrace_glBindImageTextures;
+		lgl__glReal_glBindVertexBuffers = glad_glBindVertexBuffers;
+		if (glad_glBindVertexBuffers) glad_glBindVertexBuffers = lgl__glTrace_glBindVertexBuffers;
+		lgl__glReal_glClipControl = glad_glClipControl;
+		if (glad_glClipControl) glad_glClipControl = lgl__glTrace_glClipControl;
+		lgl__glReal_glCreateTransformFeedbacks = glad_glCreateTransformFeedbacks;
+		if (glad_glCreateTransformFeedbacks) glad_glCreateTransformFeedbacks = lgl__glTrace_glCreateTransformFeedbacks;
+		lgl__glReal_glTransformFeedbackBufferBase = glad_glTransformFeedbackBufferBase;
+		if (glad_glTransformFeedbackBufferBase) glad_glTransformFeedbackBufferBase = lgl__glTrace_glTransformFeedbackBufferBase;
+		lgl__glReal_glTransformFeedbackBufferRange = glad_glTransformFeedbackBufferRange;
+		if (glad_glTransformFeedbackBufferRange) glad_glTransformFeedbackBufferRange = lgl__glTrace_glTransformFeedbackBufferRange;
+		lgl__glReal_glGetTransformFeedbackiv = glad_glGetTransformFeedbackiv;
+		if (glad_glGetTransformFeedbackiv) glad_glGetTransformFeedbackiv = lgl__glTrace_glGetTransformFeedbackiv;
+		lgl__glReal_glGetTransformFeedbacki_v = glad_glGetTransformFeedbacki_v;
+		if (glad_glGetTransformFeedbacki_v) glad_glGetTransformFeedbacki_v = lgl__glTrace_glGetTransformFeedbacki_v;
+		lgl__glReal_glGetTransformFeedbacki64_v = glad_glGetTransformFeedbacki64_v;
+		if (glad_glGetTransformFeedbacki64_v) glad_glGetTransformFeedbacki64_v = lgl__glTrace_glGetTransformFeedbacki64_v;
+		lgl__glReal_glCreateBuffers = glad_glCreateBuffers;
+		if (glad_glCreateBuffers) glad_glCreateBuffers = lgl__glTrace_glCreateBuffers;
+		lgl__glReal_glNamedBufferStorage = glad_glNamedBufferStorage;
+		if (glad_glNamedBufferStorage) glad_glNamedBufferStorage = lgl__glTrace_glNamedBufferStorage;
+		lgl__glReal_glNamedBufferData = glad_glNamedBufferData;
+		if (glad_glNamedBufferData) glad_glNamedBufferData = lgl__glTrace_glNamedBufferData;
+		lgl__glReal_glNamedBufferSubData = glad_glNamedBufferSubData;
+		if (glad_glNamedBufferSubData) glad_glNamedBufferSubData = lgl__glTrace_glNamedBufferSubData;
+		lgl__glReal_glCopyNamedBufferSubData = glad_glCopyNamedBufferSubData;
+		if (glad_glCopyNamedBufferSubData) glad_glCopyNamedBufferSubData = lgl__glTrace_glCopyNamedBufferSubData;
+		lgl__glReal_glClearNamedBufferData = glad_glClearNamedBufferData;
+		if (glad_glClearNamedBufferData) glad_glClearNamedBufferData = lgl__glTrace_glClearNamedBufferData;
+		lgl__glReal_glClearNamedBufferSubData = glad_glClearNamedBufferSubData;
+		if (glad_glClearNamedBufferSubData) glad_glClearNamedBufferSubData = lgl__glTrace_glClearNamedBufferSubData;
+		lgl__glReal_glMapNamedBuffer = glad_glMapNamedBuffer;
+		if (glad_glMapNamedBuffer) glad_glMapNamedBuffer = lgl__glTrace_glMapNamedBuffer;
+		lgl__glReal_glMapNamedBufferRange = glad_glMapNamedBufferRange;
+		if (glad_glMapNamedBufferRange) glad_glMapNamedBufferRange = lgl__glTrace_glMapNamedBufferRange;
+		lgl__glReal_glUnmapNamedBuffer = glad_glUnmapNamedBuffer;
+		if (glad_glUnmapNamedBuffer) glad_glUnmapNamedBuffer = lgl__glTrace_glUnmapNamedBuffer;
+		lgl__glReal_glFlushMappedNamedBufferRange = glad_glFlushMappedNamedBufferRange;
+		if (glad_glFlushMappedNamedBufferRange) glad_glFlushMappedNamedBufferRange = lgl__glTrace_glFlushMappedNamedBufferRange;
+		lgl__glReal_glGetNamedBufferParameteriv = glad_glGetNamedBufferParameteriv;
+		if (glad_glGetNamedBufferParameteriv) glad_glGetNamedBufferParameteriv = lgl__glTrace_glGetNamedBufferParameteriv;
+		lgl__glReal_glGetNamedBufferParameteri64v = glad_glGetNamedBufferParameteri64v;
+		if (glad_glGetNamedBufferParameteri64v) glad_glGetNamedBufferParameteri64v = lgl__glTrace_glGetNamedBufferParameteri64v;
+		lgl__glReal_glGetNamedBufferPointerv = glad_glGetNamedBufferPointerv;
+		if (glad_glGetNamedBufferPointerv) glad_glGetNamedBufferPointerv = lgl__glTrace_glGetNamedBufferPointerv;
+		lgl__glReal_glGetNamedBufferSubData = glad_glGetNamedBufferSubData;
+		if (glad_glGetNamedBufferSubData) glad_glGetNamedBufferSubData = lgl__glTrace_glGetNamedBufferSubData;
+		lgl__glReal_glCreateFramebuffers = glad_glCreateFramebuffers;
+		if (glad_glCreateFramebuffers) glad_glCreateFramebuffers = lgl__glTrace_glCreateFramebuffers;
+		lgl__glReal_glNamedFramebufferRenderbuffer = glad_glNamedFramebufferRenderbuffer;
+		if (glad_glNamedFramebufferRenderbuffer) glad_glNamedFramebufferRenderbuffer = lgl__glTrace_glNamedFramebufferRenderbuffer;
+		lgl__glReal_glNamedFramebufferParameteri = glad_glNamedFramebufferParameteri;
+		if (glad_glNamedFramebufferParameteri) glad_glNamedFramebufferParameteri = lgl__glTrace_glNamedFramebufferParameteri;
+		lgl__glReal_glNamedFramebufferTexture = glad_glNamedFramebufferTexture;
+		if (glad_glNamedFramebufferTexture) glad_glNamedFramebufferTexture = lgl__glTrace_glNamedFramebufferTexture;
+		lgl__glReal_glNamedFramebufferTextureLayer = glad_glNamedFramebufferTextureLayer;
+		if (glad_glNamedFramebufferTextureLayer) glad_glNamedFramebufferTextureLayer = lgl__glTrace_glNamedFramebufferTextureLayer;
+		lgl__glReal_glNamedFramebufferDrawBuffer = glad_glNamedFramebufferDrawBuffer;
+		if (glad_glNamedFramebufferDrawBuffer) glad_glNamedFramebufferDrawBuffer = lgl__glTrace_glNamedFramebufferDrawBuffer;
+		lgl__glReal_glNamedFramebufferDrawBuffers = glad_glNamedFramebufferDrawBuffers;
+		if (glad_glNamedFramebufferDrawBuffers) glad_glNamedFramebufferDrawBuffers = lgl__glTrace_glNamedFramebufferDrawBuffers;
+		lgl__glReal_glNamedFramebufferReadBuffer = glad_glNamedFramebufferReadBuffer;
+		if (glad_glNamedFramebufferReadBuffer) glad_glNamedFramebufferReadBuffer = lgl__glTrace_glNamedFramebufferReadBuffer;
+		lgl__glReal_glInvalidateNamedFramebufferData = glad_glInvalidateNamedFramebufferData;
+		if (glad_glInvalidateNamedFramebufferData) glad_glInvalidateNamedFramebufferData = lgl__glTrace_glInvalidateNamedFramebufferData;
+		lgl__glReal_glInvalidateNamedFramebufferSubData = glad_glInvalidateNamedFramebufferSubData;
+		if (glad_glInvalidateNamedFramebufferSubData) glad_glInvalidateNamedFramebufferSubData = lgl__glTrace_glInvalidateNamedFramebufferSubData;
+		lgl__glReal_glClearNamedFramebufferiv = glad_glClearNamedFramebufferiv;
+		if (glad_glClearNamedFramebufferiv) glad_glClearNamedFramebufferiv = lgl__glTrace_glClearNamedFramebufferiv;
+		lgl__glReal_glClearNamedFramebufferuiv = glad_glClearNamedFramebufferuiv;
+		if (glad_glClearNamedFramebufferuiv) glad_glClearNamedFramebufferuiv = lgl__glTrace_glClearNamedFramebufferuiv;
+		lgl__glReal_glClearNamedFramebufferfv = glad_glClearNamedFramebufferfv;
+		if (glad_glClearNamedFramebufferfv) glad_glClearNamedFramebufferfv = lgl__glTrace_glClearNamedFramebufferfv;
+		lgl__glReal_glClearNamedFramebufferfi = glad_glClearNamedFramebufferfi;
+		if (glad_glClearNamedFramebufferfi) glad_glClearNamedFramebufferfi = lgl__glTrace_glClearNamedFramebufferfi;
+		lgl__glReal_glBlitNamedFramebuffer = glad_glBlitNamedFramebuffer;
+		if (glad_glBlitNamedFramebuffer) glad_glBlitNamedFramebuffer = lgl__glTrace_glBlitNamedFramebuffer;
+		lgl__glReal_glCheckNamedFramebufferStatus = glad_glCheckNamedFramebufferStatus;
+		if (glad_glCheckNamedFramebufferStatus) glad_glCheckNamedFramebufferStatus = lgl__glTrace_glCheckNamedFramebufferStatus;
+		lgl__glReal_glGetNamedFramebufferParameteriv = glad_glGetNamedFramebufferParameteriv;
+		if (glad_glGetNamedFramebufferParameteriv) glad_glGetNamedFramebufferParameteriv = lgl__glTrace_glGetNamedFramebufferParameteriv;
+		lgl__glReal_glGetNamedFramebufferAttachmentParameteriv = glad_glGetNamedFramebufferAttachmentParameteriv;
+		if (glad_glGetNamedFramebufferAttachmentParameteriv) glad_glGetNamedFramebufferAttachmentParameteriv = lgl__glTrace_glGetNamedFramebufferAttachmentParameteriv;
+		lgl__glReal_glCreateRenderbuffers = glad_glCreateRenderbuffers;
+		if (glad_glCreateRenderbuffers) glad_glCreateRenderbuffers = lgl__glTrace_glCreateRenderbuffers;
+		lgl__glReal_glNamedRenderbufferStorage = glad_glNamedRenderbufferStorage;
+		if (glad_glNamedRenderbufferStorage) glad_glNamedRenderbufferStorage = lgl__glTrace_glNamedRenderbufferStorage;
+		lgl__glReal_glNamedRenderbufferStorageMultisample = glad_glNamedRenderbufferStorageMultisample;
+		if (glad_glNamedRenderbufferStorageMultisample) glad_glNamedRenderbufferStorageMultisample = lgl__glTrace_glNamedRenderbufferStorageMultisample;
+		lgl__glReal_glGetNamedRenderbufferParameteriv = glad_glGetNamedRenderbufferParameteriv;
+		if (glad_glGetNamedRenderbufferParameteriv) glad_glGetNamedRenderbufferParameteriv = lgl__glTrace_glGetNamedRenderbufferParameteriv;
+		lgl__glReal_glCreateTextures = glad_glCreateTextures;
+		if (glad_glCreateTextures) glad_glCreateTextures = lgl__glTrace_glCreateTextures;
+		lgl__glReal_glTextureBuffer = glad_glTextureBuffer;
+		if (glad_glTextureBuffer) glad_glTextureBuffer = lgl__glTrace_glTextureBuffer;
+		lgl__glReal_glTextureBufferRange = glad_glTextureBufferRange;
+		if (glad_glTextureBufferRange) glad_glTextureBufferRange = lgl__glTrace_glTextureBufferRange;
+		lgl__glReal_glTextureStorage1D = glad_glTextureStorage1D;
+		if (glad_glTextureStorage1D) glad_glTextureStorage1D = lgl__glTrace_glTextureStorage1D;
+		lgl__glReal_glTextureStorage2D = glad_glTextureStorage2D;
+		if (glad_glTextureStorage2D) glad_glTextureStorage2D = lgl__glTrace_glTextureStorage2D;
+		lgl__glReal_glTextureStorage3D = glad_glTextureStorage3D;
+		if (glad_glTextureStorage3D) glad_glTextureStorage3D = lgl__glTrace_glTextureStorage3D;
+		lgl__glReal_glTextureStorage2DMultisample = glad_glTextureStorage2DMultisample;
+		if (glad_glTextureStorage2DMultisample) glad_glTextureStorage2DMultisample = lgl__glTrace_glTextureStorage2DMultisample;
+		lgl__glReal_glTextureStorage3DMultisample = glad_glTextureStorage3DMultisample;
+		if (glad_glTextureStorage3DMultisample) glad_glTextureStorage3DMultisample = lgl__glTrace_glTextureStorage3DMultisample;
+		lgl__glReal_glTextureSubImage1D = glad_glTextureSubImage1D;
+		if (glad_glTextureSubImage1D) glad_glTextureSubImage1D = lgl__glTrace_glTextureSubImage1D;
+		lgl__glReal_glTextureSubImage2D = glad_glTextureSubImage2D;
+		if (glad_glTextureSubImage2D) glad_glTextureSubImage2D = lgl__glTrace_glTextureSubImage2D;
+		lgl__glReal_glTextureSubImage3D = glad_glTextureSubImage3D;
+		if (glad_glTextureSubImage3D) glad_glTextureSubImage3D = lgl__glTrace_glTextureSubImage3D;
+		lgl__glReal_glCompressedTextureSubImage1D = glad_glCompressedTextureSubImage1D;
+		if (glad_glCompressedTextureSubImage1D) glad_glCompressedTextureSubImage1D = lgl__glTrace_glCompressedTextureSubImage1D;
+		lgl__glReal_glCompressedTextureSubImage2D = glad_glCompressedTextureSubImage2D;
+		if (glad_glCompressedTextureSubImage2D) glad_glCompressedTextureSubImage2D = lgl__glTrace_glCompressedTextureSubImage2D;
+		lgl__glReal_glCompressedTextureSubImage3D = glad_glCompressedTextureSubImage3D;
+		if (glad_glCompressedTextureSubImage3D) glad_glCompressedTextureSubImage3D = lgl__glTrace_glCompressedTextureSubImage3D;
+		lgl__glReal_glCopyTextureSubImage1D = glad_glCopyTextureSubImage1D;
+		if (glad_glCopyTextureSubImage1D) glad_glCopyTextureSubImage1D = lgl__glTrace_glCopyTextureSubImage1D;
+		lgl__glReal_glCopyTextureSubImage2D = glad_glCopyTextureSubImage2D;
+		if (glad_glCopyTextureSubImage2D) glad_glCopyTextureSubImage2D = lgl__glTrace_glCopyTextureSubImage2D;
+		lgl__glReal_glCopyTextureSubImage3D = glad_glCopyTextureSubImage3D;
+		if (glad_glCopyTextureSubImage3D) glad_glCopyTextureSubImage3D = lgl__glTrace_glCopyTextureSubImage3D;
+		lgl__glReal_glTextureParameterf = glad_glTextureParameterf;
+		if (glad_glTextureParameterf) glad_glTextureParameterf = lgl__glTrace_glTextureParameterf;
+		lgl__glReal_glTextureParameterfv = glad_glTextureParameterfv;
+		if (glad_glTextureParameterfv) glad_glTextureParameterfv = lgl__glTrace_glTextureParameterfv;
+		lgl__glReal_glTextureParameteri = glad_glTextureParameteri;
+		if (glad_glTextureParameteri) glad_glTextureParameteri = lgl__glTrace_glTextureParameteri;
+		lgl__glReal_glTextureParameterIiv = glad_glTextureParameterIiv;
+		if (glad_glTextureParameterIiv) glad_glTextureParameterIiv = lgl__glTrace_glTextureParameterIiv;
+		lgl__glReal_glTextureParameterIuiv = glad_glTextureParameterIuiv;
+		if (glad_glTextureParameterIuiv) glad_glTextureParameterIuiv = lgl__glTrace_glTextureParameterIuiv;
+		lgl__glReal_glTextureParameteriv = glad_glTextureParameteriv;
+		if (glad_glTextureParameteriv) glad_glTextureParameteriv = lgl__glTrace_glTextureParameteriv;
+		lgl__glReal_glGenerateTextureMipmap = glad_glGenerateTextureMipmap;
+		if (glad_glGenerateTextureMipmap) glad_glGenerateTextureMipmap = lgl__glTrace_glGenerateTextureMipmap;
+		lgl__glReal_glBindTextureUnit = glad_glBindTextureUnit;
+		if (glad_glBindTextureUnit) glad_glBindTextureUnit = lgl__glTrace_glBindTextureUnit;
+		lgl__glReal_glGetTextureImage = glad_glGetTextureImage;
+		if (glad_glGetTextureImage) glad_glGetTextureImage = lgl__glTrace_glGetTextureImage;
+		lgl__glReal_glGetCompressedTextureImage = glad_glGetCompressedTextureImage;
+		if (glad_glGetCompressedTextureImage) glad_glGetCompressedTextureImage = lgl__glTrace_glGetCompressedTextureImage;
+		lgl__glReal_glGetTextureLevelParameterfv = glad_glGetTextureLevelParameterfv;
+		if (glad_glGetTextureLevelParameterfv) glad_glGetTextureLevelParameterfv = lgl__glTrace_glGetTextureLevelParameterfv;
+		lgl__glReal_glGetTextureLevelParameteriv = glad_glGetTextureLevelParameteriv;
+		if (glad_glGetTextureLevelParameteriv) glad_glGetTextureLevelParameteriv = lgl__glTrace_glGetTextureLevelParameteriv;
+		lgl__glReal_glGetTextureParameterfv = glad_glGetTextureParameterfv;
+		if (glad_glGetTextureParameterfv) glad_glGetTextureParameterfv = lgl__glTrace_glGetTextureParameterfv;
+		lgl__glReal_glGetTextureParameterIiv = glad_glGetTextureParameterIiv;
+		if (glad_glGetTextureParameterIiv) glad_glGetTextureParameterIiv = lgl__glTrace_glGetTextureParameterIiv;
+		lgl__glReal_glGetTextureParameterIuiv = glad_glGetTextureParameterIuiv;
+		if (glad_glGetTextureParameterIuiv) glad_glGetTextureParameterIuiv = lgl__glTrace_glGetTextureParameterIuiv;
+		lgl__glReal_glGetTextureParameteriv = glad_glGetTextureParameteriv;
+		if (glad_glGetTextureParameteriv) glad_glGetTextureParameteriv = lgl__glTrace_glGetTextureParameteriv;
+		lgl__glReal_glCreateVertexArrays = glad_glCreateVertexArrays;
+		if (glad_glCreateVertexArrays) glad_glCreateVertexArrays = lgl__glTrace_glCreateVertexArrays;
+		lgl__glReal_glDisableVertexArrayAttrib = glad_glDisableVertexArrayAttrib;
+		if (glad_glDisableVertexArrayAttrib) glad_glDisableVertexArrayAttrib = lgl__glTrace_glDisableVertexArrayAttrib;
+		lgl__glReal_glEnableVertexArrayAttrib = glad_glEnableVertexArrayAttrib;
+		if (glad_glEnableVertexArrayAttrib) glad_glEnableVertexArrayAttrib = lgl__glTrace_glEnableVertexArrayAttrib;
+		lgl__glReal_glVertexArrayElementBuffer = glad_glVertexArrayElementBuffer;
+		if (glad_glVertexArrayElementBuffer) glad_glVertexArrayElementBuffer = lgl__glTrace_glVertexArrayElementBuffer;
+		lgl__glReal_glVertexArrayVertexBuffer = glad_glVertexArrayVertexBuffer;
+		if (glad_glVertexArrayVertexBuffer) glad_glVertexArrayVertexBuffer = lgl__glTrace_glVertexArrayVertexBuffer;
+		lgl__glReal_glVertexArrayVertexBuffers = glad_glVertexArrayVertexBuffers;
+		if (glad_glVertexArrayVertexBuffers) glad_glVertexArrayVertexBuffers = lgl__glTrace_glVertexArrayVertexBuffers;
+		lgl__glReal_glVertexArrayAttribBinding = glad_glVertexArrayAttribBinding;
+		if (glad_glVertexArrayAttribBinding) glad_glVertexArrayAttribBinding = lgl__glTrace_glVertexArrayAttribBinding;
+		lgl__glReal_glVertexArrayAttribFormat = glad_glVertexArrayAttribFormat;
+		if (glad_glVertexArrayAttribFormat) glad_glVertexArrayAttribFormat = lgl__glTrace_glVertexArrayAttribFormat;
+		lgl__glReal_glVertexArrayAttribIFormat = glad_glVertexArrayAttribIFormat;
+		if (glad_glVertexArrayAttribIFormat) glad_glVertexArrayAttribIFormat = lgl__glTrace_glVertexArrayAttribIFormat;
+		lgl__glReal_glVertexArrayAttribLFormat = glad_glVertexArrayAttribLFormat;
+		if (glad_glVertexArrayAttribLFormat) glad_glVertexArrayAttribLFormat = lgl__glTrace_glVertexArrayAttribLFormat;
+		lgl__glReal_glVertexArrayBindingDivisor = glad_glVertexArrayBindingDivisor;
+		if (glad_glVertexArrayBindingDivisor) glad_glVertexArrayBindingDivisor = lgl__glTrace_glVertexArrayBindingDivisor;
+		lgl__glReal_glGetVertexArrayiv = glad_glGetVertexArrayiv;
+		if (glad_glGetVertexArrayiv) glad_glGetVertexArrayiv = lgl__glTrace_glGetVertexArrayiv;
+		lgl__glReal_glGetVertexArrayIndexediv = glad_glGetVertexArrayIndexediv;
+		if (glad_glGetVertexArrayIndexediv) glad_glGetVertexArrayIndexediv = lgl__glTrace_glGetVertexArrayIndexediv;
+		lgl__glReal_glGetVertexArrayIndexed64iv = glad_glGetVertexArrayIndexed64iv;
+		if (glad_glGetVertexArrayIndexed64iv) glad_glGetVertexArrayIndexed64iv = lgl__glTrace_glGetVertexArrayIndexed64iv;
+		lgl__glReal_glCreateSamplers = glad_glCreateSamplers;
+		if (glad_glCreateSamplers) glad_glCreateSamplers = lgl__glTrace_glCreateSamplers;
+		lgl__glReal_glCreateProgramPipelines = glad_glCreateProgramPipelines;
+		if (glad_glCreateProgramPipelines) glad_glCreateProgramPipelines = lgl__glTrace_glCreateProgramPipelines;
+		lgl__glReal_glCreateQueries = glad_glCreateQueries;
+		if (glad_glCreateQueries) glad_glCreateQueries = lgl__glTrace_glCreateQueries;
+		lgl__glReal_glGetQueryBufferObjecti64v = glad_glGetQueryBufferObjecti64v;
+		if (glad_glGetQueryBufferObjecti64v) glad_glGetQueryBufferObjecti64v = lgl__glTrace_glGetQueryBufferObjecti64v;
+		lgl__glReal_glGetQueryBufferObjectiv = glad_glGetQueryBufferObjectiv;
+		if (glad_glGetQueryBufferObjectiv) glad_glGetQueryBufferObjectiv = lgl__glTrace_glGetQueryBufferObjectiv;
+		lgl__glReal_glGetQueryBufferObjectui64v = glad_glGetQueryBufferObjectui64v;
+		if (glad_glGetQueryBufferObjectui64v) glad_glGetQueryBufferObjectui64v = lgl__glTrace_glGetQueryBufferObjectui64v;
+		lgl__glReal_glGetQueryBufferObjectuiv = glad_glGetQueryBufferObjectuiv;
+		if (glad_glGetQueryBufferObjectuiv) glad_glGetQueryBufferObjectuiv = lgl__glTrace_glGetQueryBufferObjectuiv;
+		lgl__glReal_glMemoryBarrierByRegion = glad_glMemoryBarrierByRegion;
+		if (glad_glMemoryBarrierByRegion) glad_glMemoryBarrierByRegion = lgl__glTrace_glMemoryBarrierByRegion;
+		lgl__glReal_glGetTextureSubImage = glad_glGetTextureSubImage;
+		if (glad_glGetTextureSubImage) glad_glGetTextureSubImage = lgl__glTrace_glGetTextureSubImage;
+		lgl__glReal_glGetCompressedTextureSubImage = glad_glGetCompressedTextureSubImage;
+		if (glad_glGetCompressedTextureSubImage) glad_glGetCompressedTextureSubImage = lgl__glTrace_glGetCompressedTextureSubImage;
+		lgl__glReal_glGetGraphicsResetStatus = glad_glGetGraphicsResetStatus;
+		if (glad_glGetGraphicsResetStatus) glad_glGetGraphicsResetStatus = lgl__glTrace_glGetGraphicsResetStatus;
+		lgl__glReal_glGetnCompressedTexImage = glad_glGetnCompressedTexImage;
+		if (glad_glGetnCompressedTexImage) glad_glGetnCompressedTexImage = lgl__glTrace_glGetnCompressedTexImage;
+		lgl__glReal_glGetnTexImage = glad_glGetnTexImage;
+		if (glad_glGetnTexImage) glad_glGetnTexImage = lgl__glTrace_glGetnTexImage;
+		lgl__glReal_glGetnUniformdv = glad_glGetnUniformdv;
+		if (glad_glGetnUniformdv) glad_glGetnUniformdv = lgl__glTrace_glGetnUniformdv;
+		lgl__glReal_glGetnUniformfv = glad_glGetnUniformfv;
+		if (glad_glGetnUniformfv) glad_glGetnUniformfv = lgl__glTrace_glGetnUniformfv;
+		lgl__glReal_glGetnUniformiv = glad_glGetnUniformiv;
+		if (glad_glGetnUniformiv) glad_glGetnUniformiv = lgl__glTrace_glGetnUniformiv;
+		lgl__glReal_glGetnUniformuiv = glad_glGetnUniformuiv;
+		if (glad_glGetnUniformuiv) glad_glGetnUniformuiv = lgl__glTrace_glGetnUniformuiv;
+		lgl__glReal_glReadnPixels = glad_glReadnPixels;
+		if (glad_glReadnPixels) glad_glReadnPixels = lgl__glTrace_glReadnPixels;
+		lgl__glReal_glGetnMapdv = glad_glGetnMapdv;
+		if (glad_glGetnMapdv) glad_glGetnMapdv = lgl__glTrace_glGetnMapdv;
+		lgl__glReal_glGetnMapfv = glad_glGetnMapfv;
+		if (glad_glGetnMapfv) glad_glGetnMapfv = lgl__glTrace_glGetnMapfv;
+		lgl__glReal_glGetnMapiv = glad_glGetnMapiv;
+		if (glad_glGetnMapiv) glad_glGetnMapiv = lgl__glTrace_glGetnMapiv;
+		lgl__glReal_glGetnPixelMapfv = glad_glGetnPixelMapfv;
+		if (glad_glGetnPixelMapfv) glad_glGetnPixelMapfv = lgl__glTrace_glGetnPixelMapfv;
+		lgl__glReal_glGetnPixelMapuiv = glad_glGetnPixelMapuiv;
+		if (glad_glGetnPixelMapuiv) glad_glGetnPixelMapuiv = lgl__glTrace_glGetnPixelMapuiv;
+		lgl__glReal_glGetnPixelMapusv = glad_glGetnPixelMapusv;
+		if (glad_glGetnPixelMapusv) glad_glGetnPixelMapusv = lgl__glTrace_glGetnPixelMapusv;
+		lgl__glReal_glGetnPolygonStipple = glad_glGetnPolygonStipple;
+		if (glad_glGetnPolygonStipple) glad_glGetnPolygonStipple = lgl__glTrace_glGetnPolygonStipple;
+		lgl__glReal_glGetnColorTable = glad_glGetnColorTable;
+		if (glad_glGetnColorTable) glad_glGetnColorTable = lgl__glTrace_glGetnColorTable;
+		lgl__glReal_glGetnConvolutionFilter = glad_glGetnConvolutionFilter;
+		if (glad_glGetnConvolutionFilter) glad_glGetnConvolutionFilter = lgl__glTrace_glGetnConvolutionFilter;
+		lgl__glReal_glGetnSeparableFilter = glad_glGetnSeparableFilter;
+		if (glad_glGetnSeparableFilter) glad_glGetnSeparableFilter = lgl__glTrace_glGetnSeparableFilter;
+		lgl__glReal_glGetnHistogram = glad_glGetnHistogram;
+		if (glad_glGetnHistogram) glad_glGetnHistogram = lgl__glTrace_glGetnHistogram;
+		lgl__glReal_glGetnMinmax = glad_glGetnMinmax;
+		if (glad_glGetnMinmax) glad_glGetnMinmax = lgl__glTrace_glGetnMinmax;
+		lgl__glReal_glTextureBarrier = glad_glTextureBarrier;
+		if (glad_glTextureBarrier) glad_glTextureBarrier = lgl__glTrace_glTextureBarrier;
+		lgl__glReal_glSpecializeShader = glad_glSpecializeShader;
+		if (glad_glSpecializeShader) glad_glSpecializeShader = lgl__glTrace_glSpecializeShader;
+		lgl__glReal_glMultiDrawArraysIndirectCount = glad_glMultiDrawArraysIndirectCount;
+		if (glad_glMultiDrawArraysIndirectCount) glad_glMultiDrawArraysIndirectCount = lgl__glTrace_glMultiDrawArraysIndirectCount;
+		lgl__glReal_glMultiDrawElementsIndirectCount = glad_glMultiDrawElementsIndirectCount;
+		if (glad_glMultiDrawElementsIndirectCount) glad_glMultiDrawElementsIndirectCount = lgl__glTrace_glMultiDrawElementsIndirectCount;
+		lgl__glReal_glPolygonOffsetClamp = glad_glPolygonOffsetClamp;
+		if (glad_glPolygonOffsetClamp) glad_glPolygonOffsetClamp = lgl__glTrace_glPolygonOffsetClamp;
+	} else {
+		if (glad_glCullFace == lgl__glTrace_glCullFace)
+			glad_glCullFace = lgl__glReal_glCullFace;
+		else if (glad_glCullFace != lgl__glReal_glCullFace)
+			left++;
+		if (glad_glFrontFace == lgl__glTrace_glFrontFace)
+			glad_glFrontFace = lgl__glReal_glFrontFace;
+		else if (glad_glFrontFace != lgl__glReal_glFrontFace)
+			left++;
+		if (glad_glHint == lgl__glTrace_glHint)
+			glad_glHint = lgl__glReal_glHint;
+		else if (glad_glHint != lgl__glReal_glHint)
+			left++;
+		if (glad_glLineWidth == lgl__glTrace_glLineWidth)
+			glad_glLineWidth = lgl__glReal_glLineWidth;
+		else if (glad_glLineWidth != lgl__glReal_glLineWidth)
+			left++;
+		if (glad_glPointSize == lgl__glTrace_glPointSize)
+			glad_glPointSize = lgl__glReal_glPointSize;
+		else if (glad_glPointSize != lgl__glReal_glPointSize)
+			left++;
+		if (glad_glPolygonMode == lgl__glTrace_glPolygonMode)
+			glad_glPolygonMode = lgl__glReal_glPolygonMode;
+		else if (glad_glPolygonMode != lgl__glReal_glPolygonMode)
+			left++;
+		if (glad_glScissor == lgl__glTrace_glScissor)
+			glad_glScissor = lgl__glReal_glScissor;
+		else if (glad_glScissor != lgl__glReal_glScissor)
+			left++;
+		if (glad_glTexParameterf == lgl__glTrace_glTexParameterf)
+			glad_glTexParameterf = lgl__glReal_glTexParameterf;
+		else if (glad_glTexParameterf != lgl__glReal_glTexParameterf)
+			left++;
+		if (glad_glTexParameterfv == lgl__glTrace_glTexParameterfv)
+			glad_glTexParameterfv = lgl__glReal_glTexParameterfv;
+		else if (glad_glTexParameterfv != lgl__glReal_glTexParameterfv)
+			left++;
+		if (glad_glTexParameteri == lgl__glTrace_glTexParameteri)
+			glad_glTexParameteri = lgl__glReal_glTexParameteri;
+		else if (glad_glTexParameteri != lgl__glReal_glTexParameteri)
+			left++;
+		if (glad_glTexParameteriv == lgl__glTrace_glTexParameteriv)
+			glad_glTexParameteriv = lgl__glReal_glTexParameteriv;
+		else if (glad_glTexParameteriv != lgl__glReal_glTexParameteriv)
+			left++;
+		if (glad_glTexImage1D == lgl__glTrace_glTexImage1D)
+			glad_glTexImage1D = lgl__glReal_glTexImage1D;
+		else if (glad_glTexImage1D != lgl__glReal_glTexImage1D)
+			left++;
+		if (glad_glTexImage2D == lgl__glTrace_glTexImage2D)
+			glad_glTexImage2D = lgl__glReal_glTexImage2D;
+		else if (glad_glTexImage2D != lgl__glReal_glTexImage2D)
+			left++;
+		if (glad_glDrawBuffer == lgl__glTrace_glDrawBuffer)
+			glad_glDrawBuffer = lgl__glReal_glDrawBuffer;
+		else if (glad_glDrawBuffer != lgl__glReal_glDrawBuffer)
+			left++;
+		if (glad_glClear == lgl__glTrace_glClear)
+			glad_glClear = lgl__glReal_glClear;
+		else if (glad_glClear != lgl__glReal_glClear)
+			left++;
+		if (glad_glClearColor == lgl__glTrace_glClearColor)
+			glad_glClearColor = lgl__glReal_glClearColor;
+		else if (glad_glClearColor != lgl__glReal_glClearColor)
+			left++;
+		if (glad_glClearStencil == lgl__glTrace_glClearStencil)
+			glad_glClearStencil = lgl__glReal_glClearStencil;
+		else if (glad_glClearStencil != lgl__glReal_glClearStencil)
+			left++;
+		if (glad_glClearDepth == lgl__glTrace_glClearDepth)
+			glad_glClearDepth = lgl__glReal_glClearDepth;
+		else if (glad_glClearDepth != lgl__glReal_glClearDepth)
+			left++;
+		if (glad_glStencilMask == lgl__glTrace_glStencilMask)
+			glad_glStencilMask = lgl__glReal_glStencilMask;
+		else if (glad_glStencilMask != lgl__glReal_glStencilMask)
+			left++;
+		if (glad_glColorMask == lgl__glTrace_glColorMask)
+			glad_glColorMask = lgl__glReal_glColorMask;
+		else if (glad_glColorMask != lgl__glReal_glColorMask)
+			left++;
+		if (glad_glDepthMask == lgl__glTrace_glDepthMask)
+			glad_glDepthMask = lgl__glReal_glDepthMask;
+		else if (glad_glDepthMask != lgl__glReal_glDepthMask)
+			left++;
+		if (glad_glDisable == lgl__glTrace_glDisable)
+			glad_glDisable = lgl__glReal_glDisable;
+		else if (glad_glDisable != lgl__glReal_glDisable)
+			left++;
+		if (glad_glEnable == lgl__glTrace_glEnable)
+			glad_glEnable = lgl__glReal_glEnable;
+		else if (glad_glEnable != lgl__glReal_glEnable)
+			left++;
+		if (glad_glFinish == lgl__glTrace_glFinish)
+			glad_glFinish = lgl__glReal_glFinish;
+		else if (glad_glFinish != lgl__glReal_glFinish)
+			left++;
+		if (glad_glFlush == lgl__glTrace_glFlush)
+			glad_glFlush = lgl__glReal_glFlush;
+		else if (glad_glFlush != lgl__glReal_glFlush)
+			left++;
+		if (glad_glBlendFunc == lgl__glTrace_glBlendFunc)
+			glad_glBlendFunc = lgl__glReal_glBlendFunc;
+		else if (glad_glBlendFunc != lgl__glReal_glBlendFunc)
+			left++;
+		if (glad_glLogicOp == lgl__glTrace_glLogicOp)
+			glad_glLogicOp = lgl__glReal_glLogicOp;
+		else if (glad_glLogicOp != lgl__glReal_glLogicOp)
+			left++;
+		if (glad_glStencilFunc == lgl__glTrace_glStencilFunc)
+			glad_glStencilFunc = lgl__glReal_glStencilFunc;
+		else if (glad_glStencilFunc != lgl__glReal_glStencilFunc)
+			left++;
+		if (glad_glStencilOp == lgl__glTrace_glStencilOp)
+			glad_glStencilOp = lgl__glReal_glStencilOp;
+		else if (glad_glStencilOp != lgl__glReal_glStencilOp)
+			left++;
+		if (glad_glDepthFunc == lgl__glTrace_glDepthFunc)
+			glad_glDepthFunc = lgl__glReal_glDepthFunc;
+		else if (glad_glDepthFunc != lgl__glReal_glDepthFunc)
+			left++;
+		if (glad_glPixelStoref == lgl__glTrace_glPixelStoref)
+			glad_glPixelStoref = lgl__glReal_glPixelStoref;
+		else if (glad_glPixelStoref != lgl__glReal_glPixelStoref)
+			left++;
+		if (glad_glPixelStorei == lgl__glTrace_glPixelStorei)
+			glad_glPixelStorei = lgl__glReal_glPixelStorei;
+		else if (glad_glPixelStorei != lgl__glReal_glPixelStorei)
+			left++;
+		if (glad_glReadBuffer == lgl__glTrace_glReadBuffer)
+			glad_glReadBuffer = lgl__glReal_glReadBuffer;
+		else if (glad_glReadBuffer != lgl__glReal_glReadBuffer)
+			left++;
+		if (glad_glReadPixels == lgl__glTrace_glReadPixels)
+			glad_glReadPixels = lgl__glReal_glReadPixels;
+		else if (glad_glReadPixels != lgl__glReal_glReadPixels)
+			left++;
+		if (glad_glGetBooleanv == lgl__glTrace_glGetBooleanv)
+			glad_glGetBooleanv = lgl__glReal_glGetBooleanv;
+		else if (glad_glGetBooleanv != lgl__glReal_glGetBooleanv)
+			left++;
+		if (glad_glGetDoublev == lgl__glTrace_glGetDoublev)
+			glad_glGetDoublev = lgl__glReal_glGetDoublev;
+		else if (glad_glGetDoublev != lgl__glReal_glGetDoublev)
+			left++;
+		if (glad_glGetError == lgl__glTrace_glGetError)
+			glad_glGetError = lgl__glReal_glGetError;
+		else if (glad_glGetError != lgl__glReal_glGetError)
+			left++;
+		if (glad_glGetFloatv == lgl__glTrace_glGetFloatv)
+			glad_glGetFloatv = lgl__glReal_glGetFloatv;
+		else if (glad_glGetFloatv != lgl__glReal_glGetFloatv)
+			left++;
+		if (glad_glGetIntegerv == lgl__glTrace_glGetIntegerv)
+			glad_glGetIntegerv = lgl__glReal_glGetIntegerv;
+		else if (glad_glGetIntegerv != lgl__glReal_glGetIntegerv)
+			left++;
+		if (glad_glGetString == lgl__glTrace_glGetString)
+			glad_glGetString = lgl__glReal_glGetString;
+		else if (glad_glGetString != lgl__glReal_glGetString)
+			left++;
+		if (glad_glGetTexImage == lgl__glTrace_glGetTexImage)
+			glad_glGetTexImage = lgl__glReal_glGetTexImage;
+		else if (glad_glGetTexImage != lgl__glReal_glGetTexImage)
+			left++;
+		if (glad_glGetTexParameterfv == lgl__glTrace_glGetTexParameterfv)
+			glad_glGetTexParameterfv = lgl__glReal_glGetTexParameterfv;
+		else if (glad_glGetTexParameterfv != lgl__glReal_glGetTexParameterfv)
+			left++;
+		if (glad_glGetTexParameteriv == lgl__glTrace_glGetTexParameteriv)
+			glad_glGetTexParameteriv = lgl__glReal_glGetTexParameteriv;
+		else if (glad_glGetTexParameteriv != lgl__glReal_glGetTexParameteriv)
+			left++;
+		if (glad_glGetTexLevelParameterfv == lgl__glTrace_glGetTexLevelParameterfv)
+			glad_glGetTexLevelParameterfv = lgl__glReal_glGetTexLevelParameterfv;
+		else if (glad_glGetTexLevelParameterfv != lgl__glReal_glGetTexLevelParameterfv)
+			left++;
+		if (glad_glGetTexLevelParameteriv == lgl__glTrace_glGetTexLevelParameteriv)
+			glad_glGetTexLevelParameteriv = lgl__glReal_glGetTexLevelParameteriv;
+		else if (glad_glGetTexLevelParameteriv != lgl__glReal_glGetTexLevelParameteriv)
+			left++;
+		if (glad_glIsEnabled == lgl__glTrace_glIsEnabled)
+			glad_glIsEnabled = lgl__glReal_glIsEnabled;
+		else if (glad_glIsEnabled != lgl__glReal_glIsEnabled)
+			left++;
+		if (glad_glDepthRange == lgl__glTrace_glDepthRange)
+			glad_glDepthRange = lgl__glReal_glDepthRange;
+		else if (glad_glDepthRange != lgl__glReal_glDepthRange)
+			left++;
+		if (glad_glViewport == lgl__glTrace_glViewport)
+			glad_glViewport = lgl__glReal_glViewport;
+		else if (glad_glViewport != lgl__glReal_glViewport)
+			left++;
+		if (glad_glDrawArrays == lgl__glTrace_glDrawArrays)
+			glad_glDrawArrays = lgl__glReal_glDrawArrays;
+		else if (glad_glDrawArrays != lgl__glReal_glDrawArrays)
+			left++;
+		if (glad_glDrawElements == lgl__glTrace_glDrawElements)
+			glad_glDrawElements = lgl__glReal_glDrawElements;
+		else if (glad_glDrawElements != lgl__glReal_glDrawElements)
+			left++;
+		if (glad_glPolygonOffset == lgl__glTrace_glPolygonOffset)
+			glad_glPolygonOffset = lgl__glReal_glPolygonOffset;
+		else if (glad_glPolygonOffset != lgl__glReal_glPolygonOffset)
+			left++;
+		if (glad_glCopyTexImage1D == lgl__glTrace_glCopyTexImage1D)
+			glad_glCopyTexImage1D = lgl__glReal_glCopyTexImage1D;
+		else if (glad_glCopyTexImage1D != lgl__glReal_glCopyTexImage1D)
+			left++;
+		if (glad_glCopyTexImage2D == lgl__glTrace_glCopyTexImage2D)
+			glad_glCopyTexImage2D = lgl__glReal_glCopyTexImage2D;
+		else if (glad_glCopyTexImage2D != lgl__glReal_glCopyTexImage2D)
+			left++;
+		if (glad_glCopyTexSubImage1D == lgl__glTrace_glCopyTexSubImage1D)
+			glad_glCopyTexSubImage1D = lgl__glReal_glCopyTexSubImage1D;
+		else if (glad_glCopyTexSubImage1D != lgl__glReal_glCopyTexSubImage1D)
+			left++;
+		if (glad_glCopyTexSubImage2D == lgl__glTrace_glCopyTexSubImage2D)
+			glad_glCopyTexSubImage2D = lgl__glReal_glCopyTexSubImage2D;
+		else if (glad_glCopyTexSubImage2D != lgl__glReal_glCopyTexSubImage2D)
+			left++;
+		if (glad_glTexSubImage1D == lgl__glTrace_glTexSubImage1D)
+			glad_glTexSubImage1D = lgl__glReal_glTexSubImage1D;
+		else if (glad_glTexSubImage1D != lgl__glReal_glTexSubImage1D)
+			left++;
+		if (glad_glTexSubImage2D == lgl__glTrace_glTexSubImage2D)
+			glad_glTexSubImage2D = lgl__glReal_glTexSubImage2D;
+		else if (glad_glTexSubImage2D != lgl__glReal_glTexSubImage2D)
+			left++;
+		if (glad_glBindTexture == lgl__glTrace_glBindTexture)
+			glad_glBindTexture = lgl__glReal_glBindTexture;
+		else if (glad_glBindTexture != lgl__glReal_glBindTexture)
+			left++;
+		if (glad_glDeleteTextures == lgl__glTrace_glDeleteTextures)
+			glad_glDeleteTextures = lgl__glReal_glDeleteTextures;
+		else if (glad_glDeleteTextures != lgl__glReal_glDeleteTextures)
+			left++;
+		if (glad_glGenTextures == lgl__glTrace_glGenTextures)
+			glad_glGenTextures = lgl__glReal_glGenTextures;
+		else if (glad_glGenTextures != lgl__glReal_glGenTextures)
+			left++;
+		if (glad_glIsTexture == lgl__glTrace_glIsTexture)
+			glad_glIsTexture = lgl__glReal_glIsTexture;
+		else if (glad_glIsTexture != lgl__glReal_glIsTexture)
+			left++;
+		if (glad_glDrawRangeElements == lgl__glTrace_glDrawRangeElements)
+			glad_glDrawRangeElements = lgl__glReal_glDrawRangeElements;
+		else if (glad_glDrawRangeElements != lgl__glReal_glDrawRangeElements)
+			left++;
+		if (glad_glTexImage3D == lgl__glTrace_glTexImage3D)
+			glad_glTexImage3D = lgl__glReal_glTexImage3D;
+		else if (glad_glTexImage3D != lgl__glReal_glTexImage3D)
+			left++;
+		if (glad_glTexSubImage3D == lgl__glTrace_glTexSubImage3D)
+			glad_glTexSubImage3D = lgl__glReal_glTexSubImage3D;
+		else if (glad_glTexSubImage3D != lgl__glReal_glTexSubImage3D)
+			left++;
+		if (glad_glCopyTexSubImage3D == lgl__glTrace_glCopyTexSubImage3D)
+			glad_glCopyTexSubImage3D = lgl__glReal_glCopyTexSubImage3D;
+		else if (glad_glCopyTexSubImage3D != lgl__glReal_glCopyTexSubImage3D)
+			left++;
+		if (glad_glActiveTexture == lgl__glTrace_glActiveTexture)
+			glad_glActiveTexture = lgl__glReal_glActiveTexture;
+		else if (glad_glActiveTexture != lgl__glReal_glActiveTexture)
+			left++;
+		if (glad_glSampleCoverage == lgl__glTrace_glSampleCoverage)
+			glad_glSampleCoverage = lgl__glReal_glSampleCoverage;
+		else if (glad_glSampleCoverage != lgl__glReal_glSampleCoverage)
+			left++;
+		if (glad_glCompressedTexImage3D == lgl__glTrace_glCompressedTexImage3D)
+			glad_glCompressedTexImage3D = lgl__glReal_glCompressedTexImage3D;
+		else if (glad_glCompressedTexImage3D != lgl__glReal_glCompressedTexImage3D)
+			left++;
+		if (glad_glCompressedTexImage2D == lgl__glTrace_glCompressedTexImage2D)
+			glad_glCompressedTexImage2D = lgl__glReal_glCompressedTexImage2D;
+		else if (glad_glCompressedTexImage2D != lgl__glReal_glCompressedTexImage2D)
+			left++;
+		if (glad_glCompressedTexImage1D == lgl__glTrace_glCompressedTexImage1D)
+			glad_glCompressedTexImage1D = lgl__glReal_glCompressedTexImage1D;
+		else if (glad_glCompressedTexImage1D != lgl__glReal_glCompressedTexImage1D)
+			left++;
+		if (glad_glCompressedTexSubImage3D == lgl__glTrace_glCompressedTexSubImage3D)
+			glad_glCompressedTexSubImage3D = lgl__glReal_glCompressedTexSubImage3D;
+		else if (glad_glCompressedTexSubImage3D != lgl__glReal_glCompressedTexSubImage3D)
+			left++;
+		if (glad_glCompressedTexSubImage2D == lgl__glTrace_glCompressedTexSubImage2D)
+			glad_glCompressedTexSubImage2D = lgl__glReal_glCompressedTexSubImage2D;
+		else if (glad_glCompressedTexSubImage2D != lgl__glReal_glCompressedTexSubImage2D)
+			left++;
+		if (glad_glCompressedTexSubImage1D == lgl__glTrace_glCompressedTexSubImage1D)
+			glad_glCompressedTexSubImage1D = lgl__glReal_glCompressedTexSubImage1D;
+		else if (glad_glCompressedTexSubImage1D != lgl__glReal_glCompressedTexSubImage1D)
+			left++;
+		if (glad_glGetCompressedTexImage == lgl__glTrace_glGetCompressedTexImage)
+			glad_glGetCompressedTexImage = lgl__glReal_glGetCompressedTexImage;
+		else if (glad_glGetCompressedTexImage != lgl__glReal_glGetCompressedTexImage)
+			left++;
+		if (glad_glBlendFuncSeparate == lgl__glTrace_glBlendFuncSeparate)
+			glad_glBlendFuncSeparate = lgl__glReal_glBlendFuncSeparate;
+		else if (glad_glBlendFuncSeparate != lgl__glReal_glBlendFuncSeparate)
+			left++;
+		if (glad_glMultiDrawArrays == lgl__glTrace_glMultiDrawArrays)
+			glad_glMultiDrawArrays = lgl__glReal_glMultiDrawArrays;
+		else if (glad_glMultiDrawArrays != lgl__glReal_glMultiDrawArrays)
+			left++;
+		if (glad_glMultiDrawElements == lgl__glTrace_glMultiDrawElements)
+			glad_glMultiDrawElements = lgl__glReal_glMultiDrawElements;
+		else if (glad_glMultiDrawElements != lgl__glReal_glMultiDrawElements)
+			left++;
+		if (glad_glPointParameterf == lgl__glTrace_glPointParameterf)
+			glad_glPointParameterf = lgl__glReal_glPointParameterf;
+		else if (glad_glPointParameterf != lgl__glReal_glPointParameterf)
+			left++;
+		if (glad_glPointParameterfv == lgl__glTrace_glPointParameterfv)
+			glad_glPointParameterfv = lgl__glReal_glPointParameterfv;
+		else if (glad_glPointParameterfv != lgl__glReal_glPointParameterfv)
+			left++;
+		if (glad_glPointParameteri == lgl__glTrace_glPointParameteri)
+			glad_glPointParameteri = lgl__glReal_glPointParameteri;
+		else if (glad_glPointParameteri != lgl__glReal_glPointParameteri)
+			left++;
+		if (glad_glPointParameteriv == lgl__glTrace_glPointParameteriv)
+			glad_glPointParameteriv = lgl__glReal_glPointParameteriv;
+		else if (glad_glPointParameteriv != lgl__glReal_glPointParameteriv)
+			left++;
+		if (glad_glBlendColor == lgl__glTrace_glBlendColor)
+			glad_glBlendColor = lgl__glReal_glBlendColor;
+		else if (glad_glBlendColor != lgl__glReal_glBlendColor)
+			left++;
+		if (glad_glBlendEquation == lgl__glTrace_glBlendEquation)
+			glad_glBlendEquation = lgl__glReal_glBlendEquation;
+		else if (glad_glBlendEquation != lgl__glReal_glBlendEquation)
+			left++;
+		if (glad_glGenQueries == lgl__glTrace_glGenQueries)
+			glad_glGenQueries = lgl__glReal_glGenQueries;
+		else if (glad_glGenQueries != lgl__glReal_glGenQueries)
+			left++;
+		if (glad_glDeleteQueries == lgl__glTrace_glDeleteQueries)
+			glad_glDeleteQueries = lgl__glReal_glDeleteQueries;
+		else if (glad_glDeleteQueries != lgl__glReal_glDeleteQueries)
+			left++;
+		if (glad_glIsQuery == lgl__glTrace_glIsQuery)
+			glad_glIsQuery = lgl__glReal_glIsQuery;
+		else if (glad_glIsQuery != lgl__glReal_glIsQuery)
+			left++;
+		if (glad_glBeginQuery == lgl__glTrace_glBeginQuery)
+			glad_glBeginQuery = lgl__glReal_glBeginQuery;
+		else if (glad_glBeginQuery != lgl__glReal_glBeginQuery)
+			left++;
+		if (glad_glEndQuery == lgl__glTrace_glEndQuery)
+			glad_glEndQuery = lgl__glReal_glEndQuery;
+		else if (glad_glEndQuery != lgl__glReal_glEndQuery)
+			left++;
+		if (glad_glGetQueryiv == lgl__glTrace_glGetQueryiv)
+			glad_glGetQueryiv = lgl__glReal_glGetQueryiv;
+		else if (glad_glGetQueryiv != lgl__glReal_glGetQueryiv)
+			left++;
+		if (glad_glGetQueryObjectiv == lgl__glTrace_glGetQueryObjectiv)
+			glad_glGetQueryObjectiv = lgl__glReal_glGetQueryObjectiv;
+		else if (glad_glGetQueryObjectiv != lgl__glReal_glGetQueryObjectiv)
+			left++;
+		if (glad_glGetQueryObjectuiv == lgl__glTrace_glGetQueryObjectuiv)
+			glad_glGetQueryObjectuiv = lgl__glReal_glGetQueryObjectuiv;
+		else if (glad_glGetQueryObjectuiv != lgl__glReal_glGetQueryObjectuiv)
+			left++;
+		if (glad_glBindBuffer == lgl__glTrace_glBindBuffer)
+			glad_glBindBuffer = lgl__glReal_glBindBuffer;
+		else if (glad_glBindBuffer != lgl__glReal_glBindBuffer)
+			left++;
+		if (glad_glDeleteBuffers == lgl__glTrace_glDeleteBuffers)
+			glad_glDeleteBuffers = lgl__glReal_glDeleteBuffers;
+		else if (glad_glDeleteBuffers != lgl__glReal_glDeleteBuffers)
+			left++;
+		if (glad_glGenBuffers == lgl__glTrace_glGenBuffers)
+			glad_glGenBuffers = lgl__glReal_glGenBuffers;
+		else if (glad_glGenBuffers != lgl__glReal_glGenBuffers)
+			left++;
+		if (glad_glIsBuffer == lgl__glTrace_glIsBuffer)
+			glad_glIsBuffer = lgl__glReal_glIsBuffer;
+		else if (glad_glIsBuffer != lgl__glReal_glIsBuffer)
+			left++;
+		if (glad_glBufferData == lgl__glTrace_glBufferData)
+			glad_glBufferData = lgl__glReal_glBufferData;
+		else if (glad_glBufferData != lgl__glReal_glBufferData)
+			left++;
+		if (glad_glBufferSubData == lgl__glTrace_glBufferSubData)
+			glad_glBufferSubData = lgl__glReal_glBufferSubData;
+		else if (glad_glBufferSubData != lgl__glReal_glBufferSubData)
+			left++;
+		if (glad_glGetBufferSubData == lgl__glTrace_glGetBufferSubData)
+			glad_glGetBufferSubData = lgl__glReal_glGetBufferSubData;
+		else if (glad_glGetBufferSubData != lgl__glReal_glGetBufferSubData)
+			left++;
+		if (glad_glMapBuffer == lgl__glTrace_glMapBuffer)
+			glad_glMapBuffer = lgl__glReal_glMapBuffer;
+		else if (glad_glMapBuffer != lgl__glReal_glMapBuffer)
+			left++;
+		if (glad_glUnmapBuffer == lgl__glTrace_glUnmapBuffer)
+			glad_glUnmapBuffer = lgl__glReal_glUnmapBuffer;
+		else if (glad_glUnmapBuffer != lgl__glReal_glUnmapBuffer)
+			left++;
+		if (glad_glGetBufferParameteriv == lgl__glTrace_glGetBufferParameteriv)
+			glad_glGetBufferParameteriv = lgl__glReal_glGetBufferParameteriv;
+		else if (glad_glGetBufferParameteriv != lgl__glReal_glGetBufferParameteriv)
+			left++;
+		if (glad_glGetBufferPointerv == lgl__glTrace_glGetBufferPointerv)
+			glad_glGetBufferPointerv = lgl__glReal_glGetBufferPointerv;
+		else if (glad_glGetBufferPointerv != lgl__glReal_glGetBufferPointerv)
+			left++;
+		if (glad_glBlendEquationSeparate == lgl__glTrace_glBlendEquationSeparate)
+			glad_glBlendEquationSeparate = lgl__glReal_glBlendEquationSeparate;
+		else if (glad_glBlendEquationSeparate != lgl__glReal_glBlendEquationSeparate)
+			left++;
+		if (glad_glDrawBuffers == lgl__glTrace_glDrawBuffers)
+			glad_glDrawBuffers = lgl__glReal_glDrawBuffers;
+		else if (glad_glDrawBuffers != lgl__glReal_glDrawBuffers)
+			left++;
+		if (glad_glStencilOpSeparate == lgl__glTrace_glStencilOpSeparate)
+			glad_glStencilOpSeparate = lgl__glReal_glStencilOpSeparate;
+		else if (glad_glStencilOpSeparate != lgl__glReal_glStencilOpSeparate)
+			left++;
+		if (glad_glStencilFuncSeparate == lgl__glTrace_glStencilFuncSeparate)
+			glad_glStencilFuncSeparate = lgl__glReal_glStencilFuncSeparate;
+		else if (glad_glStencilFuncSeparate != lgl__glReal_glStencilFuncSeparate)
+			left++;
+		if (glad_glStencilMaskSeparate == lgl__glTrace_glStencilMaskSeparate)
+			glad_glStencilMaskSeparate = lgl__glReal_glStencilMaskSeparate;
+		else if (glad_glStencilMaskSeparate != lgl__glReal_glStencilMaskSeparate)
+			left++;
+		if (glad_glAttachShader == lgl__glTrace_glAttachShader)
+			glad_glAttachShader = lgl__glReal_glAttachShader;
+		else if (glad_glAttachShader != lgl__glReal_glAttachShader)
+			left++;
+		if (glad_glBindAttribLocation == lgl__glTrace_glBindAttribLocation)
+			glad_glBindAttribLocation = lgl__glReal_glBindAttribLocation;
+		else if (glad_glBindAttribLocation != lgl__glReal_glBindAttribLocation)
+			left++;
+		if (glad_glCompileShader == lgl__glTrace_glCompileShader)
+			glad_glCompileShader = lgl__glReal_glCompileShader;
+		else if (glad_glCompileShader != lgl__glReal_glCompileShader)
+			left++;
+		if (glad_glCreateProgram == lgl__glTrace_glCreateProgram)
+			glad_glCreateProgram = lgl__glReal_glCreateProgram;
+		else if (glad_glCreateProgram != lgl__glReal_glCreateProgram)
+			left++;
+		if (glad_glCreateShader == lgl__glTrace_glCreateShader)
+			glad_glCreateShader = lgl__glReal_glCreateShader;
+		else if (glad_glCreateShader != lgl__glReal_glCreateShader)
+			left++;
+		if (glad_glDeleteProgram == lgl__glTrace_glDeleteProgram)
+			glad_glDeleteProgram = lgl__glReal_glDeleteProgram;
+		else if (glad_glDeleteProgram != lgl__glReal_glDeleteProgram)
+			left++;
+		if (glad_glDeleteShader == lgl__glTrace_glDeleteShader)
+			glad_glDeleteShader = lgl__glReal_glDeleteShader;
+		else if (glad_glDeleteShader != lgl__glReal_glDeleteShader)
+			left++;
+		if (glad_glDetachShader == lgl__glTrace_glDetachShader)
+			glad_glDetachShader = lgl__glReal_glDetachShader;
+		else if (glad_glDetachShader != lgl__glReal_glDetachShader)
+			left++;
+		if (glad_glDisableVertexAttribArray == lgl__glTrace_glDisableVertexAttribArray)
+			glad_glDisableVertexAttribArray = lgl__glReal_glDisableVertexAttribArray;
+		else if (glad_glDisableVertexAttribArray != lgl__glReal_glDisableVertexAttribArray)
+			left++;
+		if (glad_glEnableVertexAttribArray == lgl__glTrace_glEnableVertexAttribArray)
+			glad_glEnableVertexAttribArray = lgl__glReal_glEnableVertexAttribArray;
+		else if (glad_glEnableVertexAttribArray != lgl__glReal_glEnableVertexAttribArray)
+			left++;
+		if (glad_glGetActiveAttrib == lgl__glTrace_glGetActiveAttrib)
+			glad_glGetActiveAttrib = lgl__glReal_glGetActiveAttrib;
+		else if (glad_glGetActiveAttrib != lgl__glReal_glGetActiveAttrib)
+			left++;
+		if (glad_glGetActiveUniform == lgl__glTrace_glGetActiveUniform)
+			glad_glGetActiveUniform = lgl__glReal_glGetActiveUniform;
+		else if (glad_glGetActiveUniform != lgl__glReal_glGetActiveUniform)
+			left++;
+		if (glad_glGetAttachedShaders == lgl__glTrace_glGetAttachedShaders)
+			glad_glGetAttachedShaders = lgl__glReal_glGetAttachedShaders;
+		else if (glad_glGetAttachedShaders != lgl__glReal_glGetAttachedShaders)
+			left++;
+		if (glad_glGetAttribLocation == lgl__glTrace_glGetAttribLocation)
+			glad_glGetAttribLocation = lgl__glReal_glGetAttribLocation;
+		else if (glad_glGetAttribLocation != lgl__glReal_glGetAttribLocation)
+			left++;
+		if (glad_glGetProgramiv == lgl__glTrace_glGetProgramiv)
+			glad_glGetProgramiv = lgl__glReal_glGetProgramiv;
+		else if (glad_glGetProgramiv != lgl__glReal_glGetProgramiv)
+			left++;
+		if (glad_glGetProgramInfoLog == lgl__glTrace_glGetProgramInfoLog)
+			glad_glGetProgramInfoLog = lgl__glReal_glGetProgramInfoLog;
+		else if (glad_glGetProgramInfoLog != lgl__glReal_glGetProgramInfoLog)
+			left++;
+		if (glad_glGetShaderiv == lgl__glTrace_glGetShaderiv)
+			glad_glGetShaderiv = lgl__glReal_glGetShaderiv;
+		else if (glad_glGetShaderiv != lgl__glReal_glGetShaderiv)
+			left++;
+		if (glad_glGetShaderInfoLog == lgl__glTrace_glGetShaderInfoLog)
+			glad_glGetShaderInfoLog = lgl__glReal_glGetShaderInfoLog;
+		else if (glad_glGetShaderInfoLog != lgl__glReal_glGetShaderInfoLog)
+			left++;
+		if (glad_glGetShaderSource == lgl__glTrace_glGetShaderSource)
+			glad_glGetShaderSource = lgl__glReal_glGetShaderSource;
+		else if (glad_glGetShaderSource != lgl__glReal_glGetShaderSource)
+			left++;
+		if (glad_glGetUniformLocation == lgl__glTrace_glGetUniformLocation)
+			glad_glGetUniformLocation = lgl__glReal_glGetUniformLocation;
+		else if (glad_glGetUniformLocation != lgl__glReal_glGetUniformLocation)
+			left++;
+		if (glad_glGetUniformfv == lgl__glTrace_glGetUniformfv)
+			glad_glGetUniformfv = lgl__glReal_glGetUniformfv;
+		else if (glad_glGetUniformfv != lgl__glReal_glGetUniformfv)
+			left++;
+		if (glad_glGetUniformiv == lgl__glTrace_glGetUniformiv)
+			glad_glGetUniformiv = lgl__glReal_glGetUniformiv;
+		else if (glad_glGetUniformiv != lgl__glReal_glGetUniformiv)
+			left++;
+		if (glad_glGetVertexAttribdv == lgl__glTrace_glGetVertexAttribdv)
+			glad_glGetVertexAttribdv = lgl__glReal_glGetVertexAttribdv;
+		else if (glad_glGetVertexAttribdv != lgl__glReal_glGetVertexAttribdv)
+			left++;
+		if (glad_glGetVertexAttribfv == lgl__glTrace_glGetVertexAttribfv)
+			glad_glGetVertexAttribfv = lgl__glReal_glGetVertexAttribfv;
+		else if (glad_glGetVertexAttribfv != lgl__glReal_glGetVertexAttribfv)
+			left++;
+		if (glad_glGetVertexAttribiv == lgl__glTrace_glGetVertexAttribiv)
+			glad_glGetVertexAttribiv = lgl__glReal_glGetVertexAttribiv;
+		else if (glad_glGetVertexAttribiv != lgl__glReal_glGetVertexAttribiv)
+			left++;
+		if (glad_glGetVertexAttribPointerv == lgl__glTrace_glGetVertexAttribPointerv)
+			glad_glGetVertexAttribPointerv = lgl__glReal_glGetVertexAttribPointerv;
+		else if (glad_glGetVertexAttribPointerv != lgl__glReal_glGetVertexAttribPointerv)
+			left++;
+		if (glad_glIsProgram == lgl__glTrace_glIsProgram)
+			glad_glIsProgram = lgl__glReal_glIsProgram;
+		else if (glad_glIsProgram != lgl__glReal_glIsProgram)
+			left++;
+		if (glad_glIsShader == lgl__glTrace_glIsShader)
+			glad_glIsShader = lgl__glReal_glIsShader;
+		else if (glad_glIsShader != lgl__glReal_glIsShader)
+			left++;
+		if (glad_glLinkProgram == lgl__glTrace_glLinkProgram)
+			glad_glLinkProgram = lgl__glReal_glLinkProgram;
+		else if (glad_glLinkProgram != lgl__glReal_glLinkProgram)
+			left++;
+		if (glad_glShaderSource == lgl__glTrace_glShaderSource)
+			glad_glShaderSource = lgl__glReal_glShaderSource;
+		else if (glad_glShaderSource != lgl__glReal_glShaderSource)
+			left++;
+		if (glad_glUseProgram == lgl__glTrace_glUseProgram)
+			glad_glUseProgram = lgl__glReal_glUseProgram;
+		else if (glad_glUseProgram != lgl__glReal_glUseProgram)
+			left++;
+		if (glad_glUniform1f == lgl__glTrace_glUniform1f)
+			glad_glUniform1f = lgl__glReal_glUniform1f;
+		else if (glad_glUniform1f != lgl__glReal_glUniform1f)
+			left++;
+		if (glad_glUniform2f == lgl__glTrace_glUniform2f)
+			glad_glUniform2f = lgl__glReal_glUniform2f;
+		else if (glad_glUniform2f != lgl__glReal_glUniform2f)
+			left++;
+		if (glad_glUniform3f == lgl__glTrace_glUniform3f)
+			glad_glUniform3f = lgl__glReal_glUniform3f;
+		else if (glad_glUniform3f != lgl__glReal_glUniform3f)
+			left++;
+		if (glad_glUniform4f == lgl__glTrace_glUniform4f)
+			glad_glUniform4f = lgl__glReal_glUniform4f;
+		else if (glad_glUniform4f != lgl__glReal_glUniform4f)
+			left++;
+		if (glad_glUniform1i == lgl__glTrace_glUniform1i)
+			glad_glUniform1i = lgl__glReal_glUniform1i;
+		else if (glad_glUniform1i != lgl__glReal_glUniform1i)
+			left++;
+		if (glad_glUniform2i == lgl__glTrace_glUniform2i)
+			glad_glUniform2i = lgl__glReal_glUniform2i;
+		else if (glad_glUniform2i != lgl__glReal_glUniform2i)
+			left++;
+		if (glad_glUniform3i == lgl__glTrace_glUniform3i)
+			glad_glUniform3i = lgl__glReal_glUniform3i;
+		else if (glad_glUniform3i != lgl__glReal_glUniform3i)
+			left++;
+		if (glad_glUniform4i == lgl__glTrace_glUniform4i)
+			glad_glUniform4i = lgl__glReal_glUniform4i;
+		else if (glad_glUniform4i != lgl__glReal_glUniform4i)
+			left++;
+		if (glad_glUniform1fv == lgl__glTrace_glUniform1fv)
+			glad_glUniform1fv = lgl__glReal_glUniform1fv;
+		else if (glad_glUniform1fv != lgl__glReal_glUniform1fv)
+			left++;
+		if (glad_glUniform2fv == lgl__glTrace_glUniform2fv)
+			glad_glUniform2fv = lgl__glReal_glUniform2fv;
+		else if (glad_glUniform2fv != lgl__glReal_glUniform2fv)
+			left++;
+		if (glad_glUniform3fv == lgl__glTrace_glUniform3fv)
+			glad_glUniform3fv = lgl__glReal_glUniform3fv;
+		else if (glad_glUniform3fv != lgl__glReal_glUniform3fv)
+			left++;
+		if (glad_glUniform4fv == lgl__glTrace_glUniform4fv)
+			glad_glUniform4fv = lgl__glReal_glUniform4fv;
+		else if (glad_glUniform4fv != lgl__glReal_glUniform4fv)
+			left++;
+		if (glad_glUniform1iv == lgl__glTrace_glUniform1iv)
+			glad_glUniform1iv = lgl__glReal_glUniform1iv;
+		else if (glad_glUniform1iv != lgl__glReal_glUniform1iv)
+			left++;
+		if (glad_glUniform2iv == lgl__glTrace_glUniform2iv)
+			glad_glUniform2iv = lgl__glReal_glUniform2iv;
+		else if (glad_glUniform2iv != lgl__glReal_glUniform2iv)
+			left++;
+		if (glad_glUniform3iv == lgl__glTrace_glUniform3iv)
+			glad_glUniform3iv = lgl__glReal_glUniform3iv;
+		else if (glad_glUniform3iv != lgl__glReal_glUniform3iv)
+			left++;
+		if (glad_glUniform4iv == lgl__glTrace_glUniform4iv)
+			glad_glUniform4iv = lgl__glReal_glUniform4iv;
+		else if (glad_glUniform4iv != lgl__glReal_glUniform4iv)
+			left++;
+		if (glad_glUniformMatrix2fv == lgl__glTrace_glUniformMatrix2fv)
+			glad_glUniformMatrix2fv = lgl__glReal_glUniformMatrix2fv;
+		else if (glad_glUniformMatrix2fv != lgl__glReal_glUniformMatrix2fv)
+			left++;
+		if (glad_glUniformMatrix3fv == lgl__glTrace_glUniformMatrix3fv)
+			glad_glUniformMatrix3fv = lgl__glReal_glUniformMatrix3fv;
+		else if (glad_glUniformMatrix3fv != lgl__glReal_glUniformMatrix3fv)
+			left++;
+		if (glad_glUniformMatrix4fv == lgl__glTrace_glUniformMatrix4fv)
+			glad_glUniformMatrix4fv = lgl__glReal_glUniformMatrix4fv;
+		else if (glad_glUniformMatrix4fv != lgl__glReal_glUniformMatrix4fv)
+			left++;
+		if (glad_glValidateProgram == lgl__glTrace_glValidateProgram)
+			glad_glValidateProgram = lgl__glReal_glValidateProgram;
+		else if (glad_glValidateProgram != lgl__glReal_glValidateProgram)
+			left++;
+		if (glad_glVertexAttrib1d == lgl__glTrace_glVertexAttrib1d)
+			glad_glVertexAttrib1d = lgl__glReal_glVertexAttrib1d;
+		else if (glad_glVertexAttrib1d != lgl__glReal_glVertexAttrib1d)
+			left++;
+		if (glad_glVertexAttrib1dv == lgl__glTrace_glVertexAttrib1dv)
+			glad_glVertexAttrib1dv = lgl__glReal_glVertexAttrib1dv;
+		else if (glad_glVertexAttrib1dv != lgl__glReal_glVertexAttrib1dv)
+			left++;
+		if (glad_glVertexAttrib1f == lgl__glTrace_glVertexAttrib1f)
+			glad_glVertexAttrib1f = lgl__glReal_glVertexAttrib1f;
+		else if (glad_glVertexAttrib1f != lgl__glReal_glVertexAttrib1f)
+			left++;
+		if (glad_glVertexAttrib1fv == lgl__glTrace_glVertexAttrib1fv)
+			glad_glVertexAttrib1fv = lgl__glReal_glVertexAttrib1fv;
+		else if (glad_glVertexAttrib1fv != lgl__glReal_glVertexAttrib1fv)
+			left++;
+		if (glad_glVertexAttrib1s == lgl__glTrace_glVertexAttrib1s)
+			glad_glVertexAttrib1s = lgl__glReal_glVertexAttrib1s;
+		else if (glad_glVertexAttrib1s != lgl__glReal_glVertexAttrib1s)
+			left++;
+		if (glad_glVertexAttrib1sv == lgl__glTrace_glVertexAttrib1sv)
+			glad_glVertexAttrib1sv = lgl__glReal_glVertexAttrib1sv;
+		else if (glad_glVertexAttrib1sv != lgl__glReal_glVertexAttrib1sv)
+			left++;
+		if (glad_glVertexAttrib2d == lgl__glTrace_glVertexAttrib2d)
+			glad_glVertexAttrib2d = lgl__glReal_glVertexAttrib2d;
+		else if (glad_glVertexAttrib2d != lgl__glReal_glVertexAttrib2d)
+			left++;
+		if (glad_glVertexAttrib2dv == lgl__glTrace_glVertexAttrib2dv)
+			glad_glVertexAttrib2dv = lgl__glReal_glVertexAttrib2dv;
+		else if (glad_glVertexAttrib2dv != lgl__glReal_glVertexAttrib2dv)
+			left++;
+		if (glad_glVertexAttrib2f == lgl__glTrace_glVertexAttrib2f)
+			glad_glVertexAttrib2f = lgl__glReal_glVertexAttrib2f;
+		else if (glad_glVertexAttrib2f != lgl__glReal_glVertexAttrib2f)
+			left++;
+		if (glad_glVertexAttrib2fv == lgl__glTrace_glVertexAttrib2fv)
+			glad_glVertexAttrib2fv = lgl__glReal_glVertexAttrib2fv;
+		else if (glad_glVertexAttrib2fv != lgl__glReal_glVertexAttrib2fv)
+			left++;
+		if (glad_glVertexAttrib2s == lgl__glTrace_glVertexAttrib2s)
+			glad_glVertexAttrib2s = lgl__glReal_glVertexAttrib2s;
+		else if (glad_glVertexAttrib2s != lgl__glReal_glVertexAttrib2s)
+			left++;
+		if (glad_glVertexAttrib2sv == lgl__glTrace_glVertexAttrib2sv)
+			glad_glVertexAttrib2sv = lgl__glReal_glVertexAttrib2sv;
+		else if (glad_glVertexAttrib2sv != lgl__glReal_glVertexAttrib2sv)
+			left++;
+		if (glad_glVertexAttrib3d == lgl__glTrace_glVertexAttrib3d)
+			glad_glVertexAttrib3d = lgl__glReal_glVertexAttrib3d;
+		else if (glad_glVertexAttrib3d != lgl__glReal_glVertexAttrib3d)
+			left++;
+		if (glad_glVertexAttrib3dv == lgl__glTrace_glVertexAttrib3dv)
+			glad_glVertexAttrib3dv = lgl__glReal_glVertexAttrib3dv;
+		else if (glad_glVertexAttrib3dv != lgl__glReal_glVertexAttrib3dv)
+			left++;
+		if (glad_glVertexAttrib3f == lgl__glTrace_glVertexAttrib3f)
+			glad_glVertexAttrib3f = lgl__glReal_glVertexAttrib3f;
+		else if (glad_glVertexAttrib3f != lgl__glReal_glVertexAttrib3f)
+			left++;
+		if (glad_glVertexAttrib3fv == lgl__glTrace_glVertexAttrib3fv)
+			glad_glVertexAttrib3fv = lgl__glReal_glVertexAttrib3fv;
+		else if (glad_glVertexAttrib3fv != lgl__glReal_glVertexAttrib3fv)
+			left++;
+		if (glad_glVertexAttrib3s == lgl__glTrace_glVertexAttrib3s)
+			glad_glVertexAttrib3s = lgl__glReal_glVertexAttrib3s;
+		else if (glad_glVertexAttrib3s != lgl__glReal_glVertexAttrib3s)
+			left++;
+		if (glad_glVertexAttrib3sv == lgl__glTrace_glVertexAttrib3sv)
+			glad_glVertexAttrib3sv = lgl__glReal_glVertexAttrib3sv;
+		else if (glad_glVertexAttrib3sv != lgl__glReal_glVertexAttrib3sv)
+			left++;
+		if (glad_glVertexAttrib4Nbv == lgl__glTrace_glVertexAttrib4Nbv)
+			glad_glVertexAttrib4Nbv = lgl__glReal_glVertexAttrib4Nbv;
+		else if (glad_glVertexAttrib4Nbv != lgl__glReal_glVertexAttrib4Nbv)
+			left++;
+		if (glad_glVertexAttrib4Niv == lgl__glTrace_glVertexAttrib4Niv)
+			glad_glVertexAttrib4Niv = lgl__glReal_glVertexAttrib4Niv;
+		else if (glad_glVertexAttrib4Niv != lgl__glReal_glVertexAttrib4Niv)
+			left++;
+		if (glad_glVertexAttrib4Nsv == lgl__glTrace_glVertexAttrib4Nsv)
+			glad_glVertexAttrib4Nsv = lgl__glReal_glVertexAttrib4Nsv;
+		else if (glad_glVertexAttrib4Nsv != lgl__glReal_glVertexAttrib4Nsv)
+			left++;
+		if (glad_glVertexAttrib4Nub == lgl__glTrace_glVertexAttrib4Nub)
+			glad_glVertexAttrib4Nub = lgl__glReal_glVertexAttrib4Nub;
+		else if (glad_glVertexAttrib4Nub != lgl__glReal_glVertexAttrib4Nub)
+			left++;
+		if (glad_glVertexAttrib4Nubv == lgl__glTrace_glVertexAttrib4Nubv)
+			glad_glVertexAttrib4Nubv = lgl__glReal_glVertexAttrib4Nubv;
+		else if (glad_glVertexAttrib4Nubv != lgl__glReal_glVertexAttrib4Nubv)
+			left++;
+		if (glad_glVertexAttrib4Nuiv == lgl__glTrace_glVertexAttrib4Nuiv)
+			glad_glVertexAttrib4Nuiv = lgl__glReal_glVertexAttrib4Nuiv;
+		else if (glad_glVertexAttrib4Nuiv != lgl__glReal_glVertexAttrib4Nuiv)
+			left++;
+		if (glad_glVertexAttrib4Nusv == lgl__glTrace_glVertexAttrib4Nusv)
+			glad_glVertexAttrib4Nusv = lgl__glReal_glVertexAttrib4Nusv;
+		else if (glad_glVertexAttrib4Nusv != lgl__glReal_glVertexAttrib4Nusv)
+			left++;
+		if (glad_glVertexAttrib4bv == lgl__glTrace_glVertexAttrib4bv)
+			glad_glVertexAttrib4bv = lgl__glReal_glVertexAttrib4bv;
+		else if (glad_glVertexAttrib4bv != lgl__glReal_glVertexAttrib4bv)
+			left++;
+		if (glad_glVertexAttrib4d == lgl__glTrace_glVertexAttrib4d)
+			glad_glVertexAttrib4d = lgl__glReal_glVertexAttrib4d;
+		else if (glad_glVertexAttrib4d != lgl__glReal_glVertexAttrib4d)
+			left++;
+		if (glad_glVertexAttrib4dv == lgl__glTrace_glVertexAttrib4dv)
+			glad_glVertexAttrib4dv = lgl__glReal_glVertexAttrib4dv;
+		else if (glad_glVertexAttrib4dv != lgl__glReal_glVertexAttrib4dv)
+			left++;
+		if (glad_glVertexAttrib4f == lgl__glTrace_glVertexAttrib4f)
+			glad_glVertexAttrib4f = lgl__glReal_glVertexAttrib4f;
+		else if (glad_glVertexAttrib4f != lgl__glReal_glVertexAttrib4f)
+			left++;
+		if (glad_glVertexAttrib4fv == lgl__glTrace_glVertexAttrib4fv)
+			glad_glVertexAttrib4fv = lgl__glReal_glVertexAttrib4fv;
+		else if (glad_glVertexAttrib4fv != lgl__glReal_glVertexAttrib4fv)
+			left++;
+		if (glad_glVertexAttrib4iv == lgl__glTrace_glVertexAttrib4iv)
+			glad_glVertexAttrib4iv = lgl__glReal_glVertexAttrib4iv;
+		else if (glad_glVertexAttrib4iv != lgl__glReal_glVertexAttrib4iv)
+			left++;
+		if (glad_glVertexAttrib4s == lgl__glTrace_glVertexAttrib4s)
+			glad_glVertexAttrib4s = lgl__glReal_glVertexAttrib4s;
+		else if (glad_glVertexAttrib4s != lgl__glReal_glVertexAttrib4s)
+			left++;
+		if (glad_glVertexAttrib4sv == lgl__glTrace_glVertexAttrib4sv)
+			glad_glVertexAttrib4sv = lgl__glReal_glVertexAttrib4sv;
+		else if (glad_glVertexAttrib4sv != lgl__glReal_glVertexAttrib4sv)
+			left++;
+		if (glad_glVertexAttrib4ubv == lgl__glTrace_glVertexAttrib4ubv)
+			glad_glVertexAttrib4ubv = lgl__glReal_glVertexAttrib4ubv;
+		else if (glad_glVertexAttrib4ubv != lgl__glReal_glVertexAttrib4ubv)
+			left++;
+		if (glad_glVertexAttrib4uiv == lgl__glTrace_glVertexAttrib4uiv)
+			glad_glVertexAttrib4uiv = lgl__glReal_glVertexAttrib4uiv;
+		else if (glad_glVertexAttrib4uiv != lgl__glReal_glVertexAttrib4uiv)
+			left++;
+		if (glad_glVertexAttrib4usv == lgl__glTrace_glVertexAttrib4usv)
+			glad_glVertexAttrib4usv = lgl__glReal_glVertexAttrib4usv;
+		else if (glad_glVertexAttrib4usv != lgl__glReal_glVertexAttrib4usv)
+			left++;
+		if (glad_glVertexAttribPointer == lgl__glTrace_glVertexAttribPointer)
+			glad_glVertexAttribPointer = lgl__glReal_glVertexAttribPointer;
+		else if (glad_glVertexAttribPointer != lgl__glReal_glVertexAttribPointer)
+			left++;
+		if (glad_glUniformMatrix2x3fv == lgl__glTrace_glUniformMatrix2x3fv)
+			glad_glUniformMatrix2x3fv = lgl__glReal_glUniformMatrix2x3fv;
+		else if (glad_glUniformMatrix2x3fv != lgl__glReal_glUniformMatrix2x3fv)
+			left++;
+		if (glad_glUniformMatrix3x2fv == lgl__glTrace_glUniformMatrix3x2fv)
+			glad_glUniformMatrix3x2fv = lgl__glReal_glUniformMatrix3x2fv;
+		else if (glad_glUniformMatrix3x2fv != lgl__glReal_glUniformMatrix3x2fv)
+			left++;
+		if (glad_glUniformMatrix2x4fv == lgl__glTrace_glUniformMatrix2x4fv)
+			glad_glUniformMatrix2x4fv = lgl__glReal_glUniformMatrix2x4fv;
+		else if (glad_glUniformMatrix2x4fv != lgl__glReal_glUniformMatrix2x4fv)
+			left++;
+		if (glad_glUniformMatrix4x2fv == lgl__glTrace_glUniformMatrix4x2fv)
+			glad_glUniformMatrix4x2fv = lgl__glReal_glUniformMatrix4x2fv;
+		else if (glad_glUniformMatrix4x2fv != lgl__glReal_glUniformMatrix4x2fv)
+			left++;
+		if (glad_glUniformMatrix3x4fv == lgl__glTrace_glUniformMatrix3x4fv)
+			glad_glUniformMatrix3x4fv = lgl__glReal_glUniformMatrix3x4fv;
+		else if (glad_glUniformMatrix3x4fv != lgl__glReal_glUniformMatrix3x4fv)
+			left++;
+		if (glad_glUniformMatrix4x3fv == lgl__glTrace_glUniformMatrix4x3fv)
+			glad_glUniformMatrix4x3fv = lgl__glReal_glUniformMatrix4x3fv;
+		else if (glad_glUniformMatrix4x3fv != lgl__glReal_glUniformMatrix4x3fv)
+			left++;
+		if (glad_glColorMaski == lgl__glTrace_glColorMaski)
+			glad_glColorMaski = lgl__glReal_glColorMaski;
+		else if (glad_glColorMaski != lgl__glReal_glColorMaski)
+			left++;
+		if (glad_glGetBooleani_v == lgl__glTrace_glGetBooleani_v)
+			glad_glGetBooleani_v = lgl__glReal_glGetBooleani_v;
+		else if (glad_glGetBooleani_v != lgl__glReal_glGetBooleani_v)
+			left++;
+		if (glad_glGetIntegeri_v == lgl__glTrace_glGetIntegeri_v)
+			glad_glGetIntegeri_v = lgl__glReal_glGetIntegeri_v;
+		else if (glad_glGetIntegeri_v != lgl__glReal_glGetIntegeri_v)
+			left++;
+		if (glad_glEnablei == lgl__glTrace_glEnablei)
+			glad_glEnablei = lgl__glReal_glEnablei;
+		else if (glad_glEnablei != lgl__glReal_glEnablei)
+			left++;
+		if (glad_glDisablei == lgl__glTrace_glDisablei)
+			glad_glDisablei = lgl__glReal_glDisablei;
+		else if (glad_glDisablei != lgl__glReal_glDisablei)
+			left++;
+		if (glad_glIsEnabledi == lgl__glTrace_glIsEnabledi)
+			glad_glIsEnabledi = lgl__glReal_glIsEnabledi;
+		else if (glad_glIsEnabledi != lgl__glReal_glIsEnabledi)
+			left++;
+		if (glad_glBeginTransformFeedback == lgl__glTrace_glBeginTransformFeedback)
+			glad_glBeginTransformFeedback = lgl__glReal_glBeginTransformFeedback;
+		else if (glad_glBeginTransformFeedback != lgl__glReal_glBeginTransformFeedback)
+			left++;
+		if (glad_glEndTransformFeedback == lgl__glTrace_glEndTransformFeedback)
+			glad_glEndTransformFeedback = lgl__glReal_glEndTransformFeedback;
+		else if (glad_glEndTransformFeedback != lgl__glReal_glEndTransformFeedback)
+			left++;
+		if (glad_glBindBufferRange == lgl__glTrace_glBindBufferRange)
+			glad_glBindBufferRange = lgl__glReal_glBindBufferRange;
+		else if (glad_glBindBufferRange != lgl__glReal_glBindBufferRange)
+			left++;
+		if (glad_glBindBufferBase == lgl__glTrace_glBindBufferBase)
+			glad_glBindBufferBase = lgl__glReal_glBindBufferBase;
+		else if (glad_glBindBufferBase != lgl__glReal_glBindBufferBase)
+			left++;
+		if (glad_glTransformFeedbackVaryings == lgl__glTrace_glTransformFeedbackVaryings)
+			glad_glTransformFeedbackVaryings = lgl__glReal_glTransformFeedbackVaryings;
+		else if (glad_glTransformFeedbackVaryings != lgl__glReal_glTransformFeedbackVaryings)
+			left++;
+		if (glad_glGetTransformFeedbackVarying == lgl__glTrace_glGetTransformFeedbackVarying)
+			glad_glGetTransformFeedbackVarying = lgl__glReal_glGetTransformFeedbackVarying;
+		else if (glad_glGetTransformFeedbackVarying != lgl__glReal_glGetTransformFeedbackVarying)
+			left++;
+		if (glad_glClampColor == lgl__glTrace_glClampColor)
+			glad_glClampColor = lgl__glReal_glClampColor;
+		else if (glad_glClampColor != lgl__glReal_glClampColor)
+			left++;
+		if (glad_glBeginConditionalRender == lgl__glTrace_glBeginConditionalRender)
+			glad_glBeginConditionalRender = lgl__glReal_glBeginConditionalRender;
+		else if (glad_glBeginConditionalRender != lgl__glReal_glBeginConditionalRender)
+			left++;
+		if (glad_glEndConditionalRender == lgl__glTrace_glEndConditionalRender)
+			glad_glEndConditionalRender = lgl__glReal_glEndConditionalRender;
+		else if (glad_glEndConditionalRender != lgl__glReal_glEndConditionalRender)
+			left++;
+		if (glad_glVertexAttribIPointer == lgl__glTrace_glVertexAttribIPointer)
+			glad_glVertexAttribIPointer = lgl__glReal_glVertexAttribIPointer;
+		else if (glad_glVertexAttribIPointer != lgl__glReal_glVertexAttribIPointer)
+			left++;
+		if (glad_glGetVertexAttribIiv == lgl__glTrace_glGetVertexAttribIiv)
+			glad_glGetVertexAttribIiv = lgl__glReal_glGetVertexAttribIiv;
+		else if (glad_glGetVertexAttribIiv != lgl__glReal_glGetVertexAttribIiv)
+			left++;
+		if (glad_glGetVertexAttribIuiv == lgl__glTrace_glGetVertexAttribIuiv)
+			glad_glGetVertexAttribIuiv = lgl__glReal_glGetVertexAttribIuiv;
+		else if (glad_glGetVertexAttribIuiv != lgl__glReal_glGetVertexAttribIuiv)
+			left++;
+		if (glad_glVertexAttribI1i == lgl__glTrace_glVertexAttribI1i)
+			glad_glVertexAttribI1i = lgl__glReal_glVertexAttribI1i;
+		else if (glad_glVertexAttribI1i != lgl__glReal_glVertexAttribI1i)
+			left++;
+		if (glad_glVertexAttribI2i == lgl__glTrace_glVertexAttribI2i)
+			glad_glVertexAttribI2i = lgl__glReal_glVertexAttribI2i;
+		else if (glad_glVertexAttribI2i != lgl__glReal_glVertexAttribI2i)
+			left++;
+		if (glad_glVertexAttribI3i == lgl__glTrace_glVertexAttribI3i)
+			glad_glVertexAttribI3i = lgl__glReal_glVertexAttribI3i;
+		else if (glad_glVertexAttribI3i != lgl__glReal_glVertexAttribI3i)
+			left++;
+		if (glad_glVertexAttribI4i == lgl__glTrace_glVertexAttribI4i)
+			glad_glVertexAttribI4i = lgl__glReal_glVertexAttribI4i;
+		else if (glad_glVertexAttribI4i != lgl__glReal_glVertexAttribI4i)
+			left++;
+		if (glad_glVertexAttribI1ui == lgl__glTrace_glVertexAttribI1ui)
+			glad_glVertexAttribI1ui = lgl__glReal_glVertexAttribI1ui;
+		else if (glad_glVertexAttribI1ui != lgl__glReal_glVertexAttribI1ui)
+			left++;
+		if (glad_glVertexAttribI2ui == lgl__glTrace_glVertexAttribI2ui)
+			glad_glVertexAttribI2ui = lgl__glReal_glVertexAttribI2ui;
+		else if (glad_glVertexAttribI2ui != lgl__glReal_glVertexAttribI2ui)
+			left++;
+		if (glad_glVertexAttribI3ui == lgl__glTrace_glVertexAttribI3ui)
+			glad_glVertexAttribI3ui = lgl__glReal_glVertexAttribI3ui;
+		else if (glad_glVertexAttribI3ui != lgl__glReal_glVertexAttribI3ui)
+			left++;
+		if (glad_glVertexAttribI4ui == lgl__glTrace_glVertexAttribI4ui)
+			glad_glVertexAttribI4ui = lgl__glReal_glVertexAttribI4ui;
+		else if (glad_glVertexAttribI4ui != lgl__glReal_glVertexAttribI4ui)
+			left++;
+		if (glad_glVertexAttribI1iv == lgl__glTrace_glVertexAttribI1iv)
+			glad_glVertexAttribI1iv = lgl__glReal_glVertexAttribI1iv;
+		else if (glad_glVertexAttribI1iv != lgl__glReal_glVertexAttribI1iv)
+			left++;
+		if (glad_glVertexAttribI2iv == lgl__glTrace_glVertexAttribI2iv)
+			glad_glVertexAttribI2iv = lgl__glReal_glVertexAttribI2iv;
+		else if (glad_glVertexAttribI2iv != lgl__glReal_glVertexAttribI2iv)
+			left++;
+		if (glad_glVertexAttribI3iv == lgl__glTrace_glVertexAttribI3iv)
+			glad_glVertexAttribI3iv = lgl__glReal_glVertexAttribI3iv;
+		else if (glad_glVertexAttribI3iv != lgl__glReal_glVertexAttribI3iv)
+			left++;
+		if (glad_glVertexAttribI4iv == lgl__glTrace_glVertexAttribI4iv)
+			glad_glVertexAttribI4iv = lgl__glReal_glVertexAttribI4iv;
+		else if (glad_glVertexAttribI4iv != lgl__glReal_glVertexAttribI4iv)
+			left++;
+		if (glad_glVertexAttribI1uiv == lgl__glTrace_glVertexAttribI1uiv)
+			glad_glVertexAttribI1uiv = lgl__glReal_glVertexAttribI1uiv;
+		else if (glad_glVertexAttribI1uiv != lgl__glReal_glVertexAttribI1uiv)
+			left++;
+		if (glad_glVertexAttribI2uiv == lgl__glTrace_glVertexAttribI2uiv)
+			glad_glVertexAttribI2uiv = lgl__glReal_glVertexAttribI2uiv;
+		else if (glad_glVertexAttribI2uiv != lgl__glReal_glVertexAttribI2uiv)
+			left++;
+		if (glad_glVertexAttribI3uiv == lgl__glTrace_glVertexAttribI3uiv)
+			glad_glVertexAttribI3uiv = lgl__glReal_glVertexAttribI3uiv;
+		else if (glad_glVertexAttribI3uiv != lgl__glReal_glVertexAttribI3uiv)
+			left++;
+		if (glad_glVertexAttribI4uiv == lgl__glTrace_glVertexAttribI4uiv)
+			glad_glVertexAttribI4uiv = lgl__glReal_glVertexAttribI4uiv;
+		else if (glad_glVertexAttribI4uiv != lgl__glReal_glVertexAttribI4uiv)
+			left++;
+		if (glad_glVertexAttribI4bv == lgl__glTrace_glVertexAttribI4bv)
+			glad_glVertexAttribI4bv = lgl__glReal_glVertexAttribI4bv;
+		else if (glad_glVertexAttribI4bv != lgl__glReal_glVertexAttribI4bv)
+			left++;
+		if (glad_glVertexAttribI4sv == lgl__glTrace_glVertexAttribI4sv)
+			glad_glVertexAttribI4sv = lgl__glReal_glVertexAttribI4sv;
+		else if (glad_glVertexAttribI4sv != lgl__glReal_glVertexAttribI4sv)
+			left++;
+		if (glad_glVertexAttribI4ubv == lgl__glTrace_glVertexAttribI4ubv)
+			glad_glVertexAttribI4ubv = lgl__glReal_glVertexAttribI4ubv;
+		else if (glad_glVertexAttribI4ubv != lgl__glReal_glVertexAttribI4ubv)
+			left++;
+		if (glad_glVertexAttribI4usv == lgl__glTrace_glVertexAttribI4usv)
+			glad_glVertexAttribI4usv = lgl__glReal_glVertexAttribI4usv;
+		else if (glad_glVertexAttribI4usv != lgl__glReal_glVertexAttribI4usv)
+			left++;
+		if (glad_glGetUniformuiv == lgl__glTrace_glGetUniformuiv)
+			glad_glGetUniformuiv = lgl__glReal_glGetUniformuiv;
+		else if (glad_glGetUniformuiv != lgl__glReal_glGetUniformuiv)
+			left++;
+		if (glad_glBindFragDataLocation == lgl__glTrace_glBindFragDataLocation)
+			glad_glBindFragDataLocation = lgl__glReal_glBindFragDataLocation;
+		else if (glad_glBindFragDataLocation != lgl__glReal_glBindFragDataLocation)
+			left++;
+		if (glad_glGetFragDataLocation == lgl__glTrace_glGetFragDataLocation)
+			glad_glGetFragDataLocation = lgl__glReal_glGetFragDataLocation;
+		else if (glad_glGetFragDataLocation != lgl__glReal_glGetFragDataLocation)
+			left++;
+		if (glad_glUniform1ui == lgl__glTrace_glUniform1ui)
+			glad_glUniform1ui = lgl__glReal_glUniform1ui;
+		else if (glad_glUniform1ui != lgl__glReal_glUniform1ui)
+			left++;
+		if (glad_glUniform2ui == lgl__glTrace_glUniform2ui)
+			glad_glUniform2ui = lgl__glReal_glUniform2ui;
+		else if (glad_glUniform2ui != lgl__glReal_glUniform2ui)
+			left++;
+		if (glad_glUniform3ui == lgl__glTrace_glUniform3ui)
+			glad_glUniform3ui = lgl__glReal_glUniform3ui;
+		else if (glad_glUniform3ui != lgl__glReal_glUniform3ui)
+			left++;
+		if (glad_glUniform4ui == lgl__glTrace_glUniform4ui)
+			glad_glUniform4ui = lgl__glReal_glUniform4ui;
+		else if (glad_glUniform4ui != lgl__glReal_glUniform4ui)
+			left++;
+		if (glad_glUniform1uiv == lgl__glTrace_glUniform1uiv)
+			glad_glUniform1uiv = lgl__glReal_glUniform1uiv;
+		else if (glad_glUniform1uiv != lgl__glReal_glUniform1uiv)
+			left++;
+		if (glad_glUniform2uiv == lgl__glTrace_glUniform2uiv)
+			glad_glUniform2uiv = lgl__glReal_glUniform2uiv;
+		else if (glad_glUniform2uiv != lgl__glReal_glUniform2uiv)
+			left++;
+		if (glad_glUniform3uiv == lgl__glTrace_glUniform3uiv)
+			glad_glUniform3uiv = lgl__glReal_glUniform3uiv;
+		else if (glad_glUniform3uiv != lgl__glReal_glUniform3uiv)
+			left++;
+		if (glad_glUniform4uiv == lgl__glTrace_glUniform4uiv)
+			glad_glUniform4uiv = lgl__glReal_glUniform4uiv;
+		else if (glad_glUniform4uiv != lgl__glReal_glUniform4uiv)
+			left++;
+		if (glad_glTexParameterIiv == lgl__glTrace_glTexParameterIiv)
+			glad_glTexParameterIiv = lgl__glReal_glTexParameterIiv;
+		else if (glad_glTexParameterIiv != lgl__glReal_glTexParameterIiv)
+			left++;
+		if (glad_glTexParameterIuiv == lgl__glTrace_glTexParameterIuiv)
+			glad_glTexParameterIuiv = lgl__glReal_glTexParameterIuiv;
+		else if (glad_glTexParameterIuiv != lgl__glReal_glTexParameterIuiv)
+			left++;
+		if (glad_glGetTexParameterIiv == lgl__glTrace_glGetTexParameterIiv)
+			glad_glGetTexParameterIiv = lgl__glReal_glGetTexParameterIiv;
+		else if (glad_glGetTexParameterIiv != lgl__glReal_glGetTexParameterIiv)
+			left++;
+		if (glad_glGetTexParameterIuiv == lgl__glTrace_glGetTexParameterIuiv)
+			glad_glGetTexParameterIuiv = lgl__glReal_glGetTexParameterIuiv;
+		else if (glad_glGetTexParameterIuiv != lgl__glReal_glGetTexParameterIuiv)
+			left++;
+		if (glad_glClearBufferiv == lgl__glTrace_glClearBufferiv)
+			glad_glClearBufferiv = lgl__glReal_glClearBufferiv;
+		else if (glad_glClearBufferiv != lgl__glReal_glClearBufferiv)
+			left++;
+		if (glad_glClearBufferuiv == lgl__glTrace_glClearBufferuiv)
+			glad_glClearBufferuiv = lgl__glReal_glClearBufferuiv;
+		else if (glad_glClearBufferuiv != lgl__glReal_glClearBufferuiv)
+			left++;
+		if (glad_glClearBufferfv == lgl__glTrace_glClearBufferfv)
+			glad_glClearBufferfv = lgl__glReal_glClearBufferfv;
+		else if (glad_glClearBufferfv != lgl__glReal_glClearBufferfv)
+			left++;
+		if (glad_glClearBufferfi == lgl__glTrace_glClearBufferfi)
+			glad_glClearBufferfi = lgl__glReal_glClearBufferfi;
+		else if (glad_glClearBufferfi != lgl__glReal_glClearBufferfi)
+			left++;
+		if (glad_glGetStringi == lgl__glTrace_glGetStringi)
+			glad_glGetStringi = lgl__glReal_glGetStringi;
+		else if (glad_glGetStringi != lgl__glReal_glGetStringi)
+			left++;
+		if (glad_glIsRenderbuffer == lgl__glTrace_glIsRenderbuffer)
+			glad_glIsRenderbuffer = lgl__glReal_glIsRenderbuffer;
+		else if (glad_glIsRenderbuffer != lgl__glReal_glIsRenderbuffer)
+			left++;
+		if (glad_glBindRenderbuffer == lgl__glTrace_glBindRenderbuffer)
+			glad_glBindRenderbuffer = lgl__glReal_glBindRenderbuffer;
+		else if (glad_glBindRenderbuffer != lgl__glReal_glBindRenderbuffer)
+			left++;
+		if (glad_glDeleteRenderbuffers == lgl__glTrace_glDeleteRenderbuffers)
+			glad_glDeleteRenderbuffers = lgl__glReal_glDeleteRenderbuffers;
+		else if (glad_glDeleteRenderbuffers != lgl__glReal_glDeleteRenderbuffers)
+			left++;
+		if (glad_glGenRenderbuffers == lgl__glTrace_glGenRenderbuffers)
+			glad_glGenRenderbuffers = lgl__glReal_glGenRenderbuffers;
+		else if (glad_glGenRenderbuffers != lgl__glReal_glGenRenderbuffers)
+			left++;
+		if (glad_glRenderbufferStorage == lgl__glTrace_glRenderbufferStorage)
+			glad_glRenderbufferStorage = lgl__glReal_glRenderbufferStorage;
+		else if (glad_glRenderbufferStorage != lgl__glReal_glRenderbufferStorage)
+			left++;
+		if (glad_glGetRenderbufferParameteriv == lgl__glTrace_glGetRenderbufferParameteriv)
+			glad_glGetRenderbufferParameteriv = lgl__glReal_glGetRenderbufferParameteriv;
+		else if (glad_glGetRenderbufferParameteriv != lgl__glReal_glGetRenderbufferParameteriv)
+			left++;
+		if (glad_glIsFramebuffer == lgl__glTrace_glIsFramebuffer)
+			glad_glIsFramebuffer = lgl__glReal_glIsFramebuffer;
+		else if (glad_glIsFramebuffer != lgl__glReal_glIsFramebuffer)
+			left++;
+		if (glad_glBindFramebuffer == lgl__glTrace_glBindFramebuffer)
+			glad_glBindFramebuffer = lgl__glReal_glBindFramebuffer;
+		else if (glad_glBindFramebuffer != lgl__glReal_glBindFramebuffer)
+			left++;
+		if (glad_glDeleteFramebuffers == lgl__glTrace_glDeleteFramebuffers)
+			glad_glDeleteFramebuffers = lgl__glReal_glDeleteFramebuffers;
+		else if (glad_glDeleteFramebuffers != lgl__glReal_glDeleteFramebuffers)
+			left++;
+		if (glad_glGenFramebuffers == lgl__glTrace_glGenFramebuffers)
+			glad_glGenFramebuffers = lgl__glReal_glGenFramebuffers;
+		else if (glad_glGenFramebuffers != lgl__glReal_glGenFramebuffers)
+			left++;
+		if (glad_glCheckFramebufferStatus == lgl__glTrace_glCheckFramebufferStatus)
+			glad_glCheckFramebufferStatus = lgl__glReal_glCheckFramebufferStatus;
+		else if (glad_glCheckFramebufferStatus != lgl__glReal_glCheckFramebufferStatus)
+			left++;
+		if (glad_glFramebufferTexture1D == lgl__glTrace_glFramebufferTexture1D)
+			glad_glFramebufferTexture1D = lgl__glReal_glFramebufferTexture1D;
+		else if (glad_glFramebufferTexture1D != lgl__glReal_glFramebufferTexture1D)
+			left++;
+		if (glad_glFramebufferTexture2D == lgl__glTrace_glFramebufferTexture2D)
+			glad_glFramebufferTexture2D = lgl__glReal_glFramebufferTexture2D;
+		else if (glad_glFramebufferTexture2D != lgl__glReal_glFramebufferTexture2D)
+			left++;
+		if (glad_glFramebufferTexture3D == lgl__glTrace_glFramebufferTexture3D)
+			glad_glFramebufferTexture3D = lgl__glReal_glFramebufferTexture3D;
+		else if (glad_glFramebufferTexture3D != lgl__glReal_glFramebufferTexture3D)
+			left++;
+		if (glad_glFramebufferRenderbuffer == lgl__glTrace_glFramebufferRenderbuffer)
+			glad_glFramebufferRenderbuffer = lgl__glReal_glFramebufferRenderbuffer;
+		else if (glad_glFramebufferRenderbuffer != lgl__glReal_glFramebufferRenderbuffer)
+			left++;
+		if (glad_glGetFramebufferAttachmentParameteriv == lgl__glTrace_glGetFramebufferAttachmentParameteriv)
+			glad_glGetFramebufferAttachmentParameteriv = lgl__glReal_glGetFramebufferAttachmentParameteriv;
+		else if (glad_glGetFramebufferAttachmentParameteriv != lgl__glReal_glGetFramebufferAttachmentParameteriv)
+			left++;
+		if (glad_glGenerateMipmap == lgl__glTrace_glGenerateMipmap)
+			glad_glGenerateMipmap = lgl__glReal_glGenerateMipmap;
+		else if (glad_glGenerateMipmap != lgl__glReal_glGenerateMipmap)
+			left++;
+		if (glad_glBlitFramebuffer == lgl__glTrace_glBlitFramebuffer)
+			glad_glBlitFramebuffer = lgl__glReal_glBlitFramebuffer;
+		else if (glad_glBlitFramebuffer != lgl__glReal_glBlitFramebuffer)
+			left++;
+		if (glad_glRenderbufferStorageMultisample == lgl__glTrace_glRenderbufferStorageMultisample)
+			glad_glRenderbufferStorageMultisample = lgl__glReal_glRenderbufferStorageMultisample;
+		else if (glad_glRenderbufferStorageMultisample != lgl__glReal_glRenderbufferStorageMultisample)
+			left++;
+		if (glad_glFramebufferTextureLayer == lgl__glTrace_glFramebufferTextureLayer)
+			glad_glFramebufferTextureLayer = lgl__glReal_glFramebufferTextureLayer;
+		else if (glad_glFramebufferTextureLayer != lgl__glReal_glFramebufferTextureLayer)
+			left++;
+		if (glad_glMapBufferRange == lgl__glTrace_glMapBufferRange)
+			glad_glMapBufferRange = lgl__glReal_glMapBufferRange;
+		else if (glad_glMapBufferRange != lgl__glReal_glMapBufferRange)
+			left++;
+		if (glad_glFlushMappedBufferRange == lgl__glTrace_glFlushMappedBufferRange)
+			glad_glFlushMappedBufferRange = lgl__glReal_glFlushMappedBufferRange;
+		else if (glad_glFlushMappedBufferRange != lgl__glReal_glFlushMappedBufferRange)
+			left++;
+		if (glad_glBindVertexArray == lgl__glTrace_glBindVertexArray)
+			glad_glBindVertexArray = lgl__glReal_glBindVertexArray;
+		else if (glad_glBindVertexArray != lgl__glReal_glBindVertexArray)
+			left++;
+		if (glad_glDeleteVertexArrays == lgl__glTrace_glDeleteVertexArrays)
+			glad_glDeleteVertexArrays = lgl__glReal_glDeleteVertexArrays;
+		else if (glad_glDeleteVertexArrays != lgl__glReal_glDeleteVertexArrays)
+			left++;
+		if (glad_glGenVertexArrays == lgl__glTrace_glGenVertexArrays)
+			glad_glGenVertexArrays = lgl__glReal_glGenVertexArrays;
+		else if (glad_glGenVertexArrays != lgl__glReal_glGenVertexArrays)
+			left++;
+		if (glad_glIsVertexArray == lgl__glTrace_glIsVertexArray)
+			glad_glIsVertexArray = lgl__glReal_glIsVertexArray;
+		else if (glad_glIsVertexArray != lgl__glReal_glIsVertexArray)
+			left++;
+		if (glad_glDrawArraysInstanced == lgl__glTrace_glDrawArraysInstanced)
+			glad_glDrawArraysInstanced = lgl__glReal_glDrawArraysInstanced;
+		else if (glad_glDrawArraysInstanced != lgl__glReal_glDrawArraysInstanced)
+			left++;
+		if (glad_glDrawElementsInstanced == lgl__glTrace_glDrawElementsInstanced)
+			glad_glDrawElementsInstanced = lgl__glReal_glDrawElementsInstanced;
+		else if (glad_glDrawElementsInstanced != lgl__glReal_glDrawElementsInstanced)
+			left++;
+		if (glad_glTexBuffer == lgl__glTrace_glTexBuffer)
+			glad_glTexBuffer = lgl__glReal_glTexBuffer;
+		else if (glad_glTexBuffer != lgl__glReal_glTexBuffer)
+			left++;
+		if (glad_glPrimitiveRestartIndex == lgl__glTrace_glPrimitiveRestartIndex)
+			glad_glPrimitiveRestartIndex = lgl__glReal_glPrimitiveRestartIndex;
+		else if (glad_glPrimitiveRestartIndex != lgl__glReal_glPrimitiveRestartIndex)
+			left++;
+		if (glad_glCopyBufferSubData == lgl__glTrace_glCopyBufferSubData)
+			glad_glCopyBufferSubData = lgl__glReal_glCopyBufferSubData;
+		else if (glad_glCopyBufferSubData != lgl__glReal_glCopyBufferSubData)
+			left++;
+		if (glad_glGetUniformIndices == lgl__glTrace_glGetUniformIndices)
+			glad_glGetUniformIndices = lgl__glReal_glGetUniformIndices;
+		else if (glad_glGetUniformIndices != lgl__glReal_glGetUniformIndices)
+			left++;
+		if (glad_glGetActiveUniformsiv == lgl__glTrace_glGetActiveUniformsiv)
+			glad_glGetActiveUniformsiv = lgl__glReal_glGetActiveUniformsiv;
+		else if (glad_glGetActiveUniformsiv != lgl__glReal_glGetActiveUniformsiv)
+			left++;
+		if (glad_glGetActiveUniformName == lgl__glTrace_glGetActiveUniformName)
+			glad_glGetActiveUniformName = lgl__glReal_glGetActiveUniformName;
+		else if (glad_glGetActiveUniformName != lgl__glReal_glGetActiveUniformName)
+			left++;
+		if (glad_glGetUniformBlockIndex == lgl__glTrace_glGetUniformBlockIndex)
+			glad_glGetUniformBlockIndex = lgl__glReal_glGetUniformBlockIndex;
+		else if (glad_glGetUniformBlockIndex != lgl__glReal_glGetUniformBlockIndex)
+			left++;
+		if (glad_glGetActiveUniformBlockiv == lgl__glTrace_glGetActiveUniformBlockiv)
+			glad_glGetActiveUniformBlockiv = lgl__glReal_glGetActiveUniformBlockiv;
+		else if (glad_glGetActiveUniformBlockiv != lgl__glReal_glGetActiveUniformBlockiv)
+			left++;
+		if (glad_glGetActiveUniformBlockName == lgl__glTrace_glGetActiveUniformBlockName)
+			glad_glGetActiveUniformBlockName = lgl__glReal_glGetActiveUniformBlockName;
+		else if (glad_glGetActiveUniformBlockName != lgl__glReal_glGetActiveUniformBlockName)
+			left++;
+		if (glad_glUniformBlockBinding == lgl__glTrace_glUniformBlockBinding)
+			glad_glUniformBlockBinding = lgl__glReal_glUniformBlockBinding;
+		else if (glad_glUniformBlockBinding != lgl__glReal_glUniformBlockBinding)
+			left++;
+		if (glad_glDrawElementsBaseVertex == lgl__glTrace_glDrawElementsBaseVertex)
+			glad_glDrawElementsBaseVertex = lgl__glReal_glDrawElementsBaseVertex;
+		else if (glad_glDrawElementsBaseVertex != lgl__glReal_glDrawElementsBaseVertex)
+			left++;
+		if (glad_glDrawRangeElementsBaseVertex == lgl__glTrace_glDrawRangeElementsBaseVertex)
+			glad_glDrawRangeElementsBaseVertex = lgl__glReal_glDrawRangeElementsBaseVertex;
+		else if (glad_glDrawRangeElementsBaseVertex != lgl__glReal_glDrawRangeElementsBaseVertex)
+			left++;
+		if (glad_glDrawElementsInstancedBaseVertex == lgl__glTrace_glDrawElementsInstancedBaseVertex)
+			glad_glDrawElementsInstancedBaseVertex = lgl__glReal_glDrawElementsInstancedBaseVertex;
+		else if (glad_glDrawElementsInstancedBaseVertex != lgl__glReal_glDrawElementsInstancedBaseVertex)
+			left++;
+		if (glad_glMultiDrawElementsBaseVertex == lgl__glTrace_glMultiDrawElementsBaseVertex)
+			glad_glMultiDrawElementsBaseVertex = lgl__glReal_glMultiDrawElementsBaseVertex;
+		else if (glad_glMultiDrawElementsBaseVertex != lgl__glReal_glMultiDrawElementsBaseVertex)
+			left++;
+		if (glad_glProvokingVertex == lgl__glTrace_glProvokingVertex)
+			glad_glProvokingVertex = lgl__glReal_glProvokingVertex;
+		else if (glad_glProvokingVertex != lgl__glReal_glProvokingVertex)
+			left++;
+		if (glad_glFenceSync == lgl__glTrace_glFenceSync)
+			glad_glFenceSync = lgl__glReal_glFenceSync;
+		else if (glad_glFenceSync != lgl__glReal_glFenceSync)
+			left++;
+		if (glad_glIsSync == lgl__glTrace_glIsSync)
+			glad_glIsSync = lgl__glReal_glIsSync;
+		else if (glad_glIsSync != lgl__glReal_glIsSync)
+			left++;
+		if (glad_glDeleteSync == lgl__glTrace_glDeleteSync)
+			glad_glDeleteSync = lgl__glReal_glDeleteSync;
+		else if (glad_glDeleteSync != lgl__glReal_glDeleteSync)
+			left++;
+		if (glad_glClientWaitSync == lgl__glTrace_glClientWaitSync)
+			glad_glClientWaitSync = lgl__glReal_glClientWaitSync;
+		else if (glad_glClientWaitSync != lgl__glReal_glClientWaitSync)
+			left++;
+		if (glad_glWaitSync == lgl__glTrace_glWaitSync)
+			glad_glWaitSync = lgl__glReal_glWaitSync;
+		else if (glad_glWaitSync != lgl__glReal_glWaitSync)
+			left++;
+		if (glad_glGetInteger64v == lgl__glTrace_glGetInteger64v)
+			glad_glGetInteger64v = lgl__glReal_glGetInteger64v;
+		else if (glad_glGetInteger64v != lgl__glReal_glGetInteger64v)
+			left++;
+		if (glad_glGetSynciv == lgl__glTrace_glGetSynciv)
+			glad_glGetSynciv = lgl__glReal_glGetSynciv;
+		else if (glad_glGetSynciv != lgl__glReal_glGetSynciv)
+			left++;
+		if (glad_glGetInteger64i_v == lgl__glTrace_glGetInteger64i_v)
+			glad_glGetInteger64i_v = lgl__glReal_glGetInteger64i_v;
+		else if (glad_glGetInteger64i_v != lgl__glReal_glGetInteger64i_v)
+			left++;
+		if (glad_glGetBufferParameteri64v == lgl__glTrace_glGetBufferParameteri64v)
+			glad_glGetBufferParameteri64v = lgl__glReal_glGetBufferParameteri64v;
+		else if (glad_glGetBufferParameteri64v != lgl__glReal_glGetBufferParameteri64v)
+			left++;
+		if (glad_glFramebufferTexture == lgl__glTrace_glFramebufferTexture)
+			glad_glFramebufferTexture = lgl__glReal_glFramebufferTexture;
+		else if (glad_glFramebufferTexture != lgl__glReal_glFramebufferTexture)
+			left++;
+		if (glad_glTexImage2DMultisample == lgl__glTrace_glTexImage2DMultisample)
+			glad_glTexImage2DMultisample = lgl__glReal_glTexImage2DMultisample;
+		else if (glad_glTexImage2DMultisample != lgl__glReal_glTexImage2DMultisample)
+			left++;
+		if (glad_glTexImage3DMultisample == lgl__glTrace_glTexImage3DMultisample)
+			glad_glTexImage3DMultisample = lgl__glReal_glTexImage3DMultisample;
+		else if (glad_glTexImage3DMultisample != lgl__glReal_glTexImage3DMultisample)
+			left++;
+		if (glad_glGetMultisamplefv == lgl__glTrace_glGetMultisamplefv)
+			glad_glGetMultisamplefv = lgl__glReal_glGetMultisamplefv;
+		else if (glad_glGetMultisamplefv != lgl__glReal_glGetMultisamplefv)
+			left++;
+		if (glad_glSampleMaski == lgl__glTrace_glSampleMaski)
+			glad_glSampleMaski = lgl__glReal_glSampleMaski;
+		else if (glad_glSampleMaski != lgl__glReal_glSampleMaski)
+			left++;
+		if (glad_glBindFragDataLocationIndexed == lgl__glTrace_glBindFragDataLocationIndexed)
+			glad_glBindFragDataLocationIndexed = lgl__glReal_glBindFragDataLocationIndexed;
+		else if (glad_glBindFragDataLocationIndexed != lgl__glReal_glBindFragDataLocationIndexed)
+			left++;
+		if (glad_glGetFragDataIndex == lgl__glTrace_glGetFragDataIndex)
+			glad_glGetFragDataIndex = lgl__glReal_glGetFragDataIndex;
+		else if (glad_glGetFragDataIndex != lgl__glReal_glGetFragDataIndex)
+			left++;
+		if (glad_glGenSamplers == lgl__glTrace_glGenSamplers)
+			glad_glGenSamplers = lgl__glReal_glGenSamplers;
+		else if (glad_glGenSamplers != lgl__glReal_glGenSamplers)
+			left++;
+		if (glad_glDeleteSamplers == lgl__glTrace_glDeleteSamplers)
+			glad_glDeleteSamplers = lgl__glReal_glDeleteSamplers;
+		else if (glad_glDeleteSamplers != lgl__glReal_glDeleteSamplers)
+			left++;
+		if (glad_glIsSampler == lgl__glTrace_glIsSampler)
+			glad_glIsSampler = lgl__glReal_glIsSampler;
+		else if (glad_glIsSampler != lgl__glReal_glIsSampler)
+			left++;
+		if (glad_glBindSampler == lgl__glTrace_glBindSampler)
+			glad_glBindSampler = lgl__glReal_glBindSampler;
+		else if (glad_glBindSampler != lgl__glReal_glBindSampler)
+			left++;
+		if (glad_glSamplerParameteri == lgl__glTrace_glSamplerParameteri)
+			glad_glSamplerParameteri = lgl__glReal_glSamplerParameteri;
+		else if (glad_glSamplerParameteri != lgl__glReal_glSamplerParameteri)
+			left++;
+		if (glad_glSamplerParameteriv == lgl__glTrace_glSamplerParameteriv)
+			glad_glSamplerParameteriv = lgl__glReal_glSamplerParameteriv;
+		else if (glad_glSamplerParameteriv != lgl__glReal_glSamplerParameteriv)
+			left++;
+		if (glad_glSamplerParameterf == lgl__glTrace_glSamplerParameterf)
+			glad_glSamplerParameterf = lgl__glReal_glSamplerParameterf;
+		else if (glad_glSamplerParameterf != lgl__glReal_glSamplerParameterf)
+			left++;
+		if (glad_glSamplerParameterfv == lgl__glTrace_glSamplerParameterfv)
+			glad_glSamplerParameterfv = lgl__glReal_glSamplerParameterfv;
+		else if (glad_glSamplerParameterfv != lgl__glReal_glSamplerParameterfv)
+			left++;
+		if (glad_glSamplerParameterIiv == lgl__glTrace_glSamplerParameterIiv)
+			glad_glSamplerParameterIiv = lgl__glReal_glSamplerParameterIiv;
+		else if (glad_glSamplerParameterIiv != lgl__glReal_glSamplerParameterIiv)
+			left++;
+		if (glad_glSamplerParameterIuiv == lgl__glTrace_glSamplerParameterIuiv)
+			glad_glSamplerParameterIuiv = lgl__glReal_glSamplerParameterIuiv;
+		else if (glad_glSamplerParameterIuiv != lgl__glReal_glSamplerParameterIuiv)
+			left++;
+		if (glad_glGetSamplerParameteriv == lgl__glTrace_glGetSamplerParameteriv)
+			glad_glGetSamplerParameteriv = lgl__glReal_glGetSamplerParameteriv;
+		else if (glad_glGetSamplerParameteriv != lgl__glReal_glGetSamplerParameteriv)
+			left++;
+		if (glad_glGetSamplerParameterIiv == lgl__glTrace_glGetSamplerParameterIiv)
+			glad_glGetSamplerParameterIiv = lgl__glReal_glGetSamplerParameterIiv;
+		else if (glad_glGetSamplerParameterIiv != lgl__glReal_glGetSamplerParameterIiv)
+			left++;
+		if (glad_glGetSamplerParameterfv == lgl__glTrace_glGetSamplerParameterfv)
+			glad_glGetSamplerParameterfv = lgl__glReal_glGetSamplerParameterfv;
+		else if (glad_glGetSamplerParameterfv != lgl__glReal_glGetSamplerParameterfv)
+			left++;
+		if (glad_glGetSamplerParameterIuiv == lgl__glTrace_glGetSamplerParameterIuiv)
+			glad_glGetSamplerParameterIuiv = lgl__glReal_glGetSamplerParameterIuiv;
+		else if (glad_glGetSamplerParameterIuiv != lgl__glReal_glGetSamplerParameterIuiv)
+			left++;
+		if (glad_glQueryCounter == lgl__glTrace_glQueryCounter)
+			glad_glQueryCounter = lgl__glReal_glQueryCounter;
+		else if (glad_glQueryCounter != lgl__glReal_glQueryCounter)
+			left++;
+		if (glad_glGetQueryObjecti64v == lgl__glTrace_glGetQueryObjecti64v)
+			glad_glGetQueryObjecti64v = lgl__glReal_glGetQueryObjecti64v;
+		else if (glad_glGetQueryObjecti64v != lgl__glReal_glGetQueryObjecti64v)
+			left++;
+		if (glad_glGetQueryObjectui64v == lgl__glTrace_glGetQueryObjectui64v)
+			glad_glGetQueryObjectui64v = lgl__glReal_glGetQueryObjectui64v;
+		else if (glad_glGetQueryObjectui64v != lgl__glReal_glGetQueryObjectui64v)
+			left++;
+		if (glad_glVertexAttribDivisor == lgl__glTrace_glVertexAttribDivisor)
+			glad_glVertexAttribDivisor = lgl__glReal_glVertexAttribDivisor;
+		else if (glad_glVertexAttribDivisor != lgl__glReal_glVertexAttribDivisor)
+			left++;
+		if (glad_glVertexAttribP1ui == lgl__glTrace_glVertexAttribP1ui)
+			glad_glVertexAttribP1ui = lgl__glReal_glVertexAttribP1ui;
+		else if (glad_glVertexAttribP1ui != lgl__glReal_glVertexAttribP1ui)
+			left++;
+		if (glad_glVertexAttribP1uiv == lgl__glTrace_glVertexAttribP1uiv)
+			glad_glVertexAttribP1uiv = lgl__glReal_glVertexAttribP1uiv;
+		else if (glad_glVertexAttribP1uiv != lgl__glReal_glVertexAttribP1uiv)
+			left++;
+		if (glad_glVertexAttribP2ui == lgl__glTrace_glVertexAttribP2ui)
+			glad_glVertexAttribP2ui = lgl__glReal_glVertexAttribP2ui;
+		else if (glad_glVertexAttribP2ui != lgl__glReal_glVertexAttribP2ui)
+			left++;
+		if (glad_glVertexAttribP2uiv == lgl__glTrace_glVertexAttribP2uiv)
+			glad_glVertexAttribP2uiv = lgl__glReal_glVertexAttribP2uiv;
+		else if (glad_glVertexAttribP2uiv != lgl__glReal_glVertexAttribP2uiv)
+			left++;
+		if (glad_glVertexAttribP3ui == lgl__glTrace_glVertexAttribP3ui)
+			glad_glVertexAttribP3ui = lgl__glReal_glVertexAttribP3ui;
+		else if (glad_glVertexAttribP3ui != lgl__glReal_glVertexAttribP3ui)
+			left++;
+		if (glad_glVertexAttribP3uiv == lgl__glTrace_glVertexAttribP3uiv)
+			glad_glVertexAttribP3uiv = lgl__glReal_glVertexAttribP3uiv;
+		else if (glad_glVertexAttribP3uiv != lgl__glReal_glVertexAttribP3uiv)
+			left++;
+		if (glad_glVertexAttribP4ui == lgl__glTrace_glVertexAttribP4ui)
+			glad_glVertexAttribP4ui = lgl__glReal_glVertexAttribP4ui;
+		else if (glad_glVertexAttribP4ui != lgl__glReal_glVertexAttribP4ui)
+			left++;
+		if (glad_glVertexAttribP4uiv == lgl__glTrace_glVertexAttribP4uiv)
+			glad_glVertexAttribP4uiv = lgl__glReal_glVertexAttribP4uiv;
+		else if (glad_glVertexAttribP4uiv != lgl__glReal_glVertexAttribP4uiv)
+			left++;
+		if (glad_glVertexP2ui == lgl__glTrace_glVertexP2ui)
+			glad_glVertexP2ui = lgl__glReal_glVertexP2ui;
+		else if (glad_glVertexP2ui != lgl__glReal_glVertexP2ui)
+			left++;
+		if (glad_glVertexP2uiv == lgl__glTrace_glVertexP2uiv)
+			glad_glVertexP2uiv = lgl__glReal_glVertexP2uiv;
+		else if (glad_glVertexP2uiv != lgl__glReal_glVertexP2uiv)
+			left++;
+		if (glad_glVertexP3ui == lgl__glTrace_glVertexP3ui)
+			glad_glVertexP3ui = lgl__glReal_glVertexP3ui;
+		else if (glad_glVertexP3ui != lgl__glReal_glVertexP3ui)
+			left++;
+		if (glad_glVertexP3uiv == lgl__glTrace_glVertexP3uiv)
+			glad_glVertexP3uiv = lgl__glReal_glVertexP3uiv;
+		else if (glad_glVertexP3uiv != lgl__glReal_glVertexP3uiv)
+			left++;
+		if (glad_glVertexP4ui == lgl__glTrace_glVertexP4ui)
+			glad_glVertexP4ui = lgl__glReal_glVertexP4ui;
+		else if (glad_glVertexP4ui != lgl__glReal_glVertexP4ui)
+			left++;
+		if (glad_glVertexP4uiv == lgl__glTrace_glVertexP4uiv)
+			glad_glVertexP4uiv = lgl__glReal_glVertexP4uiv;
+		else if (glad_glVertexP4uiv != lgl__glReal_glVertexP4uiv)
+			left++;
+		if (glad_glTexCoordP1ui == lgl__glTrace_glTexCoordP1ui)
+			glad_glTexCoordP1ui = lgl__glReal_glTexCoordP1ui;
+		else if (glad_glTexCoordP1ui != lgl__glReal_glTexCoordP1ui)
+			left++;
+		if (glad_glTexCoordP1uiv == lgl__glTrace_glTexCoordP1uiv)
+			glad_glTexCoordP1uiv = lgl__glReal_glTexCoordP1uiv;
+		else if (glad_glTexCoordP1uiv != lgl__glReal_glTexCoordP1uiv)
+			left++;
+		if (glad_glTexCoordP2ui == lgl__glTrace_glTexCoordP2ui)
+			glad_glTexCoordP2ui = lgl__glReal_glTexCoordP2ui;
+		else if (glad_glTexCoordP2ui != lgl__glReal_glTexCoordP2ui)
+			left++;
+		if (glad_glTexCoordP2uiv == lgl__glTrace_glTexCoordP2uiv)
+			glad_glTexCoordP2uiv = lgl__glReal_glTexCoordP2uiv;
+		else if (glad_glTexCoordP2uiv != lgl__glReal_glTexCoordP2uiv)
+			left++;
+		if (glad_glTexCoordP3ui == lgl__glTrace_glTexCoordP3ui)
+			glad_glTexCoordP3ui = lgl__glReal_glTexCoordP3ui;
+		else if (glad_glTexCoordP3ui != lgl__glReal_glTexCoordP3ui)
+			left++;
+		if (glad_glTexCoordP3uiv == lgl__glTrace_glTexCoordP3uiv)
+			glad_glTexCoordP3uiv = lgl__glReal_glTexCoordP3uiv;
+		else if (glad_glTexCoordP3uiv != lgl__glReal_glTexCoordP3uiv)
+			left++;
+		if (glad_glTexCoordP4ui == lgl__glTrace_glTexCoordP4ui)
+			glad_glTexCoordP4ui = lgl__glReal_glTexCoordP4ui;
+		else if (glad_glTexCoordP4ui != lgl__glReal_glTexCoordP4ui)
+			left++;
+		if (glad_glTexCoordP4uiv == lgl__glTrace_glTexCoordP4uiv)
+			glad_glTexCoordP4uiv = lgl__glReal_glTexCoordP4uiv;
+		else if (glad_glTexCoordP4uiv != lgl__glReal_glTexCoordP4uiv)
+			left++;
+		if (glad_glMultiTexCoordP1ui == lgl__glTrace_glMultiTexCoordP1ui)
+			glad_glMultiTexCoordP1ui = lgl__glReal_glMultiTexCoordP1ui;
+		else if (glad_glMultiTexCoordP1ui != lgl__glReal_glMultiTexCoordP1ui)
+			left++;
+		if (glad_glMultiTexCoordP1uiv == lgl__glTrace_glMultiTexCoordP1uiv)
+			glad_glMultiTexCoordP1uiv = lgl__glReal_glMultiTexCoordP1uiv;
+		else if (glad_glMultiTexCoordP1uiv != lgl__glReal_glMultiTexCoordP1uiv)
+			left++;
+		if (glad_glMultiTexCoordP2ui == lgl__glTrace_glMultiTexCoordP2ui)
+			glad_glMultiTexCoordP2ui = lgl__glReal_glMultiTexCoordP2ui;
+		else if (glad_glMultiTexCoordP2ui != lgl__glReal_glMultiTexCoordP2ui)
+			left++;
+		if (glad_glMultiTexCoordP2uiv == lgl__glTrace_glMultiTexCoordP2uiv)
+			glad_glMultiTexCoordP2uiv = lgl__glReal_glMultiTexCoordP2uiv;
+		else if (glad_glMultiTexCoordP2uiv != lgl__glReal_glMultiTexCoordP2uiv)
+			left++;
+		if (glad_glMultiTexCoordP3ui == lgl__glTrace_glMultiTexCoordP3ui)
+			glad_glMultiTexCoordP3ui = lgl__glReal_glMultiTexCoordP3ui;
+		else if (glad_glMultiTexCoordP3ui != lgl__glReal_glMultiTexCoordP3ui)
+			left++;
+		if (glad_glMultiTexCoordP3uiv == lgl__glTrace_glMultiTexCoordP3uiv)
+			glad_glMultiTexCoordP3uiv = lgl__glReal_glMultiTexCoordP3uiv;
+		else if (glad_glMultiTexCoordP3uiv != lgl__glReal_glMultiTexCoordP3uiv)
+			left++;
+		if (glad_glMultiTexCoordP4ui == lgl__glTrace_glMultiTexCoordP4ui)
+			glad_glMultiTexCoordP4ui = lgl__glReal_glMultiTexCoordP4ui;
+		else if (glad_glMultiTexCoordP4ui != lgl__glReal_glMultiTexCoordP4ui)
+			left++;
+		if (glad_glMultiTexCoordP4uiv == lgl__glTrace_glMultiTexCoordP4uiv)
+			glad_glMultiTexCoordP4uiv = lgl__glReal_glMultiTexCoordP4uiv;
+		else if (glad_glMultiTexCoordP4uiv != lgl__glReal_glMultiTexCoordP4uiv)
+			left++;
+		if (glad_glNormalP3ui == lgl__glTrace_glNormalP3ui)
+			glad_glNormalP3ui = lgl__glReal_glNormalP3ui;
+		else if (glad_glNormalP3ui != lgl__glReal_glNormalP3ui)
+			left++;
+		if (glad_glNormalP3uiv == lgl__glTrace_glNormalP3uiv)
+			glad_glNormalP3uiv = lgl__glReal_glNormalP3uiv;
+		else if (glad_glNormalP3uiv != lgl__glReal_glNormalP3uiv)
+			left++;
+		if (glad_glColorP3ui == lgl__glTrace_glColorP3ui)
+			glad_glColorP3ui = lgl__glReal_glColorP3ui;
+		else if (glad_glColorP3ui != lgl__glReal_glColorP3ui)
+			left++;
+		if (glad_glColorP3uiv == lgl__glTrace_glColorP3uiv)
+			glad_glColorP3uiv = lgl__glReal_glColorP3uiv;
+		else if (glad_glColorP3uiv != lgl__glReal_glColorP3uiv)
+			left++;
+		if (glad_glColorP4ui == lgl__glTrace_glColorP4ui)
+			glad_glColorP4ui = lgl__glReal_glColorP4ui;
+		else if (glad_glColorP4ui != lgl__glReal_glColorP4ui)
+			left++;
+		if (glad_glColorP4uiv == lgl__glTrace_glColorP4uiv)
+			glad_glColorP4uiv = lgl__glReal_glColorP4uiv;
+		else if (glad_glColorP4uiv != lgl__glReal_glColorP4uiv)
+			left++;
+		if (glad_glSecondaryColorP3ui == lgl__glTrace_glSecondaryColorP3ui)
+			glad_glSecondaryColorP3ui = lgl__glReal_glSecondaryColorP3ui;
+		else if (glad_glSecondaryColorP3ui != lgl__glReal_glSecondaryColorP3ui)
+			left++;
+		if (glad_glSecondaryColorP3uiv == lgl__glTrace_glSecondaryColorP3uiv)
+			glad_glSecondaryColorP3uiv = lgl__glReal_glSecondaryColorP3uiv;
+		else if (glad_glSecondaryColorP3uiv != lgl__glReal_glSecondaryColorP3uiv)
+			left++;
+		if (glad_glMinSampleShading == lgl__glTrace_glMinSampleShading)
+			glad_glMinSampleShading = lgl__glReal_glMinSampleShading;
+		else if (glad_glMinSampleShading != lgl__glReal_glMinSampleShading)
+			left++;
+		if (glad_glBlendEquationi == lgl__glTrace_glBlendEquationi)
+			glad_glBlendEquationi = lgl__glReal_glBlendEquationi;
+		else if (glad_glBlendEquationi != lgl__glReal_glBlendEquationi)
+			left++;
+		if (glad_glBlendEquationSeparatei == lgl__glTrace_glBlendEquationSeparatei)
+			glad_glBlendEquationSeparatei = lgl__glReal_glBlendEquationSeparatei;
+		else if (glad_glBlendEquationSeparatei != lgl__glReal_glBlendEquationSeparatei)
+			left++;
+		if (glad_glBlendFunci == lgl__glTrace_glBlendFunci)
+			glad_glBlendFunci = lgl__glReal_glBlendFunci;
+		else if (glad_glBlendFunci != lgl__glReal_glBlendFunci)
+			left++;
+		if (glad_glBlendFuncSeparatei == lgl__glTrace_glBlendFuncSeparatei)
+			glad_glBlendFuncSeparatei = lgl__glReal_glBlendFuncSeparatei;
+		else if (glad_glBlendFuncSeparatei != lgl__glReal_glBlendFuncSeparatei)
+			left++;
+		if (glad_glDrawArraysIndirect == lgl__glTrace_glDrawArraysIndirect)
+			glad_glDrawArraysIndirect = lgl__glReal_glDrawArraysIndirect;
+		else if (glad_glDrawArraysIndirect != lgl__glReal_glDrawArraysIndirect)
+			left++;
+		if (glad_glDrawElementsIndirect == lgl__glTrace_glDrawElementsIndirect)
+			glad_glDrawElementsIndirect = lgl__glReal_glDrawElementsIndirect;
+		else if (glad_glDrawElementsIndirect != lgl__glReal_glDrawElementsIndirect)
+			left++;
+		if (glad_glUniform1d == lgl__glTrace_glUniform1d)
+			glad_glUniform1d = lgl__glReal_glUniform1d;
+		else if (glad_glUniform1d != lgl__glReal_glUniform1d)
+			left++;
+		if (glad_glUniform2d == lgl__glTrace_glUniform2d)
+			glad_glUniform2d = lgl__glReal_glUniform2d;
+		else if (glad_glUniform2d != lgl__glReal_glUniform2d)
+			left++;
+		if (glad_glUniform3d == lgl__glTrace_glUniform3d)
+			glad_glUniform3d = lgl__glReal_glUniform3d;
+		else if (glad_glUniform3d != lgl__glReal_glUniform3d)
+			left++;
+		if (glad_glUniform4d == lgl__glTrace_glUniform4d)
+			glad_glUniform4d = lgl__glReal_glUniform4d;
+		else if (glad_glUniform4d != lgl__glReal_glUniform4d)
+			left++;
+		if (glad_glUniform1dv == lgl__glTrace_glUniform1dv)
+			glad_glUniform1dv = lgl__glReal_glUniform1dv;
+		else if (glad_glUniform1dv != lgl__glReal_glUniform1dv)
+			left++;
+		if (glad_glUniform2dv == lgl__glTrace_glUniform2dv)
+			glad_glUniform2dv = lgl__glReal_glUniform2dv;
+		else if (glad_glUniform2dv != lgl__glReal_glUniform2dv)
+			left++;
+		if (glad_glUniform3dv == lgl__glTrace_glUniform3dv)
+			glad_glUniform3dv = lgl__glReal_glUniform3dv;
+		else if (glad_glUniform3dv != lgl__glReal_glUniform3dv)
+			left++;
+		if (glad_glUniform4dv == lgl__glTrace_glUniform4dv)
+			glad_glUniform4dv = lgl__glReal_glUniform4dv;
+		else if (glad_glUniform4dv != lgl__glReal_glUniform4dv)
+			left++;
+		if (glad_glUniformMatrix2dv == lgl__glTrace_glUniformMatrix2dv)
+			glad_glUniformMatrix2dv = lgl__glReal_glUniformMatrix2dv;
+		else if (glad_glUniformMatrix2dv != lgl__glReal_glUniformMatrix2dv)
+			left++;
+		if (glad_glUniformMatrix3dv == lgl__glTrace_glUniformMatrix3dv)
+			glad_glUniformMatrix3dv = lgl__glReal_glUniformMatrix3dv;
+		else if (glad_glUniformMatrix3dv != lgl__glReal_glUniformMatrix3dv)
+			left++;
+		if (glad_glUniformMatrix4dv == lgl__glTrace_glUniformMatrix4dv)
+			glad_glUniformMatrix4dv = lgl__glReal_glUniformMatrix4dv;
+		else if (glad_glUniformMatrix4dv != lgl__glReal_glUniformMatrix4dv)
+			left++;
+		if (glad_glUniformMatrix2x3dv == lgl__glTrace_glUniformMatrix2x3dv)
+			glad_glUniformMatrix2x3dv = lgl__glReal_glUniformMatrix2x3dv;
+		else if (glad_glUniformMatrix2x3dv != lgl__glReal_glUniformMatrix2x3dv)
+			left++;
+		if (glad_glUniformMatrix2x4dv == lgl__glTrace_glUniformMatrix2x4dv)
+			glad_glUniformMatrix2x4dv = lgl__glReal_glUniformMatrix2x4dv;
+		else if (glad_glUniformMatrix2x4dv != lgl__glReal_glUniformMatrix2x4dv)
+			left++;
+		if (glad_glUniformMatrix3x2dv == lgl__glTrace_glUniformMatrix3x2dv)
+			glad_glUniformMatrix3x2dv = lgl__glReal_glUniformMatrix3x2dv;
+		else if (glad_glUniformMatrix3x2dv != lgl__glReal_glUniformMatrix3x2dv)
+			left++;
+		if (glad_glUniformMatrix3x4dv == lgl__glTrace_glUniformMatrix3x4dv)
+			glad_glUniformMatrix3x4dv = lgl__glReal_glUniformMatrix3x4dv;
+		else if (glad_glUniformMatrix3x4dv != lgl__glReal_glUniformMatrix3x4dv)
+			left++;
+		if (glad_glUniformMatrix4x2dv == lgl__glTrace_glUniformMatrix4x2dv)
+			glad_glUniformMatrix4x2dv = lgl__glReal_glUniformMatrix4x2dv;
+		else if (glad_glUniformMatrix4x2dv != lgl__glReal_glUniformMatrix4x2dv)
+			left++;
+		if (glad_glUniformMatrix4x3dv == lgl__glTrace_glUniformMatrix4x3dv)
+			glad_glUniformMatrix4x3dv = lgl__glReal_glUniformMatrix4x3dv;
+		else if (glad_glUniformMatrix4x3dv != lgl__glReal_glUniformMatrix4x3dv)
+			left++;
+		if (glad_glGetUniformdv == lgl__glTrace_glGetUniformdv)
+			glad_glGetUniformdv = lgl__glReal_glGetUniformdv;
+		else if (glad_glGetUniformdv != lgl__glReal_glGetUniformdv)
+			left++;
+		if (glad_glGetSubroutineUniformLocation == lgl__glTrace_glGetSubroutineUniformLocation)
+			glad_glGetSubroutineUniformLocation = lgl__glReal_glGetSubroutineUniformLocation;
+		else if (glad_glGetSubroutineUniformLocation != lgl__glReal_glGetSubroutineUniformLocation)
+			left++;
+		if (glad_glGetSubroutineIndex == lgl__glTrace_glGetSubroutineIndex)
+			glad_glGetSubroutineIndex = lgl__glReal_glGetSubroutineIndex;
+		else if (glad_glGetSubroutineIndex != lgl__glReal_glGetSubroutineIndex)
+			left++;
+		if (glad_glGetActiveSubroutineUniformiv == lgl__glTrace_glGetActiveSubroutineUniformiv)
+			glad_glGetActiveSubroutineUniformiv = lgl__glReal_glGetActiveSubroutineUniformiv;
+		else if (glad_glGetActiveSubroutineUniformiv != lgl__glReal_glGetActiveSubroutineUniformiv)
+			left++;
+		if (glad_glGetActiveSubroutineUniformName == lgl__glTrace_glGetActiveSubroutineUniformName)
+			glad_glGetActiveSubroutineUniformName = lgl__glReal_glGetActiveSubroutineUniformName;
+		else if (glad_glGetActiveSubroutineUniformName != lgl__glReal_glGetActiveSubroutineUniformName)
+			left++;
+		if (glad_glGetActiveSubroutineName == lgl__glTrace_glGetActiveSubroutineName)
+			glad_glGetActiveSubroutineName = lgl__glReal_glGetActiveSubroutineName;
+		else if (glad_glGetActiveSubroutineName != lgl__glReal_glGetActiveSubroutineName)
+			left++;
+		if (glad_glUniformSubroutinesuiv == lgl__glTrace_glUniformSubroutinesuiv)
+			glad_glUniformSubroutinesuiv = lgl__glReal_glUniformSubroutinesuiv;
+		else if (glad_glUniformSubroutinesuiv != lgl__glReal_glUniformSubroutinesuiv)
+			left++;
+		if (glad_glGetUniformSubroutineuiv == lgl__glTrace_glGetUniformSubroutineuiv)
+			glad_glGetUniformSubroutineuiv = lgl__glReal_glGetUniformSubroutineuiv;
+		else if (glad_glGetUniformSubroutineuiv != lgl__glReal_glGetUniformSubroutineuiv)
+			left++;
+		if (glad_glGetProgramStageiv == lgl__glTrace_glGetProgramStageiv)
+			glad_glGetProgramStageiv = lgl__glReal_glGetProgramStageiv;
+		else if (glad_glGetProgramStageiv != lgl__glReal_glGetProgramStageiv)
+			left++;
+		if (glad_glPatchParameteri == lgl__glTrace_glPatchParameteri)
+			glad_glPatchParameteri = lgl__glReal_glPatchParameteri;
+		else if (glad_glPatchParameteri != lgl__glReal_glPatchParameteri)
+			left++;
+		if (glad_glPatchParameterfv == lgl__glTrace_glPatchParameterfv)
+			glad_glPatchParameterfv = lgl__glReal_glPatchParameterfv;
+		else if (glad_glPatchParameterfv != lgl__glReal_glPatchParameterfv)
+			left++;
+		if (glad_glBindTransformFeedback == lgl__glTrace_glBindTransformFeedback)
+			glad_glBindTransformFeedback = lgl__glReal_glBindTransformFeedback;
+		else if (glad_glBindTransformFeedback != lgl__glReal_glBindTransformFeedback)
+			left++;
+		if (glad_glDeleteTransformFeedbacks == lgl__glTrace_glDeleteTransformFeedbacks)
+			glad_glDeleteTransformFeedbacks = lgl__glReal_glDeleteTransformFeedbacks;
+		else if (glad_glDeleteTransformFeedbacks != lgl__glReal_glDeleteTransformFeedbacks)
+			left++;
+		if (glad_glGenTransformFeedbacks == lgl__glTrace_glGenTransformFeedbacks)
+			glad_glGenTransformFeedbacks = lgl__glReal_glGenTransformFeedbacks;
+		else if (glad_glGenTransformFeedbacks != lgl__glReal_glGenTransformFeedbacks)
+			left++;
+		if (glad_glIsTransformFeedback == lgl__glTrace_glIsTransformFeedback)
+			glad_glIsTransformFeedback = lgl__glReal_glIsTransformFeedback;
+		else if (glad_glIsTransformFeedback != lgl__glReal_glIsTransformFeedback)
+			left++;
+		if (glad_glPauseTransformFeedback == lgl__glTrace_glPauseTransformFeedback)
+			glad_glPauseTransformFeedback = lgl__glReal_glPauseTransformFeedback;
+		else if (glad_glPauseTransformFeedback != lgl__glReal_glPauseTransformFeedback)
+			left++;
+		if (glad_glResumeTransformFeedback == lgl__glTrace_glResumeTransformFeedback)
+			glad_glResumeTransformFeedback = lgl__glReal_glResumeTransformFeedback;
+		else if (glad_glResumeTransformFeedback != lgl__glReal_glResumeTransformFeedback)
+			left++;
+		if (glad_glDrawTransformFeedback == lgl__glTrace_glDrawTransformFeedback)
+			glad_glDrawTransformFeedback = lgl__glReal_glDrawTransformFeedback;
+		else if (glad_glDrawTransformFeedback != lgl__glReal_glDrawTransformFeedback)
+			left++;
+		if (glad_glDrawTransformFeedbackStream == lgl__glTrace_glDrawTransformFeedbackStream)
+			glad_glDrawTransformFeedbackStream = lgl__glReal_glDrawTransformFeedbackStream;
+		else if (glad_glDrawTransformFeedbackStream != lgl__glReal_glDrawTransformFeedbackStream)
+			left++;
+		if (glad_glBeginQueryIndexed == lgl__glTrace_glBeginQueryIndexed)
+			glad_glBeginQueryIndexed = lgl__glReal_glBeginQueryIndexed;
+		else if (glad_glBeginQueryIndexed != lgl__glReal_glBeginQueryIndexed)
+			left++;
+		if (glad_glEndQueryIndexed == lgl__glTrace_glEndQueryIndexed)
+			glad_glEndQueryIndexed = lgl__glReal_glEndQueryIndexed;
+		else if (glad_glEndQueryIndexed != lgl__glReal_glEndQueryIndexed)
+			left++;
+		if (glad_glGetQueryIndexediv == lgl__glTrace_glGetQueryIndexediv)
+			glad_glGetQueryIndexediv = lgl__glReal_glGetQueryIndexediv;
+		else if (glad_glGetQueryIndexediv != lgl__glReal_glGetQueryIndexediv)
+			left++;
+		if (glad_glReleaseShaderCompiler == lgl__glTrace_glReleaseShaderCompiler)
+			glad_glReleaseShaderCompiler = lgl__glReal_glReleaseShaderCompiler;
+		else if (glad_glReleaseShaderCompiler != lgl__glReal_glReleaseShaderCompiler)
+			left++;
+		if (glad_glShaderBinary == lgl__glTrace_glShaderBinary)
+			glad_glShaderBinary = lgl__glReal_glShaderBinary;
+		else if (glad_glShaderBinary != lgl__glReal_glShaderBinary)
+			left++;
+		if (glad_glGetShaderPrecisionFormat == lgl__glTrace_glGetShaderPrecisionFormat)
+			glad_glGetShaderPrecisionFormat = lgl__glReal_glGetShaderPrecisionFormat;
+		else if (glad_glGetShaderPrecisionFormat != lgl__glReal_glGetShaderPrecisionFormat)
+			left++;
+		if (glad_glDepthRangef == lgl__glTrace_glDepthRangef)
+			glad_glDepthRangef = lgl__glReal_glDepthRangef;
+		else if (glad_glDepthRangef != lgl__glReal_glDepthRangef)
+			left++;
+		if (glad_glClearDepthf == lgl__glTrace_glClearDepthf)
+			glad_glClearDepthf = lgl__glReal_glClearDepthf;
+		else if (glad_glClearDepthf != lgl__glReal_glClearDepthf)
+			left++;
+		if (glad_glGetProgramBinary == lgl__glTrace_glGetProgramBinary)
+			glad_glGetProgramBinary = lgl__glReal_glGetProgramBinary;
+		else if (glad_glGetProgramBinary != lgl__glReal_glGetProgramBinary)
+			left++;
+		if (glad_glProgramBinary == lgl__glTrace_glProgramBinary)
+			glad_glProgramBinary = lgl__glReal_glProgramBinary;
+		else if (glad_glProgramBinary != lgl__glReal_glProgramBinary)
+			left++;
+		if (glad_glProgramParameteri == lgl__glTrace_glProgramParameteri)
+			glad_glProgramParameteri = lgl__glReal_glProgramParameteri;
+		else if (glad_glProgramParameteri != lgl__glReal_glProgramParameteri)
+			left++;
+		if (glad_glUseProgramStages == lgl__glTrace_glUseProgramStages)
+			glad_glUseProgramStages = lgl__glReal_glUseProgramStages;
+		else if (glad_glUseProgramStages != lgl__glReal_glUseProgramStages)
+			left++;
+		if (glad_glActiveShaderProgram == lgl__glTrace_glActiveShaderProgram)
+			glad_glActiveShaderProgram = lgl__glReal_glActiveShaderProgram;
+		else if (glad_glActiveShaderProgram != lgl__glReal_glActiveShaderProgram)
+			left++;
+		if (glad_glCreateShaderProgramv == lgl__glTrace_glCreateShaderProgramv)
+			glad_glCreateShaderProgramv = lgl__glReal_glCreateShaderProgramv;
+		else if (glad_glCreateShaderProgramv != lgl__glReal_glCreateShaderProgramv)
+			left++;
+		if (glad_glBindProgramPipeline == lgl__glTrace_glBindProgramPipeline)
+			glad_glBindProgramPipeline = lgl__glReal_glBindProgramPipeline;
+		else if (glad_glBindProgramPipeline != lgl__glReal_glBindProgramPipeline)
+			left++;
+		if (glad_glDeleteProgramPipelines == lgl__glTrace_glDeleteProgramPipelines)
+			glad_glDeleteProgramPipelines = lgl__glReal_glDeleteProgramPipelines;
+		else if (glad_glDeleteProgramPipelines != lgl__glReal_glDeleteProgramPipelines)
+			left++;
+		if (glad_glGenProgramPipelines == lgl__glTrace_glGenProgramPipelines)
+			glad_glGenProgramPipelines = lgl__glReal_glGenProgramPipelines;
+		else if (glad_glGenProgramPipelines != lgl__glReal_glGenProgramPipelines)
+			left++;
+		if (glad_glIsProgramPipeline == lgl__glTrace_glIsProgramPipeline)
+			glad_glIsProgramPipeline = lgl__glReal_glIsProgramPipeline;
+		else if (glad_glIsProgramPipeline != lgl__glReal_glIsProgramPipeline)
+			left++;
+		if (glad_glGetProgramPipelineiv == lgl__glTrace_glGetProgramPipelineiv)
+			glad_glGetProgramPipelineiv = lgl__glReal_glGetProgramPipelineiv;
+		else if (glad_glGetProgramPipelineiv != lgl__glReal_glGetProgramPipelineiv)
+			left++;
+		if (glad_glProgramUniform1i == lgl__glTrace_glProgramUniform1i)
+			glad_glProgramUniform1i = lgl__glReal_glProgramUniform1i;
+		else if (glad_glProgramUniform1i != lgl__glReal_glProgramUniform1i)
+			left++;
+		if (glad_glProgramUniform1iv == lgl__glTrace_glProgramUniform1iv)
+			glad_glProgramUniform1iv = lgl__glReal_glProgramUniform1iv;
+		else if (glad_glProgramUniform1iv != lgl__glReal_glProgramUniform1iv)
+			left++;
+		if (glad_glProgramUniform1f == lgl__glTrace_glProgramUniform1f)
+			glad_glProgramUniform1f = lgl__glReal_glProgramUniform1f;
+		else if (glad_glProgramUniform1f != lgl__glReal_glProgramUniform1f)
+			left++;
+		if (glad_glProgramUniform1fv == lgl__glTrace_glProgramUniform1fv)
+			glad_glProgramUniform1fv = lgl__glReal_glProgramUniform1fv;
+		else if (glad_glProgramUniform1fv != lgl__glReal_glProgramUniform1fv)
+			left++;
+		if (glad_glProgramUniform1d == lgl__glTrace_glProgramUniform1d)
+			glad_glProgramUniform1d = lgl__glReal_glProgramUniform1d;
+		else if (glad_glProgramUniform1d != lgl__glReal_glProgramUniform1d)
+			left++;
+		if (glad_glProgramUniform1dv == lgl__glTrace_glProgramUniform1dv)
+			glad_glProgramUniform1dv = lgl__glReal_glProgramUniform1dv;
+		else if (glad_glProgramUniform1dv != lgl__glReal_glProgramUniform1dv)
+			left++;
+		if (glad_glProgramUniform1ui == lgl__glTrace_glProgramUniform1ui)
+			glad_glProgramUniform1ui = lgl__glReal_glProgramUniform1ui;
+		else if (glad_glProgramUniform1ui != lgl__glReal_glProgramUniform1ui)
+			left++;
+		if (glad_glProgramUniform1uiv == lgl__glTrace_glProgramUniform1uiv)
+			glad_glProgramUniform1uiv = lgl__glReal_glProgramUniform1uiv;
+		else if (glad_glProgramUniform1uiv != lgl__glReal_glProgramUniform1uiv)
+			left++;
+		if (glad_glProgramUniform2i == lgl__glTrace_glProgramUniform2i)
+			glad_glProgramUniform2i = lgl__glReal_glProgramUniform2i;
+		else if (glad_glProgramUniform2i != lgl__glReal_glProgramUniform2i)
+			left++;
+		if (glad_glProgramUniform2iv == lgl__glTrace_glProgramUniform2iv)
+			glad_glProgramUniform2iv = lgl__glReal_glProgramUniform2iv;
+		else if (glad_glProgramUniform2iv != lgl__glReal_glProgramUniform2iv)
+			left++;
+		if (glad_glProgramUniform2f == lgl__glTrace_glProgramUniform2f)
+			glad_glProgramUniform2f = lgl__glReal_glProgramUniform2f;
+		else if (glad_glProgramUniform2f != lgl__glReal_glProgramUniform2f)
+			left++;
+		if (glad_glProgramUniform2fv == lgl__glTrace_glProgramUniform2fv)
+			glad_glProgramUniform2fv = lgl__glReal_glProgramUniform2fv;
+		else if (glad_glProgramUniform2fv != lgl__glReal_glProgramUniform2fv)
+			left++;
+		if (glad_glProgramUniform2d == lgl__glTrace_glProgramUniform2d)
+			glad_glProgramUniform2d = lgl__glReal_glProgramUniform2d;
+		else if (glad_glProgramUniform2d != lgl__glReal_glProgramUniform2d)
+			left++;
+		if (glad_glProgramUniform2dv == lgl__glTrace_glProgramUniform2dv)
+			glad_glProgramUniform2dv = lgl__glReal_glProgramUniform2dv;
+		else if (glad_glProgramUniform2dv != lgl__glReal_glProgramUniform2dv)
+			left++;
+		if (glad_glProgramUniform2ui == lgl__glTrace_glProgramUniform2ui)
+			glad_glProgramUniform2ui = lgl__glReal_glProgramUniform2ui;
+		else if (glad_glProgramUniform2ui != lgl__glReal_glProgramUniform2ui)
+			left++;
+		if (glad_glProgramUniform2uiv == lgl__glTrace_glProgramUniform2uiv)
+			glad_glProgramUniform2uiv = lgl__glReal_glProgramUniform2uiv;
+		else if (glad_glProgramUniform2uiv != lgl__glReal_glProgramUniform2uiv)
+			left++;
+		if (glad_glProgramUniform3i == lgl__glTrace_glProgramUniform3i)
+			glad_glProgramUniform3i = lgl__glReal_glProgramUniform3i;
+		else if (glad_glProgramUniform3i != lgl__glReal_glProgramUniform3i)
+			left++;
+		if (glad_glProgramUniform3iv == lgl__glTrace_glProgramUniform3iv)
+			glad_glProgramUniform3iv = lgl__glReal_glProgramUniform3iv;
+		else if (glad_glProgramUniform3iv != lgl__glReal_glProgramUniform3iv)
+			left++;
+		if (glad_glProgramUniform3f == lgl__glTrace_glProgramUniform3f)
+			glad_glProgramUniform3f = lgl__glReal_glProgramUniform3f;
+		else if (glad_glProgramUniform3f != lgl__glReal_glProgramUniform3f)
+			left++;
+		if (glad_glProgramUniform3fv == lgl__glTrace_glProgramUniform3fv)
+			glad_glProgramUniform3fv = lgl__glReal_glProgramUniform3fv;
+		else if (glad_glProgramUniform3fv != lgl__glReal_glProgramUniform3fv)
+			left++;
+		if (glad_glProgramUniform3d == lgl__glTrace_glProgramUniform3d)
+			glad_glProgramUniform3d = lgl__glReal_glProgramUniform3d;
+		else if (glad_glProgramUniform3d != lgl__glReal_glProgramUniform3d)
+			left++;
+		if (glad_glProgramUniform3dv == lgl__glTrace_glProgramUniform3dv)
+			glad_glProgramUniform3dv = lgl__glReal_glProgramUniform3dv;
+		else if (glad_glProgramUniform3dv != lgl__glReal_glProgramUniform3dv)
+			left++;
+		if (glad_glProgramUniform3ui == lgl__glTrace_glProgramUniform3ui)
+			glad_glProgramUniform3ui = lgl__glReal_glProgramUniform3ui;
+		else if (glad_glProgramUniform3ui != lgl__glReal_glProgramUniform3ui)
+			left++;
+		if (glad_glProgramUniform3uiv == lgl__glTrace_glProgramUniform3uiv)
+			glad_glProgramUniform3uiv = lgl__glReal_glProgramUniform3uiv;
+		else if (glad_glProgramUniform3uiv != lgl__glReal_glProgramUniform3uiv)
+			left++;
+		if (glad_glProgramUniform4i == lgl__glTrace_glProgramUniform4i)
+			glad_glProgramUniform4i = lgl__glReal_glProgramUniform4i;
+		else if (glad_glProgramUniform4i != lgl__glReal_glProgramUniform4i)
+			left++;
+		if (glad_glProgramUniform4iv == lgl__glTrace_glProgramUniform4iv)
+			glad_glProgramUniform4iv = lgl__glReal_glProgramUniform4iv;
+		else if (glad_glProgramUniform4iv != lgl__glReal_glProgramUniform4iv)
+			left++;
+		if (glad_glProgramUniform4f == lgl__glTrace_glProgramUniform4f)
+			glad_glProgramUniform4f = lgl__glReal_glProgramUniform4f;
+		else if (glad_glProgramUniform4f != lgl__glReal_glProgramUniform4f)
+			left++;
+		if (glad_glProgramUniform4fv == lgl__glTrace_glProgramUniform4fv)
+			glad_glProgramUniform4fv = lgl__glReal_glProgramUniform4fv;
+		else if (glad_glProgramUniform4fv != lgl__glReal_glProgramUniform4fv)
+			left++;
+		if (glad_glProgramUniform4d == lgl__glTrace_glProgramUniform4d)
+			glad_glProgramUniform4d = lgl__glReal_glProgramUniform4d;
+		else if (glad_glProgramUniform4d != lgl__glReal_glProgramUniform4d)
+			left++;
+		if (glad_glProgramUniform4dv == lgl__glTrace_glProgramUniform4dv)
+			glad_glProgramUniform4dv = lgl__glReal_glProgramUniform4dv;
+		else if (glad_glProgramUniform4dv != lgl__glReal_glProgramUniform4dv)
+			left++;
+		if (glad_glProgramUniform4ui == lgl__glTrace_glProgramUniform4ui)
+			glad_glProgramUniform4ui = lgl__glReal_glProgramUniform4ui;
+		else if (glad_glProgramUniform4ui != lgl__glReal_glProgramUniform4ui)
+			left++;
+		if (glad_glProgramUniform4uiv == lgl__glTrace_glProgramUniform4uiv)
+			glad_glProgramUniform4uiv = lgl__glReal_glProgramUniform4uiv;
+		else if (glad_glProgramUniform4uiv != lgl__glReal_glProgramUniform4uiv)
+			left++;
+		if (glad_glProgramUniformMatrix2fv == lgl__glTrace_glProgramUniformMatrix2fv)
+			glad_glProgramUniformMatrix2fv = lgl__glReal_glProgramUniformMatrix2fv;
+		else if (glad_glProgramUniformMatrix2fv != lgl__glReal_glProgramUniformMatrix2fv)
+			left++;
+		if (glad_glProgramUniformMatrix3fv == lgl__glTrace_glProgramUniformMatrix3fv)
+			glad_glProgramUniformMatrix3fv = lgl__glReal_glProgramUniformMatrix3fv;
+		else if (glad_glProgramUniformMatrix3fv != lgl__glReal_glProgramUniformMatrix3fv)
+			left++;
+		if (glad_glProgramUniformMatrix4fv == lgl__glTrace_glProgramUniformMatrix4fv)
+			glad_glProgramUniformMatrix4fv = lgl__glReal_glProgramUniformMatrix4fv;
+		else if (glad_glProgramUniformMatrix4fv != lgl__glReal_glProgramUniformMatrix4fv)
+			left++;
+		if (glad_glProgramUniformMatrix2dv == lgl__glTrace_glProgramUniformMatrix2dv)
+			glad_glProgramUniformMatrix2dv = lgl__glReal_glProgramUniformMatrix2dv;
+		else if (glad_glProgramUniformMatrix2dv != lgl__glReal_glProgramUniformMatrix2dv)
+			left++;
+		if (glad_glProgramUniformMatrix3dv == lgl__glTrace_glProgramUniformMatrix3dv)
+			glad_glProgramUniformMatrix3dv = lgl__glReal_glProgramUniformMatrix3dv;
+		else if (glad_glProgramUniformMatrix3dv != lgl__glReal_glProgramUniformMatrix3dv)
+			left++;
+		if (glad_glProgramUniformMatrix4dv == lgl__glTrace_glProgramUniformMatrix4dv)
+			glad_glProgramUniformMatrix4dv = lgl__glReal_glProgramUniformMatrix4dv;
+		else if (glad_glProgramUniformMatrix4dv != lgl__glReal_glProgramUniformMatrix4dv)
+			left++;
+		if (glad_glProgramUniformMatrix2x3fv == lgl__glTrace_glProgramUniformMatrix2x3fv)
+			glad_glProgramUniformMatrix2x3fv = lgl__glReal_glProgramUniformMatrix2x3fv;
+		else if (glad_glProgramUniformMatrix2x3fv != lgl__glReal_glProgramUniformMatrix2x3fv)
+			left++;
+		if (glad_glProgramUniformMatrix3x2fv == lgl__glTrace_glProgramUniformMatrix3x2fv)
+			glad_glProgramUniformMatrix3x2fv = lgl__glReal_glProgramUniformMatrix3x2fv;
+		else if (glad_glProgramUniformMatrix3x2fv != lgl__glReal_glProgramUniformMatrix3x2fv)
+			left++;
+		if (glad_glProgramUniformMatrix2x4fv == lgl__glTrace_glProgramUniformMatrix2x4fv)
+			glad_glProgramUniformMatrix2x4fv = lgl__glReal_glProgramUniformMatrix2x4fv;
+		else if (glad_glProgramUniformMatrix2x4fv != lgl__glReal_glProgramUniformMatrix2x4fv)
+			left++;
+		if (glad_glProgramUniformMatrix4x2fv == lgl__glTrace_glProgramUniformMatrix4x2fv)
+			glad_glProgramUniformMatrix4x2fv = lgl__glReal_glProgramUniformMatrix4x2fv;
+		else if (glad_glProgramUniformMatrix4x2fv != lgl__glReal_glProgramUniformMatrix4x2fv)
+			left++;
+		if (glad_glProgramUniformMatrix3x4fv == lgl__glTrace_glProgramUniformMatrix3x4fv)
+			glad_glProgramUniformMatrix3x4fv = lgl__glReal_glProgramUniformMatrix3x4fv;
+		else if (glad_glProgramUniformMatrix3x4fv != lgl__glReal_glProgramUniformMatrix3x4fv)
+			left++;
+		if (glad_glProgramUniformMatrix4x3fv == lgl__glTrace_glProgramUniformMatrix4x3fv)
+			glad_glProgramUniformMatrix4x3fv = lgl__glReal_glProgramUniformMatrix4x3fv;
+		else if (glad_glProgramUniformMatrix4x3fv != lgl__glReal_glProgramUniformMatrix4x3fv)
+			left++;
+		if (glad_glProgramUniformMatrix2x3dv == lgl__glTrace_glProgramUniformMatrix2x3dv)
+			glad_glProgramUniformMatrix2x3dv = lgl__glReal_glProgramUniformMatrix2x3dv;
+		else if (glad_glProgramUniformMatrix2x3dv != lgl__glReal_glProgramUniformMatrix2x3dv)
+			left++;
+		if (glad_glProgramUniformMatrix3x2dv == lgl__glTrace_glProgramUniformMatrix3x2dv)
+			glad_glProgramUniformMatrix3x2dv = lgl__glReal_glProgramUniformMatrix3x2dv;
+		else if (glad_glProgramUniformMatrix3x2dv != lgl__glReal_glProgramUniformMatrix3x2dv)
+			left++;
+		if (glad_glProgramUniformMatrix2x4dv == lgl__glTrace_glProgramUniformMatrix2x4dv)
+			glad_glProgramUniformMatrix2x4dv = lgl__glReal_glProgramUniformMatrix2x4dv;
+		else if (glad_glProgramUniformMatrix2x4dv != lgl__glReal_glProgramUniformMatrix2x4dv)
+			left++;
+		if (glad_glProgramUniformMatrix4x2dv == lgl__glTrace_glProgramUniformMatrix4x2dv)
+			glad_glProgramUniformMatrix4x2dv = lgl__glReal_glProgramUniformMatrix4x2dv;
+		else if (glad_glProgramUniformMatrix4x2dv != lgl__glReal_glProgramUniformMatrix4x2dv)
+			left++;
+		if (glad_glProgramUniformMatrix3x4dv == lgl__glTrace_glProgramUniformMatrix3x4dv)
+			glad_glProgramUniformMatrix3x4dv = lgl__glReal_glProgramUniformMatrix3x4dv;
+		else if (glad_glProgramUniformMatrix3x4dv != lgl__glReal_glProgramUniformMatrix3x4dv)
+			left++;
+		if (glad_glProgramUniformMatrix4x3dv == lgl__glTrace_glProgramUniformMatrix4x3dv)
+			glad_glProgramUniformMatrix4x3dv = lgl__glReal_glProgramUniformMatrix4x3dv;
+		else if (glad_glProgramUniformMatrix4x3dv != lgl__glReal_glProgramUniformMatrix4x3dv)
+			left++;
+		if (glad_glValidateProgramPipeline == lgl__glTrace_glValidateProgramPipeline)
+			glad_glValidateProgramPipeline = lgl__glReal_glValidateProgramPipeline;
+		else if (glad_glValidateProgramPipeline != lgl__glReal_glValidateProgramPipeline)
+			left++;
+		if (glad_glGetProgramPipelineInfoLog == lgl__glTrace_glGetProgramPipelineInfoLog)
+			glad_glGetProgramPipelineInfoLog = lgl__glReal_glGetProgramPipelineInfoLog;
+		else if (glad_glGetProgramPipelineInfoLog != lgl__glReal_glGetProgramPipelineInfoLog)
+			left++;
+		if (glad_glVertexAttribL1d == lgl__glTrace_glVertexAttribL1d)
+			glad_glVertexAttribL1d = lgl__glReal_glVertexAttribL1d;
+		else if (glad_glVertexAttribL1d != lgl__glReal_glVertexAttribL1d)
+			left++;
+		if (glad_glVertexAttribL2d == lgl__glTrace_glVertexAttribL2d)
+			glad_glVertexAttribL2d = lgl__glReal_glVertexAttribL2d;
+		else if (glad_glVertexAttribL2d != lgl__glReal_glVertexAttribL2d)
+			left++;
+		if (glad_glVertexAttribL3d == lgl__glTrace_glVertexAttribL3d)
+			glad_glVertexAttribL3d = lgl__glReal_glVertexAttribL3d;
+		else if (glad_glVertexAttribL3d != lgl__glReal_glVertexAttribL3d)
+			left++;
+		if (glad_glVertexAttribL4d == lgl__glTrace_glVertexAttribL4d)
+			glad_glVertexAttribL4d = lgl__glReal_glVertexAttribL4d;
+		else if (glad_glVertexAttribL4d != lgl__glReal_glVertexAttribL4d)
+			left++;
+		if (glad_glVertexAttribL1dv == lgl__glTrace_glVertexAttribL1dv)
+			glad_glVertexAttribL1dv = lgl__glReal_glVertexAttribL1dv;
+		else if (glad_glVertexAttribL1dv != lgl__glReal_glVertexAttribL1dv)
+			left++;
+		if (glad_glVertexAttribL2dv == lgl__glTrace_glVertexAttribL2dv)
+			glad_glVertexAttribL2dv = lgl__glReal_glVertexAttribL2dv;
+		else if (glad_glVertexAttribL2dv != lgl__glReal_glVertexAttribL2dv)
+			left++;
+		if (glad_glVertexAttribL3dv == lgl__glTrace_glVertexAttribL3dv)
+			glad_glVertexAttribL3dv = lgl__glReal_glVertexAttribL3dv;
+		else if (glad_glVertexAttribL3dv != lgl__glReal_glVertexAttribL3dv)
+			left++;
+		if (glad_glVertexAttribL4dv == lgl__glTrace_glVertexAttribL4dv)
+			glad_glVertexAttribL4dv = lgl__glReal_glVertexAttribL4dv;
+		else if (glad_glVertexAttribL4dv != lgl__glReal_glVertexAttribL4dv)
+			left++;
+		if (glad_glVertexAttribLPointer == lgl__glTrace_glVertexAttribLPointer)
+			glad_glVertexAttribLPointer = lgl__glReal_glVertexAttribLPointer;
+		else if (glad_glVertexAttribLPointer != lgl__glReal_glVertexAttribLPointer)
+			left++;
+		if (glad_glGetVertexAttribLdv == lgl__glTrace_glGetVertexAttribLdv)
+			glad_glGetVertexAttribLdv = lgl__glReal_glGetVertexAttribLdv;
+		else if (glad_glGetVertexAttribLdv != lgl__glReal_glGetVertexAttribLdv)
+			left++;
+		if (glad_glViewportArrayv == lgl__glTrace_glViewportArrayv)
+			glad_glViewportArrayv = lgl__glReal_glViewportArrayv;
+		else if (glad_glViewportArrayv != lgl__glReal_glViewportArrayv)
+			left++;
+		if (glad_glViewportIndexedf == lgl__glTrace_glViewportIndexedf)
+			glad_glViewportIndexedf = lgl__glReal_glViewportIndexedf;
+		else if (glad_glViewportIndexedf != lgl__glReal_glViewportIndexedf)
+			left++;
+		if (glad_glViewportIndexedfv == lgl__glTrace_glViewportIndexedfv)
+			glad_glViewportIndexedfv = lgl__glReal_glViewportIndexedfv;
+		else if (glad_glViewportIndexedfv != lgl__glReal_glViewportIndexedfv)
+			left++;
+		if (glad_glScissorArrayv == lgl__glTrace_glScissorArrayv)
+			glad_glScissorArrayv = lgl__glReal_glScissorArrayv;
+		else if (glad_glScissorArrayv != lgl__glReal_glScissorArrayv)
+			left++;
+		if (glad_glScissorIndexed == lgl__glTrace_glScissorIndexed)
+			glad_glScissorIndexed = lgl__glReal_glScissorIndexed;
+		else if (glad_glScissorIndexed != lgl__glReal_glScissorIndexed)
+			left++;
+		if (glad_glScissorIndexedv == lgl__glTrace_glScissorIndexedv)
+			glad_glScissorIndexedv = lgl__glReal_glScissorIndexedv;
+		else if (glad_glScissorIndexedv != lgl__glReal_glScissorIndexedv)
+			left++;
+		if (glad_glDepthRangeArrayv == lgl__glTrace_glDepthRangeArrayv)
+			glad_glDepthRangeArrayv = lgl__glReal_glDepthRangeArrayv;
+		else if (glad_glDepthRangeArrayv != lgl__glReal_glDepthRangeArrayv)
+			left++;
+		if (glad_glDepthRangeIndexed == lgl__glTrace_glDepthRangeIndexed)
+			glad_glDepthRangeIndexed = lgl__glReal_glDepthRangeIndexed;
+		else if (glad_glDepthRangeIndexed != lgl__glReal_glDepthRangeIndexed)
+			left++;
+		if (glad_glGetFloati_v == lgl__glTrace_glGetFloati_v)
+			glad_glGetFloati_v = lgl__glReal_glGetFloati_v;
+		else if (glad_glGetFloati_v != lgl__glReal_glGetFloati_v)
+			left++;
+		if (glad_glGetDoublei_v == lgl__glTrace_glGetDoublei_v)
+			glad_glGetDoublei_v = lgl__glReal_glGetDoublei_v;
+		else if (glad_glGetDoublei_v != lgl__glReal_glGetDoublei_v)
+			left++;
+		if (glad_glDrawArraysInstancedBaseInstance == lgl__glTrace_glDrawArraysInstancedBaseInstance)
+			glad_glDrawArraysInstancedBaseInstance = lgl__glReal_glDrawArraysInstancedBaseInstance;
+		else if (glad_glDrawArraysInstancedBaseInstance != lgl__glReal_glDrawArraysInstancedBaseInstance)
+			left++;
+		if (glad_glDrawElementsInstancedBaseInstance == lgl__glTrace_glDrawElementsInstancedBaseInstance)
+			glad_glDrawElementsInstancedBaseInstance = lgl__glReal_glDrawElementsInstancedBaseInstance;
+		else if (glad_glDrawElementsInstancedBaseInstance != lgl__glReal_glDrawElementsInstancedBaseInstance)
+			left++;
+		if (glad_glDrawElementsInstancedBaseVertexBaseInstance == lgl__glTrace_glDrawElementsInstancedBaseVertexBaseInstance)
+			glad_glDrawElementsInstancedBaseVertexBaseInstance = lgl__glReal_glDrawElementsInstancedBaseVertexBaseInstance;
+		else if (glad_glDrawElementsInstancedBaseVertexBaseInstance != lgl__glReal_glDrawElementsInstancedBaseVertexBaseInstance)
+			left++;
+		if (glad_glGetInternalformativ == lgl__glTrace_glGetInternalformativ)
+			glad_glGetInternalformativ = lgl__glReal_glGetInternalformativ;
+		else if (glad_glGetInternalformativ != lgl__glReal_glGetInternalformativ)
+			left++;
+		if (glad_glGetActiveAtomicCounterBufferiv == lgl__glTrace_glGetActiveAtomicCounterBufferiv)
+			glad_glGetActiveAtomicCounterBufferiv = lgl__glReal_glGetActiveAtomicCounterBufferiv;
+		else if (glad_glGetActiveAtomicCounterBufferiv != lgl__glReal_glGetActiveAtomicCounterBufferiv)
+			left++;
+		if (glad_glBindImageTexture == lgl__glTrace_glBindImageTexture)
+			glad_glBindImageTexture = lgl__glReal_glBindImageTexture;
+		else if (glad_glBindImageTexture != lgl__glReal_glBindImageTexture)
+			left++;
+		if (glad_glMemoryBarrier == lgl__glTrace_glMemoryBarrier)
+			glad_glMemoryBarrier = lgl__glReal_glMemoryBarrier;
+		else if (glad_glMemoryBarrier != lgl__glReal_glMemoryBarrier)
+			left++;
+		if (glad_glTexStorage1D == lgl__glTrace_glTexStorage1D)
+			glad_glTexStorage1D = lgl__glReal_glTexStorage1D;
+		else if (glad_glTexStorage1D != lgl__glReal_glTexStorage1D)
+			left++;
+		if (glad_glTexStorage2D == lgl__glTrace_glTexStorage2D)
+			glad_glTexStorage2D = lgl__glReal_glTexStorage2D;
+		else if (glad_glTexStorage2D != lgl__glReal_glTexStorage2D)
+			left++;
+		if (glad_glTexStorage3D == lgl__glTrace_glTexStorage3D)
+			glad_glTexStorage3D = lgl__glReal_glTexStorage3D;
+		else if (glad_glTexStorage3D != lgl__glReal_glTexStorage3D)
+			left++;
+		if (glad_glDrawTransformFeedbackInstanced == lgl__glTrace_glDrawTransformFeedbackInstanced)
+			glad_glDrawTransformFeedbackInstanced = lgl__glReal_glDrawTransformFeedbackInstanced;
+		else if (glad_glDrawTransformFeedbackInstanced != lgl__glReal_glDrawTransformFeedbackInstanced)
+			left++;
+		if (glad_glDrawTransformFeedbackStreamInstanced == lgl__glTrace_glDrawTransformFeedbackStreamInstanced)
+			glad_glDrawTransformFeedbackStreamInstanced = lgl__glReal_glDrawTransformFeedbackStreamInstanced;
+		else if (glad_glDrawTransformFeedbackStreamInstanced != lgl__glReal_glDrawTransformFeedbackStreamInstanced)
+			left++;
+		if (glad_glClearBufferData == lgl__glTrace_glClearBufferData)
+			glad_glClearBufferData = lgl__glReal_glClearBufferData;
+		else if (glad_glClearBufferData != lgl__glReal_glClearBufferData)
+			left++;
+		if (glad_glClearBufferSubData == lgl__glTrace_glClearBufferSubData)
+			glad_glClearBufferSubData = lgl__glReal_glClearBufferSubData;
+		else if (glad_glClearBufferSubData != lgl__glReal_glClearBufferSubData)
+			left++;
+		if (glad_glDispatchCompute == lgl__glTrace_glDispatchCompute)
+			glad_glDispatchCompute = lgl__glReal_glDispatchCompute;
+		else if (glad_glDispatchCompute != lgl__glReal_glDispatchCompute)
+			left++;
+		if (glad_glDispatchComputeIndirect == lgl__glTrace_glDispatchComputeIndirect)
+			glad_glDispatchComputeIndirect = lgl__glReal_glDispatchComputeIndirect;
+		else if (glad_glDispatchComputeIndirect != lgl__glReal_glDispatchComputeIndirect)
+			left++;
+		if (glad_glCopyImageSubData == lgl__glTrace_glCopyImageSubData)
+			glad_glCopyImageSubData = lgl__glReal_glCopyImageSubData;
+		else if (glad_glCopyImageSubData != lgl__glReal_glCopyImageSubData)
+			left++;
+		if (glad_glFramebufferParameteri == lgl__glTrace_glFramebufferParameteri)
+			glad_glFramebufferParameteri = lgl__glReal_glFramebufferParameteri;
+		else if (glad_glFramebufferParameteri != lgl__glReal_glFramebufferParameteri)
+			left++;
+		if (glad_glGetFramebufferParameteriv == lgl__glTrace_glGetFramebufferParameteriv)
+			glad_glGetFramebufferParameteriv = lgl__glReal_glGetFramebufferParameteriv;
+		else if (glad_glGetFramebufferParameteriv != lgl__glReal_glGetFramebufferParameteriv)
+			left++;
+		if (glad_glGetInternalformati64v == lgl__glTrace_glGetInternalformati64v)
+			glad_glGetInternalformati64v = lgl__glReal_glGetInternalformati64v;
+		else if (glad_glGetInternalformati64v != lgl__glReal_glGetInternalformati64v)
+			left++;
+		if (glad_glInvalidateTexSubImage == lgl__glTrace_glInvalidateTexSubImage)
+			glad_glInvalidateTexSubImage = lgl__glReal_glInvalidateTexSubImage;
+		else if (glad_glInvalidateTexSubImage != lgl__glReal_glInvalidateTexSubImage)
+			left++;
+		if (glad_glInvalidateTexImage == lgl__glTrace_glInvalidateTexImage)
+			glad_glInvalidateTexImage = lgl__glReal_glInvalidateTexImage;
+		else if (glad_glInvalidateTexImage != lgl__glReal_glInvalidateTexImage)
+			left++;
+		if (glad_glInvalidateBufferSubData == lgl__glTrace_glInvalidateBufferSubData)
+			glad_glInvalidateBufferSubData = lgl__glReal_glInvalidateBufferSubData;
+		else if (glad_glInvalidateBufferSubData != lgl__glReal_glInvalidateBufferSubData)
+			left++;
+		if (glad_glInvalidateBufferData == lgl__glTrace_glInvalidateBufferData)
+			glad_glInvalidateBufferData = lgl__glReal_glInvalidateBufferData;
+		else if (glad_glInvalidateBufferData != lgl__glReal_glInvalidateBufferData)
+			left++;
+		if (glad_glInvalidateFramebuffer == lgl__glTrace_glInvalidateFramebuffer)
+			glad_glInvalidateFramebuffer = lgl__glReal_glInvalidateFramebuffer;
+		else if (glad_glInvalidateFramebuffer != lgl__glReal_glInvalidateFramebuffer)
+			left++;
+		if (glad_glInvalidateSubFramebuffer == lgl__glTrace_glInvalidateSubFramebuffer)
+			glad_glInvalidateSubFramebuffer = lgl__glReal_glInvalidateSubFramebuffer;
+		else if (glad_glInvalidateSubFramebuffer != lgl__glReal_glInvalidateSubFramebuffer)
+			left++;
+		if (glad_glMultiDrawArraysIndirect == lgl__glTrace_glMultiDrawArraysIndirect)
+			glad_glMultiDrawArraysIndirect = lgl__glReal_glMultiDrawArraysIndirect;
+		else if (glad_glMultiDrawArraysIndirect != lgl__glReal_glMultiDrawArraysIndirect)
+			left++;
+		if (glad_glMultiDrawElementsIndirect == lgl__glTrace_glMultiDrawElementsIndirect)
+			glad_glMultiDrawElementsIndirect = lgl__glReal_glMultiDrawElementsIndirect;
+		else if (glad_glMultiDrawElementsIndirect != lgl__glReal_glMultiDrawElementsIndirect)
+			left++;
+		if (glad_glGetProgramInterfaceiv == lgl__glTrace_glGetProgramInterfaceiv)
+			glad_glGetProgramInterfaceiv = lgl__glReal_glGetProgramInterfaceiv;
+		else if (glad_glGetProgramInterfaceiv != lgl__glReal_glGetProgramInterfaceiv)
+			left++;
+		if (glad_glGetProgramResourceIndex == lgl__glTrace_glGetProgramResourceIndex)
+			glad_glGetProgramResourceIndex = lgl__glReal_glGetProgramResourceIndex;
+		else if (glad_glGetProgramResourceIndex != lgl__glReal_glGetProgramResourceIndex)
+			left++;
+		if (glad_glGetProgramResourceName == lgl__glTrace_glGetProgramResourceName)
+			glad_glGetProgramResourceName = lgl__glReal_glGetProgramResourceName;
+		else if (glad_glGetProgramResourceName != lgl__glReal_glGetProgramResourceName)
+			left++;
+		if (glad_glGetProgramResourceiv == lgl__glTrace_glGetProgramResourceiv)
+			glad_glGetProgramResourceiv = lgl__glReal_glGetProgramResourceiv;
+		else if (glad_glGetProgramResourceiv != lgl__glReal_glGetProgramResourceiv)
+			left++;
+		if (glad_glGetProgramResourceLocation == lgl__glTrace_glGetProgramResourceLocation)
+			glad_glGetProgramResourceLocation = lgl__glReal_glGetProgramResourceLocation;
+		else if (glad_glGetProgramResourceLocation != lgl__glReal_glGetProgramResourceLocation)
+			left++;
+		if (glad_glGetProgramResourceLocationIndex == lgl__glTrace_glGetProgramResourceLocationIndex)
+			glad_glGetProgramResourceLocationIndex = lgl__glReal_glGetProgramResourceLocationIndex;
+		else if (glad_glGetProgramResourceLocationIndex != lgl__glReal_glGetProgramResourceLocationIndex)
+			left++;
+		if (glad_glShaderStorageBlockBinding == lgl__glTrace_glShaderStorageBlockBinding)
+			glad_glShaderStorageBlockBinding = lgl__glReal_glShaderStorageBlockBinding;
+		else if (glad_glShaderStorageBlockBinding != lgl__glReal_glShaderStorageBlockBinding)
+			left++;
+		if (glad_glTexBufferRange == lgl__glTrace_glTexBufferRange)
+			glad_glTexBufferRange = lgl__glReal_glTexBufferRange;
+		else if (glad_glTexBufferRange != lgl__glReal_glTexBufferRange)
+			left++;
+		if (glad_glTexStorage2DMultisample == lgl__glTrace_glTexStorage2DMultisample)
+			glad_glTexStorage2DMultisample = lgl__glReal_glTexStorage2DMultisample;
+		else if (glad_glTexStorage2DMultisample != lgl__glReal_glTexStorage2DMultisample)
+			left++;
+		if (glad_glTexStorage3DMultisample == lgl__glTrace_glTexStorage3DMultisample)
+			glad_glTexStorage3DMultisample = lgl__glReal_glTexStorage3DMultisample;
+		else if (glad_glTexStorage3DMultisample != lgl__glReal_glTexStorage3DMultisample)
+			left++;
+		if (glad_glTextureView == lgl__glTrace_glTextureView)
+			glad_glTextureView = lgl__glReal_glTextureView;
+		else if (glad_glTextureView != lgl__glReal_glTextureView)
+			left++;
+		if (glad_glBindVertexBuffer == lgl__glTrace_glBindVertexBuffer)
+			glad_glBindVertexBuffer = lgl__glReal_glBindVertexBuffer;
+		else if (glad_glBindVertexBuffer != lgl__glReal_glBindVertexBuffer)
+			left++;
+		if (glad_glVertexAttribFormat == lgl__glTrace_glVertexAttribFormat)
+			glad_glVertexAttribFormat = lgl__glReal_glVertexAttribFormat;
+		else if (glad_glVertexAttribFormat != lgl__glReal_glVertexAttribFormat)
+			left++;
+		if (glad_glVertexAttribIFormat == lgl__glTrace_glVertexAttribIFormat)
+			glad_glVertexAttribIFormat = lgl__glReal_glVertexAttribIFormat;
+		else if (glad_glVertexAttribIFormat != lgl__glReal_glVertexAttribIFormat)
+			left++;
+		if (glad_glVertexAttribLFormat == lgl__glTrace_glVertexAttribLFormat)
+			glad_glVertexAttribLFormat = lgl__glReal_glVertexAttribLFormat;
+		else if (glad_glVertexAttribLFormat != lgl__glReal_glVertexAttribLFormat)
+			left++;
+		if (glad_glVertexAttribBinding == lgl__glTrace_glVertexAttribBinding)
+			glad_glVertexAttribBinding = lgl__glReal_glVertexAttribBinding;
+		else if (glad_glVertexAttribBinding != lgl__glReal_glVertexAttribBinding)
+			left++;
+		if (glad_glVertexBindingDivisor == lgl__glTrace_glVertexBindingDivisor)
+			glad_glVertexBindingDivisor = lgl__glReal_glVertexBindingDivisor;
+		else if (glad_glVertexBindingDivisor != lgl__glReal_glVertexBindingDivisor)
+			left++;
+		if (glad_glDebugMessageControl == lgl__glTrace_glDebugMessageControl)
+			glad_glDebugMessageControl = lgl__glReal_glDebugMessageControl;
+		else if (glad_glDebugMessageControl != lgl__glReal_glDebugMessageControl)
+			left++;
+		if (glad_glDebugMessageInsert == lgl__glTrace_glDebugMessageInsert)
+			glad_glDebugMessageInsert = lgl__glReal_glDebugMessageInsert;
+		else if (glad_glDebugMessageInsert != lgl__glReal_glDebugMessageInsert)
+			left++;
+		if (glad_glDebugMessageCallback == lgl__glTrace_glDebugMessageCallback)
+			glad_glDebugMessageCallback = lgl__glReal_glDebugMessageCallback;
+		else if (glad_glDebugMessageCallback != lgl__glReal_glDebugMessageCallback)
+			left++;
+		if (glad_glGetDebugMessageLog == lgl__glTrace_glGetDebugMessageLog)
+			glad_glGetDebugMessageLog = lgl__glReal_glGetDebugMessageLog;
+		else if (glad_glGetDebugMessageLog != lgl__glReal_glGetDebugMessageLog)
+			left++;
+		if (glad_glPushDebugGroup == lgl__glTrace_glPushDebugGroup)
+			glad_glPushDebugGroup = lgl__glReal_glPushDebugGroup;
+		else if (glad_glPushDebugGroup != lgl__glReal_glPushDebugGroup)
+			left++;
+		if (glad_glPopDebugGroup == lgl__glTrace_glPopDebugGroup)
+			glad_glPopDebugGroup = lgl__glReal_glPopDebugGroup;
+		else if (glad_glPopDebugGroup != lgl__glReal_glPopDebugGroup)
+			left++;
+		if (glad_glObjectLabel == lgl__glTrace_glObjectLabel)
+			glad_glObjectLabel = lgl__glReal_glObjectLabel;
+		else if (glad_glObjectLabel != lgl__glReal_glObjectLabel)
+			left++;
+		if (glad_glGetObjectLabel == lgl__glTrace_glGetObjectLabel)
+			glad_glGetObjectLabel = lgl__glReal_glGetObjectLabel;
+		else if (glad_glGetObjectLabel != lgl__glReal_glGetObjectLabel)
+			left++;
+		if (glad_glObjectPtrLabel == lgl__glTrace_glObjectPtrLabel)
+			glad_glObjectPtrLabel = lgl__glReal_glObjectPtrLabel;
+		else if (glad_glObjectPtrLabel != lgl__glReal_glObjectPtrLabel)
+			left++;
+		if (glad_glGetObjectPtrLabel == lgl__glTrace_glGetObjectPtrLabel)
+			glad_glGetObjectPtrLabel = lgl__glReal_glGetObjectPtrLabel;
+		else if (glad_glGetObjectPtrLabel != lgl__glReal_glGetObjectPtrLabel)
+			left++;
+		if (glad_glGetPointerv == lgl__glTrace_glGetPointerv)
+			glad_glGetPointerv = lgl__glReal_glGetPointerv;
+		else if (glad_glGetPointerv != lgl__glReal_glGetPointerv)
+			left++;
+		if (glad_glBufferStorage == lgl__glTrace_glBufferStorage)
+			glad_glBufferStorage = lgl__glReal_glBufferStorage;
+		else if (glad_glBufferStorage != lgl__glReal_glBufferStorage)
+			left++;
+		if (glad_glClearTexImage == lgl__glTrace_glClearTexImage)
+			glad_glClearTexImage = lgl__glReal_glClearTexImage;
+		else if (glad_glClearTexImage != lgl__glReal_glClearTexImage)
+			left++;
+		if (glad_glClearTexSubImage == lgl__glTrace_glClearTexSubImage)
+			glad_glClearTexSubImage = lgl__glReal_glClearTexSubImage;
+		else if (glad_glClearTexSubImage != lgl__glReal_glClearTexSubImage)
+			left++;
+		if (glad_glBindBuffersBase == lgl__glTrace_glBindBuffersBase)
+			glad_glBindBuffersBase = lgl__glReal_glBindBuffersBase;
+		else if (glad_glBindBuffersBase != lgl__glReal_glBindBuffersBase)
+			left++;
+		if (glad_glBindBuffersRange == lgl__glTrace_glBindBuffersRange)
+			glad_glBindBuffersRange = lgl__glReal_glBindBuffersRange;
+		else if (glad_glBindBuffersRange != lgl__glReal_glBindBuffersRange)
+			left++;
+		if (glad_glBindTextures == lgl__glTrace_glBindTextures)
+			glad_glBindTextures = lgl__glReal_glBindTextures;
+		else if (glad_glBindTextures != lgl__glReal_glBindTextures)
+			left++;
+		if (glad_glBindSamplers == lgl__glTrace_glBindSamplers)
+			glad_glBindSamplers = lgl__glReal_glBindSamplers;
+		else if (glad_glBindSamplers != lgl__glReal_glBindSamplers)
+			left++;
+		if (glad_glBindImageTextures == lgl__glTrace_glBindImageTextures)
+			glad_glBindImageTextures = lgl__glReal_glBindImageTextures;
+		else if (glad_glBindImageTextures != lgl__glReal_glBindImageTextures)
+			left++;
+		if (glad_glBindVertexBuffers == lgl__glTrace_glBindVertexBuffers)
+			glad_glBindVertexBuffers = lgl__glReal_glBindVertexBuffers;
+		else if (glad_glBindVertexBuffers != lgl__glReal_glBindVertexBuffers)
+			left++;
+		if (glad_glClipControl == lgl__glTrace_glClipControl)
+			glad_glClipControl = lgl__glReal_glClipControl;
+		else if (glad_glClipControl != lgl__glReal_glClipControl)
+			left++;
+		if (glad_glCreateTransformFeedbacks == lgl__glTrace_glCreateTransformFeedbacks)
+			glad_glCreateTransformFeedbacks = lgl__glReal_glCreateTransformFeedbacks;
+		else if (glad_glCreateTransformFeedbacks != lgl__glReal_glCreateTransformFeedbacks)
+			left++;
+		if (glad_glTransformFeedbackBufferBase == lgl__glTrace_glTransformFeedbackBufferBase)
+			glad_glTransformFeedbackBufferBase = lgl__glReal_glTransformFeedbackBufferBase;
+		else if (glad_glTransformFeedbackBufferBase != lgl__glReal_glTransformFeedbackBufferBase)
+			left++;
+		if (glad_glTransformFeedbackBufferRange == lgl__glTrace_glTransformFeedbackBufferRange)
+			glad_glTransformFeedbackBufferRange = lgl__glReal_glTransformFeedbackBufferRange;
+		else if (glad_glTransformFeedbackBufferRange != lgl__glReal_glTransformFeedbackBufferRange)
+			left++;
+		if (glad_glGetTransformFeedbackiv == lgl__glTrace_glGetTransformFeedbackiv)
+			glad_glGetTransformFeedbackiv = lgl__glReal_glGetTransformFeedbackiv;
+		else if (glad_glGetTransformFeedbackiv != lgl__glReal_glGetTransformFeedbackiv)
+			left++;
+		if (glad_glGetTransformFeedbacki_v == lgl__glTrace_glGetTransformFeedbacki_v)
+			glad_glGetTransformFeedbacki_v = lgl__glReal_glGetTransformFeedbacki_v;
+		else if (glad_glGetTransformFeedbacki_v != lgl__glReal_glGetTransformFeedbacki_v)
+			left++;
+		if (glad_glGetTransformFeedbacki64_v == lgl__glTrace_glGetTransformFeedbacki64_v)
+			glad_glGetTransformFeedbacki64_v = lgl__glReal_glGetTransformFeedbacki64_v;
+		else if (glad_glGetTransformFeedbacki64_v != lgl__glReal_glGetTransformFeedbacki64_v)
+			left++;
+		if (glad_glCreateBuffers == lgl__glTrace_glCreateBuffers)
+			glad_glCreateBuffers = lgl__glReal_glCreateBuffers;
+		else if (glad_glCreateBuffers != lgl__glReal_glCreateBuffers)
+			left++;
+		if (glad_glNamedBufferStorage == lgl__glTrace_glNamedBufferStorage)
+			glad_glNamedBufferStorage = lgl__glReal_glNamedBufferStorage;
+		else if (glad_glNamedBufferStorage != lgl__glReal_glNamedBufferStorage)
+			left++;
+		if (glad_glNamedBufferData == lgl__glTrace_glNamedBufferData)
+			glad_glNamedBufferData = lgl__glReal_glNamedBufferData;
+		else if (glad_glNamedBufferData != lgl__glReal_glNamedBufferData)
+			left++;
+		if (glad_glNamedBufferSubData == lgl__glTrace_glNamedBufferSubData)
+			glad_glNamedBufferSubData = lgl__glReal_glNamedBufferSubData;
+		else if (glad_glNamedBufferSubData != lgl__glReal_glNamedBufferSubData)
+			left++;
+		if (glad_glCopyNamedBufferSubData == lgl__glTrace_glCopyNamedBufferSubData)
+			glad_glCopyNamedBufferSubData = lgl__glReal_glCopyNamedBufferSubData;
+		else if (glad_glCopyNamedBufferSubData != lgl__glReal_glCopyNamedBufferSubData)
+			left++;
+		if (glad_glClearNamedBufferData == lgl__glTrace_glClearNamedBufferData)
+			glad_glClearNamedBufferData = lgl__glReal_glClearNamedBufferData;
+		else if (glad_glClearNamedBufferData != lgl__glReal_glClearNamedBufferData)
+			left++;
+		if (glad_glClearNamedBufferSubData == lgl__glTrace_glClearNamedBufferSubData)
+			glad_glClearNamedBufferSubData = lgl__glReal_glClearNamedBufferSubData;
+		else if (glad_glClearNamedBufferSubData != lgl__glReal_glClearNamedBufferSubData)
+			left++;
+		if (glad_glMapNamedBuffer == lgl__glTrace_glMapNamedBuffer)
+			glad_glMapNamedBuffer = lgl__glReal_glMapNamedBuffer;
+		else if (glad_glMapNamedBuffer != lgl__glReal_glMapNamedBuffer)
+			left++;
+		if (glad_glMapNamedBufferRange == lgl__glTrace_glMapNamedBufferRange)
+			glad_glMapNamedBufferRange = lgl__glReal_glMapNamedBufferRange;
+		else if (glad_glMapNamedBufferRange != lgl__glReal_glMapNamedBufferRange)
+			left++;
+		if (glad_glUnmapNamedBuffer == lgl__glTrace_glUnmapNamedBuffer)
+			glad_glUnmapNamedBuffer = lgl__glReal_glUnmapNamedBuffer;
+		else if (glad_glUnmapNamedBuffer != lgl__glReal_glUnmapNamedBuffer)
+			left++;
+		if (glad_glFlushMappedNamedBufferRange == lgl__glTrace_glFlushMappedNamedBufferRange)
+			glad_glFlushMappedNamedBufferRange = lgl__glReal_glFlushMappedNamedBufferRange;
+		else if (glad_glFlushMappedNamedBufferRange != lgl__glReal_glFlushMappedNamedBufferRange)
+			left++;
+		if (glad_glGetNamedBufferParameteriv == lgl__glTrace_glGetNamedBufferParameteriv)
+			glad_glGetNamedBufferParameteriv = lgl__glReal_glGetNamedBufferParameteriv;
+		else if (glad_glGetNamedBufferParameteriv != lgl__glReal_glGetNamedBufferParameteriv)
+			left++;
+		if (glad_glGetNamedBufferParameteri64v == lgl__glTrace_glGetNamedBufferParameteri64v)
+			glad_glGetNamedBufferParameteri64v = lgl__glReal_glGetNamedBufferParameteri64v;
+		else if (glad_glGetNamedBufferParameteri64v != lgl__glReal_glGetNamedBufferParameteri64v)
+			left++;
+		if (glad_glGetNamedBufferPointerv == lgl__glTrace_glGetNamedBufferPointerv)
+			glad_glGetNamedBufferPointerv = lgl__glReal_glGetNamedBufferPointerv;
+		else if (glad_glGetNamedBufferPointerv != lgl__glReal_glGetNamedBufferPointerv)
+			left++;
+		if (glad_glGetNamedBufferSubData == lgl__glTrace_glGetNamedBufferSubData)
+			glad_glGetNamedBufferSubData = lgl__glReal_glGetNamedBufferSubData;
+		else if (glad_glGetNamedBufferSubData != lgl__glReal_glGetNamedBufferSubData)
+			left++;
+		if (glad_glCreateFramebuffers == lgl__glTrace_glCreateFramebuffers)
+			glad_glCreateFramebuffers = lgl__glReal_glCreateFramebuffers;
+		else if (glad_glCreateFramebuffers != lgl__glReal_glCreateFramebuffers)
+			left++;
+		if (glad_glNamedFramebufferRenderbuffer == lgl__glTrace_glNamedFramebufferRenderbuffer)
+			glad_glNamedFramebufferRenderbuffer = lgl__glReal_glNamedFramebufferRenderbuffer;
+		else if (glad_glNamedFramebufferRenderbuffer != lgl__glReal_glNamedFramebufferRenderbuffer)
+			left++;
+		if (glad_glNamedFramebufferParameteri == lgl__glTrace_glNamedFramebufferParameteri)
+			glad_glNamedFramebufferParameteri = lgl__glReal_glNamedFramebufferParameteri;
+		else if (glad_glNamedFramebufferParameteri != lgl__glReal_glNamedFramebufferParameteri)
+			left++;
+		if (glad_glNamedFramebufferTexture == lgl__glTrace_glNamedFramebufferTexture)
+			glad_glNamedFramebufferTexture = lgl__glReal_glNamedFramebufferTexture;
+		else if (glad_glNamedFramebufferTexture != lgl__glReal_glNamedFramebufferTexture)
+			left++;
+		if (glad_glNamedFramebufferTextureLayer == lgl__glTrace_glNamedFramebufferTextureLayer)
+			glad_glNamedFramebufferTextureLayer = lgl__glReal_glNamedFramebufferTextureLayer;
+		else if (glad_glNamedFramebufferTextureLayer != lgl__glReal_glNamedFramebufferTextureLayer)
+			left++;
+		if (glad_glNamedFramebufferDrawBuffer == lgl__glTrace_glNamedFramebufferDrawBuffer)
+			glad_glNamedFramebufferDrawBuffer = lgl__glReal_glNamedFramebufferDrawBuffer;
+		else if (glad_glNamedFramebufferDrawBuffer != lgl__glReal_glNamedFramebufferDrawBuffer)
+			left++;
+		if (glad_glNamedFramebufferDrawBuffers == lgl__glTrace_glNamedFramebufferDrawBuffers)
+			glad_glNamedFramebufferDrawBuffers = lgl__glReal_glNamedFramebufferDrawBuffers;
+		else if (glad_glNamedFramebufferDrawBuffers != lgl__glReal_glNamedFramebufferDrawBuffers)
+			left++;
+		if (glad_glNamedFramebufferReadBuffer == lgl__glTrace_glNamedFramebufferReadBuffer)
+			glad_glNamedFramebufferReadBuffer = lgl__glReal_glNamedFramebufferReadBuffer;
+		else if (glad_glNamedFramebufferReadBuffer != lgl__glReal_glNamedFramebufferReadBuffer)
+			left++;
+		if (glad_glInvalidateNamedFramebufferData == lgl__glTrace_glInvalidateNamedFramebufferData)
+			glad_glInvalidateNamedFramebufferData = lgl__glReal_glInvalidateNamedFramebufferData;
+		else if (glad_glInvalidateNamedFramebufferData != lgl__glReal_glInvalidateNamedFramebufferData)
+			left++;
+		if (glad_glInvalidateNamedFramebufferSubData == lgl__glTrace_glInvalidateNamedFramebufferSubData)
+			glad_glInvalidateNamedFramebufferSubData = lgl__glReal_glInvalidateNamedFramebufferSubData;
+		else if (glad_glInvalidateNamedFramebufferSubData != lgl__glReal_glInvalidateNamedFramebufferSubData)
+			left++;
+		if (glad_glClearNamedFramebufferiv == lgl__glTrace_glClearNamedFramebufferiv)
+			glad_glClearNamedFramebufferiv = lgl__glReal_glClearNamedFramebufferiv;
+		else if (glad_glClearNamedFramebufferiv != lgl__glReal_glClearNamedFramebufferiv)
+			left++;
+		if (glad_glClearNamedFramebufferuiv == lgl__glTrace_glClearNamedFramebufferuiv)
+			glad_glClearNamedFramebufferuiv = lgl__glReal_glClearNamedFramebufferuiv;
+		else if (glad_glClearNamedFramebufferuiv != lgl__glReal_glClearNamedFramebufferuiv)
+			left++;
+		if (glad_glClearNamedFramebufferfv == lgl__glTrace_glClearNamedFramebufferfv)
+			glad_glClearNamedFramebufferfv = lgl__glReal_glClearNamedFramebufferfv;
+		else if (glad_glClearNamedFramebufferfv != lgl__glReal_glClearNamedFramebufferfv)
+			left++;
+		if (glad_glClearNamedFramebufferfi == lgl__glTrace_glClearNamedFramebufferfi)
+			glad_glClearNamedFramebufferfi = lgl__glReal_glClearNamedFramebufferfi;
+		else if (glad_glClearNamedFramebufferfi != lgl__glReal_glClearNamedFramebufferfi)
+			left++;
+		if (glad_glBlitNamedFramebuffer == lgl__glTrace_glBlitNamedFramebuffer)
+			glad_glBlitNamedFramebuffer = lgl__glReal_glBlitNamedFramebuffer;
+		else if (glad_glBlitNamedFramebuffer != lgl__glReal_glBlitNamedFramebuffer)
+			left++;
+		if (glad_glCheckNamedFramebufferStatus == lgl__glTrace_glCheckNamedFramebufferStatus)
+			glad_glCheckNamedFramebufferStatus = lgl__glReal_glCheckNamedFramebufferStatus;
+		else if (glad_glCheckNamedFramebufferStatus != lgl__glReal_glCheckNamedFramebufferStatus)
+			left++;
+		if (glad_glGetNamedFramebufferParameteriv == lgl__glTrace_glGetNamedFramebufferParameteriv)
+			glad_glGetNamedFramebufferParameteriv = lgl__glReal_glGetNamedFramebufferParameteriv;
+		else if (glad_glGetNamedFramebufferParameteriv != lgl__glReal_glGetNamedFramebufferParameteriv)
+			left++;
+		if (glad_glGetNamedFramebufferAttachmentParameteriv == lgl__glTrace_glGetNamedFramebufferAttachmentParameteriv)
+			glad_glGetNamedFramebufferAttachmentParameteriv = lgl__glReal_glGetNamedFramebufferAttachmentParameteriv;
+		else if (glad_glGetNamedFramebufferAttachmentParameteriv != lgl__glReal_glGetNamedFramebufferAttachmentParameteriv)
+			left++;
+		if (glad_glCreateRenderbuffers == lgl__glTrace_glCreateRenderbuffers)
+			glad_glCreateRenderbuffers = lgl__glReal_glCreateRenderbuffers;
+		else if (glad_glCreateRenderbuffers != lgl__glReal_glCreateRenderbuffers)
+			left++;
+		if (glad_glNamedRenderbufferStorage == lgl__glTrace_glNamedRenderbufferStorage)
+			glad_glNamedRenderbufferStorage = lgl__glReal_glNamedRenderbufferStorage;
+		else if (glad_glNamedRenderbufferStorage != lgl__glReal_glNamedRenderbufferStorage)
+			left++;
+		if (glad_glNamedRenderbufferStorageMultisample == lgl__glTrace_glNamedRenderbufferStorageMultisample)
+			glad_glNamedRenderbufferStorageMultisample = lgl__glReal_glNamedRenderbufferStorageMultisample;
+		else if (glad_glNamedRenderbufferStorageMultisample != lgl__glReal_glNamedRenderbufferStorageMultisample)
+			left++;
+		if (glad_glGetNamedRenderbufferParameteriv == lgl__glTrace_glGetNamedRenderbufferParameteriv)
+			glad_glGetNamedRenderbufferParameteriv = lgl__glReal_glGetNamedRenderbufferParameteriv;
+		else if (glad_glGetNamedRenderbufferParameteriv != lgl__glReal_glGetNamedRenderbufferParameteriv)
+			left++;
+		if (glad_glCreateTextures == lgl__glTrace_glCreateTextures)
+			glad_glCreateTextures = lgl__glReal_glCreateTextures;
+		else if (glad_glCreateTextures != lgl__glReal_glCreateTextures)
+			left++;
+		if (glad_glTextureBuffer == lgl__glTrace_glTextureBuffer)
+			glad_glTextureBuffer = lgl__glReal_glTextureBuffer;
+		else if (glad_glTextureBuffer != lgl__glReal_glTextureBuffer)
+			left++;
+		if (glad_glTextureBufferRange == lgl__glTrace_glTextureBufferRange)
+			glad_glTextureBufferRange = lgl__glReal_glTextureBufferRange;
+		else if (glad_glTextureBufferRange != lgl__glReal_glTextureBufferRange)
+			left++;
+		if (glad_glTextureStorage1D == lgl__glTrace_glTextureStorage1D)
+			glad_glTextureStorage1D = lgl__glReal_glTextureStorage1D;
+		else if (glad_glTextureStorage1D != lgl__glReal_glTextureStorage1D)
+			left++;
+		if (glad_glTextureStorage2D == lgl__glTrace_glTextureStorage2D)
+			glad_glTextureStorage2D = lgl__glReal_glTextureStorage2D;
+		else if (glad_glTextureStorage2D != lgl__glReal_glTextureStorage2D)
+			left++;
+		if (glad_glTextureStorage3D == lgl__glTrace_glTextureStorage3D)
+			glad_glTextureStorage3D = lgl__glReal_glTextureStorage3D;
+		else if (glad_glTextureStorage3D != lgl__glReal_glTextureStorage3D)
+			left++;
+		if (glad_glTextureStorage2DMultisample == lgl__glTrace_glTextureStorage2DMultisample)
+			glad_glTextureStorage2DMultisample = lgl__glReal_glTextureStorage2DMultisample;
+		else if (glad_glTextureStorage2DMultisample != lgl__glReal_glTextureStorage2DMultisample)
+			left++;
+		if (glad_glTextureStorage3DMultisample == lgl__glTrace_glTextureStorage3DMultisample)
+			glad_glTextureStorage3DMultisample = lgl__glReal_glTextureStorage3DMultisample;
+		else if (glad_glTextureStorage3DMultisample != lgl__glReal_glTextureStorage3DMultisample)
+			left++;
+		if (glad_glTextureSubImage1D == lgl__glTrace_glTextureSubImage1D)
+			glad_glTextureSubImage1D = lgl__glReal_glTextureSubImage1D;
+		else if (glad_glTextureSubImage1D != lgl__glReal_glTextureSubImage1D)
+			left++;
+		if (glad_glTextureSubImage2D == lgl__glTrace_glTextureSubImage2D)
+			glad_glTextureSubImage2D = lgl__glReal_glTextureSubImage2D;
+		else if (glad_glTextureSubImage2D != lgl__glReal_glTextureSubImage2D)
+			left++;
+		if (glad_glTextureSubImage3D == lgl__glTrace_glTextureSubImage3D)
+			glad_glTextureSubImage3D = lgl__glReal_glTextureSubImage3D;
+		else if (glad_glTextureSubImage3D != lgl__glReal_glTextureSubImage3D)
+			left++;
+		if (glad_glCompressedTextureSubImage1D == lgl__glTrace_glCompressedTextureSubImage1D)
+			glad_glCompressedTextureSubImage1D = lgl__glReal_glCompressedTextureSubImage1D;
+		else if (glad_glCompressedTextureSubImage1D != lgl__glReal_glCompressedTextureSubImage1D)
+			left++;
+		if (glad_glCompressedTextureSubImage2D == lgl__glTrace_glCompressedTextureSubImage2D)
+			glad_glCompressedTextureSubImage2D = lgl__glReal_glCompressedTextureSubImage2D;
+		else if (glad_glCompressedTextureSubImage2D != lgl__glReal_glCompressedTextureSubImage2D)
+			left++;
+		if (glad_glCompressedTextureSubImage3D == lgl__glTrace_glCompressedTextureSubImage3D)
+			glad_glCompressedTextureSubImage3D = lgl__glReal_glCompressedTextureSubImage3D;
+		else if (glad_glCompressedTextureSubImage3D != lgl__glReal_glCompressedTextureSubImage3D)
+			left++;
+		if (glad_glCopyTextureSubImage1D == lgl__glTrace_glCopyTextureSubImage1D)
+			glad_glCopyTextureSubImage1D = lgl__glReal_glCopyTextureSubImage1D;
+		else if (glad_glCopyTextureSubImage1D != lgl__glReal_glCopyTextureSubImage1D)
+			left++;
+		if (glad_glCopyTextureSubImage2D == lgl__glTrace_glCopyTextureSubImage2D)
+			glad_glCopyTextureSubImage2D = lgl__glReal_glCopyTextureSubImage2D;
+		else if (glad_glCopyTextureSubImage2D != lgl__glReal_glCopyTextureSubImage2D)
+			left++;
+		if (glad_glCopyTextureSubImage3D == lgl__glTrace_glCopyTextureSubImage3D)
+			glad_glCopyTextureSubImage3D = lgl__glReal_glCopyTextureSubImage3D;
+		else if (glad_glCopyTextureSubImage3D != lgl__glReal_glCopyTextureSubImage3D)
+			left++;
+		if (glad_glTextureParameterf == lgl__glTrace_glTextureParameterf)
+			glad_glTextureParameterf = lgl__glReal_glTextureParameterf;
+		else if (glad_glTextureParameterf != lgl__glReal_glTextureParameterf)
+			left++;
+		if (glad_glTextureParameterfv == lgl__glTrace_glTextureParameterfv)
+			glad_glTextureParameterfv = lgl__glReal_glTextureParameterfv;
+		else if (glad_glTextureParameterfv != lgl__glReal_glTextureParameterfv)
+			left++;
+		if (glad_glTextureParameteri == lgl__glTrace_glTextureParameteri)
+			glad_glTextureParameteri = lgl__glReal_glTextureParameteri;
+		else if (glad_glTextureParameteri != lgl__glReal_glTextureParameteri)
+			left++;
+		if (glad_glTextureParameterIiv == lgl__glTrace_glTextureParameterIiv)
+			glad_glTextureParameterIiv = lgl__glReal_glTextureParameterIiv;
+		else if (glad_glTextureParameterIiv != lgl__glReal_glTextureParameterIiv)
+			left++;
+		if (glad_glTextureParameterIuiv == lgl__glTrace_glTextureParameterIuiv)
+			glad_glTextureParameterIuiv = lgl__glReal_glTextureParameterIuiv;
+		else if (glad_glTextureParameterIuiv != lgl__glReal_glTextureParameterIuiv)
+			left++;
+		if (glad_glTextureParameteriv == lgl__glTrace_glTextureParameteriv)
+			glad_glTextureParameteriv = lgl__glReal_glTextureParameteriv;
+		else if (glad_glTextureParameteriv != lgl__glReal_glTextureParameteriv)
+			left++;
+		if (glad_glGenerateTextureMipmap == lgl__glTrace_glGenerateTextureMipmap)
+			glad_glGenerateTextureMipmap = lgl__glReal_glGenerateTextureMipmap;
+		else if (glad_glGenerateTextureMipmap != lgl__glReal_glGenerateTextureMipmap)
+			left++;
+		if (glad_glBindTextureUnit == lgl__glTrace_glBindTextureUnit)
+			glad_glBindTextureUnit = lgl__glReal_glBindTextureUnit;
+		else if (glad_glBindTextureUnit != lgl__glReal_glBindTextureUnit)
+			left++;
+		if (glad_glGetTextureImage == lgl__glTrace_glGetTextureImage)
+			glad_glGetTextureImage = lgl__glReal_glGetTextureImage;
+		else if (glad_glGetTextureImage != lgl__glReal_glGetTextureImage)
+			left++;
+		if (glad_glGetCompressedTextureImage == lgl__glTrace_glGetCompressedTextureImage)
+			glad_glGetCompressedTextureImage = lgl__glReal_glGetCompressedTextureImage;
+		else if (glad_glGetCompressedTextureImage != lgl__glReal_glGetCompressedTextureImage)
+			left++;
+		if (glad_glGetTextureLevelParameterfv == lgl__glTrace_glGetTextureLevelParameterfv)
+			glad_glGetTextureLevelParameterfv = lgl__glReal_glGetTextureLevelParameterfv;
+		else if (glad_glGetTextureLevelParameterfv != lgl__glReal_glGetTextureLevelParameterfv)
+			left++;
+		if (glad_glGetTextureLevelParameteriv == lgl__glTrace_glGetTextureLevelParameteriv)
+			glad_glGetTextureLevelParameteriv = lgl__glReal_glGetTextureLevelParameteriv;
+		else if (glad_glGetTextureLevelParameteriv != lgl__glReal_glGetTextureLevelParameteriv)
+			left++;
+		if (glad_glGetTextureParameterfv == lgl__glTrace_glGetTextureParameterfv)
+			glad_glGetTextureParameterfv = lgl__glReal_glGetTextureParameterfv;
+		else if (glad_glGetTextureParameterfv != lgl__glReal_glGetTextureParameterfv)
+			left++;
+		if (glad_glGetTextureParameterIiv == lgl__glTrace_glGetTextureParameterIiv)
+			glad_glGetTextureParameterIiv = lgl__glReal_glGetTextureParameterIiv;
+		else if (glad_glGetTextureParameterIiv != lgl__glReal_glGetTextureParameterIiv)
+			left++;
+		if (glad_glGetTextureParameterIuiv == lgl__glTrace_glGetTextureParameterIuiv)
+			glad_glGetTextureParameterIuiv = lgl__glReal_glGetTextureParameterIuiv;
+		else if (glad_glGetTextureParameterIuiv != lgl__glReal_glGetTextureParameterIuiv)
+			left++;
+		if (glad_glGetTextureParameteriv == lgl__glTrace_glGetTextureParameteriv)
+			glad_glGetTextureParameteriv = lgl__glReal_glGetTextureParameteriv;
+		else if (glad_glGetTextureParameteriv != lgl__glReal_glGetTextureParameteriv)
+			left++;
+		if (glad_glCreateVertexArrays == lgl__glTrace_glCreateVertexArrays)
+			glad_glCreateVertexArrays = lgl__glReal_glCreateVertexArrays;
+		else if (glad_glCreateVertexArrays != lgl__glReal_glCreateVertexArrays)
+			left++;
+		if (glad_glDisableVertexArrayAttrib == lgl__glTrace_glDisableVertexArrayAttrib)
+			glad_glDisableVertexArrayAttrib = lgl__glReal_glDisableVertexArrayAttrib;
+		else if (glad_glDisableVertexArrayAttrib != lgl__glReal_glDisableVertexArrayAttrib)
+			left++;
+		if (glad_glEnableVertexArrayAttrib == lgl__glTrace_glEnableVertexArrayAttrib)
+			glad_glEnableVertexArrayAttrib = lgl__glReal_glEnableVertexArrayAttrib;
+		else if (glad_glEnableVertexArrayAttrib != lgl__glReal_glEnableVertexArrayAttrib)
+			left++;
+		if (glad_glVertexArrayElementBuffer == lgl__glTrace_glVertexArrayElementBuffer)
+			glad_glVertexArrayElementBuffer = lgl__glReal_glVertexArrayElementBuffer;
+		else if (glad_glVertexArrayElementBuffer != lgl__glReal_glVertexArrayElementBuffer)
+			left++;
+		if (glad_glVertexArrayVertexBuffer == lgl__glTrace_glVertexArrayVertexBuffer)
+			glad_glVertexArrayVertexBuffer = lgl__glReal_glVertexArrayVertexBuffer;
+		else if (glad_glVertexArrayVertexBuffer != lgl__glReal_glVertexArrayVertexBuffer)
+			left++;
+		if (glad_glVertexArrayVertexBuffers == lgl__glTrace_glVertexArrayVertexBuffers)
+			glad_glVertexArrayVertexBuffers = lgl__glReal_glVertexArrayVertexBuffers;
+		else if (glad_glVertexArrayVertexBuffers != lgl__glReal_glVertexArrayVertexBuffers)
+			left++;
+		if (glad_glVertexArrayAttribBinding == lgl__glTrace_glVertexArrayAttribBinding)
+			glad_glVertexArrayAttribBinding = lgl__glReal_glVertexArrayAttribBinding;
+		else if (glad_glVertexArrayAttribBinding != lgl__glReal_glVertexArrayAttribBinding)
+			left++;
+		if (glad_glVertexArrayAttribFormat == lgl__glTrace_glVertexArrayAttribFormat)
+			glad_glVertexArrayAttribFormat = lgl__glReal_glVertexArrayAttribFormat;
+		else if (glad_glVertexArrayAttribFormat != lgl__glReal_glVertexArrayAttribFormat)
+			left++;
+		if (glad_glVertexArrayAttribIFormat == lgl__glTrace_glVertexArrayAttribIFormat)
+			glad_glVertexArrayAttribIFormat = lgl__glReal_glVertexArrayAttribIFormat;
+		else if (glad_glVertexArrayAttribIFormat != lgl__glReal_glVertexArrayAttribIFormat)
+			left++;
+		if (glad_glVertexArrayAttribLFormat == lgl__glTrace_glVertexArrayAttribLFormat)
+			glad_glVertexArrayAttribLFormat = lgl__glReal_glVertexArrayAttribLFormat;
+		else if (glad_glVertexArrayAttribLFormat != lgl__glReal_glVertexArrayAttribLFormat)
+			left++;
+		if (glad_glVertexArrayBindingDivisor == lgl__glTrace_glVertexArrayBindingDivisor)
+			glad_glVertexArrayBindingDivisor = lgl__glReal_glVertexArrayBindingDivisor;
+		else if (glad_glVertexArrayBindingDivisor != lgl__glReal_glVertexArrayBindingDivisor)
+			left++;
+		if (glad_glGetVertexArrayiv == lgl__glTrace_glGetVertexArrayiv)
+			glad_glGetVertexArrayiv = lgl__glReal_glGetVertexArrayiv;
+		else if (glad_glGetVertexArrayiv != lgl__glReal_glGetVertexArrayiv)
+			left++;
+		if (glad_glGetVertexArrayIndexediv == lgl__glTrace_glGetVertexArrayIndexediv)
+			glad_glGetVertexArrayIndexediv = lgl__glReal_glGetVertexArrayIndexediv;
+		else if (glad_glGetVertexArrayIndexediv != lgl__glReal_glGetVertexArrayIndexediv)
+			left++;
+		if (glad_glGetVertexArrayIndexed64iv == lgl__glTrace_glGetVertexArrayIndexed64iv)
+			glad_glGetVertexArrayIndexed64iv = lgl__glReal_glGetVertexArrayIndexed64iv;
+		else if (glad_glGetVertexArrayIndexed64iv != lgl__glReal_glGetVertexArrayIndexed64iv)
+			left++;
+		if (glad_glCreateSamplers == lgl__glTrace_glCreateSamplers)
+			glad_glCreateSamplers = lgl__glReal_glCreateSamplers;
+		else if (glad_glCreateSamplers != lgl__glReal_glCreateSamplers)
+			left++;
+		if (glad_glCreateProgramPipelines == lgl__glTrace_glCreateProgramPipelines)
+			glad_glCreateProgramPipelines = lgl__glReal_glCreateProgramPipelines;
+		else if (glad_glCreateProgramPipelines != lgl__glReal_glCreateProgramPipelines)
+			left++;
+		if (glad_glCreateQueries == lgl__glTrace_glCreateQueries)
+			glad_glCreateQueries = lgl__glReal_glCreateQueries;
+		else if (glad_glCreateQueries != lgl__glReal_glCreateQueries)
+			left++;
+		if (glad_glGetQueryBufferObjecti64v == lgl__glTrace_glGetQueryBufferObjecti64v)
+			glad_glGetQueryBufferObjecti64v = lgl__glReal_glGetQueryBufferObjecti64v;
+		else if (glad_glGetQueryBufferObjecti64v != lgl__glReal_glGetQueryBufferObjecti64v)
+			left++;
+		if (glad_glGetQueryBufferObjectiv == lgl__glTrace_glGetQueryBufferObjectiv)
+			glad_glGetQueryBufferObjectiv = lgl__glReal_glGetQueryBufferObjectiv;
+		else if (glad_glGetQueryBufferObjectiv != lgl__glReal_glGetQueryBufferObjectiv)
+			left++;
+		if (glad_glGetQueryBufferObjectui64v == lgl__glTrace_glGetQueryBufferObjectui64v)
+			glad_glGetQueryBufferObjectui64v = lgl__glReal_glGetQueryBufferObjectui64v;
+		else if (glad_glGetQueryBufferObjectui64v != lgl__glReal_glGetQueryBufferObjectui64v)
+			left++;
+		if (glad_glGetQueryBufferObjectuiv == lgl__glTrace_glGetQueryBufferObjectuiv)
+			glad_glGetQueryBufferObjectuiv = lgl__glReal_glGetQueryBufferObjectuiv;
+		else if (glad_glGetQueryBufferObjectuiv != lgl__glReal_glGetQueryBufferObjectuiv)
+			left++;
+		if (glad_glMemoryBarrierByRegion == lgl__glTrace_glMemoryBarrierByRegion)
+			glad_glMemoryBarrierByRegion = lgl__glReal_glMemoryBarrierByRegion;
+		else if (glad_glMemoryBarrierByRegion != lgl__glReal_glMemoryBarrierByRegion)
+			left++;
+		if (glad_glGetTextureSubImage == lgl__glTrace_glGetTextureSubImage)
+			glad_glGetTextureSubImage = lgl__glReal_glGetTextureSubImage;
+		else if (glad_glGetTextureSubImage != lgl__glReal_glGetTextureSubImage)
+			left++;
+		if (glad_glGetCompressedTextureSubImage == lgl__glTrace_glGetCompressedTextureSubImage)
+			glad_glGetCompressedTextureSubImage = lgl__glReal_glGetCompressedTextureSubImage;
+		else if (glad_glGetCompressedTextureSubImage != lgl__glReal_glGetCompressedTextureSubImage)
+			left++;
+		if (glad_glGetGraphicsResetStatus == lgl__glTrace_glGetGraphicsResetStatus)
+			glad_glGetGraphicsResetStatus = lgl__glReal_glGetGraphicsResetStatus;
+		else if (glad_glGetGraphicsResetStatus != lgl__glReal_glGetGraphicsResetStatus)
+			left++;
+		if (glad_glGetnCompressedTexImage == lgl__glTrace_glGetnCompressedTexImage)
+			glad_glGetnCompressedTexImage = lgl__glReal_glGetnCompressedTexImage;
+		else if (glad_glGetnCompressedTexImage != lgl__glReal_glGetnCompressedTexImage)
+			left++;
+		if (glad_glGetnTexImage == lgl__glTrace_glGetnTexImage)
+			glad_glGetnTexImage = lgl__glReal_glGetnTexImage;
+		else if (glad_glGetnTexImage != lgl__glReal_glGetnTexImage)
+			left++;
+		if (glad_glGetnUniformdv == lgl__glTrace_glGetnUniformdv)
+			glad_glGetnUniformdv = lgl__glReal_glGetnUniformdv;
+		else if (glad_glGetnUniformdv != lgl__glReal_glGetnUniformdv)
+			left++;
+		if (glad_glGetnUniformfv == lgl__glTrace_glGetnUniformfv)
+			glad_glGetnUniformfv = lgl__glReal_glGetnUniformfv;
+		else if (glad_glGetnUniformfv != lgl__glReal_glGetnUniformfv)
+			left++;
+		if (glad_glGetnUniformiv == lgl__glTrace_glGetnUniformiv)
+			glad_glGetnUniformiv = lgl__glReal_glGetnUniformiv;
+		else if (glad_glGetnUniformiv != lgl__glReal_glGetnUniformiv)
+			left++;
+		if (glad_glGetnUniformuiv == lgl__glTrace_glGetnUniformuiv)
+			glad_glGetnUniformuiv = lgl__glReal_glGetnUniformuiv;
+		else if (glad_glGetnUniformuiv != lgl__glReal_glGetnUniformuiv)
+			left++;
+		if (glad_glReadnPixels == lgl__glTrace_glReadnPixels)
+			glad_glReadnPixels = lgl__glReal_glReadnPixels;
+		else if (glad_glReadnPixels != lgl__glReal_glReadnPixels)
+			left++;
+		if (glad_glGetnMapdv == lgl__glTrace_glGetnMapdv)
+			glad_glGetnMapdv = lgl__glReal_glGetnMapdv;
+		else if (glad_glGetnMapdv != lgl__glReal_glGetnMapdv)
+			left++;
+		if (glad_glGetnMapfv == lgl__glTrace_glGetnMapfv)
+			glad_glGetnMapfv = lgl__glReal_glGetnMapfv;
+		else if (glad_glGetnMapfv != lgl__glReal_glGetnMapfv)
+			left++;
+		if (glad_glGetnMapiv == lgl__glTrace_glGetnMapiv)
+			glad_glGetnMapiv = lgl__glReal_glGetnMapiv;
+		else if (glad_glGetnMapiv != lgl__glReal_glGetnMapiv)
+			left++;
+		if (glad_glGetnPixelMapfv == lgl__glTrace_glGetnPixelMapfv)
+			glad_glGetnPixelMapfv = lgl__glReal_glGetnPixelMapfv;
+		else if (glad_glGetnPixelMapfv != lgl__glReal_glGetnPixelMapfv)
+			left++;
+		if (glad_glGetnPixelMapuiv == lgl__glTrace_glGetnPixelMapuiv)
+			glad_glGetnPixelMapuiv = lgl__glReal_glGetnPixelMapuiv;
+		else if (glad_glGetnPixelMapuiv != lgl__glReal_glGetnPixelMapuiv)
+			left++;
+		if (glad_glGetnPixelMapusv == lgl__glTrace_glGetnPixelMapusv)
+			glad_glGetnPixelMapusv = lgl__glReal_glGetnPixelMapusv;
+		else if (glad_glGetnPixelMapusv != lgl__glReal_glGetnPixelMapusv)
+			left++;
+		if (glad_glGetnPolygonStipple == lgl__glTrace_glGetnPolygonStipple)
+			glad_glGetnPolygonStipple = lgl__glReal_glGetnPolygonStipple;
+		else if (glad_glGetnPolygonStipple != lgl__glReal_glGetnPolygonStipple)
+			left++;
+		if (glad_glGetnColorTable == lgl__glTrace_glGetnColorTable)
+			glad_glGetnColorTable = lgl__glReal_glGetnColorTable;
+		else if (glad_glGetnColorTable != lgl__glReal_glGetnColorTable)
+			left++;
+		if (glad_glGetnConvolutionFilter == lgl__glTrace_glGetnConvolutionFilter)
+			glad_glGetnConvolutionFilter = lgl__glReal_glGetnConvolutionFilter;
+		else if (glad_glGetnConvolutionFilter != lgl__glReal_glGetnConvolutionFilter)
+			left++;
+		if (glad_glGetnSeparableFilter == lgl__glTrace_glGetnSeparableFilter)
+			glad_glGetnSeparableFilter = lgl__glReal_glGetnSeparableFilter;
+		else if (glad_glGetnSeparableFilter != lgl__glReal_glGetnSeparableFilter)
+			left++;
+		if (glad_glGetnHistogram == lgl__glTrace_glGetnHistogram)
+			glad_glGetnHistogram = lgl__glReal_glGetnHistogram;
+		else if (glad_glGetnHistogram != lgl__glReal_glGetnHistogram)
+			left++;
+		if (glad_glGetnMinmax == lgl__glTrace_glGetnMinmax)
+			glad_glGetnMinmax = lgl__glReal_glGetnMinmax;
+		else if (glad_glGetnMinmax != lgl__glReal_glGetnMinmax)
+			left++;
+		if (glad_glTextureBarrier == lgl__glTrace_glTextureBarrier)
+			glad_glTextureBarrier = lgl__glReal_glTextureBarrier;
+		else if (glad_glTextureBarrier != lgl__glReal_glTextureBarrier)
+			left++;
+		if (glad_glSpecializeShader == lgl__glTrace_glSpecializeShader)
+			glad_glSpecializeShader = lgl__glReal_glSpecializeShader;
+		else if (glad_glSpecializeShader != lgl__glReal_glSpecializeShader)
+			left++;
+		if (glad_glMultiDrawArraysIndirectCount == lgl__glTrace_glMultiDrawArraysIndirectCount)
+			glad_glMultiDrawArraysIndirectCount = lgl__glReal_glMultiDrawArraysIndirectCount;
+		else if (glad_glMultiDrawArraysIndirectCount != lgl__glReal_glMultiDrawArraysIndirectCount)
+			left++;
+		if (glad_glMultiDrawElementsIndirectCount == lgl__glTrace_glMultiDrawElementsIndirectCount)
+			glad_glMultiDrawElementsIndirectCount = lgl__glReal_glMultiDrawElementsIndirectCount;
+		else if (glad_glMultiDrawElementsIndirectCount != lgl__glReal_glMultiDrawElementsIndirectCount)
+			left++;
+		if (glad_glPolygonOffsetClamp == lgl__glTrace_glPolygonOffsetClamp)
+			glad_glPolygonOffsetClamp = lgl__glReal_glPolygonOffsetClamp;
+		else if (glad_glPolygonOffsetClamp != lgl__glReal_glPolygonOffsetClamp)
+			left++;
+	}
+	return left;
+}
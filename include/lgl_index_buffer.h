@@ -0,0 +1,411 @@
+#ifndef __LGL_INDEX_BUFFER__
+#define __LGL_INDEX_BUFFER__
+
+#include <stddef.h>
+
+/* Index buffer builder: stores indices with the smallest GL type that can
+ * address every vertex, optionally as triangle strips joined by the fixed
+ * primitive restart index. Index lists can also be saved to disk with a
+ * delta + Stream VByte encoding, decoded at load time with SSSE3 when
+ * built with -mssse3 (perf/2.vertex_packing is) and a scalar loop
+ * otherwise. */
+
+typedef struct {
+	unsigned int mode;  /* GL_TRIANGLES or GL_TRIANGLE_STRIP */
+	unsigned int type;  /* GL_UNSIGNED_BYTE, _SHORT or _INT */
+	int indexSize;      /* bytes per index */
+	int count;
+	int vertexCount;
+	void *data;
+} lgl_IndexBuffer;
+
+/* picks the index type for `vertexCount` vertices; with primitive restart
+ * the largest value of the type is reserved */
+unsigned int lgl_indexTypeFor(int vertexCount, int primitiveRestart);
+
+/* builds a triangle list */
+int lgl_indexBufferBuild(lgl_IndexBuffer *ib, const unsigned int *indices,
+			 int count, int vertexCount);
+
+/* converts a triangle list into strips; the list is kept if the strips
+ * would not be smaller */
+int lgl_indexBufferBuildStrips(lgl_IndexBuffer *ib,
+			       const unsigned int *indices, int count,
+			       int vertexCount);
+
+void lgl_indexBufferFree(lgl_IndexBuffer *ib);
+
+size_t lgl_indexBufferSize(const lgl_IndexBuffer *ib);
+
+/* glBufferData into the bound GL_ELEMENT_ARRAY_BUFFER */
+void lgl_indexBufferUpload(const lgl_IndexBuffer *ib, unsigned int usage);
+
+void lgl_indexBufferDraw(const lgl_IndexBuffer *ib);
+
+/* largest size lgl_indexEncode can produce for `count` indices */
+size_t lgl_indexEncodeBound(int count);
+
+size_t lgl_indexEncode(const unsigned int *indices, int count,
+		       unsigned char *out);
+
+/* returns 0 if `in` is too short for `count` indices */
+int lgl_indexDecode(const unsigned char *in, size_t size,
+		    unsigned int *out, int count);
+
+int lgl_indexBufferSave(const lgl_IndexBuffer *ib, const char *path);
+
+/* returns 0 if the file is not an index list saved by
+ * lgl_indexBufferSave, or has an index out of range of its vertices */
+int lgl_indexBufferLoad(lgl_IndexBuffer *ib, const char *path);
+
+#endif /*__LGL_INDEX_BUFFER__*/
+
+#ifdef LGL_INDEX_BUFFER_IMPLEMENTATION
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+
+#define LGL__INDEX_MAGIC 0x494c474cu /* "LGLI" */
+#define LGL__RESTART 0xffffffffu
+#define LGL__INDEX_MAX_COUNT 0x1fffffffu /* keeps every size below in range */
+
+unsigned int lgl_indexTypeFor(int vertexCount, int primitiveRestart)
+{
+	int reserved = primitiveRestart ? 1 : 0;
+
+	if (vertexCount <= 0x100 - reserved) return GL_UNSIGNED_BYTE;
+	if (vertexCount <= 0x10000 - reserved) return GL_UNSIGNED_SHORT;
+	return GL_UNSIGNED_INT;
+}
+
+static int lgl__indexStore(lgl_IndexBuffer *ib, unsigned int mode,
+			   const unsigned int *indices, int count,
+			   int vertexCount)
+{
+	int i;
+
+	ib->mode = mode;
+	ib->type = lgl_indexTypeFor(vertexCount, mode != GL_TRIANGLES);
+	ib->indexSize = ib->type == GL_UNSIGNED_BYTE ? 1
+		: ib->type == GL_UNSIGNED_SHORT ? 2 : 4;
+	ib->count = count;
+	ib->vertexCount = vertexCount;
+	ib->data = malloc((size_t)ib->indexSize * (count > 0 ? count : 1));
+	if (!ib->data) return 0;
+
+	/* the restart index narrows to the largest value of the type */
+	for (i = 0; i < count; i++) {
+		switch (ib->indexSize) {
+		case 1: ((unsigned char *)ib->data)[i] = (unsigned char)indices[i]; break;
+		case 2: ((unsigned short *)ib->data)[i] = (unsigned short)indices[i]; break;
+		default: ((unsigned int *)ib->data)[i] = indices[i]; break;
+		}
+	}
+
+	return 1;
+}
+
+int lgl_indexBufferBuild(lgl_IndexBuffer *ib, const unsigned int *indices,
+			 int count, int vertexCount)
+{
+	return lgl__indexStore(ib, GL_TRIANGLES, indices, count, vertexCount);
+}
+
+int lgl_indexBufferBuildStrips(lgl_IndexBuffer *ib,
+			       const unsigned int *indices, int count,
+			       int vertexCount)
+{
+	unsigned int *strips;
+	int i, n = 0, length = 0, ok;
+
+	/* a strip costs at most one restart plus three indices per triangle */
+	strips = malloc(sizeof(unsigned int) * (count / 3 * 4 + 1));
+	if (!strips) return 0;
+
+	for (i = 0; i + 2 < count; i += 3) {
+		const unsigned int *tri = indices + i;
+		int r, extended = 0;
+
+		if (length >= 3) {
+			/* the next strip triangle is (x, y, c) after an even number
+			 * of triangles and (y, x, c) after an odd one, keeping the
+			 * winding of the list */
+			unsigned int x = strips[n - 2], y = strips[n - 1];
+			unsigned int first = (length & 1) ? y : x;
+			unsigned int second = (length & 1) ? x : y;
+
+			for (r = 0; r < 3; r++) {
+				if (tri[r] == first && tri[(r + 1) % 3] == second) {
+					strips[n++] = tri[(r + 2) % 3];
+					length++;
+					extended = 1;
+					break;
+				}
+			}
+		}
+		if (extended) continue;
+
+		if (n > 0) strips[n++] = LGL__RESTART;
+		strips[n++] = tri[0];
+		strips[n++] = tri[1];
+		strips[n++] = tri[2];
+		length = 3;
+	}
+
+	if (n >= count)
+		ok = lgl__indexStore(ib, GL_TRIANGLES, indices, count, vertexCount);
+	else
+		ok = lgl__indexStore(ib, GL_TRIANGLE_STRIP, strips, n, vertexCount);
+
+	free(strips);
+	return ok;
+}
+
+void lgl_indexBufferFree(lgl_IndexBuffer *ib)
+{
+	free(ib->data);
+	ib->data = NULL;
+	ib->count = 0;
+}
+
+size_t lgl_indexBufferSize(const lgl_IndexBuffer *ib)
+{
+	return (size_t)ib->indexSize * ib->count;
+}
+
+void lgl_indexBufferUpload(const lgl_IndexBuffer *ib, unsigned int usage)
+{
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, lgl_indexBufferSize(ib),
+		     ib->data, usage);
+}
+
+void lgl_indexBufferDraw(const lgl_IndexBuffer *ib)
+{
+	if (ib->mode == GL_TRIANGLES) {
+		glDrawElements(GL_TRIANGLES, ib->count, ib->type, 0);
+		return;
+	}
+
+	glEnable(GL_PRIMITIVE_RESTART_FIXED_INDEX);
+	glDrawElements(ib->mode, ib->count, ib->type, 0);
+	glDisable(GL_PRIMITIVE_RESTART_FIXED_INDEX);
+}
+
+/* encoding
+ ************/
+size_t lgl_indexEncodeBound(int count)
+{
+	return (size_t)(count + 3) / 4 + (size_t)count * 4;
+}
+
+size_t lgl_indexEncode(const unsigned int *indices, int count,
+		       unsigned char *out)
+{
+	unsigned char *control = out;
+	unsigned char *data = out + (count + 3) / 4;
+	unsigned int previous = 0;
+	int i;
+
+	memset(control, 0, (count + 3) / 4);
+
+	for (i = 0; i < count; i++) {
+		/* zigzag-encoded delta to the previous index */
+		int delta = (int)(indices[i] - previous);
+		unsigned int value = ((unsigned int)delta << 1)
+			^ (unsigned int)-(int)((unsigned int)delta >> 31);
+		int bytes = value < 0x100 ? 1 : value < 0x10000 ? 2
+			: value < 0x1000000 ? 3 : 4;
+		int b;
+
+		control[i / 4] |= (unsigned char)((bytes - 1) << ((i % 4) * 2));
+		for (b = 0; b < bytes; b++)
+			*data++ = (unsigned char)(value >> (b * 8));
+		previous = indices[i];
+	}
+
+	return (size_t)(data - out);
+}
+
+#if defined(__SSSE3__)
+static unsigned char lgl__vbyteShuffle[256][16];
+static unsigned char lgl__vbyteLength[256];
+static int lgl__vbyteReady;
+
+static void lgl__vbyteInit(void)
+{
+	int control, lane, b;
+
+	for (control = 0; control < 256; control++) {
+		int offset = 0;
+
+		for (lane = 0; lane < 4; lane++) {
+			int bytes = ((control >> (lane * 2)) & 3) + 1;
+
+			for (b = 0; b < 4; b++)
+				lgl__vbyteShuffle[control][lane * 4 + b] =
+					b < bytes ? (unsigned char)(offset + b) : 0x80;
+			offset += bytes;
+		}
+		lgl__vbyteLength[control] = (unsigned char)offset;
+	}
+	lgl__vbyteReady = 1;
+}
+#endif
+
+int lgl_indexDecode(const unsigned char *in, size_t size,
+		    unsigned int *out, int count)
+{
+	const unsigned char *control = in;
+	const unsigned char *data = in + (count + 3) / 4;
+	const unsigned char *end = in + size;
+	unsigned int previous = 0;
+	int i = 0;
+
+	if ((size_t)(count + 3) / 4 > size) return 0;
+
+#if defined(__SSSE3__)
+	if (!lgl__vbyteReady) lgl__vbyteInit();
+
+	{
+		__m128i prev = _mm_setzero_si128();
+		__m128i one = _mm_set1_epi32(1);
+
+		/* four indices per control byte while a full 16-byte load fits */
+		for (; i + 4 <= count && end - data >= 16; i += 4) {
+			unsigned char c = control[i / 4];
+			__m128i v = _mm_loadu_si128((const __m128i *)data);
+
+			v = _mm_shuffle_epi8(v, _mm_loadu_si128(
+				(const __m128i *)lgl__vbyteShuffle[c]));
+			data += lgl__vbyteLength[c];
+
+			/* undo zigzag, then prefix-sum the deltas */
+			v = _mm_xor_si128(_mm_srli_epi32(v, 1),
+					  _mm_sub_epi32(_mm_setzero_si128(),
+							_mm_and_si128(v, one)));
+			v = _mm_add_epi32(v, _mm_slli_si128(v, 4));
+			v = _mm_add_epi32(v, _mm_slli_si128(v, 8));
+			v = _mm_add_epi32(v, prev);
+			prev = _mm_shuffle_epi32(v, _MM_SHUFFLE(3, 3, 3, 3));
+
+			_mm_storeu_si128((__m128i *)(out + i), v);
+		}
+		previous = (unsigned int)_mm_cvtsi128_si32(prev);
+	}
+#endif
+
+	for (; i < count; i++) {
+		int bytes = ((control[i / 4] >> ((i % 4) * 2)) & 3) + 1, b;
+		unsigned int value = 0;
+
+		if (end - data < bytes) return 0;
+		for (b = 0; b < bytes; b++)
+			value |= (unsigned int)*data++ << (b * 8);
+
+		previous += (value >> 1) ^ (unsigned int)-(int)(value & 1);
+		out[i] = previous;
+	}
+
+	return data <= end;
+}
+
+/* files
+ *********/
+int lgl_indexBufferSave(const lgl_IndexBuffer *ib, const char *path)
+{
+	unsigned int header[5], *indices;
+	unsigned char *encoded;
+	size_t encodedSize = 0;
+	FILE *fptr = NULL;
+	int i, ok = 0;
+
+	indices = malloc(sizeof(unsigned int) * (ib->count + 1));
+	encoded = malloc(lgl_indexEncodeBound(ib->count) + 1);
+	if (!indices || !encoded) goto defer;
+
+	/* widen back to 32 bits so the restart index reads as 0xffffffff */
+	for (i = 0; i < ib->count; i++) {
+		unsigned int max = ib->indexSize == 1 ? 0xffu
+			: ib->indexSize == 2 ? 0xffffu : 0xffffffffu;
+		unsigned int value = ib->indexSize == 1 ? ((unsigned char *)ib->data)[i]
+			: ib->indexSize == 2 ? ((unsigned short *)ib->data)[i]
+			: ((unsigned int *)ib->data)[i];
+
+		indices[i] = (value == max && ib->mode != GL_TRIANGLES)
+			? LGL__RESTART : value;
+	}
+	encodedSize = lgl_indexEncode(indices, ib->count, encoded);
+
+	header[0] = LGL__INDEX_MAGIC;
+	header[1] = ib->mode;
+	header[2] = (unsigned int)ib->count;
+	header[3] = (unsigned int)ib->vertexCount;
+	header[4] = (unsigned int)encodedSize;
+
+	fptr = fopen(path, "wb");
+	if (!fptr) goto defer;
+	ok = fwrite(header, sizeof(header), 1, fptr) == 1
+		&& fwrite(encoded, encodedSize, 1, fptr) == 1;
+
+ defer:
+	if (fptr && fclose(fptr) != 0) ok = 0;
+	free(indices);
+	free(encoded);
+	return ok;
+}
+
+int lgl_indexBufferLoad(lgl_IndexBuffer *ib, const char *path)
+{
+	unsigned int header[5], *indices = NULL, i;
+	unsigned char *encoded = NULL;
+	FILE *fptr;
+	long start, end;
+	int ok = 0;
+
+	fptr = fopen(path, "rb");
+	if (!fptr) return 0;
+
+	if (fread(header, sizeof(header), 1, fptr) != 1
+	    || header[0] != LGL__INDEX_MAGIC
+	    || (header[1] != GL_TRIANGLES && header[1] != GL_TRIANGLE_STRIP)
+	    || header[2] > LGL__INDEX_MAX_COUNT
+	    || header[3] > LGL__INDEX_MAX_COUNT
+	    || header[4] > lgl_indexEncodeBound((int)header[2]))
+		goto defer;
+
+	/* the encoded indices must be in the file before they are allocated */
+	if ((start = ftell(fptr)) < 0 || fseek(fptr, 0, SEEK_END) != 0
+	    || (end = ftell(fptr)) < 0 || end - start < (long)header[4]
+	    || fseek(fptr, start, SEEK_SET) != 0)
+		goto defer;
+
+	encoded = malloc((size_t)header[4] + 1);
+	indices = malloc(sizeof(unsigned int) * ((size_t)header[2] + 1));
+	if (!encoded || !indices) goto defer;
+
+	if (header[4] && fread(encoded, header[4], 1, fptr) != 1) goto defer;
+	if (!lgl_indexDecode(encoded, header[4], indices, (int)header[2]))
+		goto defer;
+
+	/* stored narrower, an index out of range would wrap */
+	for (i = 0; i < header[2]; i++)
+		if (indices[i] >= header[3]
+		    && !(indices[i] == LGL__RESTART && header[1] != GL_TRIANGLES))
+			goto defer;
+
+	ok = lgl__indexStore(ib, header[1], indices, (int)header[2],
+			     (int)header[3]);
+
+ defer:
+	fclose(fptr);
+	free(encoded);
+	free(indices);
+	return ok;
+}
+
+#endif /*LGL_INDEX_BUFFER_IMPLEMENTATION*/
@@ -0,0 +1,216 @@
+#ifndef __LGL_INSTANCING__
+#define __LGL_INSTANCING__
+
+#include <cglm/cglm.h>
+
+/* Instanced drawing: per-instance transforms are collected on the CPU and
+ * streamed into one buffer every frame, which is read either as instanced
+ * vertex attributes (glVertexAttribDivisor) or as a shader storage buffer.
+ * Any number of copies of a mesh then costs a single draw call.
+ *
+ * LGL_INSTANCE_MATRIX stores a full mat4 per instance and takes four
+ * attribute locations. LGL_INSTANCE_TRS stores a position with a uniform
+ * scale and a rotation quaternion (two vec4s, half the size) and takes two
+ * locations; the vertex shader rotates with the quaternion q directly:
+ *
+ *	p = p * scale;
+ *	p += 2.0 * cross(q.xyz, cross(q.xyz, p) + q.w * p);
+ *	p += position; */
+
+enum {
+	LGL_INSTANCE_MATRIX, /* mat4, 64 bytes */
+	LGL_INSTANCE_TRS     /* vec4 position + scale, vec4 quaternion, 32 bytes */
+};
+
+typedef struct {
+	int layout;
+	int floatsPerInstance;
+	int count, capacity;
+	float *data;
+
+	unsigned int buffer;
+	size_t bufferSize;   /* bytes allocated in the GL buffer */
+} lgl_InstanceBuffer;
+
+/* allocates room for `capacity` instances and creates the GL buffer */
+int lgl_instanceBufferInit(lgl_InstanceBuffer *ib, int layout, int capacity);
+
+void lgl_instanceBufferFree(lgl_InstanceBuffer *ib);
+
+/* starts a new frame of instances */
+void lgl_instanceBufferReset(lgl_InstanceBuffer *ib);
+
+/* returns the index of the instance, or -1 if the buffer could not grow;
+ * a LGL_INSTANCE_TRS buffer keeps only the translation, rotation and the
+ * x scale of the matrix, negative when the matrix mirrors */
+int lgl_instancePushMatrix(lgl_InstanceBuffer *ib, mat4 model);
+
+int lgl_instancePushTRS(lgl_InstanceBuffer *ib, vec3 position,
+			versor rotation, float scale);
+
+/* streams the instances to the GL buffer, orphaning the previous storage */
+void lgl_instanceBufferUpload(lgl_InstanceBuffer *ib);
+
+/* sets up the instance attributes starting at `location` in the bound VAO */
+void lgl_instanceBufferAttach(const lgl_InstanceBuffer *ib, unsigned int location);
+
+/* binds the instances as a shader storage buffer instead */
+void lgl_instanceBufferBindStorage(const lgl_InstanceBuffer *ib,
+				   unsigned int binding);
+
+/* one glDrawElementsInstanced for every instance of the buffer */
+void lgl_instanceDrawElements(const lgl_InstanceBuffer *ib, unsigned int mode,
+			      int count, unsigned int type);
+
+#endif /*__LGL_INSTANCING__*/
+
+#ifdef LGL_INSTANCING_IMPLEMENTATION
+
+#include <stdlib.h>
+
+int lgl_instanceBufferInit(lgl_InstanceBuffer *ib, int layout, int capacity)
+{
+	ib->layout = layout;
+	ib->floatsPerInstance = layout == LGL_INSTANCE_TRS ? 8 : 16;
+	ib->count = 0;
+	ib->capacity = capacity > 0 ? capacity : 1;
+	ib->bufferSize = 0;
+	ib->buffer = 0;
+
+	ib->data = malloc(sizeof(float) * ib->floatsPerInstance * ib->capacity);
+	if (!ib->data) return 0;
+
+	glGenBuffers(1, &ib->buffer);
+	return 1;
+}
+
+void lgl_instanceBufferFree(lgl_InstanceBuffer *ib)
+{
+	if (ib->buffer) glDeleteBuffers(1, &ib->buffer);
+	free(ib->data);
+	ib->data = NULL;
+	ib->buffer = 0;
+	ib->count = ib->capacity = 0;
+}
+
+void lgl_instanceBufferReset(lgl_InstanceBuffer *ib)
+{
+	ib->count = 0;
+}
+
+static float *lgl__instanceNext(lgl_InstanceBuffer *ib)
+{
+	if (ib->count == ib->capacity) {
+		float *grown = realloc(ib->data, sizeof(float)
+				       * ib->floatsPerInstance * ib->capacity * 2);
+
+		if (!grown) return NULL;
+		ib->data = grown;
+		ib->capacity *= 2;
+	}
+
+	return ib->data + ib->floatsPerInstance * ib->count++;
+}
+
+int lgl_instancePushMatrix(lgl_InstanceBuffer *ib, mat4 model)
+{
+	float *instance;
+
+	if (ib->layout == LGL_INSTANCE_TRS) {
+		mat4 rotation = GLM_MAT4_IDENTITY_INIT;
+		float scale = glm_vec3_norm(model[0]);
+		versor q;
+		int i;
+
+		/* glm_decompose divides by the scale; a zero scaled axis keeps
+		 * the identity axis instead, the instance collapses anyway */
+		for (i = 0; i < 3; i++) {
+			float length = glm_vec3_norm(model[i]);
+
+			if (length > 0.0f)
+				glm_vec3_scale(model[i], 1.0f / length, rotation[i]);
+		}
+		/* a mirrored matrix has no quaternion: a negative uniform scale
+		 * is -1 times a rotation, so move the sign into the scale */
+		if (glm_mat4_det(rotation) < 0.0f) {
+			for (i = 0; i < 3; i++)
+				glm_vec3_negate(rotation[i]);
+			scale = -scale;
+		}
+		glm_mat4_quat(rotation, q);
+		return lgl_instancePushTRS(ib, model[3], q, scale);
+	}
+
+	instance = lgl__instanceNext(ib);
+	if (!instance) return -1;
+	glm_mat4_ucopy(model, (vec4 *)instance);
+	return ib->count - 1;
+}
+
+int lgl_instancePushTRS(lgl_InstanceBuffer *ib, vec3 position,
+			versor rotation, float scale)
+{
+	float *instance;
+
+	if (ib->layout == LGL_INSTANCE_MATRIX) {
+		mat4 model;
+
+		glm_quat_mat4(rotation, model);
+		glm_scale_uni(model, scale);
+		glm_vec3_copy(position, model[3]);
+		return lgl_instancePushMatrix(ib, model);
+	}
+
+	instance = lgl__instanceNext(ib);
+	if (!instance) return -1;
+	instance[0] = position[0];
+	instance[1] = position[1];
+	instance[2] = position[2];
+	instance[3] = scale;
+	glm_vec4_ucopy(rotation, instance + 4);
+	return ib->count - 1;
+}
+
+void lgl_instanceBufferUpload(lgl_InstanceBuffer *ib)
+{
+	size_t size = sizeof(float) * ib->floatsPerInstance * ib->count;
+
+	glBindBuffer(GL_ARRAY_BUFFER, ib->buffer);
+
+	/* a new store every frame, so the driver never waits for the draws
+	 * still reading the previous one */
+	if (size > ib->bufferSize)
+		ib->bufferSize = sizeof(float) * ib->floatsPerInstance * ib->capacity;
+	glBufferData(GL_ARRAY_BUFFER, ib->bufferSize, NULL, GL_STREAM_DRAW);
+	glBufferSubData(GL_ARRAY_BUFFER, 0, size, ib->data);
+}
+
+void lgl_instanceBufferAttach(const lgl_InstanceBuffer *ib, unsigned int location)
+{
+	int columns = ib->floatsPerInstance / 4;
+	int stride = ib->floatsPerInstance * sizeof(float);
+	int i;
+
+	glBindBuffer(GL_ARRAY_BUFFER, ib->buffer);
+	for (i = 0; i < columns; i++) {
+		glVertexAttribPointer(location + i, 4, GL_FLOAT, GL_FALSE, stride,
+				      (void *)(i * 4 * sizeof(float)));
+		glEnableVertexAttribArray(location + i);
+		glVertexAttribDivisor(location + i, 1);
+	}
+}
+
+void lgl_instanceBufferBindStorage(const lgl_InstanceBuffer *ib,
+				   unsigned int binding)
+{
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, ib->buffer);
+}
+
+void lgl_instanceDrawElements(const lgl_InstanceBuffer *ib, unsigned int mode,
+			      int count, unsigned int type)
+{
+	if (ib->count == 0) return;
+	glDrawElementsInstanced(mode, count, type, (void *)0, ib->count);
+}
+
+#endif /*LGL_INSTANCING_IMPLEMENTATION*/
@@ -0,0 +1,835 @@
+#ifndef __LGL_MEMORY__
+#define __LGL_MEMORY__
+
+#include <stddef.h>
+#include <stdio.h>
+
+/* Memory accounting for host allocations and GL objects.
+ *
+ * Host memory goes through lgl_malloc/lgl_realloc/lgl_free, which put a
+ * small header in front of every block with its size, subsystem and the
+ * file and line that allocated it, and keep the live blocks in a list
+ * for the leak report. Including this header before the stb_image and
+ * lgl_shader.h implementations routes stbi_load (STBI_MALLOC, ...) and
+ * lgl_readFile (LGL_MALLOC, ...) through it; blocks from those must then
+ * be released with stbi_image_free and lgl_freeFile, never free().
+ *
+ * GL memory is estimated: lgl_memoryTrackGl points glad's buffer,
+ * texture and renderbuffer entry points (create, delete, storage) at
+ * wrappers that keep the size of every live object, from the storage
+ * calls' sizes, formats and mip levels, and chains to what was there
+ * before, so it composes with lgl_gl_trace.h. Drivers pad and compress,
+ * so the numbers are what the application asked for, not what the GPU
+ * holds. Objects created before lgl_memoryTrackGl are not seen.
+ *
+ * Every subsystem keeps its current and peak bytes, its live blocks or
+ * objects and how many it ever had; the host and GL totals keep their
+ * own peaks, which are not the sums of the subsystem peaks. Calls are
+ * expected on a single thread. Include glad before the implementation,
+ * which is left out when LGL_MEMORY_LIBRARY says a library provides it. */
+
+enum {
+	LGL_MEMORY_APP,           /* lgl_malloc from the sample itself */
+	LGL_MEMORY_STB_IMAGE,
+	LGL_MEMORY_LGL,           /* the lgl_*.h helpers (lgl_readFile) */
+	LGL_MEMORY_GL_BUFFER,
+	LGL_MEMORY_GL_TEXTURE,
+	LGL_MEMORY_GL_RENDERBUFFER,
+	LGL_MEMORY_SUBSYSTEMS
+};
+
+/* subsystems below this one are host memory, the rest GL */
+#define LGL_MEMORY_FIRST_GL LGL_MEMORY_GL_BUFFER
+
+typedef struct {
+	size_t current, peak;     /* in bytes */
+	unsigned long live;       /* blocks or objects alive */
+	unsigned long total;      /* ever allocated or created */
+} lgl_MemoryStats;
+
+#define lgl_malloc(size, subsystem) \
+	lgl__memoryAlloc(NULL, (size), (subsystem), __FILE__, __LINE__)
+#define lgl_realloc(pointer, size, subsystem) \
+	lgl__memoryAlloc((pointer), (size), (subsystem), __FILE__, __LINE__)
+
+void *lgl__memoryAlloc(void *pointer, size_t size, int subsystem,
+		       const char *file, int line);
+
+void lgl_free(void *pointer);
+
+/* the allocator hooks of the libraries that have them */
+#ifndef STBI_MALLOC
+#define STBI_MALLOC(size) lgl_malloc(size, LGL_MEMORY_STB_IMAGE)
+#define STBI_REALLOC(pointer, size) \
+	lgl_realloc(pointer, size, LGL_MEMORY_STB_IMAGE)
+#define STBI_FREE(pointer) lgl_free(pointer)
+#endif
+
+#ifndef LGL_MALLOC
+#define LGL_MALLOC(size) lgl_malloc(size, LGL_MEMORY_LGL)
+#define LGL_REALLOC(pointer, size) lgl_realloc(pointer, size, LGL_MEMORY_LGL)
+#define LGL_FREE(pointer) lgl_free(pointer)
+#endif
+
+/* call after gladLoadGL*; returns 0 if already tracking */
+int lgl_memoryTrackGl(void);
+
+/* puts the previous functions back into glad's pointers; while one of
+ * them was hooked again since (lgl_gl_trace.h) and still chains through
+ * the wrappers, tracking goes on, to be stopped after that. The objects
+ * seen so far stay in the statistics */
+void lgl_memoryUntrackGl(void);
+
+/* `host` and `gl` (either may be NULL) receive the totals */
+void lgl_memoryStats(lgl_MemoryStats *subsystems, lgl_MemoryStats *host,
+		     lgl_MemoryStats *gl);
+
+/* current and peak usage per subsystem */
+void lgl_memoryPrint(FILE *file);
+
+/* lists the host blocks and GL objects still alive, meant for the end of
+ * main after the sample released everything; returns how many there are */
+unsigned long lgl_memoryReportLeaks(FILE *file);
+
+#endif /*__LGL_MEMORY__*/
+
+#if defined(LGL_MEMORY_IMPLEMENTATION) && !defined(LGL_MEMORY_LIBRARY)
+
+#include <stdlib.h>
+#include <string.h>
+
+#define LGL__MEMORY_MAX_LEAKS 32  /* host blocks listed by the report */
+
+typedef struct lgl__MemoryBlock {
+	struct lgl__MemoryBlock *prev, *next;
+	size_t size;
+	const char *file;
+	int line;
+	int subsystem;
+} lgl__MemoryBlock;
+
+/* keeps the memory after the header aligned for any type */
+#define LGL__MEMORY_HEADER ((sizeof(lgl__MemoryBlock) + 15) & ~(size_t)15)
+
+typedef struct {
+	size_t bytes;
+	int live;
+	/* textures: level 0 and the mip chain, for glGenerateMipmap */
+	int width, height, depth;
+	int levels, layers;       /* layers are 6 for cube maps */
+	int depthMips;            /* 3D textures halve their depth */
+	int texel;                /* bytes */
+} lgl__MemoryGlObject;
+
+typedef struct {
+	lgl__MemoryGlObject *objects; /* indexed by name */
+	unsigned int capacity;
+} lgl__MemoryGlTable;
+
+static struct {
+	lgl_MemoryStats subsystems[LGL_MEMORY_SUBSYSTEMS];
+	lgl_MemoryStats host, gl;
+	lgl__MemoryBlock *blocks;  /* live, newest first */
+	lgl__MemoryGlTable tables[LGL_MEMORY_SUBSYSTEMS - LGL_MEMORY_FIRST_GL];
+	int tracking;
+} lgl__memory;
+
+static const char *lgl__memoryNames[LGL_MEMORY_SUBSYSTEMS] = {
+	"app", "stb_image", "lgl", "GL buffers", "GL textures",
+	"GL renderbuffers"
+};
+
+static void lgl__memoryAccount(int subsystem, size_t before, size_t after,
+			       int live)
+{
+	lgl_MemoryStats *stats = &lgl__memory.subsystems[subsystem];
+	lgl_MemoryStats *total = subsystem < LGL_MEMORY_FIRST_GL
+		? &lgl__memory.host : &lgl__memory.gl;
+
+	stats->current = stats->current - before + after;
+	total->current = total->current - before + after;
+	if (stats->current > stats->peak) stats->peak = stats->current;
+	if (total->current > total->peak) total->peak = total->current;
+
+	if (live > 0) {
+		stats->live++;
+		stats->total++;
+		total->live++;
+		total->total++;
+	} else if (live < 0) {
+		stats->live--;
+		total->live--;
+	}
+}
+
+void *lgl__memoryAlloc(void *pointer, size_t size, int subsystem,
+		       const char *file, int line)
+{
+	lgl__MemoryBlock *block = NULL, *grown;
+	size_t before = 0;
+
+	if (pointer) {
+		block = (lgl__MemoryBlock *)((char *)pointer - LGL__MEMORY_HEADER);
+		before = block->size;
+		subsystem = block->subsystem;
+	}
+
+	grown = realloc(block, LGL__MEMORY_HEADER + size);
+	if (!grown) return NULL;
+
+	if (block) {
+		/* the list points at the old address */
+		if (grown->prev) grown->prev->next = grown;
+		else lgl__memory.blocks = grown;
+		if (grown->next) grown->next->prev = grown;
+	} else {
+		grown->prev = NULL;
+		grown->next = lgl__memory.blocks;
+		if (grown->next) grown->next->prev = grown;
+		lgl__memory.blocks = grown;
+		grown->subsystem = subsystem;
+	}
+	grown->size = size;
+	grown->file = file;
+	grown->line = line;
+
+	lgl__memoryAccount(subsystem, before, size, block ? 0 : 1);
+	return (char *)grown + LGL__MEMORY_HEADER;
+}
+
+void lgl_free(void *pointer)
+{
+	lgl__MemoryBlock *block;
+
+	if (!pointer) return;
+	block = (lgl__MemoryBlock *)((char *)pointer - LGL__MEMORY_HEADER);
+
+	if (block->prev) block->prev->next = block->next;
+	else lgl__memory.blocks = block->next;
+	if (block->next) block->next->prev = block->prev;
+
+	lgl__memoryAccount(block->subsystem, block->size, 0, -1);
+	free(block);
+}
+
+/* GL objects
+   ********** */
+
+static lgl__MemoryGlObject *lgl__memoryGlObject(int subsystem,
+						GLuint name)
+{
+	lgl__MemoryGlTable *table =
+		&lgl__memory.tables[subsystem - LGL_MEMORY_FIRST_GL];
+
+	if (name >= table->capacity) {
+		unsigned int capacity = table->capacity ? table->capacity : 64;
+		lgl__MemoryGlObject *grown;
+
+		while (capacity <= name) capacity *= 2;
+		/* the tracker's own memory is not accounted */
+		grown = realloc(table->objects, capacity * sizeof(*grown));
+		if (!grown) return NULL;
+		memset(grown + table->capacity, 0,
+		       (capacity - table->capacity) * sizeof(*grown));
+		table->objects = grown;
+		table->capacity = capacity;
+	}
+	return &table->objects[name];
+}
+
+static void lgl__memoryGlCreate(int subsystem, GLsizei n, const GLuint *names)
+{
+	GLsizei i;
+
+	for (i = 0; i < n; i++) {
+		lgl__MemoryGlObject *object;
+
+		if (!names[i]) continue;
+		object = lgl__memoryGlObject(subsystem, names[i]);
+		if (!object || object->live) continue;
+		memset(object, 0, sizeof(*object));
+		object->live = 1;
+		lgl__memoryAccount(subsystem, 0, 0, 1);
+	}
+}
+
+static void lgl__memoryGlDelete(int subsystem, GLsizei n, const GLuint *names)
+{
+	lgl__MemoryGlTable *table =
+		&lgl__memory.tables[subsystem - LGL_MEMORY_FIRST_GL];
+	GLsizei i;
+
+	for (i = 0; i < n; i++) {
+		lgl__MemoryGlObject *object;
+
+		/* 0, unknown names and objects from before tracking */
+		if (names[i] >= table->capacity) continue;
+		object = &table->objects[names[i]];
+		if (!object->live) continue;
+		lgl__memoryAccount(subsystem, object->bytes, 0, -1);
+		object->live = 0;
+		object->bytes = 0;
+	}
+}
+
+static void lgl__memoryGlResize(int subsystem, GLuint name, size_t bytes)
+{
+	lgl__MemoryGlTable *table =
+		&lgl__memory.tables[subsystem - LGL_MEMORY_FIRST_GL];
+	lgl__MemoryGlObject *object;
+
+	if (name >= table->capacity || !table->objects[name].live) return;
+	object = &table->objects[name];
+	lgl__memoryAccount(subsystem, object->bytes, bytes, 0);
+	object->bytes = bytes;
+}
+
+/* bytes per texel or sample of an internal format; unsized formats are
+ * counted the way drivers usually store them, 3 channels as 4 */
+static int lgl__memoryTexelBytes(GLenum format)
+{
+	switch (format) {
+	case GL_R8: case GL_R8I: case GL_R8UI: case GL_R8_SNORM:
+	case GL_RED: case GL_STENCIL_INDEX8:
+		return 1;
+	case GL_RG8: case GL_RG8I: case GL_RG8UI: case GL_RG8_SNORM:
+	case GL_R16: case GL_R16F: case GL_R16I: case GL_R16UI:
+	case GL_RG: case GL_RGB565: case GL_RGBA4: case GL_RGB5_A1:
+	case GL_DEPTH_COMPONENT16:
+		return 2;
+	case GL_RG16: case GL_RG16F: case GL_RG16I: case GL_RG16UI:
+	case GL_R32F: case GL_R32I: case GL_R32UI:
+	case GL_DEPTH_COMPONENT32F: case GL_DEPTH_COMPONENT24:
+	case GL_DEPTH_COMPONENT32: case GL_DEPTH_COMPONENT:
+	case GL_DEPTH24_STENCIL8: case GL_DEPTH_STENCIL:
+	case GL_R11F_G11F_B10F: case GL_RGB9_E5: case GL_RGB10_A2:
+	case GL_RGB10_A2UI:
+		return 4;
+	case GL_RGBA16: case GL_RGBA16F: case GL_RGBA16I: case GL_RGBA16UI:
+	case GL_RGB16: case GL_RGB16F: case GL_RGB16I: case GL_RGB16UI:
+	case GL_RG32F: case GL_RG32I: case GL_RG32UI:
+	case GL_DEPTH32F_STENCIL8:
+		return 8;
+	case GL_RGBA32F: case GL_RGBA32I: case GL_RGBA32UI:
+	case GL_RGB32F: case GL_RGB32I: case GL_RGB32UI:
+		return 16;
+	default:
+		/* GL_RGB(A)8, GL_SRGB8(_ALPHA8), GL_RGB, GL_RGBA, ... */
+		return 4;
+	}
+}
+
+static size_t lgl__memoryTextureBytes(const lgl__MemoryGlObject *texture)
+{
+	size_t bytes = 0;
+	int level;
+
+	for (level = 0; level < texture->levels; level++) {
+		size_t width = texture->width >> level;
+		size_t height = texture->height >> level;
+		size_t depth = texture->depthMips
+			? (size_t)texture->depth >> level : (size_t)texture->depth;
+
+		bytes += (width ? width : 1) * (height ? height : 1)
+			* (depth ? depth : 1);
+	}
+	return bytes * texture->layers * texture->texel;
+}
+
+/* the name bound to `target` on the active unit, through the function
+ * that was there before the wrappers */
+static PFNGLGETINTEGERVPROC lgl__memoryGetIntegerv;
+
+static GLuint lgl__memoryBound(GLenum binding)
+{
+	GLint name = 0;
+
+	if (binding) lgl__memoryGetIntegerv(binding, &name);
+	return (GLuint)name;
+}
+
+static GLenum lgl__memoryBufferBinding(GLenum target)
+{
+	switch (target) {
+	case GL_ARRAY_BUFFER: return GL_ARRAY_BUFFER_BINDING;
+	case GL_ELEMENT_ARRAY_BUFFER: return GL_ELEMENT_ARRAY_BUFFER_BINDING;
+	case GL_UNIFORM_BUFFER: return GL_UNIFORM_BUFFER_BINDING;
+	case GL_SHADER_STORAGE_BUFFER: return GL_SHADER_STORAGE_BUFFER_BINDING;
+	case GL_PIXEL_PACK_BUFFER: return GL_PIXEL_PACK_BUFFER_BINDING;
+	case GL_PIXEL_UNPACK_BUFFER: return GL_PIXEL_UNPACK_BUFFER_BINDING;
+	case GL_COPY_READ_BUFFER: return GL_COPY_READ_BUFFER_BINDING;
+	case GL_COPY_WRITE_BUFFER: return GL_COPY_WRITE_BUFFER_BINDING;
+	case GL_DRAW_INDIRECT_BUFFER: return GL_DRAW_INDIRECT_BUFFER_BINDING;
+	case GL_DISPATCH_INDIRECT_BUFFER:
+		return GL_DISPATCH_INDIRECT_BUFFER_BINDING;
+	case GL_TEXTURE_BUFFER: return GL_TEXTURE_BUFFER_BINDING;
+	case GL_TRANSFORM_FEEDBACK_BUFFER:
+		return GL_TRANSFORM_FEEDBACK_BUFFER_BINDING;
+	case GL_ATOMIC_COUNTER_BUFFER: return GL_ATOMIC_COUNTER_BUFFER_BINDING;
+	case GL_QUERY_BUFFER: return GL_QUERY_BUFFER_BINDING;
+	default: return 0;
+	}
+}
+
+static GLenum lgl__memoryTextureBinding(GLenum target)
+{
+	switch (target) {
+	case GL_TEXTURE_1D: return GL_TEXTURE_BINDING_1D;
+	case GL_TEXTURE_2D: return GL_TEXTURE_BINDING_2D;
+	case GL_TEXTURE_3D: return GL_TEXTURE_BINDING_3D;
+	case GL_TEXTURE_1D_ARRAY: return GL_TEXTURE_BINDING_1D_ARRAY;
+	case GL_TEXTURE_2D_ARRAY: return GL_TEXTURE_BINDING_2D_ARRAY;
+	case GL_TEXTURE_RECTANGLE: return GL_TEXTURE_BINDING_RECTANGLE;
+	case GL_TEXTURE_CUBE_MAP:
+	case GL_TEXTURE_CUBE_MAP_POSITIVE_X:
+	case GL_TEXTURE_CUBE_MAP_NEGATIVE_X:
+	case GL_TEXTURE_CUBE_MAP_POSITIVE_Y:
+	case GL_TEXTURE_CUBE_MAP_NEGATIVE_Y:
+	case GL_TEXTURE_CUBE_MAP_POSITIVE_Z:
+	case GL_TEXTURE_CUBE_MAP_NEGATIVE_Z:
+		return GL_TEXTURE_BINDING_CUBE_MAP;
+	case GL_TEXTURE_CUBE_MAP_ARRAY: return GL_TEXTURE_BINDING_CUBE_MAP_ARRAY;
+	case GL_TEXTURE_2D_MULTISAMPLE: return GL_TEXTURE_BINDING_2D_MULTISAMPLE;
+	case GL_TEXTURE_2D_MULTISAMPLE_ARRAY:
+		return GL_TEXTURE_BINDING_2D_MULTISAMPLE_ARRAY;
+	default: return 0;
+	}
+}
+
+/* records level `level` of a texture; level 0 sets its size, higher
+ * levels extend the mip chain */
+static void lgl__memoryTexture(GLuint name, GLenum target, GLint level,
+			       GLsizei levels, GLenum format, GLsizei width,
+			       GLsizei height, GLsizei depth)
+{
+	lgl__MemoryGlTable *table =
+		&lgl__memory.tables[LGL_MEMORY_GL_TEXTURE - LGL_MEMORY_FIRST_GL];
+	lgl__MemoryGlObject *texture;
+
+	if (name >= table->capacity || !table->objects[name].live) return;
+	texture = &table->objects[name];
+
+	if (level == 0) {
+		texture->width = width;
+		texture->height = height;
+		texture->depth = depth;
+		texture->texel = lgl__memoryTexelBytes(format);
+		texture->depthMips = target == GL_TEXTURE_3D;
+		texture->layers = target == GL_TEXTURE_CUBE_MAP
+			|| (target >= GL_TEXTURE_CUBE_MAP_POSITIVE_X
+			    && target <= GL_TEXTURE_CUBE_MAP_NEGATIVE_Z) ? 6 : 1;
+		if (levels > 0 || texture->levels < 1) texture->levels = 1;
+	}
+	if (levels > 0) texture->levels = levels;
+	else if (level + 1 > texture->levels) texture->levels = level + 1;
+
+	lgl__memoryGlResize(LGL_MEMORY_GL_TEXTURE, name,
+			    lgl__memoryTextureBytes(texture));
+}
+
+static void lgl__memoryMipmaps(GLuint name)
+{
+	lgl__MemoryGlTable *table =
+		&lgl__memory.tables[LGL_MEMORY_GL_TEXTURE - LGL_MEMORY_FIRST_GL];
+	lgl__MemoryGlObject *texture;
+	int size;
+
+	if (name >= table->capacity || !table->objects[name].live) return;
+	texture = &table->objects[name];
+
+	size = texture->width > texture->height ? texture->width : texture->height;
+	if (texture->depthMips && texture->depth > size) size = texture->depth;
+	for (texture->levels = 1; size > 1; size >>= 1) texture->levels++;
+
+	lgl__memoryGlResize(LGL_MEMORY_GL_TEXTURE, name,
+			    lgl__memoryTextureBytes(texture));
+}
+
+static void lgl__memoryRenderbuffer(GLuint name, GLsizei samples,
+				    GLenum format, GLsizei width,
+				    GLsizei height)
+{
+	lgl__memoryGlResize(LGL_MEMORY_GL_RENDERBUFFER, name,
+			    (size_t)width * height * (samples > 1 ? samples : 1)
+			    * lgl__memoryTexelBytes(format));
+}
+
+/* the wrappers, each calling the function it replaced */
+
+#define LGL__MEMORY_ENTRY_POINTS(X) \
+	X(glGenBuffers, PFNGLGENBUFFERSPROC) \
+	X(glCreateBuffers, PFNGLCREATEBUFFERSPROC) \
+	X(glDeleteBuffers, PFNGLDELETEBUFFERSPROC) \
+	X(glBufferData, PFNGLBUFFERDATAPROC) \
+	X(glBufferStorage, PFNGLBUFFERSTORAGEPROC) \
+	X(glNamedBufferData, PFNGLNAMEDBUFFERDATAPROC) \
+	X(glNamedBufferStorage, PFNGLNAMEDBUFFERSTORAGEPROC) \
+	X(glGenTextures, PFNGLGENTEXTURESPROC) \
+	X(glCreateTextures, PFNGLCREATETEXTURESPROC) \
+	X(glDeleteTextures, PFNGLDELETETEXTURESPROC) \
+	X(glTexImage2D, PFNGLTEXIMAGE2DPROC) \
+	X(glTexImage3D, PFNGLTEXIMAGE3DPROC) \
+	X(glTexStorage2D, PFNGLTEXSTORAGE2DPROC) \
+	X(glTexStorage3D, PFNGLTEXSTORAGE3DPROC) \
+	X(glTextureStorage2D, PFNGLTEXTURESTORAGE2DPROC) \
+	X(glTextureStorage3D, PFNGLTEXTURESTORAGE3DPROC) \
+	X(glGenerateMipmap, PFNGLGENERATEMIPMAPPROC) \
+	X(glGenerateTextureMipmap, PFNGLGENERATETEXTUREMIPMAPPROC) \
+	X(glGenRenderbuffers, PFNGLGENRENDERBUFFERSPROC) \
+	X(glCreateRenderbuffers, PFNGLCREATERENDERBUFFERSPROC) \
+	X(glDeleteRenderbuffers, PFNGLDELETERENDERBUFFERSPROC) \
+	X(glRenderbufferStorage, PFNGLRENDERBUFFERSTORAGEPROC) \
+	X(glRenderbufferStorageMultisample, \
+	  PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC) \
+	X(glNamedRenderbufferStorage, PFNGLNAMEDRENDERBUFFERSTORAGEPROC) \
+	X(glNamedRenderbufferStorageMultisample, \
+	  PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC)
+
+#define LGL__MEMORY_PREVIOUS(name, type) static type lgl__memoryPrev_##name;
+LGL__MEMORY_ENTRY_POINTS(LGL__MEMORY_PREVIOUS)
+#undef LGL__MEMORY_PREVIOUS
+
+static void APIENTRY lgl__memory_glGenBuffers(GLsizei n, GLuint *buffers)
+{
+	lgl__memoryPrev_glGenBuffers(n, buffers);
+	lgl__memoryGlCreate(LGL_MEMORY_GL_BUFFER, n, buffers);
+}
+
+static void APIENTRY lgl__memory_glCreateBuffers(GLsizei n, GLuint *buffers)
+{
+	lgl__memoryPrev_glCreateBuffers(n, buffers);
+	lgl__memoryGlCreate(LGL_MEMORY_GL_BUFFER, n, buffers);
+}
+
+static void APIENTRY lgl__memory_glDeleteBuffers(GLsizei n,
+						 const GLuint *buffers)
+{
+	lgl__memoryPrev_glDeleteBuffers(n, buffers);
+	lgl__memoryGlDelete(LGL_MEMORY_GL_BUFFER, n, buffers);
+}
+
+static void APIENTRY lgl__memory_glBufferData(GLenum target, GLsizeiptr size,
+					      const void *data, GLenum usage)
+{
+	lgl__memoryPrev_glBufferData(target, size, data, usage);
+	lgl__memoryGlResize(LGL_MEMORY_GL_BUFFER,
+			    lgl__memoryBound(lgl__memoryBufferBinding(target)),
+			    (size_t)size);
+}
+
+static void APIENTRY lgl__memory_glBufferStorage(GLenum target,
+						 GLsizeiptr size,
+						 const void *data,
+						 GLbitfield flags)
+{
+	lgl__memoryPrev_glBufferStorage(target, size, data, flags);
+	lgl__memoryGlResize(LGL_MEMORY_GL_BUFFER,
+			    lgl__memoryBound(lgl__memoryBufferBinding(target)),
+			    (size_t)size);
+}
+
+static void APIENTRY lgl__memory_glNamedBufferData(GLuint buffer,
+						   GLsizeiptr size,
+						   const void *data,
+						   GLenum usage)
+{
+	lgl__memoryPrev_glNamedBufferData(buffer, size, data, usage);
+	lgl__memoryGlResize(LGL_MEMORY_GL_BUFFER, buffer, (size_t)size);
+}
+
+static void APIENTRY lgl__memory_glNamedBufferStorage(GLuint buffer,
+						      GLsizeiptr size,
+						      const void *data,
+						      GLbitfield flags)
+{
+	lgl__memoryPrev_glNamedBufferStorage(buffer, size, data, flags);
+	lgl__memoryGlResize(LGL_MEMORY_GL_BUFFER, buffer, (size_t)size);
+}
+
+static void APIENTRY lgl__memory_glGenTextures(GLsizei n, GLuint *textures)
+{
+	lgl__memoryPrev_glGenTextures(n, textures);
+	lgl__memoryGlCreate(LGL_MEMORY_GL_TEXTURE, n, textures);
+}
+
+static void APIENTRY lgl__memory_glCreateTextures(GLenum target, GLsizei n,
+						  GLuint *textures)
+{
+	lgl__memoryPrev_glCreateTextures(target, n, textures);
+	lgl__memoryGlCreate(LGL_MEMORY_GL_TEXTURE, n, textures);
+}
+
+static void APIENTRY lgl__memory_glDeleteTextures(GLsizei n,
+						  const GLuint *textures)
+{
+	lgl__memoryPrev_glDeleteTextures(n, textures);
+	lgl__memoryGlDelete(LGL_MEMORY_GL_TEXTURE, n, textures);
+}
+
+static void APIENTRY lgl__memory_glTexImage2D(GLenum target, GLint level,
+					      GLint internalformat,
+					      GLsizei width, GLsizei height,
+					      GLint border, GLenum format,
+					      GLenum type, const void *pixels)
+{
+	lgl__memoryPrev_glTexImage2D(target, level, internalformat, width,
+				     height, border, format, type, pixels);
+	lgl__memoryTexture(lgl__memoryBound(lgl__memoryTextureBinding(target)),
+			   target, level, 0, (GLenum)internalformat, width,
+			   height, 1);
+}
+
+static void APIENTRY lgl__memory_glTexImage3D(GLenum target, GLint level,
+					      GLint internalformat,
+					      GLsizei width, GLsizei height,
+					      GLsizei depth, GLint border,
+					      GLenum format, GLenum type,
+					      const void *pixels)
+{
+	lgl__memoryPrev_glTexImage3D(target, level, internalformat, width,
+				     height, depth, border, format, type,
+				     pixels);
+	lgl__memoryTexture(lgl__memoryBound(lgl__memoryTextureBinding(target)),
+			   target, level, 0, (GLenum)internalformat, width,
+			   height, depth);
+}
+
+static void APIENTRY lgl__memory_glTexStorage2D(GLenum target, GLsizei levels,
+						GLenum internalformat,
+						GLsizei width, GLsizei height)
+{
+	lgl__memoryPrev_glTexStorage2D(target, levels, internalformat, width,
+				       height);
+	lgl__memoryTexture(lgl__memoryBound(lgl__memoryTextureBinding(target)),
+			   target, 0, levels, internalformat, width, height, 1);
+}
+
+static void APIENTRY lgl__memory_glTexStorage3D(GLenum target, GLsizei levels,
+						GLenum internalformat,
+						GLsizei width, GLsizei height,
+						GLsizei depth)
+{
+	lgl__memoryPrev_glTexStorage3D(target, levels, internalformat, width,
+				       height, depth);
+	lgl__memoryTexture(lgl__memoryBound(lgl__memoryTextureBinding(target)),
+			   target, 0, levels, internalformat, width, height,
+			   depth);
+}
+
+/* the DSA calls do not say the target; a 3D texture is told from an
+ * array by GL_TEXTURE_TARGET, which needs GL 4.5 like the calls */
+static GLenum lgl__memoryTextureTarget(GLuint texture, GLenum guess)
+{
+	GLint target = (GLint)guess;
+
+	if (glad_glGetTextureParameteriv)
+		glad_glGetTextureParameteriv(texture, GL_TEXTURE_TARGET, &target);
+	return (GLenum)target;
+}
+
+static void APIENTRY lgl__memory_glTextureStorage2D(GLuint texture,
+						    GLsizei levels,
+						    GLenum internalformat,
+						    GLsizei width,
+						    GLsizei height)
+{
+	lgl__memoryPrev_glTextureStorage2D(texture, levels, internalformat,
+					   width, height);
+	lgl__memoryTexture(texture,
+			   lgl__memoryTextureTarget(texture, GL_TEXTURE_2D),
+			   0, levels, internalformat, width, height, 1);
+}
+
+static void APIENTRY lgl__memory_glTextureStorage3D(GLuint texture,
+						    GLsizei levels,
+						    GLenum internalformat,
+						    GLsizei width,
+						    GLsizei height,
+						    GLsizei depth)
+{
+	lgl__memoryPrev_glTextureStorage3D(texture, levels, internalformat,
+					   width, height, depth);
+	lgl__memoryTexture(texture,
+			   lgl__memoryTextureTarget(texture, GL_TEXTURE_2D_ARRAY),
+			   0, levels, internalformat, width, height, depth);
+}
+
+static void APIENTRY lgl__memory_glGenerateMipmap(GLenum target)
+{
+	lgl__memoryPrev_glGenerateMipmap(target);
+	lgl__memoryMipmaps(lgl__memoryBound(lgl__memoryTextureBinding(target)));
+}
+
+static void APIENTRY lgl__memory_glGenerateTextureMipmap(GLuint texture)
+{
+	lgl__memoryPrev_glGenerateTextureMipmap(texture);
+	lgl__memoryMipmaps(texture);
+}
+
+static void APIENTRY lgl__memory_glGenRenderbuffers(GLsizei n,
+						    GLuint *renderbuffers)
+{
+	lgl__memoryPrev_glGenRenderbuffers(n, renderbuffers);
+	lgl__memoryGlCreate(LGL_MEMORY_GL_RENDERBUFFER, n, renderbuffers);
+}
+
+static void APIENTRY lgl__memory_glCreateRenderbuffers(GLsizei n,
+						       GLuint *renderbuffers)
+{
+	lgl__memoryPrev_glCreateRenderbuffers(n, renderbuffers);
+	lgl__memoryGlCreate(LGL_MEMORY_GL_RENDERBUFFER, n, renderbuffers);
+}
+
+static void APIENTRY lgl__memory_glDeleteRenderbuffers(GLsizei n,
+						       const GLuint *renderbuffers)
+{
+	lgl__memoryPrev_glDeleteRenderbuffers(n, renderbuffers);
+	lgl__memoryGlDelete(LGL_MEMORY_GL_RENDERBUFFER, n, renderbuffers);
+}
+
+static void APIENTRY lgl__memory_glRenderbufferStorage(GLenum target,
+						       GLenum internalformat,
+						       GLsizei width,
+						       GLsizei height)
+{
+	lgl__memoryPrev_glRenderbufferStorage(target, internalformat, width,
+					      height);
+	lgl__memoryRenderbuffer(lgl__memoryBound(GL_RENDERBUFFER_BINDING), 0,
+				internalformat, width, height);
+}
+
+static void APIENTRY lgl__memory_glRenderbufferStorageMultisample(
+	GLenum target, GLsizei samples, GLenum internalformat, GLsizei width,
+	GLsizei height)
+{
+	lgl__memoryPrev_glRenderbufferStorageMultisample(target, samples,
+							 internalformat, width,
+							 height);
+	lgl__memoryRenderbuffer(lgl__memoryBound(GL_RENDERBUFFER_BINDING),
+				samples, internalformat, width, height);
+}
+
+static void APIENTRY lgl__memory_glNamedRenderbufferStorage(
+	GLuint renderbuffer, GLenum internalformat, GLsizei width,
+	GLsizei height)
+{
+	lgl__memoryPrev_glNamedRenderbufferStorage(renderbuffer, internalformat,
+						   width, height);
+	lgl__memoryRenderbuffer(renderbuffer, 0, internalformat, width, height);
+}
+
+static void APIENTRY lgl__memory_glNamedRenderbufferStorageMultisample(
+	GLuint renderbuffer, GLsizei samples, GLenum internalformat,
+	GLsizei width, GLsizei height)
+{
+	lgl__memoryPrev_glNamedRenderbufferStorageMultisample(
+		renderbuffer, samples, internalformat, width, height);
+	lgl__memoryRenderbuffer(renderbuffer, samples, internalformat, width,
+				height);
+}
+
+int lgl_memoryTrackGl(void)
+{
+	if (lgl__memory.tracking) return 0;
+
+	lgl__memoryGetIntegerv = glad_glGetIntegerv;
+#define LGL__MEMORY_HOOK(name, type) \
+	lgl__memoryPrev_##name = glad_##name; \
+	if (glad_##name) glad_##name = lgl__memory_##name;
+	LGL__MEMORY_ENTRY_POINTS(LGL__MEMORY_HOOK)
+#undef LGL__MEMORY_HOOK
+
+	lgl__memory.tracking = 1;
+	return 1;
+}
+
+void lgl_memoryUntrackGl(void)
+{
+	int left = 0;
+
+	if (!lgl__memory.tracking) return;
+
+#define LGL__MEMORY_UNHOOK(name, type) \
+	if (glad_##name == lgl__memory_##name) \
+		glad_##name = lgl__memoryPrev_##name; \
+	else if (glad_##name != lgl__memoryPrev_##name) \
+		left++;
+	LGL__MEMORY_ENTRY_POINTS(LGL__MEMORY_UNHOOK)
+#undef LGL__MEMORY_UNHOOK
+
+	lgl__memory.tracking = left > 0;
+}
+
+/* reports
+   ******* */
+
+void lgl_memoryStats(lgl_MemoryStats *subsystems, lgl_MemoryStats *host,
+		     lgl_MemoryStats *gl)
+{
+	if (subsystems)
+		memcpy(subsystems, lgl__memory.subsystems,
+		       sizeof(lgl__memory.subsystems));
+	if (host) *host = lgl__memory.host;
+	if (gl) *gl = lgl__memory.gl;
+}
+
+static void lgl__memoryPrintRow(FILE *file, const char *name,
+				const lgl_MemoryStats *stats)
+{
+	fprintf(file, "%-18s %12.1f %12.1f %8lu %8lu\n", name,
+		stats->current / 1024.0, stats->peak / 1024.0, stats->live,
+		stats->total);
+}
+
+void lgl_memoryPrint(FILE *file)
+{
+	int i;
+
+	fprintf(file, "%-18s %12s %12s %8s %8s\n", "memory", "current KiB",
+		"peak KiB", "live", "total");
+	for (i = 0; i < LGL_MEMORY_SUBSYSTEMS; i++) {
+		if (i == LGL_MEMORY_FIRST_GL)
+			lgl__memoryPrintRow(file, "host", &lgl__memory.host);
+		if (lgl__memory.subsystems[i].total)
+			lgl__memoryPrintRow(file, lgl__memoryNames[i],
+					    &lgl__memory.subsystems[i]);
+	}
+	lgl__memoryPrintRow(file, "GL (estimated)", &lgl__memory.gl);
+}
+
+unsigned long lgl_memoryReportLeaks(FILE *file)
+{
+	lgl__MemoryBlock *block;
+	unsigned long listed = 0;
+	int i;
+
+	for (block = lgl__memory.blocks; block; block = block->next) {
+		if (listed++ < LGL__MEMORY_MAX_LEAKS)
+			fprintf(file, "leak: %lu bytes of %s from %s:%d\n",
+				(unsigned long)block->size,
+				lgl__memoryNames[block->subsystem], block->file,
+				block->line);
+	}
+	if (listed > LGL__MEMORY_MAX_LEAKS)
+		fprintf(file, "leak: %lu more host blocks\n",
+			listed - LGL__MEMORY_MAX_LEAKS);
+
+	for (i = LGL_MEMORY_FIRST_GL; i < LGL_MEMORY_SUBSYSTEMS; i++) {
+		lgl__MemoryGlTable *table =
+			&lgl__memory.tables[i - LGL_MEMORY_FIRST_GL];
+		unsigned int name;
+
+		for (name = 0; name < table->capacity; name++) {
+			if (!table->objects[name].live) continue;
+			fprintf(file, "leak: %s %u, %lu bytes\n",
+				lgl__memoryNames[i], name,
+				(unsigned long)table->objects[name].bytes);
+		}
+	}
+
+	listed += lgl__memory.gl.live;
+	if (!listed) fprintf(file, "no leaks\n");
+	return listed;
+}
+
+#endif /*LGL_MEMORY_IMPLEMENTATION*/
@@ -0,0 +1,494 @@
+#ifndef __LGL_MESH_OPT__
+#define __LGL_MESH_OPT__
+
+/* Mesh processing run before the index buffer is uploaded: duplicate
+ * vertex welding, Forsyth vertex-cache ordering, overdraw-aware cluster
+ * ordering and vertex-fetch remapping. Meshes are indexed triangle lists
+ * over interleaved float vertices, `stride` floats apart, with the position
+ * in the first three floats. A stage that runs out of memory leaves the
+ * mesh untouched. */
+
+#define LGL_MESH_CACHE_SIZE 32
+
+typedef struct {
+	int triangles;
+	int vertices;   /* vertices referenced by the indices */
+	float acmr;     /* cache misses per triangle, 0.5 at best, 3 at worst */
+	float atvr;     /* cache misses per vertex, 1 at best */
+} lgl_MeshStats;
+
+/* simulates a FIFO post-transform cache of `cacheSize` entries */
+void lgl_meshAnalyze(const unsigned int *indices, int indexCount,
+		     int vertexCount, int cacheSize, lgl_MeshStats *stats);
+
+void lgl_meshPrintStats(const char *name, const lgl_MeshStats *before,
+			const lgl_MeshStats *after);
+
+/* merges bit-identical vertices and rewrites the indices, the vertex array
+ * is compacted in place; returns the new vertex count */
+int lgl_meshWeld(float *vertices, int vertexCount, int stride,
+		 unsigned int *indices, int indexCount);
+
+int lgl_meshOptimizeCache(unsigned int *indices, int indexCount,
+			  int vertexCount);
+
+/* reorders the clusters found in a cache-optimized index list so that
+ * outward facing ones are drawn first */
+int lgl_meshOptimizeOverdraw(unsigned int *indices, int indexCount,
+			     const float *vertices, int vertexCount,
+			     int stride);
+
+/* renumbers vertices in order of first use and drops unused ones; returns
+ * the new vertex count */
+int lgl_meshOptimizeFetch(float *vertices, int vertexCount, int stride,
+			  unsigned int *indices, int indexCount);
+
+/* runs every stage above; returns the new vertex count and fills the
+ * optional statistics */
+int lgl_meshOptimize(float *vertices, int vertexCount, int stride,
+		     unsigned int *indices, int indexCount,
+		     lgl_MeshStats *before, lgl_MeshStats *after);
+
+#endif /*__LGL_MESH_OPT__*/
+
+#ifdef LGL_MESH_OPT_IMPLEMENTATION
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+void lgl_meshAnalyze(const unsigned int *indices, int indexCount,
+		     int vertexCount, int cacheSize, lgl_MeshStats *stats)
+{
+	unsigned int *cache = malloc(sizeof(unsigned int) * cacheSize);
+	unsigned char *used = calloc(vertexCount > 0 ? vertexCount : 1, 1);
+	int i, j, head = 0, filled = 0, misses = 0, referenced = 0;
+
+	memset(stats, 0, sizeof(*stats));
+	if (!cache || !used) goto done;
+
+	for (i = 0; i < indexCount; i++) {
+		unsigned int v = indices[i];
+		int hit = 0;
+
+		for (j = 0; j < filled; j++) {
+			if (cache[j] == v) {
+				hit = 1;
+				break;
+			}
+		}
+		if (hit) continue;
+
+		misses++;
+		cache[head] = v;
+		head = (head + 1) % cacheSize;
+		if (filled < cacheSize) filled++;
+
+		if (!used[v]) {
+			used[v] = 1;
+			referenced++;
+		}
+	}
+
+	stats->triangles = indexCount / 3;
+	stats->vertices = referenced;
+	stats->acmr = stats->triangles ? (float)misses / stats->triangles : 0.0f;
+	stats->atvr = referenced ? (float)misses / referenced : 0.0f;
+
+ done:
+	free(cache);
+	free(used);
+}
+
+void lgl_meshPrintStats(const char *name, const lgl_MeshStats *before,
+			const lgl_MeshStats *after)
+{
+	printf("mesh \"%s\": %d triangles, %d -> %d vertices, "
+	       "ACMR %.3f -> %.3f, ATVR %.3f -> %.3f\n",
+	       name, after->triangles, before->vertices, after->vertices,
+	       before->acmr, after->acmr, before->atvr, after->atvr);
+}
+
+/* welding
+ ***********/
+static unsigned int lgl__hashVertex(const float *vertex, int stride)
+{
+	const unsigned char *bytes = (const unsigned char *)vertex;
+	unsigned int hash = 2166136261u;
+	size_t i;
+
+	for (i = 0; i < sizeof(float) * stride; i++)
+		hash = (hash ^ bytes[i]) * 16777619u;
+	return hash;
+}
+
+int lgl_meshWeld(float *vertices, int vertexCount, int stride,
+		 unsigned int *indices, int indexCount)
+{
+	unsigned int tableSize = 1, *table, *remap;
+	size_t vertexSize = sizeof(float) * stride;
+	int i, unique = 0;
+
+	while (tableSize < (unsigned int)vertexCount * 2) tableSize <<= 1;
+
+	table = malloc(sizeof(unsigned int) * tableSize);
+	remap = malloc(sizeof(unsigned int) * (vertexCount > 0 ? vertexCount : 1));
+	if (!table || !remap) {
+		free(table);
+		free(remap);
+		return vertexCount;
+	}
+	memset(table, 0xff, sizeof(unsigned int) * tableSize);
+
+	for (i = 0; i < vertexCount; i++) {
+		const float *vertex = vertices + (size_t)i * stride;
+		unsigned int slot = lgl__hashVertex(vertex, stride) & (tableSize - 1);
+
+		/* linear probing over the vertices kept so far */
+		while (table[slot] != 0xffffffffu
+		       && memcmp(vertices + (size_t)table[slot] * stride,
+				 vertex, vertexSize) != 0)
+			slot = (slot + 1) & (tableSize - 1);
+
+		if (table[slot] == 0xffffffffu) {
+			if (unique != i)
+				memmove(vertices + (size_t)unique * stride,
+					vertex, vertexSize);
+			table[slot] = unique++;
+		}
+		remap[i] = table[slot];
+	}
+
+	for (i = 0; i < indexCount; i++)
+		indices[i] = remap[indices[i]];
+
+	free(table);
+	free(remap);
+	return unique;
+}
+
+/* vertex cache optimization (Tom Forsyth, "Linear-Speed Vertex Cache
+ * Optimisation")
+ **************************************************************************/
+#define LGL__FORSYTH_CACHE 32
+
+static float lgl__forsythScore(int cachePos, int valence)
+{
+	float score = 0.0f;
+
+	if (valence == 0) return -1.0f;
+
+	if (cachePos >= 0) {
+		if (cachePos < 3) {
+			/* the last triangle's vertices, no matter the order */
+			score = 0.75f;
+		} else {
+			float scaler = 1.0f / (LGL__FORSYTH_CACHE - 3);
+			score = (float)pow(1.0f - (cachePos - 3) * scaler, 1.5);
+		}
+	}
+
+	return score + 2.0f * (float)pow((double)valence, -0.5);
+}
+
+int lgl_meshOptimizeCache(unsigned int *indices, int indexCount,
+			  int vertexCount)
+{
+	int triCount = indexCount / 3;
+	int *valence, *adjOffset, *adjacency, *cachePos;
+	float *vertexScore, *triScore;
+	unsigned char *emitted;
+	unsigned int *output;
+	int cache[LGL__FORSYTH_CACHE + 3], cacheCount = 0;
+	int i, j, t, best = -1, scanCursor = 0, ok = 0;
+
+	valence = calloc(vertexCount + 1, sizeof(int));
+	adjOffset = calloc(vertexCount + 1, sizeof(int));
+	adjacency = malloc(sizeof(int) * (indexCount + 1));
+	cachePos = malloc(sizeof(int) * (vertexCount + 1));
+	vertexScore = malloc(sizeof(float) * (vertexCount + 1));
+	triScore = malloc(sizeof(float) * (triCount + 1));
+	emitted = calloc(triCount + 1, 1);
+	output = malloc(sizeof(unsigned int) * (indexCount + 1));
+	if (!valence || !adjOffset || !adjacency || !cachePos || !vertexScore
+	    || !triScore || !emitted || !output)
+		goto defer;
+
+	/* triangle lists per vertex */
+	for (i = 0; i < triCount * 3; i++)
+		valence[indices[i]]++;
+	for (i = 1; i <= vertexCount; i++)
+		adjOffset[i] = adjOffset[i - 1] + valence[i - 1];
+	memset(valence, 0, sizeof(int) * vertexCount);
+	for (i = 0; i < triCount * 3; i++) {
+		unsigned int v = indices[i];
+		adjacency[adjOffset[v] + valence[v]++] = i / 3;
+	}
+
+	for (i = 0; i < vertexCount; i++) {
+		cachePos[i] = -1;
+		vertexScore[i] = lgl__forsythScore(-1, valence[i]);
+	}
+	for (t = 0; t < triCount; t++) {
+		triScore[t] = vertexScore[indices[t * 3]]
+			+ vertexScore[indices[t * 3 + 1]]
+			+ vertexScore[indices[t * 3 + 2]];
+		if (best < 0 || triScore[t] > triScore[best]) best = t;
+	}
+
+	for (i = 0; i < triCount; i++) {
+		int newCache[LGL__FORSYTH_CACHE + 3], newCount = 0;
+
+		if (best < 0) {
+			/* nothing in the cache touches a live triangle */
+			while (scanCursor < triCount && emitted[scanCursor])
+				scanCursor++;
+			best = scanCursor;
+		}
+
+		t = best;
+		emitted[t] = 1;
+		memcpy(output + i * 3, indices + t * 3, sizeof(unsigned int) * 3);
+
+		/* remove the triangle from its vertices' lists */
+		for (j = 0; j < 3; j++) {
+			unsigned int v = indices[t * 3 + j];
+			int *list = adjacency + adjOffset[v], k;
+
+			for (k = 0; k < valence[v]; k++) {
+				if (list[k] == t) {
+					list[k] = list[valence[v] - 1];
+					break;
+				}
+			}
+			valence[v]--;
+			newCache[newCount++] = (int)v;
+		}
+
+		/* LRU: the new triangle's vertices move to the front */
+		for (j = 0; j < cacheCount; j++) {
+			int v = cache[j];
+			if (v != newCache[0] && v != newCache[1] && v != newCache[2])
+				newCache[newCount++] = v;
+		}
+
+		for (j = 0; j < newCount; j++) {
+			int v = newCache[j];
+			cachePos[v] = j < LGL__FORSYTH_CACHE ? j : -1;
+			vertexScore[v] = lgl__forsythScore(cachePos[v], valence[v]);
+		}
+
+		/* rescore the live triangles touching the cache */
+		best = -1;
+		for (j = 0; j < newCount; j++) {
+			int v = newCache[j], k;
+			int *list = adjacency + adjOffset[v];
+
+			for (k = 0; k < valence[v]; k++) {
+				int tri = list[k];
+
+				triScore[tri] = vertexScore[indices[tri * 3]]
+					+ vertexScore[indices[tri * 3 + 1]]
+					+ vertexScore[indices[tri * 3 + 2]];
+				if (best < 0 || triScore[tri] > triScore[best])
+					best = tri;
+			}
+		}
+
+		cacheCount = newCount < LGL__FORSYTH_CACHE ? newCount : LGL__FORSYTH_CACHE;
+		memcpy(cache, newCache, sizeof(int) * cacheCount);
+	}
+
+	memcpy(indices, output, sizeof(unsigned int) * triCount * 3);
+	ok = 1;
+
+ defer:
+	free(valence);
+	free(adjOffset);
+	free(adjacency);
+	free(cachePos);
+	free(vertexScore);
+	free(triScore);
+	free(emitted);
+	free(output);
+	return ok;
+}
+
+/* overdraw
+ ************/
+typedef struct {
+	int start, count; /* in triangles */
+	float sortKey;
+} lgl__MeshCluster;
+
+static int lgl__compareClusters(const void *a, const void *b)
+{
+	float ka = ((const lgl__MeshCluster *)a)->sortKey;
+	float kb = ((const lgl__MeshCluster *)b)->sortKey;
+
+	return (ka < kb) - (ka > kb);
+}
+
+int lgl_meshOptimizeOverdraw(unsigned int *indices, int indexCount,
+			     const float *vertices, int vertexCount,
+			     int stride)
+{
+	int triCount = indexCount / 3;
+	lgl__MeshCluster *clusters;
+	unsigned int *output, *cacheTime;
+	float meshCenter[3] = {0.0f, 0.0f, 0.0f};
+	int i, c, clusterCount = 0, time = 0;
+
+	clusters = malloc(sizeof(lgl__MeshCluster) * (triCount + 1));
+	output = malloc(sizeof(unsigned int) * (indexCount + 1));
+	cacheTime = calloc(vertexCount + 1, sizeof(unsigned int));
+	if (!clusters || !output || !cacheTime) {
+		free(clusters);
+		free(output);
+		free(cacheTime);
+		return 0;
+	}
+
+	for (i = 0; i < vertexCount; i++) {
+		meshCenter[0] += vertices[(size_t)i * stride] / vertexCount;
+		meshCenter[1] += vertices[(size_t)i * stride + 1] / vertexCount;
+		meshCenter[2] += vertices[(size_t)i * stride + 2] / vertexCount;
+	}
+
+	/* a cluster starts wherever the simulated cache misses on every
+	 * vertex of a triangle, i.e. where the cache optimizer restarted */
+	for (i = 0; i < triCount; i++) {
+		int j, misses = 0;
+
+		for (j = 0; j < 3; j++) {
+			unsigned int v = indices[i * 3 + j];
+			if (!cacheTime[v] || time - cacheTime[v] >= LGL_MESH_CACHE_SIZE) {
+				cacheTime[v] = ++time;
+				misses++;
+			}
+		}
+
+		if (i == 0 || misses == 3) {
+			clusters[clusterCount].start = i;
+			clusters[clusterCount].count = 0;
+			clusterCount++;
+		}
+		clusters[clusterCount - 1].count++;
+	}
+
+	/* clusters facing away from the mesh center occlude the others */
+	for (c = 0; c < clusterCount; c++) {
+		float center[3] = {0.0f, 0.0f, 0.0f}, normal[3] = {0.0f, 0.0f, 0.0f};
+		float area = 0.0f, length;
+
+		for (i = clusters[c].start; i < clusters[c].start + clusters[c].count; i++) {
+			const float *a = vertices + (size_t)indices[i * 3] * stride;
+			const float *b = vertices + (size_t)indices[i * 3 + 1] * stride;
+			const float *d = vertices + (size_t)indices[i * 3 + 2] * stride;
+			float e1[3], e2[3], n[3], triArea;
+			int k;
+
+			for (k = 0; k < 3; k++) {
+				e1[k] = b[k] - a[k];
+				e2[k] = d[k] - a[k];
+			}
+			n[0] = e1[1] * e2[2] - e1[2] * e2[1];
+			n[1] = e1[2] * e2[0] - e1[0] * e2[2];
+			n[2] = e1[0] * e2[1] - e1[1] * e2[0];
+			triArea = (float)sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+
+			for (k = 0; k < 3; k++) {
+				center[k] += (a[k] + b[k] + d[k]) / 3.0f * triArea;
+				normal[k] += n[k];
+			}
+			area += triArea;
+		}
+
+		length = (float)sqrt(normal[0] * normal[0] + normal[1] * normal[1]
+			       + normal[2] * normal[2]);
+		clusters[c].sortKey = 0.0f;
+		if (area > 0.0f && length > 0.0f) {
+			int k;
+			for (k = 0; k < 3; k++)
+				clusters[c].sortKey += (center[k] / area - meshCenter[k])
+					* normal[k] / length;
+		}
+	}
+
+	qsort(clusters, clusterCount, sizeof(lgl__MeshCluster),
+	      lgl__compareClusters);
+
+	for (c = 0, i = 0; c < clusterCount; c++) {
+		memcpy(output + i * 3, indices + clusters[c].start * 3,
+		       sizeof(unsigned int) * 3 * clusters[c].count);
+		i += clusters[c].count;
+	}
+	memcpy(indices, output, sizeof(unsigned int) * triCount * 3);
+
+	free(clusters);
+	free(output);
+	free(cacheTime);
+	return 1;
+}
+
+/* vertex fetch
+ ****************/
+int lgl_meshOptimizeFetch(float *vertices, int vertexCount, int stride,
+			  unsigned int *indices, int indexCount)
+{
+	size_t vertexSize = sizeof(float) * stride;
+	unsigned int *remap;
+	float *copy;
+	int i, next = 0;
+
+	remap = malloc(sizeof(unsigned int) * (vertexCount + 1));
+	copy = malloc(vertexSize * (vertexCount + 1));
+	if (!remap || !copy) {
+		free(remap);
+		free(copy);
+		return vertexCount;
+	}
+
+	memcpy(copy, vertices, vertexSize * vertexCount);
+	memset(remap, 0xff, sizeof(unsigned int) * vertexCount);
+
+	for (i = 0; i < indexCount; i++) {
+		unsigned int v = indices[i];
+
+		if (remap[v] == 0xffffffffu) {
+			memcpy(vertices + (size_t)next * stride,
+			       copy + (size_t)v * stride, vertexSize);
+			remap[v] = next++;
+		}
+		indices[i] = remap[v];
+	}
+
+	free(remap);
+	free(copy);
+	return next;
+}
+
+int lgl_meshOptimize(float *vertices, int vertexCount, int stride,
+		     unsigned int *indices, int indexCount,
+		     lgl_MeshStats *before, lgl_MeshStats *after)
+{
+	if (before)
+		lgl_meshAnalyze(indices, indexCount, vertexCount,
+				LGL_MESH_CACHE_SIZE, before);
+
+	vertexCount = lgl_meshWeld(vertices, vertexCount, stride,
+				   indices, indexCount);
+	lgl_meshOptimizeCache(indices, indexCount, vertexCount);
+	lgl_meshOptimizeOverdraw(indices, indexCount, vertices,
+				 vertexCount, stride);
+	vertexCount = lgl_meshOptimizeFetch(vertices, vertexCount, stride,
+					    indices, indexCount);
+
+	if (after)
+		lgl_meshAnalyze(indices, indexCount, vertexCount,
+				LGL_MESH_CACHE_SIZE, after);
+	return vertexCount;
+}
+
+#endif /*LGL_MESH_OPT_IMPLEMENTATION*/
@@ -0,0 +1,256 @@
+#ifndef __LGL_MULTIDRAW__
+#define __LGL_MULTIDRAW__
+
+#include <stddef.h>
+
+/* Multi-draw indirect batching: meshes are appended to one shared vertex
+ * and index buffer (the arena), so every mesh can be drawn from the same
+ * VAO with its own first index and base vertex. A draw batch records one
+ * DrawElementsIndirectCommand plus a block of per-draw data for every
+ * draw, uploads both and submits the whole pass with a single
+ * glMultiDrawElementsIndirect. Shaders fetch their per-draw data from the
+ * storage buffer with gl_DrawID. */
+
+typedef struct {
+	unsigned int count;
+	unsigned int instanceCount;
+	unsigned int firstIndex;
+	int baseVertex;
+	unsigned int baseInstance;
+} lgl_DrawElementsIndirectCommand;
+
+/* where a mesh lives in the arena */
+typedef struct {
+	unsigned int firstIndex;
+	unsigned int indexCount;
+	int baseVertex;
+	int vertexCount;
+} lgl_ArenaMesh;
+
+typedef struct {
+	int stride;
+	int vertexCount, vertexCapacity;
+	int indexCount, indexCapacity;
+
+	unsigned int VAO;
+	unsigned int VBO, EBO;
+} lgl_MeshArena;
+
+typedef struct {
+	int count, capacity;
+	int drawDataSize;  /* bytes of per-draw data, may be 0 */
+
+	lgl_DrawElementsIndirectCommand *commands;
+	unsigned char *drawData;
+
+	unsigned int commandBuffer;  /* GL_DRAW_INDIRECT_BUFFER */
+	unsigned int drawDataBuffer; /* GL_SHADER_STORAGE_BUFFER */
+	size_t commandBufferSize, drawDataBufferSize;
+} lgl_DrawBatch;
+
+/* creates the arena buffers and its VAO; the VAO is left bound with the
+ * vertex buffer on binding 0, so the caller only describes the attributes
+ * (glVertexAttribFormat/glVertexAttribBinding or
+ * lgl_vertexFormatApplyBinding(fmt, 0)) */
+int lgl_meshArenaInit(lgl_MeshArena *arena, int stride,
+		      int vertexCapacity, int indexCapacity);
+
+void lgl_meshArenaFree(lgl_MeshArena *arena);
+
+/* copies a mesh into the arena; indices are relative to the mesh's own
+ * vertices. Returns 0 if the arena is full. */
+int lgl_meshArenaAdd(lgl_MeshArena *arena, const void *vertices,
+		     int vertexCount, const unsigned int *indices,
+		     int indexCount, lgl_ArenaMesh *mesh);
+
+int lgl_drawBatchInit(lgl_DrawBatch *batch, int drawDataSize, int capacity);
+
+void lgl_drawBatchFree(lgl_DrawBatch *batch);
+
+void lgl_drawBatchReset(lgl_DrawBatch *batch);
+
+/* records a draw of `mesh`; `drawData` (drawDataSize bytes) is copied into
+ * the slot read by gl_DrawID. Returns the draw index or -1. */
+int lgl_drawBatchAdd(lgl_DrawBatch *batch, const lgl_ArenaMesh *mesh,
+		     unsigned int instanceCount, const void *drawData);
+
+/* uploads the commands and per-draw data (bound as a storage buffer on
+ * `binding`) and draws the whole batch from the arena */
+void lgl_drawBatchSubmit(lgl_DrawBatch *batch, const lgl_MeshArena *arena,
+			 unsigned int binding);
+
+#endif /*__LGL_MULTIDRAW__*/
+
+#ifdef LGL_MULTIDRAW_IMPLEMENTATION
+
+#include <stdlib.h>
+#include <string.h>
+
+int lgl_meshArenaInit(lgl_MeshArena *arena, int stride,
+		      int vertexCapacity, int indexCapacity)
+{
+	memset(arena, 0, sizeof(*arena));
+	arena->stride = stride;
+	arena->vertexCapacity = vertexCapacity;
+	arena->indexCapacity = indexCapacity;
+
+	glGenVertexArrays(1, &arena->VAO);
+	glGenBuffers(1, &arena->VBO);
+	glGenBuffers(1, &arena->EBO);
+	if (!arena->VAO || !arena->VBO || !arena->EBO) return 0;
+
+	/* immutable stores, filled with glBufferSubData as meshes come in */
+	glBindVertexArray(arena->VAO);
+	glBindBuffer(GL_ARRAY_BUFFER, arena->VBO);
+	glBufferStorage(GL_ARRAY_BUFFER, (size_t)stride * vertexCapacity,
+			NULL, GL_DYNAMIC_STORAGE_BIT);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, arena->EBO);
+	glBufferStorage(GL_ELEMENT_ARRAY_BUFFER,
+			sizeof(unsigned int) * indexCapacity,
+			NULL, GL_DYNAMIC_STORAGE_BIT);
+
+	glBindVertexBuffer(0, arena->VBO, 0, stride);
+	return 1;
+}
+
+void lgl_meshArenaFree(lgl_MeshArena *arena)
+{
+	if (arena->VAO) glDeleteVertexArrays(1, &arena->VAO);
+	if (arena->VBO) glDeleteBuffers(1, &arena->VBO);
+	if (arena->EBO) glDeleteBuffers(1, &arena->EBO);
+	memset(arena, 0, sizeof(*arena));
+}
+
+int lgl_meshArenaAdd(lgl_MeshArena *arena, const void *vertices,
+		     int vertexCount, const unsigned int *indices,
+		     int indexCount, lgl_ArenaMesh *mesh)
+{
+	if (arena->vertexCount + vertexCount > arena->vertexCapacity
+	    || arena->indexCount + indexCount > arena->indexCapacity)
+		return 0;
+
+	glBindBuffer(GL_ARRAY_BUFFER, arena->VBO);
+	glBufferSubData(GL_ARRAY_BUFFER,
+			(size_t)arena->stride * arena->vertexCount,
+			(size_t)arena->stride * vertexCount, vertices);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, arena->EBO);
+	glBufferSubData(GL_COPY_WRITE_BUFFER,
+			sizeof(unsigned int) * arena->indexCount,
+			sizeof(unsigned int) * indexCount, indices);
+
+	mesh->firstIndex = arena->indexCount;
+	mesh->indexCount = indexCount;
+	mesh->baseVertex = arena->vertexCount;
+	mesh->vertexCount = vertexCount;
+
+	arena->vertexCount += vertexCount;
+	arena->indexCount += indexCount;
+	return 1;
+}
+
+int lgl_drawBatchInit(lgl_DrawBatch *batch, int drawDataSize, int capacity)
+{
+	memset(batch, 0, sizeof(*batch));
+	batch->drawDataSize = drawDataSize;
+	batch->capacity = capacity > 0 ? capacity : 1;
+
+	batch->commands = malloc(sizeof(*batch->commands) * batch->capacity);
+	if (drawDataSize > 0)
+		batch->drawData = malloc((size_t)drawDataSize * batch->capacity);
+	if (!batch->commands || (drawDataSize > 0 && !batch->drawData)) {
+		lgl_drawBatchFree(batch);
+		return 0;
+	}
+
+	glGenBuffers(1, &batch->commandBuffer);
+	glGenBuffers(1, &batch->drawDataBuffer);
+	return 1;
+}
+
+void lgl_drawBatchFree(lgl_DrawBatch *batch)
+{
+	if (batch->commandBuffer) glDeleteBuffers(1, &batch->commandBuffer);
+	if (batch->drawDataBuffer) glDeleteBuffers(1, &batch->drawDataBuffer);
+	free(batch->commands);
+	free(batch->drawData);
+	memset(batch, 0, sizeof(*batch));
+}
+
+void lgl_drawBatchReset(lgl_DrawBatch *batch)
+{
+	batch->count = 0;
+}
+
+int lgl_drawBatchAdd(lgl_DrawBatch *batch, const lgl_ArenaMesh *mesh,
+		     unsigned int instanceCount, const void *drawData)
+{
+	lgl_DrawElementsIndirectCommand *command;
+
+	if (batch->count == batch->capacity) {
+		int capacity = batch->capacity * 2;
+		void *grown;
+
+		grown = realloc(batch->commands, sizeof(*batch->commands) * capacity);
+		if (!grown) return -1;
+		batch->commands = grown;
+
+		if (batch->drawDataSize > 0) {
+			grown = realloc(batch->drawData,
+					(size_t)batch->drawDataSize * capacity);
+			if (!grown) return -1;
+			batch->drawData = grown;
+		}
+		batch->capacity = capacity;
+	}
+
+	command = &batch->commands[batch->count];
+	command->count = mesh->indexCount;
+	command->instanceCount = instanceCount;
+	command->firstIndex = mesh->firstIndex;
+	command->baseVertex = mesh->baseVertex;
+	command->baseInstance = 0;
+
+	if (batch->drawDataSize > 0 && drawData)
+		memcpy(batch->drawData + (size_t)batch->drawDataSize * batch->count,
+		       drawData, batch->drawDataSize);
+
+	return batch->count++;
+}
+
+/* orphans the store when it is big enough, grows it otherwise */
+static void lgl__batchStream(unsigned int target, unsigned int buffer,
+			     size_t *bufferSize, size_t capacity,
+			     const void *data, size_t size)
+{
+	glBindBuffer(target, buffer);
+	if (capacity > *bufferSize) *bufferSize = capacity;
+	glBufferData(target, *bufferSize, NULL, GL_STREAM_DRAW);
+	glBufferSubData(target, 0, size, data);
+}
+
+void lgl_drawBatchSubmit(lgl_DrawBatch *batch, const lgl_MeshArena *arena,
+			 unsigned int binding)
+{
+	if (batch->count == 0) return;
+
+	lgl__batchStream(GL_DRAW_INDIRECT_BUFFER, batch->commandBuffer,
+			 &batch->commandBufferSize,
+			 sizeof(*batch->commands) * batch->capacity,
+			 batch->commands, sizeof(*batch->commands) * batch->count);
+
+	if (batch->drawDataSize > 0) {
+		lgl__batchStream(GL_SHADER_STORAGE_BUFFER, batch->drawDataBuffer,
+				 &batch->drawDataBufferSize,
+				 (size_t)batch->drawDataSize * batch->capacity,
+				 batch->drawData,
+				 (size_t)batch->drawDataSize * batch->count);
+		glBindBufferBase(GL_SHADER_STORAGE_BUFFER, binding,
+				 batch->drawDataBuffer);
+	}
+
+	glBindVertexArray(arena->VAO);
+	glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, (void *)0,
+				    batch->count, 0);
+}
+
+#endif /*LGL_MULTIDRAW_IMPLEMENTATION*/
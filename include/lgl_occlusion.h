@@ -0,0 +1,339 @@
+#ifndef __LGL_OCCLUSION__
+#define __LGL_OCCLUSION__
+
+#include <cglm/cglm.h>
+
+/* Software occlusion culling: a handful of occluder meshes are rasterized
+ * into a small CPU depth buffer, which is then reduced into a per-tile
+ * hierarchical-Z. Object bounds are tested against it before any draw call
+ * is issued. Depth runs from 0 (near) to 1 (far), like the default GL
+ * depth range. */
+
+#define LGL_OCCLUSION_TILE 8
+
+typedef struct {
+	int width, height; /* rounded up to a multiple of LGL_OCCLUSION_TILE */
+	int tilesX, tilesY;
+	float *depth;      /* nearest occluder depth per pixel */
+	float *hiz;        /* farthest occluder depth per tile */
+	mat4 viewProj;
+
+	/* statistics, reset by lgl_occlusionBegin */
+	unsigned int trianglesRasterized;
+	unsigned int objectsTested;
+	unsigned int objectsOccluded;
+} lgl_OcclusionBuffer;
+
+int lgl_occlusionInit(lgl_OcclusionBuffer *ob, int width, int height);
+
+void lgl_occlusionFree(lgl_OcclusionBuffer *ob);
+
+/* clears the depth buffer and sets the camera used by the following calls */
+void lgl_occlusionBegin(lgl_OcclusionBuffer *ob, mat4 viewProj);
+
+/* positions are read as 3 floats every `stride` floats, like the
+ * interleaved vertex arrays of the samples */
+void lgl_occlusionRasterize(lgl_OcclusionBuffer *ob, mat4 model,
+			    const float *positions, int stride,
+			    const unsigned int *indices, int indexCount);
+
+void lgl_occlusionBuildHiZ(lgl_OcclusionBuffer *ob);
+
+/* returns 0 if the box is hidden behind the occluders or outside the
+ * view, 1 if it may be visible */
+int lgl_occlusionTestAABB(lgl_OcclusionBuffer *ob, vec3 min, vec3 max);
+
+#endif /*__LGL_OCCLUSION__*/
+
+#ifdef LGL_OCCLUSION_IMPLEMENTATION
+
+#include <float.h>
+#include <stdlib.h>
+#include <math.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#define LGL__OCC_MIN_W 1e-5f
+
+int lgl_occlusionInit(lgl_OcclusionBuffer *ob, int width, int height)
+{
+	int tile = LGL_OCCLUSION_TILE;
+
+	ob->width = (width + tile - 1) / tile * tile;
+	ob->height = (height + tile - 1) / tile * tile;
+	ob->tilesX = ob->width / tile;
+	ob->tilesY = ob->height / tile;
+
+	ob->depth = malloc(sizeof(float) * ob->width * ob->height);
+	ob->hiz = malloc(sizeof(float) * ob->tilesX * ob->tilesY);
+	if (!ob->depth || !ob->hiz) {
+		lgl_occlusionFree(ob);
+		return 0;
+	}
+
+	glm_mat4_identity(ob->viewProj);
+	ob->trianglesRasterized = 0;
+	ob->objectsTested = 0;
+	ob->objectsOccluded = 0;
+	return 1;
+}
+
+void lgl_occlusionFree(lgl_OcclusionBuffer *ob)
+{
+	free(ob->depth);
+	free(ob->hiz);
+	ob->depth = NULL;
+	ob->hiz = NULL;
+}
+
+void lgl_occlusionBegin(lgl_OcclusionBuffer *ob, mat4 viewProj)
+{
+	int i, count = ob->width * ob->height;
+
+#if defined(__SSE2__)
+	__m128 far = _mm_set1_ps(1.0f);
+	for (i = 0; i < count; i += 4)
+		_mm_storeu_ps(ob->depth + i, far);
+#else
+	for (i = 0; i < count; i++)
+		ob->depth[i] = 1.0f;
+#endif
+
+	glm_mat4_copy(viewProj, ob->viewProj);
+	ob->trianglesRasterized = 0;
+	ob->objectsTested = 0;
+	ob->objectsOccluded = 0;
+}
+
+/* v0, v1 and v2 are in window space: x and y in pixels, z in [0, 1] */
+static void lgl__occlusionTriangle(lgl_OcclusionBuffer *ob,
+				   const float *v0, const float *v1,
+				   const float *v2)
+{
+	float area, zx, zy, zc;
+	float a0, b0, c0, a1, b1, c1, a2, b2, c2;
+	int minX, maxX, minY, maxY, x, y;
+
+	/* counter-clockwise triangles face the camera */
+	area = (v1[0] - v0[0]) * (v2[1] - v0[1])
+		- (v2[0] - v0[0]) * (v1[1] - v0[1]);
+	if (area <= 0.0f) return;
+
+	minX = (int)floorf(glm_min(v0[0], glm_min(v1[0], v2[0])));
+	maxX = (int)ceilf(glm_max(v0[0], glm_max(v1[0], v2[0])));
+	minY = (int)floorf(glm_min(v0[1], glm_min(v1[1], v2[1])));
+	maxY = (int)ceilf(glm_max(v0[1], glm_max(v1[1], v2[1])));
+
+	if (minX < 0) minX = 0;
+	if (minY < 0) minY = 0;
+	if (maxX > ob->width - 1) maxX = ob->width - 1;
+	if (maxY > ob->height - 1) maxY = ob->height - 1;
+	if (minX > maxX || minY > maxY) return;
+
+	/* rows are walked four pixels at a time */
+	minX &= ~3;
+
+	/* edge functions e(x, y) = a * x + b * y + c, positive inside */
+	a0 = v1[1] - v2[1]; b0 = v2[0] - v1[0];
+	c0 = (v2[1] - v1[1]) * v1[0] - (v2[0] - v1[0]) * v1[1];
+	a1 = v2[1] - v0[1]; b1 = v0[0] - v2[0];
+	c1 = (v0[1] - v2[1]) * v2[0] - (v0[0] - v2[0]) * v2[1];
+	a2 = v0[1] - v1[1]; b2 = v1[0] - v0[0];
+	c2 = (v1[1] - v0[1]) * v0[0] - (v1[0] - v0[0]) * v0[1];
+
+	/* depth is affine in window space */
+	zx = ((v1[2] - v0[2]) * (v2[1] - v0[1])
+	      - (v2[2] - v0[2]) * (v1[1] - v0[1])) / area;
+	zy = ((v2[2] - v0[2]) * (v1[0] - v0[0])
+	      - (v1[2] - v0[2]) * (v2[0] - v0[0])) / area;
+	zc = v0[2] - zx * v0[0] - zy * v0[1];
+
+	for (y = minY; y <= maxY; y++) {
+		float py = (float)y + 0.5f;
+		float *row = ob->depth + y * ob->width;
+
+#if defined(__SSE2__)
+		__m128 zero = _mm_setzero_ps();
+		__m128 offs = _mm_set_ps(3.5f, 2.5f, 1.5f, 0.5f);
+		__m128 va0 = _mm_set1_ps(a0), vr0 = _mm_set1_ps(b0 * py + c0);
+		__m128 va1 = _mm_set1_ps(a1), vr1 = _mm_set1_ps(b1 * py + c1);
+		__m128 va2 = _mm_set1_ps(a2), vr2 = _mm_set1_ps(b2 * py + c2);
+		__m128 vzx = _mm_set1_ps(zx), vzr = _mm_set1_ps(zy * py + zc);
+
+		for (x = minX; x <= maxX; x += 4) {
+			__m128 px = _mm_add_ps(_mm_set1_ps((float)x), offs);
+			__m128 e0 = _mm_add_ps(_mm_mul_ps(va0, px), vr0);
+			__m128 e1 = _mm_add_ps(_mm_mul_ps(va1, px), vr1);
+			__m128 e2 = _mm_add_ps(_mm_mul_ps(va2, px), vr2);
+			__m128 z = _mm_add_ps(_mm_mul_ps(vzx, px), vzr);
+			__m128 old = _mm_loadu_ps(row + x);
+			__m128 mask;
+
+			mask = _mm_and_ps(_mm_cmpge_ps(e0, zero),
+					  _mm_cmpge_ps(e1, zero));
+			mask = _mm_and_ps(mask, _mm_cmpge_ps(e2, zero));
+			mask = _mm_and_ps(mask, _mm_cmplt_ps(z, old));
+
+			_mm_storeu_ps(row + x, _mm_or_ps(_mm_and_ps(mask, z),
+							 _mm_andnot_ps(mask, old)));
+		}
+#else
+		for (x = minX; x <= maxX; x++) {
+			float px = (float)x + 0.5f;
+			float z;
+
+			if (a0 * px + b0 * py + c0 < 0.0f) continue;
+			if (a1 * px + b1 * py + c1 < 0.0f) continue;
+			if (a2 * px + b2 * py + c2 < 0.0f) continue;
+
+			z = zx * px + zy * py + zc;
+			if (z < row[x]) row[x] = z;
+		}
+#endif
+	}
+
+	ob->trianglesRasterized++;
+}
+
+static void lgl__occlusionToWindow(const lgl_OcclusionBuffer *ob,
+				   const vec4 clip, float *out)
+{
+	float invW = 1.0f / clip[3];
+
+	out[0] = (clip[0] * invW * 0.5f + 0.5f) * (float)ob->width;
+	out[1] = (clip[1] * invW * 0.5f + 0.5f) * (float)ob->height;
+	out[2] = clip[2] * invW * 0.5f + 0.5f;
+}
+
+void lgl_occlusionRasterize(lgl_OcclusionBuffer *ob, mat4 model,
+			    const float *positions, int stride,
+			    const unsigned int *indices, int indexCount)
+{
+	mat4 mvp;
+	int i;
+
+	glm_mat4_mul(ob->viewProj, model, mvp);
+
+	for (i = 0; i + 2 < indexCount; i += 3) {
+		vec4 clip[3], poly[4];
+		float win[4][3];
+		int j, count = 0;
+
+		for (j = 0; j < 3; j++) {
+			const float *p = positions + indices[i + j] * stride;
+			glm_mat4_mulv(mvp, (vec4){p[0], p[1], p[2], 1.0f},
+				      clip[j]);
+		}
+
+		/* clip against the near plane (z = -w); the result has at
+		 * most four vertices */
+		for (j = 0; j < 3; j++) {
+			float *a = clip[j], *b = clip[(j + 1) % 3];
+			float da = a[2] + a[3], db = b[2] + b[3];
+
+			if (da >= 0.0f)
+				glm_vec4_copy(a, poly[count++]);
+			if ((da >= 0.0f) != (db >= 0.0f))
+				glm_vec4_lerp(a, b, da / (da - db), poly[count++]);
+		}
+		if (count < 3) continue;
+
+		for (j = 0; j < count; j++) {
+			if (poly[j][3] < LGL__OCC_MIN_W) break;
+			lgl__occlusionToWindow(ob, poly[j], win[j]);
+		}
+		if (j < count) continue;
+
+		lgl__occlusionTriangle(ob, win[0], win[1], win[2]);
+		if (count == 4)
+			lgl__occlusionTriangle(ob, win[0], win[2], win[3]);
+	}
+}
+
+void lgl_occlusionBuildHiZ(lgl_OcclusionBuffer *ob)
+{
+	int tx, ty, y, x;
+	int tile = LGL_OCCLUSION_TILE;
+
+	for (ty = 0; ty < ob->tilesY; ty++) {
+		for (tx = 0; tx < ob->tilesX; tx++) {
+			const float *base = ob->depth
+				+ ty * tile * ob->width + tx * tile;
+			float farthest;
+
+#if defined(__SSE2__)
+			__m128 m = _mm_setzero_ps();
+			for (y = 0; y < tile; y++)
+				for (x = 0; x < tile; x += 4)
+					m = _mm_max_ps(m, _mm_loadu_ps(base + y * ob->width + x));
+			m = _mm_max_ps(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(1, 0, 3, 2)));
+			m = _mm_max_ps(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(2, 3, 0, 1)));
+			farthest = _mm_cvtss_f32(m);
+#else
+			farthest = 0.0f;
+			for (y = 0; y < tile; y++)
+				for (x = 0; x < tile; x++)
+					if (base[y * ob->width + x] > farthest)
+						farthest = base[y * ob->width + x];
+#endif
+
+			ob->hiz[ty * ob->tilesX + tx] = farthest;
+		}
+	}
+}
+
+int lgl_occlusionTestAABB(lgl_OcclusionBuffer *ob, vec3 min, vec3 max)
+{
+	float minX = (float)ob->width, maxX = 0.0f;
+	float minY = (float)ob->height, maxY = 0.0f;
+	float nearest = FLT_MAX; /* above 1 when the box is past the far plane */
+	int i, behind = 0, tx, ty, tx0, tx1, ty0, ty1;
+
+	ob->objectsTested++;
+
+	for (i = 0; i < 8; i++) {
+		vec4 corner, clip;
+		float win[3];
+
+		corner[0] = (i & 1) ? max[0] : min[0];
+		corner[1] = (i & 2) ? max[1] : min[1];
+		corner[2] = (i & 4) ? max[2] : min[2];
+		corner[3] = 1.0f;
+		glm_mat4_mulv(ob->viewProj, corner, clip);
+
+		if (clip[3] < LGL__OCC_MIN_W || clip[2] < -clip[3]) {
+			behind++;
+			continue;
+		}
+
+		lgl__occlusionToWindow(ob, clip, win);
+		minX = glm_min(minX, win[0]); maxX = glm_max(maxX, win[0]);
+		minY = glm_min(minY, win[1]); maxY = glm_max(maxY, win[1]);
+		nearest = glm_min(nearest, win[2]);
+	}
+
+	/* a box crossing the near plane is assumed to be visible */
+	if (behind > 0 && behind < 8) return 1;
+
+	if (behind == 8 || maxX < 0.0f || maxY < 0.0f || nearest > 1.0f
+	    || minX >= (float)ob->width || minY >= (float)ob->height) {
+		ob->objectsOccluded++;
+		return 0;
+	}
+
+	tx0 = (int)glm_max(minX, 0.0f) / LGL_OCCLUSION_TILE;
+	ty0 = (int)glm_max(minY, 0.0f) / LGL_OCCLUSION_TILE;
+	tx1 = (int)glm_min(maxX, (float)(ob->width - 1)) / LGL_OCCLUSION_TILE;
+	ty1 = (int)glm_min(maxY, (float)(ob->height - 1)) / LGL_OCCLUSION_TILE;
+
+	for (ty = ty0; ty <= ty1; ty++)
+		for (tx = tx0; tx <= tx1; tx++)
+			if (nearest <= ob->hiz[ty * ob->tilesX + tx]) return 1;
+
+	ob->objectsOccluded++;
+	return 0;
+}
+
+#endif /*LGL_OCCLUSION_IMPLEMENTATION*/
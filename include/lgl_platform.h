@@ -0,0 +1,762 @@
+#ifndef __LGL_PLATFORM__
+#define __LGL_PLATFORM__
+
+/* Window and context platform. By default this is just GLFW. Built with
+ * LGL_PLATFORM_EGL (surfaceless Mesa, e.g. llvmpipe) or
+ * LGL_PLATFORM_OSMESA it instead implements the part of the GLFW API the
+ * samples use on an offscreen context, so every sample runs unchanged on
+ * machines without a display or GPU:
+ *
+ *  - the "window" is an offscreen color + depth/stencil target of the
+ *    requested size, an FBO left bound for EGL, the OSMesa buffer itself
+ *    for OSMesa;
+ *  - the requested context version is tried first, then lower ones down
+ *    to 3.3, since software drivers may not reach 4.6;
+ *  - glfwWindowShouldClose turns true after LGL_FRAMES frames (default
+ *    100) and glfwSwapBuffers waits for the frame with glFinish;
+ *  - there is no input, glfwGetKey always reports GLFW_RELEASE.
+ *
+ * For benchmarking, LGL_FIXED_DT (in seconds) makes glfwGetTime return
+ * frame number * LGL_FIXED_DT, so animations are the same on every run
+ * whatever the frame rate. LGL_BENCH names a file ("-" for stdout) that
+ * receives, at glfwTerminate, a JSON object with percentiles of per-frame
+ * CPU time (from one swap to the next), swap time (waiting for the GPU
+ * in glFinish) and GPU time (GL_TIME_ELAPSED around the frame). The first
+ * LGL_WARMUP frames (default 1) run on top of LGL_FRAMES and are left
+ * out. With LGL_GL_TRACE set the object also has the time spent inside
+ * GL calls per frame (gl_ms): the platform installs lgl_gl_trace.h at the
+ * first swap, once the sample has loaded GL, unless the sample installed
+ * it itself or LGL_GL_CAPTURE is set. The trace reports the time through
+ * lgl_platformBenchGl. The wrappers add to the CPU time they measure.
+ *
+ * LGL_CAPTURE names a binary PPM file that receives the last frame before
+ * the window closes, e.g. to compare against a reference image. The frame
+ * is read into a pixel buffer object when it is swapped and mapped only
+ * at glfwTerminate, so the readback does not stall the frame.
+ *
+ * The headless backends read the clock with clock_gettime, so build them
+ * with _POSIX_C_SOURCE defined. Define LGL_PLATFORM_IMPLEMENTATION in the
+ * file containing main. */
+
+#if defined(LGL_PLATFORM_EGL) || defined(LGL_PLATFORM_OSMESA)
+#define LGL_PLATFORM_HEADLESS
+#endif
+
+#ifndef LGL_PLATFORM_HEADLESS
+
+#include <GLFW/glfw3.h>
+
+#else
+
+/* the same values as in GLFW/glfw3.h */
+#define GLFW_FALSE 0
+#define GLFW_TRUE 1
+#define GLFW_RELEASE 0
+#define GLFW_PRESS 1
+
+#define GLFW_KEY_SPACE 32
+#define GLFW_KEY_ESCAPE 256
+#define GLFW_KEY_DOWN 264
+#define GLFW_KEY_UP 265
+
+#define GLFW_CONTEXT_VERSION_MAJOR 0x00022002
+#define GLFW_CONTEXT_VERSION_MINOR 0x00022003
+#define GLFW_OPENGL_PROFILE 0x00022008
+#define GLFW_OPENGL_CORE_PROFILE 0x00032001
+
+typedef struct GLFWwindow GLFWwindow;
+typedef struct GLFWmonitor GLFWmonitor;
+typedef void (*GLFWglproc)(void);
+typedef void (*GLFWframebuffersizefun)(GLFWwindow *window, int width,
+				       int height);
+
+int glfwInit(void);
+void glfwTerminate(void);
+void glfwWindowHint(int hint, int value);
+GLFWwindow *glfwCreateWindow(int width, int height, const char *title,
+			     GLFWmonitor *monitor, GLFWwindow *share);
+void glfwMakeContextCurrent(GLFWwindow *window);
+GLFWglproc glfwGetProcAddress(const char *name);
+void glfwSwapInterval(int interval);
+GLFWframebuffersizefun glfwSetFramebufferSizeCallback(GLFWwindow *window,
+						      GLFWframebuffersizefun callback);
+int glfwWindowShouldClose(GLFWwindow *window);
+void glfwSetWindowShouldClose(GLFWwindow *window, int value);
+int glfwGetKey(GLFWwindow *window, int key);
+void glfwPollEvents(void);
+void glfwSwapBuffers(GLFWwindow *window);
+double glfwGetTime(void);
+
+/* the `seconds` spent inside GL calls during the frame swapped last */
+void lgl_platformBenchGl(double seconds);
+
+#endif /*LGL_PLATFORM_HEADLESS*/
+
+#endif /*__LGL_PLATFORM__*/
+
+#if defined(LGL_PLATFORM_IMPLEMENTATION) && defined(LGL_PLATFORM_HEADLESS)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef LGL_PLATFORM_EGL
+#define EGL_NO_X11
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#else
+#include <GL/osmesa.h>
+#endif
+
+/* gl_ms for every sample, see glfwSwapBuffers */
+#define LGL_GL_TRACE_IMPLEMENTATION
+#include <lgl_gl_trace.h>
+
+struct GLFWwindow {
+	int width, height;
+	int frames, maxFrames, shouldClose;
+
+#ifdef LGL_PLATFORM_EGL
+	EGLDisplay display;
+	EGLContext context;
+	unsigned int framebuffer, renderbuffers[2];
+#else
+	OSMesaContext context;
+	unsigned char *pixels;
+#endif
+};
+
+enum {
+	LGL__BENCH_CPU, LGL__BENCH_SWAP, LGL__BENCH_GPU, LGL__BENCH_GL,
+	LGL__BENCH_COUNT
+};
+
+static struct {
+	int major, minor, core;
+	struct timespec start;
+	GLFWwindow window;
+	int created;
+
+	double fixedDt;         /* 0 for the real clock */
+
+	/* benchmark, when benchPath is set */
+	const char *benchPath;
+	int warmup;
+	double *samples[LGL__BENCH_COUNT]; /* in ms, by measured frame */
+	int sampleCount;
+	int lastSample;         /* of the frame swapped last, -1 if unmeasured */
+	int glSamples;          /* gl_ms samples reported */
+	int glTrace;            /* the platform installed lgl_gl_trace.h */
+	double frameStart;
+	unsigned int query;
+	int queryActive;
+	char renderer[128];
+
+	/* capture of the last frame, when capturePath is set */
+	const char *capturePath;
+	unsigned int capturePbo;
+} lgl__platform;
+
+/* versions tried after the requested one */
+static const int lgl__platformFallbacks[][2] = {{4, 5}, {4, 3}, {3, 3}};
+
+/* seconds since glfwInit, always from the real clock */
+static double lgl__platformNow(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (double)(now.tv_sec - lgl__platform.start.tv_sec)
+		+ (now.tv_nsec - lgl__platform.start.tv_nsec) * 1e-9;
+}
+
+int glfwInit(void)
+{
+	const char *fixedDt = getenv("LGL_FIXED_DT");
+
+	memset(&lgl__platform, 0, sizeof(lgl__platform));
+	lgl__platform.major = 3;
+	lgl__platform.minor = 3;
+	lgl__platform.lastSample = -1;
+	clock_gettime(CLOCK_MONOTONIC, &lgl__platform.start);
+
+	if (fixedDt) lgl__platform.fixedDt = atof(fixedDt);
+	lgl__platform.benchPath = getenv("LGL_BENCH");
+	lgl__platform.capturePath = getenv("LGL_CAPTURE");
+	return GLFW_TRUE;
+}
+
+void glfwWindowHint(int hint, int value)
+{
+	if (hint == GLFW_CONTEXT_VERSION_MAJOR) lgl__platform.major = value;
+	if (hint == GLFW_CONTEXT_VERSION_MINOR) lgl__platform.minor = value;
+	if (hint == GLFW_OPENGL_PROFILE)
+		lgl__platform.core = value == GLFW_OPENGL_CORE_PROFILE;
+}
+
+#ifdef LGL_PLATFORM_EGL
+
+static EGLContext lgl__platformCreateContext(EGLDisplay display, EGLConfig config,
+					     int major, int minor)
+{
+	EGLint attribs[] = {
+		EGL_CONTEXT_MAJOR_VERSION, 0,
+		EGL_CONTEXT_MINOR_VERSION, 0,
+		EGL_CONTEXT_OPENGL_PROFILE_MASK,
+		EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+		EGL_NONE
+	};
+
+	attribs[1] = major;
+	attribs[3] = minor;
+	if (!lgl__platform.core)
+		attribs[5] = EGL_CONTEXT_OPENGL_COMPATIBILITY_PROFILE_BIT;
+	return eglCreateContext(display, config, EGL_NO_CONTEXT, attribs);
+}
+
+static int lgl__platformOpen(GLFWwindow *window)
+{
+	PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay;
+	EGLint configAttribs[] = {
+		EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+		EGL_NONE
+	};
+	EGLConfig config = NULL;
+	EGLint configCount = 0;
+	size_t i;
+
+	getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC)
+		eglGetProcAddress("eglGetPlatformDisplayEXT");
+	if (!getPlatformDisplay) return 0;
+
+	window->display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA,
+					     EGL_DEFAULT_DISPLAY, NULL);
+	if (window->display == EGL_NO_DISPLAY
+	    || !eglInitialize(window->display, NULL, NULL))
+		return 0;
+
+	eglChooseConfig(window->display, configAttribs, &config, 1, &configCount);
+	if (!eglBindAPI(EGL_OPENGL_API)) return 0;
+
+	window->context = lgl__platformCreateContext(window->display, config,
+						     lgl__platform.major,
+						     lgl__platform.minor);
+	for (i = 0; !window->context && i < sizeof(lgl__platformFallbacks)
+		     / sizeof(lgl__platformFallbacks[0]); i++) {
+		const int *version = lgl__platformFallbacks[i];
+
+		if (version[0] * 10 + version[1]
+		    >= lgl__platform.major * 10 + lgl__platform.minor)
+			continue;
+		window->context = lgl__platformCreateContext(window->display,
+							     config, version[0],
+							     version[1]);
+		if (window->context)
+			fprintf(stderr, "OpenGL %d.%d is not available,"
+				" using %d.%d\n", lgl__platform.major,
+				lgl__platform.minor, version[0], version[1]);
+	}
+
+	return window->context != EGL_NO_CONTEXT;
+}
+
+/* the default framebuffer of a surfaceless context is incomplete, so
+ * render into an FBO instead; GL is loaded by hand, glad is not yet */
+static void lgl__platformMakeCurrent(GLFWwindow *window)
+{
+	PFNGLGENFRAMEBUFFERSPROC genFramebuffers;
+	PFNGLBINDFRAMEBUFFERPROC bindFramebuffer;
+	PFNGLGENRENDERBUFFERSPROC genRenderbuffers;
+	PFNGLBINDRENDERBUFFERPROC bindRenderbuffer;
+	PFNGLRENDERBUFFERSTORAGEPROC renderbufferStorage;
+	PFNGLFRAMEBUFFERRENDERBUFFERPROC framebufferRenderbuffer;
+	PFNGLVIEWPORTPROC viewport;
+
+	eglMakeCurrent(window->display, EGL_NO_SURFACE, EGL_NO_SURFACE,
+		       window->context);
+	if (window->framebuffer) return;
+
+	genFramebuffers = (PFNGLGENFRAMEBUFFERSPROC)
+		eglGetProcAddress("glGenFramebuffers");
+	bindFramebuffer = (PFNGLBINDFRAMEBUFFERPROC)
+		eglGetProcAddress("glBindFramebuffer");
+	genRenderbuffers = (PFNGLGENRENDERBUFFERSPROC)
+		eglGetProcAddress("glGenRenderbuffers");
+	bindRenderbuffer = (PFNGLBINDRENDERBUFFERPROC)
+		eglGetProcAddress("glBindRenderbuffer");
+	renderbufferStorage = (PFNGLRENDERBUFFERSTORAGEPROC)
+		eglGetProcAddress("glRenderbufferStorage");
+	framebufferRenderbuffer = (PFNGLFRAMEBUFFERRENDERBUFFERPROC)
+		eglGetProcAddress("glFramebufferRenderbuffer");
+	viewport = (PFNGLVIEWPORTPROC)eglGetProcAddress("glViewport");
+
+	genFramebuffers(1, &window->framebuffer);
+	bindFramebuffer(GL_FRAMEBUFFER, window->framebuffer);
+	genRenderbuffers(2, window->renderbuffers);
+
+	bindRenderbuffer(GL_RENDERBUFFER, window->renderbuffers[0]);
+	renderbufferStorage(GL_RENDERBUFFER, GL_RGBA8,
+			    window->width, window->height);
+	framebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+				GL_RENDERBUFFER, window->renderbuffers[0]);
+
+	bindRenderbuffer(GL_RENDERBUFFER, window->renderbuffers[1]);
+	renderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8,
+			    window->width, window->height);
+	framebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT,
+				GL_RENDERBUFFER, window->renderbuffers[1]);
+
+	bindRenderbuffer(GL_RENDERBUFFER, 0);
+	viewport(0, 0, window->width, window->height);
+}
+
+static void lgl__platformClose(GLFWwindow *window)
+{
+	if (window->context) {
+		eglMakeCurrent(window->display, EGL_NO_SURFACE, EGL_NO_SURFACE,
+			       EGL_NO_CONTEXT);
+		eglDestroyContext(window->display, window->context);
+	}
+	if (window->display) eglTerminate(window->display);
+}
+
+GLFWglproc glfwGetProcAddress(const char *name)
+{
+	return (GLFWglproc)eglGetProcAddress(name);
+}
+
+#else /* LGL_PLATFORM_OSMESA */
+
+static OSMesaContext lgl__platformCreateContext(int major, int minor)
+{
+	int attribs[] = {
+		OSMESA_FORMAT, OSMESA_RGBA,
+		OSMESA_DEPTH_BITS, 24,
+		OSMESA_STENCIL_BITS, 8,
+		OSMESA_PROFILE, OSMESA_CORE_PROFILE,
+		OSMESA_CONTEXT_MAJOR_VERSION, 0,
+		OSMESA_CONTEXT_MINOR_VERSION, 0,
+		0
+	};
+
+	if (!lgl__platform.core) attribs[7] = OSMESA_COMPAT_PROFILE;
+	attribs[9] = major;
+	attribs[11] = minor;
+	return OSMesaCreateContextAttribs(attribs, NULL);
+}
+
+static int lgl__platformOpen(GLFWwindow *window)
+{
+	size_t i;
+
+	window->pixels = malloc((size_t)window->width * window->height * 4);
+	if (!window->pixels) return 0;
+
+	window->context = lgl__platformCreateContext(lgl__platform.major,
+						     lgl__platform.minor);
+	for (i = 0; !window->context && i < sizeof(lgl__platformFallbacks)
+		     / sizeof(lgl__platformFallbacks[0]); i++) {
+		const int *version = lgl__platformFallbacks[i];
+
+		if (version[0] * 10 + version[1]
+		    >= lgl__platform.major * 10 + lgl__platform.minor)
+			continue;
+		window->context = lgl__platformCreateContext(version[0],
+							     version[1]);
+		if (window->context)
+			fprintf(stderr, "OpenGL %d.%d is not available,"
+				" using %d.%d\n", lgl__platform.major,
+				lgl__platform.minor, version[0], version[1]);
+	}
+
+	return window->context != NULL;
+}
+
+/* the buffer is the default framebuffer, nothing else to set up */
+static void lgl__platformMakeCurrent(GLFWwindow *window)
+{
+	OSMesaMakeCurrent(window->context, window->pixels, GL_UNSIGNED_BYTE,
+			  window->width, window->height);
+}
+
+static void lgl__platformClose(GLFWwindow *window)
+{
+	if (window->context) OSMesaDestroyContext(window->context);
+	free(window->pixels);
+}
+
+GLFWglproc glfwGetProcAddress(const char *name)
+{
+	return (GLFWglproc)OSMesaGetProcAddress(name);
+}
+
+#endif /*LGL_PLATFORM_EGL*/
+
+/* the platform's own GL calls, loaded by hand rather than through glad so
+ * that lgl_gl_trace.h, which wraps glad's pointers, sees only the
+ * application's calls */
+static struct {
+	PFNGLGETSTRINGPROC GetString;
+	PFNGLGETINTEGERVPROC GetIntegerv;
+	PFNGLFINISHPROC Finish;
+	PFNGLGENQUERIESPROC GenQueries;
+	PFNGLBEGINQUERYPROC BeginQuery;
+	PFNGLENDQUERYPROC EndQuery;
+	PFNGLGETQUERYOBJECTUI64VPROC GetQueryObjectui64v;
+	PFNGLGENBUFFERSPROC GenBuffers;
+	PFNGLDELETEBUFFERSPROC DeleteBuffers;
+	PFNGLBINDBUFFERPROC BindBuffer;
+	PFNGLBUFFERDATAPROC BufferData;
+	PFNGLMAPBUFFERRANGEPROC MapBufferRange;
+	PFNGLUNMAPBUFFERPROC UnmapBuffer;
+	PFNGLBINDFRAMEBUFFERPROC BindFramebuffer;
+	PFNGLREADPIXELSPROC ReadPixels;
+} lgl__gl;
+
+static void lgl__platformLoadGl(void)
+{
+	lgl__gl.GetString = (PFNGLGETSTRINGPROC)
+		glfwGetProcAddress("glGetString");
+	lgl__gl.GetIntegerv = (PFNGLGETINTEGERVPROC)
+		glfwGetProcAddress("glGetIntegerv");
+	lgl__gl.Finish = (PFNGLFINISHPROC)
+		glfwGetProcAddress("glFinish");
+	lgl__gl.GenQueries = (PFNGLGENQUERIESPROC)
+		glfwGetProcAddress("glGenQueries");
+	lgl__gl.BeginQuery = (PFNGLBEGINQUERYPROC)
+		glfwGetProcAddress("glBeginQuery");
+	lgl__gl.EndQuery = (PFNGLENDQUERYPROC)
+		glfwGetProcAddress("glEndQuery");
+	lgl__gl.GetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)
+		glfwGetProcAddress("glGetQueryObjectui64v");
+	lgl__gl.GenBuffers = (PFNGLGENBUFFERSPROC)
+		glfwGetProcAddress("glGenBuffers");
+	lgl__gl.DeleteBuffers = (PFNGLDELETEBUFFERSPROC)
+		glfwGetProcAddress("glDeleteBuffers");
+	lgl__gl.BindBuffer = (PFNGLBINDBUFFERPROC)
+		glfwGetProcAddress("glBindBuffer");
+	lgl__gl.BufferData = (PFNGLBUFFERDATAPROC)
+		glfwGetProcAddress("glBufferData");
+	lgl__gl.MapBufferRange = (PFNGLMAPBUFFERRANGEPROC)
+		glfwGetProcAddress("glMapBufferRange");
+	lgl__gl.UnmapBuffer = (PFNGLUNMAPBUFFERPROC)
+		glfwGetProcAddress("glUnmapBuffer");
+	lgl__gl.BindFramebuffer = (PFNGLBINDFRAMEBUFFERPROC)
+		glfwGetProcAddress("glBindFramebuffer");
+	lgl__gl.ReadPixels = (PFNGLREADPIXELSPROC)
+		glfwGetProcAddress("glReadPixels");
+}
+
+GLFWwindow *glfwCreateWindow(int width, int height, const char *title,
+			     GLFWmonitor *monitor, GLFWwindow *share)
+{
+	GLFWwindow *window = &lgl__platform.window;
+	const char *frames = getenv("LGL_FRAMES");
+	const char *warmup = getenv("LGL_WARMUP");
+	int i;
+
+	(void)title;
+	(void)monitor;
+	(void)share;
+	if (lgl__platform.created) return NULL;
+
+	memset(window, 0, sizeof(*window));
+	window->width = width;
+	window->height = height;
+	window->maxFrames = frames ? atoi(frames) : 100;
+
+	if (lgl__platform.benchPath) {
+		/* the first frame has no GPU time, so it is always warmup */
+		lgl__platform.warmup = warmup ? atoi(warmup) : 1;
+		if (lgl__platform.warmup < 1) lgl__platform.warmup = 1;
+
+		/* one block, freed through samples[0] */
+		lgl__platform.samples[0] = malloc((window->maxFrames + 1)
+						  * LGL__BENCH_COUNT * sizeof(double));
+		if (!lgl__platform.samples[0]) return NULL;
+		for (i = 1; i < LGL__BENCH_COUNT; i++)
+			lgl__platform.samples[i] = lgl__platform.samples[i - 1]
+				+ window->maxFrames + 1;
+		window->maxFrames += lgl__platform.warmup;
+	}
+
+	if (!lgl__platformOpen(window)) {
+		lgl__platformClose(window);
+		free(lgl__platform.samples[0]);
+		lgl__platform.samples[0] = NULL;
+		return NULL;
+	}
+
+	lgl__platform.created = 1;
+	return window;
+}
+
+void glfwMakeContextCurrent(GLFWwindow *window)
+{
+	if (!window) return;
+	lgl__platformMakeCurrent(window);
+	lgl__platformLoadGl();
+}
+
+static int lgl__benchCompare(const void *a, const void *b)
+{
+	double x = *(const double *)a, y = *(const double *)b;
+
+	return (x > y) - (x < y);
+}
+
+/* nearest rank on sorted samples */
+static double lgl__benchPercentile(const double *sorted, int count,
+				   double percent)
+{
+	int rank = (int)(percent / 100.0 * count + 0.999999);
+
+	if (rank < 1) rank = 1;
+	if (rank > count) rank = count;
+	return sorted[rank - 1];
+}
+
+static void lgl__benchWrite(void)
+{
+	static const char *names[LGL__BENCH_COUNT] = {
+		"cpu_ms", "swap_ms", "gpu_ms", "gl_ms"
+	};
+	static const double percents[] = {50.0, 90.0, 95.0, 99.0};
+	int count = lgl__platform.sampleCount, i, j;
+	FILE *file;
+
+	if (!strcmp(lgl__platform.benchPath, "-")) file = stdout;
+	else file = fopen(lgl__platform.benchPath, "w");
+	if (!file) {
+		fprintf(stderr, "Failed to write \"%s\"\n", lgl__platform.benchPath);
+		goto defer;
+	}
+
+	fprintf(file, "{\n  \"renderer\": \"%s\",\n"
+		"  \"frames\": %d,\n  \"warmup\": %d,\n  \"fixed_dt\": %g",
+		lgl__platform.renderer, count, lgl__platform.warmup,
+		lgl__platform.fixedDt);
+
+	for (i = 0; i < LGL__BENCH_COUNT; i++) {
+		double *sorted = lgl__platform.samples[i], sum = 0.0;
+
+		/* only when the GL trace reported every measured frame */
+		if (i == LGL__BENCH_GL && lgl__platform.glSamples != count)
+			continue;
+
+		qsort(sorted, count, sizeof(*sorted), lgl__benchCompare);
+		for (j = 0; j < count; j++) sum += sorted[j];
+
+		fprintf(file, ",\n  \"%s\": {", names[i]);
+		if (count) {
+			fprintf(file, "\"min\": %.4f, \"mean\": %.4f",
+				sorted[0], sum / count);
+			for (j = 0; j < (int)(sizeof(percents) / sizeof(*percents)); j++)
+				fprintf(file, ", \"p%d\": %.4f", (int)percents[j],
+					lgl__benchPercentile(sorted, count,
+							     percents[j]));
+			fprintf(file, ", \"max\": %.4f", sorted[count - 1]);
+		}
+		fprintf(file, "}");
+	}
+	fprintf(file, "\n}\n");
+	if (file != stdout) fclose(file);
+
+ defer:
+	free(lgl__platform.samples[0]);
+	lgl__platform.samples[0] = NULL;
+}
+
+/* closes the frame being measured and opens the next one */
+static void lgl__benchSwap(GLFWwindow *window, double swapStart)
+{
+	double now = lgl__platformNow();
+	int frame = window->frames - lgl__platform.warmup;
+
+	if (!lgl__platform.query) {
+		const char *renderer = (const char *)lgl__gl.GetString(GL_RENDERER);
+
+		strncpy(lgl__platform.renderer, renderer ? renderer : "",
+			sizeof(lgl__platform.renderer) - 1);
+		lgl__gl.GenQueries(1, &lgl__platform.query);
+	}
+
+	lgl__platform.lastSample = -1;
+	if (lgl__platform.queryActive && frame >= 0
+	    && frame < window->maxFrames - lgl__platform.warmup) {
+		GLuint64 gpuTime = 0;
+		int n = lgl__platform.sampleCount++;
+
+		lgl__platform.lastSample = n;
+
+		/* after glFinish, so the result is there without a stall */
+		lgl__gl.GetQueryObjectui64v(lgl__platform.query,
+					    GL_QUERY_RESULT, &gpuTime);
+		lgl__platform.samples[LGL__BENCH_CPU][n] =
+			(swapStart - lgl__platform.frameStart) * 1000.0;
+		lgl__platform.samples[LGL__BENCH_SWAP][n] =
+			(now - swapStart) * 1000.0;
+		lgl__platform.samples[LGL__BENCH_GPU][n] = gpuTime * 1e-6;
+	}
+
+	lgl__platform.queryActive = window->frames + 1 < window->maxFrames;
+	if (lgl__platform.queryActive)
+		lgl__gl.BeginQuery(GL_TIME_ELAPSED, lgl__platform.query);
+	lgl__platform.frameStart = lgl__platformNow();
+}
+
+/* starts reading the frame into a PBO, GL state is left as it was */
+static void lgl__captureRead(GLFWwindow *window)
+{
+	GLint readFramebuffer = 0, packBuffer = 0;
+	unsigned int framebuffer = 0;
+
+#ifdef LGL_PLATFORM_EGL
+	framebuffer = window->framebuffer;
+#endif
+
+	lgl__gl.GetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &readFramebuffer);
+	lgl__gl.GetIntegerv(GL_PIXEL_PACK_BUFFER_BINDING, &packBuffer);
+
+	lgl__gl.GenBuffers(1, &lgl__platform.capturePbo);
+	lgl__gl.BindBuffer(GL_PIXEL_PACK_BUFFER, lgl__platform.capturePbo);
+	lgl__gl.BufferData(GL_PIXEL_PACK_BUFFER, (GLsizeiptr)window->width
+			   * window->height * 4, NULL, GL_STREAM_READ);
+
+	lgl__gl.BindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+	lgl__gl.ReadPixels(0, 0, window->width, window->height, GL_RGBA,
+			   GL_UNSIGNED_BYTE, (void *)0);
+
+	lgl__gl.BindFramebuffer(GL_READ_FRAMEBUFFER, (GLuint)readFramebuffer);
+	lgl__gl.BindBuffer(GL_PIXEL_PACK_BUFFER, (GLuint)packBuffer);
+}
+
+/* writes the captured frame as PPM, top row first */
+static void lgl__captureWrite(GLFWwindow *window)
+{
+	const unsigned char *pixels;
+	FILE *file;
+	int x, y;
+
+	lgl__gl.BindBuffer(GL_PIXEL_PACK_BUFFER, lgl__platform.capturePbo);
+	pixels = lgl__gl.MapBufferRange(GL_PIXEL_PACK_BUFFER, 0,
+					(GLsizeiptr)window->width
+					* window->height * 4, GL_MAP_READ_BIT);
+
+	file = fopen(lgl__platform.capturePath, "wb");
+	if (!pixels || !file) {
+		fprintf(stderr, "Failed to capture to \"%s\"\n",
+			lgl__platform.capturePath);
+		goto defer;
+	}
+
+	fprintf(file, "P6\n%d %d\n255\n", window->width, window->height);
+	for (y = window->height - 1; y >= 0; y--)
+		for (x = 0; x < window->width; x++)
+			fwrite(pixels + ((size_t)y * window->width + x) * 4, 1, 3,
+			       file);
+
+ defer:
+	if (file) fclose(file);
+	if (pixels) lgl__gl.UnmapBuffer(GL_PIXEL_PACK_BUFFER);
+	lgl__gl.BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+	lgl__gl.DeleteBuffers(1, &lgl__platform.capturePbo);
+	lgl__platform.capturePbo = 0;
+}
+
+void glfwTerminate(void)
+{
+	GLFWwindow *window = &lgl__platform.window;
+
+	if (!lgl__platform.created) return;
+
+	/* enough for a CI log to show the sample ran */
+	fprintf(stderr, "%d frames in %.3f s\n", window->frames,
+		lgl__platformNow());
+	if (lgl__platform.benchPath) lgl__benchWrite();
+	if (lgl__platform.capturePbo) lgl__captureWrite(window);
+	if (lgl__platform.glTrace) {
+		lgl_glTraceUninstall();
+		lgl__platform.glTrace = 0;
+	}
+	lgl__platformClose(window);
+	lgl__platform.created = 0;
+}
+
+void glfwSwapInterval(int interval)
+{
+	(void)interval;
+}
+
+/* the size never changes, so the callback is never called */
+GLFWframebuffersizefun glfwSetFramebufferSizeCallback(GLFWwindow *window,
+						      GLFWframebuffersizefun callback)
+{
+	(void)window;
+	(void)callback;
+	return NULL;
+}
+
+int glfwWindowShouldClose(GLFWwindow *window)
+{
+	return window->shouldClose || window->frames >= window->maxFrames;
+}
+
+void glfwSetWindowShouldClose(GLFWwindow *window, int value)
+{
+	window->shouldClose = value;
+}
+
+int glfwGetKey(GLFWwindow *window, int key)
+{
+	(void)window;
+	(void)key;
+	return GLFW_RELEASE;
+}
+
+void glfwPollEvents(void)
+{
+}
+
+void glfwSwapBuffers(GLFWwindow *window)
+{
+	double swapStart = lgl__platformNow();
+
+	if (lgl__platform.queryActive) lgl__gl.EndQuery(GL_TIME_ELAPSED);
+	if (lgl__platform.capturePath && !lgl__platform.capturePbo
+	    && window->frames + 1 >= window->maxFrames)
+		lgl__captureRead(window);
+
+	/* a real swap waits for the GPU at some point too */
+	lgl__gl.Finish();
+
+	if (lgl__platform.benchPath) lgl__benchSwap(window, swapStart);
+
+	/* GL is loaded by now; a capture has to start before the setup */
+	if (lgl__platform.glTrace)
+		lgl_glTraceEndFrame(NULL);
+	else if (!window->frames && getenv("LGL_GL_TRACE")
+		 && !getenv("LGL_GL_CAPTURE"))
+		lgl__platform.glTrace = lgl_glTraceInstall();
+	window->frames++;
+}
+
+void lgl_platformBenchGl(double seconds)
+{
+	if (!lgl__platform.benchPath || lgl__platform.lastSample < 0) return;
+
+	lgl__platform.samples[LGL__BENCH_GL][lgl__platform.lastSample] =
+		seconds * 1000.0;
+	lgl__platform.glSamples++;
+	lgl__platform.lastSample = -1;
+}
+
+double glfwGetTime(void)
+{
+	if (lgl__platform.fixedDt > 0.0)
+		return lgl__platform.window.frames * lgl__platform.fixedDt;
+	return lgl__platformNow();
+}
+
+#endif /*LGL_PLATFORM_IMPLEMENTATION && LGL_PLATFORM_HEADLESS*/
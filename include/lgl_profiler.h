@@ -0,0 +1,330 @@
+#ifndef __LGL_PROFILER__
+#define __LGL_PROFILER__
+
+#include <stdio.h>
+
+/* Nested CPU/GPU profiling scopes. Every scope takes CPU time from the
+ * monotonic clock and GPU time from a pair of GL_TIMESTAMP queries. The
+ * queries are double-buffered: a frame's results are read one frame
+ * later, and only if they are already there, so the profiler never
+ * waits on the GPU. A frame whose results are late loses its GPU times.
+ *
+ * Scopes are merged into a call tree by name and parent, with running
+ * totals, and can also be streamed to a Chrome trace-event file (open in
+ * chrome://tracing or Perfetto), CPU scopes on thread 1 and GPU scopes on
+ * thread 2 of the same timeline.
+ *
+ * The clock is clock_gettime, so build with _POSIX_C_SOURCE defined.
+ * Scope names are stored as pointers and must outlive the profiler. */
+
+#define LGL_PROFILER_MAX_SCOPES 64  /* per frame */
+#define LGL_PROFILER_MAX_DEPTH 16
+#define LGL_PROFILER_MAX_NODES 128  /* distinct scopes in the tree */
+
+typedef struct {
+	const char *name;
+	int node;                 /* in lgl_Profiler.nodes */
+	int depth;
+	double cpuBegin, cpuEnd;  /* monotonic clock, in seconds */
+} lgl_ProfileScope;
+
+typedef struct {
+	lgl_ProfileScope scopes[LGL_PROFILER_MAX_SCOPES];
+	unsigned int queries[LGL_PROFILER_MAX_SCOPES * 2]; /* begin, end */
+	int count;
+	int last;                 /* in queries, the one issued last */
+	int pending;              /* queries issued but not read */
+} lgl_ProfileFrame;
+
+typedef struct {
+	const char *name;
+	int parent;               /* -1 for a root */
+	unsigned long cpuCount, gpuCount;
+	double cpuTotal, gpuTotal; /* in ms */
+	double cpuLast, gpuLast;
+} lgl_ProfileNode;
+
+typedef struct {
+	lgl_ProfileFrame frames[2];
+	int current;
+
+	int stack[LGL_PROFILER_MAX_DEPTH]; /* open scopes of the current frame */
+	int depth;
+
+	lgl_ProfileNode nodes[LGL_PROFILER_MAX_NODES];
+	int nodeCount;
+
+	unsigned long frame;
+	unsigned long late;       /* frames whose GPU times were dropped */
+	double gpuOffset;         /* GPU clock minus CPU clock, in seconds */
+
+	FILE *trace;
+	int traceEvents;
+} lgl_Profiler;
+
+/* `tracePath` may be NULL for no trace file; returns 0 on failure */
+int lgl_profilerInit(lgl_Profiler *profiler, const char *tracePath);
+
+/* reads what is left and closes the trace */
+void lgl_profilerFree(lgl_Profiler *profiler);
+
+/* call once per frame, after the last scope (and after swapping) */
+void lgl_profilerEndFrame(lgl_Profiler *profiler);
+
+/* scopes nest and must be closed in the same frame; scopes past the
+ * limits are ignored */
+void lgl_profileBegin(lgl_Profiler *profiler, const char *name);
+void lgl_profileEnd(lgl_Profiler *profiler);
+
+/* the tree with average CPU and GPU ms per call */
+void lgl_profilerPrint(const lgl_Profiler *profiler, FILE *file);
+
+#endif /*__LGL_PROFILER__*/
+
+#ifdef LGL_PROFILER_IMPLEMENTATION
+
+#include <string.h>
+#include <time.h>
+
+static double lgl__profilerNow(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (double)now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+int lgl_profilerInit(lgl_Profiler *profiler, const char *tracePath)
+{
+	GLint64 gpuNow = 0;
+	int i;
+
+	memset(profiler, 0, sizeof(*profiler));
+
+	for (i = 0; i < 2; i++)
+		glGenQueries(LGL_PROFILER_MAX_SCOPES * 2,
+			     profiler->frames[i].queries);
+
+	/* lines the GPU timestamps up with the CPU clock */
+	glGetInteger64v(GL_TIMESTAMP, &gpuNow);
+	profiler->gpuOffset = gpuNow * 1e-9 - lgl__profilerNow();
+
+	if (tracePath) {
+		profiler->trace = fopen(tracePath, "w");
+		if (!profiler->trace) {
+			fprintf(stderr, "Failed to open \"%s\"\n", tracePath);
+			return 0;
+		}
+		fprintf(profiler->trace, "{\"traceEvents\": [\n"
+			"{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1,"
+			" \"tid\": 1, \"args\": {\"name\": \"CPU\"}},\n"
+			"{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1,"
+			" \"tid\": 2, \"args\": {\"name\": \"GPU\"}}");
+	}
+	return 1;
+}
+
+/* the node of `name` under `parent`, added on first use; -1 when full */
+static int lgl__profilerNode(lgl_Profiler *profiler, const char *name,
+			     int parent)
+{
+	lgl_ProfileNode *node;
+	int i;
+
+	for (i = 0; i < profiler->nodeCount; i++)
+		if (profiler->nodes[i].parent == parent
+		    && (profiler->nodes[i].name == name
+			|| !strcmp(profiler->nodes[i].name, name)))
+			return i;
+
+	if (profiler->nodeCount == LGL_PROFILER_MAX_NODES) return -1;
+
+	node = &profiler->nodes[profiler->nodeCount];
+	memset(node, 0, sizeof(*node));
+	node->name = name;
+	node->parent = parent;
+	return profiler->nodeCount++;
+}
+
+static void lgl__profilerTraceEvent(lgl_Profiler *profiler, const char *name,
+				    int thread, double begin, double end)
+{
+	/* microseconds, as trace events want them */
+	fprintf(profiler->trace, ",\n{\"name\": \"%s\", \"ph\": \"X\","
+		" \"pid\": 1, \"tid\": %d, \"ts\": %.3f, \"dur\": %.3f}",
+		name, thread, begin * 1e6, (end - begin) * 1e6);
+	profiler->traceEvents++;
+}
+
+/* collects the GPU times of `frame` if they are all there */
+static void lgl__profilerRead(lgl_Profiler *profiler, lgl_ProfileFrame *frame)
+{
+	GLint available = 0;
+	int i;
+
+	if (!frame->pending) return;
+	frame->pending = 0;
+
+	/* the GPU finishes in order, the query issued last lands last; with
+	 * nested scopes that is the outermost end, not the last slot */
+	glGetQueryObjectiv(frame->queries[frame->last],
+			   GL_QUERY_RESULT_AVAILABLE, &available);
+	if (!available) {
+		profiler->late++;
+		return;
+	}
+
+	for (i = 0; i < frame->count; i++) {
+		const lgl_ProfileScope *scope = &frame->scopes[i];
+		lgl_ProfileNode *node = &profiler->nodes[scope->node];
+		GLuint64 begin = 0, end = 0;
+		double ms;
+
+		glGetQueryObjectui64v(frame->queries[i * 2], GL_QUERY_RESULT,
+				      &begin);
+		glGetQueryObjectui64v(frame->queries[i * 2 + 1], GL_QUERY_RESULT,
+				      &end);
+		ms = (end - begin) * 1e-6;
+
+		node->gpuLast = ms;
+		node->gpuTotal += ms;
+		node->gpuCount++;
+
+		if (profiler->trace)
+			lgl__profilerTraceEvent(profiler, scope->name, 2,
+						begin * 1e-9 - profiler->gpuOffset,
+						end * 1e-9 - profiler->gpuOffset);
+	}
+}
+
+void lgl_profilerEndFrame(lgl_Profiler *profiler)
+{
+	lgl_ProfileFrame *frame = &profiler->frames[profiler->current];
+	int i;
+
+	/* scopes left open end here */
+	while (profiler->depth) lgl_profileEnd(profiler);
+
+	if (profiler->trace)
+		for (i = 0; i < frame->count; i++)
+			lgl__profilerTraceEvent(profiler, frame->scopes[i].name, 1,
+						frame->scopes[i].cpuBegin,
+						frame->scopes[i].cpuEnd);
+	frame->pending = frame->count > 0;
+
+	/* the previous frame had a whole frame to finish */
+	profiler->current ^= 1;
+	lgl__profilerRead(profiler, &profiler->frames[profiler->current]);
+	profiler->frames[profiler->current].count = 0;
+	profiler->frame++;
+}
+
+void lgl_profileBegin(lgl_Profiler *profiler, const char *name)
+{
+	lgl_ProfileFrame *frame = &profiler->frames[profiler->current];
+	lgl_ProfileScope *scope;
+	int parent = -1, node;
+
+	if (profiler->depth >= LGL_PROFILER_MAX_DEPTH
+	    || frame->count == LGL_PROFILER_MAX_SCOPES) {
+		/* still push, so the matching lgl_profileEnd pops it */
+		if (profiler->depth < LGL_PROFILER_MAX_DEPTH)
+			profiler->stack[profiler->depth] = -1;
+		profiler->depth++;
+		return;
+	}
+
+	if (profiler->depth) {
+		int open = profiler->stack[profiler->depth - 1];
+
+		if (open >= 0) parent = frame->scopes[open].node;
+	}
+
+	node = lgl__profilerNode(profiler, name, parent);
+	if (node < 0) {
+		profiler->stack[profiler->depth++] = -1;
+		return;
+	}
+
+	scope = &frame->scopes[frame->count];
+	scope->name = name;
+	scope->node = node;
+	scope->depth = profiler->depth;
+	scope->cpuBegin = lgl__profilerNow();
+	glQueryCounter(frame->queries[frame->count * 2], GL_TIMESTAMP);
+	frame->last = frame->count * 2;
+
+	profiler->stack[profiler->depth++] = frame->count++;
+}
+
+void lgl_profileEnd(lgl_Profiler *profiler)
+{
+	lgl_ProfileFrame *frame = &profiler->frames[profiler->current];
+	lgl_ProfileScope *scope;
+	lgl_ProfileNode *node;
+	int open;
+
+	if (!profiler->depth) return;
+	profiler->depth--;
+	if (profiler->depth >= LGL_PROFILER_MAX_DEPTH) return;
+
+	open = profiler->stack[profiler->depth];
+	if (open < 0) return;
+
+	scope = &frame->scopes[open];
+	glQueryCounter(frame->queries[open * 2 + 1], GL_TIMESTAMP);
+	frame->last = open * 2 + 1;
+	scope->cpuEnd = lgl__profilerNow();
+
+	node = &profiler->nodes[scope->node];
+	node->cpuLast = (scope->cpuEnd - scope->cpuBegin) * 1000.0;
+	node->cpuTotal += node->cpuLast;
+	node->cpuCount++;
+}
+
+void lgl_profilerFree(lgl_Profiler *profiler)
+{
+	int i;
+
+	/* whatever the GPU has finished by now */
+	glFinish();
+	for (i = 0; i < 2; i++) {
+		lgl__profilerRead(profiler, &profiler->frames[i]);
+		glDeleteQueries(LGL_PROFILER_MAX_SCOPES * 2,
+				profiler->frames[i].queries);
+	}
+
+	if (profiler->trace) {
+		fprintf(profiler->trace, "\n]}\n");
+		fclose(profiler->trace);
+		profiler->trace = NULL;
+	}
+}
+
+static void lgl__profilerPrintChildren(const lgl_Profiler *profiler,
+				       FILE *file, int parent, int depth)
+{
+	int i;
+
+	for (i = 0; i < profiler->nodeCount; i++) {
+		const lgl_ProfileNode *node = &profiler->nodes[i];
+
+		if (node->parent != parent) continue;
+
+		fprintf(file, "%*s%-*s | %8.3f ms cpu | %8.3f ms gpu | %6lu calls\n",
+			depth * 2, "", 24 - depth * 2, node->name,
+			node->cpuCount ? node->cpuTotal / node->cpuCount : 0.0,
+			node->gpuCount ? node->gpuTotal / node->gpuCount : 0.0,
+			node->cpuCount);
+		lgl__profilerPrintChildren(profiler, file, i, depth + 1);
+	}
+}
+
+void lgl_profilerPrint(const lgl_Profiler *profiler, FILE *file)
+{
+	fprintf(file, "%lu frames, %lu without GPU times\n",
+		profiler->frame, profiler->late);
+	lgl__profilerPrintChildren(profiler, file, -1, 0);
+}
+
+#endif /*LGL_PROFILER_IMPLEMENTATION*/
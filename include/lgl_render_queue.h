@@ -0,0 +1,215 @@
+#ifndef __LGL_RENDER_QUEUE__
+#define __LGL_RENDER_QUEUE__
+
+#include <stdint.h>
+
+/* Per-frame draw queue: every pushed draw gets a 64-bit sort key, the
+ * queue is radix sorted and then submitted through an lgl_StateCache, so
+ * program and texture switches drop to roughly the number of distinct
+ * states instead of the number of draws.
+ *
+ * Key layout, most significant first:
+ *   opaque:      pass:4 | 0:1 | program:12 | material:16 | vao:11 | depth:20
+ *   translucent: pass:4 | 1:1 | ~depth:20 | program:12 | material:16 | vao:11
+ * Opaque draws group by state and go front to back inside a state,
+ * translucent ones go back to front after the opaque ones of their pass.
+ * GL names are truncated to their field; a collision only costs extra
+ * state changes, never a wrong draw. Include lgl_state_cache.h first. */
+
+#define LGL_QUEUE_TEXTURES 2
+
+typedef struct {
+	unsigned int pass;        /* 0 to 15, drawn in order */
+	unsigned int program;
+	unsigned int textures[LGL_QUEUE_TEXTURES]; /* GL_TEXTURE_2D per unit */
+	unsigned int vao;
+	int blended;              /* translucent, GL_BLEND and no depth writes */
+
+	unsigned int mode;        /* GL_TRIANGLES, ... */
+	int first, count;         /* vertices, or indices when indexed */
+	unsigned int indexType;   /* 0 for glDrawArrays */
+
+	unsigned int user;        /* passed back to the draw callback */
+} lgl_DrawItem;
+
+/* called after the item's state is set and right before its draw, to set
+ * per-draw uniforms */
+typedef void (*lgl_DrawCallback)(const lgl_DrawItem *item, void *data);
+
+typedef struct {
+	lgl_DrawItem *items;
+	uint64_t *keys, *scratchKeys;
+	unsigned int *order, *scratchOrder;
+	int count, capacity;
+} lgl_RenderQueue;
+
+int lgl_renderQueueInit(lgl_RenderQueue *queue, int capacity);
+void lgl_renderQueueFree(lgl_RenderQueue *queue);
+void lgl_renderQueueReset(lgl_RenderQueue *queue);
+
+/* `depth` is the view depth mapped to [0, 1]; returns 0 when full */
+int lgl_renderQueuePush(lgl_RenderQueue *queue, const lgl_DrawItem *item,
+			float depth);
+
+void lgl_renderQueueSort(lgl_RenderQueue *queue);
+
+/* draws the items in sorted order, `callback` may be NULL */
+void lgl_renderQueueSubmit(lgl_RenderQueue *queue, lgl_StateCache *state,
+			   lgl_DrawCallback callback, void *data);
+
+#endif /*__LGL_RENDER_QUEUE__*/
+
+#ifdef LGL_RENDER_QUEUE_IMPLEMENTATION
+
+#include <stdlib.h>
+#include <string.h>
+
+#define LGL__QUEUE_DEPTH_BITS 20
+
+static uint64_t lgl__queueKey(const lgl_DrawItem *item, float depth)
+{
+	uint64_t pass = item->pass & 0xF;
+	uint64_t program = item->program & 0xFFF;
+	uint64_t material = (item->textures[0] * 31u + item->textures[1]) & 0xFFFF;
+	uint64_t vao = item->vao & 0x7FF;
+	uint64_t quantized;
+
+	if (depth < 0.0f) depth = 0.0f;
+	if (depth > 1.0f) depth = 1.0f;
+	quantized = (uint64_t)(depth * ((1 << LGL__QUEUE_DEPTH_BITS) - 1));
+
+	if (item->blended)
+		return pass << 60 | (uint64_t)1 << 59
+			| (quantized ^ 0xFFFFF) << 39
+			| program << 27 | material << 11 | vao;
+
+	return pass << 60 | program << 47 | material << 31 | vao << 20
+		| quantized;
+}
+
+int lgl_renderQueueInit(lgl_RenderQueue *queue, int capacity)
+{
+	memset(queue, 0, sizeof(*queue));
+
+	queue->items = malloc(capacity * sizeof(*queue->items));
+	queue->keys = malloc(capacity * sizeof(*queue->keys));
+	queue->scratchKeys = malloc(capacity * sizeof(*queue->scratchKeys));
+	queue->order = malloc(capacity * sizeof(*queue->order));
+	queue->scratchOrder = malloc(capacity * sizeof(*queue->scratchOrder));
+	if (!queue->items || !queue->keys || !queue->scratchKeys
+	    || !queue->order || !queue->scratchOrder) {
+		lgl_renderQueueFree(queue);
+		return 0;
+	}
+
+	queue->capacity = capacity;
+	return 1;
+}
+
+void lgl_renderQueueFree(lgl_RenderQueue *queue)
+{
+	free(queue->items);
+	free(queue->keys);
+	free(queue->scratchKeys);
+	free(queue->order);
+	free(queue->scratchOrder);
+	memset(queue, 0, sizeof(*queue));
+}
+
+void lgl_renderQueueReset(lgl_RenderQueue *queue)
+{
+	queue->count = 0;
+}
+
+int lgl_renderQueuePush(lgl_RenderQueue *queue, const lgl_DrawItem *item,
+			float depth)
+{
+	if (queue->count == queue->capacity) return 0;
+
+	queue->items[queue->count] = *item;
+	queue->keys[queue->count] = lgl__queueKey(item, depth);
+	queue->order[queue->count] = (unsigned int)queue->count;
+	queue->count++;
+	return 1;
+}
+
+/* LSD radix sort, one byte per pass; bytes equal in every key are skipped,
+ * which with few states removes most passes */
+void lgl_renderQueueSort(lgl_RenderQueue *queue)
+{
+	int shift, i;
+
+	for (shift = 0; shift < 64; shift += 8) {
+		unsigned int histogram[256] = {0};
+		unsigned int offset = 0;
+		uint64_t *keys;
+		unsigned int *order;
+
+		for (i = 0; i < queue->count; i++)
+			histogram[(queue->keys[i] >> shift) & 0xFF]++;
+		if (queue->count == 0
+		    || histogram[(queue->keys[0] >> shift) & 0xFF]
+		       == (unsigned int)queue->count)
+			continue;
+
+		for (i = 0; i < 256; i++) {
+			unsigned int bucket = histogram[i];
+
+			histogram[i] = offset;
+			offset += bucket;
+		}
+
+		for (i = 0; i < queue->count; i++) {
+			unsigned int to = histogram[(queue->keys[i] >> shift) & 0xFF]++;
+
+			queue->scratchKeys[to] = queue->keys[i];
+			queue->scratchOrder[to] = queue->order[i];
+		}
+
+		keys = queue->keys;
+		queue->keys = queue->scratchKeys;
+		queue->scratchKeys = keys;
+		order = queue->order;
+		queue->order = queue->scratchOrder;
+		queue->scratchOrder = order;
+	}
+}
+
+void lgl_renderQueueSubmit(lgl_RenderQueue *queue, lgl_StateCache *state,
+			   lgl_DrawCallback callback, void *data)
+{
+	int i, unit;
+
+	for (i = 0; i < queue->count; i++) {
+		const lgl_DrawItem *item = &queue->items[queue->order[i]];
+
+		lgl_stateUseProgram(state, item->program);
+		for (unit = 0; unit < LGL_QUEUE_TEXTURES; unit++)
+			if (item->textures[unit])
+				lgl_stateBindTexture(state, unit, GL_TEXTURE_2D,
+						     item->textures[unit]);
+		lgl_stateBindVertexArray(state, item->vao);
+
+		if (item->blended) {
+			lgl_stateEnable(state, GL_BLEND);
+			lgl_stateDepthMask(state, 0);
+		} else {
+			lgl_stateDisable(state, GL_BLEND);
+			lgl_stateDepthMask(state, 1);
+		}
+
+		if (callback) callback(item, data);
+
+		if (item->indexType) {
+			size_t indexSize = item->indexType == GL_UNSIGNED_INT ? 4
+				: item->indexType == GL_UNSIGNED_SHORT ? 2 : 1;
+
+			glDrawElements(item->mode, item->count, item->indexType,
+				       (void *)(item->first * indexSize));
+		} else {
+			glDrawArrays(item->mode, item->first, item->count);
+		}
+	}
+}
+
+#endif /*LGL_RENDER_QUEUE_IMPLEMENTATION*/
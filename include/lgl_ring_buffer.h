@@ -0,0 +1,144 @@
+#ifndef __LGL_RING_BUFFER__
+#define __LGL_RING_BUFFER__
+
+#include <stddef.h>
+
+/* Ring allocator for per-frame dynamic data: one buffer created with
+ * glBufferStorage and mapped persistently and coherently for the whole
+ * run, split into LGL_RING_FRAMES regions. Every frame writes into the
+ * next region while the GPU may still read the previous ones; a fence per
+ * region makes the CPU wait only if it laps the GPU. Allocation inside a
+ * frame is a single atomic add, so several threads can write vertex and
+ * uniform data at once without locks or GL calls. */
+
+#define LGL_RING_FRAMES 3
+
+typedef struct {
+	unsigned int buffer;
+	unsigned char *mapped;
+
+	size_t frameSize;   /* bytes per region */
+	size_t alignment;   /* of every allocation */
+	int frame;          /* region written this frame */
+	size_t head;        /* bytes used in the region, updated atomically */
+
+	void *fences[LGL_RING_FRAMES]; /* GLsync */
+	unsigned long waits;           /* frames that had to wait for the GPU */
+} lgl_RingBuffer;
+
+/* `alignment` 0 uses GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, so allocations
+ * can be bound with glBindBufferRange */
+int lgl_ringInit(lgl_RingBuffer *ring, size_t frameSize, size_t alignment);
+
+void lgl_ringFree(lgl_RingBuffer *ring);
+
+/* moves to the next region, waiting for the GPU to release it */
+void lgl_ringBeginFrame(lgl_RingBuffer *ring);
+
+/* fences the region written this frame, call after its last draw */
+void lgl_ringEndFrame(lgl_RingBuffer *ring);
+
+/* returns a pointer to `size` writable bytes and their offset in the
+ * buffer, or NULL when the region is full; safe to call from any thread
+ * between lgl_ringBeginFrame and lgl_ringEndFrame */
+void *lgl_ringAlloc(lgl_RingBuffer *ring, size_t size, size_t *offset);
+
+#endif /*__LGL_RING_BUFFER__*/
+
+#ifdef LGL_RING_BUFFER_IMPLEMENTATION
+
+#include <string.h>
+
+#define LGL__RING_FLAGS (GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT \
+			 | GL_MAP_COHERENT_BIT)
+
+int lgl_ringInit(lgl_RingBuffer *ring, size_t frameSize, size_t alignment)
+{
+	memset(ring, 0, sizeof(*ring));
+
+	if (alignment == 0) {
+		int uniformAlignment = 256;
+
+		glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &uniformAlignment);
+		alignment = (size_t)uniformAlignment;
+	}
+	ring->alignment = alignment;
+	ring->frameSize = (frameSize + alignment - 1) / alignment * alignment;
+
+	glGenBuffers(1, &ring->buffer);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, ring->buffer);
+	glBufferStorage(GL_COPY_WRITE_BUFFER, ring->frameSize * LGL_RING_FRAMES,
+			NULL, LGL__RING_FLAGS);
+	ring->mapped = glMapBufferRange(GL_COPY_WRITE_BUFFER, 0,
+					ring->frameSize * LGL_RING_FRAMES,
+					LGL__RING_FLAGS);
+	if (!ring->mapped) {
+		lgl_ringFree(ring);
+		return 0;
+	}
+
+	/* the first lgl_ringBeginFrame moves to region 0 */
+	ring->frame = LGL_RING_FRAMES - 1;
+	return 1;
+}
+
+void lgl_ringFree(lgl_RingBuffer *ring)
+{
+	int i;
+
+	for (i = 0; i < LGL_RING_FRAMES; i++)
+		if (ring->fences[i]) glDeleteSync(ring->fences[i]);
+
+	if (ring->mapped) {
+		glBindBuffer(GL_COPY_WRITE_BUFFER, ring->buffer);
+		glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+	}
+	if (ring->buffer) glDeleteBuffers(1, &ring->buffer);
+	memset(ring, 0, sizeof(*ring));
+}
+
+void lgl_ringBeginFrame(lgl_RingBuffer *ring)
+{
+	GLsync fence;
+
+	ring->frame = (ring->frame + 1) % LGL_RING_FRAMES;
+	fence = ring->fences[ring->frame];
+
+	if (fence) {
+		/* poll first to count stalls, then block with a flush so the
+		 * fence is sure to signal */
+		GLenum status = glClientWaitSync(fence, 0, 0);
+
+		if (status == GL_TIMEOUT_EXPIRED) {
+			ring->waits++;
+			while (status == GL_TIMEOUT_EXPIRED)
+				status = glClientWaitSync(fence,
+							  GL_SYNC_FLUSH_COMMANDS_BIT,
+							  1000000);
+		}
+		glDeleteSync(fence);
+		ring->fences[ring->frame] = NULL;
+	}
+
+	ring->head = 0;
+}
+
+void lgl_ringEndFrame(lgl_RingBuffer *ring)
+{
+	ring->fences[ring->frame] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+void *lgl_ringAlloc(lgl_RingBuffer *ring, size_t size, size_t *offset)
+{
+	size_t aligned = (size + ring->alignment - 1)
+		/ ring->alignment * ring->alignment;
+	size_t start = __atomic_fetch_add(&ring->head, aligned, __ATOMIC_RELAXED);
+
+	if (start + aligned > ring->frameSize) return NULL;
+
+	start += ring->frameSize * ring->frame;
+	if (offset) *offset = start;
+	return ring->mapped + start;
+}
+
+#endif /*LGL_RING_BUFFER_IMPLEMENTATION*/
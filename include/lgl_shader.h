@@ -4,15 +4,30 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+/* allocations go through these; lgl_memory.h points them at its tracker */
+#ifndef LGL_MALLOC
+#define LGL_MALLOC(size) malloc(size)
+#define LGL_REALLOC(pointer, size) realloc(pointer, size)
+#define LGL_FREE(pointer) free(pointer)
+#endif
+
+/* returns the file's content with a terminating 0, to be released with
+ * lgl_freeFile, or NULL */
 char *lgl_readFile(const char *path);
 
-void lgl_compileShader(unsigned int shader, const char *sourceFile);
+void lgl_freeFile(char *content);
 
-void lgl_linkProgram(unsigned int program);
+/* both print the info log and return 0 on failure; a program that links
+ * also had its shaders compile */
+int lgl_compileShader(unsigned int shader, const char *sourceFile);
+
+int lgl_linkProgram(unsigned int program);
 
 #endif /*__LGL_SHADER__*/
 
-#ifdef LGL_SHADER_IMPLEMENTATION
+/* LGL_SHADER_LIBRARY leaves out the implementation, for builds linking it
+ * from a library such as the CMake build's lgl_runtime */
+#if defined(LGL_SHADER_IMPLEMENTATION) && !defined(LGL_SHADER_LIBRARY)
 
 char *lgl_readFile(const char *path)
 {
@@ -23,59 +38,69 @@ char *lgl_readFile(const char *path)
 	fptr = fopen(path, "r");
 	if (!fptr) return NULL;
 
-	if (fseek(fptr, 0, SEEK_END) < 0) return NULL;
+	if (fseek(fptr, 0, SEEK_END) < 0) goto done;
 	size = ftell(fptr);
-	if (size < 0) return NULL;
+	if (size < 0) goto done;
 	fseek(fptr, 0, SEEK_SET);
 
-	content = malloc(size + 1);
+	content = LGL_MALLOC(size + 1);
+	if (!content) goto done;
 	fread(content, size, 1, fptr);
 	if (ferror(fptr)) {
-		free(content);
-		return NULL;
+		LGL_FREE(content);
+		content = NULL;
+		goto done;
 	}
 
 	content[size] = 0;
+ done:
+	fclose(fptr);
 	return content;
 }
 
-void lgl_compileShader(unsigned int shader, const char *sourceFile)
+void lgl_freeFile(char *content)
 {
-	const char *source = lgl_readFile(sourceFile);
+	LGL_FREE(content);
+}
+
+int lgl_compileShader(unsigned int shader, const char *sourceFile)
+{
+	int success = 0;
+	char *source = lgl_readFile(sourceFile);
 	if (!source) {
 		fprintf(stderr, "Could not read shader file \"%s\"\n", sourceFile);
-		return;
+		return 0;
 	}
 
-	glShaderSource(shader, 1, &source, NULL);
+	/* GL keeps its own copy of the source */
+	glShaderSource(shader, 1, (const char **)&source, NULL);
+	lgl_freeFile(source);
 	glCompileShader(shader);
 
-	{
-		int success = 0;
+	glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+	if (!success) {
 		char infoLog[512];
 
-		glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
-		if (!success) {
-			glGetShaderInfoLog(shader, 512, NULL, infoLog);
-			fprintf(stderr, "Shader \"%s\" compilation failed!\nError: %s\n", sourceFile, infoLog);
-		}
+		glGetShaderInfoLog(shader, 512, NULL, infoLog);
+		fprintf(stderr, "Shader \"%s\" compilation failed!\nError: %s\n", sourceFile, infoLog);
 	}
+	return success;
 }
 
-void lgl_linkProgram(unsigned int program)
+int lgl_linkProgram(unsigned int program)
 {
+	int success = 0;
+
 	glLinkProgram(program);
 
-	{
-		int success = 0;
+	glGetProgramiv(program, GL_LINK_STATUS, &success);
+	if (!success) {
 		char infoLog[512];
 
-		glGetProgramiv(program, GL_LINK_STATUS, &success);
-		if (!success) {
-			glGetProgramInfoLog(program, 512, NULL, infoLog);
-			fprintf(stderr, "Program linking failed!\nError: %s\n", infoLog);
-		}
+		glGetProgramInfoLog(program, 512, NULL, infoLog);
+		fprintf(stderr, "Program linking failed!\nError: %s\n", infoLog);
 	}
+	return success;
 }
 
 #endif /*LGL_SHADER_IMPLEMENTATION*/
@@ -0,0 +1,286 @@
+#ifndef __LGL_STATE_CACHE__
+#define __LGL_STATE_CACHE__
+
+/* Shadow copy of the GL state a draw loop touches most: program, vertex
+ * array, framebuffers, texture units, and blend/depth/cull state. Every
+ * setter compares against the copy and only calls GL when the value
+ * actually changes, counting what it drops so redundant state traffic
+ * shows up per frame. The cache assumes it is the only thing changing
+ * this state; after calling GL directly, use lgl_stateInvalidate. */
+
+#define LGL_STATE_TEXTURE_UNITS 16
+
+/* kinds of calls, for the per-frame counters */
+enum {
+	LGL_STATE_PROGRAM,
+	LGL_STATE_VERTEX_ARRAY,
+	LGL_STATE_FRAMEBUFFER,
+	LGL_STATE_ACTIVE_TEXTURE,
+	LGL_STATE_TEXTURE,
+	LGL_STATE_CAPABILITY,
+	LGL_STATE_BLEND_FUNC,
+	LGL_STATE_DEPTH_FUNC,
+	LGL_STATE_DEPTH_MASK,
+	LGL_STATE_KIND_COUNT
+};
+
+/* capabilities tracked by lgl_stateEnable and lgl_stateDisable */
+enum {
+	LGL__STATE_BLEND,
+	LGL__STATE_DEPTH_TEST,
+	LGL__STATE_CULL_FACE,
+	LGL__STATE_SCISSOR_TEST,
+	LGL__STATE_CAPABILITY_COUNT
+};
+
+typedef struct {
+	unsigned int counts[LGL_STATE_KIND_COUNT];
+	unsigned int redundant[LGL_STATE_KIND_COUNT];
+} lgl_StateStats;
+
+typedef struct {
+	/* ~0u is "unknown", so the next set always reaches GL */
+	unsigned int program;
+	unsigned int vertexArray;
+	unsigned int drawFramebuffer, readFramebuffer;
+	unsigned int activeTexture;                       /* unit index */
+	unsigned int textures[LGL_STATE_TEXTURE_UNITS];
+	unsigned int textureTargets[LGL_STATE_TEXTURE_UNITS];
+	int capabilities[LGL__STATE_CAPABILITY_COUNT];    /* -1 unknown */
+	unsigned int blendSrc, blendDst;
+	unsigned int depthFunc;
+	int depthMask;                                    /* -1 unknown */
+
+	lgl_StateStats frame;     /* calls requested in the current frame */
+	lgl_StateStats lastFrame; /* totals of the previous frame */
+} lgl_StateCache;
+
+void lgl_stateInit(lgl_StateCache *state);
+
+/* forgets the shadowed values, statistics are kept */
+void lgl_stateInvalidate(lgl_StateCache *state);
+
+void lgl_stateUseProgram(lgl_StateCache *state, unsigned int program);
+void lgl_stateBindVertexArray(lgl_StateCache *state, unsigned int vao);
+
+/* `target` is GL_FRAMEBUFFER, GL_DRAW_FRAMEBUFFER or GL_READ_FRAMEBUFFER */
+void lgl_stateBindFramebuffer(lgl_StateCache *state, unsigned int target,
+			      unsigned int framebuffer);
+
+/* binds `texture` to `target` of texture unit `unit`, switching the
+ * active unit only when the binding changes */
+void lgl_stateBindTexture(lgl_StateCache *state, unsigned int unit,
+			  unsigned int target, unsigned int texture);
+
+/* GL_BLEND, GL_DEPTH_TEST, GL_CULL_FACE or GL_SCISSOR_TEST; anything else
+ * is passed straight through */
+void lgl_stateEnable(lgl_StateCache *state, unsigned int capability);
+void lgl_stateDisable(lgl_StateCache *state, unsigned int capability);
+
+void lgl_stateBlendFunc(lgl_StateCache *state, unsigned int src,
+			unsigned int dst);
+void lgl_stateDepthFunc(lgl_StateCache *state, unsigned int func);
+void lgl_stateDepthMask(lgl_StateCache *state, int mask);
+
+/* moves the frame counters to `lastFrame` and clears them */
+void lgl_stateEndFrame(lgl_StateCache *state);
+
+/* sums of one statistics block over every kind of call */
+unsigned int lgl_stateCalls(const lgl_StateStats *stats);
+unsigned int lgl_stateRedundant(const lgl_StateStats *stats);
+
+#endif /*__LGL_STATE_CACHE__*/
+
+#ifdef LGL_STATE_CACHE_IMPLEMENTATION
+
+#include <string.h>
+
+#define LGL__STATE_UNKNOWN (~0u)
+
+/* counts one requested call and whether it can be dropped */
+#define LGL__STATE_SAME(state, kind, same) \
+	((state)->frame.counts[kind]++, \
+	 (same) ? ((state)->frame.redundant[kind]++, 1) : 0)
+
+static int lgl__stateCapabilityIndex(unsigned int capability)
+{
+	switch (capability) {
+	case GL_BLEND:        return LGL__STATE_BLEND;
+	case GL_DEPTH_TEST:   return LGL__STATE_DEPTH_TEST;
+	case GL_CULL_FACE:    return LGL__STATE_CULL_FACE;
+	case GL_SCISSOR_TEST: return LGL__STATE_SCISSOR_TEST;
+	default:              return -1;
+	}
+}
+
+void lgl_stateInit(lgl_StateCache *state)
+{
+	memset(state, 0, sizeof(*state));
+	lgl_stateInvalidate(state);
+}
+
+void lgl_stateInvalidate(lgl_StateCache *state)
+{
+	int i;
+
+	state->program = LGL__STATE_UNKNOWN;
+	state->vertexArray = LGL__STATE_UNKNOWN;
+	state->drawFramebuffer = LGL__STATE_UNKNOWN;
+	state->readFramebuffer = LGL__STATE_UNKNOWN;
+	state->activeTexture = LGL__STATE_UNKNOWN;
+	for (i = 0; i < LGL_STATE_TEXTURE_UNITS; i++) {
+		state->textures[i] = LGL__STATE_UNKNOWN;
+		state->textureTargets[i] = LGL__STATE_UNKNOWN;
+	}
+	for (i = 0; i < LGL__STATE_CAPABILITY_COUNT; i++)
+		state->capabilities[i] = -1;
+	state->blendSrc = LGL__STATE_UNKNOWN;
+	state->blendDst = LGL__STATE_UNKNOWN;
+	state->depthFunc = LGL__STATE_UNKNOWN;
+	state->depthMask = -1;
+}
+
+void lgl_stateUseProgram(lgl_StateCache *state, unsigned int program)
+{
+	if (LGL__STATE_SAME(state, LGL_STATE_PROGRAM, state->program == program))
+		return;
+	glUseProgram(program);
+	state->program = program;
+}
+
+void lgl_stateBindVertexArray(lgl_StateCache *state, unsigned int vao)
+{
+	if (LGL__STATE_SAME(state, LGL_STATE_VERTEX_ARRAY,
+			    state->vertexArray == vao))
+		return;
+	glBindVertexArray(vao);
+	state->vertexArray = vao;
+}
+
+void lgl_stateBindFramebuffer(lgl_StateCache *state, unsigned int target,
+			      unsigned int framebuffer)
+{
+	int same;
+
+	if (target == GL_DRAW_FRAMEBUFFER)
+		same = state->drawFramebuffer == framebuffer;
+	else if (target == GL_READ_FRAMEBUFFER)
+		same = state->readFramebuffer == framebuffer;
+	else
+		same = state->drawFramebuffer == framebuffer
+			&& state->readFramebuffer == framebuffer;
+
+	if (LGL__STATE_SAME(state, LGL_STATE_FRAMEBUFFER, same)) return;
+	glBindFramebuffer(target, framebuffer);
+
+	if (target != GL_READ_FRAMEBUFFER) state->drawFramebuffer = framebuffer;
+	if (target != GL_DRAW_FRAMEBUFFER) state->readFramebuffer = framebuffer;
+}
+
+void lgl_stateBindTexture(lgl_StateCache *state, unsigned int unit,
+			  unsigned int target, unsigned int texture)
+{
+	if (unit >= LGL_STATE_TEXTURE_UNITS) {
+		glActiveTexture(GL_TEXTURE0 + unit);
+		glBindTexture(target, texture);
+		state->activeTexture = unit;
+		return;
+	}
+
+	if (LGL__STATE_SAME(state, LGL_STATE_TEXTURE,
+			    state->textures[unit] == texture
+			    && state->textureTargets[unit] == target))
+		return;
+
+	if (!LGL__STATE_SAME(state, LGL_STATE_ACTIVE_TEXTURE,
+			     state->activeTexture == unit)) {
+		glActiveTexture(GL_TEXTURE0 + unit);
+		state->activeTexture = unit;
+	}
+
+	glBindTexture(target, texture);
+	state->textures[unit] = texture;
+	state->textureTargets[unit] = target;
+}
+
+static void lgl__stateSetCapability(lgl_StateCache *state,
+				    unsigned int capability, int enabled)
+{
+	int index = lgl__stateCapabilityIndex(capability);
+
+	if (index >= 0 && LGL__STATE_SAME(state, LGL_STATE_CAPABILITY,
+					  state->capabilities[index] == enabled))
+		return;
+
+	if (enabled)
+		glEnable(capability);
+	else
+		glDisable(capability);
+	if (index >= 0) state->capabilities[index] = enabled;
+}
+
+void lgl_stateEnable(lgl_StateCache *state, unsigned int capability)
+{
+	lgl__stateSetCapability(state, capability, 1);
+}
+
+void lgl_stateDisable(lgl_StateCache *state, unsigned int capability)
+{
+	lgl__stateSetCapability(state, capability, 0);
+}
+
+void lgl_stateBlendFunc(lgl_StateCache *state, unsigned int src,
+			unsigned int dst)
+{
+	if (LGL__STATE_SAME(state, LGL_STATE_BLEND_FUNC,
+			    state->blendSrc == src && state->blendDst == dst))
+		return;
+	glBlendFunc(src, dst);
+	state->blendSrc = src;
+	state->blendDst = dst;
+}
+
+void lgl_stateDepthFunc(lgl_StateCache *state, unsigned int func)
+{
+	if (LGL__STATE_SAME(state, LGL_STATE_DEPTH_FUNC,
+			    state->depthFunc == func))
+		return;
+	glDepthFunc(func);
+	state->depthFunc = func;
+}
+
+void lgl_stateDepthMask(lgl_StateCache *state, int mask)
+{
+	mask = mask ? 1 : 0;
+	if (LGL__STATE_SAME(state, LGL_STATE_DEPTH_MASK,
+			    state->depthMask == mask))
+		return;
+	glDepthMask(mask ? GL_TRUE : GL_FALSE);
+	state->depthMask = mask;
+}
+
+void lgl_stateEndFrame(lgl_StateCache *state)
+{
+	state->lastFrame = state->frame;
+	memset(&state->frame, 0, sizeof(state->frame));
+}
+
+unsigned int lgl_stateCalls(const lgl_StateStats *stats)
+{
+	unsigned int total = 0;
+	int i;
+
+	for (i = 0; i < LGL_STATE_KIND_COUNT; i++) total += stats->counts[i];
+	return total;
+}
+
+unsigned int lgl_stateRedundant(const lgl_StateStats *stats)
+{
+	unsigned int total = 0;
+	int i;
+
+	for (i = 0; i < LGL_STATE_KIND_COUNT; i++) total += stats->redundant[i];
+	return total;
+}
+
+#endif /*LGL_STATE_CACHE_IMPLEMENTATION*/
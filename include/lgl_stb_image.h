@@ -0,0 +1,9 @@
+/* stb_image.h the way the samples include it: define
+ * LGL_STB_IMAGE_IMPLEMENTATION in one file for stb's implementation,
+ * which LGL_STB_IMAGE_LIBRARY leaves out for builds linking it from a
+ * library such as the CMake build's lgl_runtime. */
+
+#if defined(LGL_STB_IMAGE_IMPLEMENTATION) && !defined(LGL_STB_IMAGE_LIBRARY)
+#define STB_IMAGE_IMPLEMENTATION
+#endif
+#include <stb_image.h>
@@ -0,0 +1,460 @@
+#ifndef __LGL_TRANSFORM__
+#define __LGL_TRANSFORM__
+
+#include <cglm/cglm.h>
+
+/* Transform hierarchy: every node stores a local translation, rotation
+ * (quaternion) and scale. Nodes live in contiguous arrays sorted breadth
+ * first, so one linear pass updates parents before their children, and
+ * only nodes below a changed node get their world matrix recomputed.
+ * Nodes are referred to by the handle returned by lgl_transformAdd, which
+ * stays valid when the arrays are reordered.
+ *
+ * Include lgl_worker_pool.h first, or define LGL_TRANSFORM_NO_THREADS
+ * to leave out lgl_transformUpdateParallel's threads. */
+
+typedef struct {
+	int count, capacity;
+	int sorted;            /* 0 after nodes were added */
+	int dirtyCount;
+
+	/* indexed by handle */
+	int *slotOf;
+	int *parentHandle;
+
+	/* indexed by slot, in breadth-first order */
+	int *handleOf;
+	int *parent;           /* slot of the parent, -1 for roots */
+	int *depth;
+	vec3 *position;
+	versor *rotation;
+	vec3 *scale;
+	mat4 *world;
+	unsigned char *dirty;  /* local TRS changed */
+	unsigned char *moved;  /* world matrix recomputed by the last update */
+
+	int levelCount;
+	int *levelStart;       /* first slot of every depth, levelCount + 1 */
+
+	void *matrixBlock;
+
+	void *pool;            /* lgl_WorkerPool of lgl_transformUpdateParallel */
+	int poolThreads;
+} lgl_TransformTree;
+
+int lgl_transformInit(lgl_TransformTree *tree, int capacity);
+
+void lgl_transformFree(lgl_TransformTree *tree);
+
+/* returns the handle of a new identity node, or -1; `parent` is a handle
+ * or -1 for a root */
+int lgl_transformAdd(lgl_TransformTree *tree, int parent);
+
+void lgl_transformSetPosition(lgl_TransformTree *tree, int node, vec3 position);
+
+void lgl_transformSetRotation(lgl_TransformTree *tree, int node, versor rotation);
+
+void lgl_transformSetScale(lgl_TransformTree *tree, int node, vec3 scale);
+
+/* marks every node as changed, which forces a full update */
+void lgl_transformMarkAllDirty(lgl_TransformTree *tree);
+
+/* recomputes the world matrices below changed nodes; returns how many
+ * world matrices were recomputed */
+int lgl_transformUpdate(lgl_TransformTree *tree);
+
+/* same as lgl_transformUpdate, with the nodes of every depth split
+ * between `threadCount` threads; the threads are kept in a worker pool
+ * until lgl_transformFree or a different `threadCount` */
+int lgl_transformUpdateParallel(lgl_TransformTree *tree, int threadCount);
+
+/* world matrix of a node, valid until the next update */
+vec4 *lgl_transformWorld(lgl_TransformTree *tree, int node);
+
+#endif /*__LGL_TRANSFORM__*/
+
+#ifdef LGL_TRANSFORM_IMPLEMENTATION
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef LGL_TRANSFORM_NO_THREADS
+#include <pthread.h>
+#endif
+
+static int lgl__transformAlloc(lgl_TransformTree *tree, int capacity)
+{
+	lgl_TransformTree grown = *tree;
+	size_t n = (size_t)capacity;
+	char *block;
+
+	grown.slotOf = realloc(tree->slotOf, sizeof(int) * n);
+	if (grown.slotOf) tree->slotOf = grown.slotOf;
+	grown.parentHandle = realloc(tree->parentHandle, sizeof(int) * n);
+	if (grown.parentHandle) tree->parentHandle = grown.parentHandle;
+	grown.handleOf = realloc(tree->handleOf, sizeof(int) * n);
+	if (grown.handleOf) tree->handleOf = grown.handleOf;
+	grown.parent = realloc(tree->parent, sizeof(int) * n);
+	if (grown.parent) tree->parent = grown.parent;
+	grown.depth = realloc(tree->depth, sizeof(int) * n);
+	if (grown.depth) tree->depth = grown.depth;
+	grown.position = realloc(tree->position, sizeof(vec3) * n);
+	if (grown.position) tree->position = grown.position;
+	grown.rotation = realloc(tree->rotation, sizeof(versor) * n);
+	if (grown.rotation) tree->rotation = grown.rotation;
+	grown.scale = realloc(tree->scale, sizeof(vec3) * n);
+	if (grown.scale) tree->scale = grown.scale;
+	grown.dirty = realloc(tree->dirty, n);
+	if (grown.dirty) tree->dirty = grown.dirty;
+	grown.moved = realloc(tree->moved, n);
+	if (grown.moved) tree->moved = grown.moved;
+	grown.levelStart = realloc(tree->levelStart, sizeof(int) * (n + 1));
+	if (grown.levelStart) tree->levelStart = grown.levelStart;
+
+	if (!grown.slotOf || !grown.parentHandle || !grown.handleOf
+	    || !grown.parent || !grown.depth || !grown.position
+	    || !grown.rotation || !grown.scale || !grown.dirty || !grown.moved
+	    || !grown.levelStart)
+		return 0;
+
+	/* matrices are kept 32-byte aligned for cglm's SIMD paths */
+	block = malloc(sizeof(mat4) * n + 32);
+	if (!block) return 0;
+	grown.world = (mat4 *)(((size_t)block + 31) & ~(size_t)31);
+	if (tree->world)
+		memcpy(grown.world, tree->world, sizeof(mat4) * tree->count);
+	free(tree->matrixBlock);
+	tree->matrixBlock = block;
+	tree->world = grown.world;
+
+	tree->capacity = capacity;
+	return 1;
+}
+
+int lgl_transformInit(lgl_TransformTree *tree, int capacity)
+{
+	memset(tree, 0, sizeof(*tree));
+	tree->sorted = 1;
+	if (capacity < 16) capacity = 16;
+
+	if (!lgl__transformAlloc(tree, capacity)) {
+		lgl_transformFree(tree);
+		return 0;
+	}
+	return 1;
+}
+
+void lgl_transformFree(lgl_TransformTree *tree)
+{
+	free(tree->slotOf);
+	free(tree->parentHandle);
+	free(tree->handleOf);
+	free(tree->parent);
+	free(tree->depth);
+	free(tree->position);
+	free(tree->rotation);
+	free(tree->scale);
+	free(tree->dirty);
+	free(tree->moved);
+	free(tree->levelStart);
+	free(tree->matrixBlock);
+#ifndef LGL_TRANSFORM_NO_THREADS
+	if (tree->pool) {
+		lgl_workerPoolFree(tree->pool);
+		free(tree->pool);
+	}
+#endif
+	memset(tree, 0, sizeof(*tree));
+}
+
+int lgl_transformAdd(lgl_TransformTree *tree, int parent)
+{
+	int node = tree->count;
+
+	if (parent >= tree->count) return -1;
+	if (tree->count == tree->capacity
+	    && !lgl__transformAlloc(tree, tree->capacity * 2))
+		return -1;
+
+	/* appended for now, lgl_transformUpdate restores the order */
+	tree->slotOf[node] = node;
+	tree->handleOf[node] = node;
+	tree->parentHandle[node] = parent;
+	tree->parent[node] = parent < 0 ? -1 : tree->slotOf[parent];
+	tree->depth[node] = parent < 0 ? 0 : tree->depth[tree->slotOf[parent]] + 1;
+	glm_vec3_zero(tree->position[node]);
+	glm_quat_identity(tree->rotation[node]);
+	glm_vec3_one(tree->scale[node]);
+	glm_mat4_identity(tree->world[node]);
+	tree->dirty[node] = 1;
+	tree->moved[node] = 0;
+
+	tree->count++;
+	tree->dirtyCount++;
+	tree->sorted = 0;
+	return node;
+}
+
+void lgl_transformSetPosition(lgl_TransformTree *tree, int node, vec3 position)
+{
+	int slot = tree->slotOf[node];
+
+	glm_vec3_copy(position, tree->position[slot]);
+	tree->dirty[slot] = 1;
+	tree->dirtyCount++;
+}
+
+void lgl_transformSetRotation(lgl_TransformTree *tree, int node, versor rotation)
+{
+	int slot = tree->slotOf[node];
+
+	glm_quat_copy(rotation, tree->rotation[slot]);
+	tree->dirty[slot] = 1;
+	tree->dirtyCount++;
+}
+
+void lgl_transformSetScale(lgl_TransformTree *tree, int node, vec3 scale)
+{
+	int slot = tree->slotOf[node];
+
+	glm_vec3_copy(scale, tree->scale[slot]);
+	tree->dirty[slot] = 1;
+	tree->dirtyCount++;
+}
+
+void lgl_transformMarkAllDirty(lgl_TransformTree *tree)
+{
+	memset(tree->dirty, 1, tree->count);
+	tree->dirtyCount += tree->count;
+}
+
+vec4 *lgl_transformWorld(lgl_TransformTree *tree, int node)
+{
+	return tree->world[tree->slotOf[node]];
+}
+
+/* stable counting sort of the nodes by depth */
+static int lgl__transformSort(lgl_TransformTree *tree)
+{
+	lgl_TransformTree sorted = {0};
+	int i, levels = 0;
+
+	for (i = 0; i < tree->count; i++)
+		if (tree->depth[i] + 1 > levels) levels = tree->depth[i] + 1;
+
+	if (!lgl__transformAlloc(&sorted, tree->capacity)) {
+		lgl_transformFree(&sorted);
+		return 0;
+	}
+
+	memset(sorted.levelStart, 0, sizeof(int) * (levels + 1));
+	for (i = 0; i < tree->count; i++)
+		sorted.levelStart[tree->depth[i] + 1]++;
+	for (i = 0; i < levels; i++)
+		sorted.levelStart[i + 1] += sorted.levelStart[i];
+
+	/* handles were created parent first, so walking them in order
+	 * places every parent before its children */
+	{
+		int *next = malloc(sizeof(int) * (levels + 1));
+		int handle;
+
+		if (!next) {
+			lgl_transformFree(&sorted);
+			return 0;
+		}
+		memcpy(next, sorted.levelStart, sizeof(int) * (levels + 1));
+
+		for (handle = 0; handle < tree->count; handle++) {
+			int from = tree->slotOf[handle];
+			int to = next[tree->depth[from]]++;
+
+			sorted.slotOf[handle] = to;
+			sorted.handleOf[to] = handle;
+			sorted.parentHandle[handle] = tree->parentHandle[handle];
+			sorted.depth[to] = tree->depth[from];
+			glm_vec3_copy(tree->position[from], sorted.position[to]);
+			glm_quat_copy(tree->rotation[from], sorted.rotation[to]);
+			glm_vec3_copy(tree->scale[from], sorted.scale[to]);
+			glm_mat4_copy(tree->world[from], sorted.world[to]);
+			sorted.dirty[to] = tree->dirty[from];
+			sorted.moved[to] = 0;
+		}
+		free(next);
+	}
+
+	for (i = 0; i < tree->count; i++) {
+		int parentHandle = sorted.parentHandle[sorted.handleOf[i]];
+		sorted.parent[i] = parentHandle < 0 ? -1 : sorted.slotOf[parentHandle];
+	}
+
+	sorted.count = tree->count;
+	sorted.capacity = tree->capacity;
+	sorted.dirtyCount = tree->dirtyCount;
+	sorted.levelCount = levels;
+	sorted.sorted = 1;
+
+	/* the worker pool outlives the reordering */
+	sorted.pool = tree->pool;
+	sorted.poolThreads = tree->poolThreads;
+	tree->pool = NULL;
+	tree->poolThreads = 0;
+
+	lgl_transformFree(tree);
+	*tree = sorted;
+	return 1;
+}
+
+/* updates slots [begin, end) of one depth, returns the number of moved nodes */
+static int lgl__transformUpdateRange(lgl_TransformTree *tree, int begin, int end)
+{
+	int i, moved = 0;
+
+	for (i = begin; i < end; i++) {
+		int parent = tree->parent[i];
+		mat4 local;
+
+		tree->moved[i] = tree->dirty[i] || (parent >= 0 && tree->moved[parent]);
+		if (!tree->moved[i]) continue;
+
+		/* T * R * S, written directly into the columns */
+		glm_quat_mat4(tree->rotation[i], local);
+		glm_vec4_scale(local[0], tree->scale[i][0], local[0]);
+		glm_vec4_scale(local[1], tree->scale[i][1], local[1]);
+		glm_vec4_scale(local[2], tree->scale[i][2], local[2]);
+		glm_vec3_copy(tree->position[i], local[3]);
+
+		if (parent >= 0)
+			glm_mul(tree->world[parent], local, tree->world[i]);
+		else
+			glm_mat4_copy(local, tree->world[i]);
+
+		tree->dirty[i] = 0;
+		moved++;
+	}
+
+	return moved;
+}
+
+int lgl_transformUpdate(lgl_TransformTree *tree)
+{
+	int moved;
+
+	if (!tree->sorted && !lgl__transformSort(tree)) return 0;
+	if (tree->dirtyCount == 0) {
+		memset(tree->moved, 0, tree->count);
+		return 0;
+	}
+
+	moved = lgl__transformUpdateRange(tree, 0, tree->count);
+	tree->dirtyCount = 0;
+	return moved;
+}
+
+#ifndef LGL_TRANSFORM_NO_THREADS
+/* a small barrier on a mutex and condition variable, between the pool's
+ * workers at the end of every depth */
+typedef struct {
+	pthread_mutex_t mutex;
+	pthread_cond_t cond;
+	int participants, arrived, generation;
+} lgl__TransformBarrier;
+
+typedef struct {
+	lgl_TransformTree *tree;
+	lgl__TransformBarrier barrier;
+	int moved[LGL_WORKER_POOL_MAX];
+} lgl__TransformJob;
+
+static void lgl__transformBarrierWait(lgl__TransformBarrier *barrier)
+{
+	int generation;
+
+	pthread_mutex_lock(&barrier->mutex);
+	generation = barrier->generation;
+	if (++barrier->arrived == barrier->participants) {
+		barrier->arrived = 0;
+		barrier->generation++;
+		pthread_cond_broadcast(&barrier->cond);
+	} else {
+		while (generation == barrier->generation)
+			pthread_cond_wait(&barrier->cond, &barrier->mutex);
+	}
+	pthread_mutex_unlock(&barrier->mutex);
+}
+
+static void lgl__transformWorker(void *data, int index)
+{
+	lgl__TransformJob *job = data;
+	lgl_TransformTree *tree = job->tree;
+	int threadCount = job->barrier.participants;
+	int level;
+
+	for (level = 0; level < tree->levelCount; level++) {
+		int begin = tree->levelStart[level];
+		int size = tree->levelStart[level + 1] - begin;
+		int from = begin + (int)((long)size * index / threadCount);
+		int to = begin + (int)((long)size * (index + 1) / threadCount);
+
+		job->moved[index] += lgl__transformUpdateRange(tree, from, to);
+
+		/* the next depth reads this one's world matrices */
+		lgl__transformBarrierWait(&job->barrier);
+	}
+}
+#endif
+
+int lgl_transformUpdateParallel(lgl_TransformTree *tree, int threadCount)
+{
+#ifndef LGL_TRANSFORM_NO_THREADS
+	lgl_WorkerPool *pool;
+	lgl__TransformJob job;
+	int i, moved = 0;
+
+	if (threadCount > LGL_WORKER_POOL_MAX) threadCount = LGL_WORKER_POOL_MAX;
+	if (threadCount <= 1) return lgl_transformUpdate(tree);
+
+	if (!tree->sorted && !lgl__transformSort(tree)) return 0;
+	if (tree->dirtyCount == 0) {
+		memset(tree->moved, 0, tree->count);
+		return 0;
+	}
+
+	/* the threads are started once and kept for the next updates */
+	pool = tree->pool;
+	if (pool && tree->poolThreads != threadCount) {
+		lgl_workerPoolFree(pool);
+		free(pool);
+		pool = tree->pool = NULL;
+	}
+	if (!pool) {
+		pool = malloc(sizeof(*pool));
+		if (!pool) return lgl_transformUpdate(tree);
+		lgl_workerPoolInit(pool, threadCount);
+		tree->pool = pool;
+		tree->poolThreads = threadCount;
+	}
+
+	job.tree = tree;
+	pthread_mutex_init(&job.barrier.mutex, NULL);
+	pthread_cond_init(&job.barrier.cond, NULL);
+	job.barrier.participants = pool->threadCount;
+	job.barrier.arrived = 0;
+	job.barrier.generation = 0;
+	memset(job.moved, 0, sizeof(job.moved));
+
+	lgl_workerPoolRun(pool, lgl__transformWorker, &job);
+	for (i = 0; i < pool->threadCount; i++)
+		moved += job.moved[i];
+
+	pthread_cond_destroy(&job.barrier.cond);
+	pthread_mutex_destroy(&job.barrier.mutex);
+	tree->dirtyCount = 0;
+	return moved;
+#else
+	(void)threadCount;
+	return lgl_transformUpdate(tree);
+#endif
+}
+
+#endif /*LGL_TRANSFORM_IMPLEMENTATION*/
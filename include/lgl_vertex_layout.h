@@ -0,0 +1,242 @@
+#ifndef __LGL_VERTEX_LAYOUT__
+#define __LGL_VERTEX_LAYOUT__
+
+#include <stddef.h>
+
+/* Declarative vertex layouts and a cache of one VAO per distinct layout.
+ * Attributes are listed in vertex order and their offsets and the stride
+ * follow from their types, so no stride is written by hand. The VAO of a
+ * layout is described once with glVertexArrayAttribFormat; meshes sharing
+ * the layout share the VAO and only swap the buffers attached to it.
+ * The VAOs are built with lgl_dsa.h; include it first. */
+
+#define LGL_VERTEX_LAYOUT_MAX_ATTRIBS 8
+
+typedef struct {
+	unsigned int location;
+	int size;             /* components, 1 to 4 */
+	unsigned int type;    /* GL_FLOAT, GL_UNSIGNED_BYTE, ... */
+	int normalized;
+	unsigned int offset;  /* in bytes, filled in by lgl_vertexLayoutAdd */
+} lgl_VertexAttrib;
+
+typedef struct {
+	lgl_VertexAttrib attribs[LGL_VERTEX_LAYOUT_MAX_ATTRIBS];
+	int attribCount;
+	int stride;           /* in bytes */
+} lgl_VertexLayout;
+
+typedef struct {
+	lgl_VertexLayout layout;
+	unsigned int hash;
+	unsigned int vao;     /* 0 for an empty slot */
+} lgl_VaoCacheEntry;
+
+typedef struct {
+	lgl_VaoCacheEntry *entries;
+	int count, capacity;  /* capacity is a power of two */
+	unsigned long hits, misses;
+} lgl_VaoCache;
+
+void lgl_vertexLayoutInit(lgl_VertexLayout *layout);
+
+/* appends an attribute after the previous one; returns 0 when full */
+int lgl_vertexLayoutAdd(lgl_VertexLayout *layout, unsigned int location,
+			int size, unsigned int type, int normalized);
+
+unsigned int lgl_vertexLayoutHash(const lgl_VertexLayout *layout);
+
+int lgl_vaoCacheInit(lgl_VaoCache *cache, int capacity);
+
+/* deletes every cached VAO */
+void lgl_vaoCacheFree(lgl_VaoCache *cache);
+
+/* the VAO for `layout`, created on first use; 0 on failure */
+unsigned int lgl_vaoCacheGet(lgl_VaoCache *cache, const lgl_VertexLayout *layout);
+
+/* binds the layout's VAO with `vbo` at `offset` and `ebo` (may be 0)
+ * attached, ready to draw a mesh; returns the VAO or 0 on failure */
+unsigned int lgl_vaoCacheBind(lgl_VaoCache *cache, const lgl_VertexLayout *layout,
+			      unsigned int vbo, size_t offset, unsigned int ebo);
+
+#endif /*__LGL_VERTEX_LAYOUT__*/
+
+#ifdef LGL_VERTEX_LAYOUT_IMPLEMENTATION
+
+#include <stdlib.h>
+#include <string.h>
+
+static int lgl__vertexAttribBytes(int size, unsigned int type)
+{
+	switch (type) {
+	case GL_BYTE:
+	case GL_UNSIGNED_BYTE:
+		return size;
+	case GL_SHORT:
+	case GL_UNSIGNED_SHORT:
+	case GL_HALF_FLOAT:
+		return size * 2;
+	case GL_DOUBLE:
+		return size * 8;
+	case GL_INT_2_10_10_10_REV:
+	case GL_UNSIGNED_INT_2_10_10_10_REV:
+	case GL_UNSIGNED_INT_10F_11F_11F_REV:
+		return 4;
+	default:
+		return size * 4;
+	}
+}
+
+void lgl_vertexLayoutInit(lgl_VertexLayout *layout)
+{
+	/* zeroed padding too, the hash and comparisons read raw bytes */
+	memset(layout, 0, sizeof(*layout));
+}
+
+int lgl_vertexLayoutAdd(lgl_VertexLayout *layout, unsigned int location,
+			int size, unsigned int type, int normalized)
+{
+	lgl_VertexAttrib *attrib;
+
+	if (layout->attribCount == LGL_VERTEX_LAYOUT_MAX_ATTRIBS) return 0;
+
+	attrib = &layout->attribs[layout->attribCount++];
+	attrib->location = location;
+	attrib->size = size;
+	attrib->type = type;
+	attrib->normalized = normalized ? 1 : 0;
+	attrib->offset = (unsigned int)layout->stride;
+
+	/* keep every attribute 4-byte aligned */
+	layout->stride += (lgl__vertexAttribBytes(size, type) + 3) & ~3;
+	return 1;
+}
+
+/* FNV-1a over the layout */
+unsigned int lgl_vertexLayoutHash(const lgl_VertexLayout *layout)
+{
+	const unsigned char *bytes = (const unsigned char *)layout;
+	unsigned int hash = 2166136261u;
+	size_t i;
+
+	for (i = 0; i < sizeof(*layout); i++) {
+		hash ^= bytes[i];
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+int lgl_vaoCacheInit(lgl_VaoCache *cache, int capacity)
+{
+	int size = 8;
+
+	memset(cache, 0, sizeof(*cache));
+	while (size < capacity) size *= 2;
+
+	cache->entries = calloc(size, sizeof(*cache->entries));
+	if (!cache->entries) return 0;
+
+	cache->capacity = size;
+	return 1;
+}
+
+void lgl_vaoCacheFree(lgl_VaoCache *cache)
+{
+	int i;
+
+	for (i = 0; i < cache->capacity; i++)
+		if (cache->entries[i].vao)
+			glDeleteVertexArrays(1, &cache->entries[i].vao);
+	free(cache->entries);
+	memset(cache, 0, sizeof(*cache));
+}
+
+/* slot holding `layout`, or the empty slot where it belongs */
+static lgl_VaoCacheEntry *lgl__vaoCacheFind(lgl_VaoCacheEntry *entries,
+					    int capacity,
+					    const lgl_VertexLayout *layout,
+					    unsigned int hash)
+{
+	int i = (int)(hash & (unsigned int)(capacity - 1));
+
+	while (entries[i].vao
+	       && (entries[i].hash != hash
+		   || memcmp(&entries[i].layout, layout, sizeof(*layout))))
+		i = (i + 1) & (capacity - 1);
+	return &entries[i];
+}
+
+static int lgl__vaoCacheGrow(lgl_VaoCache *cache)
+{
+	int capacity = cache->capacity * 2, i;
+	lgl_VaoCacheEntry *entries = calloc(capacity, sizeof(*entries));
+
+	if (!entries) return 0;
+
+	for (i = 0; i < cache->capacity; i++) {
+		const lgl_VaoCacheEntry *entry = &cache->entries[i];
+
+		if (entry->vao)
+			*lgl__vaoCacheFind(entries, capacity, &entry->layout,
+					   entry->hash) = *entry;
+	}
+
+	free(cache->entries);
+	cache->entries = entries;
+	cache->capacity = capacity;
+	return 1;
+}
+
+unsigned int lgl_vaoCacheGet(lgl_VaoCache *cache, const lgl_VertexLayout *layout)
+{
+	unsigned int hash = lgl_vertexLayoutHash(layout);
+	lgl_VaoCacheEntry *entry;
+	unsigned int vao = 0;
+	int i;
+
+	entry = lgl__vaoCacheFind(cache->entries, cache->capacity, layout, hash);
+	if (entry->vao) {
+		cache->hits++;
+		return entry->vao;
+	}
+
+	/* stay at most 3/4 full so probing ends quickly */
+	if ((cache->count + 1) * 4 > cache->capacity * 3) {
+		if (!lgl__vaoCacheGrow(cache)) return 0;
+		entry = lgl__vaoCacheFind(cache->entries, cache->capacity,
+					  layout, hash);
+	}
+
+	glCreateVertexArrays(1, &vao);
+	if (!vao) return 0;
+
+	for (i = 0; i < layout->attribCount; i++) {
+		const lgl_VertexAttrib *attrib = &layout->attribs[i];
+
+		lgl_vertexArrayAttrib(vao, attrib->location, attrib->size,
+				      attrib->type, attrib->normalized,
+				      attrib->offset, 0);
+	}
+
+	entry->layout = *layout;
+	entry->hash = hash;
+	entry->vao = vao;
+	cache->count++;
+	cache->misses++;
+	return vao;
+}
+
+unsigned int lgl_vaoCacheBind(lgl_VaoCache *cache, const lgl_VertexLayout *layout,
+			      unsigned int vbo, size_t offset, unsigned int ebo)
+{
+	unsigned int vao = lgl_vaoCacheGet(cache, layout);
+
+	if (!vao) return 0;
+
+	glVertexArrayVertexBuffer(vao, 0, vbo, (GLintptr)offset, layout->stride);
+	glVertexArrayElementBuffer(vao, ebo);
+	glBindVertexArray(vao);
+	return vao;
+}
+
+#endif /*LGL_VERTEX_LAYOUT_IMPLEMENTATION*/
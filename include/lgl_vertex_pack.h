@@ -0,0 +1,395 @@
+#ifndef __LGL_VERTEX_PACK__
+#define __LGL_VERTEX_PACK__
+
+#include <stddef.h>
+#include <cglm/cglm.h>
+
+/* Vertex format compiler: describes how each float attribute of an
+ * interleaved vertex array is quantized, packs the vertices and sets up
+ * the matching vertex attribute state. */
+
+#define LGL_VERTEX_PACK_MAX_ATTRIBS 8
+
+enum {
+	LGL_PACK_FLOAT,   /* unchanged 32-bit floats */
+	LGL_PACK_SNORM16, /* positions, normalized into the mesh bounds */
+	LGL_PACK_HALF,    /* texture coordinates */
+	LGL_PACK_UNORM8,  /* colors in [0, 1], alpha defaults to 1 */
+	LGL_PACK_SNORM10  /* unit normals as GL_INT_2_10_10_10_REV */
+};
+
+typedef struct {
+	unsigned int location;
+	int components;  /* floats read from the source vertex */
+	int format;      /* LGL_PACK_* */
+
+	/* filled in by lgl_vertexFormatCompile and lgl_vertexPack */
+	int srcOffset;   /* in floats */
+	int offset;      /* in bytes */
+	vec3 center;     /* SNORM16 only: value = center + extent * snorm */
+	vec3 extent;
+	float maxError;  /* largest absolute error of the last pack */
+} lgl_PackAttrib;
+
+typedef struct {
+	lgl_PackAttrib attribs[LGL_VERTEX_PACK_MAX_ATTRIBS];
+	int attribCount;
+	int srcStride;   /* in floats */
+	int stride;      /* in bytes */
+} lgl_VertexFormat;
+
+void lgl_vertexFormatInit(lgl_VertexFormat *fmt);
+
+/* attributes are read from the source vertex in the order they are added */
+int lgl_vertexFormatAdd(lgl_VertexFormat *fmt, unsigned int location,
+			int components, int format);
+
+void lgl_vertexFormatCompile(lgl_VertexFormat *fmt);
+
+size_t lgl_vertexPackSize(const lgl_VertexFormat *fmt, int vertexCount);
+
+/* packs `vertexCount` source vertices into `dst`, which must hold
+ * lgl_vertexPackSize bytes; records the bounds of SNORM16 attributes and
+ * the measured error of every attribute */
+void lgl_vertexPack(lgl_VertexFormat *fmt, const float *src,
+		    int vertexCount, void *dst);
+
+/* matrix mapping the normalized positions of `location` back to their
+ * original space, to be multiplied into the model matrix */
+void lgl_vertexFormatDequantize(const lgl_VertexFormat *fmt,
+				unsigned int location, mat4 dest);
+
+/* glVertexAttribPointer setup for the bound VAO and GL_ARRAY_BUFFER */
+void lgl_vertexFormatApply(const lgl_VertexFormat *fmt, size_t baseOffset);
+
+/* glVertexAttribFormat setup reading from vertex buffer binding `binding`;
+ * the buffer is attached with glBindVertexBuffer(binding, buf, 0, stride) */
+void lgl_vertexFormatApplyBinding(const lgl_VertexFormat *fmt,
+				  unsigned int binding);
+
+unsigned short lgl_floatToHalf(float value);
+
+float lgl_halfToFloat(unsigned short half);
+
+#endif /*__LGL_VERTEX_PACK__*/
+
+#ifdef LGL_VERTEX_PACK_IMPLEMENTATION
+
+#include <string.h>
+#include <math.h>
+
+void lgl_vertexFormatInit(lgl_VertexFormat *fmt)
+{
+	memset(fmt, 0, sizeof(*fmt));
+}
+
+int lgl_vertexFormatAdd(lgl_VertexFormat *fmt, unsigned int location,
+			int components, int format)
+{
+	lgl_PackAttrib *attrib;
+
+	if (fmt->attribCount >= LGL_VERTEX_PACK_MAX_ATTRIBS) return 0;
+	if (components < 1 || components > 4) return 0;
+	if ((format == LGL_PACK_SNORM16 || format == LGL_PACK_SNORM10)
+	    && components > 3) return 0;
+
+	attrib = &fmt->attribs[fmt->attribCount++];
+	memset(attrib, 0, sizeof(*attrib));
+	attrib->location = location;
+	attrib->components = components;
+	attrib->format = format;
+	return 1;
+}
+
+static int lgl__packedSize(const lgl_PackAttrib *attrib)
+{
+	switch (attrib->format) {
+	case LGL_PACK_SNORM16: return (attrib->components * 2 + 3) & ~3;
+	case LGL_PACK_HALF: return (attrib->components * 2 + 3) & ~3;
+	case LGL_PACK_UNORM8: return 4;
+	case LGL_PACK_SNORM10: return 4;
+	default: return attrib->components * 4;
+	}
+}
+
+void lgl_vertexFormatCompile(lgl_VertexFormat *fmt)
+{
+	int i, src = 0, offset = 0;
+
+	for (i = 0; i < fmt->attribCount; i++) {
+		lgl_PackAttrib *attrib = &fmt->attribs[i];
+
+		attrib->srcOffset = src;
+		attrib->offset = offset;
+		src += attrib->components;
+		offset += lgl__packedSize(attrib);
+	}
+
+	fmt->srcStride = src;
+	fmt->stride = offset;
+}
+
+size_t lgl_vertexPackSize(const lgl_VertexFormat *fmt, int vertexCount)
+{
+	return (size_t)fmt->stride * (size_t)vertexCount;
+}
+
+unsigned short lgl_floatToHalf(float value)
+{
+	unsigned int bits, sign, mantissa;
+	int exponent;
+
+	memcpy(&bits, &value, sizeof(bits));
+	sign = (bits >> 16) & 0x8000;
+	exponent = (int)((bits >> 23) & 0xff) - 127 + 15;
+	mantissa = bits & 0x7fffff;
+
+	if (exponent >= 31) {
+		/* overflow, infinity and NaN */
+		if (((bits >> 23) & 0xff) == 0xff && mantissa)
+			return (unsigned short)(sign | 0x7e00);
+		return (unsigned short)(sign | 0x7c00);
+	}
+
+	if (exponent <= 0) {
+		/* subnormal half or zero */
+		if (exponent < -10) return (unsigned short)sign;
+		mantissa |= 0x800000;
+		{
+			int shift = 14 - exponent;
+			unsigned int half = mantissa >> shift;
+			unsigned int rest = mantissa & ((1u << shift) - 1);
+			unsigned int mid = 1u << (shift - 1);
+
+			if (rest > mid || (rest == mid && (half & 1))) half++;
+			return (unsigned short)(sign | half);
+		}
+	}
+
+	{
+		unsigned int half = sign | ((unsigned int)exponent << 10)
+			| (mantissa >> 13);
+		unsigned int rest = mantissa & 0x1fff;
+
+		/* round to nearest even, carrying into the exponent */
+		if (rest > 0x1000 || (rest == 0x1000 && (half & 1))) half++;
+		return (unsigned short)half;
+	}
+}
+
+float lgl_halfToFloat(unsigned short half)
+{
+	unsigned int sign = (unsigned int)(half & 0x8000) << 16;
+	unsigned int exponent = (half >> 10) & 0x1f;
+	unsigned int mantissa = half & 0x3ff;
+	unsigned int bits;
+	float value;
+
+	if (exponent == 0) {
+		value = ldexpf((float)mantissa, -24);
+		return sign ? -value : value;
+	}
+
+	if (exponent == 31)
+		bits = sign | 0x7f800000 | (mantissa << 13);
+	else
+		bits = sign | ((exponent - 15 + 127) << 23) | (mantissa << 13);
+
+	memcpy(&value, &bits, sizeof(value));
+	return value;
+}
+
+static int lgl__quantizeSigned(float value, int maxValue)
+{
+	value = glm_clamp(value, -1.0f, 1.0f) * (float)maxValue;
+	return (int)(value < 0.0f ? value - 0.5f : value + 0.5f);
+}
+
+static void lgl__packBounds(lgl_PackAttrib *attrib, const float *src,
+			    int srcStride, int vertexCount)
+{
+	vec3 min = {0.0f, 0.0f, 0.0f}, max = {0.0f, 0.0f, 0.0f};
+	int v, c;
+
+	for (v = 0; v < vertexCount; v++) {
+		const float *value = src + v * srcStride + attrib->srcOffset;
+
+		for (c = 0; c < attrib->components && c < 3; c++) {
+			if (v == 0 || value[c] < min[c]) min[c] = value[c];
+			if (v == 0 || value[c] > max[c]) max[c] = value[c];
+		}
+	}
+
+	for (c = 0; c < 3; c++) {
+		attrib->center[c] = (min[c] + max[c]) * 0.5f;
+		attrib->extent[c] = (max[c] - min[c]) * 0.5f;
+		if (attrib->extent[c] <= 0.0f) attrib->extent[c] = 1.0f;
+	}
+}
+
+void lgl_vertexPack(lgl_VertexFormat *fmt, const float *src,
+		    int vertexCount, void *dst)
+{
+	unsigned char *out = dst;
+	int i, v, c;
+
+	memset(dst, 0, lgl_vertexPackSize(fmt, vertexCount));
+
+	for (i = 0; i < fmt->attribCount; i++) {
+		lgl_PackAttrib *attrib = &fmt->attribs[i];
+
+		attrib->maxError = 0.0f;
+		if (attrib->format == LGL_PACK_SNORM16)
+			lgl__packBounds(attrib, src, fmt->srcStride, vertexCount);
+	}
+
+	for (v = 0; v < vertexCount; v++) {
+		const float *vertex = src + v * fmt->srcStride;
+		unsigned char *packed = out + v * fmt->stride;
+
+		for (i = 0; i < fmt->attribCount; i++) {
+			lgl_PackAttrib *attrib = &fmt->attribs[i];
+			const float *value = vertex + attrib->srcOffset;
+			unsigned char *field = packed + attrib->offset;
+			float decoded[4];
+
+			switch (attrib->format) {
+			case LGL_PACK_SNORM16: {
+				short q[4] = {0, 0, 0, 0};
+				for (c = 0; c < attrib->components; c++) {
+					q[c] = (short)lgl__quantizeSigned(
+						(value[c] - attrib->center[c])
+						/ attrib->extent[c], 32767);
+					decoded[c] = attrib->center[c] + attrib->extent[c]
+						* glm_max((float)q[c] / 32767.0f, -1.0f);
+				}
+				memcpy(field, q, attrib->components * sizeof(short));
+				break;
+			}
+			case LGL_PACK_HALF: {
+				unsigned short h[4];
+				for (c = 0; c < attrib->components; c++) {
+					h[c] = lgl_floatToHalf(value[c]);
+					decoded[c] = lgl_halfToFloat(h[c]);
+				}
+				memcpy(field, h, attrib->components * sizeof(short));
+				break;
+			}
+			case LGL_PACK_UNORM8:
+				for (c = 0; c < 4; c++) {
+					float f = c < attrib->components ? value[c] : 1.0f;
+					field[c] = (unsigned char)(glm_clamp(f, 0.0f, 1.0f) * 255.0f + 0.5f);
+					decoded[c] = (float)field[c] / 255.0f;
+				}
+				break;
+			case LGL_PACK_SNORM10: {
+				unsigned int word = 0;
+				for (c = 0; c < 3; c++) {
+					float f = c < attrib->components ? value[c] : 0.0f;
+					int q = lgl__quantizeSigned(f, 511);
+					word |= ((unsigned int)q & 0x3ff) << (c * 10);
+					decoded[c] = glm_max((float)q / 511.0f, -1.0f);
+				}
+				memcpy(field, &word, sizeof(word));
+				break;
+			}
+			default:
+				memcpy(field, value, attrib->components * sizeof(float));
+				memcpy(decoded, value, attrib->components * sizeof(float));
+				break;
+			}
+
+			for (c = 0; c < attrib->components; c++) {
+				float error = fabsf(decoded[c] - value[c]);
+				if (error > attrib->maxError) attrib->maxError = error;
+			}
+		}
+	}
+}
+
+void lgl_vertexFormatDequantize(const lgl_VertexFormat *fmt,
+				unsigned int location, mat4 dest)
+{
+	int i;
+
+	glm_mat4_identity(dest);
+	for (i = 0; i < fmt->attribCount; i++) {
+		const lgl_PackAttrib *attrib = &fmt->attribs[i];
+
+		if (attrib->location != location) continue;
+		if (attrib->format != LGL_PACK_SNORM16) return;
+
+		glm_translate_make(dest, (float *)attrib->center);
+		glm_scale(dest, (float *)attrib->extent);
+		return;
+	}
+}
+
+static void lgl__attribType(const lgl_PackAttrib *attrib, int *size,
+			    unsigned int *type, unsigned char *normalized)
+{
+	*size = attrib->components;
+	*normalized = GL_FALSE;
+
+	switch (attrib->format) {
+	case LGL_PACK_SNORM16:
+		*type = GL_SHORT;
+		*normalized = GL_TRUE;
+		break;
+	case LGL_PACK_HALF:
+		*type = GL_HALF_FLOAT;
+		break;
+	case LGL_PACK_UNORM8:
+		*size = 4;
+		*type = GL_UNSIGNED_BYTE;
+		*normalized = GL_TRUE;
+		break;
+	case LGL_PACK_SNORM10:
+		*size = 4;
+		*type = GL_INT_2_10_10_10_REV;
+		*normalized = GL_TRUE;
+		break;
+	default:
+		*type = GL_FLOAT;
+		break;
+	}
+}
+
+void lgl_vertexFormatApply(const lgl_VertexFormat *fmt, size_t baseOffset)
+{
+	int i;
+
+	for (i = 0; i < fmt->attribCount; i++) {
+		const lgl_PackAttrib *attrib = &fmt->attribs[i];
+		unsigned int type;
+		unsigned char normalized;
+		int size;
+
+		lgl__attribType(attrib, &size, &type, &normalized);
+		glVertexAttribPointer(attrib->location, size, type, normalized,
+				      fmt->stride,
+				      (void *)(baseOffset + attrib->offset));
+		glEnableVertexAttribArray(attrib->location);
+	}
+}
+
+void lgl_vertexFormatApplyBinding(const lgl_VertexFormat *fmt,
+				  unsigned int binding)
+{
+	int i;
+
+	for (i = 0; i < fmt->attribCount; i++) {
+		const lgl_PackAttrib *attrib = &fmt->attribs[i];
+		unsigned int type;
+		unsigned char normalized;
+		int size;
+
+		lgl__attribType(attrib, &size, &type, &normalized);
+		glVertexAttribFormat(attrib->location, size, type, normalized,
+				     attrib->offset);
+		glVertexAttribBinding(attrib->location, binding);
+		glEnableVertexAttribArray(attrib->location);
+	}
+}
+
+#endif /*LGL_VERTEX_PACK_IMPLEMENTATION*/
@@ -0,0 +1,152 @@
+#ifndef __LGL_WORKER_POOL__
+#define __LGL_WORKER_POOL__
+
+#include <pthread.h>
+
+/* A fixed set of worker threads that stay alive between jobs, so a
+ * per-frame parallel section pays a condition variable wake-up instead
+ * of thread creation. A job is one function called once per worker with
+ * the worker's index; the thread that runs the job works as worker 0
+ * and returns when every worker is done. Link with -pthread.
+ *
+ * The pool must not move in memory between init and free, and jobs are
+ * run from one thread at a time. */
+
+#define LGL_WORKER_POOL_MAX 64
+
+typedef void (*lgl_WorkerFunc)(void *data, int index);
+
+typedef struct lgl_WorkerPool lgl_WorkerPool;
+
+typedef struct {
+	lgl_WorkerPool *pool;
+	int index;
+} lgl__WorkerSlot;
+
+struct lgl_WorkerPool {
+	int threadCount;          /* workers, including the calling thread */
+	pthread_t threads[LGL_WORKER_POOL_MAX];
+	lgl__WorkerSlot slots[LGL_WORKER_POOL_MAX];
+
+	pthread_mutex_t mutex;
+	pthread_cond_t start, done;
+	lgl_WorkerFunc func;
+	void *data;
+	unsigned long job;        /* counts the jobs started */
+	int busy;                 /* workers still running the current job */
+	int quit;
+};
+
+/* starts `threadCount` - 1 threads; returns the number of workers, which
+ * is smaller when threads could not be created, and at least 1 */
+int lgl_workerPoolInit(lgl_WorkerPool *pool, int threadCount);
+
+void lgl_workerPoolFree(lgl_WorkerPool *pool);
+
+/* calls func(data, index) for every worker index in parallel */
+void lgl_workerPoolRun(lgl_WorkerPool *pool, lgl_WorkerFunc func,
+		       void *data);
+
+#endif /*__LGL_WORKER_POOL__*/
+
+#ifdef LGL_WORKER_POOL_IMPLEMENTATION
+
+static void *lgl__workerMain(void *arg)
+{
+	lgl__WorkerSlot *slot = arg;
+	lgl_WorkerPool *pool = slot->pool;
+	unsigned long seen = 0;
+
+	for (;;) {
+		lgl_WorkerFunc func;
+		void *data;
+
+		pthread_mutex_lock(&pool->mutex);
+		while (pool->job == seen && !pool->quit)
+			pthread_cond_wait(&pool->start, &pool->mutex);
+		if (pool->quit) {
+			pthread_mutex_unlock(&pool->mutex);
+			return NULL;
+		}
+		seen = pool->job;
+		func = pool->func;
+		data = pool->data;
+		pthread_mutex_unlock(&pool->mutex);
+
+		func(data, slot->index);
+
+		pthread_mutex_lock(&pool->mutex);
+		if (--pool->busy == 0) pthread_cond_signal(&pool->done);
+		pthread_mutex_unlock(&pool->mutex);
+	}
+}
+
+int lgl_workerPoolInit(lgl_WorkerPool *pool, int threadCount)
+{
+	int i;
+
+	if (threadCount > LGL_WORKER_POOL_MAX)
+		threadCount = LGL_WORKER_POOL_MAX;
+
+	pthread_mutex_init(&pool->mutex, NULL);
+	pthread_cond_init(&pool->start, NULL);
+	pthread_cond_init(&pool->done, NULL);
+	pool->func = NULL;
+	pool->data = NULL;
+	pool->job = 0;
+	pool->busy = 0;
+	pool->quit = 0;
+
+	pool->threadCount = 1;
+	for (i = 1; i < threadCount; i++) {
+		lgl__WorkerSlot *slot = &pool->slots[pool->threadCount];
+
+		slot->pool = pool;
+		slot->index = pool->threadCount;
+		if (pthread_create(&pool->threads[pool->threadCount], NULL,
+				   lgl__workerMain, slot) != 0)
+			break;
+		pool->threadCount++;
+	}
+
+	return pool->threadCount;
+}
+
+void lgl_workerPoolFree(lgl_WorkerPool *pool)
+{
+	int i;
+
+	pthread_mutex_lock(&pool->mutex);
+	pool->quit = 1;
+	pthread_cond_broadcast(&pool->start);
+	pthread_mutex_unlock(&pool->mutex);
+
+	for (i = 1; i < pool->threadCount; i++)
+		pthread_join(pool->threads[i], NULL);
+	pool->threadCount = 0;
+
+	pthread_cond_destroy(&pool->done);
+	pthread_cond_destroy(&pool->start);
+	pthread_mutex_destroy(&pool->mutex);
+}
+
+void lgl_workerPoolRun(lgl_WorkerPool *pool, lgl_WorkerFunc func,
+		       void *data)
+{
+	pthread_mutex_lock(&pool->mutex);
+	pool->func = func;
+	pool->data = data;
+	pool->busy = pool->threadCount - 1;
+	pool->job++;
+	pthread_cond_broadcast(&pool->start);
+	pthread_mutex_unlock(&pool->mutex);
+
+	func(data, 0);
+
+	pthread_mutex_lock(&pool->mutex);
+	while (pool->busy > 0)
+		pthread_cond_wait(&pool->done, &pool->mutex);
+	pthread_mutex_unlock(&pool->mutex);
+}
+
+#endif /*LGL_WORKER_POOL_IMPLEMENTATION*/
@@ -0,0 +1,279 @@
+#include <glad/glad.h>
+
+#define LGL_PLATFORM_IMPLEMENTATION
+#include <lgl_platform.h>
+
+#include <cglm/cglm.h>
+
+#define LGL_SHADER_IMPLEMENTATION
+#include <lgl_shader.h>
+
+#define LGL_OCCLUSION_IMPLEMENTATION
+#include <lgl_occlusion.h>
+
+#define LGL_INDEX_BUFFER_IMPLEMENTATION
+#include <lgl_index_buffer.h>
+
+#include <stdio.h>
+
+#define goto_defer(value) do { exitCode = (value); goto defer; } while(0)
+
+/* a dense field of small cubes behind a few large walls */
+#define GRID_X 48
+#define GRID_Z 48
+#define OBJECT_COUNT (GRID_X * GRID_Z)
+#define WALL_COUNT 3
+
+#define OCCLUSION_WIDTH 256
+#define OCCLUSION_HEIGHT 192
+
+static void onWindowResize(GLFWwindow *window, int width, int height)
+{
+	(void)window;
+	glViewport(0, 0, width, height);
+}
+
+int main(void)
+{
+	int exitCode = 0, glLoaded = 0, shouldQuit = 0;
+	GLFWwindow *window = NULL;
+
+	unsigned int vertexShader, fragmentShader, shaderProgram;
+	int linked;
+	unsigned int VAO, buffers[2]; /* two buffers - VBO and EBO */
+
+	float vertices[] = {
+		-0.5f, -0.5f, -0.5f,
+		0.5f, -0.5f, -0.5f,
+		0.5f,  0.5f, -0.5f,
+		-0.5f,  0.5f, -0.5f,
+		-0.5f, -0.5f,  0.5f,
+		0.5f, -0.5f,  0.5f,
+		0.5f,  0.5f,  0.5f,
+		-0.5f,  0.5f,  0.5f
+	};
+	unsigned int indices[] = {
+		4, 5, 6,  6, 7, 4, /* front */
+		1, 0, 3,  3, 2, 1, /* back */
+		0, 4, 7,  7, 3, 0, /* left */
+		5, 1, 2,  2, 6, 5, /* right */
+		7, 6, 2,  2, 3, 7, /* top */
+		0, 1, 5,  5, 4, 0  /* bottom */
+	};
+
+	vec3 wallPositions[WALL_COUNT] = {
+		{-7.0f, 2.0f, -10.0f}, {0.0f, 2.0f, -10.0f}, {7.0f, 2.0f, -10.0f}
+	};
+	vec3 wallScale = {6.0f, 8.0f, 1.0f};
+	mat4 wallModels[WALL_COUNT];
+	vec3 objectPositions[OBJECT_COUNT];
+
+	lgl_IndexBuffer cubeIndices = {0};
+	lgl_OcclusionBuffer occlusion = {0};
+	int cullingEnabled = 1, spaceWasDown = 0;
+	int mvpLocation, colorLocation;
+
+	/* statistics of the current report interval */
+	double reportStart = 0.0, cullSeconds = 0.0;
+	unsigned long frames = 0, drawCalls = 0;
+
+	if (!lgl_occlusionInit(&occlusion, OCCLUSION_WIDTH, OCCLUSION_HEIGHT)
+	    || !lgl_indexBufferBuild(&cubeIndices, indices, 36, 8)) {
+		fprintf(stderr, "Failed to allocate the scene\n");
+		goto_defer(-1);
+	}
+
+	glfwInit();
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 6);
+	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+	window = glfwCreateWindow(800, 600, "LearnOpenGL", NULL, NULL);
+	if (!window) {
+		fprintf(stderr, "Failed to create window!\n");
+		goto_defer(-1);
+	}
+	glfwMakeContextCurrent(window);
+
+	if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+		fprintf(stderr, "Failed to load OpenGL\n");
+		goto_defer(-1);
+	}
+	glLoaded = 1;
+	glfwSetFramebufferSizeCallback(window, onWindowResize);
+
+	/* shaders
+	 ***********/
+	vertexShader = glCreateShader(GL_VERTEX_SHADER);
+	lgl_compileShader(vertexShader, "shaders/vertex.glsl");
+
+	fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+	lgl_compileShader(fragmentShader, "shaders/fragment.glsl");
+
+	shaderProgram = glCreateProgram();
+	glAttachShader(shaderProgram, vertexShader);
+	glAttachShader(shaderProgram, fragmentShader);
+	linked = lgl_linkProgram(shaderProgram);
+
+	glDeleteShader(vertexShader);
+	glDeleteShader(fragmentShader);
+	if (!linked) goto_defer(-1);
+
+	/* VAO and buffers
+	 *******************/
+	glGenVertexArrays(1, &VAO);
+	glGenBuffers(2, buffers);
+
+	glBindVertexArray(VAO);
+	glBindBuffer(GL_ARRAY_BUFFER, buffers[0]);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers[1]);
+
+	glBufferData(GL_ARRAY_BUFFER, sizeof(vertices),
+		     vertices, GL_STATIC_DRAW);
+	lgl_indexBufferUpload(&cubeIndices, GL_STATIC_DRAW);
+
+	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE,
+			      3 * sizeof(float), (void *)0);
+	glEnableVertexAttribArray(0);
+
+	/* scene
+	 *********/
+	{
+		int i, x, z;
+
+		for (i = 0; i < WALL_COUNT; i++) {
+			glm_translate_make(wallModels[i], wallPositions[i]);
+			glm_scale(wallModels[i], wallScale);
+		}
+
+		for (z = 0; z < GRID_Z; z++) {
+			for (x = 0; x < GRID_X; x++) {
+				float *p = objectPositions[z * GRID_X + x];
+				p[0] = (float)x - GRID_X * 0.5f;
+				p[1] = (float)((x * 7 + z * 3) % 5) - 1.0f;
+				p[2] = -14.0f - (float)z * 1.5f;
+			}
+		}
+	}
+
+	mvpLocation = glGetUniformLocation(shaderProgram, "mvp");
+	colorLocation = glGetUniformLocation(shaderProgram, "color");
+
+	glEnable(GL_DEPTH_TEST);
+	glEnable(GL_CULL_FACE);
+
+	printf("Press SPACE to toggle occlusion culling\n");
+	reportStart = glfwGetTime();
+
+	while (!shouldQuit) {
+		mat4 view, projection, viewProj, model, mvp;
+		double time = glfwGetTime(), cullStart;
+		int i, spaceDown;
+
+		if (glfwWindowShouldClose(window)) shouldQuit = 1;
+		if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
+			shouldQuit = 1;
+
+		spaceDown = glfwGetKey(window, GLFW_KEY_SPACE) == GLFW_PRESS;
+		if (spaceDown && !spaceWasDown) {
+			cullingEnabled = !cullingEnabled;
+			printf("Occlusion culling %s\n", cullingEnabled ? "on" : "off");
+		}
+		spaceWasDown = spaceDown;
+
+		/* camera
+		 **********/
+		{
+			float sway = (float)sin(time * 0.3) * 6.0f;
+			glm_lookat((vec3){sway, 1.5f, 6.0f},
+				   (vec3){sway * 0.5f, 1.0f, -30.0f},
+				   (vec3){0.0f, 1.0f, 0.0f}, view);
+			glm_perspective(glm_rad(45.0f), 800.0f / 600.0f,
+					0.1f, 200.0f, projection);
+			glm_mat4_mul(projection, view, viewProj);
+		}
+
+		/* occluders
+		 *************/
+		cullStart = glfwGetTime();
+		if (cullingEnabled) {
+			lgl_occlusionBegin(&occlusion, viewProj);
+			for (i = 0; i < WALL_COUNT; i++)
+				lgl_occlusionRasterize(&occlusion, wallModels[i],
+						       vertices, 3, indices, 36);
+			lgl_occlusionBuildHiZ(&occlusion);
+		}
+
+		/* rendering
+		 *************/
+		glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+		glUseProgram(shaderProgram);
+		glBindVertexArray(VAO);
+
+		glUniform3f(colorLocation, 0.6f, 0.6f, 0.6f);
+		for (i = 0; i < WALL_COUNT; i++) {
+			glm_mat4_mul(viewProj, wallModels[i], mvp);
+			glUniformMatrix4fv(mvpLocation, 1, GL_FALSE, mvp[0]);
+			lgl_indexBufferDraw(&cubeIndices);
+			drawCalls++;
+		}
+
+		glUniform3f(colorLocation, 1.0f, 0.5f, 0.2f);
+		for (i = 0; i < OBJECT_COUNT; i++) {
+			float *p = objectPositions[i];
+
+			if (cullingEnabled) {
+				vec3 min = {p[0] - 0.3f, p[1] - 0.3f, p[2] - 0.3f};
+				vec3 max = {p[0] + 0.3f, p[1] + 0.3f, p[2] + 0.3f};
+				if (!lgl_occlusionTestAABB(&occlusion, min, max))
+					continue;
+			}
+
+			glm_translate_make(model, p);
+			glm_scale_uni(model, 0.6f);
+			glm_mat4_mul(viewProj, model, mvp);
+
+			glUniformMatrix4fv(mvpLocation, 1, GL_FALSE, mvp[0]);
+			lgl_indexBufferDraw(&cubeIndices);
+			drawCalls++;
+		}
+		cullSeconds += glfwGetTime() - cullStart;
+
+		glfwPollEvents();
+		glfwSwapBuffers(window);
+
+		/* report
+		 **********/
+		frames++;
+		if (glfwGetTime() - reportStart >= 2.0) {
+			double elapsed = glfwGetTime() - reportStart;
+
+			printf("culling %-3s | %6.3f ms/frame | %6.3f ms cpu submit"
+			       " | %5lu draws/frame | %u/%d objects hidden\n",
+			       cullingEnabled ? "on" : "off",
+			       elapsed * 1000.0 / frames,
+			       cullSeconds * 1000.0 / frames,
+			       drawCalls / frames,
+			       cullingEnabled ? occlusion.objectsOccluded : 0,
+			       OBJECT_COUNT);
+
+			reportStart = glfwGetTime();
+			cullSeconds = 0.0;
+			frames = drawCalls = 0;
+		}
+	}
+
+ defer:
+	if (glLoaded) {
+		glDeleteProgram(shaderProgram);
+		glDeleteVertexArrays(1, &VAO);
+		glDeleteBuffers(2, buffers);
+	}
+	lgl_occlusionFree(&occlusion);
+	lgl_indexBufferFree(&cubeIndices);
+
+	glfwTerminate();
+	return exitCode;
+}
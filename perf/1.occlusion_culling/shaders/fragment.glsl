@@ -0,0 +1,10 @@
+#version 330 core
+
+in vec3 Shade;
+
+out vec4 FragColor;
+
+void main()
+{
+	FragColor = vec4(Shade, 1.0);
+}
@@ -0,0 +1,13 @@
+#version 330 core
+layout (location = 0) in vec3 aPos;
+
+out vec3 Shade;
+
+uniform mat4 mvp;
+uniform vec3 color;
+
+void main()
+{
+	Shade = color * (0.75 + 0.25 * aPos.y);
+	gl_Position = mvp * vec4(aPos, 1.0f);
+}
@@ -0,0 +1,220 @@
+#include <glad/glad.h>
+
+#define LGL_PLATFORM_IMPLEMENTATION
+#include <lgl_platform.h>
+
+#define LGL_SHADER_IMPLEMENTATION
+#include <lgl_shader.h>
+
+#define LGL_FRAME_SCHEDULER_IMPLEMENTATION
+#include <lgl_frame_scheduler.h>
+
+#include <math.h>
+#include <stdio.h>
+
+#define goto_defer(value) do { exitCode = (value); goto defer; } while(0)
+
+/* CPU and GPU load of a frame, both a few milliseconds */
+#define PARTICLE_COUNT 131072
+#define ITERATIONS 256
+#define FRAMES_IN_FLIGHT 2
+
+enum { MODE_UNPACED, MODE_LATENCY, MODE_THROUGHPUT, MODE_COUNT };
+static const char *modeNames[MODE_COUNT] = {
+	"unpaced", "latency", "throughput"
+};
+
+static void onWindowResize(GLFWwindow *window, int width, int height)
+{
+	(void)window;
+	glViewport(0, 0, width, height);
+}
+
+/* springs pulling particles to a moving target; returns their center */
+static void simulate(float (*particles)[4], float time, float *center)
+{
+	float target[2], sum[2] = {0.0f, 0.0f};
+	int i;
+
+	target[0] = -0.75f + 0.2f * cosf(time * 0.3f);
+	target[1] = 0.15f + 0.1f * sinf(time * 0.5f);
+
+	for (i = 0; i < PARTICLE_COUNT; i++) {
+		float *p = particles[i];
+		float stiffness = 0.01f + 0.05f * (float)i / PARTICLE_COUNT;
+
+		p[2] = p[2] * 0.98f + (target[0] - p[0]) * stiffness;
+		p[3] = p[3] * 0.98f + (target[1] - p[1]) * stiffness;
+		p[0] += p[2];
+		p[1] += p[3];
+		sum[0] += p[0];
+		sum[1] += p[1];
+	}
+
+	center[0] = sum[0] / PARTICLE_COUNT;
+	center[1] = sum[1] / PARTICLE_COUNT;
+}
+
+int main(void)
+{
+	int exitCode = 0, glLoaded = 0, shouldQuit = 0;
+	GLFWwindow *window = NULL;
+
+	unsigned int vertexShader, fragmentShader, shaderProgram = 0;
+	int linked;
+	unsigned int VAO = 0;
+	int centerLocation;
+
+	static float particles[PARTICLE_COUNT][4];
+	lgl_FrameScheduler frames;
+	double simStarts[LGL_FRAMES_MAX] = {0.0};
+
+	int mode = MODE_THROUGHPUT, spaceWasDown = 0;
+
+	/* statistics of the current report interval */
+	double reportStart = 0.0, simSeconds = 0.0, waitSeconds = 0.0;
+	double latencySeconds = 0.0;
+	unsigned long reportFrames = 0, latencySamples = 0, waitsAtStart = 0;
+
+	glfwInit();
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 6);
+	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+	window = glfwCreateWindow(800, 600, "LearnOpenGL", NULL, NULL);
+	if (!window) {
+		fprintf(stderr, "Failed to create window!\n");
+		goto_defer(-1);
+	}
+	glfwMakeContextCurrent(window);
+	glfwSwapInterval(0);
+
+	if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+		fprintf(stderr, "Failed to load OpenGL\n");
+		goto_defer(-1);
+	}
+	glLoaded = 1;
+	glfwSetFramebufferSizeCallback(window, onWindowResize);
+
+	/* shaders
+	 ***********/
+	vertexShader = glCreateShader(GL_VERTEX_SHADER);
+	lgl_compileShader(vertexShader, "shaders/vertex.glsl");
+
+	fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+	lgl_compileShader(fragmentShader, "shaders/fragment.glsl");
+
+	shaderProgram = glCreateProgram();
+	glAttachShader(shaderProgram, vertexShader);
+	glAttachShader(shaderProgram, fragmentShader);
+	linked = lgl_linkProgram(shaderProgram);
+
+	glDeleteShader(vertexShader);
+	glDeleteShader(fragmentShader);
+	if (!linked) goto_defer(-1);
+
+	glUseProgram(shaderProgram);
+	glUniform1i(glGetUniformLocation(shaderProgram, "iterations"), ITERATIONS);
+	centerLocation = glGetUniformLocation(shaderProgram, "center");
+
+	/* the triangle comes from gl_VertexID, but core needs a VAO bound */
+	glGenVertexArrays(1, &VAO);
+	glBindVertexArray(VAO);
+
+	lgl_frameSchedulerInit(&frames, LGL_FRAME_THROUGHPUT, FRAMES_IN_FLIGHT);
+
+	printf("press SPACE to cycle unpaced/latency/throughput pacing\n");
+	reportStart = glfwGetTime();
+
+	while (!shouldQuit) {
+		double waitStart, simStart;
+		unsigned long completed = frames.completed;
+		float center[2];
+		int spaceDown;
+
+		if (glfwWindowShouldClose(window)) shouldQuit = 1;
+		if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
+			shouldQuit = 1;
+
+		spaceDown = glfwGetKey(window, GLFW_KEY_SPACE) == GLFW_PRESS;
+		if (spaceDown && !spaceWasDown) {
+			mode = (mode + 1) % MODE_COUNT;
+			frames.mode = mode == MODE_LATENCY
+				? LGL_FRAME_LATENCY : LGL_FRAME_THROUGHPUT;
+			printf("Pacing for %s\n", modeNames[mode]);
+		}
+		spaceWasDown = spaceDown;
+
+		/* pacing
+		 **********/
+		waitStart = glfwGetTime();
+		if (mode != MODE_UNPACED) {
+			lgl_frameBegin(&frames);
+
+			/* from simulation start to the GPU finishing the frame,
+			 * as far as the fences can tell */
+			while (completed < frames.completed) {
+				completed++;
+				latencySeconds += glfwGetTime()
+					- simStarts[completed % LGL_FRAMES_MAX];
+				latencySamples++;
+			}
+		}
+		waitSeconds += glfwGetTime() - waitStart;
+
+		/* simulation
+		 **************/
+		simStart = glfwGetTime();
+		simStarts[frames.frame % LGL_FRAMES_MAX] = simStart;
+		simulate(particles, (float)simStart, center);
+		simSeconds += glfwGetTime() - simStart;
+
+		/* rendering
+		 *************/
+		glUseProgram(shaderProgram);
+		glUniform2fv(centerLocation, 1, center);
+		glBindVertexArray(VAO);
+		glDrawArrays(GL_TRIANGLES, 0, 3);
+
+		if (mode != MODE_UNPACED) lgl_frameEnd(&frames);
+
+		glfwPollEvents();
+		glfwSwapBuffers(window);
+
+		reportFrames++;
+		if (glfwGetTime() - reportStart >= 2.0) {
+			double elapsed = glfwGetTime() - reportStart;
+
+			printf("%-10s | %7.3f ms/frame | %7.3f ms simulate"
+			       " | %7.3f ms paced wait | %3lu waits",
+			       modeNames[mode],
+			       elapsed * 1000.0 / reportFrames,
+			       simSeconds * 1000.0 / reportFrames,
+			       waitSeconds * 1000.0 / reportFrames,
+			       frames.waits - waitsAtStart);
+			if (latencySamples)
+				printf(" | %7.3f ms latency\n",
+				       latencySeconds * 1000.0 / latencySamples);
+			else
+				printf(" |     unknown latency\n");
+
+			reportStart = glfwGetTime();
+			simSeconds = 0.0;
+			waitSeconds = 0.0;
+			latencySeconds = 0.0;
+			reportFrames = 0;
+			latencySamples = 0;
+			waitsAtStart = frames.waits;
+		}
+	}
+
+ defer:
+	if (glLoaded) {
+		glDeleteProgram(shaderProgram);
+		glDeleteVertexArrays(1, &VAO);
+		lgl_frameSchedulerFree(&frames);
+	}
+
+	glfwTerminate();
+	return exitCode;
+}
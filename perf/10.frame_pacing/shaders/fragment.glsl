@@ -0,0 +1,23 @@
+#version 330 core
+
+in vec2 Position;
+
+out vec4 FragColor;
+
+uniform vec2 center;
+uniform int iterations;
+
+/* a Julia set, `iterations` sets the GPU load */
+void main()
+{
+	vec2 z = Position * vec2(1.6, 1.2);
+	int i;
+
+	for (i = 0; i < iterations; i++) {
+		z = vec2(z.x * z.x - z.y * z.y, 2.0 * z.x * z.y) + center;
+		if (dot(z, z) > 4.0) break;
+	}
+
+	FragColor = vec4(vec3(float(i) / float(iterations)) * vec3(0.4, 0.7, 1.0),
+			 1.0);
+}
@@ -0,0 +1,10 @@
+#version 330 core
+
+out vec2 Position;
+
+/* one triangle covering the screen, no vertex buffer needed */
+void main()
+{
+	Position = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2) * 2.0 - 1.0;
+	gl_Position = vec4(Position, 0.0, 1.0);
+}
@@ -0,0 +1,260 @@
+#include <glad/glad.h>
+
+#define LGL_PLATFORM_IMPLEMENTATION
+#include <lgl_platform.h>
+
+#define LGL_SHADER_IMPLEMENTATION
+#include <lgl_shader.h>
+
+#define LGL_DSA_IMPLEMENTATION
+#include <lgl_dsa.h>
+
+#define LGL_VERTEX_LAYOUT_IMPLEMENTATION
+#include <lgl_vertex_layout.h>
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#define goto_defer(value) do { exitCode = (value); goto defer; } while(0)
+
+/* many small meshes with their own buffers in a handful of layouts */
+#define GRID 32
+#define MESH_COUNT (GRID * GRID)
+#define MAX_SIDES 8
+#define LAYOUT_COUNT 3
+
+enum { MODE_PER_MESH, MODE_CACHED, MODE_COUNT };
+static const char *modeNames[MODE_COUNT] = {"per-mesh", "cached"};
+
+enum { LAYOUT_POSITION, LAYOUT_COLOR, LAYOUT_TEXCOORD };
+
+typedef struct {
+	int layout, sides;
+	unsigned int VBO, EBO;
+	unsigned int VAO; /* its own, for MODE_PER_MESH */
+} Mesh;
+
+static void onWindowResize(GLFWwindow *window, int width, int height)
+{
+	(void)window;
+	glViewport(0, 0, width, height);
+}
+
+static void describeLayouts(lgl_VertexLayout *layouts)
+{
+	int i;
+
+	for (i = 0; i < LAYOUT_COUNT; i++) {
+		lgl_vertexLayoutInit(&layouts[i]);
+		lgl_vertexLayoutAdd(&layouts[i], 0, 3, GL_FLOAT, GL_FALSE);
+	}
+	lgl_vertexLayoutAdd(&layouts[LAYOUT_COLOR], 1, 4,
+			    GL_UNSIGNED_BYTE, GL_TRUE);
+	lgl_vertexLayoutAdd(&layouts[LAYOUT_TEXCOORD], 2, 2,
+			    GL_UNSIGNED_SHORT, GL_TRUE);
+}
+
+/* a regular polygon at its grid cell, written in its layout */
+static void createMesh(Mesh *mesh, int index, const lgl_VertexLayout *layout)
+{
+	unsigned char vertices[MAX_SIDES * 16];
+	unsigned char indices[MAX_SIDES];
+	float center[2];
+	int i;
+
+	center[0] = ((index % GRID) + 0.5f) * 2.0f / GRID - 1.0f;
+	center[1] = ((index / GRID) + 0.5f) * 2.0f / GRID - 1.0f;
+
+	for (i = 0; i < mesh->sides; i++) {
+		unsigned char *vertex = vertices + i * layout->stride;
+		float angle = 6.2831853f * i / mesh->sides;
+		float position[3];
+
+		position[0] = center[0] + cosf(angle) * 0.9f / GRID;
+		position[1] = center[1] + sinf(angle) * 0.9f / GRID;
+		position[2] = 0.0f;
+		memcpy(vertex, position, sizeof(position));
+
+		if (mesh->layout == LAYOUT_COLOR) {
+			vertex[12] = (unsigned char)(127 + 127 * cosf(angle));
+			vertex[13] = (unsigned char)(index * 7);
+			vertex[14] = (unsigned char)(127 + 127 * sinf(angle));
+			vertex[15] = 255;
+		} else if (mesh->layout == LAYOUT_TEXCOORD) {
+			unsigned short texCoord[2];
+
+			texCoord[0] = (unsigned short)(32767 + 32767 * cosf(angle));
+			texCoord[1] = (unsigned short)(32767 + 32767 * sinf(angle));
+			memcpy(vertex + 12, texCoord, sizeof(texCoord));
+		}
+
+		indices[i] = (unsigned char)i;
+	}
+
+	mesh->VBO = lgl_createBuffer(mesh->sides * layout->stride, vertices, 0);
+	mesh->EBO = lgl_createBuffer(mesh->sides, indices, 0);
+}
+
+int main(void)
+{
+	int exitCode = 0, glLoaded = 0, shouldQuit = 0;
+	GLFWwindow *window = NULL;
+
+	unsigned int vertexShader, fragmentShader, shaderProgram = 0;
+	int linked;
+
+	lgl_VertexLayout layouts[LAYOUT_COUNT];
+	lgl_VaoCache vaoCache = {0};
+	static Mesh meshes[MESH_COUNT];
+
+	int mode = MODE_CACHED, spaceWasDown = 0;
+	int i;
+
+	/* statistics of the current report interval */
+	double reportStart = 0.0, submitSeconds = 0.0;
+	unsigned long frames = 0;
+
+	glfwInit();
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 6);
+	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+	window = glfwCreateWindow(800, 600, "LearnOpenGL", NULL, NULL);
+	if (!window) {
+		fprintf(stderr, "Failed to create window!\n");
+		goto_defer(-1);
+	}
+	glfwMakeContextCurrent(window);
+	glfwSwapInterval(0);
+
+	if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+		fprintf(stderr, "Failed to load OpenGL\n");
+		goto_defer(-1);
+	}
+	glLoaded = 1;
+	glfwSetFramebufferSizeCallback(window, onWindowResize);
+
+	/* shaders
+	 ***********/
+	vertexShader = glCreateShader(GL_VERTEX_SHADER);
+	lgl_compileShader(vertexShader, "shaders/vertex.glsl");
+
+	fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+	lgl_compileShader(fragmentShader, "shaders/fragment.glsl");
+
+	shaderProgram = glCreateProgram();
+	glAttachShader(shaderProgram, vertexShader);
+	glAttachShader(shaderProgram, fragmentShader);
+	linked = lgl_linkProgram(shaderProgram);
+
+	glDeleteShader(vertexShader);
+	glDeleteShader(fragmentShader);
+	if (!linked) goto_defer(-1);
+
+	/* meshes
+	 **********/
+	describeLayouts(layouts);
+	if (!lgl_vaoCacheInit(&vaoCache, LAYOUT_COUNT)) {
+		fprintf(stderr, "Failed to allocate the VAO cache\n");
+		goto_defer(-1);
+	}
+
+	for (i = 0; i < MESH_COUNT; i++) {
+		const lgl_VertexLayout *layout;
+		int j;
+
+		meshes[i].layout = i * 7 % LAYOUT_COUNT;
+		meshes[i].sides = 3 + i % (MAX_SIDES - 2);
+		layout = &layouts[meshes[i].layout];
+		createMesh(&meshes[i], i, layout);
+
+		/* the old way, every mesh describes its own VAO */
+		meshes[i].VAO = lgl_createVertexArray();
+		lgl_vertexArrayBuffers(meshes[i].VAO, 0, meshes[i].VBO, 0,
+				       layout->stride, meshes[i].EBO);
+		for (j = 0; j < layout->attribCount; j++)
+			lgl_vertexArrayAttrib(meshes[i].VAO,
+					      layout->attribs[j].location,
+					      layout->attribs[j].size,
+					      layout->attribs[j].type,
+					      layout->attribs[j].normalized,
+					      layout->attribs[j].offset, 0);
+	}
+
+	printf("%d meshes in %d layouts, press SPACE to toggle"
+	       " per-mesh/cached VAOs\n", MESH_COUNT, LAYOUT_COUNT);
+	reportStart = glfwGetTime();
+
+	while (!shouldQuit) {
+		double submitStart;
+		int spaceDown;
+
+		if (glfwWindowShouldClose(window)) shouldQuit = 1;
+		if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
+			shouldQuit = 1;
+
+		spaceDown = glfwGetKey(window, GLFW_KEY_SPACE) == GLFW_PRESS;
+		if (spaceDown && !spaceWasDown) {
+			mode = (mode + 1) % MODE_COUNT;
+			printf("Drawing with %s VAOs\n", modeNames[mode]);
+		}
+		spaceWasDown = spaceDown;
+
+		/* rendering
+		 *************/
+		glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+		glClear(GL_COLOR_BUFFER_BIT);
+
+		submitStart = glfwGetTime();
+		glUseProgram(shaderProgram);
+
+		for (i = 0; i < MESH_COUNT; i++) {
+			const Mesh *mesh = &meshes[i];
+
+			if (mode == MODE_CACHED)
+				lgl_vaoCacheBind(&vaoCache, &layouts[mesh->layout],
+						 mesh->VBO, 0, mesh->EBO);
+			else
+				glBindVertexArray(mesh->VAO);
+
+			glDrawElements(GL_TRIANGLE_FAN, mesh->sides,
+				       GL_UNSIGNED_BYTE, 0);
+		}
+
+		submitSeconds += glfwGetTime() - submitStart;
+
+		glfwPollEvents();
+		glfwSwapBuffers(window);
+
+		frames++;
+		if (glfwGetTime() - reportStart >= 2.0) {
+			double elapsed = glfwGetTime() - reportStart;
+
+			printf("%-8s | %7.3f ms/frame | %7.3f ms cpu submit"
+			       " | %4d VAOs\n",
+			       modeNames[mode],
+			       elapsed * 1000.0 / frames,
+			       submitSeconds * 1000.0 / frames,
+			       mode == MODE_CACHED ? vaoCache.count : MESH_COUNT);
+
+			reportStart = glfwGetTime();
+			submitSeconds = 0.0;
+			frames = 0;
+		}
+	}
+
+ defer:
+	if (glLoaded) {
+		glDeleteProgram(shaderProgram);
+		for (i = 0; i < MESH_COUNT; i++) {
+			glDeleteVertexArrays(1, &meshes[i].VAO);
+			glDeleteBuffers(1, &meshes[i].VBO);
+			glDeleteBuffers(1, &meshes[i].EBO);
+		}
+		lgl_vaoCacheFree(&vaoCache);
+	}
+
+	glfwTerminate();
+	return exitCode;
+}
@@ -0,0 +1,11 @@
+#version 330 core
+
+in vec4 Color;
+in vec2 TexCoord;
+
+out vec4 FragColor;
+
+void main()
+{
+	FragColor = vec4(0.2 + Color.rgb + vec3(TexCoord, 0.5) * 0.6, 1.0);
+}
@@ -0,0 +1,14 @@
+#version 330 core
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec4 aColor;    /* (0, 0, 0, 1) when not in the layout */
+layout (location = 2) in vec2 aTexCoord;
+
+out vec4 Color;
+out vec2 TexCoord;
+
+void main()
+{
+	Color = aColor;
+	TexCoord = aTexCoord;
+	gl_Position = vec4(aPos, 1.0);
+}
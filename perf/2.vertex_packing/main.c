@@ -0,0 +1,360 @@
+#include <glad/glad.h>
+
+#define LGL_PLATFORM_IMPLEMENTATION
+#include <lgl_platform.h>
+
+#include <cglm/cglm.h>
+
+#define LGL_SHADER_IMPLEMENTATION
+#include <lgl_shader.h>
+
+#define LGL_VERTEX_PACK_IMPLEMENTATION
+#include <lgl_vertex_pack.h>
+
+#define LGL_MESH_OPT_IMPLEMENTATION
+#include <lgl_mesh_opt.h>
+
+#define LGL_INDEX_BUFFER_IMPLEMENTATION
+#include <lgl_index_buffer.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define goto_defer(value) do { exitCode = (value); goto defer; } while(0)
+
+/* a finely tessellated sphere, drawn a few times per frame */
+#define STACKS 256
+#define SLICES 256
+#define VERTEX_COUNT ((STACKS + 1) * (SLICES + 1))
+#define INDEX_COUNT (STACKS * SLICES * 6)
+#define GRID 4
+
+/* position, normal, texture coords, color */
+#define FLOATS_PER_VERTEX 12
+
+/* the compressed sphere indices, written on the first run */
+#define INDEX_FILE "sphere.lgli"
+
+#if defined(__SSSE3__)
+#define INDEX_DECODER "SSSE3"
+#else
+#define INDEX_DECODER "scalar"
+#endif
+
+static void onWindowResize(GLFWwindow *window, int width, int height)
+{
+	(void)window;
+	glViewport(0, 0, width, height);
+}
+
+static void buildSphere(float *vertices, unsigned int *indices)
+{
+	int stack, slice;
+
+	for (stack = 0; stack <= STACKS; stack++) {
+		float v = (float)stack / STACKS;
+		float phi = v * GLM_PIf;
+
+		for (slice = 0; slice <= SLICES; slice++) {
+			float u = (float)slice / SLICES;
+			float theta = u * 2.0f * GLM_PIf;
+			float *vertex = vertices
+				+ (stack * (SLICES + 1) + slice) * FLOATS_PER_VERTEX;
+
+			vertex[3] = sinf(phi) * cosf(theta);
+			vertex[4] = cosf(phi);
+			vertex[5] = sinf(phi) * sinf(theta);
+			vertex[0] = vertex[3] * 0.45f;
+			vertex[1] = vertex[4] * 0.45f;
+			vertex[2] = vertex[5] * 0.45f;
+			vertex[6] = u;
+			vertex[7] = v;
+			vertex[8] = 0.5f + 0.5f * vertex[3];
+			vertex[9] = 0.5f + 0.5f * vertex[4];
+			vertex[10] = 0.5f + 0.5f * vertex[5];
+			vertex[11] = 1.0f;
+		}
+	}
+
+	for (stack = 0; stack < STACKS; stack++) {
+		for (slice = 0; slice < SLICES; slice++) {
+			unsigned int a = stack * (SLICES + 1) + slice;
+			unsigned int b = a + SLICES + 1;
+
+			*indices++ = a; *indices++ = a + 1; *indices++ = b;
+			*indices++ = b; *indices++ = a + 1; *indices++ = b + 1;
+		}
+	}
+}
+
+static int sameIndices(const lgl_IndexBuffer *a, const lgl_IndexBuffer *b)
+{
+	return a->mode == b->mode && a->type == b->type && a->count == b->count
+		&& !memcmp(a->data, b->data, lgl_indexBufferSize(a));
+}
+
+/* loads the sphere's indices the way an asset would arrive, through the
+ * compressed file and its decoder, and checks them against `built`; the
+ * file is (re)written when it is missing or stale */
+static int loadIndices(lgl_IndexBuffer *ib, const lgl_IndexBuffer *built)
+{
+	int attempt;
+
+	for (attempt = 0; attempt < 2; attempt++) {
+		clock_t start = clock();
+
+		if (lgl_indexBufferLoad(ib, INDEX_FILE) && sameIndices(ib, built)) {
+			printf("%s: %d %s indices decoded in %.3f ms (%s)\n",
+			       INDEX_FILE, ib->count,
+			       ib->mode == GL_TRIANGLES ? "list" : "strip",
+			       (clock() - start) * 1000.0 / CLOCKS_PER_SEC,
+			       INDEX_DECODER);
+			return 1;
+		}
+		lgl_indexBufferFree(ib);
+		if (attempt == 0 && !lgl_indexBufferSave(built, INDEX_FILE))
+			break;
+	}
+	return 0;
+}
+
+/* uploads the sphere with `fmt` into a new VAO sharing the index buffer */
+static int uploadMesh(lgl_VertexFormat *fmt, const float *vertices,
+		      int vertexCount, unsigned int EBO,
+		      unsigned int *VAO, unsigned int *VBO)
+{
+	void *packed = malloc(lgl_vertexPackSize(fmt, vertexCount));
+
+	if (!packed) return 0;
+	lgl_vertexPack(fmt, vertices, vertexCount, packed);
+
+	glGenVertexArrays(1, VAO);
+	glGenBuffers(1, VBO);
+
+	glBindVertexArray(*VAO);
+	glBindBuffer(GL_ARRAY_BUFFER, *VBO);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+
+	glBufferData(GL_ARRAY_BUFFER, lgl_vertexPackSize(fmt, vertexCount),
+		     packed, GL_STATIC_DRAW);
+	lgl_vertexFormatApply(fmt, 0);
+
+	free(packed);
+	return 1;
+}
+
+static void describeFormat(const char *name, const lgl_VertexFormat *fmt,
+			   int vertexCount)
+{
+	int i;
+
+	printf("%s: %d bytes per vertex, %.2f MiB\n", name, fmt->stride,
+	       lgl_vertexPackSize(fmt, vertexCount) / (1024.0 * 1024.0));
+	for (i = 0; i < fmt->attribCount; i++)
+		printf("  attribute %u max error %g\n",
+		       fmt->attribs[i].location, fmt->attribs[i].maxError);
+}
+
+int main(void)
+{
+	int exitCode = 0, glLoaded = 0, shouldQuit = 0;
+	GLFWwindow *window = NULL;
+
+	unsigned int vertexShader, fragmentShader, shaderProgram;
+	int linked;
+	unsigned int VAO[2], VBO[2], EBO; /* full floats and packed */
+	lgl_VertexFormat formats[2];
+
+	float *vertices = NULL;
+	unsigned int *indices = NULL;
+	int vertexCount = VERTEX_COUNT;
+	lgl_MeshStats statsBefore, statsAfter;
+	lgl_IndexBuffer builtIndices = {0}, sphereIndices = {0};
+
+	int usePacked = 1, spaceWasDown = 0;
+	int mvpLocation;
+
+	double reportStart = 0.0;
+	unsigned long frames = 0;
+
+	vertices = malloc(sizeof(float) * VERTEX_COUNT * FLOATS_PER_VERTEX);
+	indices = malloc(sizeof(unsigned int) * INDEX_COUNT);
+	if (!vertices || !indices) {
+		fprintf(stderr, "Failed to allocate the sphere\n");
+		goto_defer(-1);
+	}
+	buildSphere(vertices, indices);
+
+	vertexCount = lgl_meshOptimize(vertices, vertexCount, FLOATS_PER_VERTEX,
+				       indices, INDEX_COUNT,
+				       &statsBefore, &statsAfter);
+	lgl_meshPrintStats("sphere", &statsBefore, &statsAfter);
+
+	if (!lgl_indexBufferBuildStrips(&builtIndices, indices, INDEX_COUNT,
+					vertexCount)) {
+		fprintf(stderr, "Failed to allocate the sphere\n");
+		goto_defer(-1);
+	}
+	if (!loadIndices(&sphereIndices, &builtIndices)) {
+		fprintf(stderr, "Failed to load \"%s\"\n", INDEX_FILE);
+		goto_defer(-1);
+	}
+
+	glfwInit();
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 6);
+	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+	window = glfwCreateWindow(800, 600, "LearnOpenGL", NULL, NULL);
+	if (!window) {
+		fprintf(stderr, "Failed to create window!\n");
+		goto_defer(-1);
+	}
+	glfwMakeContextCurrent(window);
+
+	if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+		fprintf(stderr, "Failed to load OpenGL\n");
+		goto_defer(-1);
+	}
+	glLoaded = 1;
+	glfwSetFramebufferSizeCallback(window, onWindowResize);
+
+	/* shaders
+	 ***********/
+	vertexShader = glCreateShader(GL_VERTEX_SHADER);
+	lgl_compileShader(vertexShader, "shaders/vertex.glsl");
+
+	fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+	lgl_compileShader(fragmentShader, "shaders/fragment.glsl");
+
+	shaderProgram = glCreateProgram();
+	glAttachShader(shaderProgram, vertexShader);
+	glAttachShader(shaderProgram, fragmentShader);
+	linked = lgl_linkProgram(shaderProgram);
+
+	glDeleteShader(vertexShader);
+	glDeleteShader(fragmentShader);
+	if (!linked) goto_defer(-1);
+
+	/* vertex formats
+	 ******************/
+	lgl_vertexFormatInit(&formats[0]);
+	lgl_vertexFormatAdd(&formats[0], 0, 3, LGL_PACK_FLOAT);
+	lgl_vertexFormatAdd(&formats[0], 1, 3, LGL_PACK_FLOAT);
+	lgl_vertexFormatAdd(&formats[0], 2, 2, LGL_PACK_FLOAT);
+	lgl_vertexFormatAdd(&formats[0], 3, 4, LGL_PACK_FLOAT);
+	lgl_vertexFormatCompile(&formats[0]);
+
+	lgl_vertexFormatInit(&formats[1]);
+	lgl_vertexFormatAdd(&formats[1], 0, 3, LGL_PACK_SNORM16);
+	lgl_vertexFormatAdd(&formats[1], 1, 3, LGL_PACK_SNORM10);
+	lgl_vertexFormatAdd(&formats[1], 2, 2, LGL_PACK_HALF);
+	lgl_vertexFormatAdd(&formats[1], 3, 4, LGL_PACK_UNORM8);
+	lgl_vertexFormatCompile(&formats[1]);
+
+	/* VAOs and buffers
+	 ********************/
+	glGenBuffers(1, &EBO);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+	lgl_indexBufferUpload(&sphereIndices, GL_STATIC_DRAW);
+
+	if (!uploadMesh(&formats[0], vertices, vertexCount, EBO, &VAO[0], &VBO[0])
+	    || !uploadMesh(&formats[1], vertices, vertexCount, EBO, &VAO[1], &VBO[1])) {
+		fprintf(stderr, "Failed to upload the sphere\n");
+		goto_defer(-1);
+	}
+
+	describeFormat("float", &formats[0], vertexCount);
+	describeFormat("packed", &formats[1], vertexCount);
+	printf("Press SPACE to switch between the two formats\n");
+
+	mvpLocation = glGetUniformLocation(shaderProgram, "mvp");
+
+	glEnable(GL_DEPTH_TEST);
+	glEnable(GL_CULL_FACE);
+
+	reportStart = glfwGetTime();
+
+	while (!shouldQuit) {
+		mat4 view, projection, viewProj, dequantize;
+		int x, y, spaceDown;
+
+		if (glfwWindowShouldClose(window)) shouldQuit = 1;
+		if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
+			shouldQuit = 1;
+
+		spaceDown = glfwGetKey(window, GLFW_KEY_SPACE) == GLFW_PRESS;
+		if (spaceDown && !spaceWasDown) {
+			usePacked = !usePacked;
+			printf("Drawing %s vertices\n", usePacked ? "packed" : "float");
+		}
+		spaceWasDown = spaceDown;
+
+		glm_lookat((vec3){0.0f, 0.0f, 3.5f}, (vec3){0.0f, 0.0f, 0.0f},
+			   (vec3){0.0f, 1.0f, 0.0f}, view);
+		glm_perspective(glm_rad(45.0f), 800.0f / 600.0f,
+				0.1f, 100.0f, projection);
+		glm_mat4_mul(projection, view, viewProj);
+		lgl_vertexFormatDequantize(&formats[usePacked], 0, dequantize);
+
+		/* rendering
+		 *************/
+		glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+		glUseProgram(shaderProgram);
+		glBindVertexArray(VAO[usePacked]);
+
+		for (y = 0; y < GRID; y++) {
+			for (x = 0; x < GRID; x++) {
+				mat4 model, mvp;
+
+				glm_translate_make(model, (vec3){
+					(x - (GRID - 1) * 0.5f) * 0.9f,
+					(y - (GRID - 1) * 0.5f) * 0.9f, 0.0f});
+				glm_rotate(model, (float)glfwGetTime(),
+					   (vec3){0.0f, 1.0f, 0.0f});
+				glm_mat4_mul(model, dequantize, model);
+				glm_mat4_mul(viewProj, model, mvp);
+
+				glUniformMatrix4fv(mvpLocation, 1, GL_FALSE, mvp[0]);
+				lgl_indexBufferDraw(&sphereIndices);
+			}
+		}
+
+		glfwPollEvents();
+		glfwSwapBuffers(window);
+
+		frames++;
+		if (glfwGetTime() - reportStart >= 2.0) {
+			double elapsed = glfwGetTime() - reportStart;
+
+			printf("%-6s | %6.3f ms/frame | %6.1f MiB vertex fetch/frame\n",
+			       usePacked ? "packed" : "float",
+			       elapsed * 1000.0 / frames,
+			       GRID * GRID * lgl_vertexPackSize(&formats[usePacked],
+								vertexCount)
+			       / (1024.0 * 1024.0));
+
+			reportStart = glfwGetTime();
+			frames = 0;
+		}
+	}
+
+ defer:
+	if (glLoaded) {
+		glDeleteProgram(shaderProgram);
+		glDeleteVertexArrays(2, VAO);
+		glDeleteBuffers(2, VBO);
+		glDeleteBuffers(1, &EBO);
+	}
+	free(vertices);
+	free(indices);
+	lgl_indexBufferFree(&builtIndices);
+	lgl_indexBufferFree(&sphereIndices);
+
+	glfwTerminate();
+	return exitCode;
+}
@@ -0,0 +1,14 @@
+#version 330 core
+
+in vec3 Normal;
+in vec2 TexCoord;
+in vec4 Color;
+
+out vec4 FragColor;
+
+void main()
+{
+	float light = max(dot(normalize(Normal), normalize(vec3(0.4, 0.8, 0.6))), 0.1);
+	float checker = mod(floor(TexCoord.x * 32.0) + floor(TexCoord.y * 16.0), 2.0);
+	FragColor = vec4(Color.rgb * light * (0.7 + 0.3 * checker), Color.a);
+}
@@ -0,0 +1,19 @@
+#version 330 core
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aNormal;
+layout (location = 2) in vec2 aTexCoord;
+layout (location = 3) in vec4 aColor;
+
+out vec3 Normal;
+out vec2 TexCoord;
+out vec4 Color;
+
+uniform mat4 mvp;
+
+void main()
+{
+	Normal = aNormal;
+	TexCoord = aTexCoord;
+	Color = aColor;
+	gl_Position = mvp * vec4(aPos, 1.0f);
+}
@@ -0,0 +1,264 @@
+#include <glad/glad.h>
+
+#define LGL_PLATFORM_IMPLEMENTATION
+#include <lgl_platform.h>
+
+#include <cglm/cglm.h>
+
+#define LGL_SHADER_IMPLEMENTATION
+#include <lgl_shader.h>
+
+#define LGL_WORKER_POOL_IMPLEMENTATION
+#include <lgl_worker_pool.h>
+
+#define LGL_TRANSFORM_IMPLEMENTATION
+#include <lgl_transform.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define goto_defer(value) do { exitCode = (value); goto defer; } while(0)
+
+/* root -> hubs -> arms -> leaves, about 70k nodes */
+#define HUBS 64
+#define ARMS 32
+#define LEAVES 32
+#define NODE_COUNT (1 + HUBS + HUBS * ARMS + HUBS * ARMS * LEAVES)
+
+/* hubs spun every frame, the rest of the tree stays still */
+#define ANIMATED_HUBS 4
+#define THREAD_COUNT 4
+
+enum { MODE_DIRTY, MODE_FULL, MODE_PARALLEL, MODE_COUNT };
+static const char *modeNames[MODE_COUNT] = {"dirty", "full", "parallel"};
+
+static void onWindowResize(GLFWwindow *window, int width, int height)
+{
+	(void)window;
+	glViewport(0, 0, width, height);
+}
+
+/* fills `hubs` with the hub handles, returns 0 on failure */
+static int buildTree(lgl_TransformTree *tree, int *hubs)
+{
+	int root, hub, arm, leaf;
+
+	root = lgl_transformAdd(tree, -1);
+	if (root < 0) return 0;
+
+	for (hub = 0; hub < HUBS; hub++) {
+		float angle = hub * 2.0f * GLM_PIf / HUBS;
+		int hubNode = lgl_transformAdd(tree, root);
+
+		if (hubNode < 0) return 0;
+		hubs[hub] = hubNode;
+		lgl_transformSetPosition(tree, hubNode, (vec3){
+			cosf(angle) * 6.0f, ((hub % 8) - 3.5f) * 0.8f,
+			sinf(angle) * 6.0f});
+
+		for (arm = 0; arm < ARMS; arm++) {
+			versor rotation;
+			int armNode = lgl_transformAdd(tree, hubNode);
+
+			if (armNode < 0) return 0;
+			glm_quatv(rotation, arm * 2.0f * GLM_PIf / ARMS,
+				  (vec3){0.0f, 0.0f, 1.0f});
+			lgl_transformSetRotation(tree, armNode, rotation);
+
+			for (leaf = 0; leaf < LEAVES; leaf++) {
+				int leafNode = lgl_transformAdd(tree, armNode);
+
+				if (leafNode < 0) return 0;
+				lgl_transformSetPosition(tree, leafNode, (vec3){
+					0.1f + leaf * 0.03f, 0.0f, 0.0f});
+			}
+		}
+	}
+
+	return 1;
+}
+
+int main(void)
+{
+	int exitCode = 0, glLoaded = 0, shouldQuit = 0;
+	GLFWwindow *window = NULL;
+
+	unsigned int vertexShader, fragmentShader, shaderProgram;
+	int linked;
+	unsigned int VAO, VBO;
+
+	lgl_TransformTree tree = {0};
+	int hubs[HUBS];
+	float *points = NULL;
+
+	int mode = MODE_DIRTY, spaceWasDown = 0;
+	int viewProjLocation;
+	unsigned long frame = 0;
+
+	/* statistics of the current report interval */
+	double reportStart = 0.0, updateSeconds = 0.0;
+	unsigned long frames = 0, recomputed = 0;
+
+	points = malloc(sizeof(float) * 3 * NODE_COUNT);
+	if (!points || !lgl_transformInit(&tree, NODE_COUNT)
+	    || !buildTree(&tree, hubs)) {
+		fprintf(stderr, "Failed to allocate the scene\n");
+		goto_defer(-1);
+	}
+
+	glfwInit();
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 6);
+	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+	window = glfwCreateWindow(800, 600, "LearnOpenGL", NULL, NULL);
+	if (!window) {
+		fprintf(stderr, "Failed to create window!\n");
+		goto_defer(-1);
+	}
+	glfwMakeContextCurrent(window);
+
+	if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+		fprintf(stderr, "Failed to load OpenGL\n");
+		goto_defer(-1);
+	}
+	glLoaded = 1;
+	glfwSetFramebufferSizeCallback(window, onWindowResize);
+
+	/* shaders
+	 ***********/
+	vertexShader = glCreateShader(GL_VERTEX_SHADER);
+	lgl_compileShader(vertexShader, "shaders/vertex.glsl");
+
+	fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+	lgl_compileShader(fragmentShader, "shaders/fragment.glsl");
+
+	shaderProgram = glCreateProgram();
+	glAttachShader(shaderProgram, vertexShader);
+	glAttachShader(shaderProgram, fragmentShader);
+	linked = lgl_linkProgram(shaderProgram);
+
+	glDeleteShader(vertexShader);
+	glDeleteShader(fragmentShader);
+	if (!linked) goto_defer(-1);
+
+	/* VAO and buffer of the world positions
+	 *****************************************/
+	glGenVertexArrays(1, &VAO);
+	glGenBuffers(1, &VBO);
+
+	glBindVertexArray(VAO);
+	glBindBuffer(GL_ARRAY_BUFFER, VBO);
+	glBufferData(GL_ARRAY_BUFFER, sizeof(float) * 3 * NODE_COUNT,
+		     NULL, GL_STREAM_DRAW);
+	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void *)0);
+	glEnableVertexAttribArray(0);
+
+	viewProjLocation = glGetUniformLocation(shaderProgram, "viewProj");
+	glEnable(GL_DEPTH_TEST);
+	glEnable(GL_PROGRAM_POINT_SIZE);
+
+	printf("%d nodes, press SPACE to cycle dirty/full/parallel updates\n",
+	       tree.count);
+	reportStart = glfwGetTime();
+
+	while (!shouldQuit) {
+		double time = glfwGetTime(), updateStart;
+		mat4 view, projection, viewProj;
+		int i, spaceDown;
+
+		if (glfwWindowShouldClose(window)) shouldQuit = 1;
+		if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
+			shouldQuit = 1;
+
+		spaceDown = glfwGetKey(window, GLFW_KEY_SPACE) == GLFW_PRESS;
+		if (spaceDown && !spaceWasDown) {
+			mode = (mode + 1) % MODE_COUNT;
+			printf("Updating with %s\n", modeNames[mode]);
+		}
+		spaceWasDown = spaceDown;
+
+		/* animation
+		 *************/
+		updateStart = glfwGetTime();
+
+		for (i = 0; i < ANIMATED_HUBS; i++) {
+			int hub = (int)((frame / 60 + i * (HUBS / ANIMATED_HUBS)) % HUBS);
+			versor rotation;
+
+			glm_quatv(rotation, (float)time * 2.0f + hub,
+				  (vec3){0.3f, 1.0f, 0.0f});
+			glm_quat_normalize(rotation);
+			lgl_transformSetRotation(&tree, hubs[hub], rotation);
+		}
+
+		if (mode == MODE_DIRTY) {
+			recomputed += lgl_transformUpdate(&tree);
+		} else {
+			lgl_transformMarkAllDirty(&tree);
+			recomputed += mode == MODE_PARALLEL
+				? lgl_transformUpdateParallel(&tree, THREAD_COUNT)
+				: lgl_transformUpdate(&tree);
+		}
+
+		updateSeconds += glfwGetTime() - updateStart;
+
+		/* the translation column of every world matrix */
+		for (i = 0; i < tree.count; i++)
+			glm_vec3_copy(tree.world[i][3], &points[i * 3]);
+
+		glm_lookat((vec3){sinf((float)time * 0.1f) * 14.0f, 6.0f,
+				  cosf((float)time * 0.1f) * 14.0f},
+			   (vec3){0.0f, 0.0f, 0.0f}, (vec3){0.0f, 1.0f, 0.0f}, view);
+		glm_perspective(glm_rad(45.0f), 800.0f / 600.0f,
+				0.1f, 100.0f, projection);
+		glm_mat4_mul(projection, view, viewProj);
+
+		/* rendering
+		 *************/
+		glClearColor(0.1f, 0.1f, 0.15f, 1.0f);
+		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+		glUseProgram(shaderProgram);
+		glUniformMatrix4fv(viewProjLocation, 1, GL_FALSE, viewProj[0]);
+
+		glBindVertexArray(VAO);
+		glBindBuffer(GL_ARRAY_BUFFER, VBO);
+		glBufferSubData(GL_ARRAY_BUFFER, 0,
+				sizeof(float) * 3 * tree.count, points);
+		glDrawArrays(GL_POINTS, 0, tree.count);
+
+		glfwPollEvents();
+		glfwSwapBuffers(window);
+
+		frame++;
+		frames++;
+		if (glfwGetTime() - reportStart >= 2.0) {
+			double elapsed = glfwGetTime() - reportStart;
+
+			printf("%-8s | %6.3f ms/frame | %6.3f ms update"
+			       " | %7lu matrices/frame\n",
+			       modeNames[mode],
+			       elapsed * 1000.0 / frames,
+			       updateSeconds * 1000.0 / frames,
+			       recomputed / frames);
+
+			reportStart = glfwGetTime();
+			updateSeconds = 0.0;
+			frames = 0;
+			recomputed = 0;
+		}
+	}
+
+ defer:
+	if (glLoaded) {
+		glDeleteProgram(shaderProgram);
+		glDeleteVertexArrays(1, &VAO);
+		glDeleteBuffers(1, &VBO);
+	}
+	lgl_transformFree(&tree);
+	free(points);
+
+	glfwTerminate();
+	return exitCode;
+}
@@ -0,0 +1,13 @@
+#version 330 core
+layout (location = 0) in vec3 aPos;
+
+out vec3 Color;
+
+uniform mat4 viewProj;
+
+void main()
+{
+	Color = 0.5 + 0.5 * normalize(aPos + vec3(0.0, 0.0, 0.001));
+	gl_Position = viewProj * vec4(aPos, 1.0f);
+	gl_PointSize = 2.0;
+}
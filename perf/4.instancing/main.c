@@ -0,0 +1,270 @@
+#include <glad/glad.h>
+
+#define LGL_PLATFORM_IMPLEMENTATION
+#include <lgl_platform.h>
+
+#include <cglm/cglm.h>
+
+#define LGL_SHADER_IMPLEMENTATION
+#include <lgl_shader.h>
+
+#define LGL_INSTANCING_IMPLEMENTATION
+#include <lgl_instancing.h>
+
+#include <stdio.h>
+
+#define goto_defer(value) do { exitCode = (value); goto defer; } while(0)
+
+/* about 100k spinning quads */
+#define GRID 320
+#define QUAD_COUNT (GRID * GRID)
+
+enum { MODE_UNIFORM, MODE_MATRIX, MODE_TRS, MODE_SSBO, MODE_COUNT };
+static const char *modeNames[MODE_COUNT] = {"uniform", "matrix", "trs", "ssbo"};
+static const char *vertexShaders[MODE_COUNT] = {
+	"shaders/vertex_uniform.glsl", "shaders/vertex_matrix.glsl",
+	"shaders/vertex_trs.glsl", "shaders/vertex_ssbo.glsl"
+};
+
+static void onWindowResize(GLFWwindow *window, int width, int height)
+{
+	(void)window;
+	glViewport(0, 0, width, height);
+}
+
+static unsigned int createProgram(const char *vertexPath)
+{
+	unsigned int vertexShader, fragmentShader, program;
+
+	vertexShader = glCreateShader(GL_VERTEX_SHADER);
+	lgl_compileShader(vertexShader, vertexPath);
+
+	fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+	lgl_compileShader(fragmentShader, "shaders/fragment.glsl");
+
+	program = glCreateProgram();
+	glAttachShader(program, vertexShader);
+	glAttachShader(program, fragmentShader);
+	if (!lgl_linkProgram(program)) {
+		glDeleteProgram(program);
+		program = 0;
+	}
+
+	glDeleteShader(vertexShader);
+	glDeleteShader(fragmentShader);
+	return program;
+}
+
+static void quadTransform(int i, float time, vec3 position, versor rotation)
+{
+	position[0] = (i % GRID - GRID * 0.5f) * 0.1f;
+	position[1] = (i / GRID - GRID * 0.5f) * 0.1f;
+	position[2] = 0.0f;
+	glm_quatv(rotation, time + i * 0.01f, (vec3){0.0f, 0.0f, 1.0f});
+}
+
+int main(void)
+{
+	int exitCode = 0, glLoaded = 0, shouldQuit = 0;
+	GLFWwindow *window = NULL;
+
+	unsigned int programs[MODE_COUNT] = {0};
+	unsigned int VAO[MODE_COUNT] = {0}, buffers[2] = {0}; /* VBO and EBO */
+
+	float vertices[] = {
+		0.5f,  0.5f, 0.0f,
+		0.5f, -0.5f, 0.0f,
+		-0.5f, -0.5f, 0.0f,
+		-0.5f,  0.5f, 0.0f
+	};
+	unsigned int indices[] = {
+		0, 1, 3,
+		1, 2, 3
+	};
+
+	lgl_InstanceBuffer matrices = {0}, trs = {0};
+	int mode = MODE_MATRIX, spaceWasDown = 0;
+	int viewProjLocations[MODE_COUNT], modelLocation;
+	int i;
+
+	/* statistics of the current report interval */
+	double reportStart = 0.0, submitSeconds = 0.0, worstFrame = 0.0;
+	double lastFrame = 0.0;
+	unsigned long frames = 0, drawCalls = 0;
+
+	glfwInit();
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 6);
+	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+	window = glfwCreateWindow(800, 600, "LearnOpenGL", NULL, NULL);
+	if (!window) {
+		fprintf(stderr, "Failed to create window!\n");
+		goto_defer(-1);
+	}
+	glfwMakeContextCurrent(window);
+	glfwSwapInterval(0);
+
+	if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+		fprintf(stderr, "Failed to load OpenGL\n");
+		goto_defer(-1);
+	}
+	glLoaded = 1;
+	glfwSetFramebufferSizeCallback(window, onWindowResize);
+
+	/* shaders
+	 ***********/
+	for (i = 0; i < MODE_COUNT; i++) {
+		programs[i] = createProgram(vertexShaders[i]);
+		if (!programs[i]) goto_defer(-1);
+		viewProjLocations[i] = glGetUniformLocation(programs[i], "viewProj");
+	}
+	modelLocation = glGetUniformLocation(programs[MODE_UNIFORM], "model");
+
+	/* VAOs and buffers
+	 ********************/
+	if (!lgl_instanceBufferInit(&matrices, LGL_INSTANCE_MATRIX, QUAD_COUNT)
+	    || !lgl_instanceBufferInit(&trs, LGL_INSTANCE_TRS, QUAD_COUNT)) {
+		fprintf(stderr, "Failed to allocate the instances\n");
+		goto_defer(-1);
+	}
+
+	glGenVertexArrays(MODE_COUNT, VAO);
+	glGenBuffers(2, buffers);
+
+	glBindBuffer(GL_ARRAY_BUFFER, buffers[0]);
+	glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+
+	/* every VAO shares the quad, the instanced ones add their attributes */
+	for (i = 0; i < MODE_COUNT; i++) {
+		glBindVertexArray(VAO[i]);
+		glBindBuffer(GL_ARRAY_BUFFER, buffers[0]);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers[1]);
+		if (i == 0)
+			glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices),
+				     indices, GL_STATIC_DRAW);
+
+		glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE,
+				      3 * sizeof(float), (void *)0);
+		glEnableVertexAttribArray(0);
+
+		if (i == MODE_MATRIX) lgl_instanceBufferAttach(&matrices, 1);
+		if (i == MODE_TRS) lgl_instanceBufferAttach(&trs, 1);
+	}
+
+	printf("%d quads, press SPACE to cycle uniform/matrix/trs/ssbo\n",
+	       QUAD_COUNT);
+	reportStart = lastFrame = glfwGetTime();
+
+	while (!shouldQuit) {
+		double time = glfwGetTime(), submitStart;
+		mat4 view, projection, viewProj;
+		int spaceDown;
+
+		if (glfwWindowShouldClose(window)) shouldQuit = 1;
+		if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
+			shouldQuit = 1;
+
+		spaceDown = glfwGetKey(window, GLFW_KEY_SPACE) == GLFW_PRESS;
+		if (spaceDown && !spaceWasDown) {
+			mode = (mode + 1) % MODE_COUNT;
+			printf("Drawing with %s\n", modeNames[mode]);
+		}
+		spaceWasDown = spaceDown;
+
+		glm_lookat((vec3){0.0f, 0.0f, 24.0f}, (vec3){0.0f, 0.0f, 0.0f},
+			   (vec3){0.0f, 1.0f, 0.0f}, view);
+		glm_perspective(glm_rad(70.0f), 800.0f / 600.0f,
+				0.1f, 100.0f, projection);
+		glm_mat4_mul(projection, view, viewProj);
+
+		/* rendering
+		 *************/
+		glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+		glClear(GL_COLOR_BUFFER_BIT);
+
+		submitStart = glfwGetTime();
+
+		glUseProgram(programs[mode]);
+		glUniformMatrix4fv(viewProjLocations[mode], 1, GL_FALSE, viewProj[0]);
+		glBindVertexArray(VAO[mode]);
+
+		if (mode == MODE_UNIFORM) {
+			/* the old way: one uniform and one draw per quad */
+			for (i = 0; i < QUAD_COUNT; i++) {
+				vec3 position;
+				versor rotation;
+				mat4 model;
+
+				quadTransform(i, (float)time, position, rotation);
+				glm_quat_mat4(rotation, model);
+				glm_scale_uni(model, 0.08f);
+				glm_vec3_copy(position, model[3]);
+
+				glUniformMatrix4fv(modelLocation, 1, GL_FALSE, model[0]);
+				glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+			}
+			drawCalls += QUAD_COUNT;
+		} else {
+			lgl_InstanceBuffer *instances =
+				mode == MODE_TRS ? &trs : &matrices;
+
+			lgl_instanceBufferReset(instances);
+			for (i = 0; i < QUAD_COUNT; i++) {
+				vec3 position;
+				versor rotation;
+
+				quadTransform(i, (float)time, position, rotation);
+				lgl_instancePushTRS(instances, position, rotation, 0.08f);
+			}
+			lgl_instanceBufferUpload(instances);
+
+			if (mode == MODE_SSBO)
+				lgl_instanceBufferBindStorage(instances, 0);
+			lgl_instanceDrawElements(instances, GL_TRIANGLES, 6,
+						 GL_UNSIGNED_INT);
+			drawCalls++;
+		}
+
+		submitSeconds += glfwGetTime() - submitStart;
+
+		glfwPollEvents();
+		glfwSwapBuffers(window);
+
+		frames++;
+		if (glfwGetTime() - lastFrame > worstFrame)
+			worstFrame = glfwGetTime() - lastFrame;
+		lastFrame = glfwGetTime();
+
+		if (glfwGetTime() - reportStart >= 2.0) {
+			double elapsed = glfwGetTime() - reportStart;
+
+			printf("%-7s | %7.3f ms/frame | %7.3f ms worst"
+			       " | %7.3f ms cpu submit | %6lu draws/frame\n",
+			       modeNames[mode],
+			       elapsed * 1000.0 / frames,
+			       worstFrame * 1000.0,
+			       submitSeconds * 1000.0 / frames,
+			       drawCalls / frames);
+
+			reportStart = glfwGetTime();
+			submitSeconds = 0.0;
+			worstFrame = 0.0;
+			frames = 0;
+			drawCalls = 0;
+		}
+	}
+
+ defer:
+	if (glLoaded) {
+		for (i = 0; i < MODE_COUNT; i++)
+			glDeleteProgram(programs[i]);
+		glDeleteVertexArrays(MODE_COUNT, VAO);
+		glDeleteBuffers(2, buffers);
+		lgl_instanceBufferFree(&matrices);
+		lgl_instanceBufferFree(&trs);
+	}
+
+	glfwTerminate();
+	return exitCode;
+}
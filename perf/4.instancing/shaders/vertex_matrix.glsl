@@ -0,0 +1,13 @@
+#version 330 core
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in mat4 aModel;
+
+out vec3 Color;
+
+uniform mat4 viewProj;
+
+void main()
+{
+	Color = 0.5 + 0.5 * aPos;
+	gl_Position = viewProj * aModel * vec4(aPos, 1.0f);
+}
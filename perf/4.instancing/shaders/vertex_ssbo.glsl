@@ -0,0 +1,16 @@
+#version 430 core
+layout (location = 0) in vec3 aPos;
+
+layout (std430, binding = 0) readonly buffer Instances {
+	mat4 models[];
+};
+
+out vec3 Color;
+
+uniform mat4 viewProj;
+
+void main()
+{
+	Color = 0.5 + 0.5 * aPos;
+	gl_Position = viewProj * models[gl_InstanceID] * vec4(aPos, 1.0f);
+}
@@ -0,0 +1,17 @@
+#version 330 core
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec4 aPositionScale;
+layout (location = 2) in vec4 aRotation;
+
+out vec3 Color;
+
+uniform mat4 viewProj;
+
+void main()
+{
+	vec3 p = aPos * aPositionScale.w;
+
+	p += 2.0 * cross(aRotation.xyz, cross(aRotation.xyz, p) + aRotation.w * p);
+	Color = 0.5 + 0.5 * aPos;
+	gl_Position = viewProj * vec4(p + aPositionScale.xyz, 1.0f);
+}
@@ -0,0 +1,13 @@
+#version 330 core
+layout (location = 0) in vec3 aPos;
+
+out vec3 Color;
+
+uniform mat4 viewProj;
+uniform mat4 model;
+
+void main()
+{
+	Color = 0.5 + 0.5 * aPos;
+	gl_Position = viewProj * model * vec4(aPos, 1.0f);
+}
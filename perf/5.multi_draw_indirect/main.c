@@ -0,0 +1,329 @@
+#include <glad/glad.h>
+
+#define LGL_PLATFORM_IMPLEMENTATION
+#include <lgl_platform.h>
+
+#include <cglm/cglm.h>
+
+#define LGL_SHADER_IMPLEMENTATION
+#include <lgl_shader.h>
+
+#define LGL_MULTIDRAW_IMPLEMENTATION
+#include <lgl_multidraw.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define goto_defer(value) do { exitCode = (value); goto defer; } while(0)
+
+/* a field of assorted meshes, every one its own draw */
+#define GRID_X 128
+#define GRID_Y 64
+#define OBJECT_COUNT (GRID_X * GRID_Y)
+
+/* position, normal */
+#define FLOATS_PER_VERTEX 6
+#define MESH_COUNT 4
+
+enum { MODE_DIRECT, MODE_INDIRECT, MODE_COUNT };
+static const char *modeNames[MODE_COUNT] = {"direct", "indirect"};
+
+/* per-draw data, laid out as the std430 DrawData of the vertex shader */
+typedef struct {
+	mat4 model;
+	vec4 color;
+} DrawData;
+
+typedef void (*SurfaceFn)(float u, float v, float *vertex);
+
+static void onWindowResize(GLFWwindow *window, int width, int height)
+{
+	(void)window;
+	glViewport(0, 0, width, height);
+}
+
+static void sphereAt(float u, float v, float *vertex)
+{
+	float theta = u * 2.0f * GLM_PIf, phi = v * GLM_PIf;
+
+	vertex[3] = sinf(phi) * cosf(theta);
+	vertex[4] = cosf(phi);
+	vertex[5] = sinf(phi) * sinf(theta);
+	glm_vec3_scale(&vertex[3], 0.5f, vertex);
+}
+
+static void torusAt(float u, float v, float *vertex)
+{
+	float theta = u * 2.0f * GLM_PIf, phi = -v * 2.0f * GLM_PIf;
+
+	vertex[3] = cosf(phi) * cosf(theta);
+	vertex[4] = sinf(phi);
+	vertex[5] = cosf(phi) * sinf(theta);
+	vertex[0] = 0.32f * cosf(theta) + 0.15f * vertex[3];
+	vertex[1] = 0.15f * vertex[4];
+	vertex[2] = 0.32f * sinf(theta) + 0.15f * vertex[5];
+}
+
+static void cylinderAt(float u, float v, float *vertex)
+{
+	float theta = u * 2.0f * GLM_PIf;
+
+	vertex[3] = cosf(theta);
+	vertex[4] = 0.0f;
+	vertex[5] = sinf(theta);
+	vertex[0] = 0.35f * vertex[3];
+	vertex[1] = 0.5f - v;
+	vertex[2] = 0.35f * vertex[5];
+}
+
+/* tessellates a parametric surface into the arena */
+static int addSurface(lgl_MeshArena *arena, SurfaceFn surface,
+		      int slices, int stacks, lgl_ArenaMesh *mesh)
+{
+	int vertexCount = (slices + 1) * (stacks + 1);
+	int indexCount = slices * stacks * 6;
+	float *vertices = malloc(sizeof(float) * FLOATS_PER_VERTEX * vertexCount);
+	unsigned int *indices = malloc(sizeof(unsigned int) * indexCount);
+	unsigned int *index = indices;
+	int stack, slice, added = 0;
+
+	if (vertices && indices) {
+		for (stack = 0; stack <= stacks; stack++)
+			for (slice = 0; slice <= slices; slice++)
+				surface((float)slice / slices, (float)stack / stacks,
+					vertices + FLOATS_PER_VERTEX
+					* (stack * (slices + 1) + slice));
+
+		for (stack = 0; stack < stacks; stack++) {
+			for (slice = 0; slice < slices; slice++) {
+				unsigned int a = stack * (slices + 1) + slice;
+				unsigned int b = a + slices + 1;
+
+				*index++ = a; *index++ = a + 1; *index++ = b;
+				*index++ = b; *index++ = a + 1; *index++ = b + 1;
+			}
+		}
+
+		added = lgl_meshArenaAdd(arena, vertices, vertexCount,
+					 indices, indexCount, mesh);
+	}
+
+	free(vertices);
+	free(indices);
+	return added;
+}
+
+static unsigned int createProgram(const char *vertexPath)
+{
+	unsigned int vertexShader, fragmentShader, program;
+
+	vertexShader = glCreateShader(GL_VERTEX_SHADER);
+	lgl_compileShader(vertexShader, vertexPath);
+
+	fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+	lgl_compileShader(fragmentShader, "shaders/fragment.glsl");
+
+	program = glCreateProgram();
+	glAttachShader(program, vertexShader);
+	glAttachShader(program, fragmentShader);
+	if (!lgl_linkProgram(program)) {
+		glDeleteProgram(program);
+		program = 0;
+	}
+
+	glDeleteShader(vertexShader);
+	glDeleteShader(fragmentShader);
+	return program;
+}
+
+int main(void)
+{
+	int exitCode = 0, glLoaded = 0, shouldQuit = 0;
+	GLFWwindow *window = NULL;
+
+	unsigned int programs[MODE_COUNT] = {0};
+	int viewProjLocations[MODE_COUNT], modelLocation, colorLocation;
+
+	lgl_MeshArena arena = {0};
+	lgl_ArenaMesh meshes[MESH_COUNT];
+	lgl_DrawBatch batch = {0};
+
+	int objectMeshes[OBJECT_COUNT];
+	vec4 objectColors[OBJECT_COUNT];
+
+	int mode = MODE_INDIRECT, spaceWasDown = 0;
+	int i;
+
+	/* statistics of the current report interval */
+	double reportStart = 0.0, submitSeconds = 0.0;
+	unsigned long frames = 0, drawCalls = 0;
+
+	srand(1);
+	for (i = 0; i < OBJECT_COUNT; i++) {
+		objectMeshes[i] = rand() % MESH_COUNT;
+		glm_vec4_copy((vec4){0.3f + 0.7f * rand() / RAND_MAX,
+				     0.3f + 0.7f * rand() / RAND_MAX,
+				     0.3f + 0.7f * rand() / RAND_MAX, 1.0f},
+			      objectColors[i]);
+	}
+
+	glfwInit();
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 6);
+	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+	window = glfwCreateWindow(800, 600, "LearnOpenGL", NULL, NULL);
+	if (!window) {
+		fprintf(stderr, "Failed to create window!\n");
+		goto_defer(-1);
+	}
+	glfwMakeContextCurrent(window);
+	glfwSwapInterval(0);
+
+	if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+		fprintf(stderr, "Failed to load OpenGL\n");
+		goto_defer(-1);
+	}
+	glLoaded = 1;
+	glfwSetFramebufferSizeCallback(window, onWindowResize);
+
+	/* shaders
+	 ***********/
+	programs[MODE_DIRECT] = createProgram("shaders/vertex_direct.glsl");
+	programs[MODE_INDIRECT] = createProgram("shaders/vertex_indirect.glsl");
+	if (!programs[MODE_DIRECT] || !programs[MODE_INDIRECT]) goto_defer(-1);
+	for (i = 0; i < MODE_COUNT; i++)
+		viewProjLocations[i] = glGetUniformLocation(programs[i], "viewProj");
+	modelLocation = glGetUniformLocation(programs[MODE_DIRECT], "model");
+	colorLocation = glGetUniformLocation(programs[MODE_DIRECT], "color");
+
+	/* mesh arena
+	 **************/
+	if (!lgl_meshArenaInit(&arena, FLOATS_PER_VERTEX * sizeof(float),
+			       1 << 16, 1 << 18)) {
+		fprintf(stderr, "Failed to create the mesh arena\n");
+		goto_defer(-1);
+	}
+
+	glVertexAttribFormat(0, 3, GL_FLOAT, GL_FALSE, 0);
+	glVertexAttribBinding(0, 0);
+	glEnableVertexAttribArray(0);
+	glVertexAttribFormat(1, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float));
+	glVertexAttribBinding(1, 0);
+	glEnableVertexAttribArray(1);
+
+	if (!addSurface(&arena, sphereAt, 24, 16, &meshes[0])
+	    || !addSurface(&arena, torusAt, 32, 12, &meshes[1])
+	    || !addSurface(&arena, cylinderAt, 16, 1, &meshes[2])
+	    || !addSurface(&arena, sphereAt, 6, 4, &meshes[3])
+	    || !lgl_drawBatchInit(&batch, sizeof(DrawData), OBJECT_COUNT)) {
+		fprintf(stderr, "Failed to build the meshes\n");
+		goto_defer(-1);
+	}
+
+	glEnable(GL_DEPTH_TEST);
+
+	printf("%d objects from %d meshes, press SPACE to toggle"
+	       " direct/indirect\n", OBJECT_COUNT, MESH_COUNT);
+	reportStart = glfwGetTime();
+
+	while (!shouldQuit) {
+		double time = glfwGetTime(), submitStart;
+		mat4 view, projection, viewProj;
+		int spaceDown;
+
+		if (glfwWindowShouldClose(window)) shouldQuit = 1;
+		if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
+			shouldQuit = 1;
+
+		spaceDown = glfwGetKey(window, GLFW_KEY_SPACE) == GLFW_PRESS;
+		if (spaceDown && !spaceWasDown) {
+			mode = (mode + 1) % MODE_COUNT;
+			printf("Drawing with %s\n", modeNames[mode]);
+		}
+		spaceWasDown = spaceDown;
+
+		glm_lookat((vec3){0.0f, 0.0f, 40.0f}, (vec3){0.0f, 0.0f, 0.0f},
+			   (vec3){0.0f, 1.0f, 0.0f}, view);
+		glm_perspective(glm_rad(70.0f), 800.0f / 600.0f,
+				0.1f, 100.0f, projection);
+		glm_mat4_mul(projection, view, viewProj);
+
+		/* rendering
+		 *************/
+		glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+		submitStart = glfwGetTime();
+
+		glUseProgram(programs[mode]);
+		glUniformMatrix4fv(viewProjLocations[mode], 1, GL_FALSE, viewProj[0]);
+		glBindVertexArray(arena.VAO);
+		lgl_drawBatchReset(&batch);
+
+		for (i = 0; i < OBJECT_COUNT; i++) {
+			const lgl_ArenaMesh *mesh = &meshes[objectMeshes[i]];
+			DrawData draw;
+
+			glm_translate_make(draw.model, (vec3){
+				(i % GRID_X - GRID_X * 0.5f) * 0.8f,
+				(i / GRID_X - GRID_Y * 0.5f) * 0.8f, 0.0f});
+			glm_rotate(draw.model, (float)time + i * 0.1f,
+				   (vec3){0.6f, 0.8f, 0.0f});
+			glm_scale_uni(draw.model, 0.6f);
+			glm_vec4_copy(objectColors[i], draw.color);
+
+			if (mode == MODE_DIRECT) {
+				/* one uniform update and one draw per object */
+				glUniformMatrix4fv(modelLocation, 1, GL_FALSE,
+						   draw.model[0]);
+				glUniform4fv(colorLocation, 1, draw.color);
+				glDrawElementsBaseVertex(GL_TRIANGLES, mesh->indexCount,
+					GL_UNSIGNED_INT,
+					(void *)(sizeof(unsigned int) * mesh->firstIndex),
+					mesh->baseVertex);
+				drawCalls++;
+			} else {
+				lgl_drawBatchAdd(&batch, mesh, 1, &draw);
+			}
+		}
+
+		if (mode == MODE_INDIRECT) {
+			lgl_drawBatchSubmit(&batch, &arena, 0);
+			drawCalls++;
+		}
+
+		submitSeconds += glfwGetTime() - submitStart;
+
+		glfwPollEvents();
+		glfwSwapBuffers(window);
+
+		frames++;
+		if (glfwGetTime() - reportStart >= 2.0) {
+			double elapsed = glfwGetTime() - reportStart;
+
+			printf("%-8s | %7.3f ms/frame | %7.3f ms cpu submit"
+			       " | %5lu draw calls/frame\n",
+			       modeNames[mode],
+			       elapsed * 1000.0 / frames,
+			       submitSeconds * 1000.0 / frames,
+			       drawCalls / frames);
+
+			reportStart = glfwGetTime();
+			submitSeconds = 0.0;
+			frames = 0;
+			drawCalls = 0;
+		}
+	}
+
+ defer:
+	if (glLoaded) {
+		for (i = 0; i < MODE_COUNT; i++)
+			glDeleteProgram(programs[i]);
+		lgl_meshArenaFree(&arena);
+		lgl_drawBatchFree(&batch);
+	}
+
+	glfwTerminate();
+	return exitCode;
+}
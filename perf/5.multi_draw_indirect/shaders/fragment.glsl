@@ -0,0 +1,12 @@
+#version 330 core
+
+in vec3 Normal;
+in vec4 Color;
+
+out vec4 FragColor;
+
+void main()
+{
+	float light = max(dot(normalize(Normal), normalize(vec3(0.4, 0.8, 0.6))), 0.15);
+	FragColor = vec4(Color.rgb * light, Color.a);
+}
@@ -0,0 +1,17 @@
+#version 330 core
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aNormal;
+
+out vec3 Normal;
+out vec4 Color;
+
+uniform mat4 viewProj;
+uniform mat4 model;
+uniform vec4 color;
+
+void main()
+{
+	Normal = mat3(model) * aNormal;
+	Color = color;
+	gl_Position = viewProj * model * vec4(aPos, 1.0f);
+}
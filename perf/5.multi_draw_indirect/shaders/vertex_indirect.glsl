@@ -0,0 +1,27 @@
+#version 450 core
+#extension GL_ARB_shader_draw_parameters : require
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aNormal;
+
+struct DrawData {
+	mat4 model;
+	vec4 color;
+};
+
+layout (std430, binding = 0) readonly buffer Draws {
+	DrawData draws[];
+};
+
+out vec3 Normal;
+out vec4 Color;
+
+uniform mat4 viewProj;
+
+void main()
+{
+	DrawData draw = draws[gl_DrawIDARB];
+
+	Normal = mat3(draw.model) * aNormal;
+	Color = draw.color;
+	gl_Position = viewProj * draw.model * vec4(aPos, 1.0f);
+}
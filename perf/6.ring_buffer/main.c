@@ -0,0 +1,314 @@
+#include <glad/glad.h>
+
+#define LGL_PLATFORM_IMPLEMENTATION
+#include <lgl_platform.h>
+
+#include <cglm/cglm.h>
+
+#define LGL_SHADER_IMPLEMENTATION
+#include <lgl_shader.h>
+
+#define LGL_RING_BUFFER_IMPLEMENTATION
+#include <lgl_ring_buffer.h>
+
+#define LGL_WORKER_POOL_IMPLEMENTATION
+#include <lgl_worker_pool.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define goto_defer(value) do { exitCode = (value); goto defer; } while(0)
+
+/* particles rewritten every frame by a few threads */
+#define PARTICLE_COUNT 262144
+#define THREAD_COUNT 4
+#define CHUNK (PARTICLE_COUNT / THREAD_COUNT)
+
+/* position, phase */
+#define FLOATS_PER_PARTICLE 4
+#define PARTICLE_SIZE (FLOATS_PER_PARTICLE * sizeof(float))
+
+enum { MODE_SUBDATA, MODE_ORPHAN, MODE_RING, MODE_COUNT };
+static const char *modeNames[MODE_COUNT] = {"subdata", "orphan", "ring"};
+
+/* std140 layout of the Frame uniform block */
+typedef struct {
+	mat4 viewProj;
+	vec4 time;
+} FrameData;
+
+typedef struct {
+	lgl_RingBuffer *ring;   /* NULL to write into `staging` */
+	float *staging;
+	int first;
+	float time;
+
+	size_t offset;          /* where the chunk ended up in the ring */
+	int failed;
+} Worker;
+
+static void onWindowResize(GLFWwindow *window, int width, int height)
+{
+	(void)window;
+	glViewport(0, 0, width, height);
+}
+
+static void writeParticles(void *data, int index)
+{
+	Worker *worker = (Worker *)data + index;
+	float *particle;
+	int i;
+
+	if (worker->ring) {
+		particle = lgl_ringAlloc(worker->ring, CHUNK * PARTICLE_SIZE,
+					 &worker->offset);
+		worker->failed = particle == NULL;
+		if (!particle) return;
+	} else {
+		particle = worker->staging + worker->first * FLOATS_PER_PARTICLE;
+	}
+
+	/* a spinning galaxy, inner stars faster */
+	for (i = worker->first; i < worker->first + CHUNK; i++) {
+		float radius = 0.2f + 4.0f * (float)i / PARTICLE_COUNT;
+		float angle = i * 2.3999632f + worker->time / radius;
+		float arm = sinf(angle * 2.0f - radius) * 0.15f;
+
+		particle[0] = cosf(angle) * (radius + arm);
+		particle[1] = sinf(i * 0.37f) * 0.08f;
+		particle[2] = sinf(angle) * (radius + arm);
+		particle[3] = radius * 3.0f;
+		particle += FLOATS_PER_PARTICLE;
+	}
+}
+
+int main(void)
+{
+	int exitCode = 0, glLoaded = 0, shouldQuit = 0;
+	GLFWwindow *window = NULL;
+
+	unsigned int vertexShader, fragmentShader, shaderProgram;
+	int linked;
+	unsigned int VAO, VBO, UBO;
+
+	lgl_RingBuffer ring = {0};
+	Worker workers[THREAD_COUNT];
+	lgl_WorkerPool pool;
+	int poolStarted = 0;
+	float *staging = NULL;
+
+	int mode = MODE_RING, spaceWasDown = 0;
+	int i;
+
+	/* statistics of the current report interval */
+	double reportStart = 0.0, writeSeconds = 0.0;
+	unsigned long frames = 0, waitsAtStart = 0;
+
+	staging = malloc(PARTICLE_COUNT * PARTICLE_SIZE);
+	if (!staging) {
+		fprintf(stderr, "Failed to allocate the particles\n");
+		goto_defer(-1);
+	}
+
+	/* the writers stay alive so the timed section does not pay for
+	 * starting threads */
+	poolStarted = 1;
+	if (lgl_workerPoolInit(&pool, THREAD_COUNT) < THREAD_COUNT) {
+		fprintf(stderr, "Failed to start the writer threads\n");
+		goto_defer(-1);
+	}
+
+	glfwInit();
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 6);
+	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+	window = glfwCreateWindow(800, 600, "LearnOpenGL", NULL, NULL);
+	if (!window) {
+		fprintf(stderr, "Failed to create window!\n");
+		goto_defer(-1);
+	}
+	glfwMakeContextCurrent(window);
+	glfwSwapInterval(0);
+
+	if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+		fprintf(stderr, "Failed to load OpenGL\n");
+		goto_defer(-1);
+	}
+	glLoaded = 1;
+	glfwSetFramebufferSizeCallback(window, onWindowResize);
+
+	/* shaders
+	 ***********/
+	vertexShader = glCreateShader(GL_VERTEX_SHADER);
+	lgl_compileShader(vertexShader, "shaders/vertex.glsl");
+
+	fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+	lgl_compileShader(fragmentShader, "shaders/fragment.glsl");
+
+	shaderProgram = glCreateProgram();
+	glAttachShader(shaderProgram, vertexShader);
+	glAttachShader(shaderProgram, fragmentShader);
+	linked = lgl_linkProgram(shaderProgram);
+
+	glDeleteShader(vertexShader);
+	glDeleteShader(fragmentShader);
+	if (!linked) goto_defer(-1);
+
+	glUniformBlockBinding(shaderProgram,
+			      glGetUniformBlockIndex(shaderProgram, "Frame"), 0);
+
+	/* buffers
+	 ***********/
+	glGenVertexArrays(1, &VAO);
+	glGenBuffers(1, &VBO);
+	glGenBuffers(1, &UBO);
+
+	glBindBuffer(GL_ARRAY_BUFFER, VBO);
+	glBufferData(GL_ARRAY_BUFFER, PARTICLE_COUNT * PARTICLE_SIZE,
+		     NULL, GL_DYNAMIC_DRAW);
+	glBindBuffer(GL_UNIFORM_BUFFER, UBO);
+	glBufferData(GL_UNIFORM_BUFFER, sizeof(FrameData), NULL, GL_DYNAMIC_DRAW);
+
+	/* the particle format is fixed, only the source buffer changes */
+	glBindVertexArray(VAO);
+	glVertexAttribFormat(0, 4, GL_FLOAT, GL_FALSE, 0);
+	glVertexAttribBinding(0, 0);
+	glEnableVertexAttribArray(0);
+
+	/* room for every particle and the uniform block, per frame */
+	if (!lgl_ringInit(&ring, PARTICLE_COUNT * PARTICLE_SIZE
+			  + THREAD_COUNT * 256 + sizeof(FrameData) + 256, 0)) {
+		fprintf(stderr, "Failed to map the ring buffer\n");
+		goto_defer(-1);
+	}
+
+	glEnable(GL_PROGRAM_POINT_SIZE);
+
+	printf("%d particles from %d threads, press SPACE to cycle"
+	       " subdata/orphan/ring\n", PARTICLE_COUNT, THREAD_COUNT);
+	reportStart = glfwGetTime();
+
+	while (!shouldQuit) {
+		double time = glfwGetTime(), writeStart;
+		FrameData frame;
+		mat4 view, projection;
+		int spaceDown;
+
+		if (glfwWindowShouldClose(window)) shouldQuit = 1;
+		if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
+			shouldQuit = 1;
+
+		spaceDown = glfwGetKey(window, GLFW_KEY_SPACE) == GLFW_PRESS;
+		if (spaceDown && !spaceWasDown) {
+			mode = (mode + 1) % MODE_COUNT;
+			printf("Streaming with %s\n", modeNames[mode]);
+		}
+		spaceWasDown = spaceDown;
+
+		glm_lookat((vec3){0.0f, 4.0f, 6.0f}, (vec3){0.0f, 0.0f, 0.0f},
+			   (vec3){0.0f, 1.0f, 0.0f}, view);
+		glm_perspective(glm_rad(45.0f), 800.0f / 600.0f,
+				0.1f, 100.0f, projection);
+		glm_mat4_mul(projection, view, frame.viewProj);
+		glm_vec4_copy((vec4){(float)time, 0.0f, 0.0f, 0.0f}, frame.time);
+
+		/* streaming
+		 *************/
+		writeStart = glfwGetTime();
+		if (mode == MODE_RING) lgl_ringBeginFrame(&ring);
+
+		for (i = 0; i < THREAD_COUNT; i++) {
+			workers[i].ring = mode == MODE_RING ? &ring : NULL;
+			workers[i].staging = staging;
+			workers[i].first = i * CHUNK;
+			workers[i].time = (float)time;
+			workers[i].failed = 0;
+		}
+		lgl_workerPoolRun(&pool, writeParticles, workers);
+
+		if (mode == MODE_RING) {
+			size_t offset;
+			void *block = lgl_ringAlloc(&ring, sizeof(frame), &offset);
+
+			if (block) {
+				memcpy(block, &frame, sizeof(frame));
+				glBindBufferRange(GL_UNIFORM_BUFFER, 0, ring.buffer,
+						  offset, sizeof(frame));
+			}
+		} else {
+			glBindBuffer(GL_ARRAY_BUFFER, VBO);
+			if (mode == MODE_ORPHAN)
+				glBufferData(GL_ARRAY_BUFFER,
+					     PARTICLE_COUNT * PARTICLE_SIZE,
+					     NULL, GL_DYNAMIC_DRAW);
+			glBufferSubData(GL_ARRAY_BUFFER, 0,
+					PARTICLE_COUNT * PARTICLE_SIZE, staging);
+
+			glBindBuffer(GL_UNIFORM_BUFFER, UBO);
+			glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(frame), &frame);
+			glBindBufferBase(GL_UNIFORM_BUFFER, 0, UBO);
+		}
+
+		writeSeconds += glfwGetTime() - writeStart;
+
+		/* rendering
+		 *************/
+		glClearColor(0.05f, 0.05f, 0.1f, 1.0f);
+		glClear(GL_COLOR_BUFFER_BIT);
+
+		glUseProgram(shaderProgram);
+		glBindVertexArray(VAO);
+
+		/* one draw per thread's chunk */
+		for (i = 0; i < THREAD_COUNT; i++) {
+			if (mode == MODE_RING) {
+				if (workers[i].failed) continue;
+				glBindVertexBuffer(0, ring.buffer, workers[i].offset,
+						   PARTICLE_SIZE);
+			} else {
+				glBindVertexBuffer(0, VBO,
+						   workers[i].first * PARTICLE_SIZE,
+						   PARTICLE_SIZE);
+			}
+			glDrawArrays(GL_POINTS, 0, CHUNK);
+		}
+
+		if (mode == MODE_RING) lgl_ringEndFrame(&ring);
+
+		glfwPollEvents();
+		glfwSwapBuffers(window);
+
+		frames++;
+		if (glfwGetTime() - reportStart >= 2.0) {
+			double elapsed = glfwGetTime() - reportStart;
+
+			printf("%-7s | %7.3f ms/frame | %7.3f ms write+upload"
+			       " | %3lu fence waits\n",
+			       modeNames[mode],
+			       elapsed * 1000.0 / frames,
+			       writeSeconds * 1000.0 / frames,
+			       ring.waits - waitsAtStart);
+
+			reportStart = glfwGetTime();
+			writeSeconds = 0.0;
+			frames = 0;
+			waitsAtStart = ring.waits;
+		}
+	}
+
+ defer:
+	if (glLoaded) {
+		glDeleteProgram(shaderProgram);
+		glDeleteVertexArrays(1, &VAO);
+		glDeleteBuffers(1, &VBO);
+		glDeleteBuffers(1, &UBO);
+		lgl_ringFree(&ring);
+	}
+	if (poolStarted) lgl_workerPoolFree(&pool);
+	free(staging);
+
+	glfwTerminate();
+	return exitCode;
+}
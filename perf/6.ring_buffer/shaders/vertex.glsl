@@ -0,0 +1,18 @@
+#version 330 core
+layout (location = 0) in vec4 aParticle; /* position, phase */
+
+layout (std140) uniform Frame {
+	mat4 viewProj;
+	vec4 time;
+};
+
+out vec3 Color;
+
+void main()
+{
+	float phase = aParticle.w + time.x;
+
+	Color = 0.5 + 0.5 * vec3(sin(phase), sin(phase + 2.1), sin(phase + 4.2));
+	gl_Position = viewProj * vec4(aParticle.xyz, 1.0f);
+	gl_PointSize = 1.0;
+}
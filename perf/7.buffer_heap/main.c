@@ -0,0 +1,367 @@
+#include <glad/glad.h>
+
+#define LGL_PLATFORM_IMPLEMENTATION
+#include <lgl_platform.h>
+
+#include <cglm/cglm.h>
+
+#define LGL_SHADER_IMPLEMENTATION
+#include <lgl_shader.h>
+
+#define LGL_BUFFER_HEAP_IMPLEMENTATION
+#include <lgl_buffer_heap.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define goto_defer(value) do { exitCode = (value); goto defer; } while(0)
+
+/* thousands of tiny polygons, a few of them replaced every frame */
+#define GRID 64
+#define MESH_COUNT (GRID * GRID)
+#define MAX_SIDES 48
+#define CHURN 32
+
+/* position, color */
+#define FLOATS_PER_VERTEX 6
+#define VERTEX_SIZE (FLOATS_PER_VERTEX * sizeof(float))
+
+enum { MODE_BUFFERS, MODE_HEAP, MODE_COUNT };
+static const char *modeNames[MODE_COUNT] = {"buffers", "heap"};
+
+typedef struct {
+	int sides;
+	float vertices[(MAX_SIDES + 1) * FLOATS_PER_VERTEX];
+	unsigned int indices[MAX_SIDES * 3];
+
+	/* MODE_BUFFERS: objects of its own */
+	unsigned int VAO, VBO, EBO;
+
+	/* MODE_HEAP: blocks of the shared heaps */
+	int vertexBlock, indexBlock;
+} Mesh;
+
+static void onWindowResize(GLFWwindow *window, int width, int height)
+{
+	(void)window;
+	glViewport(0, 0, width, height);
+}
+
+/* a polygon fan with a random number of sides */
+static void buildMesh(Mesh *mesh, int slot)
+{
+	float cx = ((slot % GRID) + 0.5f) * 2.0f / GRID - 1.0f;
+	float cy = ((slot / GRID) + 0.5f) * 2.0f / GRID - 1.0f;
+	float *vertex = mesh->vertices;
+	int i;
+
+	mesh->sides = 3 + rand() % (MAX_SIDES - 2);
+
+	for (i = 0; i <= mesh->sides; i++) {
+		float angle = (float)i / mesh->sides * 2.0f * GLM_PIf;
+		float radius = i == mesh->sides ? 0.0f : 0.8f / GRID;
+
+		vertex[0] = cx + cosf(angle) * radius;
+		vertex[1] = cy + sinf(angle) * radius;
+		vertex[2] = 0.0f;
+		vertex[3] = (float)mesh->sides / MAX_SIDES;
+		vertex[4] = 0.4f + 0.6f * (slot % GRID) / GRID;
+		vertex[5] = 0.4f + 0.6f * (slot / GRID) / GRID;
+		vertex += FLOATS_PER_VERTEX;
+	}
+
+	/* the center is the last vertex */
+	for (i = 0; i < mesh->sides; i++) {
+		mesh->indices[i * 3 + 0] = mesh->sides;
+		mesh->indices[i * 3 + 1] = i;
+		mesh->indices[i * 3 + 2] = (i + 1) % mesh->sides;
+	}
+}
+
+static void uploadBuffers(Mesh *mesh)
+{
+	glGenVertexArrays(1, &mesh->VAO);
+	glGenBuffers(1, &mesh->VBO);
+	glGenBuffers(1, &mesh->EBO);
+
+	glBindVertexArray(mesh->VAO);
+	glBindBuffer(GL_ARRAY_BUFFER, mesh->VBO);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh->EBO);
+
+	glBufferData(GL_ARRAY_BUFFER, (mesh->sides + 1) * VERTEX_SIZE,
+		     mesh->vertices, GL_STATIC_DRAW);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER,
+		     mesh->sides * 3 * sizeof(unsigned int),
+		     mesh->indices, GL_STATIC_DRAW);
+
+	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, VERTEX_SIZE, (void *)0);
+	glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, VERTEX_SIZE,
+			      (void *)(3 * sizeof(float)));
+	glEnableVertexAttribArray(0);
+	glEnableVertexAttribArray(1);
+}
+
+static void releaseBuffers(Mesh *mesh)
+{
+	glDeleteVertexArrays(1, &mesh->VAO);
+	glDeleteBuffers(1, &mesh->VBO);
+	glDeleteBuffers(1, &mesh->EBO);
+	mesh->VAO = mesh->VBO = mesh->EBO = 0;
+}
+
+static void releaseHeap(Mesh *mesh, lgl_BufferHeap *vertexHeap,
+			lgl_BufferHeap *indexHeap)
+{
+	lgl_bufferHeapRelease(vertexHeap, mesh->vertexBlock);
+	lgl_bufferHeapRelease(indexHeap, mesh->indexBlock);
+	mesh->vertexBlock = mesh->indexBlock = -1;
+}
+
+/* returns the number of blocks moved to make room, or -1 if the heaps
+ * are full even after defragmenting */
+static int uploadHeap(Mesh *mesh, lgl_BufferHeap *vertexHeap,
+		      lgl_BufferHeap *indexHeap)
+{
+	int moved = 0;
+
+	mesh->vertexBlock = lgl_bufferHeapAlloc(vertexHeap, mesh->sides + 1);
+	mesh->indexBlock = lgl_bufferHeapAlloc(indexHeap, mesh->sides * 3);
+
+	if (mesh->vertexBlock < 0 || mesh->indexBlock < 0) {
+		releaseHeap(mesh, vertexHeap, indexHeap);
+		moved += lgl_bufferHeapDefragment(vertexHeap);
+		moved += lgl_bufferHeapDefragment(indexHeap);
+
+		mesh->vertexBlock = lgl_bufferHeapAlloc(vertexHeap, mesh->sides + 1);
+		mesh->indexBlock = lgl_bufferHeapAlloc(indexHeap, mesh->sides * 3);
+		if (mesh->vertexBlock < 0 || mesh->indexBlock < 0) {
+			releaseHeap(mesh, vertexHeap, indexHeap);
+			return -1;
+		}
+	}
+
+	lgl_bufferHeapUpload(vertexHeap, mesh->vertexBlock,
+			     mesh->vertices, mesh->sides + 1);
+	lgl_bufferHeapUpload(indexHeap, mesh->indexBlock,
+			     mesh->indices, mesh->sides * 3);
+	return moved;
+}
+
+/* share of the free space that is not in the largest free block */
+static double fragmentation(const lgl_BufferHeap *heap)
+{
+	unsigned int freeElements = heap->capacity - heap->usedElements;
+
+	if (freeElements == 0) return 0.0;
+	return 1.0 - (double)lgl_bufferHeapLargestFree(heap) / freeElements;
+}
+
+int main(void)
+{
+	int exitCode = 0, glLoaded = 0, shouldQuit = 0;
+	GLFWwindow *window = NULL;
+
+	unsigned int vertexShader, fragmentShader, shaderProgram;
+	int linked;
+	unsigned int heapVAO = 0;
+	lgl_BufferHeap vertexHeap = {0}, indexHeap = {0};
+	Mesh *meshes = NULL;
+
+	int mode = MODE_HEAP, spaceWasDown = 0;
+	int i;
+
+	/* statistics of the current report interval */
+	double reportStart = 0.0, submitSeconds = 0.0;
+	unsigned long frames = 0, moved = 0;
+
+	meshes = calloc(MESH_COUNT, sizeof(Mesh));
+	if (!meshes) {
+		fprintf(stderr, "Failed to allocate the meshes\n");
+		goto_defer(-1);
+	}
+
+	glfwInit();
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 6);
+	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+	window = glfwCreateWindow(800, 600, "LearnOpenGL", NULL, NULL);
+	if (!window) {
+		fprintf(stderr, "Failed to create window!\n");
+		goto_defer(-1);
+	}
+	glfwMakeContextCurrent(window);
+	glfwSwapInterval(0);
+
+	if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+		fprintf(stderr, "Failed to load OpenGL\n");
+		goto_defer(-1);
+	}
+	glLoaded = 1;
+	glfwSetFramebufferSizeCallback(window, onWindowResize);
+
+	/* shaders
+	 ***********/
+	vertexShader = glCreateShader(GL_VERTEX_SHADER);
+	lgl_compileShader(vertexShader, "shaders/vertex.glsl");
+
+	fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+	lgl_compileShader(fragmentShader, "shaders/fragment.glsl");
+
+	shaderProgram = glCreateProgram();
+	glAttachShader(shaderProgram, vertexShader);
+	glAttachShader(shaderProgram, fragmentShader);
+	linked = lgl_linkProgram(shaderProgram);
+
+	glDeleteShader(vertexShader);
+	glDeleteShader(fragmentShader);
+	if (!linked) goto_defer(-1);
+
+	/* heaps and their shared VAO
+	 ******************************/
+	if (!lgl_bufferHeapInit(&vertexHeap, VERTEX_SIZE,
+				MESH_COUNT * (MAX_SIDES + 1) * 2, 16)
+	    || !lgl_bufferHeapInit(&indexHeap, sizeof(unsigned int),
+				   MESH_COUNT * MAX_SIDES * 3 * 2, 32)) {
+		fprintf(stderr, "Failed to create the buffer heaps\n");
+		goto_defer(-1);
+	}
+
+	glGenVertexArrays(1, &heapVAO);
+	glBindVertexArray(heapVAO);
+	glBindBuffer(GL_ARRAY_BUFFER, vertexHeap.buffer);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexHeap.buffer);
+	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, VERTEX_SIZE, (void *)0);
+	glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, VERTEX_SIZE,
+			      (void *)(3 * sizeof(float)));
+	glEnableVertexAttribArray(0);
+	glEnableVertexAttribArray(1);
+
+	srand(1);
+	for (i = 0; i < MESH_COUNT; i++) {
+		buildMesh(&meshes[i], i);
+		if (uploadHeap(&meshes[i], &vertexHeap, &indexHeap) < 0) {
+			fprintf(stderr, "The buffer heaps are full\n");
+			goto_defer(-1);
+		}
+	}
+
+	printf("%d meshes, %d replaced per frame, press SPACE to toggle"
+	       " buffers/heap\n", MESH_COUNT, CHURN);
+	reportStart = glfwGetTime();
+
+	while (!shouldQuit) {
+		double submitStart;
+		int spaceDown;
+
+		if (glfwWindowShouldClose(window)) shouldQuit = 1;
+		if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
+			shouldQuit = 1;
+
+		/* move every mesh over to the other storage */
+		spaceDown = glfwGetKey(window, GLFW_KEY_SPACE) == GLFW_PRESS;
+		if (spaceDown && !spaceWasDown) {
+			mode = (mode + 1) % MODE_COUNT;
+			for (i = 0; i < MESH_COUNT; i++) {
+				if (mode == MODE_HEAP) {
+					releaseBuffers(&meshes[i]);
+					uploadHeap(&meshes[i], &vertexHeap, &indexHeap);
+				} else {
+					releaseHeap(&meshes[i], &vertexHeap, &indexHeap);
+					uploadBuffers(&meshes[i]);
+				}
+			}
+			printf("Storing meshes in %s\n", modeNames[mode]);
+		}
+		spaceWasDown = spaceDown;
+
+		submitStart = glfwGetTime();
+
+		/* churn
+		 *********/
+		for (i = 0; i < CHURN; i++) {
+			Mesh *mesh = &meshes[rand() % MESH_COUNT];
+			int slot = (int)(mesh - meshes), blocksMoved;
+
+			if (mode == MODE_HEAP) {
+				releaseHeap(mesh, &vertexHeap, &indexHeap);
+				buildMesh(mesh, slot);
+
+				/* a failed mesh is skipped until it is replaced */
+				blocksMoved = uploadHeap(mesh, &vertexHeap, &indexHeap);
+				if (blocksMoved > 0) moved += blocksMoved;
+			} else {
+				releaseBuffers(mesh);
+				buildMesh(mesh, slot);
+				uploadBuffers(mesh);
+			}
+		}
+
+		/* rendering
+		 *************/
+		glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+		glClear(GL_COLOR_BUFFER_BIT);
+
+		glUseProgram(shaderProgram);
+		if (mode == MODE_HEAP) glBindVertexArray(heapVAO);
+
+		for (i = 0; i < MESH_COUNT; i++) {
+			const Mesh *mesh = &meshes[i];
+
+			if (mode == MODE_HEAP) {
+				if (mesh->vertexBlock < 0 || mesh->indexBlock < 0)
+					continue;
+				glDrawElementsBaseVertex(GL_TRIANGLES, mesh->sides * 3,
+					GL_UNSIGNED_INT,
+					(void *)(sizeof(unsigned int)
+						 * lgl_bufferHeapOffset(&indexHeap,
+									mesh->indexBlock)),
+					(int)lgl_bufferHeapOffset(&vertexHeap,
+								  mesh->vertexBlock));
+			} else {
+				glBindVertexArray(mesh->VAO);
+				glDrawElements(GL_TRIANGLES, mesh->sides * 3,
+					       GL_UNSIGNED_INT, (void *)0);
+			}
+		}
+
+		submitSeconds += glfwGetTime() - submitStart;
+
+		glfwPollEvents();
+		glfwSwapBuffers(window);
+
+		frames++;
+		if (glfwGetTime() - reportStart >= 2.0) {
+			double elapsed = glfwGetTime() - reportStart;
+
+			printf("%-7s | %7.3f ms/frame | %7.3f ms cpu | %5d buffers"
+			       " | %4.1f%% fragmented | %6lu blocks moved\n",
+			       modeNames[mode],
+			       elapsed * 1000.0 / frames,
+			       submitSeconds * 1000.0 / frames,
+			       mode == MODE_HEAP ? 2 : MESH_COUNT * 2,
+			       100.0 * fragmentation(&vertexHeap),
+			       moved);
+
+			reportStart = glfwGetTime();
+			submitSeconds = 0.0;
+			frames = 0;
+			moved = 0;
+		}
+	}
+
+ defer:
+	if (glLoaded) {
+		glDeleteProgram(shaderProgram);
+		if (meshes)
+			for (i = 0; i < MESH_COUNT; i++)
+				if (meshes[i].VAO) releaseBuffers(&meshes[i]);
+		glDeleteVertexArrays(1, &heapVAO);
+		lgl_bufferHeapFree(&vertexHeap);
+		lgl_bufferHeapFree(&indexHeap);
+	}
+	free(meshes);
+
+	glfwTerminate();
+	return exitCode;
+}
@@ -0,0 +1,330 @@
+#include <glad/glad.h>
+
+#define LGL_PLATFORM_IMPLEMENTATION
+#include <lgl_platform.h>
+
+#define LGL_SHADER_IMPLEMENTATION
+#include <lgl_shader.h>
+
+#define LGL_DSA_IMPLEMENTATION
+#include <lgl_dsa.h>
+
+#define LGL_STATE_CACHE_IMPLEMENTATION
+#include <lgl_state_cache.h>
+
+#define LGL_RENDER_QUEUE_IMPLEMENTATION
+#include <lgl_render_queue.h>
+
+#include <stdio.h>
+
+#define goto_defer(value) do { exitCode = (value); goto defer; } while(0)
+
+/* objects come in groups sharing a material, the way a scene is built */
+#define GRID 64
+#define OBJECT_COUNT (GRID * GRID)
+#define GROUP_SIZE 16
+
+#define PROGRAM_COUNT 3
+#define TEXTURE_COUNT 8
+#define MESH_COUNT 2
+#define TEXTURE_SIZE 8
+
+enum { MODE_DIRECT, MODE_CACHED, MODE_QUEUED, MODE_COUNT };
+static const char *modeNames[MODE_COUNT] = {"direct", "cached", "queued"};
+
+static const char *fragmentShaders[PROGRAM_COUNT] = {
+	"shaders/fragment_plain.glsl", "shaders/fragment_tint.glsl",
+	"shaders/fragment_invert.glsl"
+};
+
+typedef struct {
+	int program, texture, mesh, blended;
+	float offset[2];
+} Object;
+
+/* what the queue's draw callback needs to find an object's uniforms */
+typedef struct {
+	const Object *objects;
+	const int *offsetLocations;
+} DrawContext;
+
+static void onWindowResize(GLFWwindow *window, int width, int height)
+{
+	(void)window;
+	glViewport(0, 0, width, height);
+}
+
+static unsigned int createProgram(const char *fragmentPath)
+{
+	unsigned int vertexShader, fragmentShader, program;
+
+	vertexShader = glCreateShader(GL_VERTEX_SHADER);
+	lgl_compileShader(vertexShader, "shaders/vertex.glsl");
+
+	fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+	lgl_compileShader(fragmentShader, fragmentPath);
+
+	program = glCreateProgram();
+	glAttachShader(program, vertexShader);
+	glAttachShader(program, fragmentShader);
+	if (!lgl_linkProgram(program)) {
+		glDeleteProgram(program);
+		program = 0;
+	}
+
+	glDeleteShader(vertexShader);
+	glDeleteShader(fragmentShader);
+	return program;
+}
+
+/* a checkerboard in one of a few colors */
+static unsigned int createTexture(int index)
+{
+	unsigned char pixels[TEXTURE_SIZE * TEXTURE_SIZE * 3];
+	int x, y;
+
+	for (y = 0; y < TEXTURE_SIZE; y++) {
+		for (x = 0; x < TEXTURE_SIZE; x++) {
+			unsigned char *pixel = pixels + (y * TEXTURE_SIZE + x) * 3;
+			int on = (x + y) & 1;
+
+			pixel[0] = on ? 255 : (unsigned char)(index * 32);
+			pixel[1] = on ? (unsigned char)(255 - index * 32) : 0;
+			pixel[2] = on ? 128 : (unsigned char)(index * 16);
+		}
+	}
+
+	return lgl_createTexture2D(TEXTURE_SIZE, TEXTURE_SIZE, 3, pixels,
+				   GL_REPEAT, GL_NEAREST, GL_NEAREST);
+}
+
+static void setObjectUniforms(const lgl_DrawItem *item, void *data)
+{
+	const DrawContext *context = data;
+	const Object *object = &context->objects[item->user];
+
+	glUniform2fv(context->offsetLocations[object->program], 1,
+		     object->offset);
+}
+
+int main(void)
+{
+	int exitCode = 0, glLoaded = 0, shouldQuit = 0;
+	GLFWwindow *window = NULL;
+
+	unsigned int programs[PROGRAM_COUNT] = {0};
+	unsigned int textures[TEXTURE_COUNT] = {0};
+	unsigned int VAO[MESH_COUNT] = {0}, VBO[MESH_COUNT] = {0};
+	int offsetLocations[PROGRAM_COUNT];
+
+	/* a quad and a diamond, both as triangle fans */
+	float meshes[MESH_COUNT][8] = {
+		{-0.5f, -0.5f, 0.5f, -0.5f, 0.5f, 0.5f, -0.5f, 0.5f},
+		{0.0f, -0.5f, 0.5f, 0.0f, 0.0f, 0.5f, -0.5f, 0.0f}
+	};
+
+	static Object objects[OBJECT_COUNT];
+	lgl_StateCache state;
+	lgl_RenderQueue queue = {0};
+	DrawContext context;
+
+	int mode = MODE_CACHED, spaceWasDown = 0;
+	int i;
+
+	/* statistics of the current report interval */
+	double reportStart = 0.0, submitSeconds = 0.0;
+	unsigned long frames = 0, stateCalls = 0, glCalls = 0;
+
+	glfwInit();
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 6);
+	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+	window = glfwCreateWindow(800, 600, "LearnOpenGL", NULL, NULL);
+	if (!window) {
+		fprintf(stderr, "Failed to create window!\n");
+		goto_defer(-1);
+	}
+	glfwMakeContextCurrent(window);
+	glfwSwapInterval(0);
+
+	if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+		fprintf(stderr, "Failed to load OpenGL\n");
+		goto_defer(-1);
+	}
+	glLoaded = 1;
+	glfwSetFramebufferSizeCallback(window, onWindowResize);
+
+	/* shaders and textures
+	 ************************/
+	for (i = 0; i < PROGRAM_COUNT; i++) {
+		programs[i] = createProgram(fragmentShaders[i]);
+		if (!programs[i]) goto_defer(-1);
+		offsetLocations[i] = glGetUniformLocation(programs[i], "offset");
+	}
+
+	for (i = 0; i < TEXTURE_COUNT; i++)
+		textures[i] = createTexture(i);
+
+	/* VAOs and buffers
+	 ********************/
+	for (i = 0; i < MESH_COUNT; i++) {
+		VBO[i] = lgl_createBuffer(sizeof(meshes[i]), meshes[i], 0);
+		VAO[i] = lgl_createVertexArray();
+		lgl_vertexArrayBuffers(VAO[i], 0, VBO[i], 0, 2 * sizeof(float), 0);
+		lgl_vertexArrayAttrib(VAO[i], 0, 2, GL_FLOAT, GL_FALSE, 0, 0);
+	}
+
+	/* scene
+	 *********/
+	for (i = 0; i < OBJECT_COUNT; i++) {
+		int group = i / GROUP_SIZE;
+
+		objects[i].program = group % PROGRAM_COUNT;
+		objects[i].texture = group * 5 % TEXTURE_COUNT;
+		objects[i].mesh = group / PROGRAM_COUNT % MESH_COUNT;
+		objects[i].blended = group % 4 == 0;
+		objects[i].offset[0] = ((i % GRID) + 0.5f) * 2.0f / GRID - 1.0f;
+		objects[i].offset[1] = ((i / GRID) + 0.5f) * 2.0f / GRID - 1.0f;
+	}
+
+	if (!lgl_renderQueueInit(&queue, OBJECT_COUNT)) {
+		fprintf(stderr, "Failed to allocate the render queue\n");
+		goto_defer(-1);
+	}
+	context.objects = objects;
+	context.offsetLocations = offsetLocations;
+
+	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	lgl_stateInit(&state);
+
+	printf("%d objects, press SPACE to cycle direct/cached/queued state\n",
+	       OBJECT_COUNT);
+	reportStart = glfwGetTime();
+
+	while (!shouldQuit) {
+		double submitStart;
+		int spaceDown;
+
+		if (glfwWindowShouldClose(window)) shouldQuit = 1;
+		if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
+			shouldQuit = 1;
+
+		spaceDown = glfwGetKey(window, GLFW_KEY_SPACE) == GLFW_PRESS;
+		if (spaceDown && !spaceWasDown) {
+			mode = (mode + 1) % MODE_COUNT;
+			/* direct calls leave the shadow copy stale */
+			lgl_stateInvalidate(&state);
+			printf("Setting state %s\n", modeNames[mode]);
+		}
+		spaceWasDown = spaceDown;
+
+		/* rendering
+		 *************/
+		glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+		glClear(GL_COLOR_BUFFER_BIT);
+
+		submitStart = glfwGetTime();
+
+		if (mode == MODE_QUEUED) {
+			/* sorted by state, then submitted through the cache */
+			lgl_renderQueueReset(&queue);
+			for (i = 0; i < OBJECT_COUNT; i++) {
+				const Object *object = &objects[i];
+				lgl_DrawItem item = {0};
+
+				item.program = programs[object->program];
+				item.textures[0] = textures[object->texture];
+				item.vao = VAO[object->mesh];
+				item.blended = object->blended;
+				item.mode = GL_TRIANGLE_FAN;
+				item.count = 4;
+				item.user = (unsigned int)i;
+
+				/* top of the screen is furthest away */
+				lgl_renderQueuePush(&queue, &item,
+						    0.5f + 0.5f * object->offset[1]);
+			}
+			lgl_renderQueueSort(&queue);
+			lgl_renderQueueSubmit(&queue, &state, setObjectUniforms,
+					      &context);
+		}
+
+		/* every object states all it needs, like the samples do */
+		for (i = 0; mode != MODE_QUEUED && i < OBJECT_COUNT; i++) {
+			const Object *object = &objects[i];
+
+			if (mode == MODE_DIRECT) {
+				glUseProgram(programs[object->program]);
+				glActiveTexture(GL_TEXTURE0);
+				glBindTexture(GL_TEXTURE_2D, textures[object->texture]);
+				glBindVertexArray(VAO[object->mesh]);
+				if (object->blended)
+					glEnable(GL_BLEND);
+				else
+					glDisable(GL_BLEND);
+			} else {
+				lgl_stateUseProgram(&state, programs[object->program]);
+				lgl_stateBindTexture(&state, 0, GL_TEXTURE_2D,
+						     textures[object->texture]);
+				lgl_stateBindVertexArray(&state, VAO[object->mesh]);
+				if (object->blended)
+					lgl_stateEnable(&state, GL_BLEND);
+				else
+					lgl_stateDisable(&state, GL_BLEND);
+			}
+
+			glUniform2fv(offsetLocations[object->program], 1,
+				     object->offset);
+			glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
+		}
+
+		if (mode == MODE_DIRECT) {
+			stateCalls += OBJECT_COUNT * 5;
+			glCalls += OBJECT_COUNT * 5;
+		} else {
+			lgl_stateEndFrame(&state);
+			stateCalls += lgl_stateCalls(&state.lastFrame);
+			glCalls += lgl_stateCalls(&state.lastFrame)
+				- lgl_stateRedundant(&state.lastFrame);
+		}
+
+		submitSeconds += glfwGetTime() - submitStart;
+
+		glfwPollEvents();
+		glfwSwapBuffers(window);
+
+		frames++;
+		if (glfwGetTime() - reportStart >= 2.0) {
+			double elapsed = glfwGetTime() - reportStart;
+
+			printf("%-6s | %7.3f ms/frame | %7.3f ms cpu submit"
+			       " | %6lu state calls/frame | %6lu reached GL"
+			       " | %6lu dropped\n",
+			       modeNames[mode],
+			       elapsed * 1000.0 / frames,
+			       submitSeconds * 1000.0 / frames,
+			       stateCalls / frames, glCalls / frames,
+			       (stateCalls - glCalls) / frames);
+
+			reportStart = glfwGetTime();
+			submitSeconds = 0.0;
+			frames = 0;
+			stateCalls = 0;
+			glCalls = 0;
+		}
+	}
+
+ defer:
+	if (glLoaded) {
+		for (i = 0; i < PROGRAM_COUNT; i++)
+			glDeleteProgram(programs[i]);
+		glDeleteTextures(TEXTURE_COUNT, textures);
+		glDeleteVertexArrays(MESH_COUNT, VAO);
+		glDeleteBuffers(MESH_COUNT, VBO);
+	}
+	lgl_renderQueueFree(&queue);
+
+	glfwTerminate();
+	return exitCode;
+}
@@ -0,0 +1,12 @@
+#version 330 core
+
+in vec2 TexCoord;
+
+out vec4 FragColor;
+
+uniform sampler2D tex;
+
+void main()
+{
+	FragColor = vec4(1.0 - texture(tex, TexCoord).rgb, 0.6);
+}
@@ -0,0 +1,12 @@
+#version 330 core
+layout (location = 0) in vec2 aPos;
+
+out vec2 TexCoord;
+
+uniform vec2 offset;
+
+void main()
+{
+	TexCoord = aPos + 0.5;
+	gl_Position = vec4(offset + aPos * 0.028, 0.0, 1.0);
+}
@@ -0,0 +1,297 @@
+#include <glad/glad.h>
+
+#define LGL_PLATFORM_IMPLEMENTATION
+#include <lgl_platform.h>
+
+#define LGL_SHADER_IMPLEMENTATION
+#include <lgl_shader.h>
+
+#define LGL_DSA_IMPLEMENTATION
+#include <lgl_dsa.h>
+
+#define LGL_STATE_CACHE_IMPLEMENTATION
+#include <lgl_state_cache.h>
+
+#define LGL_COMMAND_BUFFER_IMPLEMENTATION
+#include <lgl_command_buffer.h>
+
+#define LGL_WORKER_POOL_IMPLEMENTATION
+#include <lgl_worker_pool.h>
+
+#include <math.h>
+#include <stdio.h>
+
+#define goto_defer(value) do { exitCode = (value); goto defer; } while(0)
+
+/* swirling shapes, a good part of them off screen and culled */
+#define OBJECT_COUNT 16384
+#define THREAD_COUNT 4
+#define CHUNK (OBJECT_COUNT / THREAD_COUNT)
+#define MESH_COUNT 2
+
+enum { MODE_SINGLE, MODE_THREADED, MODE_COUNT };
+static const char *modeNames[MODE_COUNT] = {"single", "threaded"};
+
+typedef struct {
+	lgl_CommandBuffer commands;
+	int first, count;
+	float time;
+
+	/* GL names and locations are plain integers, safe to share */
+	unsigned int program, VAO[MESH_COUNT];
+	int transformLocation, colorLocation;
+
+	int visible;
+} Worker;
+
+static void onWindowResize(GLFWwindow *window, int width, int height)
+{
+	(void)window;
+	glViewport(0, 0, width, height);
+}
+
+/* culls, animates and records one range of objects, no GL calls */
+static void recordObjects(void *data, int index)
+{
+	Worker *worker = (Worker *)data + index;
+	int i;
+
+	lgl_commandBufferReset(&worker->commands);
+	worker->visible = 0;
+
+	lgl_cmdUseProgram(&worker->commands, worker->program);
+
+	for (i = worker->first; i < worker->first + worker->count; i++) {
+		float radius = 0.05f + 1.6f * (float)i / OBJECT_COUNT;
+		float angle = i * 2.3999632f + worker->time * 0.5f / radius;
+		float wobble = 0.0f, transform[4], color[4];
+		int mesh = i % MESH_COUNT, harmonic;
+
+		/* stands in for real per-object animation work */
+		for (harmonic = 1; harmonic <= 16; harmonic++)
+			wobble += sinf(worker->time * harmonic + i * 0.1f)
+				* 0.03f / harmonic;
+
+		transform[0] = cosf(angle) * (radius + wobble) * 0.75f;
+		transform[1] = sinf(angle) * (radius + wobble);
+		transform[2] = 0.012f + 0.006f * sinf(i * 0.7f);
+		transform[3] = angle * 3.0f;
+
+		if (fabsf(transform[0]) > 1.0f + transform[2]
+		    || fabsf(transform[1]) > 1.0f + transform[2])
+			continue;
+
+		color[0] = 0.5f + 0.5f * sinf(angle);
+		color[1] = 0.5f + 0.5f * sinf(angle + 2.094f);
+		color[2] = 0.5f + 0.5f * sinf(angle + 4.188f);
+		color[3] = 1.0f;
+
+		/* every draw states its VAO, replay drops the repeats */
+		lgl_cmdBindVertexArray(&worker->commands, worker->VAO[mesh]);
+		lgl_cmdUniform4f(&worker->commands, worker->transformLocation,
+				 transform);
+		lgl_cmdUniform4f(&worker->commands, worker->colorLocation, color);
+		lgl_cmdDrawArrays(&worker->commands, GL_TRIANGLE_FAN, 0,
+				  mesh ? 3 : 4);
+		worker->visible++;
+	}
+}
+
+int main(void)
+{
+	int exitCode = 0, glLoaded = 0, shouldQuit = 0;
+	GLFWwindow *window = NULL;
+
+	unsigned int vertexShader, fragmentShader, shaderProgram = 0;
+	int linked;
+	unsigned int VAO[MESH_COUNT] = {0}, VBO[MESH_COUNT] = {0};
+
+	/* a quad and a triangle, both as triangle fans */
+	float meshes[MESH_COUNT][8] = {
+		{-0.5f, -0.5f, 0.5f, -0.5f, 0.5f, 0.5f, -0.5f, 0.5f},
+		{0.0f, 0.6f, -0.5f, -0.3f, 0.5f, -0.3f, 0.0f, 0.0f}
+	};
+
+	Worker workers[THREAD_COUNT] = {0};
+	lgl_WorkerPool pool;
+	int poolStarted = 0;
+	lgl_StateCache state;
+
+	int mode = MODE_THREADED, spaceWasDown = 0;
+	int i;
+
+	/* statistics of the current report interval */
+	double reportStart = 0.0, recordSeconds = 0.0, replaySeconds = 0.0;
+	unsigned long frames = 0, visible = 0, commandWords = 0;
+
+	for (i = 0; i < THREAD_COUNT; i++) {
+		if (!lgl_commandBufferInit(&workers[i].commands, 4 * CHUNK)) {
+			fprintf(stderr, "Failed to allocate the command buffers\n");
+			goto_defer(-1);
+		}
+	}
+
+	/* the recorders stay alive so the record time does not include
+	 * starting threads */
+	poolStarted = 1;
+	if (lgl_workerPoolInit(&pool, THREAD_COUNT) < THREAD_COUNT) {
+		fprintf(stderr, "Failed to start the recording threads\n");
+		goto_defer(-1);
+	}
+
+	glfwInit();
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 6);
+	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+	window = glfwCreateWindow(800, 600, "LearnOpenGL", NULL, NULL);
+	if (!window) {
+		fprintf(stderr, "Failed to create window!\n");
+		goto_defer(-1);
+	}
+	glfwMakeContextCurrent(window);
+	glfwSwapInterval(0);
+
+	if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+		fprintf(stderr, "Failed to load OpenGL\n");
+		goto_defer(-1);
+	}
+	glLoaded = 1;
+	glfwSetFramebufferSizeCallback(window, onWindowResize);
+
+	/* shaders
+	 ***********/
+	vertexShader = glCreateShader(GL_VERTEX_SHADER);
+	lgl_compileShader(vertexShader, "shaders/vertex.glsl");
+
+	fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+	lgl_compileShader(fragmentShader, "shaders/fragment.glsl");
+
+	shaderProgram = glCreateProgram();
+	glAttachShader(shaderProgram, vertexShader);
+	glAttachShader(shaderProgram, fragmentShader);
+	linked = lgl_linkProgram(shaderProgram);
+
+	glDeleteShader(vertexShader);
+	glDeleteShader(fragmentShader);
+	if (!linked) goto_defer(-1);
+
+	/* VAOs and buffers
+	 ********************/
+	for (i = 0; i < MESH_COUNT; i++) {
+		VBO[i] = lgl_createBuffer(sizeof(meshes[i]), meshes[i], 0);
+		VAO[i] = lgl_createVertexArray();
+		lgl_vertexArrayBuffers(VAO[i], 0, VBO[i], 0, 2 * sizeof(float), 0);
+		lgl_vertexArrayAttrib(VAO[i], 0, 2, GL_FLOAT, GL_FALSE, 0, 0);
+	}
+
+	for (i = 0; i < THREAD_COUNT; i++) {
+		workers[i].program = shaderProgram;
+		workers[i].VAO[0] = VAO[0];
+		workers[i].VAO[1] = VAO[1];
+		workers[i].transformLocation =
+			glGetUniformLocation(shaderProgram, "transform");
+		workers[i].colorLocation =
+			glGetUniformLocation(shaderProgram, "color");
+	}
+
+	lgl_stateInit(&state);
+
+	printf("%d objects, press SPACE to toggle single/threaded recording\n",
+	       OBJECT_COUNT);
+	reportStart = glfwGetTime();
+
+	while (!shouldQuit) {
+		double time = glfwGetTime(), recordStart, replayStart;
+		int spaceDown;
+
+		if (glfwWindowShouldClose(window)) shouldQuit = 1;
+		if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
+			shouldQuit = 1;
+
+		spaceDown = glfwGetKey(window, GLFW_KEY_SPACE) == GLFW_PRESS;
+		if (spaceDown && !spaceWasDown) {
+			mode = (mode + 1) % MODE_COUNT;
+			printf("Recording %s\n", modeNames[mode]);
+		}
+		spaceWasDown = spaceDown;
+
+		/* recording
+		 *************/
+		recordStart = glfwGetTime();
+
+		if (mode == MODE_THREADED) {
+			for (i = 0; i < THREAD_COUNT; i++) {
+				workers[i].first = i * CHUNK;
+				workers[i].count = CHUNK;
+				workers[i].time = (float)time;
+			}
+			lgl_workerPoolRun(&pool, recordObjects, workers);
+		} else {
+			/* the same work, all on the GL thread */
+			workers[0].first = 0;
+			workers[0].count = OBJECT_COUNT;
+			workers[0].time = (float)time;
+			recordObjects(workers, 0);
+		}
+
+		recordSeconds += glfwGetTime() - recordStart;
+
+		/* rendering
+		 *************/
+		glClearColor(0.05f, 0.05f, 0.1f, 1.0f);
+		glClear(GL_COLOR_BUFFER_BIT);
+
+		replayStart = glfwGetTime();
+
+		/* in recording order, so the image does not depend on threads */
+		for (i = 0; i < (mode == MODE_THREADED ? THREAD_COUNT : 1); i++) {
+			if (workers[i].commands.failed)
+				fprintf(stderr, "Commands dropped by worker %d\n", i);
+			lgl_commandBufferExecute(&workers[i].commands, &state);
+			visible += workers[i].visible;
+			commandWords += workers[i].commands.count;
+		}
+		lgl_stateEndFrame(&state);
+
+		replaySeconds += glfwGetTime() - replayStart;
+
+		glfwPollEvents();
+		glfwSwapBuffers(window);
+
+		frames++;
+		if (glfwGetTime() - reportStart >= 2.0) {
+			double elapsed = glfwGetTime() - reportStart;
+
+			printf("%-8s | %7.3f ms/frame | %7.3f ms record"
+			       " | %7.3f ms replay | %5lu draws/frame"
+			       " | %5lu KiB commands\n",
+			       modeNames[mode],
+			       elapsed * 1000.0 / frames,
+			       recordSeconds * 1000.0 / frames,
+			       replaySeconds * 1000.0 / frames,
+			       visible / frames,
+			       commandWords * 4 / 1024 / frames);
+
+			reportStart = glfwGetTime();
+			recordSeconds = 0.0;
+			replaySeconds = 0.0;
+			frames = 0;
+			visible = 0;
+			commandWords = 0;
+		}
+	}
+
+ defer:
+	if (glLoaded) {
+		glDeleteProgram(shaderProgram);
+		glDeleteVertexArrays(MESH_COUNT, VAO);
+		glDeleteBuffers(MESH_COUNT, VBO);
+	}
+	for (i = 0; i < THREAD_COUNT; i++)
+		lgl_commandBufferFree(&workers[i].commands);
+	if (poolStarted) lgl_workerPoolFree(&pool);
+
+	glfwTerminate();
+	return exitCode;
+}
@@ -0,0 +1,12 @@
+#version 330 core
+layout (location = 0) in vec2 aPos;
+
+uniform vec4 transform; /* offset, scale, angle */
+
+void main()
+{
+	float c = cos(transform.w), s = sin(transform.w);
+	vec2 p = mat2(c, s, -s, c) * aPos * transform.z;
+
+	gl_Position = vec4(transform.xy + p, 0.0, 1.0);
+}
@@ -0,0 +1,9 @@
+/* The lgl_memory.h implementation for the CMake build's lgl_runtime
+ * library, which routes its stb_image and lgl_shader allocations through
+ * it with LGL_MEMORY_TRACKING. Samples built with LGL_MEMORY_LIBRARY
+ * defined skip their own copy. */
+
+#include <glad/glad.h>
+
+#define LGL_MEMORY_IMPLEMENTATION
+#include <lgl_memory.h>
@@ -0,0 +1,13 @@
+/* The lgl_shader.h implementation for the CMake build's lgl_runtime
+ * library. Samples built with LGL_SHADER_LIBRARY defined skip their own
+ * copy. With LGL_MEMORY_TRACKING (the CMake option of that name) its
+ * allocations are accounted by lgl_memory.h. */
+
+#include <glad/glad.h>
+
+#ifdef LGL_MEMORY_TRACKING
+#include <lgl_memory.h>
+#endif
+
+#define LGL_SHADER_IMPLEMENTATION
+#include <lgl_shader.h>
@@ -0,0 +1,12 @@
+/* The stb_image implementation for the CMake build's lgl_runtime
+ * library, compiled once instead of in every sample that loads textures.
+ * Samples built with LGL_STB_IMAGE_LIBRARY defined skip their own copy
+ * (see include/lgl_stb_image.h). With LGL_MEMORY_TRACKING (the CMake
+ * option of that name) its allocations are accounted by lgl_memory.h. */
+
+#ifdef LGL_MEMORY_TRACKING
+#include <lgl_memory.h>
+#endif
+
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
@@ -0,0 +1,58 @@
+#!/bin/sh
+# Runs every 1.getting_started sample headless (make headless) on a fixed
+# clock and collects the per-sample frame time percentiles into one JSON
+# file, see include/lgl_platform.h for what is measured. LGL_GL_TRACE is
+# set, so the results include the time spent inside GL calls (gl_ms).
+#
+# usage: tools/benchmark.sh [output.json] [sample dir...]
+# env:   LGL_FRAMES (default 300), LGL_WARMUP (default 30),
+#        LGL_FIXED_DT (default 1/60), HEADLESS and HEADLESS_LIBS for make
+
+set -e
+
+root=$(cd "$(dirname "$0")/.." && pwd)
+output=${1:-benchmark.json}
+[ $# -gt 0 ] && shift
+case $output in
+/*) ;;
+*) output=$(pwd)/$output ;;
+esac
+
+export LGL_FRAMES=${LGL_FRAMES:-300}
+export LGL_WARMUP=${LGL_WARMUP:-30}
+export LGL_FIXED_DT=${LGL_FIXED_DT:-0.0166667}
+export LGL_GL_TRACE=1
+
+if [ $# -eq 0 ]; then
+	set -- "$root"/1.getting_started/*/
+fi
+
+results=$(mktemp -d)
+trap 'rm -rf "$results"' EXIT
+
+{
+	printf '{\n"commit": "%s",\n"samples": {' \
+	       "$(git -C "$root" rev-parse --short HEAD 2>/dev/null || echo unknown)"
+	separator=
+	for dir in "$@"; do
+		# shader-only exercises have nothing to run
+		[ -f "$dir/Makefile" ] || continue
+		name=$(basename "$dir")
+		echo "benchmarking $name" >&2
+
+		if ! LGL_BENCH="$results/$name.json" \
+		     make -s -C "$dir" headless >"$results/$name.log" 2>&1 \
+		   || [ ! -s "$results/$name.json" ]; then
+			echo "$name failed, see below" >&2
+			cat "$results/$name.log" >&2
+			continue
+		fi
+
+		printf '%s\n"%s": ' "$separator" "$name"
+		cat "$results/$name.json"
+		separator=,
+	done
+	printf '}\n}\n'
+} >"$output"
+
+echo "wrote $output" >&2
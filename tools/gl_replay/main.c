@@ -0,0 +1,560 @@
+/* Plays back a GL call capture (LGL_GL_CAPTURE, see
+ * include/lgl_gl_trace.h) on a headless context, to profile a frame
+ * without the application around it. The frames before the captured one
+ * are replayed once to recreate the objects and state it uses, then the
+ * captured frame is replayed again and again; each replay is one frame of
+ * the headless platform, so its CPU, swap and GPU time percentiles are
+ * written as JSON like for every sample (LGL_BENCH, default stdout) and
+ * LGL_CAPTURE can save the last frame as an image.
+ *
+ * GL may hand out other object names than it did in the application, so
+ * the names GL creates are mapped from the captured ones and every call
+ * taking a name gets the replayed one; objects the captured frame creates
+ * are created again on every replay. Framebuffer 0 is the platform's
+ * framebuffer. The first pass compares the values GL returns with the
+ * captured ones and warns when they differ.
+ *
+ * usage: gl_replay capture.bin [repeat]
+ *        repeat is the number of measured replays, 100 by default */
+
+#include <glad/glad.h>
+
+#define LGL_PLATFORM_IMPLEMENTATION
+#include <lgl_platform.h>
+
+#include <lgl_gl_trace.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define goto_defer(value) do { exitCode = (value); goto defer; } while(0)
+
+#define SCRATCH_MAX 16    /* pointers GL writes to in one call */
+#define OUTPUT_MIN 65536  /* for outputs of unknown size */
+#define MAPPED_NAME_MAX 0x1000000 /* captured names above are not mapped */
+
+/* GL object namespaces, programs and shaders share one */
+enum {
+	NAME_BUFFER, NAME_TEXTURE, NAME_VERTEX_ARRAY, NAME_FRAMEBUFFER,
+	NAME_RENDERBUFFER, NAME_SAMPLER, NAME_QUERY, NAME_PROGRAM,
+	NAME_PIPELINE, NAME_TRANSFORM_FEEDBACK, NAME_COUNT
+};
+
+typedef struct {
+	const unsigned char *data;
+	size_t size, at;
+	int failed;                 /* truncated or unknown data */
+
+	int width, height, major, minor;
+	int *calls;                 /* by entry point in the file, -1 if unknown */
+	unsigned int callCount;
+	const char *name;           /* of the call being replayed */
+
+	/* memory handed to GL for one call */
+	void *scratch[SCRATCH_MAX];
+	int scratchCount;
+	struct {
+		const void *expected;
+		const void *actual;
+		size_t bytes;
+	} records[SCRATCH_MAX];
+	int recordCount;
+
+	/* captured sync object -> replayed one */
+	GLuint64 *syncIds;
+	GLsync *syncs;
+	size_t syncCount, syncCapacity;
+
+	/* captured name -> replayed one, by namespace; 0 for names that were
+	 * not created in the capture, which are used as they are */
+	GLuint *names[NAME_COUNT];
+	size_t nameCapacity[NAME_COUNT];
+	GLuint defaultFramebuffer;  /* the platform's, for framebuffer 0 */
+
+	int checking;               /* first pass, compare with the capture */
+	unsigned long mismatches, lossy, maps, unmapped;
+} Replay;
+
+static void readValue(Replay *r, void *value, size_t bytes)
+{
+	if (r->failed || r->at + bytes > r->size) {
+		r->failed = 1;
+		memset(value, 0, bytes);
+		return;
+	}
+	memcpy(value, r->data + r->at, bytes);
+	r->at += bytes;
+}
+
+static unsigned int readU32(Replay *r)
+{
+	unsigned int value;
+
+	readValue(r, &value, sizeof(value));
+	return value;
+}
+
+/* `bytes` of data starting at the next multiple of 8 */
+static const void *readData(Replay *r, size_t bytes)
+{
+	const void *data;
+
+	r->at = (r->at + 7) & ~(size_t)7;
+	if (r->failed || r->at + bytes > r->size) {
+		r->failed = 1;
+		return NULL;
+	}
+	data = r->data + r->at;
+	r->at += bytes;
+	return data;
+}
+
+static void *allocScratch(Replay *r, size_t bytes)
+{
+	void *memory;
+
+	if (r->scratchCount == SCRATCH_MAX) {
+		r->failed = 1;
+		return NULL;
+	}
+	memory = calloc(bytes ? bytes : 1, 1);
+	if (!memory) {
+		r->failed = 1;
+		return NULL;
+	}
+	r->scratch[r->scratchCount++] = memory;
+	return memory;
+}
+
+static void mismatch(Replay *r, const char *what)
+{
+	if (!r->checking) return;
+	if (r->mismatches++ < 10)
+		fprintf(stderr, "%s: %s than in the capture\n", r->name, what);
+}
+
+static void *readPointer(Replay *r)
+{
+	unsigned char tag = 0;
+	GLuint64 offset;
+	size_t bytes;
+
+	readValue(r, &tag, 1);
+	switch (tag) {
+	case LGL_GL_CAPTURE_NULL:
+		return NULL;
+	case LGL_GL_CAPTURE_OFFSET:
+		readValue(r, &offset, sizeof(offset));
+		return (void *)(uintptr_t)offset;
+	case LGL_GL_CAPTURE_DATA:
+		bytes = readU32(r);
+		return (void *)readData(r, bytes);
+	case LGL_GL_CAPTURE_OUTPUT:
+		bytes = readU32(r);
+		return allocScratch(r, bytes > OUTPUT_MIN ? bytes : OUTPUT_MIN);
+	case LGL_GL_CAPTURE_RECORD: {
+		void *actual;
+
+		bytes = readU32(r);
+		actual = allocScratch(r, bytes);
+		if (actual && r->recordCount < SCRATCH_MAX) {
+			r->records[r->recordCount].expected = readData(r, bytes);
+			r->records[r->recordCount].actual = actual;
+			r->records[r->recordCount].bytes = bytes;
+			r->recordCount++;
+		}
+		return actual;
+	}
+	default:
+		r->failed = 1;
+		return NULL;
+	}
+}
+
+static const GLchar **readStrings(Replay *r)
+{
+	unsigned char tag = 0;
+	const GLchar **strings;
+	unsigned int count, i;
+
+	readValue(r, &tag, 1);
+	if (tag == LGL_GL_CAPTURE_NULL) return NULL;
+	if (tag != LGL_GL_CAPTURE_STRINGS) {
+		r->failed = 1;
+		return NULL;
+	}
+
+	count = readU32(r);
+	strings = allocScratch(r, count * sizeof(*strings));
+	if (!strings) return NULL;
+	for (i = 0; i < count && !r->failed; i++) {
+		unsigned int length = readU32(r);
+
+		strings[i] = readData(r, length + 1);
+	}
+	return strings;
+}
+
+static GLsync readSync(Replay *r)
+{
+	GLuint64 id;
+	size_t i;
+
+	readValue(r, &id, sizeof(id));
+	if (!id) return NULL;
+	for (i = 0; i < r->syncCount; i++)
+		if (r->syncIds[i] == id) return r->syncs[i];
+	mismatch(r, "uses a sync object unknown");
+	return NULL;
+}
+
+static void mapSync(Replay *r, GLsync sync)
+{
+	GLuint64 id;
+
+	readValue(r, &id, sizeof(id));
+	if (r->syncCount == r->syncCapacity) {
+		size_t capacity = r->syncCapacity ? r->syncCapacity * 2 : 16;
+		GLuint64 *ids = realloc(r->syncIds, capacity * sizeof(*ids));
+		GLsync *syncs;
+
+		if (ids) r->syncIds = ids;
+		syncs = realloc(r->syncs, capacity * sizeof(*syncs));
+		if (syncs) r->syncs = syncs;
+		if (!ids || !syncs) {
+			r->failed = 1;
+			return;
+		}
+		r->syncCapacity = capacity;
+	}
+	r->syncIds[r->syncCount] = id;
+	r->syncs[r->syncCount++] = sync;
+}
+
+static GLuint mapName(Replay *r, int space, GLuint name)
+{
+	if (space == NAME_FRAMEBUFFER && name == 0) return r->defaultFramebuffer;
+	if (name < r->nameCapacity[space] && r->names[space][name])
+		return r->names[space][name];
+	return name;
+}
+
+/* a copy of `names` with the replayed names */
+static const GLuint *mapNames(Replay *r, int space, const GLuint *names,
+			      GLsizei count)
+{
+	GLuint *mapped;
+	GLsizei i;
+
+	if (!names || count <= 0) return names;
+	mapped = allocScratch(r, (size_t)count * sizeof(*mapped));
+	if (!mapped) return names;
+	for (i = 0; i < count; i++)
+		mapped[i] = mapName(r, space, names[i]);
+	return mapped;
+}
+
+static void addName(Replay *r, int space, GLuint captured, GLuint replayed)
+{
+	if (!captured) return;
+	if (captured >= MAPPED_NAME_MAX) {
+		r->unmapped++;
+		return;
+	}
+
+	if (captured >= r->nameCapacity[space]) {
+		size_t capacity = r->nameCapacity[space] ? r->nameCapacity[space] : 64;
+		GLuint *names;
+
+		while (capacity <= captured) capacity *= 2;
+		names = realloc(r->names[space], capacity * sizeof(*names));
+		if (!names) {
+			r->failed = 1;
+			return;
+		}
+		memset(names + r->nameCapacity[space], 0,
+		       (capacity - r->nameCapacity[space]) * sizeof(*names));
+		r->names[space] = names;
+		r->nameCapacity[space] = capacity;
+	}
+	r->names[space][captured] = replayed;
+}
+
+/* after a glGen* or glCreate* call: the names it created */
+static void recordNames(Replay *r, int space)
+{
+	int i;
+	size_t j;
+
+	for (i = 0; i < r->recordCount; i++) {
+		const GLuint *expected = r->records[i].expected;
+		const GLuint *actual = r->records[i].actual;
+
+		if (!expected) continue;
+		for (j = 0; j < r->records[i].bytes / sizeof(GLuint); j++)
+			addName(r, space, expected[j], actual[j]);
+	}
+}
+
+/* after glCreateProgram and the like, which return the name */
+static void mapResult(Replay *r, int space, GLuint name)
+{
+	GLuint expected = 0;
+
+	readValue(r, &expected, sizeof(expected));
+	addName(r, space, expected, name);
+}
+
+static void checkResult(Replay *r, const void *value, size_t bytes)
+{
+	unsigned char expected[8];
+
+	readValue(r, expected, bytes);
+	if (memcmp(expected, value, bytes)) mismatch(r, "returned another value");
+}
+
+#include "replay_gen.h"
+
+/* after a call: free its scratch memory */
+static void finishCall(Replay *r)
+{
+	int i;
+
+	r->recordCount = 0;
+
+	for (i = 0; i < r->scratchCount; i++)
+		free(r->scratch[i]);
+	r->scratchCount = 0;
+}
+
+/* replays the calls up to the next frame end; returns 0 on errors */
+static int replayFrame(Replay *r)
+{
+	while (!r->failed) {
+		unsigned short id = 0;
+		int index;
+
+		readValue(r, &id, sizeof(id));
+		if (id == LGL_GL_CAPTURE_FRAME_END) {
+			readU32(r);
+			return !r->failed;
+		}
+
+		if (id & LGL_GL_CAPTURE_LOSSY) {
+			/* nothing but the id was stored */
+			if (r->checking) r->lossy++;
+			continue;
+		}
+
+		if (id >= r->callCount) {
+			fprintf(stderr, "Unknown entry point %u\n", id);
+			return 0;
+		}
+		index = r->calls[id];
+		if (index < 0) {
+			/* the arguments cannot be skipped without the decoder */
+			fprintf(stderr, "This replayer does not know an entry point"
+				" of the capture, regenerate it with"
+				" tools/gl_trace_gen.py\n");
+			return 0;
+		}
+
+		r->name = callNames[index];
+		if (r->checking && !strncmp(r->name, "glMap", 5)) r->maps++;
+		if (!replayCall(r, index)) {
+			/* lossy for this replayer's generator, yet stored */
+			fprintf(stderr, "%s cannot be replayed, regenerate with"
+				" tools/gl_trace_gen.py\n", r->name);
+			return 0;
+		}
+		finishCall(r);
+	}
+	return 0;
+}
+
+static int readHeader(Replay *r)
+{
+	unsigned int version, count, i;
+	char name[256];
+	int j;
+
+	if (r->size < 8 || memcmp(r->data, "LGLGLCAP", 8)) return 0;
+	r->at = 8;
+	version = readU32(r);
+	if (version != LGL_GL_CAPTURE_VERSION) return 0;
+
+	readValue(r, &r->width, sizeof(r->width));
+	readValue(r, &r->height, sizeof(r->height));
+	readValue(r, &r->major, sizeof(r->major));
+	readValue(r, &r->minor, sizeof(r->minor));
+
+	count = readU32(r);
+	if (r->failed || count > LGL_GL_CAPTURE_LOSSY) return 0;
+	r->calls = malloc((count ? count : 1) * sizeof(*r->calls));
+	if (!r->calls) return 0;
+	r->callCount = count;
+
+	/* the capturing build may know other entry points than this one */
+	for (i = 0; i < count; i++) {
+		unsigned short length = 0;
+
+		readValue(r, &length, sizeof(length));
+		if (r->failed || length >= sizeof(name)) return 0;
+		readValue(r, name, length);
+		name[length] = '\0';
+
+		r->calls[i] = -1;
+		for (j = 0; j < CALL_COUNT; j++)
+			if (!strcmp(callNames[j], name)) {
+				r->calls[i] = j;
+				break;
+			}
+	}
+	return !r->failed;
+}
+
+static unsigned char *readFile(const char *path, size_t *size)
+{
+	FILE *file = fopen(path, "rb");
+	unsigned char *data = NULL;
+	long length;
+
+	if (!file) return NULL;
+	if (fseek(file, 0, SEEK_END) || (length = ftell(file)) < 0
+	    || fseek(file, 0, SEEK_SET))
+		goto defer;
+
+	/* malloc aligns the data in the file to 8 bytes or more */
+	data = malloc(length ? (size_t)length : 1);
+	if (data && fread(data, 1, (size_t)length, file) != (size_t)length) {
+		free(data);
+		data = NULL;
+	}
+	*size = (size_t)length;
+
+ defer:
+	fclose(file);
+	return data;
+}
+
+int main(int argc, char **argv)
+{
+	int exitCode = 0, repeat = argc > 2 ? atoi(argv[2]) : 100;
+	Replay r = {0};
+	unsigned char *data;
+	unsigned int lastFrame = 0;
+	unsigned short marker = 0;
+	size_t frameStart;
+	GLFWwindow *window;
+	GLint defaultFramebuffer = 0;
+	char frames[32];
+	int i;
+
+	if (argc < 2 || argc > 3 || repeat < 1) {
+		fprintf(stderr, "usage: %s capture.bin [repeat]\n", argv[0]);
+		return 2;
+	}
+
+	data = readFile(argv[1], &r.size);
+	r.data = data;
+	if (!data || !readHeader(&r)) {
+		fprintf(stderr, "\"%s\" is not a GL capture\n", argv[1]);
+		goto_defer(2);
+	}
+
+	/* the capture ends with the captured frame's end */
+	if (r.size < r.at + 6) {
+		fprintf(stderr, "\"%s\" holds no frame\n", argv[1]);
+		goto_defer(2);
+	}
+	memcpy(&marker, r.data + r.size - 6, sizeof(marker));
+	memcpy(&lastFrame, r.data + r.size - 4, sizeof(lastFrame));
+	if (marker != LGL_GL_CAPTURE_FRAME_END) {
+		fprintf(stderr, "\"%s\" is truncated\n", argv[1]);
+		goto_defer(2);
+	}
+	if (lastFrame == 0) {
+		fprintf(stderr, "Frame 0 includes the setup and cannot be"
+			" repeated, capture a later frame\n");
+		goto_defer(2);
+	}
+
+	/* every frame is a platform frame: the earlier ones and the first
+	 * replay of the captured frame are warmup */
+	sprintf(frames, "%d", repeat);
+	setenv("LGL_FRAMES", frames, 1);
+	sprintf(frames, "%u", lastFrame + 1);
+	setenv("LGL_WARMUP", frames, 1);
+	setenv("LGL_BENCH", "-", 0);
+	unsetenv("LGL_FIXED_DT");
+
+	glfwInit();
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, r.major ? r.major : 3);
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, r.major ? r.minor : 3);
+	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+	window = glfwCreateWindow(r.width > 0 ? r.width : 800,
+				  r.height > 0 ? r.height : 600, "gl_replay",
+				  NULL, NULL);
+	if (!window) {
+		fprintf(stderr, "Failed to create window!\n");
+		goto_defer(1);
+	}
+	glfwMakeContextCurrent(window);
+
+	if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+		fprintf(stderr, "Failed to load OpenGL!\n");
+		goto_defer(1);
+	}
+
+	/* what the application drew to with framebuffer 0 */
+	glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &defaultFramebuffer);
+	r.defaultFramebuffer = (GLuint)defaultFramebuffer;
+
+	r.checking = 1;
+	frameStart = r.at;
+	while (!glfwWindowShouldClose(window)) {
+		/* past the captured frame: replay it again */
+		if (r.at == r.size) {
+			r.at = frameStart;
+			r.checking = 0;
+		}
+		frameStart = r.at;
+
+		if (!replayFrame(&r)) {
+			fprintf(stderr, "Replay failed at byte %lu%s%s\n",
+				(unsigned long)r.at, r.name ? " after " : "",
+				r.name ? r.name : "");
+			goto_defer(1);
+		}
+		glfwSwapBuffers(window);
+	}
+
+	fprintf(stderr, "Replayed frames 0 to %u once, frame %u %d times\n",
+		lastFrame - 1, lastFrame, repeat + 1);
+	if (r.lossy)
+		fprintf(stderr, "%lu calls skipped, their data was not captured\n",
+			r.lossy);
+	if (r.maps)
+		fprintf(stderr, "%lu buffer maps: writes through mapped buffers"
+			" are not captured\n", r.maps);
+	if (r.unmapped)
+		fprintf(stderr, "%lu names too large to map, used as they are\n",
+			r.unmapped);
+	if (r.mismatches)
+		fprintf(stderr, "%lu results differed from the capture, the"
+			" replay may not match the application\n", r.mismatches);
+
+ defer:
+	finishCall(&r);
+	glfwTerminate();
+	free(r.syncIds);
+	free(r.syncs);
+	for (i = 0; i < NAME_COUNT; i++)
+		free(r.names[i]);
+	free(r.calls);
+	free(data);
+	return exitCode;
+}
@@ -0,0 +1,8307 @@
+/* Generated by tools/gl_trace_gen.py from the glad header, do not edit.
+ * Decodes and calls one captured GL call, see main.c. */
+
+#define CALL_COUNT 699
+
+static const char *callNames[CALL_COUNT] = {
+	"glCullFace",
+	"glFrontFace",
+	"glHint",
+	"glLineWidth",
+	"glPointSize",
+	"glPolygonMode",
+	"glScissor",
+	"glTexParameterf",
+	"glTexParameterfv",
+	"glTexParameteri",
+	"glTexParameteriv",
+	"glTexImage1D",
+	"glTexImage2D",
+	"glDrawBuffer",
+	"glClear",
+	"glClearColor",
+	"glClearStencil",
+	"glClearDepth",
+	"glStencilMask",
+	"glColorMask",
+	"glDepthMask",
+	"glDisable",
+	"glEnable",
+	"glFinish",
+	"glFlush",
+	"glBlendFunc",
+	"glLogicOp",
+	"glStencilFunc",
+	"glStencilOp",
+	"glDepthFunc",
+	"glPixelStoref",
+	"glPixelStorei",
+	"glReadBuffer",
+	"glReadPixels",
+	"glGetBooleanv",
+	"glGetDoublev",
+	"glGetError",
+	"glGetFloatv",
+	"glGetIntegerv",
+	"glGetString",
+	"glGetTexImage",
+	"glGetTexParameterfv",
+	"glGetTexParameteriv",
+	"glGetTexLevelParameterfv",
+	"glGetTexLevelParameteriv",
+	"glIsEnabled",
+	"glDepthRange",
+	"glViewport",
+	"glDrawArrays",
+	"glDrawElements",
+	"glPolygonOffset",
+	"glCopyTexImage1D",
+	"glCopyTexImage2D",
+	"glCopyTexSubImage1D",
+	"glCopyTexSubImage2D",
+	"glTexSubImage1D",
+	"glTexSubImage2D",
+	"glBindTexture",
+	"glDeleteTextures",
+	"glGenTextures",
+	"glIsTexture",
+	"glDrawRangeElements",
+	"glTexImage3D",
+	"glTexSubImage3D",
+	"glCopyTexSubImage3D",
+	"glActiveTexture",
+	"glSampleCoverage",
+	"glCompressedTexImage3D",
+	"glCompressedTexImage2D",
+	"glCompressedTexImage1D",
+	"glCompressedTexSubImage3D",
+	"glCompressedTexSubImage2D",
+	"glCompressedTexSubImage1D",
+	"glGetCompressedTexImage",
+	"glBlendFuncSeparate",
+	"glMultiDrawArrays",
+	"glMultiDrawElements",
+	"glPointParameterf",
+	"glPointParameterfv",
+	"glPointParameteri",
+	"glPointParameteriv",
+	"glBlendColor",
+	"glBlendEquation",
+	"glGenQueries",
+	"glDeleteQueries",
+	"glIsQuery",
+	"glBeginQuery",
+	"glEndQuery",
+	"glGetQueryiv",
+	"glGetQueryObjectiv",
+	"glGetQueryObjectuiv",
+	"glBindBuffer",
+	"glDeleteBuffers",
+	"glGenBuffers",
+	"glIsBuffer",
+	"glBufferData",
+	"glBufferSubData",
+	"glGetBufferSubData",
+	"glMapBuffer",
+	"glUnmapBuffer",
+	"glGetBufferParameteriv",
+	"glGetBufferPointerv",
+	"glBlendEquationSeparate",
+	"glDrawBuffers",
+	"glStencilOpSeparate",
+	"glStencilFuncSeparate",
+	"glStencilMaskSeparate",
+	"glAttachShader",
+	"glBindAttribLocation",
+	"glCompileShader",
+	"glCreateProgram",
+	"glCreateShader",
+	"glDeleteProgram",
+	"glDeleteShader",
+	"glDetachShader",
+	"glDisableVertexAttribArray",
+	"glEnableVertexAttribArray",
+	"glGetActiveAttrib",
+	"glGetActiveUniform",
+	"glGetAttachedShaders",
+	"glGetAttribLocation",
+	"glGetProgramiv",
+	"glGetProgramInfoLog",
+	"glGetShaderiv",
+	"glGetShaderInfoLog",
+	"glGetShaderSource",
+	"glGetUniformLocation",
+	"glGetUniformfv",
+	"glGetUniformiv",
+	"glGetVertexAttribdv",
+	"glGetVertexAttribfv",
+	"glGetVertexAttribiv",
+	"glGetVertexAttribPointerv",
+	"glIsProgram",
+	"glIsShader",
+	"glLinkProgram",
+	"glShaderSource",
+	"glUseProgram",
+	"glUniform1f",
+	"glUniform2f",
+	"glUniform3f",
+	"glUniform4f",
+	"glUniform1i",
+	"glUniform2i",
+	"glUniform3i",
+	"glUniform4i",
+	"glUniform1fv",
+	"glUniform2fv",
+	"glUniform3fv",
+	"glUniform4fv",
+	"glUniform1iv",
+	"glUniform2iv",
+	"glUniform3iv",
+	"glUniform4iv",
+	"glUniformMatrix2fv",
+	"glUniformMatrix3fv",
+	"glUniformMatrix4fv",
+	"glValidateProgram",
+	"glVertexAttrib1d",
+	"glVertexAttrib1dv",
+	"glVertexAttrib1f",
+	"glVertexAttrib1fv",
+	"glVertexAttrib1s",
+	"glVertexAttrib1sv",
+	"glVertexAttrib2d",
+	"glVertexAttrib2dv",
+	"glVertexAttrib2f",
+	"glVertexAttrib2fv",
+	"glVertexAttrib2s",
+	"glVertexAttrib2sv",
+	"glVertexAttrib3d",
+	"glVertexAttrib3dv",
+	"glVertexAttrib3f",
+	"glVertexAttrib3fv",
+	"glVertexAttrib3s",
+	"glVertexAttrib3sv",
+	"glVertexAttrib4Nbv",
+	"glVertexAttrib4Niv",
+	"glVertexAttrib4Nsv",
+	"glVertexAttrib4Nub",
+	"glVertexAttrib4Nubv",
+	"glVertexAttrib4Nuiv",
+	"glVertexAttrib4Nusv",
+	"glVertexAttrib4bv",
+	"glVertexAttrib4d",
+	"glVertexAttrib4dv",
+	"glVertexAttrib4f",
+	"glVertexAttrib4fv",
+	"glVertexAttrib4iv",
+	"glVertexAttrib4s",
+	"glVertexAttrib4sv",
+	"glVertexAttrib4ubv",
+	"glVertexAttrib4uiv",
+	"glVertexAttrib4usv",
+	"glVertexAttribPointer",
+	"glUniformMatrix2x3fv",
+	"glUniformMatrix3x2fv",
+	"glUniformMatrix2x4fv",
+	"glUniformMatrix4x2fv",
+	"glUniformMatrix3x4fv",
+	"glUniformMatrix4x3fv",
+	"glColorMaski",
+	"glGetBooleani_v",
+	"glGetIntegeri_v",
+	"glEnablei",
+	"glDisablei",
+	"glIsEnabledi",
+	"glBeginTransformFeedback",
+	"glEndTransformFeedback",
+	"glBindBufferRange",
+	"glBindBufferBase",
+	"glTransformFeedbackVaryings",
+	"glGetTransformFeedbackVarying",
+	"glClampColor",
+	"glBeginConditionalRender",
+	"glEndConditionalRender",
+	"glVertexAttribIPointer",
+	"glGetVertexAttribIiv",
+	"glGetVertexAttribIuiv",
+	"glVertexAttribI1i",
+	"glVertexAttribI2i",
+	"glVertexAttribI3i",
+	"glVertexAttribI4i",
+	"glVertexAttribI1ui",
+	"glVertexAttribI2ui",
+	"glVertexAttribI3ui",
+	"glVertexAttribI4ui",
+	"glVertexAttribI1iv",
+	"glVertexAttribI2iv",
+	"glVertexAttribI3iv",
+	"glVertexAttribI4iv",
+	"glVertexAttribI1uiv",
+	"glVertexAttribI2uiv",
+	"glVertexAttribI3uiv",
+	"glVertexAttribI4uiv",
+	"glVertexAttribI4bv",
+	"glVertexAttribI4sv",
+	"glVertexAttribI4ubv",
+	"glVertexAttribI4usv",
+	"glGetUniformuiv",
+	"glBindFragDataLocation",
+	"glGetFragDataLocation",
+	"glUniform1ui",
+	"glUniform2ui",
+	"glUniform3ui",
+	"glUniform4ui",
+	"glUniform1uiv",
+	"glUniform2uiv",
+	"glUniform3uiv",
+	"glUniform4uiv",
+	"glTexParameterIiv",
+	"glTexParameterIuiv",
+	"glGetTexParameterIiv",
+	"glGetTexParameterIuiv",
+	"glClearBufferiv",
+	"glClearBufferuiv",
+	"glClearBufferfv",
+	"glClearBufferfi",
+	"glGetStringi",
+	"glIsRenderbuffer",
+	"glBindRenderbuffer",
+	"glDeleteRenderbuffers",
+	"glGenRenderbuffers",
+	"glRenderbufferStorage",
+	"glGetRenderbufferParameteriv",
+	"glIsFramebuffer",
+	"glBindFramebuffer",
+	"glDeleteFramebuffers",
+	"glGenFramebuffers",
+	"glCheckFramebufferStatus",
+	"glFramebufferTexture1D",
+	"glFramebufferTexture2D",
+	"glFramebufferTexture3D",
+	"glFramebufferRenderbuffer",
+	"glGetFramebufferAttachmentParameteriv",
+	"glGenerateMipmap",
+	"glBlitFramebuffer",
+	"glRenderbufferStorageMultisample",
+	"glFramebufferTextureLayer",
+	"glMapBufferRange",
+	"glFlushMappedBufferRange",
+	"glBindVertexArray",
+	"glDeleteVertexArrays",
+	"glGenVertexArrays",
+	"glIsVertexArray",
+	"glDrawArraysInstanced",
+	"glDrawElementsInstanced",
+	"glTexBuffer",
+	"glPrimitiveRestartIndex",
+	"glCopyBufferSubData",
+	"glGetUniformIndices",
+	"glGetActiveUniformsiv",
+	"glGetActiveUniformName",
+	"glGetUniformBlockIndex",
+	"glGetActiveUniformBlockiv",
+	"glGetActiveUniformBlockName",
+	"glUniformBlockBinding",
+	"glDrawElementsBaseVertex",
+	"glDrawRangeElementsBaseVertex",
+	"glDrawElementsInstancedBaseVertex",
+	"glMultiDrawElementsBaseVertex",
+	"glProvokingVertex",
+	"glFenceSync",
+	"glIsSync",
+	"glDeleteSync",
+	"glClientWaitSync",
+	"glWaitSync",
+	"glGetInteger64v",
+	"glGetSynciv",
+	"glGetInteger64i_v",
+	"glGetBufferParameteri64v",
+	"glFramebufferTexture",
+	"glTexImage2DMultisample",
+	"glTexImage3DMultisample",
+	"glGetMultisamplefv",
+	"glSampleMaski",
+	"glBindFragDataLocationIndexed",
+	"glGetFragDataIndex",
+	"glGenSamplers",
+	"glDeleteSamplers",
+	"glIsSampler",
+	"glBindSampler",
+	"glSamplerParameteri",
+	"glSamplerParameteriv",
+	"glSamplerParameterf",
+	"glSamplerParameterfv",
+	"glSamplerParameterIiv",
+	"glSamplerParameterIuiv",
+	"glGetSamplerParameteriv",
+	"glGetSamplerParameterIiv",
+	"glGetSamplerParameterfv",
+	"glGetSamplerParameterIuiv",
+	"glQueryCounter",
+	"glGetQueryObjecti64v",
+	"glGetQueryObjectui64v",
+	"glVertexAttribDivisor",
+	"glVertexAttribP1ui",
+	"glVertexAttribP1uiv",
+	"glVertexAttribP2ui",
+	"glVertexAttribP2uiv",
+	"glVertexAttribP3ui",
+	"glVertexAttribP3uiv",
+	"glVertexAttribP4ui",
+	"glVertexAttribP4uiv",
+	"glVertexP2ui",
+	"glVertexP2uiv",
+	"glVertexP3ui",
+	"glVertexP3uiv",
+	"glVertexP4ui",
+	"glVertexP4uiv",
+	"glTexCoordP1ui",
+	"glTexCoordP1uiv",
+	"glTexCoordP2ui",
+	"glTexCoordP2uiv",
+	"glTexCoordP3ui",
+	"glTexCoordP3uiv",
+	"glTexCoordP4ui",
+	"glTexCoordP4uiv",
+	"glMultiTexCoordP1ui",
+	"glMultiTexCoordP1uiv",
+	"glMultiTexCoordP2ui",
+	"glMultiTexCoordP2uiv",
+	"glMultiTexCoordP3ui",
+	"glMultiTexCoordP3uiv",
+	"glMultiTexCoordP4ui",
+	"glMultiTexCoordP4uiv",
+	"glNormalP3ui",
+	"glNormalP3uiv",
+	"glColorP3ui",
+	"glColorP3uiv",
+	"glColorP4ui",
+	"glColorP4uiv",
+	"glSecondaryColorP3ui",
+	"glSecondaryColorP3uiv",
+	"glMinSampleShading",
+	"glBlendEquationi",
+	"glBlendEquationSeparatei",
+	"glBlendFunci",
+	"glBlendFuncSeparatei",
+	"glDrawArraysIndirect",
+	"glDrawElementsIndirect",
+	"glUniform1d",
+	"glUniform2d",
+	"glUniform3d",
+	"glUniform4d",
+	"glUniform1dv",
+	"glUniform2dv",
+	"glUniform3dv",
+	"glUniform4dv",
+	"glUniformMatrix2dv",
+	"glUniformMatrix3dv",
+	"glUniformMatrix4dv",
+	"glUniformMatrix2x3dv",
+	"glUniformMatrix2x4dv",
+	"glUniformMatrix3x2dv",
+	"glUniformMatrix3x4dv",
+	"glUniformMatrix4x2dv",
+	"glUniformMatrix4x3dv",
+	"glGetUniformdv",
+	"glGetSubroutineUniformLocation",
+	"glGetSubroutineIndex",
+	"glGetActiveSubroutineUniformiv",
+	"glGetActiveSubroutineUniformName",
+	"glGetActiveSubroutineName",
+	"glUniformSubroutinesuiv",
+	"glGetUniformSubroutineuiv",
+	"glGetProgramStageiv",
+	"glPatchParameteri",
+	"glPatchParameterfv",
+	"glBindTransformFeedback",
+	"glDeleteTransformFeedbacks",
+	"glGenTransformFeedbacks",
+	"glIsTransformFeedback",
+	"glPauseTransformFeedback",
+	"glResumeTransformFeedback",
+	"glDrawTransformFeedback",
+	"glDrawTransformFeedbackStream",
+	"glBeginQueryIndexed",
+	"glEndQueryIndexed",
+	"glGetQueryIndexediv",
+	"glReleaseShaderCompiler",
+	"glShaderBinary",
+	"glGetShaderPrecisionFormat",
+	"glDepthRangef",
+	"glClearDepthf",
+	"glGetProgramBinary",
+	"glProgramBinary",
+	"glProgramParameteri",
+	"glUseProgramStages",
+	"glActiveShaderProgram",
+	"glCreateShaderProgramv",
+	"glBindProgramPipeline",
+	"glDeleteProgramPipelines",
+	"glGenProgramPipelines",
+	"glIsProgramPipeline",
+	"glGetProgramPipelineiv",
+	"glProgramUniform1i",
+	"glProgramUniform1iv",
+	"glProgramUniform1f",
+	"glProgramUniform1fv",
+	"glProgramUniform1d",
+	"glProgramUniform1dv",
+	"glProgramUniform1ui",
+	"glProgramUniform1uiv",
+	"glProgramUniform2i",
+	"glProgramUniform2iv",
+	"glProgramUniform2f",
+	"glProgramUniform2fv",
+	"glProgramUniform2d",
+	"glProgramUniform2dv",
+	"glProgramUniform2ui",
+	"glProgramUniform2uiv",
+	"glProgramUniform3i",
+	"glProgramUniform3iv",
+	"glProgramUniform3f",
+	"glProgramUniform3fv",
+	"glProgramUniform3d",
+	"glProgramUniform3dv",
+	"glProgramUniform3ui",
+	"glProgramUniform3uiv",
+	"glProgramUniform4i",
+	"glProgramUniform4iv",
+	"glProgramUniform4f",
+	"glProgramUniform4fv",
+	"glProgramUniform4d",
+	"glProgramUniform4dv",
+	"glProgramUniform4ui",
+	"glProgramUniform4uiv",
+	"glProgramUniformMatrix2fv",
+	"glProgramUniformMatrix3fv",
+	"glProgramUniformMatrix4fv",
+	"glProgramUniformMatrix2dv",
+	"glProgramUniformMatrix3dv",
+	"glProgramUniformMatrix4dv",
+	"glProgramUniformMatrix2x3fv",
+	"glProgramUniformMatrix3x2fv",
+	"glProgramUniformMatrix2x4fv",
+	"glProgramUniformMatrix4x2fv",
+	"glProgramUniformMatrix3x4fv",
+	"glProgramUniformMatrix4x3fv",
+	"glProgramUniformMatrix2x3dv",
+	"glProgramUniformMatrix3x2dv",
+	"glProgramUniformMatrix2x4dv",
+	"glProgramUniformMatrix4x2dv",
+	"glProgramUniformMatrix3x4dv",
+	"glProgramUniformMatrix4x3dv",
+	"glValidateProgramPipeline",
+	"glGetProgramPipelineInfoLog",
+	"glVertexAttribL1d",
+	"glVertexAttribL2d",
+	"glVertexAttribL3d",
+	"glVertexAttribL4d",
+	"glVertexAttribL1dv",
+	"glVertexAttribL2dv",
+	"glVertexAttribL3dv",
+	"glVertexAttribL4dv",
+	"glVertexAttribLPointer",
+	"glGetVertexAttribLdv",
+	"glViewportArrayv",
+	"glViewportIndexedf",
+	"glViewportIndexedfv",
+	"glScissorArrayv",
+	"glScissorIndexed",
+	"glScissorIndexedv",
+	"glDepthRangeArrayv",
+	"glDepthRangeIndexed",
+	"glGetFloati_v",
+	"glGetDoublei_v",
+	"glDrawArraysInstancedBaseInstance",
+	"glDrawElementsInstancedBaseInstance",
+	"glDrawElementsInstancedBaseVertexBaseInstance",
+	"glGetInternalformativ",
+	"glGetActiveAtomicCounterBufferiv",
+	"glBindImageTexture",
+	"glMemoryBarrier",
+	"glTexStorage1D",
+	"glTexStorage2D",
+	"glTexStorage3D",
+	"glDrawTransformFeedbackInstanced",
+	"glDrawTransformFeedbackStreamInstanced",
+	"glClearBufferData",
+	"glClearBufferSubData",
+	"glDispatchCompute",
+	"glDispatchComputeIndirect",
+	"glCopyImageSubData",
+	"glFramebufferParameteri",
+	"glGetFramebufferParameteriv",
+	"glGetInternalformati64v",
+	"glInvalidateTexSubImage",
+	"glInvalidateTexImage",
+	"glInvalidateBufferSubData",
+	"glInvalidateBufferData",
+	"glInvalidateFramebuffer",
+	"glInvalidateSubFramebuffer",
+	"glMultiDrawArraysIndirect",
+	"glMultiDrawElementsIndirect",
+	"glGetProgramInterfaceiv",
+	"glGetProgramResourceIndex",
+	"glGetProgramResourceName",
+	"glGetProgramResourceiv",
+	"glGetProgramResourceLocation",
+	"glGetProgramResourceLocationIndex",
+	"glShaderStorageBlockBinding",
+	"glTexBufferRange",
+	"glTexStorage2DMultisample",
+	"glTexStorage3DMultisample",
+	"glTextureView",
+	"glBindVertexBuffer",
+	"glVertexAttribFormat",
+	"glVertexAttribIFormat",
+	"glVertexAttribLFormat",
+	"glVertexAttribBinding",
+	"glVertexBindingDivisor",
+	"glDebugMessageControl",
+	"glDebugMessageInsert",
+	"glDebugMessageCallback",
+	"glGetDebugMessageLog",
+	"glPushDebugGroup",
+	"glPopDebugGroup",
+	"glObjectLabel",
+	"glGetObjectLabel",
+	"glObjectPtrLabel",
+	"glGetObjectPtrLabel",
+	"glGetPointerv",
+	"glBufferStorage",
+	"glClearTexImage",
+	"glClearTexSubImage",
+	"glBindBuffersBase",
+	"glBindBuffersRange",
+	"glBindTextures",
+	"glBindSamplers",
+	"glBindImageTextures",
+	"glBindVertexBuffers",
+	"glClipControl",
+	"glCreateTransformFeedbacks",
+	"glTransformFeedbackBufferBase",
+	"glTransformFeedbackBufferRange",
+	"glGetTransformFeedbackiv",
+	"glGetTransformFeedbacki_v",
+	"glGetTransformFeedbacki64_v",
+	"glCreateBuffers",
+	"glNamedBufferStorage",
+	"glNamedBufferData",
+	"glNamedBufferSubData",
+	"glCopyNamedBufferSubData",
+	"glClearNamedBufferData",
+	"glClearNamedBufferSubData",
+	"glMapNamedBuffer",
+	"glMapNamedBufferRange",
+	"glUnmapNamedBuffer",
+	"glFlushMappedNamedBufferRange",
+	"glGetNamedBufferParameteriv",
+	"glGetNamedBufferParameteri64v",
+	"glGetNamedBufferPointerv",
+	"glGetNamedBufferSubData",
+	"glCreateFramebuffers",
+	"glNamedFramebufferRenderbuffer",
+	"glNamedFramebufferParameteri",
+	"glNamedFramebufferTexture",
+	"glNamedFramebufferTextureLayer",
+	"glNamedFramebufferDrawBuffer",
+	"glNamedFramebufferDrawBuffers",
+	"glNamedFramebufferReadBuffer",
+	"glInvalidateNamedFramebufferData",
+	"glInvalidateNamedFramebufferSubData",
+	"glClearNamedFramebufferiv",
+	"glClearNamedFramebufferuiv",
+	"glClearNamedFramebufferfv",
+	"glClearNamedFramebufferfi",
+	"glBlitNamedFramebuffer",
+	"glCheckNamedFramebufferStatus",
+	"glGetNamedFramebufferParameteriv",
+	"glGetNamedFramebufferAttachmentParameteriv",
+	"glCreateRenderbuffers",
+	"glNamedRenderbufferStorage",
+	"glNamedRenderbufferStorageMultisample",
+	"glGetNamedRenderbufferParameteriv",
+	"glCreateTextures",
+	"glTextureBuffer",
+	"glTextureBufferRange",
+	"glTextureStorage1D",
+	"glTextureStorage2D",
+	"glTextureStorage3D",
+	"glTextureStorage2DMultisample",
+	"glTextureStorage3DMultisample",
+	"glTextureSubImage1D",
+	"glTextureSubImage2D",
+	"glTextureSubImage3D",
+	"glCompressedTextureSubImage1D",
+	"glCompressedTextureSubImage2D",
+	"glCompressedTextureSubImage3D",
+	"glCopyTextureSubImage1D",
+	"glCopyTextureSubImage2D",
+	"glCopyTextureSubImage3D",
+	"glTextureParameterf",
+	"glTextureParameterfv",
+	"glTextureParameteri",
+	"glTextureParameterIiv",
+	"glTextureParameterIuiv",
+	"glTextureParameteriv",
+	"glGenerateTextureMipmap",
+	"glBindTextureUnit",
+	"glGetTextureImage",
+	"glGetCompressedTextureImage",
+	"glGetTextureLevelParameterfv",
+	"glGetTextureLevelParameteriv",
+	"glGetTextureParameterfv",
+	"glGetTextureParameterIiv",
+	"glGetTextureParameterIuiv",
+	"glGetTextureParameteriv",
+	"glCreateVertexArrays",
+	"glDisableVertexArrayAttrib",
+	"glEnableVertexArrayAttrib",
+	"glVertexArrayElementBuffer",
+	"glVertexArrayVertexBuffer",
+	"glVertexArrayVertexBuffers",
+	"glVertexArrayAttribBinding",
+	"glVertexArrayAttribFormat",
+	"glVertexArrayAttribIFormat",
+	"glVertexArrayAttribLFormat",
+	"glVertexArrayBindingDivisor",
+	"glGetVertexArrayiv",
+	"glGetVertexArrayIndexediv",
+	"glGetVertexArrayIndexed64iv",
+	"glCreateSamplers",
+	"glCreateProgramPipelines",
+	"glCreateQueries",
+	"glGetQueryBufferObjecti64v",
+	"glGetQueryBufferObjectiv",
+	"glGetQueryBufferObjectui64v",
+	"glGetQueryBufferObjectuiv",
+	"glMemoryBarrierByRegion",
+	"glGetTextureSubImage",
+	"glGetCompressedTextureSubImage",
+	"glGetGraphicsResetStatus",
+	"glGetnCompressedTexImage",
+	"glGetnTexImage",
+	"glGetnUniformdv",
+	"glGetnUniformfv",
+	"glGetnUniformiv",
+	"glGetnUniformuiv",
+	"glReadnPixels",
+	"glGetnMapdv",
+	"glGetnMapfv",
+	"glGetnMapiv",
+	"glGetnPixelMapfv",
+	"glGetnPixelMapuiv",
+	"glGetnPixelMapusv",
+	"glGetnPolygonStipple",
+	"glGetnColorTable",
+	"glGetnConvolutionFilter",
+	"glGetnSeparableFilter",
+	"glGetnHistogram",
+	"glGetnMinmax",
+	"glTextureBarrier",
+	"glSpecializeShader",
+	"glMultiDrawArraysIndirectCount",
+	"glMultiDrawElementsIndirectCount",
+	"glPolygonOffsetClamp",
+};
+
+/* returns 0 for calls the capture could not record */
+static int replayCall(Replay *replay, int index)
+{
+	switch (index) {
+	case 0: { /* glCullFace */
+		GLenum mode;
+		readValue(replay, &mode, sizeof(mode));
+		glad_glCullFace(mode);
+		break;
+	}
+	case 1: { /* glFrontFace */
+		GLenum mode;
+		readValue(replay, &mode, sizeof(mode));
+		glad_glFrontFace(mode);
+		break;
+	}
+	case 2: { /* glHint */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLenum mode;
+		readValue(replay, &mode, sizeof(mode));
+		glad_glHint(target, mode);
+		break;
+	}
+	case 3: { /* glLineWidth */
+		GLfloat width;
+		readValue(replay, &width, sizeof(width));
+		glad_glLineWidth(width);
+		break;
+	}
+	case 4: { /* glPointSize */
+		GLfloat size;
+		readValue(replay, &size, sizeof(size));
+		glad_glPointSize(size);
+		break;
+	}
+	case 5: { /* glPolygonMode */
+		GLenum face;
+		readValue(replay, &face, sizeof(face));
+		GLenum mode;
+		readValue(replay, &mode, sizeof(mode));
+		glad_glPolygonMode(face, mode);
+		break;
+	}
+	case 6: { /* glScissor */
+		GLint x;
+		readValue(replay, &x, sizeof(x));
+		GLint y;
+		readValue(replay, &y, sizeof(y));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLsizei height;
+		readValue(replay, &height, sizeof(height));
+		glad_glScissor(x, y, width, height);
+		break;
+	}
+	case 7: { /* glTexParameterf */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLfloat param;
+		readValue(replay, &param, sizeof(param));
+		glad_glTexParameterf(target, pname, param);
+		break;
+	}
+	case 8: { /* glTexParameterfv */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		const GLfloat *params = (const GLfloat *)readPointer(replay);
+		glad_glTexParameterfv(target, pname, params);
+		break;
+	}
+	case 9: { /* glTexParameteri */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint param;
+		readValue(replay, &param, sizeof(param));
+		glad_glTexParameteri(target, pname, param);
+		break;
+	}
+	case 10: { /* glTexParameteriv */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		const GLint *params = (const GLint *)readPointer(replay);
+		glad_glTexParameteriv(target, pname, params);
+		break;
+	}
+	case 11: { /* glTexImage1D */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLint level;
+		readValue(replay, &level, sizeof(level));
+		GLint internalformat;
+		readValue(replay, &internalformat, sizeof(internalformat));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLint border;
+		readValue(replay, &border, sizeof(border));
+		GLenum format;
+		readValue(replay, &format, sizeof(format));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		const void *pixels = (const void *)readPointer(replay);
+		glad_glTexImage1D(target, level, internalformat, width, border, format, type, pixels);
+		break;
+	}
+	case 12: { /* glTexImage2D */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLint level;
+		readValue(replay, &level, sizeof(level));
+		GLint internalformat;
+		readValue(replay, &internalformat, sizeof(internalformat));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLsizei height;
+		readValue(replay, &height, sizeof(height));
+		GLint border;
+		readValue(replay, &border, sizeof(border));
+		GLenum format;
+		readValue(replay, &format, sizeof(format));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		const void *pixels = (const void *)readPointer(replay);
+		glad_glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+		break;
+	}
+	case 13: { /* glDrawBuffer */
+		GLenum buf;
+		readValue(replay, &buf, sizeof(buf));
+		glad_glDrawBuffer(buf);
+		break;
+	}
+	case 14: { /* glClear */
+		GLbitfield mask;
+		readValue(replay, &mask, sizeof(mask));
+		glad_glClear(mask);
+		break;
+	}
+	case 15: { /* glClearColor */
+		GLfloat red;
+		readValue(replay, &red, sizeof(red));
+		GLfloat green;
+		readValue(replay, &green, sizeof(green));
+		GLfloat blue;
+		readValue(replay, &blue, sizeof(blue));
+		GLfloat alpha;
+		readValue(replay, &alpha, sizeof(alpha));
+		glad_glClearColor(red, green, blue, alpha);
+		break;
+	}
+	case 16: { /* glClearStencil */
+		GLint s;
+		readValue(replay, &s, sizeof(s));
+		glad_glClearStencil(s);
+		break;
+	}
+	case 17: { /* glClearDepth */
+		GLdouble depth;
+		readValue(replay, &depth, sizeof(depth));
+		glad_glClearDepth(depth);
+		break;
+	}
+	case 18: { /* glStencilMask */
+		GLuint mask;
+		readValue(replay, &mask, sizeof(mask));
+		glad_glStencilMask(mask);
+		break;
+	}
+	case 19: { /* glColorMask */
+		GLboolean red;
+		readValue(replay, &red, sizeof(red));
+		GLboolean green;
+		readValue(replay, &green, sizeof(green));
+		GLboolean blue;
+		readValue(replay, &blue, sizeof(blue));
+		GLboolean alpha;
+		readValue(replay, &alpha, sizeof(alpha));
+		glad_glColorMask(red, green, blue, alpha);
+		break;
+	}
+	case 20: { /* glDepthMask */
+		GLboolean flag;
+		readValue(replay, &flag, sizeof(flag));
+		glad_glDepthMask(flag);
+		break;
+	}
+	case 21: { /* glDisable */
+		GLenum cap;
+		readValue(replay, &cap, sizeof(cap));
+		glad_glDisable(cap);
+		break;
+	}
+	case 22: { /* glEnable */
+		GLenum cap;
+		readValue(replay, &cap, sizeof(cap));
+		glad_glEnable(cap);
+		break;
+	}
+	case 23: { /* glFinish */
+		glad_glFinish();
+		break;
+	}
+	case 24: { /* glFlush */
+		glad_glFlush();
+		break;
+	}
+	case 25: { /* glBlendFunc */
+		GLenum sfactor;
+		readValue(replay, &sfactor, sizeof(sfactor));
+		GLenum dfactor;
+		readValue(replay, &dfactor, sizeof(dfactor));
+		glad_glBlendFunc(sfactor, dfactor);
+		break;
+	}
+	case 26: { /* glLogicOp */
+		GLenum opcode;
+		readValue(replay, &opcode, sizeof(opcode));
+		glad_glLogicOp(opcode);
+		break;
+	}
+	case 27: { /* glStencilFunc */
+		GLenum func;
+		readValue(replay, &func, sizeof(func));
+		GLint ref;
+		readValue(replay, &ref, sizeof(ref));
+		GLuint mask;
+		readValue(replay, &mask, sizeof(mask));
+		glad_glStencilFunc(func, ref, mask);
+		break;
+	}
+	case 28: { /* glStencilOp */
+		GLenum fail;
+		readValue(replay, &fail, sizeof(fail));
+		GLenum zfail;
+		readValue(replay, &zfail, sizeof(zfail));
+		GLenum zpass;
+		readValue(replay, &zpass, sizeof(zpass));
+		glad_glStencilOp(fail, zfail, zpass);
+		break;
+	}
+	case 29: { /* glDepthFunc */
+		GLenum func;
+		readValue(replay, &func, sizeof(func));
+		glad_glDepthFunc(func);
+		break;
+	}
+	case 30: { /* glPixelStoref */
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLfloat param;
+		readValue(replay, &param, sizeof(param));
+		glad_glPixelStoref(pname, param);
+		break;
+	}
+	case 31: { /* glPixelStorei */
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint param;
+		readValue(replay, &param, sizeof(param));
+		glad_glPixelStorei(pname, param);
+		break;
+	}
+	case 32: { /* glReadBuffer */
+		GLenum src;
+		readValue(replay, &src, sizeof(src));
+		glad_glReadBuffer(src);
+		break;
+	}
+	case 33: { /* glReadPixels */
+		GLint x;
+		readValue(replay, &x, sizeof(x));
+		GLint y;
+		readValue(replay, &y, sizeof(y));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLsizei height;
+		readValue(replay, &height, sizeof(height));
+		GLenum format;
+		readValue(replay, &format, sizeof(format));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		void *pixels = (void *)readPointer(replay);
+		glad_glReadPixels(x, y, width, height, format, type, pixels);
+		break;
+	}
+	case 34: { /* glGetBooleanv */
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLboolean *data = (GLboolean *)readPointer(replay);
+		glad_glGetBooleanv(pname, data);
+		break;
+	}
+	case 35: { /* glGetDoublev */
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLdouble *data = (GLdouble *)readPointer(replay);
+		glad_glGetDoublev(pname, data);
+		break;
+	}
+	case 36: { /* glGetError */
+		GLenum result = glad_glGetError();
+
+		checkResult(replay, &result, sizeof(result));
+		break;
+	}
+	case 37: { /* glGetFloatv */
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLfloat *data = (GLfloat *)readPointer(replay);
+		glad_glGetFloatv(pname, data);
+		break;
+	}
+	case 38: { /* glGetIntegerv */
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint *data = (GLint *)readPointer(replay);
+		glad_glGetIntegerv(pname, data);
+		break;
+	}
+	case 39: { /* glGetString */
+		GLenum name;
+		readValue(replay, &name, sizeof(name));
+		glad_glGetString(name);
+		break;
+	}
+	case 41: { /* glGetTexParameterfv */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLfloat *params = (GLfloat *)readPointer(replay);
+		glad_glGetTexParameterfv(target, pname, params);
+		break;
+	}
+	case 42: { /* glGetTexParameteriv */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint *params = (GLint *)readPointer(replay);
+		glad_glGetTexParameteriv(target, pname, params);
+		break;
+	}
+	case 43: { /* glGetTexLevelParameterfv */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLint level;
+		readValue(replay, &level, sizeof(level));
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLfloat *params = (GLfloat *)readPointer(replay);
+		glad_glGetTexLevelParameterfv(target, level, pname, params);
+		break;
+	}
+	case 44: { /* glGetTexLevelParameteriv */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLint level;
+		readValue(replay, &level, sizeof(level));
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint *params = (GLint *)readPointer(replay);
+		glad_glGetTexLevelParameteriv(target, level, pname, params);
+		break;
+	}
+	case 45: { /* glIsEnabled */
+		GLenum cap;
+		readValue(replay, &cap, sizeof(cap));
+		GLboolean result = glad_glIsEnabled(cap);
+
+		checkResult(replay, &result, sizeof(result));
+		break;
+	}
+	case 46: { /* glDepthRange */
+		GLdouble n;
+		readValue(replay, &n, sizeof(n));
+		GLdouble f;
+		readValue(replay, &f, sizeof(f));
+		glad_glDepthRange(n, f);
+		break;
+	}
+	case 47: { /* glViewport */
+		GLint x;
+		readValue(replay, &x, sizeof(x));
+		GLint y;
+		readValue(replay, &y, sizeof(y));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLsizei height;
+		readValue(replay, &height, sizeof(height));
+		glad_glViewport(x, y, width, height);
+		break;
+	}
+	case 48: { /* glDrawArrays */
+		GLenum mode;
+		readValue(replay, &mode, sizeof(mode));
+		GLint first;
+		readValue(replay, &first, sizeof(first));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		glad_glDrawArrays(mode, first, count);
+		break;
+	}
+	case 49: { /* glDrawElements */
+		GLenum mode;
+		readValue(replay, &mode, sizeof(mode));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		const void *indices = (const void *)readPointer(replay);
+		glad_glDrawElements(mode, count, type, indices);
+		break;
+	}
+	case 50: { /* glPolygonOffset */
+		GLfloat factor;
+		readValue(replay, &factor, sizeof(factor));
+		GLfloat units;
+		readValue(replay, &units, sizeof(units));
+		glad_glPolygonOffset(factor, units);
+		break;
+	}
+	case 51: { /* glCopyTexImage1D */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLint level;
+		readValue(replay, &level, sizeof(level));
+		GLenum internalformat;
+		readValue(replay, &internalformat, sizeof(internalformat));
+		GLint x;
+		readValue(replay, &x, sizeof(x));
+		GLint y;
+		readValue(replay, &y, sizeof(y));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLint border;
+		readValue(replay, &border, sizeof(border));
+		glad_glCopyTexImage1D(target, level, internalformat, x, y, width, border);
+		break;
+	}
+	case 52: { /* glCopyTexImage2D */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLint level;
+		readValue(replay, &level, sizeof(level));
+		GLenum internalformat;
+		readValue(replay, &internalformat, sizeof(internalformat));
+		GLint x;
+		readValue(replay, &x, sizeof(x));
+		GLint y;
+		readValue(replay, &y, sizeof(y));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLsizei height;
+		readValue(replay, &height, sizeof(height));
+		GLint border;
+		readValue(replay, &border, sizeof(border));
+		glad_glCopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+		break;
+	}
+	case 53: { /* glCopyTexSubImage1D */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLint level;
+		readValue(replay, &level, sizeof(level));
+		GLint xoffset;
+		readValue(replay, &xoffset, sizeof(xoffset));
+		GLint x;
+		readValue(replay, &x, sizeof(x));
+		GLint y;
+		readValue(replay, &y, sizeof(y));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		glad_glCopyTexSubImage1D(target, level, xoffset, x, y, width);
+		break;
+	}
+	case 54: { /* glCopyTexSubImage2D */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLint level;
+		readValue(replay, &level, sizeof(level));
+		GLint xoffset;
+		readValue(replay, &xoffset, sizeof(xoffset));
+		GLint yoffset;
+		readValue(replay, &yoffset, sizeof(yoffset));
+		GLint x;
+		readValue(replay, &x, sizeof(x));
+		GLint y;
+		readValue(replay, &y, sizeof(y));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLsizei height;
+		readValue(replay, &height, sizeof(height));
+		glad_glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+		break;
+	}
+	case 55: { /* glTexSubImage1D */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLint level;
+		readValue(replay, &level, sizeof(level));
+		GLint xoffset;
+		readValue(replay, &xoffset, sizeof(xoffset));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLenum format;
+		readValue(replay, &format, sizeof(format));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		const void *pixels = (const void *)readPointer(replay);
+		glad_glTexSubImage1D(target, level, xoffset, width, format, type, pixels);
+		break;
+	}
+	case 56: { /* glTexSubImage2D */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLint level;
+		readValue(replay, &level, sizeof(level));
+		GLint xoffset;
+		readValue(replay, &xoffset, sizeof(xoffset));
+		GLint yoffset;
+		readValue(replay, &yoffset, sizeof(yoffset));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLsizei height;
+		readValue(replay, &height, sizeof(height));
+		GLenum format;
+		readValue(replay, &format, sizeof(format));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		const void *pixels = (const void *)readPointer(replay);
+		glad_glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+		break;
+	}
+	case 57: { /* glBindTexture */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		glad_glBindTexture(target, texture);
+		break;
+	}
+	case 58: { /* glDeleteTextures */
+		GLsizei n;
+		readValue(replay, &n, sizeof(n));
+		const GLuint *textures = (const GLuint *)readPointer(replay);
+		textures = mapNames(replay, NAME_TEXTURE, textures, n);
+		glad_glDeleteTextures(n, textures);
+		break;
+	}
+	case 59: { /* glGenTextures */
+		GLsizei n;
+		readValue(replay, &n, sizeof(n));
+		GLuint *textures = (GLuint *)readPointer(replay);
+		glad_glGenTextures(n, textures);
+		recordNames(replay, NAME_TEXTURE);
+		break;
+	}
+	case 60: { /* glIsTexture */
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		GLboolean result = glad_glIsTexture(texture);
+
+		checkResult(replay, &result, sizeof(result));
+		break;
+	}
+	case 61: { /* glDrawRangeElements */
+		GLenum mode;
+		readValue(replay, &mode, sizeof(mode));
+		GLuint start;
+		readValue(replay, &start, sizeof(start));
+		GLuint end;
+		readValue(replay, &end, sizeof(end));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		const void *indices = (const void *)readPointer(replay);
+		glad_glDrawRangeElements(mode, start, end, count, type, indices);
+		break;
+	}
+	case 62: { /* glTexImage3D */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLint level;
+		readValue(replay, &level, sizeof(level));
+		GLint internalformat;
+		readValue(replay, &internalformat, sizeof(internalformat));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLsizei height;
+		readValue(replay, &height, sizeof(height));
+		GLsizei depth;
+		readValue(replay, &depth, sizeof(depth));
+		GLint border;
+		readValue(replay, &border, sizeof(border));
+		GLenum format;
+		readValue(replay, &format, sizeof(format));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		const void *pixels = (const void *)readPointer(replay);
+		glad_glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+		break;
+	}
+	case 63: { /* glTexSubImage3D */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLint level;
+		readValue(replay, &level, sizeof(level));
+		GLint xoffset;
+		readValue(replay, &xoffset, sizeof(xoffset));
+		GLint yoffset;
+		readValue(replay, &yoffset, sizeof(yoffset));
+		GLint zoffset;
+		readValue(replay, &zoffset, sizeof(zoffset));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLsizei height;
+		readValue(replay, &height, sizeof(height));
+		GLsizei depth;
+		readValue(replay, &depth, sizeof(depth));
+		GLenum format;
+		readValue(replay, &format, sizeof(format));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		const void *pixels = (const void *)readPointer(replay);
+		glad_glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+		break;
+	}
+	case 64: { /* glCopyTexSubImage3D */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLint level;
+		readValue(replay, &level, sizeof(level));
+		GLint xoffset;
+		readValue(replay, &xoffset, sizeof(xoffset));
+		GLint yoffset;
+		readValue(replay, &yoffset, sizeof(yoffset));
+		GLint zoffset;
+		readValue(replay, &zoffset, sizeof(zoffset));
+		GLint x;
+		readValue(replay, &x, sizeof(x));
+		GLint y;
+		readValue(replay, &y, sizeof(y));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLsizei height;
+		readValue(replay, &height, sizeof(height));
+		glad_glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+		break;
+	}
+	case 65: { /* glActiveTexture */
+		GLenum texture;
+		readValue(replay, &texture, sizeof(texture));
+		glad_glActiveTexture(texture);
+		break;
+	}
+	case 66: { /* glSampleCoverage */
+		GLfloat value;
+		readValue(replay, &value, sizeof(value));
+		GLboolean invert;
+		readValue(replay, &invert, sizeof(invert));
+		glad_glSampleCoverage(value, invert);
+		break;
+	}
+	case 67: { /* glCompressedTexImage3D */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLint level;
+		readValue(replay, &level, sizeof(level));
+		GLenum internalformat;
+		readValue(replay, &internalformat, sizeof(internalformat));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLsizei height;
+		readValue(replay, &height, sizeof(height));
+		GLsizei depth;
+		readValue(replay, &depth, sizeof(depth));
+		GLint border;
+		readValue(replay, &border, sizeof(border));
+		GLsizei imageSize;
+		readValue(replay, &imageSize, sizeof(imageSize));
+		const void *data = (const void *)readPointer(replay);
+		glad_glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+		break;
+	}
+	case 68: { /* glCompressedTexImage2D */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLint level;
+		readValue(replay, &level, sizeof(level));
+		GLenum internalformat;
+		readValue(replay, &internalformat, sizeof(internalformat));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLsizei height;
+		readValue(replay, &height, sizeof(height));
+		GLint border;
+		readValue(replay, &border, sizeof(border));
+		GLsizei imageSize;
+		readValue(replay, &imageSize, sizeof(imageSize));
+		const void *data = (const void *)readPointer(replay);
+		glad_glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+		break;
+	}
+	case 69: { /* glCompressedTexImage1D */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLint level;
+		readValue(replay, &level, sizeof(level));
+		GLenum internalformat;
+		readValue(replay, &internalformat, sizeof(internalformat));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLint border;
+		readValue(replay, &border, sizeof(border));
+		GLsizei imageSize;
+		readValue(replay, &imageSize, sizeof(imageSize));
+		const void *data = (const void *)readPointer(replay);
+		glad_glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+		break;
+	}
+	case 70: { /* glCompressedTexSubImage3D */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLint level;
+		readValue(replay, &level, sizeof(level));
+		GLint xoffset;
+		readValue(replay, &xoffset, sizeof(xoffset));
+		GLint yoffset;
+		readValue(replay, &yoffset, sizeof(yoffset));
+		GLint zoffset;
+		readValue(replay, &zoffset, sizeof(zoffset));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLsizei height;
+		readValue(replay, &height, sizeof(height));
+		GLsizei depth;
+		readValue(replay, &depth, sizeof(depth));
+		GLenum format;
+		readValue(replay, &format, sizeof(format));
+		GLsizei imageSize;
+		readValue(replay, &imageSize, sizeof(imageSize));
+		const void *data = (const void *)readPointer(replay);
+		glad_glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+		break;
+	}
+	case 71: { /* glCompressedTexSubImage2D */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLint level;
+		readValue(replay, &level, sizeof(level));
+		GLint xoffset;
+		readValue(replay, &xoffset, sizeof(xoffset));
+		GLint yoffset;
+		readValue(replay, &yoffset, sizeof(yoffset));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLsizei height;
+		readValue(replay, &height, sizeof(height));
+		GLenum format;
+		readValue(replay, &format, sizeof(format));
+		GLsizei imageSize;
+		readValue(replay, &imageSize, sizeof(imageSize));
+		const void *data = (const void *)readPointer(replay);
+		glad_glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+		break;
+	}
+	case 72: { /* glCompressedTexSubImage1D */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLint level;
+		readValue(replay, &level, sizeof(level));
+		GLint xoffset;
+		readValue(replay, &xoffset, sizeof(xoffset));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLenum format;
+		readValue(replay, &format, sizeof(format));
+		GLsizei imageSize;
+		readValue(replay, &imageSize, sizeof(imageSize));
+		const void *data = (const void *)readPointer(replay);
+		glad_glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+		break;
+	}
+	case 74: { /* glBlendFuncSeparate */
+		GLenum sfactorRGB;
+		readValue(replay, &sfactorRGB, sizeof(sfactorRGB));
+		GLenum dfactorRGB;
+		readValue(replay, &dfactorRGB, sizeof(dfactorRGB));
+		GLenum sfactorAlpha;
+		readValue(replay, &sfactorAlpha, sizeof(sfactorAlpha));
+		GLenum dfactorAlpha;
+		readValue(replay, &dfactorAlpha, sizeof(dfactorAlpha));
+		glad_glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+		break;
+	}
+	case 75: { /* glMultiDrawArrays */
+		GLenum mode;
+		readValue(replay, &mode, sizeof(mode));
+		const GLint *first = (const GLint *)readPointer(replay);
+		const GLsizei *count = (const GLsizei *)readPointer(replay);
+		GLsizei drawcount;
+		readValue(replay, &drawcount, sizeof(drawcount));
+		glad_glMultiDrawArrays(mode, first, count, drawcount);
+		break;
+	}
+	case 76: { /* glMultiDrawElements */
+		GLenum mode;
+		readValue(replay, &mode, sizeof(mode));
+		const GLsizei *count = (const GLsizei *)readPointer(replay);
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		const void *const*indices = (const void *const*)readPointer(replay);
+		GLsizei drawcount;
+		readValue(replay, &drawcount, sizeof(drawcount));
+		glad_glMultiDrawElements(mode, count, type, indices, drawcount);
+		break;
+	}
+	case 77: { /* glPointParameterf */
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLfloat param;
+		readValue(replay, &param, sizeof(param));
+		glad_glPointParameterf(pname, param);
+		break;
+	}
+	case 78: { /* glPointParameterfv */
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		const GLfloat *params = (const GLfloat *)readPointer(replay);
+		glad_glPointParameterfv(pname, params);
+		break;
+	}
+	case 79: { /* glPointParameteri */
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint param;
+		readValue(replay, &param, sizeof(param));
+		glad_glPointParameteri(pname, param);
+		break;
+	}
+	case 80: { /* glPointParameteriv */
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		const GLint *params = (const GLint *)readPointer(replay);
+		glad_glPointParameteriv(pname, params);
+		break;
+	}
+	case 81: { /* glBlendColor */
+		GLfloat red;
+		readValue(replay, &red, sizeof(red));
+		GLfloat green;
+		readValue(replay, &green, sizeof(green));
+		GLfloat blue;
+		readValue(replay, &blue, sizeof(blue));
+		GLfloat alpha;
+		readValue(replay, &alpha, sizeof(alpha));
+		glad_glBlendColor(red, green, blue, alpha);
+		break;
+	}
+	case 82: { /* glBlendEquation */
+		GLenum mode;
+		readValue(replay, &mode, sizeof(mode));
+		glad_glBlendEquation(mode);
+		break;
+	}
+	case 83: { /* glGenQueries */
+		GLsizei n;
+		readValue(replay, &n, sizeof(n));
+		GLuint *ids = (GLuint *)readPointer(replay);
+		glad_glGenQueries(n, ids);
+		recordNames(replay, NAME_QUERY);
+		break;
+	}
+	case 84: { /* glDeleteQueries */
+		GLsizei n;
+		readValue(replay, &n, sizeof(n));
+		const GLuint *ids = (const GLuint *)readPointer(replay);
+		ids = mapNames(replay, NAME_QUERY, ids, n);
+		glad_glDeleteQueries(n, ids);
+		break;
+	}
+	case 85: { /* glIsQuery */
+		GLuint id;
+		readValue(replay, &id, sizeof(id));
+		id = mapName(replay, NAME_QUERY, id);
+		GLboolean result = glad_glIsQuery(id);
+
+		checkResult(replay, &result, sizeof(result));
+		break;
+	}
+	case 86: { /* glBeginQuery */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLuint id;
+		readValue(replay, &id, sizeof(id));
+		id = mapName(replay, NAME_QUERY, id);
+		glad_glBeginQuery(target, id);
+		break;
+	}
+	case 87: { /* glEndQuery */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		glad_glEndQuery(target);
+		break;
+	}
+	case 88: { /* glGetQueryiv */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint *params = (GLint *)readPointer(replay);
+		glad_glGetQueryiv(target, pname, params);
+		break;
+	}
+	case 89: { /* glGetQueryObjectiv */
+		GLuint id;
+		readValue(replay, &id, sizeof(id));
+		id = mapName(replay, NAME_QUERY, id);
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint *params = (GLint *)readPointer(replay);
+		glad_glGetQueryObjectiv(id, pname, params);
+		break;
+	}
+	case 90: { /* glGetQueryObjectuiv */
+		GLuint id;
+		readValue(replay, &id, sizeof(id));
+		id = mapName(replay, NAME_QUERY, id);
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLuint *params = (GLuint *)readPointer(replay);
+		glad_glGetQueryObjectuiv(id, pname, params);
+		break;
+	}
+	case 91: { /* glBindBuffer */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLuint buffer;
+		readValue(replay, &buffer, sizeof(buffer));
+		buffer = mapName(replay, NAME_BUFFER, buffer);
+		glad_glBindBuffer(target, buffer);
+		break;
+	}
+	case 92: { /* glDeleteBuffers */
+		GLsizei n;
+		readValue(replay, &n, sizeof(n));
+		const GLuint *buffers = (const GLuint *)readPointer(replay);
+		buffers = mapNames(replay, NAME_BUFFER, buffers, n);
+		glad_glDeleteBuffers(n, buffers);
+		break;
+	}
+	case 93: { /* glGenBuffers */
+		GLsizei n;
+		readValue(replay, &n, sizeof(n));
+		GLuint *buffers = (GLuint *)readPointer(replay);
+		glad_glGenBuffers(n, buffers);
+		recordNames(replay, NAME_BUFFER);
+		break;
+	}
+	case 94: { /* glIsBuffer */
+		GLuint buffer;
+		readValue(replay, &buffer, sizeof(buffer));
+		buffer = mapName(replay, NAME_BUFFER, buffer);
+		GLboolean result = glad_glIsBuffer(buffer);
+
+		checkResult(replay, &result, sizeof(result));
+		break;
+	}
+	case 95: { /* glBufferData */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLsizeiptr size;
+		readValue(replay, &size, sizeof(size));
+		const void *data = (const void *)readPointer(replay);
+		GLenum usage;
+		readValue(replay, &usage, sizeof(usage));
+		glad_glBufferData(target, size, data, usage);
+		break;
+	}
+	case 96: { /* glBufferSubData */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLintptr offset;
+		readValue(replay, &offset, sizeof(offset));
+		GLsizeiptr size;
+		readValue(replay, &size, sizeof(size));
+		const void *data = (const void *)readPointer(replay);
+		glad_glBufferSubData(target, offset, size, data);
+		break;
+	}
+	case 97: { /* glGetBufferSubData */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLintptr offset;
+		readValue(replay, &offset, sizeof(offset));
+		GLsizeiptr size;
+		readValue(replay, &size, sizeof(size));
+		void *data = (void *)readPointer(replay);
+		glad_glGetBufferSubData(target, offset, size, data);
+		break;
+	}
+	case 98: { /* glMapBuffer */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLenum access;
+		readValue(replay, &access, sizeof(access));
+		glad_glMapBuffer(target, access);
+		break;
+	}
+	case 99: { /* glUnmapBuffer */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLboolean result = glad_glUnmapBuffer(target);
+
+		checkResult(replay, &result, sizeof(result));
+		break;
+	}
+	case 100: { /* glGetBufferParameteriv */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint *params = (GLint *)readPointer(replay);
+		glad_glGetBufferParameteriv(target, pname, params);
+		break;
+	}
+	case 101: { /* glGetBufferPointerv */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		void **params = (void **)readPointer(replay);
+		glad_glGetBufferPointerv(target, pname, params);
+		break;
+	}
+	case 102: { /* glBlendEquationSeparate */
+		GLenum modeRGB;
+		readValue(replay, &modeRGB, sizeof(modeRGB));
+		GLenum modeAlpha;
+		readValue(replay, &modeAlpha, sizeof(modeAlpha));
+		glad_glBlendEquationSeparate(modeRGB, modeAlpha);
+		break;
+	}
+	case 103: { /* glDrawBuffers */
+		GLsizei n;
+		readValue(replay, &n, sizeof(n));
+		const GLenum *bufs = (const GLenum *)readPointer(replay);
+		glad_glDrawBuffers(n, bufs);
+		break;
+	}
+	case 104: { /* glStencilOpSeparate */
+		GLenum face;
+		readValue(replay, &face, sizeof(face));
+		GLenum sfail;
+		readValue(replay, &sfail, sizeof(sfail));
+		GLenum dpfail;
+		readValue(replay, &dpfail, sizeof(dpfail));
+		GLenum dppass;
+		readValue(replay, &dppass, sizeof(dppass));
+		glad_glStencilOpSeparate(face, sfail, dpfail, dppass);
+		break;
+	}
+	case 105: { /* glStencilFuncSeparate */
+		GLenum face;
+		readValue(replay, &face, sizeof(face));
+		GLenum func;
+		readValue(replay, &func, sizeof(func));
+		GLint ref;
+		readValue(replay, &ref, sizeof(ref));
+		GLuint mask;
+		readValue(replay, &mask, sizeof(mask));
+		glad_glStencilFuncSeparate(face, func, ref, mask);
+		break;
+	}
+	case 106: { /* glStencilMaskSeparate */
+		GLenum face;
+		readValue(replay, &face, sizeof(face));
+		GLuint mask;
+		readValue(replay, &mask, sizeof(mask));
+		glad_glStencilMaskSeparate(face, mask);
+		break;
+	}
+	case 107: { /* glAttachShader */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLuint shader;
+		readValue(replay, &shader, sizeof(shader));
+		shader = mapName(replay, NAME_PROGRAM, shader);
+		glad_glAttachShader(program, shader);
+		break;
+	}
+	case 108: { /* glBindAttribLocation */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		const GLchar *name = (const GLchar *)readPointer(replay);
+		glad_glBindAttribLocation(program, index, name);
+		break;
+	}
+	case 109: { /* glCompileShader */
+		GLuint shader;
+		readValue(replay, &shader, sizeof(shader));
+		shader = mapName(replay, NAME_PROGRAM, shader);
+		glad_glCompileShader(shader);
+		break;
+	}
+	case 110: { /* glCreateProgram */
+		mapResult(replay, NAME_PROGRAM, glad_glCreateProgram());
+		break;
+	}
+	case 111: { /* glCreateShader */
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		mapResult(replay, NAME_PROGRAM, glad_glCreateShader(type));
+		break;
+	}
+	case 112: { /* glDeleteProgram */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		glad_glDeleteProgram(program);
+		break;
+	}
+	case 113: { /* glDeleteShader */
+		GLuint shader;
+		readValue(replay, &shader, sizeof(shader));
+		shader = mapName(replay, NAME_PROGRAM, shader);
+		glad_glDeleteShader(shader);
+		break;
+	}
+	case 114: { /* glDetachShader */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLuint shader;
+		readValue(replay, &shader, sizeof(shader));
+		shader = mapName(replay, NAME_PROGRAM, shader);
+		glad_glDetachShader(program, shader);
+		break;
+	}
+	case 115: { /* glDisableVertexAttribArray */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		glad_glDisableVertexAttribArray(index);
+		break;
+	}
+	case 116: { /* glEnableVertexAttribArray */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		glad_glEnableVertexAttribArray(index);
+		break;
+	}
+	case 117: { /* glGetActiveAttrib */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLsizei bufSize;
+		readValue(replay, &bufSize, sizeof(bufSize));
+		GLsizei *length = (GLsizei *)readPointer(replay);
+		GLint *size = (GLint *)readPointer(replay);
+		GLenum *type = (GLenum *)readPointer(replay);
+		GLchar *name = (GLchar *)readPointer(replay);
+		glad_glGetActiveAttrib(program, index, bufSize, length, size, type, name);
+		break;
+	}
+	case 118: { /* glGetActiveUniform */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLsizei bufSize;
+		readValue(replay, &bufSize, sizeof(bufSize));
+		GLsizei *length = (GLsizei *)readPointer(replay);
+		GLint *size = (GLint *)readPointer(replay);
+		GLenum *type = (GLenum *)readPointer(replay);
+		GLchar *name = (GLchar *)readPointer(replay);
+		glad_glGetActiveUniform(program, index, bufSize, length, size, type, name);
+		break;
+	}
+	case 119: { /* glGetAttachedShaders */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLsizei maxCount;
+		readValue(replay, &maxCount, sizeof(maxCount));
+		GLsizei *count = (GLsizei *)readPointer(replay);
+		GLuint *shaders = (GLuint *)readPointer(replay);
+		glad_glGetAttachedShaders(program, maxCount, count, shaders);
+		break;
+	}
+	case 120: { /* glGetAttribLocation */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		const GLchar *name = (const GLchar *)readPointer(replay);
+		GLint result = glad_glGetAttribLocation(program, name);
+
+		checkResult(replay, &result, sizeof(result));
+		break;
+	}
+	case 121: { /* glGetProgramiv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint *params = (GLint *)readPointer(replay);
+		glad_glGetProgramiv(program, pname, params);
+		break;
+	}
+	case 122: { /* glGetProgramInfoLog */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLsizei bufSize;
+		readValue(replay, &bufSize, sizeof(bufSize));
+		GLsizei *length = (GLsizei *)readPointer(replay);
+		GLchar *infoLog = (GLchar *)readPointer(replay);
+		glad_glGetProgramInfoLog(program, bufSize, length, infoLog);
+		break;
+	}
+	case 123: { /* glGetShaderiv */
+		GLuint shader;
+		readValue(replay, &shader, sizeof(shader));
+		shader = mapName(replay, NAME_PROGRAM, shader);
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint *params = (GLint *)readPointer(replay);
+		glad_glGetShaderiv(shader, pname, params);
+		break;
+	}
+	case 124: { /* glGetShaderInfoLog */
+		GLuint shader;
+		readValue(replay, &shader, sizeof(shader));
+		shader = mapName(replay, NAME_PROGRAM, shader);
+		GLsizei bufSize;
+		readValue(replay, &bufSize, sizeof(bufSize));
+		GLsizei *length = (GLsizei *)readPointer(replay);
+		GLchar *infoLog = (GLchar *)readPointer(replay);
+		glad_glGetShaderInfoLog(shader, bufSize, length, infoLog);
+		break;
+	}
+	case 125: { /* glGetShaderSource */
+		GLuint shader;
+		readValue(replay, &shader, sizeof(shader));
+		shader = mapName(replay, NAME_PROGRAM, shader);
+		GLsizei bufSize;
+		readValue(replay, &bufSize, sizeof(bufSize));
+		GLsizei *length = (GLsizei *)readPointer(replay);
+		GLchar *source = (GLchar *)readPointer(replay);
+		glad_glGetShaderSource(shader, bufSize, length, source);
+		break;
+	}
+	case 126: { /* glGetUniformLocation */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		const GLchar *name = (const GLchar *)readPointer(replay);
+		GLint result = glad_glGetUniformLocation(program, name);
+
+		checkResult(replay, &result, sizeof(result));
+		break;
+	}
+	case 127: { /* glGetUniformfv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLfloat *params = (GLfloat *)readPointer(replay);
+		glad_glGetUniformfv(program, location, params);
+		break;
+	}
+	case 128: { /* glGetUniformiv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLint *params = (GLint *)readPointer(replay);
+		glad_glGetUniformiv(program, location, params);
+		break;
+	}
+	case 129: { /* glGetVertexAttribdv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLdouble *params = (GLdouble *)readPointer(replay);
+		glad_glGetVertexAttribdv(index, pname, params);
+		break;
+	}
+	case 130: { /* glGetVertexAttribfv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLfloat *params = (GLfloat *)readPointer(replay);
+		glad_glGetVertexAttribfv(index, pname, params);
+		break;
+	}
+	case 131: { /* glGetVertexAttribiv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint *params = (GLint *)readPointer(replay);
+		glad_glGetVertexAttribiv(index, pname, params);
+		break;
+	}
+	case 132: { /* glGetVertexAttribPointerv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		void **pointer = (void **)readPointer(replay);
+		glad_glGetVertexAttribPointerv(index, pname, pointer);
+		break;
+	}
+	case 133: { /* glIsProgram */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLboolean result = glad_glIsProgram(program);
+
+		checkResult(replay, &result, sizeof(result));
+		break;
+	}
+	case 134: { /* glIsShader */
+		GLuint shader;
+		readValue(replay, &shader, sizeof(shader));
+		shader = mapName(replay, NAME_PROGRAM, shader);
+		GLboolean result = glad_glIsShader(shader);
+
+		checkResult(replay, &result, sizeof(result));
+		break;
+	}
+	case 135: { /* glLinkProgram */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		glad_glLinkProgram(program);
+		break;
+	}
+	case 136: { /* glShaderSource */
+		GLuint shader;
+		readValue(replay, &shader, sizeof(shader));
+		shader = mapName(replay, NAME_PROGRAM, shader);
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLchar *const*string = (const GLchar *const*)readStrings(replay);
+		const GLint *length = (const GLint *)readPointer(replay);
+		glad_glShaderSource(shader, count, string, length);
+		break;
+	}
+	case 137: { /* glUseProgram */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		glad_glUseProgram(program);
+		break;
+	}
+	case 138: { /* glUniform1f */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLfloat v0;
+		readValue(replay, &v0, sizeof(v0));
+		glad_glUniform1f(location, v0);
+		break;
+	}
+	case 139: { /* glUniform2f */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLfloat v0;
+		readValue(replay, &v0, sizeof(v0));
+		GLfloat v1;
+		readValue(replay, &v1, sizeof(v1));
+		glad_glUniform2f(location, v0, v1);
+		break;
+	}
+	case 140: { /* glUniform3f */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLfloat v0;
+		readValue(replay, &v0, sizeof(v0));
+		GLfloat v1;
+		readValue(replay, &v1, sizeof(v1));
+		GLfloat v2;
+		readValue(replay, &v2, sizeof(v2));
+		glad_glUniform3f(location, v0, v1, v2);
+		break;
+	}
+	case 141: { /* glUniform4f */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLfloat v0;
+		readValue(replay, &v0, sizeof(v0));
+		GLfloat v1;
+		readValue(replay, &v1, sizeof(v1));
+		GLfloat v2;
+		readValue(replay, &v2, sizeof(v2));
+		GLfloat v3;
+		readValue(replay, &v3, sizeof(v3));
+		glad_glUniform4f(location, v0, v1, v2, v3);
+		break;
+	}
+	case 142: { /* glUniform1i */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLint v0;
+		readValue(replay, &v0, sizeof(v0));
+		glad_glUniform1i(location, v0);
+		break;
+	}
+	case 143: { /* glUniform2i */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLint v0;
+		readValue(replay, &v0, sizeof(v0));
+		GLint v1;
+		readValue(replay, &v1, sizeof(v1));
+		glad_glUniform2i(location, v0, v1);
+		break;
+	}
+	case 144: { /* glUniform3i */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLint v0;
+		readValue(replay, &v0, sizeof(v0));
+		GLint v1;
+		readValue(replay, &v1, sizeof(v1));
+		GLint v2;
+		readValue(replay, &v2, sizeof(v2));
+		glad_glUniform3i(location, v0, v1, v2);
+		break;
+	}
+	case 145: { /* glUniform4i */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLint v0;
+		readValue(replay, &v0, sizeof(v0));
+		GLint v1;
+		readValue(replay, &v1, sizeof(v1));
+		GLint v2;
+		readValue(replay, &v2, sizeof(v2));
+		GLint v3;
+		readValue(replay, &v3, sizeof(v3));
+		glad_glUniform4i(location, v0, v1, v2, v3);
+		break;
+	}
+	case 146: { /* glUniform1fv */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLfloat *value = (const GLfloat *)readPointer(replay);
+		glad_glUniform1fv(location, count, value);
+		break;
+	}
+	case 147: { /* glUniform2fv */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLfloat *value = (const GLfloat *)readPointer(replay);
+		glad_glUniform2fv(location, count, value);
+		break;
+	}
+	case 148: { /* glUniform3fv */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLfloat *value = (const GLfloat *)readPointer(replay);
+		glad_glUniform3fv(location, count, value);
+		break;
+	}
+	case 149: { /* glUniform4fv */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLfloat *value = (const GLfloat *)readPointer(replay);
+		glad_glUniform4fv(location, count, value);
+		break;
+	}
+	case 150: { /* glUniform1iv */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLint *value = (const GLint *)readPointer(replay);
+		glad_glUniform1iv(location, count, value);
+		break;
+	}
+	case 151: { /* glUniform2iv */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLint *value = (const GLint *)readPointer(replay);
+		glad_glUniform2iv(location, count, value);
+		break;
+	}
+	case 152: { /* glUniform3iv */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLint *value = (const GLint *)readPointer(replay);
+		glad_glUniform3iv(location, count, value);
+		break;
+	}
+	case 153: { /* glUniform4iv */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLint *value = (const GLint *)readPointer(replay);
+		glad_glUniform4iv(location, count, value);
+		break;
+	}
+	case 154: { /* glUniformMatrix2fv */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLboolean transpose;
+		readValue(replay, &transpose, sizeof(transpose));
+		const GLfloat *value = (const GLfloat *)readPointer(replay);
+		glad_glUniformMatrix2fv(location, count, transpose, value);
+		break;
+	}
+	case 155: { /* glUniformMatrix3fv */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLboolean transpose;
+		readValue(replay, &transpose, sizeof(transpose));
+		const GLfloat *value = (const GLfloat *)readPointer(replay);
+		glad_glUniformMatrix3fv(location, count, transpose, value);
+		break;
+	}
+	case 156: { /* glUniformMatrix4fv */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLboolean transpose;
+		readValue(replay, &transpose, sizeof(transpose));
+		const GLfloat *value = (const GLfloat *)readPointer(replay);
+		glad_glUniformMatrix4fv(location, count, transpose, value);
+		break;
+	}
+	case 157: { /* glValidateProgram */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		glad_glValidateProgram(program);
+		break;
+	}
+	case 158: { /* glVertexAttrib1d */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLdouble x;
+		readValue(replay, &x, sizeof(x));
+		glad_glVertexAttrib1d(index, x);
+		break;
+	}
+	case 159: { /* glVertexAttrib1dv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		const GLdouble *v = (const GLdouble *)readPointer(replay);
+		glad_glVertexAttrib1dv(index, v);
+		break;
+	}
+	case 160: { /* glVertexAttrib1f */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLfloat x;
+		readValue(replay, &x, sizeof(x));
+		glad_glVertexAttrib1f(index, x);
+		break;
+	}
+	case 161: { /* glVertexAttrib1fv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		const GLfloat *v = (const GLfloat *)readPointer(replay);
+		glad_glVertexAttrib1fv(index, v);
+		break;
+	}
+	case 162: { /* glVertexAttrib1s */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLshort x;
+		readValue(replay, &x, sizeof(x));
+		glad_glVertexAttrib1s(index, x);
+		break;
+	}
+	case 163: { /* glVertexAttrib1sv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		const GLshort *v = (const GLshort *)readPointer(replay);
+		glad_glVertexAttrib1sv(index, v);
+		break;
+	}
+	case 164: { /* glVertexAttrib2d */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLdouble x;
+		readValue(replay, &x, sizeof(x));
+		GLdouble y;
+		readValue(replay, &y, sizeof(y));
+		glad_glVertexAttrib2d(index, x, y);
+		break;
+	}
+	case 165: { /* glVertexAttrib2dv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		const GLdouble *v = (const GLdouble *)readPointer(replay);
+		glad_glVertexAttrib2dv(index, v);
+		break;
+	}
+	case 166: { /* glVertexAttrib2f */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLfloat x;
+		readValue(replay, &x, sizeof(x));
+		GLfloat y;
+		readValue(replay, &y, sizeof(y));
+		glad_glVertexAttrib2f(index, x, y);
+		break;
+	}
+	case 167: { /* glVertexAttrib2fv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		const GLfloat *v = (const GLfloat *)readPointer(replay);
+		glad_glVertexAttrib2fv(index, v);
+		break;
+	}
+	case 168: { /* glVertexAttrib2s */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLshort x;
+		readValue(replay, &x, sizeof(x));
+		GLshort y;
+		readValue(replay, &y, sizeof(y));
+		glad_glVertexAttrib2s(index, x, y);
+		break;
+	}
+	case 169: { /* glVertexAttrib2sv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		const GLshort *v = (const GLshort *)readPointer(replay);
+		glad_glVertexAttrib2sv(index, v);
+		break;
+	}
+	case 170: { /* glVertexAttrib3d */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLdouble x;
+		readValue(replay, &x, sizeof(x));
+		GLdouble y;
+		readValue(replay, &y, sizeof(y));
+		GLdouble z;
+		readValue(replay, &z, sizeof(z));
+		glad_glVertexAttrib3d(index, x, y, z);
+		break;
+	}
+	case 171: { /* glVertexAttrib3dv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		const GLdouble *v = (const GLdouble *)readPointer(replay);
+		glad_glVertexAttrib3dv(index, v);
+		break;
+	}
+	case 172: { /* glVertexAttrib3f */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLfloat x;
+		readValue(replay, &x, sizeof(x));
+		GLfloat y;
+		readValue(replay, &y, sizeof(y));
+		GLfloat z;
+		readValue(replay, &z, sizeof(z));
+		glad_glVertexAttrib3f(index, x, y, z);
+		break;
+	}
+	case 173: { /* glVertexAttrib3fv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		const GLfloat *v = (const GLfloat *)readPointer(replay);
+		glad_glVertexAttrib3fv(index, v);
+		break;
+	}
+	case 174: { /* glVertexAttrib3s */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLshort x;
+		readValue(replay, &x, sizeof(x));
+		GLshort y;
+		readValue(replay, &y, sizeof(y));
+		GLshort z;
+		readValue(replay, &z, sizeof(z));
+		glad_glVertexAttrib3s(index, x, y, z);
+		break;
+	}
+	case 175: { /* glVertexAttrib3sv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		const GLshort *v = (const GLshort *)readPointer(replay);
+		glad_glVertexAttrib3sv(index, v);
+		break;
+	}
+	case 176: { /* glVertexAttrib4Nbv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		const GLbyte *v = (const GLbyte *)readPointer(replay);
+		glad_glVertexAttrib4Nbv(index, v);
+		break;
+	}
+	case 177: { /* glVertexAttrib4Niv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		const GLint *v = (const GLint *)readPointer(replay);
+		glad_glVertexAttrib4Niv(index, v);
+		break;
+	}
+	case 178: { /* glVertexAttrib4Nsv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		const GLshort *v = (const GLshort *)readPointer(replay);
+		glad_glVertexAttrib4Nsv(index, v);
+		break;
+	}
+	case 179: { /* glVertexAttrib4Nub */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLubyte x;
+		readValue(replay, &x, sizeof(x));
+		GLubyte y;
+		readValue(replay, &y, sizeof(y));
+		GLubyte z;
+		readValue(replay, &z, sizeof(z));
+		GLubyte w;
+		readValue(replay, &w, sizeof(w));
+		glad_glVertexAttrib4Nub(index, x, y, z, w);
+		break;
+	}
+	case 180: { /* glVertexAttrib4Nubv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		const GLubyte *v = (const GLubyte *)readPointer(replay);
+		glad_glVertexAttrib4Nubv(index, v);
+		break;
+	}
+	case 181: { /* glVertexAttrib4Nuiv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		const GLuint *v = (const GLuint *)readPointer(replay);
+		glad_glVertexAttrib4Nuiv(index, v);
+		break;
+	}
+	case 182: { /* glVertexAttrib4Nusv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		const GLushort *v = (const GLushort *)readPointer(replay);
+		glad_glVertexAttrib4Nusv(index, v);
+		break;
+	}
+	case 183: { /* glVertexAttrib4bv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		const GLbyte *v = (const GLbyte *)readPointer(replay);
+		glad_glVertexAttrib4bv(index, v);
+		break;
+	}
+	case 184: { /* glVertexAttrib4d */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLdouble x;
+		readValue(replay, &x, sizeof(x));
+		GLdouble y;
+		readValue(replay, &y, sizeof(y));
+		GLdouble z;
+		readValue(replay, &z, sizeof(z));
+		GLdouble w;
+		readValue(replay, &w, sizeof(w));
+		glad_glVertexAttrib4d(index, x, y, z, w);
+		break;
+	}
+	case 185: { /* glVertexAttrib4dv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		const GLdouble *v = (const GLdouble *)readPointer(replay);
+		glad_glVertexAttrib4dv(index, v);
+		break;
+	}
+	case 186: { /* glVertexAttrib4f */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLfloat x;
+		readValue(replay, &x, sizeof(x));
+		GLfloat y;
+		readValue(replay, &y, sizeof(y));
+		GLfloat z;
+		readValue(replay, &z, sizeof(z));
+		GLfloat w;
+		readValue(replay, &w, sizeof(w));
+		glad_glVertexAttrib4f(index, x, y, z, w);
+		break;
+	}
+	case 187: { /* glVertexAttrib4fv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		const GLfloat *v = (const GLfloat *)readPointer(replay);
+		glad_glVertexAttrib4fv(index, v);
+		break;
+	}
+	case 188: { /* glVertexAttrib4iv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		const GLint *v = (const GLint *)readPointer(replay);
+		glad_glVertexAttrib4iv(index, v);
+		break;
+	}
+	case 189: { /* glVertexAttrib4s */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLshort x;
+		readValue(replay, &x, sizeof(x));
+		GLshort y;
+		readValue(replay, &y, sizeof(y));
+		GLshort z;
+		readValue(replay, &z, sizeof(z));
+		GLshort w;
+		readValue(replay, &w, sizeof(w));
+		glad_glVertexAttrib4s(index, x, y, z, w);
+		break;
+	}
+	case 190: { /* glVertexAttrib4sv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		const GLshort *v = (const GLshort *)readPointer(replay);
+		glad_glVertexAttrib4sv(index, v);
+		break;
+	}
+	case 191: { /* glVertexAttrib4ubv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		const GLubyte *v = (const GLubyte *)readPointer(replay);
+		glad_glVertexAttrib4ubv(index, v);
+		break;
+	}
+	case 192: { /* glVertexAttrib4uiv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		const GLuint *v = (const GLuint *)readPointer(replay);
+		glad_glVertexAttrib4uiv(index, v);
+		break;
+	}
+	case 193: { /* glVertexAttrib4usv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		const GLushort *v = (const GLushort *)readPointer(replay);
+		glad_glVertexAttrib4usv(index, v);
+		break;
+	}
+	case 194: { /* glVertexAttribPointer */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLint size;
+		readValue(replay, &size, sizeof(size));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		GLboolean normalized;
+		readValue(replay, &normalized, sizeof(normalized));
+		GLsizei stride;
+		readValue(replay, &stride, sizeof(stride));
+		const void *pointer = (const void *)readPointer(replay);
+		glad_glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+		break;
+	}
+	case 195: { /* glUniformMatrix2x3fv */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLboolean transpose;
+		readValue(replay, &transpose, sizeof(transpose));
+		const GLfloat *value = (const GLfloat *)readPointer(replay);
+		glad_glUniformMatrix2x3fv(location, count, transpose, value);
+		break;
+	}
+	case 196: { /* glUniformMatrix3x2fv */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLboolean transpose;
+		readValue(replay, &transpose, sizeof(transpose));
+		const GLfloat *value = (const GLfloat *)readPointer(replay);
+		glad_glUniformMatrix3x2fv(location, count, transpose, value);
+		break;
+	}
+	case 197: { /* glUniformMatrix2x4fv */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLboolean transpose;
+		readValue(replay, &transpose, sizeof(transpose));
+		const GLfloat *value = (const GLfloat *)readPointer(replay);
+		glad_glUniformMatrix2x4fv(location, count, transpose, value);
+		break;
+	}
+	case 198: { /* glUniformMatrix4x2fv */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLboolean transpose;
+		readValue(replay, &transpose, sizeof(transpose));
+		const GLfloat *value = (const GLfloat *)readPointer(replay);
+		glad_glUniformMatrix4x2fv(location, count, transpose, value);
+		break;
+	}
+	case 199: { /* glUniformMatrix3x4fv */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLboolean transpose;
+		readValue(replay, &transpose, sizeof(transpose));
+		const GLfloat *value = (const GLfloat *)readPointer(replay);
+		glad_glUniformMatrix3x4fv(location, count, transpose, value);
+		break;
+	}
+	case 200: { /* glUniformMatrix4x3fv */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLboolean transpose;
+		readValue(replay, &transpose, sizeof(transpose));
+		const GLfloat *value = (const GLfloat *)readPointer(replay);
+		glad_glUniformMatrix4x3fv(location, count, transpose, value);
+		break;
+	}
+	case 201: { /* glColorMaski */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLboolean r;
+		readValue(replay, &r, sizeof(r));
+		GLboolean g;
+		readValue(replay, &g, sizeof(g));
+		GLboolean b;
+		readValue(replay, &b, sizeof(b));
+		GLboolean a;
+		readValue(replay, &a, sizeof(a));
+		glad_glColorMaski(index, r, g, b, a);
+		break;
+	}
+	case 202: { /* glGetBooleani_v */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLboolean *data = (GLboolean *)readPointer(replay);
+		glad_glGetBooleani_v(target, index, data);
+		break;
+	}
+	case 203: { /* glGetIntegeri_v */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLint *data = (GLint *)readPointer(replay);
+		glad_glGetIntegeri_v(target, index, data);
+		break;
+	}
+	case 204: { /* glEnablei */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		glad_glEnablei(target, index);
+		break;
+	}
+	case 205: { /* glDisablei */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		glad_glDisablei(target, index);
+		break;
+	}
+	case 206: { /* glIsEnabledi */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLboolean result = glad_glIsEnabledi(target, index);
+
+		checkResult(replay, &result, sizeof(result));
+		break;
+	}
+	case 207: { /* glBeginTransformFeedback */
+		GLenum primitiveMode;
+		readValue(replay, &primitiveMode, sizeof(primitiveMode));
+		glad_glBeginTransformFeedback(primitiveMode);
+		break;
+	}
+	case 208: { /* glEndTransformFeedback */
+		glad_glEndTransformFeedback();
+		break;
+	}
+	case 209: { /* glBindBufferRange */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLuint buffer;
+		readValue(replay, &buffer, sizeof(buffer));
+		buffer = mapName(replay, NAME_BUFFER, buffer);
+		GLintptr offset;
+		readValue(replay, &offset, sizeof(offset));
+		GLsizeiptr size;
+		readValue(replay, &size, sizeof(size));
+		glad_glBindBufferRange(target, index, buffer, offset, size);
+		break;
+	}
+	case 210: { /* glBindBufferBase */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLuint buffer;
+		readValue(replay, &buffer, sizeof(buffer));
+		buffer = mapName(replay, NAME_BUFFER, buffer);
+		glad_glBindBufferBase(target, index, buffer);
+		break;
+	}
+	case 211: { /* glTransformFeedbackVaryings */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLchar *const*varyings = (const GLchar *const*)readStrings(replay);
+		GLenum bufferMode;
+		readValue(replay, &bufferMode, sizeof(bufferMode));
+		glad_glTransformFeedbackVaryings(program, count, varyings, bufferMode);
+		break;
+	}
+	case 212: { /* glGetTransformFeedbackVarying */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLsizei bufSize;
+		readValue(replay, &bufSize, sizeof(bufSize));
+		GLsizei *length = (GLsizei *)readPointer(replay);
+		GLsizei *size = (GLsizei *)readPointer(replay);
+		GLenum *type = (GLenum *)readPointer(replay);
+		GLchar *name = (GLchar *)readPointer(replay);
+		glad_glGetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+		break;
+	}
+	case 213: { /* glClampColor */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLenum clamp;
+		readValue(replay, &clamp, sizeof(clamp));
+		glad_glClampColor(target, clamp);
+		break;
+	}
+	case 214: { /* glBeginConditionalRender */
+		GLuint id;
+		readValue(replay, &id, sizeof(id));
+		GLenum mode;
+		readValue(replay, &mode, sizeof(mode));
+		glad_glBeginConditionalRender(id, mode);
+		break;
+	}
+	case 215: { /* glEndConditionalRender */
+		glad_glEndConditionalRender();
+		break;
+	}
+	case 216: { /* glVertexAttribIPointer */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLint size;
+		readValue(replay, &size, sizeof(size));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		GLsizei stride;
+		readValue(replay, &stride, sizeof(stride));
+		const void *pointer = (const void *)readPointer(replay);
+		glad_glVertexAttribIPointer(index, size, type, stride, pointer);
+		break;
+	}
+	case 217: { /* glGetVertexAttribIiv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint *params = (GLint *)readPointer(replay);
+		glad_glGetVertexAttribIiv(index, pname, params);
+		break;
+	}
+	case 218: { /* glGetVertexAttribIuiv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLuint *params = (GLuint *)readPointer(replay);
+		glad_glGetVertexAttribIuiv(index, pname, params);
+		break;
+	}
+	case 219: { /* glVertexAttribI1i */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLint x;
+		readValue(replay, &x, sizeof(x));
+		glad_glVertexAttribI1i(index, x);
+		break;
+	}
+	case 220: { /* glVertexAttribI2i */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLint x;
+		readValue(replay, &x, sizeof(x));
+		GLint y;
+		readValue(replay, &y, sizeof(y));
+		glad_glVertexAttribI2i(index, x, y);
+		break;
+	}
+	case 221: { /* glVertexAttribI3i */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLint x;
+		readValue(replay, &x, sizeof(x));
+		GLint y;
+		readValue(replay, &y, sizeof(y));
+		GLint z;
+		readValue(replay, &z, sizeof(z));
+		glad_glVertexAttribI3i(index, x, y, z);
+		break;
+	}
+	case 222: { /* glVertexAttribI4i */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLint x;
+		readValue(replay, &x, sizeof(x));
+		GLint y;
+		readValue(replay, &y, sizeof(y));
+		GLint z;
+		readValue(replay, &z, sizeof(z));
+		GLint w;
+		readValue(replay, &w, sizeof(w));
+		glad_glVertexAttribI4i(index, x, y, z, w);
+		break;
+	}
+	case 223: { /* glVertexAttribI1ui */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLuint x;
+		readValue(replay, &x, sizeof(x));
+		glad_glVertexAttribI1ui(index, x);
+		break;
+	}
+	case 224: { /* glVertexAttribI2ui */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLuint x;
+		readValue(replay, &x, sizeof(x));
+		GLuint y;
+		readValue(replay, &y, sizeof(y));
+		glad_glVertexAttribI2ui(index, x, y);
+		break;
+	}
+	case 225: { /* glVertexAttribI3ui */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLuint x;
+		readValue(replay, &x, sizeof(x));
+		GLuint y;
+		readValue(replay, &y, sizeof(y));
+		GLuint z;
+		readValue(replay, &z, sizeof(z));
+		glad_glVertexAttribI3ui(index, x, y, z);
+		break;
+	}
+	case 226: { /* glVertexAttribI4ui */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLuint x;
+		readValue(replay, &x, sizeof(x));
+		GLuint y;
+		readValue(replay, &y, sizeof(y));
+		GLuint z;
+		readValue(replay, &z, sizeof(z));
+		GLuint w;
+		readValue(replay, &w, sizeof(w));
+		glad_glVertexAttribI4ui(index, x, y, z, w);
+		break;
+	}
+	case 227: { /* glVertexAttribI1iv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		const GLint *v = (const GLint *)readPointer(replay);
+		glad_glVertexAttribI1iv(index, v);
+		break;
+	}
+	case 228: { /* glVertexAttribI2iv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		const GLint *v = (const GLint *)readPointer(replay);
+		glad_glVertexAttribI2iv(index, v);
+		break;
+	}
+	case 229: { /* glVertexAttribI3iv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		const GLint *v = (const GLint *)readPointer(replay);
+		glad_glVertexAttribI3iv(index, v);
+		break;
+	}
+	case 230: { /* glVertexAttribI4iv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		const GLint *v = (const GLint *)readPointer(replay);
+		glad_glVertexAttribI4iv(index, v);
+		break;
+	}
+	case 231: { /* glVertexAttribI1uiv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		const GLuint *v = (const GLuint *)readPointer(replay);
+		glad_glVertexAttribI1uiv(index, v);
+		break;
+	}
+	case 232: { /* glVertexAttribI2uiv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		const GLuint *v = (const GLuint *)readPointer(replay);
+		glad_glVertexAttribI2uiv(index, v);
+		break;
+	}
+	case 233: { /* glVertexAttribI3uiv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		const GLuint *v = (const GLuint *)readPointer(replay);
+		glad_glVertexAttribI3uiv(index, v);
+		break;
+	}
+	case 234: { /* glVertexAttribI4uiv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		const GLuint *v = (const GLuint *)readPointer(replay);
+		glad_glVertexAttribI4uiv(index, v);
+		break;
+	}
+	case 235: { /* glVertexAttribI4bv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		const GLbyte *v = (const GLbyte *)readPointer(replay);
+		glad_glVertexAttribI4bv(index, v);
+		break;
+	}
+	case 236: { /* glVertexAttribI4sv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		const GLshort *v = (const GLshort *)readPointer(replay);
+		glad_glVertexAttribI4sv(index, v);
+		break;
+	}
+	case 237: { /* glVertexAttribI4ubv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		const GLubyte *v = (const GLubyte *)readPointer(replay);
+		glad_glVertexAttribI4ubv(index, v);
+		break;
+	}
+	case 238: { /* glVertexAttribI4usv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		const GLushort *v = (const GLushort *)readPointer(replay);
+		glad_glVertexAttribI4usv(index, v);
+		break;
+	}
+	case 239: { /* glGetUniformuiv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLuint *params = (GLuint *)readPointer(replay);
+		glad_glGetUniformuiv(program, location, params);
+		break;
+	}
+	case 240: { /* glBindFragDataLocation */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLuint color;
+		readValue(replay, &color, sizeof(color));
+		const GLchar *name = (const GLchar *)readPointer(replay);
+		glad_glBindFragDataLocation(program, color, name);
+		break;
+	}
+	case 241: { /* glGetFragDataLocation */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		const GLchar *name = (const GLchar *)readPointer(replay);
+		GLint result = glad_glGetFragDataLocation(program, name);
+
+		checkResult(replay, &result, sizeof(result));
+		break;
+	}
+	case 242: { /* glUniform1ui */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLuint v0;
+		readValue(replay, &v0, sizeof(v0));
+		glad_glUniform1ui(location, v0);
+		break;
+	}
+	case 243: { /* glUniform2ui */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLuint v0;
+		readValue(replay, &v0, sizeof(v0));
+		GLuint v1;
+		readValue(replay, &v1, sizeof(v1));
+		glad_glUniform2ui(location, v0, v1);
+		break;
+	}
+	case 244: { /* glUniform3ui */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLuint v0;
+		readValue(replay, &v0, sizeof(v0));
+		GLuint v1;
+		readValue(replay, &v1, sizeof(v1));
+		GLuint v2;
+		readValue(replay, &v2, sizeof(v2));
+		glad_glUniform3ui(location, v0, v1, v2);
+		break;
+	}
+	case 245: { /* glUniform4ui */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLuint v0;
+		readValue(replay, &v0, sizeof(v0));
+		GLuint v1;
+		readValue(replay, &v1, sizeof(v1));
+		GLuint v2;
+		readValue(replay, &v2, sizeof(v2));
+		GLuint v3;
+		readValue(replay, &v3, sizeof(v3));
+		glad_glUniform4ui(location, v0, v1, v2, v3);
+		break;
+	}
+	case 246: { /* glUniform1uiv */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLuint *value = (const GLuint *)readPointer(replay);
+		glad_glUniform1uiv(location, count, value);
+		break;
+	}
+	case 247: { /* glUniform2uiv */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLuint *value = (const GLuint *)readPointer(replay);
+		glad_glUniform2uiv(location, count, value);
+		break;
+	}
+	case 248: { /* glUniform3uiv */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLuint *value = (const GLuint *)readPointer(replay);
+		glad_glUniform3uiv(location, count, value);
+		break;
+	}
+	case 249: { /* glUniform4uiv */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLuint *value = (const GLuint *)readPointer(replay);
+		glad_glUniform4uiv(location, count, value);
+		break;
+	}
+	case 250: { /* glTexParameterIiv */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		const GLint *params = (const GLint *)readPointer(replay);
+		glad_glTexParameterIiv(target, pname, params);
+		break;
+	}
+	case 251: { /* glTexParameterIuiv */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		const GLuint *params = (const GLuint *)readPointer(replay);
+		glad_glTexParameterIuiv(target, pname, params);
+		break;
+	}
+	case 252: { /* glGetTexParameterIiv */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint *params = (GLint *)readPointer(replay);
+		glad_glGetTexParameterIiv(target, pname, params);
+		break;
+	}
+	case 253: { /* glGetTexParameterIuiv */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLuint *params = (GLuint *)readPointer(replay);
+		glad_glGetTexParameterIuiv(target, pname, params);
+		break;
+	}
+	case 254: { /* glClearBufferiv */
+		GLenum buffer;
+		readValue(replay, &buffer, sizeof(buffer));
+		GLint drawbuffer;
+		readValue(replay, &drawbuffer, sizeof(drawbuffer));
+		const GLint *value = (const GLint *)readPointer(replay);
+		glad_glClearBufferiv(buffer, drawbuffer, value);
+		break;
+	}
+	case 255: { /* glClearBufferuiv */
+		GLenum buffer;
+		readValue(replay, &buffer, sizeof(buffer));
+		GLint drawbuffer;
+		readValue(replay, &drawbuffer, sizeof(drawbuffer));
+		const GLuint *value = (const GLuint *)readPointer(replay);
+		glad_glClearBufferuiv(buffer, drawbuffer, value);
+		break;
+	}
+	case 256: { /* glClearBufferfv */
+		GLenum buffer;
+		readValue(replay, &buffer, sizeof(buffer));
+		GLint drawbuffer;
+		readValue(replay, &drawbuffer, sizeof(drawbuffer));
+		const GLfloat *value = (const GLfloat *)readPointer(replay);
+		glad_glClearBufferfv(buffer, drawbuffer, value);
+		break;
+	}
+	case 257: { /* glClearBufferfi */
+		GLenum buffer;
+		readValue(replay, &buffer, sizeof(buffer));
+		GLint drawbuffer;
+		readValue(replay, &drawbuffer, sizeof(drawbuffer));
+		GLfloat depth;
+		readValue(replay, &depth, sizeof(depth));
+		GLint stencil;
+		readValue(replay, &stencil, sizeof(stencil));
+		glad_glClearBufferfi(buffer, drawbuffer, depth, stencil);
+		break;
+	}
+	case 258: { /* glGetStringi */
+		GLenum name;
+		readValue(replay, &name, sizeof(name));
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		glad_glGetStringi(name, index);
+		break;
+	}
+	case 259: { /* glIsRenderbuffer */
+		GLuint renderbuffer;
+		readValue(replay, &renderbuffer, sizeof(renderbuffer));
+		renderbuffer = mapName(replay, NAME_RENDERBUFFER, renderbuffer);
+		GLboolean result = glad_glIsRenderbuffer(renderbuffer);
+
+		checkResult(replay, &result, sizeof(result));
+		break;
+	}
+	case 260: { /* glBindRenderbuffer */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLuint renderbuffer;
+		readValue(replay, &renderbuffer, sizeof(renderbuffer));
+		renderbuffer = mapName(replay, NAME_RENDERBUFFER, renderbuffer);
+		glad_glBindRenderbuffer(target, renderbuffer);
+		break;
+	}
+	case 261: { /* glDeleteRenderbuffers */
+		GLsizei n;
+		readValue(replay, &n, sizeof(n));
+		const GLuint *renderbuffers = (const GLuint *)readPointer(replay);
+		renderbuffers = mapNames(replay, NAME_RENDERBUFFER, renderbuffers, n);
+		glad_glDeleteRenderbuffers(n, renderbuffers);
+		break;
+	}
+	case 262: { /* glGenRenderbuffers */
+		GLsizei n;
+		readValue(replay, &n, sizeof(n));
+		GLuint *renderbuffers = (GLuint *)readPointer(replay);
+		glad_glGenRenderbuffers(n, renderbuffers);
+		recordNames(replay, NAME_RENDERBUFFER);
+		break;
+	}
+	case 263: { /* glRenderbufferStorage */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLenum internalformat;
+		readValue(replay, &internalformat, sizeof(internalformat));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLsizei height;
+		readValue(replay, &height, sizeof(height));
+		glad_glRenderbufferStorage(target, internalformat, width, height);
+		break;
+	}
+	case 264: { /* glGetRenderbufferParameteriv */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint *params = (GLint *)readPointer(replay);
+		glad_glGetRenderbufferParameteriv(target, pname, params);
+		break;
+	}
+	case 265: { /* glIsFramebuffer */
+		GLuint framebuffer;
+		readValue(replay, &framebuffer, sizeof(framebuffer));
+		framebuffer = mapName(replay, NAME_FRAMEBUFFER, framebuffer);
+		GLboolean result = glad_glIsFramebuffer(framebuffer);
+
+		checkResult(replay, &result, sizeof(result));
+		break;
+	}
+	case 266: { /* glBindFramebuffer */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLuint framebuffer;
+		readValue(replay, &framebuffer, sizeof(framebuffer));
+		framebuffer = mapName(replay, NAME_FRAMEBUFFER, framebuffer);
+		glad_glBindFramebuffer(target, framebuffer);
+		break;
+	}
+	case 267: { /* glDeleteFramebuffers */
+		GLsizei n;
+		readValue(replay, &n, sizeof(n));
+		const GLuint *framebuffers = (const GLuint *)readPointer(replay);
+		framebuffers = mapNames(replay, NAME_FRAMEBUFFER, framebuffers, n);
+		glad_glDeleteFramebuffers(n, framebuffers);
+		break;
+	}
+	case 268: { /* glGenFramebuffers */
+		GLsizei n;
+		readValue(replay, &n, sizeof(n));
+		GLuint *framebuffers = (GLuint *)readPointer(replay);
+		glad_glGenFramebuffers(n, framebuffers);
+		recordNames(replay, NAME_FRAMEBUFFER);
+		break;
+	}
+	case 269: { /* glCheckFramebufferStatus */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLenum result = glad_glCheckFramebufferStatus(target);
+
+		checkResult(replay, &result, sizeof(result));
+		break;
+	}
+	case 270: { /* glFramebufferTexture1D */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLenum attachment;
+		readValue(replay, &attachment, sizeof(attachment));
+		GLenum textarget;
+		readValue(replay, &textarget, sizeof(textarget));
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		GLint level;
+		readValue(replay, &level, sizeof(level));
+		glad_glFramebufferTexture1D(target, attachment, textarget, texture, level);
+		break;
+	}
+	case 271: { /* glFramebufferTexture2D */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLenum attachment;
+		readValue(replay, &attachment, sizeof(attachment));
+		GLenum textarget;
+		readValue(replay, &textarget, sizeof(textarget));
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		GLint level;
+		readValue(replay, &level, sizeof(level));
+		glad_glFramebufferTexture2D(target, attachment, textarget, texture, level);
+		break;
+	}
+	case 272: { /* glFramebufferTexture3D */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLenum attachment;
+		readValue(replay, &attachment, sizeof(attachment));
+		GLenum textarget;
+		readValue(replay, &textarget, sizeof(textarget));
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		GLint level;
+		readValue(replay, &level, sizeof(level));
+		GLint zoffset;
+		readValue(replay, &zoffset, sizeof(zoffset));
+		glad_glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+		break;
+	}
+	case 273: { /* glFramebufferRenderbuffer */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLenum attachment;
+		readValue(replay, &attachment, sizeof(attachment));
+		GLenum renderbuffertarget;
+		readValue(replay, &renderbuffertarget, sizeof(renderbuffertarget));
+		GLuint renderbuffer;
+		readValue(replay, &renderbuffer, sizeof(renderbuffer));
+		renderbuffer = mapName(replay, NAME_RENDERBUFFER, renderbuffer);
+		glad_glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+		break;
+	}
+	case 274: { /* glGetFramebufferAttachmentParameteriv */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLenum attachment;
+		readValue(replay, &attachment, sizeof(attachment));
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint *params = (GLint *)readPointer(replay);
+		glad_glGetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+		break;
+	}
+	case 275: { /* glGenerateMipmap */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		glad_glGenerateMipmap(target);
+		break;
+	}
+	case 276: { /* glBlitFramebuffer */
+		GLint srcX0;
+		readValue(replay, &srcX0, sizeof(srcX0));
+		GLint srcY0;
+		readValue(replay, &srcY0, sizeof(srcY0));
+		GLint srcX1;
+		readValue(replay, &srcX1, sizeof(srcX1));
+		GLint srcY1;
+		readValue(replay, &srcY1, sizeof(srcY1));
+		GLint dstX0;
+		readValue(replay, &dstX0, sizeof(dstX0));
+		GLint dstY0;
+		readValue(replay, &dstY0, sizeof(dstY0));
+		GLint dstX1;
+		readValue(replay, &dstX1, sizeof(dstX1));
+		GLint dstY1;
+		readValue(replay, &dstY1, sizeof(dstY1));
+		GLbitfield mask;
+		readValue(replay, &mask, sizeof(mask));
+		GLenum filter;
+		readValue(replay, &filter, sizeof(filter));
+		glad_glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+		break;
+	}
+	case 277: { /* glRenderbufferStorageMultisample */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLsizei samples;
+		readValue(replay, &samples, sizeof(samples));
+		GLenum internalformat;
+		readValue(replay, &internalformat, sizeof(internalformat));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLsizei height;
+		readValue(replay, &height, sizeof(height));
+		glad_glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+		break;
+	}
+	case 278: { /* glFramebufferTextureLayer */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLenum attachment;
+		readValue(replay, &attachment, sizeof(attachment));
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		GLint level;
+		readValue(replay, &level, sizeof(level));
+		GLint layer;
+		readValue(replay, &layer, sizeof(layer));
+		glad_glFramebufferTextureLayer(target, attachment, texture, level, layer);
+		break;
+	}
+	case 279: { /* glMapBufferRange */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLintptr offset;
+		readValue(replay, &offset, sizeof(offset));
+		GLsizeiptr length;
+		readValue(replay, &length, sizeof(length));
+		GLbitfield access;
+		readValue(replay, &access, sizeof(access));
+		glad_glMapBufferRange(target, offset, length, access);
+		break;
+	}
+	case 280: { /* glFlushMappedBufferRange */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLintptr offset;
+		readValue(replay, &offset, sizeof(offset));
+		GLsizeiptr length;
+		readValue(replay, &length, sizeof(length));
+		glad_glFlushMappedBufferRange(target, offset, length);
+		break;
+	}
+	case 281: { /* glBindVertexArray */
+		GLuint array;
+		readValue(replay, &array, sizeof(array));
+		array = mapName(replay, NAME_VERTEX_ARRAY, array);
+		glad_glBindVertexArray(array);
+		break;
+	}
+	case 282: { /* glDeleteVertexArrays */
+		GLsizei n;
+		readValue(replay, &n, sizeof(n));
+		const GLuint *arrays = (const GLuint *)readPointer(replay);
+		arrays = mapNames(replay, NAME_VERTEX_ARRAY, arrays, n);
+		glad_glDeleteVertexArrays(n, arrays);
+		break;
+	}
+	case 283: { /* glGenVertexArrays */
+		GLsizei n;
+		readValue(replay, &n, sizeof(n));
+		GLuint *arrays = (GLuint *)readPointer(replay);
+		glad_glGenVertexArrays(n, arrays);
+		recordNames(replay, NAME_VERTEX_ARRAY);
+		break;
+	}
+	case 284: { /* glIsVertexArray */
+		GLuint array;
+		readValue(replay, &array, sizeof(array));
+		array = mapName(replay, NAME_VERTEX_ARRAY, array);
+		GLboolean result = glad_glIsVertexArray(array);
+
+		checkResult(replay, &result, sizeof(result));
+		break;
+	}
+	case 285: { /* glDrawArraysInstanced */
+		GLenum mode;
+		readValue(replay, &mode, sizeof(mode));
+		GLint first;
+		readValue(replay, &first, sizeof(first));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLsizei instancecount;
+		readValue(replay, &instancecount, sizeof(instancecount));
+		glad_glDrawArraysInstanced(mode, first, count, instancecount);
+		break;
+	}
+	case 286: { /* glDrawElementsInstanced */
+		GLenum mode;
+		readValue(replay, &mode, sizeof(mode));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		const void *indices = (const void *)readPointer(replay);
+		GLsizei instancecount;
+		readValue(replay, &instancecount, sizeof(instancecount));
+		glad_glDrawElementsInstanced(mode, count, type, indices, instancecount);
+		break;
+	}
+	case 287: { /* glTexBuffer */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLenum internalformat;
+		readValue(replay, &internalformat, sizeof(internalformat));
+		GLuint buffer;
+		readValue(replay, &buffer, sizeof(buffer));
+		buffer = mapName(replay, NAME_BUFFER, buffer);
+		glad_glTexBuffer(target, internalformat, buffer);
+		break;
+	}
+	case 288: { /* glPrimitiveRestartIndex */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		glad_glPrimitiveRestartIndex(index);
+		break;
+	}
+	case 289: { /* glCopyBufferSubData */
+		GLenum readTarget;
+		readValue(replay, &readTarget, sizeof(readTarget));
+		GLenum writeTarget;
+		readValue(replay, &writeTarget, sizeof(writeTarget));
+		GLintptr readOffset;
+		readValue(replay, &readOffset, sizeof(readOffset));
+		GLintptr writeOffset;
+		readValue(replay, &writeOffset, sizeof(writeOffset));
+		GLsizeiptr size;
+		readValue(replay, &size, sizeof(size));
+		glad_glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+		break;
+	}
+	case 290: { /* glGetUniformIndices */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLsizei uniformCount;
+		readValue(replay, &uniformCount, sizeof(uniformCount));
+		const GLchar *const*uniformNames = (const GLchar *const*)readStrings(replay);
+		GLuint *uniformIndices = (GLuint *)readPointer(replay);
+		glad_glGetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+		break;
+	}
+	case 291: { /* glGetActiveUniformsiv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLsizei uniformCount;
+		readValue(replay, &uniformCount, sizeof(uniformCount));
+		const GLuint *uniformIndices = (const GLuint *)readPointer(replay);
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint *params = (GLint *)readPointer(replay);
+		glad_glGetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+		break;
+	}
+	case 292: { /* glGetActiveUniformName */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLuint uniformIndex;
+		readValue(replay, &uniformIndex, sizeof(uniformIndex));
+		GLsizei bufSize;
+		readValue(replay, &bufSize, sizeof(bufSize));
+		GLsizei *length = (GLsizei *)readPointer(replay);
+		GLchar *uniformName = (GLchar *)readPointer(replay);
+		glad_glGetActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+		break;
+	}
+	case 293: { /* glGetUniformBlockIndex */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		const GLchar *uniformBlockName = (const GLchar *)readPointer(replay);
+		GLuint result = glad_glGetUniformBlockIndex(program, uniformBlockName);
+
+		checkResult(replay, &result, sizeof(result));
+		break;
+	}
+	case 294: { /* glGetActiveUniformBlockiv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLuint uniformBlockIndex;
+		readValue(replay, &uniformBlockIndex, sizeof(uniformBlockIndex));
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint *params = (GLint *)readPointer(replay);
+		glad_glGetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+		break;
+	}
+	case 295: { /* glGetActiveUniformBlockName */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLuint uniformBlockIndex;
+		readValue(replay, &uniformBlockIndex, sizeof(uniformBlockIndex));
+		GLsizei bufSize;
+		readValue(replay, &bufSize, sizeof(bufSize));
+		GLsizei *length = (GLsizei *)readPointer(replay);
+		GLchar *uniformBlockName = (GLchar *)readPointer(replay);
+		glad_glGetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+		break;
+	}
+	case 296: { /* glUniformBlockBinding */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLuint uniformBlockIndex;
+		readValue(replay, &uniformBlockIndex, sizeof(uniformBlockIndex));
+		GLuint uniformBlockBinding;
+		readValue(replay, &uniformBlockBinding, sizeof(uniformBlockBinding));
+		glad_glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+		break;
+	}
+	case 297: { /* glDrawElementsBaseVertex */
+		GLenum mode;
+		readValue(replay, &mode, sizeof(mode));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		const void *indices = (const void *)readPointer(replay);
+		GLint basevertex;
+		readValue(replay, &basevertex, sizeof(basevertex));
+		glad_glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+		break;
+	}
+	case 298: { /* glDrawRangeElementsBaseVertex */
+		GLenum mode;
+		readValue(replay, &mode, sizeof(mode));
+		GLuint start;
+		readValue(replay, &start, sizeof(start));
+		GLuint end;
+		readValue(replay, &end, sizeof(end));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		const void *indices = (const void *)readPointer(replay);
+		GLint basevertex;
+		readValue(replay, &basevertex, sizeof(basevertex));
+		glad_glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+		break;
+	}
+	case 299: { /* glDrawElementsInstancedBaseVertex */
+		GLenum mode;
+		readValue(replay, &mode, sizeof(mode));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		const void *indices = (const void *)readPointer(replay);
+		GLsizei instancecount;
+		readValue(replay, &instancecount, sizeof(instancecount));
+		GLint basevertex;
+		readValue(replay, &basevertex, sizeof(basevertex));
+		glad_glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+		break;
+	}
+	case 300: { /* glMultiDrawElementsBaseVertex */
+		GLenum mode;
+		readValue(replay, &mode, sizeof(mode));
+		const GLsizei *count = (const GLsizei *)readPointer(replay);
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		const void *const*indices = (const void *const*)readPointer(replay);
+		GLsizei drawcount;
+		readValue(replay, &drawcount, sizeof(drawcount));
+		const GLint *basevertex = (const GLint *)readPointer(replay);
+		glad_glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+		break;
+	}
+	case 301: { /* glProvokingVertex */
+		GLenum mode;
+		readValue(replay, &mode, sizeof(mode));
+		glad_glProvokingVertex(mode);
+		break;
+	}
+	case 302: { /* glFenceSync */
+		GLenum condition;
+		readValue(replay, &condition, sizeof(condition));
+		GLbitfield flags;
+		readValue(replay, &flags, sizeof(flags));
+		mapSync(replay, glad_glFenceSync(condition, flags));
+		break;
+	}
+	case 303: { /* glIsSync */
+		GLsync sync = (GLsync)readSync(replay);
+		GLboolean result = glad_glIsSync(sync);
+
+		checkResult(replay, &result, sizeof(result));
+		break;
+	}
+	case 304: { /* glDeleteSync */
+		GLsync sync = (GLsync)readSync(replay);
+		glad_glDeleteSync(sync);
+		break;
+	}
+	case 305: { /* glClientWaitSync */
+		GLsync sync = (GLsync)readSync(replay);
+		GLbitfield flags;
+		readValue(replay, &flags, sizeof(flags));
+		GLuint64 timeout;
+		readValue(replay, &timeout, sizeof(timeout));
+		GLenum result = glad_glClientWaitSync(sync, flags, timeout);
+
+		checkResult(replay, &result, sizeof(result));
+		break;
+	}
+	case 306: { /* glWaitSync */
+		GLsync sync = (GLsync)readSync(replay);
+		GLbitfield flags;
+		readValue(replay, &flags, sizeof(flags));
+		GLuint64 timeout;
+		readValue(replay, &timeout, sizeof(timeout));
+		glad_glWaitSync(sync, flags, timeout);
+		break;
+	}
+	case 307: { /* glGetInteger64v */
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint64 *data = (GLint64 *)readPointer(replay);
+		glad_glGetInteger64v(pname, data);
+		break;
+	}
+	case 308: { /* glGetSynciv */
+		GLsync sync = (GLsync)readSync(replay);
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLsizei *length = (GLsizei *)readPointer(replay);
+		GLint *values = (GLint *)readPointer(replay);
+		glad_glGetSynciv(sync, pname, count, length, values);
+		break;
+	}
+	case 309: { /* glGetInteger64i_v */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLint64 *data = (GLint64 *)readPointer(replay);
+		glad_glGetInteger64i_v(target, index, data);
+		break;
+	}
+	case 310: { /* glGetBufferParameteri64v */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint64 *params = (GLint64 *)readPointer(replay);
+		glad_glGetBufferParameteri64v(target, pname, params);
+		break;
+	}
+	case 311: { /* glFramebufferTexture */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLenum attachment;
+		readValue(replay, &attachment, sizeof(attachment));
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		GLint level;
+		readValue(replay, &level, sizeof(level));
+		glad_glFramebufferTexture(target, attachment, texture, level);
+		break;
+	}
+	case 312: { /* glTexImage2DMultisample */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLsizei samples;
+		readValue(replay, &samples, sizeof(samples));
+		GLenum internalformat;
+		readValue(replay, &internalformat, sizeof(internalformat));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLsizei height;
+		readValue(replay, &height, sizeof(height));
+		GLboolean fixedsamplelocations;
+		readValue(replay, &fixedsamplelocations, sizeof(fixedsamplelocations));
+		glad_glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+		break;
+	}
+	case 313: { /* glTexImage3DMultisample */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLsizei samples;
+		readValue(replay, &samples, sizeof(samples));
+		GLenum internalformat;
+		readValue(replay, &internalformat, sizeof(internalformat));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLsizei height;
+		readValue(replay, &height, sizeof(height));
+		GLsizei depth;
+		readValue(replay, &depth, sizeof(depth));
+		GLboolean fixedsamplelocations;
+		readValue(replay, &fixedsamplelocations, sizeof(fixedsamplelocations));
+		glad_glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+		break;
+	}
+	case 314: { /* glGetMultisamplefv */
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLfloat *val = (GLfloat *)readPointer(replay);
+		glad_glGetMultisamplefv(pname, index, val);
+		break;
+	}
+	case 315: { /* glSampleMaski */
+		GLuint maskNumber;
+		readValue(replay, &maskNumber, sizeof(maskNumber));
+		GLbitfield mask;
+		readValue(replay, &mask, sizeof(mask));
+		glad_glSampleMaski(maskNumber, mask);
+		break;
+	}
+	case 316: { /* glBindFragDataLocationIndexed */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLuint colorNumber;
+		readValue(replay, &colorNumber, sizeof(colorNumber));
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		const GLchar *name = (const GLchar *)readPointer(replay);
+		glad_glBindFragDataLocationIndexed(program, colorNumber, index, name);
+		break;
+	}
+	case 317: { /* glGetFragDataIndex */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		const GLchar *name = (const GLchar *)readPointer(replay);
+		GLint result = glad_glGetFragDataIndex(program, name);
+
+		checkResult(replay, &result, sizeof(result));
+		break;
+	}
+	case 318: { /* glGenSamplers */
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLuint *samplers = (GLuint *)readPointer(replay);
+		glad_glGenSamplers(count, samplers);
+		recordNames(replay, NAME_SAMPLER);
+		break;
+	}
+	case 319: { /* glDeleteSamplers */
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLuint *samplers = (const GLuint *)readPointer(replay);
+		samplers = mapNames(replay, NAME_SAMPLER, samplers, count);
+		glad_glDeleteSamplers(count, samplers);
+		break;
+	}
+	case 320: { /* glIsSampler */
+		GLuint sampler;
+		readValue(replay, &sampler, sizeof(sampler));
+		sampler = mapName(replay, NAME_SAMPLER, sampler);
+		GLboolean result = glad_glIsSampler(sampler);
+
+		checkResult(replay, &result, sizeof(result));
+		break;
+	}
+	case 321: { /* glBindSampler */
+		GLuint unit;
+		readValue(replay, &unit, sizeof(unit));
+		GLuint sampler;
+		readValue(replay, &sampler, sizeof(sampler));
+		sampler = mapName(replay, NAME_SAMPLER, sampler);
+		glad_glBindSampler(unit, sampler);
+		break;
+	}
+	case 322: { /* glSamplerParameteri */
+		GLuint sampler;
+		readValue(replay, &sampler, sizeof(sampler));
+		sampler = mapName(replay, NAME_SAMPLER, sampler);
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint param;
+		readValue(replay, &param, sizeof(param));
+		glad_glSamplerParameteri(sampler, pname, param);
+		break;
+	}
+	case 323: { /* glSamplerParameteriv */
+		GLuint sampler;
+		readValue(replay, &sampler, sizeof(sampler));
+		sampler = mapName(replay, NAME_SAMPLER, sampler);
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		const GLint *param = (const GLint *)readPointer(replay);
+		glad_glSamplerParameteriv(sampler, pname, param);
+		break;
+	}
+	case 324: { /* glSamplerParameterf */
+		GLuint sampler;
+		readValue(replay, &sampler, sizeof(sampler));
+		sampler = mapName(replay, NAME_SAMPLER, sampler);
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLfloat param;
+		readValue(replay, &param, sizeof(param));
+		glad_glSamplerParameterf(sampler, pname, param);
+		break;
+	}
+	case 325: { /* glSamplerParameterfv */
+		GLuint sampler;
+		readValue(replay, &sampler, sizeof(sampler));
+		sampler = mapName(replay, NAME_SAMPLER, sampler);
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		const GLfloat *param = (const GLfloat *)readPointer(replay);
+		glad_glSamplerParameterfv(sampler, pname, param);
+		break;
+	}
+	case 326: { /* glSamplerParameterIiv */
+		GLuint sampler;
+		readValue(replay, &sampler, sizeof(sampler));
+		sampler = mapName(replay, NAME_SAMPLER, sampler);
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		const GLint *param = (const GLint *)readPointer(replay);
+		glad_glSamplerParameterIiv(sampler, pname, param);
+		break;
+	}
+	case 327: { /* glSamplerParameterIuiv */
+		GLuint sampler;
+		readValue(replay, &sampler, sizeof(sampler));
+		sampler = mapName(replay, NAME_SAMPLER, sampler);
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		const GLuint *param = (const GLuint *)readPointer(replay);
+		glad_glSamplerParameterIuiv(sampler, pname, param);
+		break;
+	}
+	case 328: { /* glGetSamplerParameteriv */
+		GLuint sampler;
+		readValue(replay, &sampler, sizeof(sampler));
+		sampler = mapName(replay, NAME_SAMPLER, sampler);
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint *params = (GLint *)readPointer(replay);
+		glad_glGetSamplerParameteriv(sampler, pname, params);
+		break;
+	}
+	case 329: { /* glGetSamplerParameterIiv */
+		GLuint sampler;
+		readValue(replay, &sampler, sizeof(sampler));
+		sampler = mapName(replay, NAME_SAMPLER, sampler);
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint *params = (GLint *)readPointer(replay);
+		glad_glGetSamplerParameterIiv(sampler, pname, params);
+		break;
+	}
+	case 330: { /* glGetSamplerParameterfv */
+		GLuint sampler;
+		readValue(replay, &sampler, sizeof(sampler));
+		sampler = mapName(replay, NAME_SAMPLER, sampler);
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLfloat *params = (GLfloat *)readPointer(replay);
+		glad_glGetSamplerParameterfv(sampler, pname, params);
+		break;
+	}
+	case 331: { /* glGetSamplerParameterIuiv */
+		GLuint sampler;
+		readValue(replay, &sampler, sizeof(sampler));
+		sampler = mapName(replay, NAME_SAMPLER, sampler);
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLuint *params = (GLuint *)readPointer(replay);
+		glad_glGetSamplerParameterIuiv(sampler, pname, params);
+		break;
+	}
+	case 332: { /* glQueryCounter */
+		GLuint id;
+		readValue(replay, &id, sizeof(id));
+		id = mapName(replay, NAME_QUERY, id);
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		glad_glQueryCounter(id, target);
+		break;
+	}
+	case 333: { /* glGetQueryObjecti64v */
+		GLuint id;
+		readValue(replay, &id, sizeof(id));
+		id = mapName(replay, NAME_QUERY, id);
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint64 *params = (GLint64 *)readPointer(replay);
+		glad_glGetQueryObjecti64v(id, pname, params);
+		break;
+	}
+	case 334: { /* glGetQueryObjectui64v */
+		GLuint id;
+		readValue(replay, &id, sizeof(id));
+		id = mapName(replay, NAME_QUERY, id);
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLuint64 *params = (GLuint64 *)readPointer(replay);
+		glad_glGetQueryObjectui64v(id, pname, params);
+		break;
+	}
+	case 335: { /* glVertexAttribDivisor */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLuint divisor;
+		readValue(replay, &divisor, sizeof(divisor));
+		glad_glVertexAttribDivisor(index, divisor);
+		break;
+	}
+	case 336: { /* glVertexAttribP1ui */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		GLboolean normalized;
+		readValue(replay, &normalized, sizeof(normalized));
+		GLuint value;
+		readValue(replay, &value, sizeof(value));
+		glad_glVertexAttribP1ui(index, type, normalized, value);
+		break;
+	}
+	case 337: { /* glVertexAttribP1uiv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		GLboolean normalized;
+		readValue(replay, &normalized, sizeof(normalized));
+		const GLuint *value = (const GLuint *)readPointer(replay);
+		glad_glVertexAttribP1uiv(index, type, normalized, value);
+		break;
+	}
+	case 338: { /* glVertexAttribP2ui */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		GLboolean normalized;
+		readValue(replay, &normalized, sizeof(normalized));
+		GLuint value;
+		readValue(replay, &value, sizeof(value));
+		glad_glVertexAttribP2ui(index, type, normalized, value);
+		break;
+	}
+	case 339: { /* glVertexAttribP2uiv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		GLboolean normalized;
+		readValue(replay, &normalized, sizeof(normalized));
+		const GLuint *value = (const GLuint *)readPointer(replay);
+		glad_glVertexAttribP2uiv(index, type, normalized, value);
+		break;
+	}
+	case 340: { /* glVertexAttribP3ui */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		GLboolean normalized;
+		readValue(replay, &normalized, sizeof(normalized));
+		GLuint value;
+		readValue(replay, &value, sizeof(value));
+		glad_glVertexAttribP3ui(index, type, normalized, value);
+		break;
+	}
+	case 341: { /* glVertexAttribP3uiv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		GLboolean normalized;
+		readValue(replay, &normalized, sizeof(normalized));
+		const GLuint *value = (const GLuint *)readPointer(replay);
+		glad_glVertexAttribP3uiv(index, type, normalized, value);
+		break;
+	}
+	case 342: { /* glVertexAttribP4ui */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		GLboolean normalized;
+		readValue(replay, &normalized, sizeof(normalized));
+		GLuint value;
+		readValue(replay, &value, sizeof(value));
+		glad_glVertexAttribP4ui(index, type, normalized, value);
+		break;
+	}
+	case 343: { /* glVertexAttribP4uiv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		GLboolean normalized;
+		readValue(replay, &normalized, sizeof(normalized));
+		const GLuint *value = (const GLuint *)readPointer(replay);
+		glad_glVertexAttribP4uiv(index, type, normalized, value);
+		break;
+	}
+	case 344: { /* glVertexP2ui */
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		GLuint value;
+		readValue(replay, &value, sizeof(value));
+		glad_glVertexP2ui(type, value);
+		break;
+	}
+	case 345: { /* glVertexP2uiv */
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		const GLuint *value = (const GLuint *)readPointer(replay);
+		glad_glVertexP2uiv(type, value);
+		break;
+	}
+	case 346: { /* glVertexP3ui */
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		GLuint value;
+		readValue(replay, &value, sizeof(value));
+		glad_glVertexP3ui(type, value);
+		break;
+	}
+	case 347: { /* glVertexP3uiv */
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		const GLuint *value = (const GLuint *)readPointer(replay);
+		glad_glVertexP3uiv(type, value);
+		break;
+	}
+	case 348: { /* glVertexP4ui */
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		GLuint value;
+		readValue(replay, &value, sizeof(value));
+		glad_glVertexP4ui(type, value);
+		break;
+	}
+	case 349: { /* glVertexP4uiv */
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		const GLuint *value = (const GLuint *)readPointer(replay);
+		glad_glVertexP4uiv(type, value);
+		break;
+	}
+	case 350: { /* glTexCoordP1ui */
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		GLuint coords;
+		readValue(replay, &coords, sizeof(coords));
+		glad_glTexCoordP1ui(type, coords);
+		break;
+	}
+	case 351: { /* glTexCoordP1uiv */
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		const GLuint *coords = (const GLuint *)readPointer(replay);
+		glad_glTexCoordP1uiv(type, coords);
+		break;
+	}
+	case 352: { /* glTexCoordP2ui */
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		GLuint coords;
+		readValue(replay, &coords, sizeof(coords));
+		glad_glTexCoordP2ui(type, coords);
+		break;
+	}
+	case 353: { /* glTexCoordP2uiv */
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		const GLuint *coords = (const GLuint *)readPointer(replay);
+		glad_glTexCoordP2uiv(type, coords);
+		break;
+	}
+	case 354: { /* glTexCoordP3ui */
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		GLuint coords;
+		readValue(replay, &coords, sizeof(coords));
+		glad_glTexCoordP3ui(type, coords);
+		break;
+	}
+	case 355: { /* glTexCoordP3uiv */
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		const GLuint *coords = (const GLuint *)readPointer(replay);
+		glad_glTexCoordP3uiv(type, coords);
+		break;
+	}
+	case 356: { /* glTexCoordP4ui */
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		GLuint coords;
+		readValue(replay, &coords, sizeof(coords));
+		glad_glTexCoordP4ui(type, coords);
+		break;
+	}
+	case 357: { /* glTexCoordP4uiv */
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		const GLuint *coords = (const GLuint *)readPointer(replay);
+		glad_glTexCoordP4uiv(type, coords);
+		break;
+	}
+	case 358: { /* glMultiTexCoordP1ui */
+		GLenum texture;
+		readValue(replay, &texture, sizeof(texture));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		GLuint coords;
+		readValue(replay, &coords, sizeof(coords));
+		glad_glMultiTexCoordP1ui(texture, type, coords);
+		break;
+	}
+	case 359: { /* glMultiTexCoordP1uiv */
+		GLenum texture;
+		readValue(replay, &texture, sizeof(texture));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		const GLuint *coords = (const GLuint *)readPointer(replay);
+		glad_glMultiTexCoordP1uiv(texture, type, coords);
+		break;
+	}
+	case 360: { /* glMultiTexCoordP2ui */
+		GLenum texture;
+		readValue(replay, &texture, sizeof(texture));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		GLuint coords;
+		readValue(replay, &coords, sizeof(coords));
+		glad_glMultiTexCoordP2ui(texture, type, coords);
+		break;
+	}
+	case 361: { /* glMultiTexCoordP2uiv */
+		GLenum texture;
+		readValue(replay, &texture, sizeof(texture));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		const GLuint *coords = (const GLuint *)readPointer(replay);
+		glad_glMultiTexCoordP2uiv(texture, type, coords);
+		break;
+	}
+	case 362: { /* glMultiTexCoordP3ui */
+		GLenum texture;
+		readValue(replay, &texture, sizeof(texture));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		GLuint coords;
+		readValue(replay, &coords, sizeof(coords));
+		glad_glMultiTexCoordP3ui(texture, type, coords);
+		break;
+	}
+	case 363: { /* glMultiTexCoordP3uiv */
+		GLenum texture;
+		readValue(replay, &texture, sizeof(texture));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		const GLuint *coords = (const GLuint *)readPointer(replay);
+		glad_glMultiTexCoordP3uiv(texture, type, coords);
+		break;
+	}
+	case 364: { /* glMultiTexCoordP4ui */
+		GLenum texture;
+		readValue(replay, &texture, sizeof(texture));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		GLuint coords;
+		readValue(replay, &coords, sizeof(coords));
+		glad_glMultiTexCoordP4ui(texture, type, coords);
+		break;
+	}
+	case 365: { /* glMultiTexCoordP4uiv */
+		GLenum texture;
+		readValue(replay, &texture, sizeof(texture));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		const GLuint *coords = (const GLuint *)readPointer(replay);
+		glad_glMultiTexCoordP4uiv(texture, type, coords);
+		break;
+	}
+	case 366: { /* glNormalP3ui */
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		GLuint coords;
+		readValue(replay, &coords, sizeof(coords));
+		glad_glNormalP3ui(type, coords);
+		break;
+	}
+	case 367: { /* glNormalP3uiv */
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		const GLuint *coords = (const GLuint *)readPointer(replay);
+		glad_glNormalP3uiv(type, coords);
+		break;
+	}
+	case 368: { /* glColorP3ui */
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		GLuint color;
+		readValue(replay, &color, sizeof(color));
+		glad_glColorP3ui(type, color);
+		break;
+	}
+	case 369: { /* glColorP3uiv */
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		const GLuint *color = (const GLuint *)readPointer(replay);
+		glad_glColorP3uiv(type, color);
+		break;
+	}
+	case 370: { /* glColorP4ui */
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		GLuint color;
+		readValue(replay, &color, sizeof(color));
+		glad_glColorP4ui(type, color);
+		break;
+	}
+	case 371: { /* glColorP4uiv */
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		const GLuint *color = (const GLuint *)readPointer(replay);
+		glad_glColorP4uiv(type, color);
+		break;
+	}
+	case 372: { /* glSecondaryColorP3ui */
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		GLuint color;
+		readValue(replay, &color, sizeof(color));
+		glad_glSecondaryColorP3ui(type, color);
+		break;
+	}
+	case 373: { /* glSecondaryColorP3uiv */
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		const GLuint *color = (const GLuint *)readPointer(replay);
+		glad_glSecondaryColorP3uiv(type, color);
+		break;
+	}
+	case 374: { /* glMinSampleShading */
+		GLfloat value;
+		readValue(replay, &value, sizeof(value));
+		glad_glMinSampleShading(value);
+		break;
+	}
+	case 375: { /* glBlendEquationi */
+		GLuint buf;
+		readValue(replay, &buf, sizeof(buf));
+		GLenum mode;
+		readValue(replay, &mode, sizeof(mode));
+		glad_glBlendEquationi(buf, mode);
+		break;
+	}
+	case 376: { /* glBlendEquationSeparatei */
+		GLuint buf;
+		readValue(replay, &buf, sizeof(buf));
+		GLenum modeRGB;
+		readValue(replay, &modeRGB, sizeof(modeRGB));
+		GLenum modeAlpha;
+		readValue(replay, &modeAlpha, sizeof(modeAlpha));
+		glad_glBlendEquationSeparatei(buf, modeRGB, modeAlpha);
+		break;
+	}
+	case 377: { /* glBlendFunci */
+		GLuint buf;
+		readValue(replay, &buf, sizeof(buf));
+		GLenum src;
+		readValue(replay, &src, sizeof(src));
+		GLenum dst;
+		readValue(replay, &dst, sizeof(dst));
+		glad_glBlendFunci(buf, src, dst);
+		break;
+	}
+	case 378: { /* glBlendFuncSeparatei */
+		GLuint buf;
+		readValue(replay, &buf, sizeof(buf));
+		GLenum srcRGB;
+		readValue(replay, &srcRGB, sizeof(srcRGB));
+		GLenum dstRGB;
+		readValue(replay, &dstRGB, sizeof(dstRGB));
+		GLenum srcAlpha;
+		readValue(replay, &srcAlpha, sizeof(srcAlpha));
+		GLenum dstAlpha;
+		readValue(replay, &dstAlpha, sizeof(dstAlpha));
+		glad_glBlendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+		break;
+	}
+	case 379: { /* glDrawArraysIndirect */
+		GLenum mode;
+		readValue(replay, &mode, sizeof(mode));
+		const void *indirect = (const void *)readPointer(replay);
+		glad_glDrawArraysIndirect(mode, indirect);
+		break;
+	}
+	case 380: { /* glDrawElementsIndirect */
+		GLenum mode;
+		readValue(replay, &mode, sizeof(mode));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		const void *indirect = (const void *)readPointer(replay);
+		glad_glDrawElementsIndirect(mode, type, indirect);
+		break;
+	}
+	case 381: { /* glUniform1d */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLdouble x;
+		readValue(replay, &x, sizeof(x));
+		glad_glUniform1d(location, x);
+		break;
+	}
+	case 382: { /* glUniform2d */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLdouble x;
+		readValue(replay, &x, sizeof(x));
+		GLdouble y;
+		readValue(replay, &y, sizeof(y));
+		glad_glUniform2d(location, x, y);
+		break;
+	}
+	case 383: { /* glUniform3d */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLdouble x;
+		readValue(replay, &x, sizeof(x));
+		GLdouble y;
+		readValue(replay, &y, sizeof(y));
+		GLdouble z;
+		readValue(replay, &z, sizeof(z));
+		glad_glUniform3d(location, x, y, z);
+		break;
+	}
+	case 384: { /* glUniform4d */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLdouble x;
+		readValue(replay, &x, sizeof(x));
+		GLdouble y;
+		readValue(replay, &y, sizeof(y));
+		GLdouble z;
+		readValue(replay, &z, sizeof(z));
+		GLdouble w;
+		readValue(replay, &w, sizeof(w));
+		glad_glUniform4d(location, x, y, z, w);
+		break;
+	}
+	case 385: { /* glUniform1dv */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLdouble *value = (const GLdouble *)readPointer(replay);
+		glad_glUniform1dv(location, count, value);
+		break;
+	}
+	case 386: { /* glUniform2dv */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLdouble *value = (const GLdouble *)readPointer(replay);
+		glad_glUniform2dv(location, count, value);
+		break;
+	}
+	case 387: { /* glUniform3dv */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLdouble *value = (const GLdouble *)readPointer(replay);
+		glad_glUniform3dv(location, count, value);
+		break;
+	}
+	case 388: { /* glUniform4dv */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLdouble *value = (const GLdouble *)readPointer(replay);
+		glad_glUniform4dv(location, count, value);
+		break;
+	}
+	case 389: { /* glUniformMatrix2dv */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLboolean transpose;
+		readValue(replay, &transpose, sizeof(transpose));
+		const GLdouble *value = (const GLdouble *)readPointer(replay);
+		glad_glUniformMatrix2dv(location, count, transpose, value);
+		break;
+	}
+	case 390: { /* glUniformMatrix3dv */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLboolean transpose;
+		readValue(replay, &transpose, sizeof(transpose));
+		const GLdouble *value = (const GLdouble *)readPointer(replay);
+		glad_glUniformMatrix3dv(location, count, transpose, value);
+		break;
+	}
+	case 391: { /* glUniformMatrix4dv */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLboolean transpose;
+		readValue(replay, &transpose, sizeof(transpose));
+		const GLdouble *value = (const GLdouble *)readPointer(replay);
+		glad_glUniformMatrix4dv(location, count, transpose, value);
+		break;
+	}
+	case 392: { /* glUniformMatrix2x3dv */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLboolean transpose;
+		readValue(replay, &transpose, sizeof(transpose));
+		const GLdouble *value = (const GLdouble *)readPointer(replay);
+		glad_glUniformMatrix2x3dv(location, count, transpose, value);
+		break;
+	}
+	case 393: { /* glUniformMatrix2x4dv */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLboolean transpose;
+		readValue(replay, &transpose, sizeof(transpose));
+		const GLdouble *value = (const GLdouble *)readPointer(replay);
+		glad_glUniformMatrix2x4dv(location, count, transpose, value);
+		break;
+	}
+	case 394: { /* glUniformMatrix3x2dv */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLboolean transpose;
+		readValue(replay, &transpose, sizeof(transpose));
+		const GLdouble *value = (const GLdouble *)readPointer(replay);
+		glad_glUniformMatrix3x2dv(location, count, transpose, value);
+		break;
+	}
+	case 395: { /* glUniformMatrix3x4dv */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLboolean transpose;
+		readValue(replay, &transpose, sizeof(transpose));
+		const GLdouble *value = (const GLdouble *)readPointer(replay);
+		glad_glUniformMatrix3x4dv(location, count, transpose, value);
+		break;
+	}
+	case 396: { /* glUniformMatrix4x2dv */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLboolean transpose;
+		readValue(replay, &transpose, sizeof(transpose));
+		const GLdouble *value = (const GLdouble *)readPointer(replay);
+		glad_glUniformMatrix4x2dv(location, count, transpose, value);
+		break;
+	}
+	case 397: { /* glUniformMatrix4x3dv */
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLboolean transpose;
+		readValue(replay, &transpose, sizeof(transpose));
+		const GLdouble *value = (const GLdouble *)readPointer(replay);
+		glad_glUniformMatrix4x3dv(location, count, transpose, value);
+		break;
+	}
+	case 398: { /* glGetUniformdv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLdouble *params = (GLdouble *)readPointer(replay);
+		glad_glGetUniformdv(program, location, params);
+		break;
+	}
+	case 399: { /* glGetSubroutineUniformLocation */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLenum shadertype;
+		readValue(replay, &shadertype, sizeof(shadertype));
+		const GLchar *name = (const GLchar *)readPointer(replay);
+		GLint result = glad_glGetSubroutineUniformLocation(program, shadertype, name);
+
+		checkResult(replay, &result, sizeof(result));
+		break;
+	}
+	case 400: { /* glGetSubroutineIndex */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLenum shadertype;
+		readValue(replay, &shadertype, sizeof(shadertype));
+		const GLchar *name = (const GLchar *)readPointer(replay);
+		GLuint result = glad_glGetSubroutineIndex(program, shadertype, name);
+
+		checkResult(replay, &result, sizeof(result));
+		break;
+	}
+	case 401: { /* glGetActiveSubroutineUniformiv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLenum shadertype;
+		readValue(replay, &shadertype, sizeof(shadertype));
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint *values = (GLint *)readPointer(replay);
+		glad_glGetActiveSubroutineUniformiv(program, shadertype, index, pname, values);
+		break;
+	}
+	case 402: { /* glGetActiveSubroutineUniformName */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLenum shadertype;
+		readValue(replay, &shadertype, sizeof(shadertype));
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLsizei bufSize;
+		readValue(replay, &bufSize, sizeof(bufSize));
+		GLsizei *length = (GLsizei *)readPointer(replay);
+		GLchar *name = (GLchar *)readPointer(replay);
+		glad_glGetActiveSubroutineUniformName(program, shadertype, index, bufSize, length, name);
+		break;
+	}
+	case 403: { /* glGetActiveSubroutineName */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLenum shadertype;
+		readValue(replay, &shadertype, sizeof(shadertype));
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLsizei bufSize;
+		readValue(replay, &bufSize, sizeof(bufSize));
+		GLsizei *length = (GLsizei *)readPointer(replay);
+		GLchar *name = (GLchar *)readPointer(replay);
+		glad_glGetActiveSubroutineName(program, shadertype, index, bufSize, length, name);
+		break;
+	}
+	case 404: { /* glUniformSubroutinesuiv */
+		GLenum shadertype;
+		readValue(replay, &shadertype, sizeof(shadertype));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLuint *indices = (const GLuint *)readPointer(replay);
+		glad_glUniformSubroutinesuiv(shadertype, count, indices);
+		break;
+	}
+	case 405: { /* glGetUniformSubroutineuiv */
+		GLenum shadertype;
+		readValue(replay, &shadertype, sizeof(shadertype));
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLuint *params = (GLuint *)readPointer(replay);
+		glad_glGetUniformSubroutineuiv(shadertype, location, params);
+		break;
+	}
+	case 406: { /* glGetProgramStageiv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLenum shadertype;
+		readValue(replay, &shadertype, sizeof(shadertype));
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint *values = (GLint *)readPointer(replay);
+		glad_glGetProgramStageiv(program, shadertype, pname, values);
+		break;
+	}
+	case 407: { /* glPatchParameteri */
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint value;
+		readValue(replay, &value, sizeof(value));
+		glad_glPatchParameteri(pname, value);
+		break;
+	}
+	case 408: { /* glPatchParameterfv */
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		const GLfloat *values = (const GLfloat *)readPointer(replay);
+		glad_glPatchParameterfv(pname, values);
+		break;
+	}
+	case 409: { /* glBindTransformFeedback */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLuint id;
+		readValue(replay, &id, sizeof(id));
+		id = mapName(replay, NAME_TRANSFORM_FEEDBACK, id);
+		glad_glBindTransformFeedback(target, id);
+		break;
+	}
+	case 410: { /* glDeleteTransformFeedbacks */
+		GLsizei n;
+		readValue(replay, &n, sizeof(n));
+		const GLuint *ids = (const GLuint *)readPointer(replay);
+		ids = mapNames(replay, NAME_TRANSFORM_FEEDBACK, ids, n);
+		glad_glDeleteTransformFeedbacks(n, ids);
+		break;
+	}
+	case 411: { /* glGenTransformFeedbacks */
+		GLsizei n;
+		readValue(replay, &n, sizeof(n));
+		GLuint *ids = (GLuint *)readPointer(replay);
+		glad_glGenTransformFeedbacks(n, ids);
+		recordNames(replay, NAME_TRANSFORM_FEEDBACK);
+		break;
+	}
+	case 412: { /* glIsTransformFeedback */
+		GLuint id;
+		readValue(replay, &id, sizeof(id));
+		id = mapName(replay, NAME_TRANSFORM_FEEDBACK, id);
+		GLboolean result = glad_glIsTransformFeedback(id);
+
+		checkResult(replay, &result, sizeof(result));
+		break;
+	}
+	case 413: { /* glPauseTransformFeedback */
+		glad_glPauseTransformFeedback();
+		break;
+	}
+	case 414: { /* glResumeTransformFeedback */
+		glad_glResumeTransformFeedback();
+		break;
+	}
+	case 415: { /* glDrawTransformFeedback */
+		GLenum mode;
+		readValue(replay, &mode, sizeof(mode));
+		GLuint id;
+		readValue(replay, &id, sizeof(id));
+		id = mapName(replay, NAME_TRANSFORM_FEEDBACK, id);
+		glad_glDrawTransformFeedback(mode, id);
+		break;
+	}
+	case 416: { /* glDrawTransformFeedbackStream */
+		GLenum mode;
+		readValue(replay, &mode, sizeof(mode));
+		GLuint id;
+		readValue(replay, &id, sizeof(id));
+		id = mapName(replay, NAME_TRANSFORM_FEEDBACK, id);
+		GLuint stream;
+		readValue(replay, &stream, sizeof(stream));
+		glad_glDrawTransformFeedbackStream(mode, id, stream);
+		break;
+	}
+	case 417: { /* glBeginQueryIndexed */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLuint id;
+		readValue(replay, &id, sizeof(id));
+		id = mapName(replay, NAME_QUERY, id);
+		glad_glBeginQueryIndexed(target, index, id);
+		break;
+	}
+	case 418: { /* glEndQueryIndexed */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		glad_glEndQueryIndexed(target, index);
+		break;
+	}
+	case 419: { /* glGetQueryIndexediv */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint *params = (GLint *)readPointer(replay);
+		glad_glGetQueryIndexediv(target, index, pname, params);
+		break;
+	}
+	case 420: { /* glReleaseShaderCompiler */
+		glad_glReleaseShaderCompiler();
+		break;
+	}
+	case 421: { /* glShaderBinary */
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLuint *shaders = (const GLuint *)readPointer(replay);
+		shaders = mapNames(replay, NAME_PROGRAM, shaders, count);
+		GLenum binaryFormat;
+		readValue(replay, &binaryFormat, sizeof(binaryFormat));
+		const void *binary = (const void *)readPointer(replay);
+		GLsizei length;
+		readValue(replay, &length, sizeof(length));
+		glad_glShaderBinary(count, shaders, binaryFormat, binary, length);
+		break;
+	}
+	case 422: { /* glGetShaderPrecisionFormat */
+		GLenum shadertype;
+		readValue(replay, &shadertype, sizeof(shadertype));
+		GLenum precisiontype;
+		readValue(replay, &precisiontype, sizeof(precisiontype));
+		GLint *range = (GLint *)readPointer(replay);
+		GLint *precision = (GLint *)readPointer(replay);
+		glad_glGetShaderPrecisionFormat(shadertype, precisiontype, range, precision);
+		break;
+	}
+	case 423: { /* glDepthRangef */
+		GLfloat n;
+		readValue(replay, &n, sizeof(n));
+		GLfloat f;
+		readValue(replay, &f, sizeof(f));
+		glad_glDepthRangef(n, f);
+		break;
+	}
+	case 424: { /* glClearDepthf */
+		GLfloat d;
+		readValue(replay, &d, sizeof(d));
+		glad_glClearDepthf(d);
+		break;
+	}
+	case 425: { /* glGetProgramBinary */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLsizei bufSize;
+		readValue(replay, &bufSize, sizeof(bufSize));
+		GLsizei *length = (GLsizei *)readPointer(replay);
+		GLenum *binaryFormat = (GLenum *)readPointer(replay);
+		void *binary = (void *)readPointer(replay);
+		glad_glGetProgramBinary(program, bufSize, length, binaryFormat, binary);
+		break;
+	}
+	case 426: { /* glProgramBinary */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLenum binaryFormat;
+		readValue(replay, &binaryFormat, sizeof(binaryFormat));
+		const void *binary = (const void *)readPointer(replay);
+		GLsizei length;
+		readValue(replay, &length, sizeof(length));
+		glad_glProgramBinary(program, binaryFormat, binary, length);
+		break;
+	}
+	case 427: { /* glProgramParameteri */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint value;
+		readValue(replay, &value, sizeof(value));
+		glad_glProgramParameteri(program, pname, value);
+		break;
+	}
+	case 428: { /* glUseProgramStages */
+		GLuint pipeline;
+		readValue(replay, &pipeline, sizeof(pipeline));
+		pipeline = mapName(replay, NAME_PIPELINE, pipeline);
+		GLbitfield stages;
+		readValue(replay, &stages, sizeof(stages));
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		glad_glUseProgramStages(pipeline, stages, program);
+		break;
+	}
+	case 429: { /* glActiveShaderProgram */
+		GLuint pipeline;
+		readValue(replay, &pipeline, sizeof(pipeline));
+		pipeline = mapName(replay, NAME_PIPELINE, pipeline);
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		glad_glActiveShaderProgram(pipeline, program);
+		break;
+	}
+	case 430: { /* glCreateShaderProgramv */
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLchar *const*strings = (const GLchar *const*)readStrings(replay);
+		mapResult(replay, NAME_PROGRAM, glad_glCreateShaderProgramv(type, count, strings));
+		break;
+	}
+	case 431: { /* glBindProgramPipeline */
+		GLuint pipeline;
+		readValue(replay, &pipeline, sizeof(pipeline));
+		pipeline = mapName(replay, NAME_PIPELINE, pipeline);
+		glad_glBindProgramPipeline(pipeline);
+		break;
+	}
+	case 432: { /* glDeleteProgramPipelines */
+		GLsizei n;
+		readValue(replay, &n, sizeof(n));
+		const GLuint *pipelines = (const GLuint *)readPointer(replay);
+		pipelines = mapNames(replay, NAME_PIPELINE, pipelines, n);
+		glad_glDeleteProgramPipelines(n, pipelines);
+		break;
+	}
+	case 433: { /* glGenProgramPipelines */
+		GLsizei n;
+		readValue(replay, &n, sizeof(n));
+		GLuint *pipelines = (GLuint *)readPointer(replay);
+		glad_glGenProgramPipelines(n, pipelines);
+		recordNames(replay, NAME_PIPELINE);
+		break;
+	}
+	case 434: { /* glIsProgramPipeline */
+		GLuint pipeline;
+		readValue(replay, &pipeline, sizeof(pipeline));
+		pipeline = mapName(replay, NAME_PIPELINE, pipeline);
+		GLboolean result = glad_glIsProgramPipeline(pipeline);
+
+		checkResult(replay, &result, sizeof(result));
+		break;
+	}
+	case 435: { /* glGetProgramPipelineiv */
+		GLuint pipeline;
+		readValue(replay, &pipeline, sizeof(pipeline));
+		pipeline = mapName(replay, NAME_PIPELINE, pipeline);
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint *params = (GLint *)readPointer(replay);
+		glad_glGetProgramPipelineiv(pipeline, pname, params);
+		break;
+	}
+	case 436: { /* glProgramUniform1i */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLint v0;
+		readValue(replay, &v0, sizeof(v0));
+		glad_glProgramUniform1i(program, location, v0);
+		break;
+	}
+	case 437: { /* glProgramUniform1iv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLint *value = (const GLint *)readPointer(replay);
+		glad_glProgramUniform1iv(program, location, count, value);
+		break;
+	}
+	case 438: { /* glProgramUniform1f */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLfloat v0;
+		readValue(replay, &v0, sizeof(v0));
+		glad_glProgramUniform1f(program, location, v0);
+		break;
+	}
+	case 439: { /* glProgramUniform1fv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLfloat *value = (const GLfloat *)readPointer(replay);
+		glad_glProgramUniform1fv(program, location, count, value);
+		break;
+	}
+	case 440: { /* glProgramUniform1d */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLdouble v0;
+		readValue(replay, &v0, sizeof(v0));
+		glad_glProgramUniform1d(program, location, v0);
+		break;
+	}
+	case 441: { /* glProgramUniform1dv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLdouble *value = (const GLdouble *)readPointer(replay);
+		glad_glProgramUniform1dv(program, location, count, value);
+		break;
+	}
+	case 442: { /* glProgramUniform1ui */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLuint v0;
+		readValue(replay, &v0, sizeof(v0));
+		glad_glProgramUniform1ui(program, location, v0);
+		break;
+	}
+	case 443: { /* glProgramUniform1uiv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLuint *value = (const GLuint *)readPointer(replay);
+		glad_glProgramUniform1uiv(program, location, count, value);
+		break;
+	}
+	case 444: { /* glProgramUniform2i */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLint v0;
+		readValue(replay, &v0, sizeof(v0));
+		GLint v1;
+		readValue(replay, &v1, sizeof(v1));
+		glad_glProgramUniform2i(program, location, v0, v1);
+		break;
+	}
+	case 445: { /* glProgramUniform2iv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLint *value = (const GLint *)readPointer(replay);
+		glad_glProgramUniform2iv(program, location, count, value);
+		break;
+	}
+	case 446: { /* glProgramUniform2f */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLfloat v0;
+		readValue(replay, &v0, sizeof(v0));
+		GLfloat v1;
+		readValue(replay, &v1, sizeof(v1));
+		glad_glProgramUniform2f(program, location, v0, v1);
+		break;
+	}
+	case 447: { /* glProgramUniform2fv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLfloat *value = (const GLfloat *)readPointer(replay);
+		glad_glProgramUniform2fv(program, location, count, value);
+		break;
+	}
+	case 448: { /* glProgramUniform2d */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLdouble v0;
+		readValue(replay, &v0, sizeof(v0));
+		GLdouble v1;
+		readValue(replay, &v1, sizeof(v1));
+		glad_glProgramUniform2d(program, location, v0, v1);
+		break;
+	}
+	case 449: { /* glProgramUniform2dv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLdouble *value = (const GLdouble *)readPointer(replay);
+		glad_glProgramUniform2dv(program, location, count, value);
+		break;
+	}
+	case 450: { /* glProgramUniform2ui */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLuint v0;
+		readValue(replay, &v0, sizeof(v0));
+		GLuint v1;
+		readValue(replay, &v1, sizeof(v1));
+		glad_glProgramUniform2ui(program, location, v0, v1);
+		break;
+	}
+	case 451: { /* glProgramUniform2uiv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLuint *value = (const GLuint *)readPointer(replay);
+		glad_glProgramUniform2uiv(program, location, count, value);
+		break;
+	}
+	case 452: { /* glProgramUniform3i */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLint v0;
+		readValue(replay, &v0, sizeof(v0));
+		GLint v1;
+		readValue(replay, &v1, sizeof(v1));
+		GLint v2;
+		readValue(replay, &v2, sizeof(v2));
+		glad_glProgramUniform3i(program, location, v0, v1, v2);
+		break;
+	}
+	case 453: { /* glProgramUniform3iv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLint *value = (const GLint *)readPointer(replay);
+		glad_glProgramUniform3iv(program, location, count, value);
+		break;
+	}
+	case 454: { /* glProgramUniform3f */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLfloat v0;
+		readValue(replay, &v0, sizeof(v0));
+		GLfloat v1;
+		readValue(replay, &v1, sizeof(v1));
+		GLfloat v2;
+		readValue(replay, &v2, sizeof(v2));
+		glad_glProgramUniform3f(program, location, v0, v1, v2);
+		break;
+	}
+	case 455: { /* glProgramUniform3fv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLfloat *value = (const GLfloat *)readPointer(replay);
+		glad_glProgramUniform3fv(program, location, count, value);
+		break;
+	}
+	case 456: { /* glProgramUniform3d */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLdouble v0;
+		readValue(replay, &v0, sizeof(v0));
+		GLdouble v1;
+		readValue(replay, &v1, sizeof(v1));
+		GLdouble v2;
+		readValue(replay, &v2, sizeof(v2));
+		glad_glProgramUniform3d(program, location, v0, v1, v2);
+		break;
+	}
+	case 457: { /* glProgramUniform3dv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLdouble *value = (const GLdouble *)readPointer(replay);
+		glad_glProgramUniform3dv(program, location, count, value);
+		break;
+	}
+	case 458: { /* glProgramUniform3ui */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLuint v0;
+		readValue(replay, &v0, sizeof(v0));
+		GLuint v1;
+		readValue(replay, &v1, sizeof(v1));
+		GLuint v2;
+		readValue(replay, &v2, sizeof(v2));
+		glad_glProgramUniform3ui(program, location, v0, v1, v2);
+		break;
+	}
+	case 459: { /* glProgramUniform3uiv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLuint *value = (const GLuint *)readPointer(replay);
+		glad_glProgramUniform3uiv(program, location, count, value);
+		break;
+	}
+	case 460: { /* glProgramUniform4i */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLint v0;
+		readValue(replay, &v0, sizeof(v0));
+		GLint v1;
+		readValue(replay, &v1, sizeof(v1));
+		GLint v2;
+		readValue(replay, &v2, sizeof(v2));
+		GLint v3;
+		readValue(replay, &v3, sizeof(v3));
+		glad_glProgramUniform4i(program, location, v0, v1, v2, v3);
+		break;
+	}
+	case 461: { /* glProgramUniform4iv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLint *value = (const GLint *)readPointer(replay);
+		glad_glProgramUniform4iv(program, location, count, value);
+		break;
+	}
+	case 462: { /* glProgramUniform4f */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLfloat v0;
+		readValue(replay, &v0, sizeof(v0));
+		GLfloat v1;
+		readValue(replay, &v1, sizeof(v1));
+		GLfloat v2;
+		readValue(replay, &v2, sizeof(v2));
+		GLfloat v3;
+		readValue(replay, &v3, sizeof(v3));
+		glad_glProgramUniform4f(program, location, v0, v1, v2, v3);
+		break;
+	}
+	case 463: { /* glProgramUniform4fv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLfloat *value = (const GLfloat *)readPointer(replay);
+		glad_glProgramUniform4fv(program, location, count, value);
+		break;
+	}
+	case 464: { /* glProgramUniform4d */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLdouble v0;
+		readValue(replay, &v0, sizeof(v0));
+		GLdouble v1;
+		readValue(replay, &v1, sizeof(v1));
+		GLdouble v2;
+		readValue(replay, &v2, sizeof(v2));
+		GLdouble v3;
+		readValue(replay, &v3, sizeof(v3));
+		glad_glProgramUniform4d(program, location, v0, v1, v2, v3);
+		break;
+	}
+	case 465: { /* glProgramUniform4dv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLdouble *value = (const GLdouble *)readPointer(replay);
+		glad_glProgramUniform4dv(program, location, count, value);
+		break;
+	}
+	case 466: { /* glProgramUniform4ui */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLuint v0;
+		readValue(replay, &v0, sizeof(v0));
+		GLuint v1;
+		readValue(replay, &v1, sizeof(v1));
+		GLuint v2;
+		readValue(replay, &v2, sizeof(v2));
+		GLuint v3;
+		readValue(replay, &v3, sizeof(v3));
+		glad_glProgramUniform4ui(program, location, v0, v1, v2, v3);
+		break;
+	}
+	case 467: { /* glProgramUniform4uiv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLuint *value = (const GLuint *)readPointer(replay);
+		glad_glProgramUniform4uiv(program, location, count, value);
+		break;
+	}
+	case 468: { /* glProgramUniformMatrix2fv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLboolean transpose;
+		readValue(replay, &transpose, sizeof(transpose));
+		const GLfloat *value = (const GLfloat *)readPointer(replay);
+		glad_glProgramUniformMatrix2fv(program, location, count, transpose, value);
+		break;
+	}
+	case 469: { /* glProgramUniformMatrix3fv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLboolean transpose;
+		readValue(replay, &transpose, sizeof(transpose));
+		const GLfloat *value = (const GLfloat *)readPointer(replay);
+		glad_glProgramUniformMatrix3fv(program, location, count, transpose, value);
+		break;
+	}
+	case 470: { /* glProgramUniformMatrix4fv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLboolean transpose;
+		readValue(replay, &transpose, sizeof(transpose));
+		const GLfloat *value = (const GLfloat *)readPointer(replay);
+		glad_glProgramUniformMatrix4fv(program, location, count, transpose, value);
+		break;
+	}
+	case 471: { /* glProgramUniformMatrix2dv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLboolean transpose;
+		readValue(replay, &transpose, sizeof(transpose));
+		const GLdouble *value = (const GLdouble *)readPointer(replay);
+		glad_glProgramUniformMatrix2dv(program, location, count, transpose, value);
+		break;
+	}
+	case 472: { /* glProgramUniformMatrix3dv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLboolean transpose;
+		readValue(replay, &transpose, sizeof(transpose));
+		const GLdouble *value = (const GLdouble *)readPointer(replay);
+		glad_glProgramUniformMatrix3dv(program, location, count, transpose, value);
+		break;
+	}
+	case 473: { /* glProgramUniformMatrix4dv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLboolean transpose;
+		readValue(replay, &transpose, sizeof(transpose));
+		const GLdouble *value = (const GLdouble *)readPointer(replay);
+		glad_glProgramUniformMatrix4dv(program, location, count, transpose, value);
+		break;
+	}
+	case 474: { /* glProgramUniformMatrix2x3fv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLboolean transpose;
+		readValue(replay, &transpose, sizeof(transpose));
+		const GLfloat *value = (const GLfloat *)readPointer(replay);
+		glad_glProgramUniformMatrix2x3fv(program, location, count, transpose, value);
+		break;
+	}
+	case 475: { /* glProgramUniformMatrix3x2fv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLboolean transpose;
+		readValue(replay, &transpose, sizeof(transpose));
+		const GLfloat *value = (const GLfloat *)readPointer(replay);
+		glad_glProgramUniformMatrix3x2fv(program, location, count, transpose, value);
+		break;
+	}
+	case 476: { /* glProgramUniformMatrix2x4fv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLboolean transpose;
+		readValue(replay, &transpose, sizeof(transpose));
+		const GLfloat *value = (const GLfloat *)readPointer(replay);
+		glad_glProgramUniformMatrix2x4fv(program, location, count, transpose, value);
+		break;
+	}
+	case 477: { /* glProgramUniformMatrix4x2fv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLboolean transpose;
+		readValue(replay, &transpose, sizeof(transpose));
+		const GLfloat *value = (const GLfloat *)readPointer(replay);
+		glad_glProgramUniformMatrix4x2fv(program, location, count, transpose, value);
+		break;
+	}
+	case 478: { /* glProgramUniformMatrix3x4fv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLboolean transpose;
+		readValue(replay, &transpose, sizeof(transpose));
+		const GLfloat *value = (const GLfloat *)readPointer(replay);
+		glad_glProgramUniformMatrix3x4fv(program, location, count, transpose, value);
+		break;
+	}
+	case 479: { /* glProgramUniformMatrix4x3fv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLboolean transpose;
+		readValue(replay, &transpose, sizeof(transpose));
+		const GLfloat *value = (const GLfloat *)readPointer(replay);
+		glad_glProgramUniformMatrix4x3fv(program, location, count, transpose, value);
+		break;
+	}
+	case 480: { /* glProgramUniformMatrix2x3dv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLboolean transpose;
+		readValue(replay, &transpose, sizeof(transpose));
+		const GLdouble *value = (const GLdouble *)readPointer(replay);
+		glad_glProgramUniformMatrix2x3dv(program, location, count, transpose, value);
+		break;
+	}
+	case 481: { /* glProgramUniformMatrix3x2dv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLboolean transpose;
+		readValue(replay, &transpose, sizeof(transpose));
+		const GLdouble *value = (const GLdouble *)readPointer(replay);
+		glad_glProgramUniformMatrix3x2dv(program, location, count, transpose, value);
+		break;
+	}
+	case 482: { /* glProgramUniformMatrix2x4dv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLboolean transpose;
+		readValue(replay, &transpose, sizeof(transpose));
+		const GLdouble *value = (const GLdouble *)readPointer(replay);
+		glad_glProgramUniformMatrix2x4dv(program, location, count, transpose, value);
+		break;
+	}
+	case 483: { /* glProgramUniformMatrix4x2dv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLboolean transpose;
+		readValue(replay, &transpose, sizeof(transpose));
+		const GLdouble *value = (const GLdouble *)readPointer(replay);
+		glad_glProgramUniformMatrix4x2dv(program, location, count, transpose, value);
+		break;
+	}
+	case 484: { /* glProgramUniformMatrix3x4dv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLboolean transpose;
+		readValue(replay, &transpose, sizeof(transpose));
+		const GLdouble *value = (const GLdouble *)readPointer(replay);
+		glad_glProgramUniformMatrix3x4dv(program, location, count, transpose, value);
+		break;
+	}
+	case 485: { /* glProgramUniformMatrix4x3dv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLboolean transpose;
+		readValue(replay, &transpose, sizeof(transpose));
+		const GLdouble *value = (const GLdouble *)readPointer(replay);
+		glad_glProgramUniformMatrix4x3dv(program, location, count, transpose, value);
+		break;
+	}
+	case 486: { /* glValidateProgramPipeline */
+		GLuint pipeline;
+		readValue(replay, &pipeline, sizeof(pipeline));
+		pipeline = mapName(replay, NAME_PIPELINE, pipeline);
+		glad_glValidateProgramPipeline(pipeline);
+		break;
+	}
+	case 487: { /* glGetProgramPipelineInfoLog */
+		GLuint pipeline;
+		readValue(replay, &pipeline, sizeof(pipeline));
+		pipeline = mapName(replay, NAME_PIPELINE, pipeline);
+		GLsizei bufSize;
+		readValue(replay, &bufSize, sizeof(bufSize));
+		GLsizei *length = (GLsizei *)readPointer(replay);
+		GLchar *infoLog = (GLchar *)readPointer(replay);
+		glad_glGetProgramPipelineInfoLog(pipeline, bufSize, length, infoLog);
+		break;
+	}
+	case 488: { /* glVertexAttribL1d */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLdouble x;
+		readValue(replay, &x, sizeof(x));
+		glad_glVertexAttribL1d(index, x);
+		break;
+	}
+	case 489: { /* glVertexAttribL2d */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLdouble x;
+		readValue(replay, &x, sizeof(x));
+		GLdouble y;
+		readValue(replay, &y, sizeof(y));
+		glad_glVertexAttribL2d(index, x, y);
+		break;
+	}
+	case 490: { /* glVertexAttribL3d */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLdouble x;
+		readValue(replay, &x, sizeof(x));
+		GLdouble y;
+		readValue(replay, &y, sizeof(y));
+		GLdouble z;
+		readValue(replay, &z, sizeof(z));
+		glad_glVertexAttribL3d(index, x, y, z);
+		break;
+	}
+	case 491: { /* glVertexAttribL4d */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLdouble x;
+		readValue(replay, &x, sizeof(x));
+		GLdouble y;
+		readValue(replay, &y, sizeof(y));
+		GLdouble z;
+		readValue(replay, &z, sizeof(z));
+		GLdouble w;
+		readValue(replay, &w, sizeof(w));
+		glad_glVertexAttribL4d(index, x, y, z, w);
+		break;
+	}
+	case 492: { /* glVertexAttribL1dv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		const GLdouble *v = (const GLdouble *)readPointer(replay);
+		glad_glVertexAttribL1dv(index, v);
+		break;
+	}
+	case 493: { /* glVertexAttribL2dv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		const GLdouble *v = (const GLdouble *)readPointer(replay);
+		glad_glVertexAttribL2dv(index, v);
+		break;
+	}
+	case 494: { /* glVertexAttribL3dv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		const GLdouble *v = (const GLdouble *)readPointer(replay);
+		glad_glVertexAttribL3dv(index, v);
+		break;
+	}
+	case 495: { /* glVertexAttribL4dv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		const GLdouble *v = (const GLdouble *)readPointer(replay);
+		glad_glVertexAttribL4dv(index, v);
+		break;
+	}
+	case 496: { /* glVertexAttribLPointer */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLint size;
+		readValue(replay, &size, sizeof(size));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		GLsizei stride;
+		readValue(replay, &stride, sizeof(stride));
+		const void *pointer = (const void *)readPointer(replay);
+		glad_glVertexAttribLPointer(index, size, type, stride, pointer);
+		break;
+	}
+	case 497: { /* glGetVertexAttribLdv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLdouble *params = (GLdouble *)readPointer(replay);
+		glad_glGetVertexAttribLdv(index, pname, params);
+		break;
+	}
+	case 498: { /* glViewportArrayv */
+		GLuint first;
+		readValue(replay, &first, sizeof(first));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLfloat *v = (const GLfloat *)readPointer(replay);
+		glad_glViewportArrayv(first, count, v);
+		break;
+	}
+	case 499: { /* glViewportIndexedf */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLfloat x;
+		readValue(replay, &x, sizeof(x));
+		GLfloat y;
+		readValue(replay, &y, sizeof(y));
+		GLfloat w;
+		readValue(replay, &w, sizeof(w));
+		GLfloat h;
+		readValue(replay, &h, sizeof(h));
+		glad_glViewportIndexedf(index, x, y, w, h);
+		break;
+	}
+	case 500: { /* glViewportIndexedfv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		const GLfloat *v = (const GLfloat *)readPointer(replay);
+		glad_glViewportIndexedfv(index, v);
+		break;
+	}
+	case 501: { /* glScissorArrayv */
+		GLuint first;
+		readValue(replay, &first, sizeof(first));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLint *v = (const GLint *)readPointer(replay);
+		glad_glScissorArrayv(first, count, v);
+		break;
+	}
+	case 502: { /* glScissorIndexed */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLint left;
+		readValue(replay, &left, sizeof(left));
+		GLint bottom;
+		readValue(replay, &bottom, sizeof(bottom));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLsizei height;
+		readValue(replay, &height, sizeof(height));
+		glad_glScissorIndexed(index, left, bottom, width, height);
+		break;
+	}
+	case 503: { /* glScissorIndexedv */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		const GLint *v = (const GLint *)readPointer(replay);
+		glad_glScissorIndexedv(index, v);
+		break;
+	}
+	case 504: { /* glDepthRangeArrayv */
+		GLuint first;
+		readValue(replay, &first, sizeof(first));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLdouble *v = (const GLdouble *)readPointer(replay);
+		glad_glDepthRangeArrayv(first, count, v);
+		break;
+	}
+	case 505: { /* glDepthRangeIndexed */
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLdouble n;
+		readValue(replay, &n, sizeof(n));
+		GLdouble f;
+		readValue(replay, &f, sizeof(f));
+		glad_glDepthRangeIndexed(index, n, f);
+		break;
+	}
+	case 506: { /* glGetFloati_v */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLfloat *data = (GLfloat *)readPointer(replay);
+		glad_glGetFloati_v(target, index, data);
+		break;
+	}
+	case 507: { /* glGetDoublei_v */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLdouble *data = (GLdouble *)readPointer(replay);
+		glad_glGetDoublei_v(target, index, data);
+		break;
+	}
+	case 508: { /* glDrawArraysInstancedBaseInstance */
+		GLenum mode;
+		readValue(replay, &mode, sizeof(mode));
+		GLint first;
+		readValue(replay, &first, sizeof(first));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLsizei instancecount;
+		readValue(replay, &instancecount, sizeof(instancecount));
+		GLuint baseinstance;
+		readValue(replay, &baseinstance, sizeof(baseinstance));
+		glad_glDrawArraysInstancedBaseInstance(mode, first, count, instancecount, baseinstance);
+		break;
+	}
+	case 509: { /* glDrawElementsInstancedBaseInstance */
+		GLenum mode;
+		readValue(replay, &mode, sizeof(mode));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		const void *indices = (const void *)readPointer(replay);
+		GLsizei instancecount;
+		readValue(replay, &instancecount, sizeof(instancecount));
+		GLuint baseinstance;
+		readValue(replay, &baseinstance, sizeof(baseinstance));
+		glad_glDrawElementsInstancedBaseInstance(mode, count, type, indices, instancecount, baseinstance);
+		break;
+	}
+	case 510: { /* glDrawElementsInstancedBaseVertexBaseInstance */
+		GLenum mode;
+		readValue(replay, &mode, sizeof(mode));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		const void *indices = (const void *)readPointer(replay);
+		GLsizei instancecount;
+		readValue(replay, &instancecount, sizeof(instancecount));
+		GLint basevertex;
+		readValue(replay, &basevertex, sizeof(basevertex));
+		GLuint baseinstance;
+		readValue(replay, &baseinstance, sizeof(baseinstance));
+		glad_glDrawElementsInstancedBaseVertexBaseInstance(mode, count, type, indices, instancecount, basevertex, baseinstance);
+		break;
+	}
+	case 511: { /* glGetInternalformativ */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLenum internalformat;
+		readValue(replay, &internalformat, sizeof(internalformat));
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLint *params = (GLint *)readPointer(replay);
+		glad_glGetInternalformativ(target, internalformat, pname, count, params);
+		break;
+	}
+	case 512: { /* glGetActiveAtomicCounterBufferiv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLuint bufferIndex;
+		readValue(replay, &bufferIndex, sizeof(bufferIndex));
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint *params = (GLint *)readPointer(replay);
+		glad_glGetActiveAtomicCounterBufferiv(program, bufferIndex, pname, params);
+		break;
+	}
+	case 513: { /* glBindImageTexture */
+		GLuint unit;
+		readValue(replay, &unit, sizeof(unit));
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		GLint level;
+		readValue(replay, &level, sizeof(level));
+		GLboolean layered;
+		readValue(replay, &layered, sizeof(layered));
+		GLint layer;
+		readValue(replay, &layer, sizeof(layer));
+		GLenum access;
+		readValue(replay, &access, sizeof(access));
+		GLenum format;
+		readValue(replay, &format, sizeof(format));
+		glad_glBindImageTexture(unit, texture, level, layered, layer, access, format);
+		break;
+	}
+	case 514: { /* glMemoryBarrier */
+		GLbitfield barriers;
+		readValue(replay, &barriers, sizeof(barriers));
+		glad_glMemoryBarrier(barriers);
+		break;
+	}
+	case 515: { /* glTexStorage1D */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLsizei levels;
+		readValue(replay, &levels, sizeof(levels));
+		GLenum internalformat;
+		readValue(replay, &internalformat, sizeof(internalformat));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		glad_glTexStorage1D(target, levels, internalformat, width);
+		break;
+	}
+	case 516: { /* glTexStorage2D */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLsizei levels;
+		readValue(replay, &levels, sizeof(levels));
+		GLenum internalformat;
+		readValue(replay, &internalformat, sizeof(internalformat));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLsizei height;
+		readValue(replay, &height, sizeof(height));
+		glad_glTexStorage2D(target, levels, internalformat, width, height);
+		break;
+	}
+	case 517: { /* glTexStorage3D */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLsizei levels;
+		readValue(replay, &levels, sizeof(levels));
+		GLenum internalformat;
+		readValue(replay, &internalformat, sizeof(internalformat));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLsizei height;
+		readValue(replay, &height, sizeof(height));
+		GLsizei depth;
+		readValue(replay, &depth, sizeof(depth));
+		glad_glTexStorage3D(target, levels, internalformat, width, height, depth);
+		break;
+	}
+	case 518: { /* glDrawTransformFeedbackInstanced */
+		GLenum mode;
+		readValue(replay, &mode, sizeof(mode));
+		GLuint id;
+		readValue(replay, &id, sizeof(id));
+		id = mapName(replay, NAME_TRANSFORM_FEEDBACK, id);
+		GLsizei instancecount;
+		readValue(replay, &instancecount, sizeof(instancecount));
+		glad_glDrawTransformFeedbackInstanced(mode, id, instancecount);
+		break;
+	}
+	case 519: { /* glDrawTransformFeedbackStreamInstanced */
+		GLenum mode;
+		readValue(replay, &mode, sizeof(mode));
+		GLuint id;
+		readValue(replay, &id, sizeof(id));
+		id = mapName(replay, NAME_TRANSFORM_FEEDBACK, id);
+		GLuint stream;
+		readValue(replay, &stream, sizeof(stream));
+		GLsizei instancecount;
+		readValue(replay, &instancecount, sizeof(instancecount));
+		glad_glDrawTransformFeedbackStreamInstanced(mode, id, stream, instancecount);
+		break;
+	}
+	case 520: { /* glClearBufferData */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLenum internalformat;
+		readValue(replay, &internalformat, sizeof(internalformat));
+		GLenum format;
+		readValue(replay, &format, sizeof(format));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		const void *data = (const void *)readPointer(replay);
+		glad_glClearBufferData(target, internalformat, format, type, data);
+		break;
+	}
+	case 521: { /* glClearBufferSubData */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLenum internalformat;
+		readValue(replay, &internalformat, sizeof(internalformat));
+		GLintptr offset;
+		readValue(replay, &offset, sizeof(offset));
+		GLsizeiptr size;
+		readValue(replay, &size, sizeof(size));
+		GLenum format;
+		readValue(replay, &format, sizeof(format));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		const void *data = (const void *)readPointer(replay);
+		glad_glClearBufferSubData(target, internalformat, offset, size, format, type, data);
+		break;
+	}
+	case 522: { /* glDispatchCompute */
+		GLuint num_groups_x;
+		readValue(replay, &num_groups_x, sizeof(num_groups_x));
+		GLuint num_groups_y;
+		readValue(replay, &num_groups_y, sizeof(num_groups_y));
+		GLuint num_groups_z;
+		readValue(replay, &num_groups_z, sizeof(num_groups_z));
+		glad_glDispatchCompute(num_groups_x, num_groups_y, num_groups_z);
+		break;
+	}
+	case 523: { /* glDispatchComputeIndirect */
+		GLintptr indirect;
+		readValue(replay, &indirect, sizeof(indirect));
+		glad_glDispatchComputeIndirect(indirect);
+		break;
+	}
+	case 524: { /* glCopyImageSubData */
+		GLuint srcName;
+		readValue(replay, &srcName, sizeof(srcName));
+		GLenum srcTarget;
+		readValue(replay, &srcTarget, sizeof(srcTarget));
+		GLint srcLevel;
+		readValue(replay, &srcLevel, sizeof(srcLevel));
+		GLint srcX;
+		readValue(replay, &srcX, sizeof(srcX));
+		GLint srcY;
+		readValue(replay, &srcY, sizeof(srcY));
+		GLint srcZ;
+		readValue(replay, &srcZ, sizeof(srcZ));
+		GLuint dstName;
+		readValue(replay, &dstName, sizeof(dstName));
+		GLenum dstTarget;
+		readValue(replay, &dstTarget, sizeof(dstTarget));
+		GLint dstLevel;
+		readValue(replay, &dstLevel, sizeof(dstLevel));
+		GLint dstX;
+		readValue(replay, &dstX, sizeof(dstX));
+		GLint dstY;
+		readValue(replay, &dstY, sizeof(dstY));
+		GLint dstZ;
+		readValue(replay, &dstZ, sizeof(dstZ));
+		GLsizei srcWidth;
+		readValue(replay, &srcWidth, sizeof(srcWidth));
+		GLsizei srcHeight;
+		readValue(replay, &srcHeight, sizeof(srcHeight));
+		GLsizei srcDepth;
+		readValue(replay, &srcDepth, sizeof(srcDepth));
+		glad_glCopyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+		break;
+	}
+	case 525: { /* glFramebufferParameteri */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint param;
+		readValue(replay, &param, sizeof(param));
+		glad_glFramebufferParameteri(target, pname, param);
+		break;
+	}
+	case 526: { /* glGetFramebufferParameteriv */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint *params = (GLint *)readPointer(replay);
+		glad_glGetFramebufferParameteriv(target, pname, params);
+		break;
+	}
+	case 527: { /* glGetInternalformati64v */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLenum internalformat;
+		readValue(replay, &internalformat, sizeof(internalformat));
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLint64 *params = (GLint64 *)readPointer(replay);
+		glad_glGetInternalformati64v(target, internalformat, pname, count, params);
+		break;
+	}
+	case 528: { /* glInvalidateTexSubImage */
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		GLint level;
+		readValue(replay, &level, sizeof(level));
+		GLint xoffset;
+		readValue(replay, &xoffset, sizeof(xoffset));
+		GLint yoffset;
+		readValue(replay, &yoffset, sizeof(yoffset));
+		GLint zoffset;
+		readValue(replay, &zoffset, sizeof(zoffset));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLsizei height;
+		readValue(replay, &height, sizeof(height));
+		GLsizei depth;
+		readValue(replay, &depth, sizeof(depth));
+		glad_glInvalidateTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth);
+		break;
+	}
+	case 529: { /* glInvalidateTexImage */
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		GLint level;
+		readValue(replay, &level, sizeof(level));
+		glad_glInvalidateTexImage(texture, level);
+		break;
+	}
+	case 530: { /* glInvalidateBufferSubData */
+		GLuint buffer;
+		readValue(replay, &buffer, sizeof(buffer));
+		buffer = mapName(replay, NAME_BUFFER, buffer);
+		GLintptr offset;
+		readValue(replay, &offset, sizeof(offset));
+		GLsizeiptr length;
+		readValue(replay, &length, sizeof(length));
+		glad_glInvalidateBufferSubData(buffer, offset, length);
+		break;
+	}
+	case 531: { /* glInvalidateBufferData */
+		GLuint buffer;
+		readValue(replay, &buffer, sizeof(buffer));
+		buffer = mapName(replay, NAME_BUFFER, buffer);
+		glad_glInvalidateBufferData(buffer);
+		break;
+	}
+	case 532: { /* glInvalidateFramebuffer */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLsizei numAttachments;
+		readValue(replay, &numAttachments, sizeof(numAttachments));
+		const GLenum *attachments = (const GLenum *)readPointer(replay);
+		glad_glInvalidateFramebuffer(target, numAttachments, attachments);
+		break;
+	}
+	case 533: { /* glInvalidateSubFramebuffer */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLsizei numAttachments;
+		readValue(replay, &numAttachments, sizeof(numAttachments));
+		const GLenum *attachments = (const GLenum *)readPointer(replay);
+		GLint x;
+		readValue(replay, &x, sizeof(x));
+		GLint y;
+		readValue(replay, &y, sizeof(y));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLsizei height;
+		readValue(replay, &height, sizeof(height));
+		glad_glInvalidateSubFramebuffer(target, numAttachments, attachments, x, y, width, height);
+		break;
+	}
+	case 534: { /* glMultiDrawArraysIndirect */
+		GLenum mode;
+		readValue(replay, &mode, sizeof(mode));
+		const void *indirect = (const void *)readPointer(replay);
+		GLsizei drawcount;
+		readValue(replay, &drawcount, sizeof(drawcount));
+		GLsizei stride;
+		readValue(replay, &stride, sizeof(stride));
+		glad_glMultiDrawArraysIndirect(mode, indirect, drawcount, stride);
+		break;
+	}
+	case 535: { /* glMultiDrawElementsIndirect */
+		GLenum mode;
+		readValue(replay, &mode, sizeof(mode));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		const void *indirect = (const void *)readPointer(replay);
+		GLsizei drawcount;
+		readValue(replay, &drawcount, sizeof(drawcount));
+		GLsizei stride;
+		readValue(replay, &stride, sizeof(stride));
+		glad_glMultiDrawElementsIndirect(mode, type, indirect, drawcount, stride);
+		break;
+	}
+	case 536: { /* glGetProgramInterfaceiv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLenum programInterface;
+		readValue(replay, &programInterface, sizeof(programInterface));
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint *params = (GLint *)readPointer(replay);
+		glad_glGetProgramInterfaceiv(program, programInterface, pname, params);
+		break;
+	}
+	case 537: { /* glGetProgramResourceIndex */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLenum programInterface;
+		readValue(replay, &programInterface, sizeof(programInterface));
+		const GLchar *name = (const GLchar *)readPointer(replay);
+		GLuint result = glad_glGetProgramResourceIndex(program, programInterface, name);
+
+		checkResult(replay, &result, sizeof(result));
+		break;
+	}
+	case 538: { /* glGetProgramResourceName */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLenum programInterface;
+		readValue(replay, &programInterface, sizeof(programInterface));
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLsizei bufSize;
+		readValue(replay, &bufSize, sizeof(bufSize));
+		GLsizei *length = (GLsizei *)readPointer(replay);
+		GLchar *name = (GLchar *)readPointer(replay);
+		glad_glGetProgramResourceName(program, programInterface, index, bufSize, length, name);
+		break;
+	}
+	case 539: { /* glGetProgramResourceiv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLenum programInterface;
+		readValue(replay, &programInterface, sizeof(programInterface));
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLsizei propCount;
+		readValue(replay, &propCount, sizeof(propCount));
+		const GLenum *props = (const GLenum *)readPointer(replay);
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		GLsizei *length = (GLsizei *)readPointer(replay);
+		GLint *params = (GLint *)readPointer(replay);
+		glad_glGetProgramResourceiv(program, programInterface, index, propCount, props, count, length, params);
+		break;
+	}
+	case 540: { /* glGetProgramResourceLocation */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLenum programInterface;
+		readValue(replay, &programInterface, sizeof(programInterface));
+		const GLchar *name = (const GLchar *)readPointer(replay);
+		GLint result = glad_glGetProgramResourceLocation(program, programInterface, name);
+
+		checkResult(replay, &result, sizeof(result));
+		break;
+	}
+	case 541: { /* glGetProgramResourceLocationIndex */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLenum programInterface;
+		readValue(replay, &programInterface, sizeof(programInterface));
+		const GLchar *name = (const GLchar *)readPointer(replay);
+		GLint result = glad_glGetProgramResourceLocationIndex(program, programInterface, name);
+
+		checkResult(replay, &result, sizeof(result));
+		break;
+	}
+	case 542: { /* glShaderStorageBlockBinding */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLuint storageBlockIndex;
+		readValue(replay, &storageBlockIndex, sizeof(storageBlockIndex));
+		GLuint storageBlockBinding;
+		readValue(replay, &storageBlockBinding, sizeof(storageBlockBinding));
+		glad_glShaderStorageBlockBinding(program, storageBlockIndex, storageBlockBinding);
+		break;
+	}
+	case 543: { /* glTexBufferRange */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLenum internalformat;
+		readValue(replay, &internalformat, sizeof(internalformat));
+		GLuint buffer;
+		readValue(replay, &buffer, sizeof(buffer));
+		buffer = mapName(replay, NAME_BUFFER, buffer);
+		GLintptr offset;
+		readValue(replay, &offset, sizeof(offset));
+		GLsizeiptr size;
+		readValue(replay, &size, sizeof(size));
+		glad_glTexBufferRange(target, internalformat, buffer, offset, size);
+		break;
+	}
+	case 544: { /* glTexStorage2DMultisample */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLsizei samples;
+		readValue(replay, &samples, sizeof(samples));
+		GLenum internalformat;
+		readValue(replay, &internalformat, sizeof(internalformat));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLsizei height;
+		readValue(replay, &height, sizeof(height));
+		GLboolean fixedsamplelocations;
+		readValue(replay, &fixedsamplelocations, sizeof(fixedsamplelocations));
+		glad_glTexStorage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+		break;
+	}
+	case 545: { /* glTexStorage3DMultisample */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLsizei samples;
+		readValue(replay, &samples, sizeof(samples));
+		GLenum internalformat;
+		readValue(replay, &internalformat, sizeof(internalformat));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLsizei height;
+		readValue(replay, &height, sizeof(height));
+		GLsizei depth;
+		readValue(replay, &depth, sizeof(depth));
+		GLboolean fixedsamplelocations;
+		readValue(replay, &fixedsamplelocations, sizeof(fixedsamplelocations));
+		glad_glTexStorage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+		break;
+	}
+	case 546: { /* glTextureView */
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLuint origtexture;
+		readValue(replay, &origtexture, sizeof(origtexture));
+		origtexture = mapName(replay, NAME_TEXTURE, origtexture);
+		GLenum internalformat;
+		readValue(replay, &internalformat, sizeof(internalformat));
+		GLuint minlevel;
+		readValue(replay, &minlevel, sizeof(minlevel));
+		GLuint numlevels;
+		readValue(replay, &numlevels, sizeof(numlevels));
+		GLuint minlayer;
+		readValue(replay, &minlayer, sizeof(minlayer));
+		GLuint numlayers;
+		readValue(replay, &numlayers, sizeof(numlayers));
+		glad_glTextureView(texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
+		break;
+	}
+	case 547: { /* glBindVertexBuffer */
+		GLuint bindingindex;
+		readValue(replay, &bindingindex, sizeof(bindingindex));
+		GLuint buffer;
+		readValue(replay, &buffer, sizeof(buffer));
+		buffer = mapName(replay, NAME_BUFFER, buffer);
+		GLintptr offset;
+		readValue(replay, &offset, sizeof(offset));
+		GLsizei stride;
+		readValue(replay, &stride, sizeof(stride));
+		glad_glBindVertexBuffer(bindingindex, buffer, offset, stride);
+		break;
+	}
+	case 548: { /* glVertexAttribFormat */
+		GLuint attribindex;
+		readValue(replay, &attribindex, sizeof(attribindex));
+		GLint size;
+		readValue(replay, &size, sizeof(size));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		GLboolean normalized;
+		readValue(replay, &normalized, sizeof(normalized));
+		GLuint relativeoffset;
+		readValue(replay, &relativeoffset, sizeof(relativeoffset));
+		glad_glVertexAttribFormat(attribindex, size, type, normalized, relativeoffset);
+		break;
+	}
+	case 549: { /* glVertexAttribIFormat */
+		GLuint attribindex;
+		readValue(replay, &attribindex, sizeof(attribindex));
+		GLint size;
+		readValue(replay, &size, sizeof(size));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		GLuint relativeoffset;
+		readValue(replay, &relativeoffset, sizeof(relativeoffset));
+		glad_glVertexAttribIFormat(attribindex, size, type, relativeoffset);
+		break;
+	}
+	case 550: { /* glVertexAttribLFormat */
+		GLuint attribindex;
+		readValue(replay, &attribindex, sizeof(attribindex));
+		GLint size;
+		readValue(replay, &size, sizeof(size));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		GLuint relativeoffset;
+		readValue(replay, &relativeoffset, sizeof(relativeoffset));
+		glad_glVertexAttribLFormat(attribindex, size, type, relativeoffset);
+		break;
+	}
+	case 551: { /* glVertexAttribBinding */
+		GLuint attribindex;
+		readValue(replay, &attribindex, sizeof(attribindex));
+		GLuint bindingindex;
+		readValue(replay, &bindingindex, sizeof(bindingindex));
+		glad_glVertexAttribBinding(attribindex, bindingindex);
+		break;
+	}
+	case 552: { /* glVertexBindingDivisor */
+		GLuint bindingindex;
+		readValue(replay, &bindingindex, sizeof(bindingindex));
+		GLuint divisor;
+		readValue(replay, &divisor, sizeof(divisor));
+		glad_glVertexBindingDivisor(bindingindex, divisor);
+		break;
+	}
+	case 553: { /* glDebugMessageControl */
+		GLenum source;
+		readValue(replay, &source, sizeof(source));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		GLenum severity;
+		readValue(replay, &severity, sizeof(severity));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLuint *ids = (const GLuint *)readPointer(replay);
+		GLboolean enabled;
+		readValue(replay, &enabled, sizeof(enabled));
+		glad_glDebugMessageControl(source, type, severity, count, ids, enabled);
+		break;
+	}
+	case 554: { /* glDebugMessageInsert */
+		GLenum source;
+		readValue(replay, &source, sizeof(source));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		GLuint id;
+		readValue(replay, &id, sizeof(id));
+		GLenum severity;
+		readValue(replay, &severity, sizeof(severity));
+		GLsizei length;
+		readValue(replay, &length, sizeof(length));
+		const GLchar *buf = (const GLchar *)readPointer(replay);
+		glad_glDebugMessageInsert(source, type, id, severity, length, buf);
+		break;
+	}
+	case 555: { /* glDebugMessageCallback */
+		GLDEBUGPROC callback = NULL;
+		readPointer(replay);
+		const void *userParam = (const void *)readPointer(replay);
+		glad_glDebugMessageCallback(callback, userParam);
+		break;
+	}
+	case 556: { /* glGetDebugMessageLog */
+		GLuint count;
+		readValue(replay, &count, sizeof(count));
+		GLsizei bufSize;
+		readValue(replay, &bufSize, sizeof(bufSize));
+		GLenum *sources = (GLenum *)readPointer(replay);
+		GLenum *types = (GLenum *)readPointer(replay);
+		GLuint *ids = (GLuint *)readPointer(replay);
+		GLenum *severities = (GLenum *)readPointer(replay);
+		GLsizei *lengths = (GLsizei *)readPointer(replay);
+		GLchar *messageLog = (GLchar *)readPointer(replay);
+		GLuint result = glad_glGetDebugMessageLog(count, bufSize, sources, types, ids, severities, lengths, messageLog);
+
+		checkResult(replay, &result, sizeof(result));
+		break;
+	}
+	case 557: { /* glPushDebugGroup */
+		GLenum source;
+		readValue(replay, &source, sizeof(source));
+		GLuint id;
+		readValue(replay, &id, sizeof(id));
+		GLsizei length;
+		readValue(replay, &length, sizeof(length));
+		const GLchar *message = (const GLchar *)readPointer(replay);
+		glad_glPushDebugGroup(source, id, length, message);
+		break;
+	}
+	case 558: { /* glPopDebugGroup */
+		glad_glPopDebugGroup();
+		break;
+	}
+	case 559: { /* glObjectLabel */
+		GLenum identifier;
+		readValue(replay, &identifier, sizeof(identifier));
+		GLuint name;
+		readValue(replay, &name, sizeof(name));
+		GLsizei length;
+		readValue(replay, &length, sizeof(length));
+		const GLchar *label = (const GLchar *)readPointer(replay);
+		glad_glObjectLabel(identifier, name, length, label);
+		break;
+	}
+	case 560: { /* glGetObjectLabel */
+		GLenum identifier;
+		readValue(replay, &identifier, sizeof(identifier));
+		GLuint name;
+		readValue(replay, &name, sizeof(name));
+		GLsizei bufSize;
+		readValue(replay, &bufSize, sizeof(bufSize));
+		GLsizei *length = (GLsizei *)readPointer(replay);
+		GLchar *label = (GLchar *)readPointer(replay);
+		glad_glGetObjectLabel(identifier, name, bufSize, length, label);
+		break;
+	}
+	case 561: { /* glObjectPtrLabel */
+		const void *ptr = (const void *)readSync(replay);
+		GLsizei length;
+		readValue(replay, &length, sizeof(length));
+		const GLchar *label = (const GLchar *)readPointer(replay);
+		glad_glObjectPtrLabel(ptr, length, label);
+		break;
+	}
+	case 562: { /* glGetObjectPtrLabel */
+		const void *ptr = (const void *)readSync(replay);
+		GLsizei bufSize;
+		readValue(replay, &bufSize, sizeof(bufSize));
+		GLsizei *length = (GLsizei *)readPointer(replay);
+		GLchar *label = (GLchar *)readPointer(replay);
+		glad_glGetObjectPtrLabel(ptr, bufSize, length, label);
+		break;
+	}
+	case 563: { /* glGetPointerv */
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		void **params = (void **)readPointer(replay);
+		glad_glGetPointerv(pname, params);
+		break;
+	}
+	case 564: { /* glBufferStorage */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLsizeiptr size;
+		readValue(replay, &size, sizeof(size));
+		const void *data = (const void *)readPointer(replay);
+		GLbitfield flags;
+		readValue(replay, &flags, sizeof(flags));
+		glad_glBufferStorage(target, size, data, flags);
+		break;
+	}
+	case 565: { /* glClearTexImage */
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		GLint level;
+		readValue(replay, &level, sizeof(level));
+		GLenum format;
+		readValue(replay, &format, sizeof(format));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		const void *data = (const void *)readPointer(replay);
+		glad_glClearTexImage(texture, level, format, type, data);
+		break;
+	}
+	case 566: { /* glClearTexSubImage */
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		GLint level;
+		readValue(replay, &level, sizeof(level));
+		GLint xoffset;
+		readValue(replay, &xoffset, sizeof(xoffset));
+		GLint yoffset;
+		readValue(replay, &yoffset, sizeof(yoffset));
+		GLint zoffset;
+		readValue(replay, &zoffset, sizeof(zoffset));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLsizei height;
+		readValue(replay, &height, sizeof(height));
+		GLsizei depth;
+		readValue(replay, &depth, sizeof(depth));
+		GLenum format;
+		readValue(replay, &format, sizeof(format));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		const void *data = (const void *)readPointer(replay);
+		glad_glClearTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data);
+		break;
+	}
+	case 567: { /* glBindBuffersBase */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLuint first;
+		readValue(replay, &first, sizeof(first));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLuint *buffers = (const GLuint *)readPointer(replay);
+		buffers = mapNames(replay, NAME_BUFFER, buffers, count);
+		glad_glBindBuffersBase(target, first, count, buffers);
+		break;
+	}
+	case 568: { /* glBindBuffersRange */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLuint first;
+		readValue(replay, &first, sizeof(first));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLuint *buffers = (const GLuint *)readPointer(replay);
+		buffers = mapNames(replay, NAME_BUFFER, buffers, count);
+		const GLintptr *offsets = (const GLintptr *)readPointer(replay);
+		const GLsizeiptr *sizes = (const GLsizeiptr *)readPointer(replay);
+		glad_glBindBuffersRange(target, first, count, buffers, offsets, sizes);
+		break;
+	}
+	case 569: { /* glBindTextures */
+		GLuint first;
+		readValue(replay, &first, sizeof(first));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLuint *textures = (const GLuint *)readPointer(replay);
+		textures = mapNames(replay, NAME_TEXTURE, textures, count);
+		glad_glBindTextures(first, count, textures);
+		break;
+	}
+	case 570: { /* glBindSamplers */
+		GLuint first;
+		readValue(replay, &first, sizeof(first));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLuint *samplers = (const GLuint *)readPointer(replay);
+		samplers = mapNames(replay, NAME_SAMPLER, samplers, count);
+		glad_glBindSamplers(first, count, samplers);
+		break;
+	}
+	case 571: { /* glBindImageTextures */
+		GLuint first;
+		readValue(replay, &first, sizeof(first));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLuint *textures = (const GLuint *)readPointer(replay);
+		textures = mapNames(replay, NAME_TEXTURE, textures, count);
+		glad_glBindImageTextures(first, count, textures);
+		break;
+	}
+	case 572: { /* glBindVertexBuffers */
+		GLuint first;
+		readValue(replay, &first, sizeof(first));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLuint *buffers = (const GLuint *)readPointer(replay);
+		buffers = mapNames(replay, NAME_BUFFER, buffers, count);
+		const GLintptr *offsets = (const GLintptr *)readPointer(replay);
+		const GLsizei *strides = (const GLsizei *)readPointer(replay);
+		glad_glBindVertexBuffers(first, count, buffers, offsets, strides);
+		break;
+	}
+	case 573: { /* glClipControl */
+		GLenum origin;
+		readValue(replay, &origin, sizeof(origin));
+		GLenum depth;
+		readValue(replay, &depth, sizeof(depth));
+		glad_glClipControl(origin, depth);
+		break;
+	}
+	case 574: { /* glCreateTransformFeedbacks */
+		GLsizei n;
+		readValue(replay, &n, sizeof(n));
+		GLuint *ids = (GLuint *)readPointer(replay);
+		glad_glCreateTransformFeedbacks(n, ids);
+		recordNames(replay, NAME_TRANSFORM_FEEDBACK);
+		break;
+	}
+	case 575: { /* glTransformFeedbackBufferBase */
+		GLuint xfb;
+		readValue(replay, &xfb, sizeof(xfb));
+		xfb = mapName(replay, NAME_TRANSFORM_FEEDBACK, xfb);
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLuint buffer;
+		readValue(replay, &buffer, sizeof(buffer));
+		buffer = mapName(replay, NAME_BUFFER, buffer);
+		glad_glTransformFeedbackBufferBase(xfb, index, buffer);
+		break;
+	}
+	case 576: { /* glTransformFeedbackBufferRange */
+		GLuint xfb;
+		readValue(replay, &xfb, sizeof(xfb));
+		xfb = mapName(replay, NAME_TRANSFORM_FEEDBACK, xfb);
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLuint buffer;
+		readValue(replay, &buffer, sizeof(buffer));
+		buffer = mapName(replay, NAME_BUFFER, buffer);
+		GLintptr offset;
+		readValue(replay, &offset, sizeof(offset));
+		GLsizeiptr size;
+		readValue(replay, &size, sizeof(size));
+		glad_glTransformFeedbackBufferRange(xfb, index, buffer, offset, size);
+		break;
+	}
+	case 577: { /* glGetTransformFeedbackiv */
+		GLuint xfb;
+		readValue(replay, &xfb, sizeof(xfb));
+		xfb = mapName(replay, NAME_TRANSFORM_FEEDBACK, xfb);
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint *param = (GLint *)readPointer(replay);
+		glad_glGetTransformFeedbackiv(xfb, pname, param);
+		break;
+	}
+	case 578: { /* glGetTransformFeedbacki_v */
+		GLuint xfb;
+		readValue(replay, &xfb, sizeof(xfb));
+		xfb = mapName(replay, NAME_TRANSFORM_FEEDBACK, xfb);
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLint *param = (GLint *)readPointer(replay);
+		glad_glGetTransformFeedbacki_v(xfb, pname, index, param);
+		break;
+	}
+	case 579: { /* glGetTransformFeedbacki64_v */
+		GLuint xfb;
+		readValue(replay, &xfb, sizeof(xfb));
+		xfb = mapName(replay, NAME_TRANSFORM_FEEDBACK, xfb);
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLint64 *param = (GLint64 *)readPointer(replay);
+		glad_glGetTransformFeedbacki64_v(xfb, pname, index, param);
+		break;
+	}
+	case 580: { /* glCreateBuffers */
+		GLsizei n;
+		readValue(replay, &n, sizeof(n));
+		GLuint *buffers = (GLuint *)readPointer(replay);
+		glad_glCreateBuffers(n, buffers);
+		recordNames(replay, NAME_BUFFER);
+		break;
+	}
+	case 581: { /* glNamedBufferStorage */
+		GLuint buffer;
+		readValue(replay, &buffer, sizeof(buffer));
+		buffer = mapName(replay, NAME_BUFFER, buffer);
+		GLsizeiptr size;
+		readValue(replay, &size, sizeof(size));
+		const void *data = (const void *)readPointer(replay);
+		GLbitfield flags;
+		readValue(replay, &flags, sizeof(flags));
+		glad_glNamedBufferStorage(buffer, size, data, flags);
+		break;
+	}
+	case 582: { /* glNamedBufferData */
+		GLuint buffer;
+		readValue(replay, &buffer, sizeof(buffer));
+		buffer = mapName(replay, NAME_BUFFER, buffer);
+		GLsizeiptr size;
+		readValue(replay, &size, sizeof(size));
+		const void *data = (const void *)readPointer(replay);
+		GLenum usage;
+		readValue(replay, &usage, sizeof(usage));
+		glad_glNamedBufferData(buffer, size, data, usage);
+		break;
+	}
+	case 583: { /* glNamedBufferSubData */
+		GLuint buffer;
+		readValue(replay, &buffer, sizeof(buffer));
+		buffer = mapName(replay, NAME_BUFFER, buffer);
+		GLintptr offset;
+		readValue(replay, &offset, sizeof(offset));
+		GLsizeiptr size;
+		readValue(replay, &size, sizeof(size));
+		const void *data = (const void *)readPointer(replay);
+		glad_glNamedBufferSubData(buffer, offset, size, data);
+		break;
+	}
+	case 584: { /* glCopyNamedBufferSubData */
+		GLuint readBuffer;
+		readValue(replay, &readBuffer, sizeof(readBuffer));
+		readBuffer = mapName(replay, NAME_BUFFER, readBuffer);
+		GLuint writeBuffer;
+		readValue(replay, &writeBuffer, sizeof(writeBuffer));
+		writeBuffer = mapName(replay, NAME_BUFFER, writeBuffer);
+		GLintptr readOffset;
+		readValue(replay, &readOffset, sizeof(readOffset));
+		GLintptr writeOffset;
+		readValue(replay, &writeOffset, sizeof(writeOffset));
+		GLsizeiptr size;
+		readValue(replay, &size, sizeof(size));
+		glad_glCopyNamedBufferSubData(readBuffer, writeBuffer, readOffset, writeOffset, size);
+		break;
+	}
+	case 585: { /* glClearNamedBufferData */
+		GLuint buffer;
+		readValue(replay, &buffer, sizeof(buffer));
+		buffer = mapName(replay, NAME_BUFFER, buffer);
+		GLenum internalformat;
+		readValue(replay, &internalformat, sizeof(internalformat));
+		GLenum format;
+		readValue(replay, &format, sizeof(format));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		const void *data = (const void *)readPointer(replay);
+		glad_glClearNamedBufferData(buffer, internalformat, format, type, data);
+		break;
+	}
+	case 586: { /* glClearNamedBufferSubData */
+		GLuint buffer;
+		readValue(replay, &buffer, sizeof(buffer));
+		buffer = mapName(replay, NAME_BUFFER, buffer);
+		GLenum internalformat;
+		readValue(replay, &internalformat, sizeof(internalformat));
+		GLintptr offset;
+		readValue(replay, &offset, sizeof(offset));
+		GLsizeiptr size;
+		readValue(replay, &size, sizeof(size));
+		GLenum format;
+		readValue(replay, &format, sizeof(format));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		const void *data = (const void *)readPointer(replay);
+		glad_glClearNamedBufferSubData(buffer, internalformat, offset, size, format, type, data);
+		break;
+	}
+	case 587: { /* glMapNamedBuffer */
+		GLuint buffer;
+		readValue(replay, &buffer, sizeof(buffer));
+		buffer = mapName(replay, NAME_BUFFER, buffer);
+		GLenum access;
+		readValue(replay, &access, sizeof(access));
+		glad_glMapNamedBuffer(buffer, access);
+		break;
+	}
+	case 588: { /* glMapNamedBufferRange */
+		GLuint buffer;
+		readValue(replay, &buffer, sizeof(buffer));
+		buffer = mapName(replay, NAME_BUFFER, buffer);
+		GLintptr offset;
+		readValue(replay, &offset, sizeof(offset));
+		GLsizeiptr length;
+		readValue(replay, &length, sizeof(length));
+		GLbitfield access;
+		readValue(replay, &access, sizeof(access));
+		glad_glMapNamedBufferRange(buffer, offset, length, access);
+		break;
+	}
+	case 589: { /* glUnmapNamedBuffer */
+		GLuint buffer;
+		readValue(replay, &buffer, sizeof(buffer));
+		buffer = mapName(replay, NAME_BUFFER, buffer);
+		GLboolean result = glad_glUnmapNamedBuffer(buffer);
+
+		checkResult(replay, &result, sizeof(result));
+		break;
+	}
+	case 590: { /* glFlushMappedNamedBufferRange */
+		GLuint buffer;
+		readValue(replay, &buffer, sizeof(buffer));
+		buffer = mapName(replay, NAME_BUFFER, buffer);
+		GLintptr offset;
+		readValue(replay, &offset, sizeof(offset));
+		GLsizeiptr length;
+		readValue(replay, &length, sizeof(length));
+		glad_glFlushMappedNamedBufferRange(buffer, offset, length);
+		break;
+	}
+	case 591: { /* glGetNamedBufferParameteriv */
+		GLuint buffer;
+		readValue(replay, &buffer, sizeof(buffer));
+		buffer = mapName(replay, NAME_BUFFER, buffer);
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint *params = (GLint *)readPointer(replay);
+		glad_glGetNamedBufferParameteriv(buffer, pname, params);
+		break;
+	}
+	case 592: { /* glGetNamedBufferParameteri64v */
+		GLuint buffer;
+		readValue(replay, &buffer, sizeof(buffer));
+		buffer = mapName(replay, NAME_BUFFER, buffer);
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint64 *params = (GLint64 *)readPointer(replay);
+		glad_glGetNamedBufferParameteri64v(buffer, pname, params);
+		break;
+	}
+	case 593: { /* glGetNamedBufferPointerv */
+		GLuint buffer;
+		readValue(replay, &buffer, sizeof(buffer));
+		buffer = mapName(replay, NAME_BUFFER, buffer);
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		void **params = (void **)readPointer(replay);
+		glad_glGetNamedBufferPointerv(buffer, pname, params);
+		break;
+	}
+	case 594: { /* glGetNamedBufferSubData */
+		GLuint buffer;
+		readValue(replay, &buffer, sizeof(buffer));
+		buffer = mapName(replay, NAME_BUFFER, buffer);
+		GLintptr offset;
+		readValue(replay, &offset, sizeof(offset));
+		GLsizeiptr size;
+		readValue(replay, &size, sizeof(size));
+		void *data = (void *)readPointer(replay);
+		glad_glGetNamedBufferSubData(buffer, offset, size, data);
+		break;
+	}
+	case 595: { /* glCreateFramebuffers */
+		GLsizei n;
+		readValue(replay, &n, sizeof(n));
+		GLuint *framebuffers = (GLuint *)readPointer(replay);
+		glad_glCreateFramebuffers(n, framebuffers);
+		recordNames(replay, NAME_FRAMEBUFFER);
+		break;
+	}
+	case 596: { /* glNamedFramebufferRenderbuffer */
+		GLuint framebuffer;
+		readValue(replay, &framebuffer, sizeof(framebuffer));
+		framebuffer = mapName(replay, NAME_FRAMEBUFFER, framebuffer);
+		GLenum attachment;
+		readValue(replay, &attachment, sizeof(attachment));
+		GLenum renderbuffertarget;
+		readValue(replay, &renderbuffertarget, sizeof(renderbuffertarget));
+		GLuint renderbuffer;
+		readValue(replay, &renderbuffer, sizeof(renderbuffer));
+		renderbuffer = mapName(replay, NAME_RENDERBUFFER, renderbuffer);
+		glad_glNamedFramebufferRenderbuffer(framebuffer, attachment, renderbuffertarget, renderbuffer);
+		break;
+	}
+	case 597: { /* glNamedFramebufferParameteri */
+		GLuint framebuffer;
+		readValue(replay, &framebuffer, sizeof(framebuffer));
+		framebuffer = mapName(replay, NAME_FRAMEBUFFER, framebuffer);
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint param;
+		readValue(replay, &param, sizeof(param));
+		glad_glNamedFramebufferParameteri(framebuffer, pname, param);
+		break;
+	}
+	case 598: { /* glNamedFramebufferTexture */
+		GLuint framebuffer;
+		readValue(replay, &framebuffer, sizeof(framebuffer));
+		framebuffer = mapName(replay, NAME_FRAMEBUFFER, framebuffer);
+		GLenum attachment;
+		readValue(replay, &attachment, sizeof(attachment));
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		GLint level;
+		readValue(replay, &level, sizeof(level));
+		glad_glNamedFramebufferTexture(framebuffer, attachment, texture, level);
+		break;
+	}
+	case 599: { /* glNamedFramebufferTextureLayer */
+		GLuint framebuffer;
+		readValue(replay, &framebuffer, sizeof(framebuffer));
+		framebuffer = mapName(replay, NAME_FRAMEBUFFER, framebuffer);
+		GLenum attachment;
+		readValue(replay, &attachment, sizeof(attachment));
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		GLint level;
+		readValue(replay, &level, sizeof(level));
+		GLint layer;
+		readValue(replay, &layer, sizeof(layer));
+		glad_glNamedFramebufferTextureLayer(framebuffer, attachment, texture, level, layer);
+		break;
+	}
+	case 600: { /* glNamedFramebufferDrawBuffer */
+		GLuint framebuffer;
+		readValue(replay, &framebuffer, sizeof(framebuffer));
+		framebuffer = mapName(replay, NAME_FRAMEBUFFER, framebuffer);
+		GLenum buf;
+		readValue(replay, &buf, sizeof(buf));
+		glad_glNamedFramebufferDrawBuffer(framebuffer, buf);
+		break;
+	}
+	case 601: { /* glNamedFramebufferDrawBuffers */
+		GLuint framebuffer;
+		readValue(replay, &framebuffer, sizeof(framebuffer));
+		framebuffer = mapName(replay, NAME_FRAMEBUFFER, framebuffer);
+		GLsizei n;
+		readValue(replay, &n, sizeof(n));
+		const GLenum *bufs = (const GLenum *)readPointer(replay);
+		glad_glNamedFramebufferDrawBuffers(framebuffer, n, bufs);
+		break;
+	}
+	case 602: { /* glNamedFramebufferReadBuffer */
+		GLuint framebuffer;
+		readValue(replay, &framebuffer, sizeof(framebuffer));
+		framebuffer = mapName(replay, NAME_FRAMEBUFFER, framebuffer);
+		GLenum src;
+		readValue(replay, &src, sizeof(src));
+		glad_glNamedFramebufferReadBuffer(framebuffer, src);
+		break;
+	}
+	case 603: { /* glInvalidateNamedFramebufferData */
+		GLuint framebuffer;
+		readValue(replay, &framebuffer, sizeof(framebuffer));
+		framebuffer = mapName(replay, NAME_FRAMEBUFFER, framebuffer);
+		GLsizei numAttachments;
+		readValue(replay, &numAttachments, sizeof(numAttachments));
+		const GLenum *attachments = (const GLenum *)readPointer(replay);
+		glad_glInvalidateNamedFramebufferData(framebuffer, numAttachments, attachments);
+		break;
+	}
+	case 604: { /* glInvalidateNamedFramebufferSubData */
+		GLuint framebuffer;
+		readValue(replay, &framebuffer, sizeof(framebuffer));
+		framebuffer = mapName(replay, NAME_FRAMEBUFFER, framebuffer);
+		GLsizei numAttachments;
+		readValue(replay, &numAttachments, sizeof(numAttachments));
+		const GLenum *attachments = (const GLenum *)readPointer(replay);
+		GLint x;
+		readValue(replay, &x, sizeof(x));
+		GLint y;
+		readValue(replay, &y, sizeof(y));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLsizei height;
+		readValue(replay, &height, sizeof(height));
+		glad_glInvalidateNamedFramebufferSubData(framebuffer, numAttachments, attachments, x, y, width, height);
+		break;
+	}
+	case 605: { /* glClearNamedFramebufferiv */
+		GLuint framebuffer;
+		readValue(replay, &framebuffer, sizeof(framebuffer));
+		framebuffer = mapName(replay, NAME_FRAMEBUFFER, framebuffer);
+		GLenum buffer;
+		readValue(replay, &buffer, sizeof(buffer));
+		GLint drawbuffer;
+		readValue(replay, &drawbuffer, sizeof(drawbuffer));
+		const GLint *value = (const GLint *)readPointer(replay);
+		glad_glClearNamedFramebufferiv(framebuffer, buffer, drawbuffer, value);
+		break;
+	}
+	case 606: { /* glClearNamedFramebufferuiv */
+		GLuint framebuffer;
+		readValue(replay, &framebuffer, sizeof(framebuffer));
+		framebuffer = mapName(replay, NAME_FRAMEBUFFER, framebuffer);
+		GLenum buffer;
+		readValue(replay, &buffer, sizeof(buffer));
+		GLint drawbuffer;
+		readValue(replay, &drawbuffer, sizeof(drawbuffer));
+		const GLuint *value = (const GLuint *)readPointer(replay);
+		glad_glClearNamedFramebufferuiv(framebuffer, buffer, drawbuffer, value);
+		break;
+	}
+	case 607: { /* glClearNamedFramebufferfv */
+		GLuint framebuffer;
+		readValue(replay, &framebuffer, sizeof(framebuffer));
+		framebuffer = mapName(replay, NAME_FRAMEBUFFER, framebuffer);
+		GLenum buffer;
+		readValue(replay, &buffer, sizeof(buffer));
+		GLint drawbuffer;
+		readValue(replay, &drawbuffer, sizeof(drawbuffer));
+		const GLfloat *value = (const GLfloat *)readPointer(replay);
+		glad_glClearNamedFramebufferfv(framebuffer, buffer, drawbuffer, value);
+		break;
+	}
+	case 608: { /* glClearNamedFramebufferfi */
+		GLuint framebuffer;
+		readValue(replay, &framebuffer, sizeof(framebuffer));
+		framebuffer = mapName(replay, NAME_FRAMEBUFFER, framebuffer);
+		GLenum buffer;
+		readValue(replay, &buffer, sizeof(buffer));
+		GLint drawbuffer;
+		readValue(replay, &drawbuffer, sizeof(drawbuffer));
+		GLfloat depth;
+		readValue(replay, &depth, sizeof(depth));
+		GLint stencil;
+		readValue(replay, &stencil, sizeof(stencil));
+		glad_glClearNamedFramebufferfi(framebuffer, buffer, drawbuffer, depth, stencil);
+		break;
+	}
+	case 609: { /* glBlitNamedFramebuffer */
+		GLuint readFramebuffer;
+		readValue(replay, &readFramebuffer, sizeof(readFramebuffer));
+		readFramebuffer = mapName(replay, NAME_FRAMEBUFFER, readFramebuffer);
+		GLuint drawFramebuffer;
+		readValue(replay, &drawFramebuffer, sizeof(drawFramebuffer));
+		drawFramebuffer = mapName(replay, NAME_FRAMEBUFFER, drawFramebuffer);
+		GLint srcX0;
+		readValue(replay, &srcX0, sizeof(srcX0));
+		GLint srcY0;
+		readValue(replay, &srcY0, sizeof(srcY0));
+		GLint srcX1;
+		readValue(replay, &srcX1, sizeof(srcX1));
+		GLint srcY1;
+		readValue(replay, &srcY1, sizeof(srcY1));
+		GLint dstX0;
+		readValue(replay, &dstX0, sizeof(dstX0));
+		GLint dstY0;
+		readValue(replay, &dstY0, sizeof(dstY0));
+		GLint dstX1;
+		readValue(replay, &dstX1, sizeof(dstX1));
+		GLint dstY1;
+		readValue(replay, &dstY1, sizeof(dstY1));
+		GLbitfield mask;
+		readValue(replay, &mask, sizeof(mask));
+		GLenum filter;
+		readValue(replay, &filter, sizeof(filter));
+		glad_glBlitNamedFramebuffer(readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+		break;
+	}
+	case 610: { /* glCheckNamedFramebufferStatus */
+		GLuint framebuffer;
+		readValue(replay, &framebuffer, sizeof(framebuffer));
+		framebuffer = mapName(replay, NAME_FRAMEBUFFER, framebuffer);
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLenum result = glad_glCheckNamedFramebufferStatus(framebuffer, target);
+
+		checkResult(replay, &result, sizeof(result));
+		break;
+	}
+	case 611: { /* glGetNamedFramebufferParameteriv */
+		GLuint framebuffer;
+		readValue(replay, &framebuffer, sizeof(framebuffer));
+		framebuffer = mapName(replay, NAME_FRAMEBUFFER, framebuffer);
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint *param = (GLint *)readPointer(replay);
+		glad_glGetNamedFramebufferParameteriv(framebuffer, pname, param);
+		break;
+	}
+	case 612: { /* glGetNamedFramebufferAttachmentParameteriv */
+		GLuint framebuffer;
+		readValue(replay, &framebuffer, sizeof(framebuffer));
+		framebuffer = mapName(replay, NAME_FRAMEBUFFER, framebuffer);
+		GLenum attachment;
+		readValue(replay, &attachment, sizeof(attachment));
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint *params = (GLint *)readPointer(replay);
+		glad_glGetNamedFramebufferAttachmentParameteriv(framebuffer, attachment, pname, params);
+		break;
+	}
+	case 613: { /* glCreateRenderbuffers */
+		GLsizei n;
+		readValue(replay, &n, sizeof(n));
+		GLuint *renderbuffers = (GLuint *)readPointer(replay);
+		glad_glCreateRenderbuffers(n, renderbuffers);
+		recordNames(replay, NAME_RENDERBUFFER);
+		break;
+	}
+	case 614: { /* glNamedRenderbufferStorage */
+		GLuint renderbuffer;
+		readValue(replay, &renderbuffer, sizeof(renderbuffer));
+		renderbuffer = mapName(replay, NAME_RENDERBUFFER, renderbuffer);
+		GLenum internalformat;
+		readValue(replay, &internalformat, sizeof(internalformat));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLsizei height;
+		readValue(replay, &height, sizeof(height));
+		glad_glNamedRenderbufferStorage(renderbuffer, internalformat, width, height);
+		break;
+	}
+	case 615: { /* glNamedRenderbufferStorageMultisample */
+		GLuint renderbuffer;
+		readValue(replay, &renderbuffer, sizeof(renderbuffer));
+		renderbuffer = mapName(replay, NAME_RENDERBUFFER, renderbuffer);
+		GLsizei samples;
+		readValue(replay, &samples, sizeof(samples));
+		GLenum internalformat;
+		readValue(replay, &internalformat, sizeof(internalformat));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLsizei height;
+		readValue(replay, &height, sizeof(height));
+		glad_glNamedRenderbufferStorageMultisample(renderbuffer, samples, internalformat, width, height);
+		break;
+	}
+	case 616: { /* glGetNamedRenderbufferParameteriv */
+		GLuint renderbuffer;
+		readValue(replay, &renderbuffer, sizeof(renderbuffer));
+		renderbuffer = mapName(replay, NAME_RENDERBUFFER, renderbuffer);
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint *params = (GLint *)readPointer(replay);
+		glad_glGetNamedRenderbufferParameteriv(renderbuffer, pname, params);
+		break;
+	}
+	case 617: { /* glCreateTextures */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLsizei n;
+		readValue(replay, &n, sizeof(n));
+		GLuint *textures = (GLuint *)readPointer(replay);
+		glad_glCreateTextures(target, n, textures);
+		recordNames(replay, NAME_TEXTURE);
+		break;
+	}
+	case 618: { /* glTextureBuffer */
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		GLenum internalformat;
+		readValue(replay, &internalformat, sizeof(internalformat));
+		GLuint buffer;
+		readValue(replay, &buffer, sizeof(buffer));
+		buffer = mapName(replay, NAME_BUFFER, buffer);
+		glad_glTextureBuffer(texture, internalformat, buffer);
+		break;
+	}
+	case 619: { /* glTextureBufferRange */
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		GLenum internalformat;
+		readValue(replay, &internalformat, sizeof(internalformat));
+		GLuint buffer;
+		readValue(replay, &buffer, sizeof(buffer));
+		buffer = mapName(replay, NAME_BUFFER, buffer);
+		GLintptr offset;
+		readValue(replay, &offset, sizeof(offset));
+		GLsizeiptr size;
+		readValue(replay, &size, sizeof(size));
+		glad_glTextureBufferRange(texture, internalformat, buffer, offset, size);
+		break;
+	}
+	case 620: { /* glTextureStorage1D */
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		GLsizei levels;
+		readValue(replay, &levels, sizeof(levels));
+		GLenum internalformat;
+		readValue(replay, &internalformat, sizeof(internalformat));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		glad_glTextureStorage1D(texture, levels, internalformat, width);
+		break;
+	}
+	case 621: { /* glTextureStorage2D */
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		GLsizei levels;
+		readValue(replay, &levels, sizeof(levels));
+		GLenum internalformat;
+		readValue(replay, &internalformat, sizeof(internalformat));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLsizei height;
+		readValue(replay, &height, sizeof(height));
+		glad_glTextureStorage2D(texture, levels, internalformat, width, height);
+		break;
+	}
+	case 622: { /* glTextureStorage3D */
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		GLsizei levels;
+		readValue(replay, &levels, sizeof(levels));
+		GLenum internalformat;
+		readValue(replay, &internalformat, sizeof(internalformat));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLsizei height;
+		readValue(replay, &height, sizeof(height));
+		GLsizei depth;
+		readValue(replay, &depth, sizeof(depth));
+		glad_glTextureStorage3D(texture, levels, internalformat, width, height, depth);
+		break;
+	}
+	case 623: { /* glTextureStorage2DMultisample */
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		GLsizei samples;
+		readValue(replay, &samples, sizeof(samples));
+		GLenum internalformat;
+		readValue(replay, &internalformat, sizeof(internalformat));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLsizei height;
+		readValue(replay, &height, sizeof(height));
+		GLboolean fixedsamplelocations;
+		readValue(replay, &fixedsamplelocations, sizeof(fixedsamplelocations));
+		glad_glTextureStorage2DMultisample(texture, samples, internalformat, width, height, fixedsamplelocations);
+		break;
+	}
+	case 624: { /* glTextureStorage3DMultisample */
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		GLsizei samples;
+		readValue(replay, &samples, sizeof(samples));
+		GLenum internalformat;
+		readValue(replay, &internalformat, sizeof(internalformat));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLsizei height;
+		readValue(replay, &height, sizeof(height));
+		GLsizei depth;
+		readValue(replay, &depth, sizeof(depth));
+		GLboolean fixedsamplelocations;
+		readValue(replay, &fixedsamplelocations, sizeof(fixedsamplelocations));
+		glad_glTextureStorage3DMultisample(texture, samples, internalformat, width, height, depth, fixedsamplelocations);
+		break;
+	}
+	case 625: { /* glTextureSubImage1D */
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		GLint level;
+		readValue(replay, &level, sizeof(level));
+		GLint xoffset;
+		readValue(replay, &xoffset, sizeof(xoffset));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLenum format;
+		readValue(replay, &format, sizeof(format));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		const void *pixels = (const void *)readPointer(replay);
+		glad_glTextureSubImage1D(texture, level, xoffset, width, format, type, pixels);
+		break;
+	}
+	case 626: { /* glTextureSubImage2D */
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		GLint level;
+		readValue(replay, &level, sizeof(level));
+		GLint xoffset;
+		readValue(replay, &xoffset, sizeof(xoffset));
+		GLint yoffset;
+		readValue(replay, &yoffset, sizeof(yoffset));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLsizei height;
+		readValue(replay, &height, sizeof(height));
+		GLenum format;
+		readValue(replay, &format, sizeof(format));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		const void *pixels = (const void *)readPointer(replay);
+		glad_glTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, type, pixels);
+		break;
+	}
+	case 627: { /* glTextureSubImage3D */
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		GLint level;
+		readValue(replay, &level, sizeof(level));
+		GLint xoffset;
+		readValue(replay, &xoffset, sizeof(xoffset));
+		GLint yoffset;
+		readValue(replay, &yoffset, sizeof(yoffset));
+		GLint zoffset;
+		readValue(replay, &zoffset, sizeof(zoffset));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLsizei height;
+		readValue(replay, &height, sizeof(height));
+		GLsizei depth;
+		readValue(replay, &depth, sizeof(depth));
+		GLenum format;
+		readValue(replay, &format, sizeof(format));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		const void *pixels = (const void *)readPointer(replay);
+		glad_glTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+		break;
+	}
+	case 628: { /* glCompressedTextureSubImage1D */
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		GLint level;
+		readValue(replay, &level, sizeof(level));
+		GLint xoffset;
+		readValue(replay, &xoffset, sizeof(xoffset));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLenum format;
+		readValue(replay, &format, sizeof(format));
+		GLsizei imageSize;
+		readValue(replay, &imageSize, sizeof(imageSize));
+		const void *data = (const void *)readPointer(replay);
+		glad_glCompressedTextureSubImage1D(texture, level, xoffset, width, format, imageSize, data);
+		break;
+	}
+	case 629: { /* glCompressedTextureSubImage2D */
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		GLint level;
+		readValue(replay, &level, sizeof(level));
+		GLint xoffset;
+		readValue(replay, &xoffset, sizeof(xoffset));
+		GLint yoffset;
+		readValue(replay, &yoffset, sizeof(yoffset));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLsizei height;
+		readValue(replay, &height, sizeof(height));
+		GLenum format;
+		readValue(replay, &format, sizeof(format));
+		GLsizei imageSize;
+		readValue(replay, &imageSize, sizeof(imageSize));
+		const void *data = (const void *)readPointer(replay);
+		glad_glCompressedTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, imageSize, data);
+		break;
+	}
+	case 630: { /* glCompressedTextureSubImage3D */
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		GLint level;
+		readValue(replay, &level, sizeof(level));
+		GLint xoffset;
+		readValue(replay, &xoffset, sizeof(xoffset));
+		GLint yoffset;
+		readValue(replay, &yoffset, sizeof(yoffset));
+		GLint zoffset;
+		readValue(replay, &zoffset, sizeof(zoffset));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLsizei height;
+		readValue(replay, &height, sizeof(height));
+		GLsizei depth;
+		readValue(replay, &depth, sizeof(depth));
+		GLenum format;
+		readValue(replay, &format, sizeof(format));
+		GLsizei imageSize;
+		readValue(replay, &imageSize, sizeof(imageSize));
+		const void *data = (const void *)readPointer(replay);
+		glad_glCompressedTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+		break;
+	}
+	case 631: { /* glCopyTextureSubImage1D */
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		GLint level;
+		readValue(replay, &level, sizeof(level));
+		GLint xoffset;
+		readValue(replay, &xoffset, sizeof(xoffset));
+		GLint x;
+		readValue(replay, &x, sizeof(x));
+		GLint y;
+		readValue(replay, &y, sizeof(y));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		glad_glCopyTextureSubImage1D(texture, level, xoffset, x, y, width);
+		break;
+	}
+	case 632: { /* glCopyTextureSubImage2D */
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		GLint level;
+		readValue(replay, &level, sizeof(level));
+		GLint xoffset;
+		readValue(replay, &xoffset, sizeof(xoffset));
+		GLint yoffset;
+		readValue(replay, &yoffset, sizeof(yoffset));
+		GLint x;
+		readValue(replay, &x, sizeof(x));
+		GLint y;
+		readValue(replay, &y, sizeof(y));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLsizei height;
+		readValue(replay, &height, sizeof(height));
+		glad_glCopyTextureSubImage2D(texture, level, xoffset, yoffset, x, y, width, height);
+		break;
+	}
+	case 633: { /* glCopyTextureSubImage3D */
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		GLint level;
+		readValue(replay, &level, sizeof(level));
+		GLint xoffset;
+		readValue(replay, &xoffset, sizeof(xoffset));
+		GLint yoffset;
+		readValue(replay, &yoffset, sizeof(yoffset));
+		GLint zoffset;
+		readValue(replay, &zoffset, sizeof(zoffset));
+		GLint x;
+		readValue(replay, &x, sizeof(x));
+		GLint y;
+		readValue(replay, &y, sizeof(y));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLsizei height;
+		readValue(replay, &height, sizeof(height));
+		glad_glCopyTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, x, y, width, height);
+		break;
+	}
+	case 634: { /* glTextureParameterf */
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLfloat param;
+		readValue(replay, &param, sizeof(param));
+		glad_glTextureParameterf(texture, pname, param);
+		break;
+	}
+	case 635: { /* glTextureParameterfv */
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		const GLfloat *param = (const GLfloat *)readPointer(replay);
+		glad_glTextureParameterfv(texture, pname, param);
+		break;
+	}
+	case 636: { /* glTextureParameteri */
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint param;
+		readValue(replay, &param, sizeof(param));
+		glad_glTextureParameteri(texture, pname, param);
+		break;
+	}
+	case 637: { /* glTextureParameterIiv */
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		const GLint *params = (const GLint *)readPointer(replay);
+		glad_glTextureParameterIiv(texture, pname, params);
+		break;
+	}
+	case 638: { /* glTextureParameterIuiv */
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		const GLuint *params = (const GLuint *)readPointer(replay);
+		glad_glTextureParameterIuiv(texture, pname, params);
+		break;
+	}
+	case 639: { /* glTextureParameteriv */
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		const GLint *param = (const GLint *)readPointer(replay);
+		glad_glTextureParameteriv(texture, pname, param);
+		break;
+	}
+	case 640: { /* glGenerateTextureMipmap */
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		glad_glGenerateTextureMipmap(texture);
+		break;
+	}
+	case 641: { /* glBindTextureUnit */
+		GLuint unit;
+		readValue(replay, &unit, sizeof(unit));
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		glad_glBindTextureUnit(unit, texture);
+		break;
+	}
+	case 642: { /* glGetTextureImage */
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		GLint level;
+		readValue(replay, &level, sizeof(level));
+		GLenum format;
+		readValue(replay, &format, sizeof(format));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		GLsizei bufSize;
+		readValue(replay, &bufSize, sizeof(bufSize));
+		void *pixels = (void *)readPointer(replay);
+		glad_glGetTextureImage(texture, level, format, type, bufSize, pixels);
+		break;
+	}
+	case 643: { /* glGetCompressedTextureImage */
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		GLint level;
+		readValue(replay, &level, sizeof(level));
+		GLsizei bufSize;
+		readValue(replay, &bufSize, sizeof(bufSize));
+		void *pixels = (void *)readPointer(replay);
+		glad_glGetCompressedTextureImage(texture, level, bufSize, pixels);
+		break;
+	}
+	case 644: { /* glGetTextureLevelParameterfv */
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		GLint level;
+		readValue(replay, &level, sizeof(level));
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLfloat *params = (GLfloat *)readPointer(replay);
+		glad_glGetTextureLevelParameterfv(texture, level, pname, params);
+		break;
+	}
+	case 645: { /* glGetTextureLevelParameteriv */
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		GLint level;
+		readValue(replay, &level, sizeof(level));
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint *params = (GLint *)readPointer(replay);
+		glad_glGetTextureLevelParameteriv(texture, level, pname, params);
+		break;
+	}
+	case 646: { /* glGetTextureParameterfv */
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLfloat *params = (GLfloat *)readPointer(replay);
+		glad_glGetTextureParameterfv(texture, pname, params);
+		break;
+	}
+	case 647: { /* glGetTextureParameterIiv */
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint *params = (GLint *)readPointer(replay);
+		glad_glGetTextureParameterIiv(texture, pname, params);
+		break;
+	}
+	case 648: { /* glGetTextureParameterIuiv */
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLuint *params = (GLuint *)readPointer(replay);
+		glad_glGetTextureParameterIuiv(texture, pname, params);
+		break;
+	}
+	case 649: { /* glGetTextureParameteriv */
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint *params = (GLint *)readPointer(replay);
+		glad_glGetTextureParameteriv(texture, pname, params);
+		break;
+	}
+	case 650: { /* glCreateVertexArrays */
+		GLsizei n;
+		readValue(replay, &n, sizeof(n));
+		GLuint *arrays = (GLuint *)readPointer(replay);
+		glad_glCreateVertexArrays(n, arrays);
+		recordNames(replay, NAME_VERTEX_ARRAY);
+		break;
+	}
+	case 651: { /* glDisableVertexArrayAttrib */
+		GLuint vaobj;
+		readValue(replay, &vaobj, sizeof(vaobj));
+		vaobj = mapName(replay, NAME_VERTEX_ARRAY, vaobj);
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		glad_glDisableVertexArrayAttrib(vaobj, index);
+		break;
+	}
+	case 652: { /* glEnableVertexArrayAttrib */
+		GLuint vaobj;
+		readValue(replay, &vaobj, sizeof(vaobj));
+		vaobj = mapName(replay, NAME_VERTEX_ARRAY, vaobj);
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		glad_glEnableVertexArrayAttrib(vaobj, index);
+		break;
+	}
+	case 653: { /* glVertexArrayElementBuffer */
+		GLuint vaobj;
+		readValue(replay, &vaobj, sizeof(vaobj));
+		vaobj = mapName(replay, NAME_VERTEX_ARRAY, vaobj);
+		GLuint buffer;
+		readValue(replay, &buffer, sizeof(buffer));
+		buffer = mapName(replay, NAME_BUFFER, buffer);
+		glad_glVertexArrayElementBuffer(vaobj, buffer);
+		break;
+	}
+	case 654: { /* glVertexArrayVertexBuffer */
+		GLuint vaobj;
+		readValue(replay, &vaobj, sizeof(vaobj));
+		vaobj = mapName(replay, NAME_VERTEX_ARRAY, vaobj);
+		GLuint bindingindex;
+		readValue(replay, &bindingindex, sizeof(bindingindex));
+		GLuint buffer;
+		readValue(replay, &buffer, sizeof(buffer));
+		buffer = mapName(replay, NAME_BUFFER, buffer);
+		GLintptr offset;
+		readValue(replay, &offset, sizeof(offset));
+		GLsizei stride;
+		readValue(replay, &stride, sizeof(stride));
+		glad_glVertexArrayVertexBuffer(vaobj, bindingindex, buffer, offset, stride);
+		break;
+	}
+	case 655: { /* glVertexArrayVertexBuffers */
+		GLuint vaobj;
+		readValue(replay, &vaobj, sizeof(vaobj));
+		vaobj = mapName(replay, NAME_VERTEX_ARRAY, vaobj);
+		GLuint first;
+		readValue(replay, &first, sizeof(first));
+		GLsizei count;
+		readValue(replay, &count, sizeof(count));
+		const GLuint *buffers = (const GLuint *)readPointer(replay);
+		buffers = mapNames(replay, NAME_BUFFER, buffers, count);
+		const GLintptr *offsets = (const GLintptr *)readPointer(replay);
+		const GLsizei *strides = (const GLsizei *)readPointer(replay);
+		glad_glVertexArrayVertexBuffers(vaobj, first, count, buffers, offsets, strides);
+		break;
+	}
+	case 656: { /* glVertexArrayAttribBinding */
+		GLuint vaobj;
+		readValue(replay, &vaobj, sizeof(vaobj));
+		vaobj = mapName(replay, NAME_VERTEX_ARRAY, vaobj);
+		GLuint attribindex;
+		readValue(replay, &attribindex, sizeof(attribindex));
+		GLuint bindingindex;
+		readValue(replay, &bindingindex, sizeof(bindingindex));
+		glad_glVertexArrayAttribBinding(vaobj, attribindex, bindingindex);
+		break;
+	}
+	case 657: { /* glVertexArrayAttribFormat */
+		GLuint vaobj;
+		readValue(replay, &vaobj, sizeof(vaobj));
+		vaobj = mapName(replay, NAME_VERTEX_ARRAY, vaobj);
+		GLuint attribindex;
+		readValue(replay, &attribindex, sizeof(attribindex));
+		GLint size;
+		readValue(replay, &size, sizeof(size));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		GLboolean normalized;
+		readValue(replay, &normalized, sizeof(normalized));
+		GLuint relativeoffset;
+		readValue(replay, &relativeoffset, sizeof(relativeoffset));
+		glad_glVertexArrayAttribFormat(vaobj, attribindex, size, type, normalized, relativeoffset);
+		break;
+	}
+	case 658: { /* glVertexArrayAttribIFormat */
+		GLuint vaobj;
+		readValue(replay, &vaobj, sizeof(vaobj));
+		vaobj = mapName(replay, NAME_VERTEX_ARRAY, vaobj);
+		GLuint attribindex;
+		readValue(replay, &attribindex, sizeof(attribindex));
+		GLint size;
+		readValue(replay, &size, sizeof(size));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		GLuint relativeoffset;
+		readValue(replay, &relativeoffset, sizeof(relativeoffset));
+		glad_glVertexArrayAttribIFormat(vaobj, attribindex, size, type, relativeoffset);
+		break;
+	}
+	case 659: { /* glVertexArrayAttribLFormat */
+		GLuint vaobj;
+		readValue(replay, &vaobj, sizeof(vaobj));
+		vaobj = mapName(replay, NAME_VERTEX_ARRAY, vaobj);
+		GLuint attribindex;
+		readValue(replay, &attribindex, sizeof(attribindex));
+		GLint size;
+		readValue(replay, &size, sizeof(size));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		GLuint relativeoffset;
+		readValue(replay, &relativeoffset, sizeof(relativeoffset));
+		glad_glVertexArrayAttribLFormat(vaobj, attribindex, size, type, relativeoffset);
+		break;
+	}
+	case 660: { /* glVertexArrayBindingDivisor */
+		GLuint vaobj;
+		readValue(replay, &vaobj, sizeof(vaobj));
+		vaobj = mapName(replay, NAME_VERTEX_ARRAY, vaobj);
+		GLuint bindingindex;
+		readValue(replay, &bindingindex, sizeof(bindingindex));
+		GLuint divisor;
+		readValue(replay, &divisor, sizeof(divisor));
+		glad_glVertexArrayBindingDivisor(vaobj, bindingindex, divisor);
+		break;
+	}
+	case 661: { /* glGetVertexArrayiv */
+		GLuint vaobj;
+		readValue(replay, &vaobj, sizeof(vaobj));
+		vaobj = mapName(replay, NAME_VERTEX_ARRAY, vaobj);
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint *param = (GLint *)readPointer(replay);
+		glad_glGetVertexArrayiv(vaobj, pname, param);
+		break;
+	}
+	case 662: { /* glGetVertexArrayIndexediv */
+		GLuint vaobj;
+		readValue(replay, &vaobj, sizeof(vaobj));
+		vaobj = mapName(replay, NAME_VERTEX_ARRAY, vaobj);
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint *param = (GLint *)readPointer(replay);
+		glad_glGetVertexArrayIndexediv(vaobj, index, pname, param);
+		break;
+	}
+	case 663: { /* glGetVertexArrayIndexed64iv */
+		GLuint vaobj;
+		readValue(replay, &vaobj, sizeof(vaobj));
+		vaobj = mapName(replay, NAME_VERTEX_ARRAY, vaobj);
+		GLuint index;
+		readValue(replay, &index, sizeof(index));
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLint64 *param = (GLint64 *)readPointer(replay);
+		glad_glGetVertexArrayIndexed64iv(vaobj, index, pname, param);
+		break;
+	}
+	case 664: { /* glCreateSamplers */
+		GLsizei n;
+		readValue(replay, &n, sizeof(n));
+		GLuint *samplers = (GLuint *)readPointer(replay);
+		glad_glCreateSamplers(n, samplers);
+		recordNames(replay, NAME_SAMPLER);
+		break;
+	}
+	case 665: { /* glCreateProgramPipelines */
+		GLsizei n;
+		readValue(replay, &n, sizeof(n));
+		GLuint *pipelines = (GLuint *)readPointer(replay);
+		glad_glCreateProgramPipelines(n, pipelines);
+		recordNames(replay, NAME_PIPELINE);
+		break;
+	}
+	case 666: { /* glCreateQueries */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLsizei n;
+		readValue(replay, &n, sizeof(n));
+		GLuint *ids = (GLuint *)readPointer(replay);
+		glad_glCreateQueries(target, n, ids);
+		recordNames(replay, NAME_QUERY);
+		break;
+	}
+	case 667: { /* glGetQueryBufferObjecti64v */
+		GLuint id;
+		readValue(replay, &id, sizeof(id));
+		id = mapName(replay, NAME_QUERY, id);
+		GLuint buffer;
+		readValue(replay, &buffer, sizeof(buffer));
+		buffer = mapName(replay, NAME_BUFFER, buffer);
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLintptr offset;
+		readValue(replay, &offset, sizeof(offset));
+		glad_glGetQueryBufferObjecti64v(id, buffer, pname, offset);
+		break;
+	}
+	case 668: { /* glGetQueryBufferObjectiv */
+		GLuint id;
+		readValue(replay, &id, sizeof(id));
+		id = mapName(replay, NAME_QUERY, id);
+		GLuint buffer;
+		readValue(replay, &buffer, sizeof(buffer));
+		buffer = mapName(replay, NAME_BUFFER, buffer);
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLintptr offset;
+		readValue(replay, &offset, sizeof(offset));
+		glad_glGetQueryBufferObjectiv(id, buffer, pname, offset);
+		break;
+	}
+	case 669: { /* glGetQueryBufferObjectui64v */
+		GLuint id;
+		readValue(replay, &id, sizeof(id));
+		id = mapName(replay, NAME_QUERY, id);
+		GLuint buffer;
+		readValue(replay, &buffer, sizeof(buffer));
+		buffer = mapName(replay, NAME_BUFFER, buffer);
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLintptr offset;
+		readValue(replay, &offset, sizeof(offset));
+		glad_glGetQueryBufferObjectui64v(id, buffer, pname, offset);
+		break;
+	}
+	case 670: { /* glGetQueryBufferObjectuiv */
+		GLuint id;
+		readValue(replay, &id, sizeof(id));
+		id = mapName(replay, NAME_QUERY, id);
+		GLuint buffer;
+		readValue(replay, &buffer, sizeof(buffer));
+		buffer = mapName(replay, NAME_BUFFER, buffer);
+		GLenum pname;
+		readValue(replay, &pname, sizeof(pname));
+		GLintptr offset;
+		readValue(replay, &offset, sizeof(offset));
+		glad_glGetQueryBufferObjectuiv(id, buffer, pname, offset);
+		break;
+	}
+	case 671: { /* glMemoryBarrierByRegion */
+		GLbitfield barriers;
+		readValue(replay, &barriers, sizeof(barriers));
+		glad_glMemoryBarrierByRegion(barriers);
+		break;
+	}
+	case 672: { /* glGetTextureSubImage */
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		GLint level;
+		readValue(replay, &level, sizeof(level));
+		GLint xoffset;
+		readValue(replay, &xoffset, sizeof(xoffset));
+		GLint yoffset;
+		readValue(replay, &yoffset, sizeof(yoffset));
+		GLint zoffset;
+		readValue(replay, &zoffset, sizeof(zoffset));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLsizei height;
+		readValue(replay, &height, sizeof(height));
+		GLsizei depth;
+		readValue(replay, &depth, sizeof(depth));
+		GLenum format;
+		readValue(replay, &format, sizeof(format));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		GLsizei bufSize;
+		readValue(replay, &bufSize, sizeof(bufSize));
+		void *pixels = (void *)readPointer(replay);
+		glad_glGetTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels);
+		break;
+	}
+	case 673: { /* glGetCompressedTextureSubImage */
+		GLuint texture;
+		readValue(replay, &texture, sizeof(texture));
+		texture = mapName(replay, NAME_TEXTURE, texture);
+		GLint level;
+		readValue(replay, &level, sizeof(level));
+		GLint xoffset;
+		readValue(replay, &xoffset, sizeof(xoffset));
+		GLint yoffset;
+		readValue(replay, &yoffset, sizeof(yoffset));
+		GLint zoffset;
+		readValue(replay, &zoffset, sizeof(zoffset));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLsizei height;
+		readValue(replay, &height, sizeof(height));
+		GLsizei depth;
+		readValue(replay, &depth, sizeof(depth));
+		GLsizei bufSize;
+		readValue(replay, &bufSize, sizeof(bufSize));
+		void *pixels = (void *)readPointer(replay);
+		glad_glGetCompressedTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels);
+		break;
+	}
+	case 674: { /* glGetGraphicsResetStatus */
+		GLenum result = glad_glGetGraphicsResetStatus();
+
+		checkResult(replay, &result, sizeof(result));
+		break;
+	}
+	case 675: { /* glGetnCompressedTexImage */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLint lod;
+		readValue(replay, &lod, sizeof(lod));
+		GLsizei bufSize;
+		readValue(replay, &bufSize, sizeof(bufSize));
+		void *pixels = (void *)readPointer(replay);
+		glad_glGetnCompressedTexImage(target, lod, bufSize, pixels);
+		break;
+	}
+	case 676: { /* glGetnTexImage */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLint level;
+		readValue(replay, &level, sizeof(level));
+		GLenum format;
+		readValue(replay, &format, sizeof(format));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		GLsizei bufSize;
+		readValue(replay, &bufSize, sizeof(bufSize));
+		void *pixels = (void *)readPointer(replay);
+		glad_glGetnTexImage(target, level, format, type, bufSize, pixels);
+		break;
+	}
+	case 677: { /* glGetnUniformdv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei bufSize;
+		readValue(replay, &bufSize, sizeof(bufSize));
+		GLdouble *params = (GLdouble *)readPointer(replay);
+		glad_glGetnUniformdv(program, location, bufSize, params);
+		break;
+	}
+	case 678: { /* glGetnUniformfv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei bufSize;
+		readValue(replay, &bufSize, sizeof(bufSize));
+		GLfloat *params = (GLfloat *)readPointer(replay);
+		glad_glGetnUniformfv(program, location, bufSize, params);
+		break;
+	}
+	case 679: { /* glGetnUniformiv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei bufSize;
+		readValue(replay, &bufSize, sizeof(bufSize));
+		GLint *params = (GLint *)readPointer(replay);
+		glad_glGetnUniformiv(program, location, bufSize, params);
+		break;
+	}
+	case 680: { /* glGetnUniformuiv */
+		GLuint program;
+		readValue(replay, &program, sizeof(program));
+		program = mapName(replay, NAME_PROGRAM, program);
+		GLint location;
+		readValue(replay, &location, sizeof(location));
+		GLsizei bufSize;
+		readValue(replay, &bufSize, sizeof(bufSize));
+		GLuint *params = (GLuint *)readPointer(replay);
+		glad_glGetnUniformuiv(program, location, bufSize, params);
+		break;
+	}
+	case 681: { /* glReadnPixels */
+		GLint x;
+		readValue(replay, &x, sizeof(x));
+		GLint y;
+		readValue(replay, &y, sizeof(y));
+		GLsizei width;
+		readValue(replay, &width, sizeof(width));
+		GLsizei height;
+		readValue(replay, &height, sizeof(height));
+		GLenum format;
+		readValue(replay, &format, sizeof(format));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		GLsizei bufSize;
+		readValue(replay, &bufSize, sizeof(bufSize));
+		void *data = (void *)readPointer(replay);
+		glad_glReadnPixels(x, y, width, height, format, type, bufSize, data);
+		break;
+	}
+	case 682: { /* glGetnMapdv */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLenum query;
+		readValue(replay, &query, sizeof(query));
+		GLsizei bufSize;
+		readValue(replay, &bufSize, sizeof(bufSize));
+		GLdouble *v = (GLdouble *)readPointer(replay);
+		glad_glGetnMapdv(target, query, bufSize, v);
+		break;
+	}
+	case 683: { /* glGetnMapfv */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLenum query;
+		readValue(replay, &query, sizeof(query));
+		GLsizei bufSize;
+		readValue(replay, &bufSize, sizeof(bufSize));
+		GLfloat *v = (GLfloat *)readPointer(replay);
+		glad_glGetnMapfv(target, query, bufSize, v);
+		break;
+	}
+	case 684: { /* glGetnMapiv */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLenum query;
+		readValue(replay, &query, sizeof(query));
+		GLsizei bufSize;
+		readValue(replay, &bufSize, sizeof(bufSize));
+		GLint *v = (GLint *)readPointer(replay);
+		glad_glGetnMapiv(target, query, bufSize, v);
+		break;
+	}
+	case 685: { /* glGetnPixelMapfv */
+		GLenum map;
+		readValue(replay, &map, sizeof(map));
+		GLsizei bufSize;
+		readValue(replay, &bufSize, sizeof(bufSize));
+		GLfloat *values = (GLfloat *)readPointer(replay);
+		glad_glGetnPixelMapfv(map, bufSize, values);
+		break;
+	}
+	case 686: { /* glGetnPixelMapuiv */
+		GLenum map;
+		readValue(replay, &map, sizeof(map));
+		GLsizei bufSize;
+		readValue(replay, &bufSize, sizeof(bufSize));
+		GLuint *values = (GLuint *)readPointer(replay);
+		glad_glGetnPixelMapuiv(map, bufSize, values);
+		break;
+	}
+	case 687: { /* glGetnPixelMapusv */
+		GLenum map;
+		readValue(replay, &map, sizeof(map));
+		GLsizei bufSize;
+		readValue(replay, &bufSize, sizeof(bufSize));
+		GLushort *values = (GLushort *)readPointer(replay);
+		glad_glGetnPixelMapusv(map, bufSize, values);
+		break;
+	}
+	case 688: { /* glGetnPolygonStipple */
+		GLsizei bufSize;
+		readValue(replay, &bufSize, sizeof(bufSize));
+		GLubyte *pattern = (GLubyte *)readPointer(replay);
+		glad_glGetnPolygonStipple(bufSize, pattern);
+		break;
+	}
+	case 689: { /* glGetnColorTable */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLenum format;
+		readValue(replay, &format, sizeof(format));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		GLsizei bufSize;
+		readValue(replay, &bufSize, sizeof(bufSize));
+		void *table = (void *)readPointer(replay);
+		glad_glGetnColorTable(target, format, type, bufSize, table);
+		break;
+	}
+	case 690: { /* glGetnConvolutionFilter */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLenum format;
+		readValue(replay, &format, sizeof(format));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		GLsizei bufSize;
+		readValue(replay, &bufSize, sizeof(bufSize));
+		void *image = (void *)readPointer(replay);
+		glad_glGetnConvolutionFilter(target, format, type, bufSize, image);
+		break;
+	}
+	case 691: { /* glGetnSeparableFilter */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLenum format;
+		readValue(replay, &format, sizeof(format));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		GLsizei rowBufSize;
+		readValue(replay, &rowBufSize, sizeof(rowBufSize));
+		void *row = (void *)readPointer(replay);
+		GLsizei columnBufSize;
+		readValue(replay, &columnBufSize, sizeof(columnBufSize));
+		void *column = (void *)readPointer(replay);
+		void *span = (void *)readPointer(replay);
+		glad_glGetnSeparableFilter(target, format, type, rowBufSize, row, columnBufSize, column, span);
+		break;
+	}
+	case 692: { /* glGetnHistogram */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLboolean reset;
+		readValue(replay, &reset, sizeof(reset));
+		GLenum format;
+		readValue(replay, &format, sizeof(format));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		GLsizei bufSize;
+		readValue(replay, &bufSize, sizeof(bufSize));
+		void *values = (void *)readPointer(replay);
+		glad_glGetnHistogram(target, reset, format, type, bufSize, values);
+		break;
+	}
+	case 693: { /* glGetnMinmax */
+		GLenum target;
+		readValue(replay, &target, sizeof(target));
+		GLboolean reset;
+		readValue(replay, &reset, sizeof(reset));
+		GLenum format;
+		readValue(replay, &format, sizeof(format));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		GLsizei bufSize;
+		readValue(replay, &bufSize, sizeof(bufSize));
+		void *values = (void *)readPointer(replay);
+		glad_glGetnMinmax(target, reset, format, type, bufSize, values);
+		break;
+	}
+	case 694: { /* glTextureBarrier */
+		glad_glTextureBarrier();
+		break;
+	}
+	case 695: { /* glSpecializeShader */
+		GLuint shader;
+		readValue(replay, &shader, sizeof(shader));
+		shader = mapName(replay, NAME_PROGRAM, shader);
+		const GLchar *pEntryPoint = (const GLchar *)readPointer(replay);
+		GLuint numSpecializationConstants;
+		readValue(replay, &numSpecializationConstants, sizeof(numSpecializationConstants));
+		const GLuint *pConstantIndex = (const GLuint *)readPointer(replay);
+		const GLuint *pConstantValue = (const GLuint *)readPointer(replay);
+		glad_glSpecializeShader(shader, pEntryPoint, numSpecializationConstants, pConstantIndex, pConstantValue);
+		break;
+	}
+	case 696: { /* glMultiDrawArraysIndirectCount */
+		GLenum mode;
+		readValue(replay, &mode, sizeof(mode));
+		const void *indirect = (const void *)readPointer(replay);
+		GLintptr drawcount;
+		readValue(replay, &drawcount, sizeof(drawcount));
+		GLsizei maxdrawcount;
+		readValue(replay, &maxdrawcount, sizeof(maxdrawcount));
+		GLsizei stride;
+		readValue(replay, &stride, sizeof(stride));
+		glad_glMultiDrawArraysIndirectCount(mode, indirect, drawcount, maxdrawcount, stride);
+		break;
+	}
+	case 697: { /* glMultiDrawElementsIndirectCount */
+		GLenum mode;
+		readValue(replay, &mode, sizeof(mode));
+		GLenum type;
+		readValue(replay, &type, sizeof(type));
+		const void *indirect = (const void *)readPointer(replay);
+		GLintptr drawcount;
+		readValue(replay, &drawcount, sizeof(drawcount));
+		GLsizei maxdrawcount;
+		readValue(replay, &maxdrawcount, sizeof(maxdrawcount));
+		GLsizei stride;
+		readValue(replay, &stride, sizeof(stride));
+		glad_glMultiDrawElementsIndirectCount(mode, type, indirect, drawcount, maxdrawcount, stride);
+		break;
+	}
+	case 698: { /* glPolygonOffsetClamp */
+		GLfloat factor;
+		readValue(replay, &factor, sizeof(factor));
+		GLfloat units;
+		readValue(replay, &units, sizeof(units));
+		GLfloat clamp;
+		readValue(replay, &clamp, sizeof(clamp));
+		glad_glPolygonOffsetClamp(factor, units, clamp);
+		break;
+	}
+	default:
+		return 0;
+	}
+	return 1;
+}
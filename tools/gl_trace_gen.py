@@ -0,0 +1,502 @@
+#!/usr/bin/env python3
+"""Generates include/lgl_gl_trace_gen.h, the GL call wrappers used by
+include/lgl_gl_trace.h, and the replayer's decoder from the glad header.
+
+usage: tools/gl_trace_gen.py [glad.h]
+
+Every entry point glad declares gets a wrapper that counts and times the
+call around the real function. The setters listed in STATE also record
+the state they set so repeated values show up as redundant, and the
+calls matched by SYNC are flagged as waiting on the driver.
+
+For frame capture every wrapper can also serialize its call; plan()
+decides how each parameter is stored (value, buffer offset, the data a
+pointer refers to, ...). The matching decoder for tools/gl_replay is
+written to tools/gl_replay/replay_gen.h."""
+
+import os
+import re
+import sys
+
+ROOT = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), ".."))
+GLAD = os.path.join(ROOT, "thirdparty/glad4.6/include/glad/glad.h")
+OUTPUT = os.path.join(ROOT, "include/lgl_gl_trace_gen.h")
+REPLAY = os.path.join(ROOT, "tools/gl_replay/replay_gen.h")
+
+# setter: (state it shares with, key, value); the key tells apart state
+# set by the same call, e.g. per target or per capability
+STATE = {
+    "glUseProgram": ("glUseProgram", "0", "program"),
+    "glBindVertexArray": ("glBindVertexArray", "0", "array"),
+    "glActiveTexture": ("glActiveTexture", "0", "texture"),
+    "glBindTexture": ("glBindTexture",
+                      "(GLuint64)lgl__glTrace.activeTexture << 32 | target",
+                      "texture"),
+    "glBindTextureUnit": ("glBindTextureUnit", "unit", "texture"),
+    # the element array buffer is part of the vertex array
+    "glBindBuffer": ("glBindBuffer",
+                     "target == GL_ELEMENT_ARRAY_BUFFER"
+                     " ? (GLuint64)lgl__glTrace.vertexArray << 32 | target"
+                     " : target", "buffer"),
+    "glBindRenderbuffer": ("glBindRenderbuffer", "target", "renderbuffer"),
+    "glBindSampler": ("glBindSampler", "unit", "sampler"),
+    "glEnable": ("glEnable", "cap", "1"),
+    "glDisable": ("glEnable", "cap", "0"),
+    "glBlendFunc": ("glBlendFunc", "0", "(GLuint64)sfactor << 32 | dfactor"),
+    "glBlendEquation": ("glBlendEquation", "0", "mode"),
+    "glDepthFunc": ("glDepthFunc", "0", "func"),
+    "glDepthMask": ("glDepthMask", "0", "flag"),
+    "glCullFace": ("glCullFace", "0", "mode"),
+    "glFrontFace": ("glFrontFace", "0", "mode"),
+    "glPolygonMode": ("glPolygonMode", "face", "mode"),
+    "glPixelStorei": ("glPixelStorei", "pname", "(GLuint)param"),
+    "glViewport": ("glViewport", "0",
+                   "(GLuint64)(x & 0xffff) << 48 | (GLuint64)(y & 0xffff) << 32"
+                   " | (GLuint64)(width & 0xffff) << 16 | (height & 0xffff)"),
+}
+
+# other bookkeeping, statements run before the call: the current texture
+# unit and vertex array the keys above use, binds that change the same
+# state, and deletes, which unbind the deleted names
+TRACK = {
+    "glActiveTexture": ["lgl__glTrace.activeTexture = texture - GL_TEXTURE0;"],
+    "glBindVertexArray": ["lgl__glTrace.vertexArray = array;"],
+    "glBindFramebuffer": ["lgl__glTraceBindFramebuffer({index},"
+                          " LGL__GL_BINDFRAMEBUFFER, target, framebuffer);"],
+    "glBindBufferBase": ["lgl__glTraceSet(LGL__GL_BINDBUFFER, target, buffer);"],
+    "glBindBufferRange": ["lgl__glTraceSet(LGL__GL_BINDBUFFER, target, buffer);"],
+    "glVertexArrayElementBuffer": [
+        "lgl__glTraceSet(LGL__GL_BINDBUFFER,"
+        " (GLuint64)vaobj << 32 | GL_ELEMENT_ARRAY_BUFFER, buffer);"],
+    "glDeleteBuffers": ["lgl__glTraceForget(LGL__GL_BINDBUFFER, n, buffers);"],
+    "glDeleteTextures": [
+        "lgl__glTraceForget(LGL__GL_BINDTEXTURE, n, textures);",
+        "lgl__glTraceForget(LGL__GL_BINDTEXTUREUNIT, n, textures);"],
+    "glDeleteVertexArrays": [
+        "lgl__glTraceForget(LGL__GL_BINDVERTEXARRAY, n, arrays);",
+        "lgl__glTraceForgetVertexArrays(LGL__GL_BINDBUFFER, n, arrays);"],
+    "glDeleteFramebuffers": [
+        "lgl__glTraceForget(LGL__GL_BINDFRAMEBUFFER, n, framebuffers);"],
+    "glDeleteRenderbuffers": [
+        "lgl__glTraceForget(LGL__GL_BINDRENDERBUFFER, n, renderbuffers);"],
+    "glDeleteSamplers": [
+        "lgl__glTraceForget(LGL__GL_BINDSAMPLER, count, samplers);"],
+    "glDeleteProgram": ["lgl__glTraceForget(LGL__GL_USEPROGRAM, 1, &program);"],
+}
+
+# calls that make the driver wait for the GPU or return state to the CPU
+SYNC = re.compile(r"^gl(Get|Is|ReadPixels|ReadnPixels|Finish|ClientWaitSync"
+                  r"|MapBuffer|MapNamedBuffer|CheckFramebufferStatus"
+                  r"|CheckNamedFramebufferStatus)")
+
+
+# object name parameters by the namespace they live in; the replayer maps
+# the captured names to the ones GL hands out during the replay
+NAMES = {
+    "buffer": "BUFFER", "buffers": "BUFFER", "readBuffer": "BUFFER",
+    "writeBuffer": "BUFFER",
+    "texture": "TEXTURE", "textures": "TEXTURE", "origtexture": "TEXTURE",
+    "array": "VERTEX_ARRAY", "arrays": "VERTEX_ARRAY", "vaobj": "VERTEX_ARRAY",
+    "framebuffer": "FRAMEBUFFER", "framebuffers": "FRAMEBUFFER",
+    "readFramebuffer": "FRAMEBUFFER", "drawFramebuffer": "FRAMEBUFFER",
+    "renderbuffer": "RENDERBUFFER", "renderbuffers": "RENDERBUFFER",
+    "sampler": "SAMPLER", "samplers": "SAMPLER",
+    "program": "PROGRAM", "shader": "PROGRAM", "shaders": "PROGRAM",
+    "pipeline": "PIPELINE", "pipelines": "PIPELINE",
+    "xfb": "TRANSFORM_FEEDBACK",
+}
+# functions returning a new name
+RESULT_NAMES = {"glCreateProgram": "PROGRAM", "glCreateShader": "PROGRAM",
+                "glCreateShaderProgramv": "PROGRAM"}
+
+
+def namespace(name, ctype, param):
+    """the namespace of an object name parameter, or None"""
+    if ctype not in ("GLuint", "const GLuint *", "GLuint *"):
+        return None
+    if param in ("id", "ids"):
+        # also debug message ids, which are not objects
+        if "Quer" in name:
+            return "QUERY"
+        if "TransformFeedback" in name:
+            return "TRANSFORM_FEEDBACK"
+        return None
+    return NAMES.get(param)
+
+
+def parse(path):
+    text = open(path).read()
+    functions = []
+    for ret, pfn, args in re.findall(
+            r"typedef (.+?) \(APIENTRYP PFN(\w+)PROC\)\((.*)\);", text):
+        name = re.search(r"GLAPI PFN%sPROC glad_(\w+);" % pfn, text).group(1)
+        params = [] if args == "void" else [a.strip() for a in args.split(",")]
+        names = [re.search(r"(\w+)$", p).group(1) for p in params]
+        functions.append((name, pfn, ret, args, names))
+    return functions
+
+
+COUNT_PARAMS = ("n", "count", "drawcount", "numAttachments", "uniformCount",
+                "numSpecializationConstants")
+TEXTURE_PARAMS = re.compile(r"^gl(Texture|Sampler|Tex|Point|Patch)Parameter")
+LEGACY_PACKED = re.compile(r"^gl(Vertex|TexCoord|MultiTexCoord|Normal|Color"
+                           r"|SecondaryColor)P\duiv$")
+
+
+def split(args):
+    """(declaration, type, name) of every parameter"""
+    params = [] if args == "void" else [a.strip() for a in args.split(",")]
+    out = []
+    for p in params:
+        name = re.search(r"(\w+)$", p).group(1)
+        out.append((p, p[:-len(name)].strip(), name))
+    return out
+
+
+def pixel_bytes(names, pack):
+    dims = [d if d in names else "1" for d in ("width", "height", "depth")]
+    return "lgl__glCapturePixelBytes(%s, format, type, %d)" \
+        % (", ".join(dims), pack)
+
+
+def plan(function):
+    """how every parameter is captured: a list of (kind, expression) in
+    parameter order, or None when a pointer cannot be captured"""
+    name, _, _, args, names = function
+    params = split(args)
+    scalars = [p for d, t, p in params if "*" not in t]
+    count = next((c for c in COUNT_PARAMS if c in scalars), None)
+    kinds = []
+    for decl, ctype, param in params:
+        element = "sizeof(*%s)" % param
+
+        if ctype == "GLsync":
+            kinds.append(("sync", param))
+        elif ctype == "GLDEBUGPROC" or name == "glDebugMessageCallback":
+            kinds.append(("drop", None))
+        elif "*" not in ctype:
+            kinds.append(("value", param))
+        elif not ctype.startswith("const"):
+            # outputs, GL writes them
+            if name.startswith(("glGen", "glCreate")) and ctype == "GLuint *":
+                kinds.append(("record", "%s * sizeof(GLuint)" % count))
+            elif param in ("pixels", "img") or name == "glReadnPixels":
+                if "bufSize" in names:
+                    kinds.append(("pack", "bufSize"))
+                elif "width" in names:
+                    kinds.append(("pack", pixel_bytes(names, 1)))
+                else:
+                    return None  # the size depends on the texture
+            elif param == "length":
+                kinds.append(("output", "sizeof(*length)"))
+            elif "bufSize" in names:
+                kinds.append(("output", "bufSize * sizeof(*%s)" % param
+                              if ctype != "void *" else "bufSize"))
+            elif param == "data" and "size" in names:
+                kinds.append(("output", "size"))
+            else:
+                kinds.append(("output", "0"))
+        elif param in ("indices", "pointer", "indirect") \
+                and ctype == "const void *":
+            kinds.append(("offset", param))
+        elif param == "ptr":
+            kinds.append(("sync", param))
+        elif param == "pixels":
+            kinds.append(("unpack", pixel_bytes(names, 0)))
+        elif param == "data" and "imageSize" in names:
+            kinds.append(("unpack", "imageSize"))
+        elif param == "data" and "Clear" in name:
+            kinds.append(("data", "lgl__glCaptureTexelBytes(format, type)"))
+        elif param == "data" and "size" in names:
+            kinds.append(("data", "size"))
+        elif param == "binary":
+            kinds.append(("data", "length"))
+        elif ctype == "const GLchar *const*":
+            kinds.append(("strings", (count, "length" if "length" in names
+                                      else "NULL")))
+        elif ctype == "const GLchar *":
+            kinds.append(("data", "lgl__glCaptureStringBytes(%s, %s)"
+                          % (param, "length" if "length" in names else "-1")))
+        elif ctype == "const void *const*":
+            kinds.append(("data", "%s * sizeof(void *)" % count))
+        elif re.match(r"^gl(Program)?Uniform", name) and param == "value":
+            m = re.search(r"Matrix(\d)x(\d)|Matrix(\d)|Uniform(\d)", name)
+            if m.group(1):
+                n = "%s * %s" % (m.group(1), m.group(2))
+            elif m.group(3):
+                n = "%s * %s" % (m.group(3), m.group(3))
+            else:
+                n = m.group(4)
+            kinds.append(("data", "%s * %s * %s" % (count, n, element)))
+        elif re.match(r"^glVertexAttrib(I|L)?\dN?[a-z]+v$", name):
+            n = re.search(r"(\d)", name).group(1)
+            kinds.append(("data", "%s * %s" % (n, element)))
+        elif re.match(r"^glVertexAttribP\duiv$", name) \
+                or LEGACY_PACKED.match(name):
+            kinds.append(("data", element))
+        elif TEXTURE_PARAMS.match(name):
+            kinds.append(("data", "lgl__glCaptureParamCount(pname) * %s"
+                          % element))
+        elif re.match(r"^glClear(Buffer|NamedFramebuffer)\w+v$", name):
+            kinds.append(("data", "(buffer == GL_COLOR ? 4 : 1) * %s" % element))
+        elif name in ("glViewportArrayv", "glScissorArrayv"):
+            kinds.append(("data", "count * 4 * %s" % element))
+        elif name == "glDepthRangeArrayv":
+            kinds.append(("data", "count * 2 * %s" % element))
+        elif name in ("glViewportIndexedfv", "glScissorIndexedv"):
+            kinds.append(("data", "4 * %s" % element))
+        elif param == "props":
+            kinds.append(("data", "propCount * %s" % element))
+        elif count:
+            kinds.append(("data", "%s * %s" % (count, element)))
+        else:
+            return None
+
+    # glShaderSource's lengths go with the strings
+    if name == "glShaderSource":
+        kinds[3] = ("drop", None)
+    return kinds
+
+
+def wrapper(index, function):
+    name, pfn, ret, args, names = function
+    call = "lgl__glReal_%s(%s)" % (name, ", ".join(names))
+    leave = "\tlgl__glTraceLeave(%d, %d, lgl__start);" % (
+        index, 1 if SYNC.match(name) else 0)
+    capture = "\tif (lgl__glTrace.capture && lgl__glTrace.depth == 1)\n" \
+        "\t\tlgl__glCapture_%s(%s);" % (
+            name, ", ".join(names + (["lgl__result"] if ret != "void" else [])))
+    lines = ["static %s APIENTRY lgl__glTrace_%s(%s)" % (ret, name, args), "{"]
+    if ret != "void":
+        lines.append("\t%s lgl__result;" % ret)
+    lines.append("\tdouble lgl__start = lgl__glTraceEnter(%d);" % index)
+    lines.append("")
+    if name in STATE:
+        owner, key, value = STATE[name]
+        lines.append("\tlgl__glTraceState(%d, %s, %s, %s);"
+                     % (index, "LGL__GL_" + owner[2:].upper(), key, value))
+    for statement in TRACK.get(name, []):
+        lines.append("\t" + statement.format(index=index))
+    if ret != "void":
+        lines.append("\tlgl__result = %s;" % call)
+        lines.append(capture)
+        lines.append(leave)
+        lines.append("\treturn lgl__result;")
+    else:
+        lines.append("\t%s;" % call)
+        lines.append(capture)
+        lines.append(leave)
+    lines.append("}")
+    return "\n".join(lines)
+
+
+def capture(index, function):
+    name, pfn, ret, args, names = function
+    params = args if ret == "void" else \
+        (args if args != "void" else "") + \
+        (", " if args != "void" else "") + "%s lgl__result" % ret
+    kinds = plan(function)
+    lines = ["static void lgl__glCapture_%s(%s)" % (name, params), "{"]
+    if kinds is None:
+        for n in names:
+            lines.append("\t(void)%s;" % n)
+        if ret != "void":
+            lines.append("\t(void)lgl__result;")
+        lines.append("\tlgl__glCaptureLossy(%d);" % index)
+        lines.append("}")
+        return "\n".join(lines)
+
+    lines.append("\tlgl__glCaptureBegin(%d);" % index)
+    for (decl, ctype, param), (kind, expr) in zip(split(args), kinds):
+        if kind == "value":
+            lines.append("\tlgl__glCaptureValue(&%s, sizeof(%s));"
+                         % (param, param))
+        elif kind == "sync":
+            lines.append("\tlgl__glCaptureSync(%s);" % param)
+        elif kind == "drop":
+            lines.append("\t(void)%s;" % param)
+            lines.append("\tlgl__glCaptureData(NULL, 0);")
+        elif kind == "offset":
+            lines.append("\tlgl__glCaptureOffset(%s);" % param)
+        elif kind == "data":
+            lines.append("\tlgl__glCaptureData(%s, %s ? (size_t)(%s) : 0);"
+                         % (param, param, expr))
+        elif kind == "unpack":
+            lines.append("\tlgl__glCaptureUnpack(%s, (size_t)(%s));"
+                         % (param, expr))
+        elif kind == "pack":
+            lines.append("\tlgl__glCapturePack(%s, (size_t)(%s));"
+                         % (param, expr))
+        elif kind == "output":
+            lines.append("\t(void)%s;" % param)
+            lines.append("\tlgl__glCaptureOutput((size_t)(%s));" % expr)
+        elif kind == "record":
+            lines.append("\tlgl__glCaptureRecord(%s, (size_t)(%s));"
+                         % (param, expr))
+        elif kind == "strings":
+            lines.append("\tlgl__glCaptureStrings(%s, %s, %s);"
+                         % (expr[0], param, expr[1]))
+    if ret == "GLsync":
+        lines.append("\tlgl__glCaptureSync(lgl__result);")
+    elif ret != "void" and "*" not in ret:
+        lines.append("\tlgl__glCaptureValue(&lgl__result, sizeof(lgl__result));")
+    elif ret != "void":
+        lines.append("\t(void)lgl__result;")
+    lines.append("}")
+    return "\n".join(lines)
+
+
+def replay_case(index, function):
+    name, pfn, ret, args, names = function
+    kinds = plan(function)
+    if kinds is None:
+        return None
+    params = split(args)
+    scalars = [p for d, t, p in params if "*" not in t]
+    count = next((c for c in COUNT_PARAMS if c in scalars), None)
+    recorded = []
+    lines = ["\tcase %d: { /* %s */" % (index, name)]
+    for (decl, ctype, param), (kind, expr) in zip(params, kinds):
+        space = namespace(name, ctype, param)
+        if kind == "value":
+            lines.append("\t\t%s;" % decl)
+            lines.append("\t\treadValue(replay, &%s, sizeof(%s));" % (param, param))
+            if space:
+                lines.append("\t\t%s = mapName(replay, NAME_%s, %s);"
+                             % (param, space, param))
+        elif kind == "sync":
+            lines.append("\t\t%s = (%s)readSync(replay);" % (decl, ctype))
+        elif kind == "strings":
+            lines.append("\t\t%s = (%s)readStrings(replay);" % (decl, ctype))
+        elif ctype == "GLDEBUGPROC":
+            lines.append("\t\t%s = NULL;" % decl)
+            lines.append("\t\treadPointer(replay);")
+        else:
+            lines.append("\t\t%s = (%s)readPointer(replay);" % (decl, ctype))
+            if space and kind == "data" and count:
+                lines.append("\t\t%s = mapNames(replay, NAME_%s, %s, %s);"
+                             % (param, space, param, count))
+            elif space and kind == "record":
+                recorded.append(space)
+    call = "glad_%s(%s)" % (name, ", ".join(names))
+    if ret == "GLsync":
+        lines.append("\t\tmapSync(replay, %s);" % call)
+    elif name in RESULT_NAMES:
+        lines.append("\t\tmapResult(replay, NAME_%s, %s);"
+                     % (RESULT_NAMES[name], call))
+    elif ret != "void" and "*" not in ret:
+        lines.append("\t\t%s result = %s;" % (ret, call))
+        lines.append("")
+        lines.append("\t\tcheckResult(replay, &result, sizeof(result));")
+    else:
+        lines.append("\t\t%s;" % call)
+    for space in recorded:
+        lines.append("\t\trecordNames(replay, NAME_%s);" % space)
+    lines.append("\t\tbreak;")
+    lines.append("\t}")
+    return "\n".join(lines)
+
+
+def generate(functions):
+    out = ["/* Generated by tools/gl_trace_gen.py from the glad header, do not"
+           " edit.",
+           " * Included by the implementation of lgl_gl_trace.h. */",
+           "",
+           "#define LGL__GL_TRACE_COUNT %d" % len(functions),
+           ""]
+
+    index = {f[0]: i for i, f in enumerate(functions)}
+    owners = set(s[0] for s in STATE.values()) | {"glBindFramebuffer"}
+    for owner in sorted(owners):
+        out.append("#define LGL__GL_%s %d" % (owner[2:].upper(), index[owner]))
+    out.append("")
+
+    out.append("static const char *lgl__glTraceNames[LGL__GL_TRACE_COUNT] = {")
+    for f in functions:
+        out.append('\t"%s",' % f[0])
+    out.append("};")
+    out.append("")
+
+    for f in functions:
+        out.append("static PFN%sPROC lgl__glReal_%s;" % (f[1], f[0]))
+    out.append("")
+
+    for i, f in enumerate(functions):
+        out.append(capture(i, f))
+        out.append("")
+
+    for i, f in enumerate(functions):
+        out.append(wrapper(i, f))
+        out.append("")
+
+    out.append("/* swaps the wrappers into glad's pointers, or the real"
+               " functions back where")
+    out.append(" * the pointers still hold the wrappers; returns how many"
+               " were hooked again")
+    out.append(" * since, and still chain through them */")
+    out.append("static int lgl__glTraceHook(int install)")
+    out.append("{")
+    out.append("\tint left = 0;")
+    out.append("")
+    out.append("\tif (install) {")
+    for f in functions:
+        out.append("\t\tlgl__glReal_{0} = glad_{0};".format(f[0]))
+        out.append("\t\tif (glad_{0}) glad_{0} = lgl__glTrace_{0};"
+                   .format(f[0]))
+    out.append("\t} else {")
+    for f in functions:
+        out.append("\t\tif (glad_{0} == lgl__glTrace_{0})".format(f[0]))
+        out.append("\t\t\tglad_{0} = lgl__glReal_{0};".format(f[0]))
+        out.append("\t\telse if (glad_{0} != lgl__glReal_{0})".format(f[0]))
+        out.append("\t\t\tleft++;")
+    out.append("\t}")
+    out.append("\treturn left;")
+    out.append("}")
+    return "\n".join(out) + "\n"
+
+
+def generate_replay(functions):
+    out = ["/* Generated by tools/gl_trace_gen.py from the glad header, do not"
+           " edit.",
+           " * Decodes and calls one captured GL call, see main.c. */",
+           "",
+           "#define CALL_COUNT %d" % len(functions),
+           "",
+           "static const char *callNames[CALL_COUNT] = {"]
+    for f in functions:
+        out.append('\t"%s",' % f[0])
+    out.append("};")
+    out.append("")
+    out.append("/* returns 0 for calls the capture could not record */")
+    out.append("static int replayCall(Replay *replay, int index)")
+    out.append("{")
+    out.append("\tswitch (index) {")
+    for i, f in enumerate(functions):
+        case = replay_case(i, f)
+        if case:
+            out.append(case)
+    out.append("\tdefault:")
+    out.append("\t\treturn 0;")
+    out.append("\t}")
+    out.append("\treturn 1;")
+    out.append("}")
+    return "\n".join(out) + "\n"
+
+
+def main():
+    glad = sys.argv[1] if len(sys.argv) > 1 else GLAD
+    functions = parse(glad)
+    with open(OUTPUT, "w") as f:
+        f.write(generate(functions))
+    with open(REPLAY, "w") as f:
+        f.write(generate_replay(functions))
+
+    lossy = [f[0] for f in functions if plan(f) is None]
+    print("%d entry points written to %s and %s" % (len(functions), OUTPUT,
+                                                    REPLAY))
+    if lossy:
+        print("not captured: " + ", ".join(lossy))
+
+
+if __name__ == "__main__":
+    main()
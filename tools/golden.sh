@@ -0,0 +1,73 @@
+#!/bin/sh
+# Golden-image test: runs every 1.getting_started sample headless (make
+# headless) on a fixed clock, captures its last frame (LGL_CAPTURE) and
+# compares it with golden/<sample>.ppm using tools/image_diff. Differing
+# samples leave golden/diff/<sample>.ppm behind.
+#
+# usage: tools/golden.sh [--update] [sample dir...]
+#        --update stores the captured frames as the new references
+# env:   GOLDEN_DIR (default golden/), TOLERANCE (per channel, default 2),
+#        MAX_DIFFERING (pixels, default 0), LGL_FRAMES (default 30),
+#        HEADLESS and HEADLESS_LIBS for make
+
+set -e
+
+root=$(cd "$(dirname "$0")/.." && pwd)
+update=0
+if [ "$1" = --update ]; then
+	update=1
+	shift
+fi
+
+golden=${GOLDEN_DIR:-$root/golden}
+case $golden in
+/*) ;;
+*) golden=$(pwd)/$golden ;;
+esac
+
+export LGL_FRAMES=${LGL_FRAMES:-30}
+export LGL_FIXED_DT=${LGL_FIXED_DT:-0.0166667}
+unset LGL_BENCH LGL_TRACE
+
+if [ $# -eq 0 ]; then
+	set -- "$root"/1.getting_started/*/
+fi
+
+make -s -C "$root/tools/image_diff" >&2
+imageDiff=$root/tools/image_diff/bin/image_diff
+
+work=$(mktemp -d)
+trap 'rm -rf "$work"' EXIT
+
+failed=0
+for dir in "$@"; do
+	# shader-only exercises have nothing to run
+	[ -f "$dir/Makefile" ] || continue
+	name=$(basename "$dir")
+
+	if ! LGL_CAPTURE="$work/$name.ppm" \
+	     make -s -C "$dir" headless >"$work/$name.log" 2>&1 \
+	   || [ ! -s "$work/$name.ppm" ]; then
+		echo "$name: FAIL, the sample did not run:"
+		cat "$work/$name.log"
+		failed=1
+		continue
+	fi
+
+	if [ $update -eq 1 ]; then
+		mkdir -p "$golden"
+		cp "$work/$name.ppm" "$golden/$name.ppm"
+		echo "$name: reference updated"
+	elif [ ! -f "$golden/$name.ppm" ]; then
+		echo "$name: FAIL, no reference, run with --update first"
+		failed=1
+	else
+		mkdir -p "$golden/diff"
+		printf '%s: ' "$name"
+		"$imageDiff" "$golden/$name.ppm" "$work/$name.ppm" \
+			     "$golden/diff/$name.ppm" "${TOLERANCE:-2}" \
+			     "${MAX_DIFFERING:-0}" || failed=1
+	fi
+done
+
+exit $failed
@@ -0,0 +1,216 @@
+/* Compares a rendered frame against a reference image, both binary PPM
+ * (as written by LGL_CAPTURE, see include/lgl_platform.h). A pixel
+ * differs when any channel is off by more than the tolerance; the images
+ * match while at most `max differing` pixels differ. On a mismatch an
+ * optional diff image shows the reference dimmed to gray with the
+ * differing pixels in red, brighter the larger the difference.
+ *
+ * usage: image_diff reference.ppm actual.ppm [diff.ppm] [tolerance]
+ *                   [max differing]
+ * exits with 0 when the images match, 1 when not, 2 on errors */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+typedef struct {
+	int width, height;
+	unsigned char *pixels; /* RGBX, the padding byte is 0 */
+} Image;
+
+static int skipSpace(FILE *file)
+{
+	int c = fgetc(file);
+
+	/* whitespace and comments between header fields */
+	while (c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '#') {
+		if (c == '#')
+			while (c != '\n' && c != EOF) c = fgetc(file);
+		c = fgetc(file);
+	}
+	return ungetc(c, file) != EOF;
+}
+
+static int readPpm(const char *path, Image *image)
+{
+	FILE *file = fopen(path, "rb");
+	int maxValue = 0, ok = 0;
+	size_t i, count;
+
+	memset(image, 0, sizeof(*image));
+	if (!file) {
+		fprintf(stderr, "Could not read \"%s\"\n", path);
+		return 0;
+	}
+
+	if (fgetc(file) != 'P' || fgetc(file) != '6'
+	    || !skipSpace(file) || fscanf(file, "%d", &image->width) != 1
+	    || !skipSpace(file) || fscanf(file, "%d", &image->height) != 1
+	    || !skipSpace(file) || fscanf(file, "%d", &maxValue) != 1
+	    || maxValue != 255 || fgetc(file) == EOF
+	    || image->width <= 0 || image->height <= 0) {
+		fprintf(stderr, "\"%s\" is not an 8-bit binary PPM\n", path);
+		goto defer;
+	}
+
+	count = (size_t)image->width * image->height;
+	image->pixels = calloc(count, 4);
+	if (!image->pixels) {
+		fprintf(stderr, "Out of memory\n");
+		goto defer;
+	}
+
+	for (i = 0; i < count; i++)
+		if (fread(image->pixels + i * 4, 1, 3, file) != 3) {
+			fprintf(stderr, "\"%s\" is truncated\n", path);
+			goto defer;
+		}
+	ok = 1;
+
+ defer:
+	fclose(file);
+	if (!ok) {
+		free(image->pixels);
+		image->pixels = NULL;
+	}
+	return ok;
+}
+
+/* pixels with a channel off by more than `tolerance`, and the largest
+ * difference of any channel */
+static size_t countDiffering(const unsigned char *a, const unsigned char *b,
+			     size_t count, int tolerance, int *maxDiff)
+{
+	size_t differing = 0, i = 0;
+	int largest = 0;
+
+#ifdef __SSE2__
+	/* four RGBX pixels at a time */
+	__m128i limit = _mm_set1_epi8((char)tolerance);
+	__m128i zero = _mm_setzero_si128();
+	__m128i largestV = zero;
+	unsigned char lanes[16];
+	int j;
+
+	for (; i + 4 <= count; i += 4) {
+		__m128i x = _mm_loadu_si128((const __m128i *)(a + i * 4));
+		__m128i y = _mm_loadu_si128((const __m128i *)(b + i * 4));
+		__m128i diff = _mm_or_si128(_mm_subs_epu8(x, y),
+					    _mm_subs_epu8(y, x));
+		int over;
+
+		largestV = _mm_max_epu8(largestV, diff);
+
+		/* nonzero bytes after subtracting the tolerance are over it */
+		over = ~_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_subs_epu8(diff, limit),
+							 zero)) & 0xffff;
+		differing += ((over & 0x000f) != 0) + ((over & 0x00f0) != 0)
+			+ ((over & 0x0f00) != 0) + ((over & 0xf000) != 0);
+	}
+
+	_mm_storeu_si128((__m128i *)lanes, largestV);
+	for (j = 0; j < 16; j++)
+		if (lanes[j] > largest) largest = lanes[j];
+#endif
+
+	for (; i < count; i++) {
+		int over = 0, c;
+
+		for (c = 0; c < 3; c++) {
+			int diff = abs(a[i * 4 + c] - b[i * 4 + c]);
+
+			if (diff > largest) largest = diff;
+			if (diff > tolerance) over = 1;
+		}
+		differing += over;
+	}
+
+	*maxDiff = largest;
+	return differing;
+}
+
+static int writeDiff(const char *path, const Image *reference,
+		     const Image *actual, int tolerance)
+{
+	size_t count = (size_t)reference->width * reference->height, i;
+	FILE *file = fopen(path, "wb");
+
+	if (!file) {
+		fprintf(stderr, "Could not write \"%s\"\n", path);
+		return 0;
+	}
+
+	fprintf(file, "P6\n%d %d\n255\n", reference->width, reference->height);
+	for (i = 0; i < count; i++) {
+		const unsigned char *a = reference->pixels + i * 4;
+		const unsigned char *b = actual->pixels + i * 4;
+		unsigned char out[3];
+		int largest = 0, c;
+
+		for (c = 0; c < 3; c++)
+			if (abs(a[c] - b[c]) > largest) largest = abs(a[c] - b[c]);
+
+		if (largest > tolerance) {
+			out[0] = (unsigned char)(128 + largest / 2);
+			out[1] = out[2] = 0;
+		} else {
+			out[0] = out[1] = out[2] =
+				(unsigned char)((a[0] + a[1] + a[2]) / 12);
+		}
+		fwrite(out, 1, 3, file);
+	}
+
+	fclose(file);
+	return 1;
+}
+
+int main(int argc, char **argv)
+{
+	Image reference = {0}, actual = {0};
+	const char *diffPath = argc > 3 ? argv[3] : NULL;
+	int tolerance = argc > 4 ? atoi(argv[4]) : 2;
+	long maxDiffering = argc > 5 ? atol(argv[5]) : 0;
+	size_t differing;
+	int exitCode = 2, maxDiff;
+
+	if (argc < 3 || argc > 6) {
+		fprintf(stderr, "usage: %s reference.ppm actual.ppm [diff.ppm]"
+			" [tolerance] [max differing]\n", argv[0]);
+		return 2;
+	}
+	if (tolerance < 0) tolerance = 0;
+	if (tolerance > 255) tolerance = 255;
+
+	if (!readPpm(argv[1], &reference) || !readPpm(argv[2], &actual))
+		goto defer;
+
+	if (reference.width != actual.width || reference.height != actual.height) {
+		printf("size differs: %dx%d, expected %dx%d\n", actual.width,
+		       actual.height, reference.width, reference.height);
+		exitCode = 1;
+		goto defer;
+	}
+
+	differing = countDiffering(reference.pixels, actual.pixels,
+				   (size_t)reference.width * reference.height,
+				   tolerance, &maxDiff);
+	exitCode = (long)differing > maxDiffering;
+
+	printf("%s: %lu of %d pixels differ by more than %d, largest"
+	       " difference %d\n", exitCode ? "FAIL" : "ok",
+	       (unsigned long)differing, reference.width * reference.height,
+	       tolerance, maxDiff);
+
+	if (exitCode && diffPath && !writeDiff(diffPath, &reference, &actual,
+						tolerance))
+		exitCode = 2;
+
+ defer:
+	free(reference.pixels);
+	free(actual.pixels);
+	return exitCode;
+}
@@ -0,0 +1,229 @@
+/* Offline mesh optimizer: reads a Wavefront OBJ file, runs the
+ * lgl_mesh_opt stages over it and writes the result back as OBJ. The
+ * optimized indices can also be written in the compressed lgl_index_buffer
+ * format.
+ *
+ * usage: mesh_optimizer input.obj output.obj [indices.lgli] */
+
+#include <glad/glad.h>
+
+#define LGL_MESH_OPT_IMPLEMENTATION
+#include <lgl_mesh_opt.h>
+
+#define LGL_INDEX_BUFFER_IMPLEMENTATION
+#include <lgl_index_buffer.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* position, texture coords, normal */
+#define STRIDE 8
+
+typedef struct {
+	float *data;
+	int count, capacity; /* in floats */
+} FloatArray;
+
+typedef struct {
+	unsigned int *data;
+	int count, capacity;
+} IndexArray;
+
+static int pushFloats(FloatArray *array, const float *values, int count)
+{
+	if (array->count + count > array->capacity) {
+		int capacity = array->capacity ? array->capacity * 2 : 1024;
+		float *data;
+
+		while (capacity < array->count + count) capacity *= 2;
+		data = realloc(array->data, sizeof(float) * capacity);
+		if (!data) return 0;
+		array->data = data;
+		array->capacity = capacity;
+	}
+
+	memcpy(array->data + array->count, values, sizeof(float) * count);
+	array->count += count;
+	return 1;
+}
+
+static int pushIndex(IndexArray *array, unsigned int value)
+{
+	if (array->count == array->capacity) {
+		int capacity = array->capacity ? array->capacity * 2 : 1024;
+		unsigned int *data = realloc(array->data,
+					     sizeof(unsigned int) * capacity);
+		if (!data) return 0;
+		array->data = data;
+		array->capacity = capacity;
+	}
+
+	array->data[array->count++] = value;
+	return 1;
+}
+
+/* resolves a 1-based or negative OBJ index, returns -1 if out of range */
+static int resolveIndex(long index, int count)
+{
+	if (index > 0 && index <= count) return (int)index - 1;
+	if (index < 0 && -index <= count) return count + (int)index;
+	return -1;
+}
+
+/* appends the vertex of one face corner ("v", "v/vt", "v//vn", "v/vt/vn") */
+static int pushCorner(FloatArray *vertices, const char *corner,
+		      const FloatArray *positions, const FloatArray *texCoords,
+		      const FloatArray *normals)
+{
+	float vertex[STRIDE] = {0.0f};
+	char *end;
+	int p, t = -1, n = -1;
+
+	p = resolveIndex(strtol(corner, &end, 10), positions->count / 3);
+	if (p < 0) return 0;
+
+	if (*end == '/') {
+		if (end[1] != '/')
+			t = resolveIndex(strtol(end + 1, &end, 10), texCoords->count / 2);
+		else
+			end++;
+		if (*end == '/')
+			n = resolveIndex(strtol(end + 1, &end, 10), normals->count / 3);
+	}
+
+	memcpy(vertex, positions->data + p * 3, sizeof(float) * 3);
+	if (t >= 0) memcpy(vertex + 3, texCoords->data + t * 2, sizeof(float) * 2);
+	if (n >= 0) memcpy(vertex + 5, normals->data + n * 3, sizeof(float) * 3);
+
+	return pushFloats(vertices, vertex, STRIDE);
+}
+
+int main(int argc, char **argv)
+{
+	FloatArray positions = {0}, texCoords = {0}, normals = {0}, vertices = {0};
+	IndexArray indices = {0};
+	FILE *input = NULL, *output = NULL;
+	char line[1024];
+	lgl_MeshStats before, after;
+	int exitCode = 0, vertexCount, i;
+
+	if (argc != 3 && argc != 4) {
+		fprintf(stderr, "usage: %s input.obj output.obj [indices.lgli]\n",
+			argv[0]);
+		return 1;
+	}
+
+	input = fopen(argv[1], "r");
+	if (!input) {
+		fprintf(stderr, "Could not read \"%s\"\n", argv[1]);
+		return 1;
+	}
+
+	while (fgets(line, sizeof(line), input)) {
+		float values[3] = {0.0f, 0.0f, 0.0f};
+
+		if (sscanf(line, "v %f %f %f", &values[0], &values[1], &values[2]) == 3) {
+			if (!pushFloats(&positions, values, 3)) goto oom;
+		} else if (sscanf(line, "vt %f %f", &values[0], &values[1]) == 2) {
+			if (!pushFloats(&texCoords, values, 2)) goto oom;
+		} else if (sscanf(line, "vn %f %f %f", &values[0], &values[1], &values[2]) == 3) {
+			if (!pushFloats(&normals, values, 3)) goto oom;
+		} else if (line[0] == 'f' && line[1] == ' ') {
+			/* polygons are triangulated as fans */
+			int first = vertices.count / STRIDE, corners = 0;
+			char *token = strtok(line + 2, " \t\r\n");
+
+			for (; token; token = strtok(NULL, " \t\r\n"), corners++) {
+				if (!pushCorner(&vertices, token, &positions,
+						&texCoords, &normals)) {
+					fprintf(stderr, "Invalid face corner \"%s\"\n", token);
+					exitCode = 1;
+					goto defer;
+				}
+				if (corners >= 2
+				    && (!pushIndex(&indices, first)
+					|| !pushIndex(&indices, first + corners - 1)
+					|| !pushIndex(&indices, first + corners)))
+					goto oom;
+			}
+		}
+	}
+
+	vertexCount = lgl_meshOptimize(vertices.data, vertices.count / STRIDE,
+				       STRIDE, indices.data, indices.count,
+				       &before, &after);
+	lgl_meshPrintStats(argv[1], &before, &after);
+
+	output = fopen(argv[2], "w");
+	if (!output) {
+		fprintf(stderr, "Could not write \"%s\"\n", argv[2]);
+		exitCode = 1;
+		goto defer;
+	}
+
+	for (i = 0; i < vertexCount; i++) {
+		const float *v = vertices.data + i * STRIDE;
+
+		fprintf(output, "v %g %g %g\n", v[0], v[1], v[2]);
+		if (texCoords.count) fprintf(output, "vt %g %g\n", v[3], v[4]);
+		if (normals.count) fprintf(output, "vn %g %g %g\n", v[5], v[6], v[7]);
+	}
+
+	for (i = 0; i + 2 < indices.count; i += 3) {
+		int k;
+
+		fputc('f', output);
+		for (k = 0; k < 3; k++) {
+			unsigned int index = indices.data[i + k] + 1;
+
+			if (texCoords.count && normals.count)
+				fprintf(output, " %u/%u/%u", index, index, index);
+			else if (texCoords.count)
+				fprintf(output, " %u/%u", index, index);
+			else if (normals.count)
+				fprintf(output, " %u//%u", index, index);
+			else
+				fprintf(output, " %u", index);
+		}
+		fputc('\n', output);
+	}
+
+	if (argc == 4) {
+		lgl_IndexBuffer ib;
+		FILE *saved;
+
+		if (!lgl_indexBufferBuild(&ib, indices.data, indices.count,
+					  vertexCount))
+			goto oom;
+
+		if (lgl_indexBufferSave(&ib, argv[3])
+		    && (saved = fopen(argv[3], "rb"))) {
+			fseek(saved, 0, SEEK_END);
+			printf("indices: %d bytes as 32-bit, %lu bytes as %d-bit, "
+			       "%ld bytes compressed\n", indices.count * 4,
+			       (unsigned long)lgl_indexBufferSize(&ib),
+			       ib.indexSize * 8, ftell(saved));
+			fclose(saved);
+		} else {
+			fprintf(stderr, "Could not write \"%s\"\n", argv[3]);
+			exitCode = 1;
+		}
+		lgl_indexBufferFree(&ib);
+	}
+	goto defer;
+
+ oom:
+	fprintf(stderr, "Out of memory\n");
+	exitCode = 1;
+
+ defer:
+	if (input) fclose(input);
+	if (output) fclose(output);
+	free(positions.data);
+	free(texCoords.data);
+	free(normals.data);
+	free(vertices.data);
+	free(indices.data);
+	return exitCode;
+}
@@ -0,0 +1,257 @@
+/* Micro-benchmarks of the CPU paths the samples share: the cglm math
+ * building their transforms, stb_image decoding their textures and
+ * lgl_readFile loading their shaders. Each case is calibrated to run for
+ * about 10 ms, repeated, and reported as nanoseconds per operation in the
+ * JSON format of LGL_BENCH (see include/lgl_platform.h), one object per
+ * case:
+ *
+ *   {"cglm_mat4_mul": {"min": ..., "mean": ..., "p50": ..., "max": ...}, ...}
+ *
+ * usage: micro_bench [repository root] [repetitions]
+ *        the root defaults to ../.., where the assets are found */
+
+#include <glad/glad.h>
+
+#include <cglm/cglm.h>
+
+#define LGL_STB_IMAGE_IMPLEMENTATION
+#include <lgl_stb_image.h>
+
+#define LGL_SHADER_IMPLEMENTATION
+#include <lgl_shader.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define goto_defer(value) do { exitCode = (value); goto defer; } while(0)
+
+#define MIN_SECONDS 0.01
+
+typedef struct {
+	const char *name;
+	void (*run)(long iterations);
+} Case;
+
+/* results land here so the compiler cannot drop the work */
+static volatile float sink;
+
+static unsigned char *texture;
+static int textureSize;
+static char shaderPath[1024];
+
+static double now(void)
+{
+	struct timespec time;
+
+	clock_gettime(CLOCK_MONOTONIC, &time);
+	return (double)time.tv_sec + time.tv_nsec * 1e-9;
+}
+
+static void mat4Mul(long iterations)
+{
+	mat4 a, b, out;
+	long i;
+
+	glm_rotate_make(a, 0.5f, (vec3){0.0f, 0.0f, 1.0f});
+	glm_translate_make(b, (vec3){0.5f, -0.5f, 0.0f});
+	glm_mat4_identity(out);
+	for (i = 0; i < iterations; i++) {
+		glm_mat4_mul(a, b, out);
+		a[3][0] = out[3][1];
+	}
+	sink = out[3][0];
+}
+
+static void mat4Inv(long iterations)
+{
+	mat4 m, out;
+	long i;
+
+	glm_perspective(glm_rad(45.0f), 800.0f / 600.0f, 0.1f, 100.0f, m);
+	glm_mat4_identity(out);
+	for (i = 0; i < iterations; i++) {
+		glm_mat4_inv(m, out);
+		m[0][1] = out[0][0] * 1e-9f;
+	}
+	sink = out[0][0];
+}
+
+/* the model matrix of 5.1.transformations */
+static void modelMatrix(long iterations)
+{
+	mat4 trans;
+	long i;
+
+	for (i = 0; i < iterations; i++) {
+		glm_mat4_identity(trans);
+		glm_translate(trans, (vec3){0.5f, -0.5f, 0.0f});
+		glm_rotate(trans, (float)i * 1e-3f, (vec3){0.0f, 0.0f, 1.0f});
+		glm_scale(trans, (vec3){0.5f, 0.5f, 0.5f});
+		sink = trans[0][0];
+	}
+}
+
+static void viewProjection(long iterations)
+{
+	mat4 view, projection, viewProjection;
+	long i;
+
+	for (i = 0; i < iterations; i++) {
+		glm_lookat((vec3){0.0f, 0.0f, 3.0f + (float)(i & 7)},
+			   (vec3){0.0f, 0.0f, 0.0f}, (vec3){0.0f, 1.0f, 0.0f},
+			   view);
+		glm_perspective(glm_rad(45.0f), 800.0f / 600.0f, 0.1f, 100.0f,
+				projection);
+		glm_mat4_mul(projection, view, viewProjection);
+		sink = viewProjection[2][2];
+	}
+}
+
+static void decodeTexture(long iterations)
+{
+	long i;
+
+	for (i = 0; i < iterations; i++) {
+		int width, height, channels;
+		unsigned char *pixels = stbi_load_from_memory(texture, textureSize,
+							      &width, &height,
+							      &channels, 0);
+
+		sink = pixels ? pixels[0] : 0.0f;
+		stbi_image_free(pixels);
+	}
+}
+
+static void readShader(long iterations)
+{
+	long i;
+
+	for (i = 0; i < iterations; i++) {
+		char *source = lgl_readFile(shaderPath);
+
+		/* timing the failure path instead would pass for a fast read */
+		if (!source) {
+			fprintf(stderr, "Could not read \"%s\" after %ld reads\n",
+				shaderPath, i);
+			exit(2);
+		}
+		sink = source[0];
+		lgl_freeFile(source);
+	}
+}
+
+static const Case cases[] = {
+	{"cglm_mat4_mul", mat4Mul},
+	{"cglm_mat4_inv", mat4Inv},
+	{"cglm_model_matrix", modelMatrix},
+	{"cglm_view_projection", viewProjection},
+	{"stbi_load_container_jpg", decodeTexture},
+	{"lgl_read_shader", readShader},
+};
+
+static int compare(const void *a, const void *b)
+{
+	double x = *(const double *)a, y = *(const double *)b;
+
+	return (x > y) - (x < y);
+}
+
+/* ns per operation of `repetitions` timed runs */
+static void measure(const Case *c, double *samples, int repetitions)
+{
+	long iterations = 1;
+	double seconds;
+	int i;
+
+	/* enough iterations for the clock to be precise */
+	for (;;) {
+		double start = now();
+
+		c->run(iterations);
+		seconds = now() - start;
+		if (seconds >= MIN_SECONDS || iterations >= (1L << 30)) break;
+		iterations *= 2;
+	}
+
+	for (i = 0; i < repetitions; i++) {
+		double start = now();
+
+		c->run(iterations);
+		samples[i] = (now() - start) * 1e9 / iterations;
+	}
+	qsort(samples, repetitions, sizeof(*samples), compare);
+}
+
+static unsigned char *readAll(const char *path, int *size)
+{
+	FILE *file = fopen(path, "rb");
+	unsigned char *data = NULL;
+	long length;
+
+	if (!file) return NULL;
+	if (!fseek(file, 0, SEEK_END) && (length = ftell(file)) > 0
+	    && !fseek(file, 0, SEEK_SET)) {
+		data = malloc(length);
+		if (data && fread(data, 1, length, file) != (size_t)length) {
+			free(data);
+			data = NULL;
+		}
+		*size = (int)length;
+	}
+	fclose(file);
+	return data;
+}
+
+int main(int argc, char **argv)
+{
+	const char *root = argc > 1 ? argv[1] : "../..";
+	int repetitions = argc > 2 ? atoi(argv[2]) : 15;
+	int exitCode = 0, i, j;
+	char path[1024];
+	double *samples = NULL;
+
+	if (argc > 3 || repetitions < 1) {
+		fprintf(stderr, "usage: %s [repository root] [repetitions]\n",
+			argv[0]);
+		return 2;
+	}
+
+	snprintf(path, sizeof(path),
+		 "%s/1.getting_started/4.1.textures/assets/textures/container.jpg",
+		 root);
+	snprintf(shaderPath, sizeof(shaderPath),
+		 "%s/1.getting_started/4.1.textures/shaders/fragment.glsl", root);
+
+	texture = readAll(path, &textureSize);
+	if (!texture) {
+		fprintf(stderr, "Could not read \"%s\"\n", path);
+		goto_defer(2);
+	}
+
+	samples = malloc(repetitions * sizeof(*samples));
+	if (!samples) {
+		fprintf(stderr, "Out of memory\n");
+		goto_defer(2);
+	}
+
+	printf("{");
+	for (i = 0; i < (int)(sizeof(cases) / sizeof(*cases)); i++) {
+		double sum = 0.0;
+
+		measure(&cases[i], samples, repetitions);
+		for (j = 0; j < repetitions; j++) sum += samples[j];
+
+		printf("%s\n\"%s\": {\"min\": %.4f, \"mean\": %.4f, \"p50\": %.4f,"
+		       " \"max\": %.4f}", i ? "," : "", cases[i].name, samples[0],
+		       sum / repetitions, samples[repetitions / 2],
+		       samples[repetitions - 1]);
+		fflush(stdout);
+	}
+	printf("\n}\n");
+
+ defer:
+	free(samples);
+	free(texture);
+	return exitCode;
+}
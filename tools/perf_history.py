@@ -0,0 +1,333 @@
+#!/usr/bin/env python3
+"""Keeps a history of benchmark results by git commit and flags
+regressions in it.
+
+usage: tools/perf_history.py run [--store FILE] [--only samples|micro]
+       tools/perf_history.py report [--store FILE] [--html FILE]
+                                    [--threshold SCORE] [--min-change PERCENT]
+
+run benchmarks the checked out tree: every 1.getting_started sample
+through tools/benchmark.sh (headless, fixed clock; its LGL_* variables
+apply) and the CPU paths through tools/micro_bench (cglm math, stb_image
+decoding, lgl_readFile). The results are appended to a CSV store, one row
+per commit, suite, case and metric; a tree with local changes is stored
+as <commit>-dirty. Running again on the same commit adds samples, the
+report takes their median.
+
+report looks for change points in every series, in the order the commits
+were first benchmarked. The noise of a series is estimated from the
+differences between neighbouring commits (median absolute deviation), and
+binary segmentation splits the series where the means on both sides
+differ by more than --threshold (default 5) noise standard errors and
+--min-change percent (default 3). Every metric is a time, so a step up is
+a regression. The report exits with 1 when the latest commit is part of
+a regression, for CI. A step on the latest commit alone is confirmed by
+its repeated runs, each of which must be --min-change percent above the
+level before; with a single run it is reported as suspected, and still
+fails, until `run` is repeated on it. The summary names the commits
+where the failing steps start, and --html writes the series as static SVG charts
+with the change points marked."""
+
+import argparse
+import csv
+import html
+import json
+import math
+import os
+import statistics
+import subprocess
+import sys
+import tempfile
+import time
+
+ROOT = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), ".."))
+STORE = os.path.join(ROOT, "perf_history.csv")
+FIELDS = ["run", "commit", "date", "suite", "case", "metric", "value"]
+
+# what is kept of each benchmark's JSON object
+SAMPLE_METRICS = [("cpu_ms", "p50"), ("cpu_ms", "p95"),
+                  ("gpu_ms", "p50"), ("gpu_ms", "p95"),
+                  ("gl_ms", "p50")]
+MICRO_METRICS = [("ns", "p50"), ("ns", "min")]
+
+
+def git(*args):
+    return subprocess.run(["git", "-C", ROOT] + list(args), check=True,
+                          capture_output=True, text=True).stdout.strip()
+
+
+def commit():
+    name = git("rev-parse", "--short", "HEAD")
+    if git("status", "--porcelain", "--untracked-files=no"):
+        name += "-dirty"
+    return name, git("show", "-s", "--format=%cI", "HEAD")
+
+
+def run_samples():
+    with tempfile.TemporaryDirectory() as work:
+        output = os.path.join(work, "samples.json")
+        subprocess.run([os.path.join(ROOT, "tools/benchmark.sh"), output],
+                       check=True)
+        with open(output) as f:
+            samples = json.load(f)["samples"]
+
+    for name, result in samples.items():
+        for key, stat in SAMPLE_METRICS:
+            if key in result:
+                yield "samples", name, "%s.%s" % (key, stat), result[key][stat]
+
+
+def run_micro():
+    directory = os.path.join(ROOT, "tools/micro_bench")
+    subprocess.run(["make", "-s", "-C", directory], check=True,
+                   stdout=sys.stderr)
+    output = subprocess.run([os.path.join(directory, "bin/micro_bench"), ROOT],
+                            check=True, capture_output=True, text=True).stdout
+
+    for name, result in json.loads(output).items():
+        for key, stat in MICRO_METRICS:
+            yield "micro", name, "%s.%s" % (key, stat), result[stat]
+
+
+def run(args):
+    name, date = commit()
+    stamp = time.strftime("%Y-%m-%dT%H:%M:%S")
+    rows = []
+    if args.only in (None, "samples"):
+        rows += list(run_samples())
+    if args.only in (None, "micro"):
+        rows += list(run_micro())
+
+    new = not os.path.exists(args.store)
+    with open(args.store, "a", newline="") as f:
+        writer = csv.writer(f)
+        if new:
+            writer.writerow(FIELDS)
+        for suite, case, metric, value in rows:
+            writer.writerow([stamp, name, date, suite, case, metric, value])
+    print("%d results of %s added to %s" % (len(rows), name, args.store),
+          file=sys.stderr)
+
+
+def load(path):
+    """commits in benchmark order, {(suite, case, metric): {commit: median
+    value}} and the same with every run's value"""
+    commits, values = [], {}
+    with open(path, newline="") as f:
+        for row in csv.DictReader(f):
+            if row["commit"] not in commits:
+                commits.append(row["commit"])
+            key = (row["suite"], row["case"], row["metric"])
+            values.setdefault(key, {}).setdefault(row["commit"], []).append(
+                float(row["value"]))
+
+    series = {}
+    for key, by_commit in values.items():
+        series[key] = {c: statistics.median(v) for c, v in by_commit.items()}
+    return commits, series, values
+
+
+def noise(values):
+    """standard deviation of one value, from neighbour differences, which a
+    step between them barely moves"""
+    if len(values) < 3:
+        return 0.0
+    diffs = [b - a for a, b in zip(values, values[1:])]
+    center = statistics.median(diffs)
+    mad = statistics.median(abs(d - center) for d in diffs)
+    return 1.4826 * mad / math.sqrt(2)
+
+
+def change_points(values, threshold, min_change):
+    """indices where a new level starts, by binary segmentation"""
+    sigma = noise(values)
+    # no measurable noise yet: only trust the relative change
+    floor = 1e-9 * max(abs(v) for v in values) if values else 0.0
+    sigma = max(sigma, floor)
+    points = []
+
+    def split(lo, hi):
+        best, where = 0.0, None
+        for i in range(lo + 1, hi):
+            left, right = values[lo:i], values[i:hi]
+            before, after = statistics.mean(left), statistics.mean(right)
+            score = abs(after - before) / (
+                sigma * math.sqrt(1 / len(left) + 1 / len(right)))
+            relative = abs(after - before) / abs(before) if before else 0.0
+            if score > best and relative * 100 >= min_change:
+                best, where = score, i
+        if where is not None and best >= threshold:
+            points.append(where)
+            split(lo, where)
+            split(where, hi)
+
+    split(0, len(values))
+    return sorted(points)
+
+
+def analyze(commits, series, threshold, min_change):
+    results = []
+    for key in sorted(series):
+        present = [c for c in commits if c in series[key]]
+        values = [series[key][c] for c in present]
+        points = change_points(values, threshold, min_change)
+        bounds = [0] + points + [len(values)]
+        levels = [statistics.mean(values[a:b]) for a, b in zip(bounds, bounds[1:])]
+        steps = []
+        for n, point in enumerate(points):
+            before, after = levels[n], levels[n + 1]
+            steps.append({"index": point, "commit": present[point],
+                          "before": before, "after": after,
+                          "change": (after - before) / before * 100})
+        results.append({"key": key, "commits": present, "values": values,
+                        "bounds": bounds, "levels": levels, "steps": steps})
+    return results
+
+
+def chart(result, width=640, height=180, pad=36):
+    values, commits = result["values"], result["commits"]
+    low, high = min(values), max(values)
+    if high == low:
+        low, high = low * 0.9, high * 1.1 + 1e-9
+    step = (width - 2 * pad) / max(len(values) - 1, 1)
+
+    def x(i):
+        return pad + i * step
+
+    def y(v):
+        return height - pad - (v - low) / (high - low) * (height - 2 * pad)
+
+    parts = ['<svg width="%d" height="%d" viewBox="0 0 %d %d">'
+             % (width, height, width, height),
+             '<rect width="100%" height="100%" fill="#fff" stroke="#ccc"/>',
+             '<text x="4" y="%d" font-size="10">%.4g</text>' % (pad, high),
+             '<text x="4" y="%d" font-size="10">%.4g</text>'
+             % (height - pad, low)]
+
+    # the level of every segment between change points
+    for (a, b), level in zip(zip(result["bounds"], result["bounds"][1:]),
+                             result["levels"]):
+        parts.append('<line x1="%.1f" y1="%.1f" x2="%.1f" y2="%.1f" '
+                     'stroke="#999" stroke-dasharray="4 3"/>'
+                     % (x(a), y(level), x(b - 1), y(level)))
+
+    points = " ".join("%.1f,%.1f" % (x(i), y(v)) for i, v in enumerate(values))
+    parts.append('<polyline points="%s" fill="none" stroke="#36c"/>' % points)
+    for i, (c, v) in enumerate(zip(commits, values)):
+        parts.append('<circle cx="%.1f" cy="%.1f" r="2.5" fill="#36c">'
+                     '<title>%s: %.4g</title></circle>'
+                     % (x(i), y(v), html.escape(c), v))
+
+    for s in result["steps"]:
+        color = "#c33" if s["change"] > 0 else "#3a3"
+        parts.append('<line x1="%.1f" y1="%d" x2="%.1f" y2="%d" stroke="%s">'
+                     '<title>%s: %+.1f%%</title></line>'
+                     % (x(s["index"]), pad / 2, x(s["index"]), height - pad,
+                        color, html.escape(s["commit"]), s["change"]))
+
+    parts.append('<text x="%d" y="%d" font-size="10">%s</text>'
+                 % (pad, height - 8, html.escape(commits[0])))
+    parts.append('<text x="%d" y="%d" font-size="10" text-anchor="end">%s'
+                 '</text>' % (width - pad, height - 8, html.escape(commits[-1])))
+    parts.append("</svg>")
+    return "\n".join(parts)
+
+
+def write_html(path, results, commits):
+    out = ["<!DOCTYPE html>", "<html><head><meta charset=\"utf-8\">",
+           "<title>Performance history</title>",
+           "<style>body{font-family:sans-serif;margin:2em}"
+           "div{display:inline-block;margin:0 1em 1em 0}"
+           "h3{font-size:13px;margin:0}.up{color:#c33}.down{color:#3a3}"
+           "</style></head><body>",
+           "<h1>Performance history</h1>",
+           "<p>%d commits, %s to %s. Dashed lines are the levels between "
+           "change points, red marks regressions and green improvements.</p>"
+           % (len(commits), html.escape(commits[0]), html.escape(commits[-1]))]
+
+    suite = None
+    for result in results:
+        if result["key"][0] != suite:
+            suite = result["key"][0]
+            out.append("<h2>%s</h2>" % html.escape(suite))
+        steps = ", ".join('<span class="%s">%s %+.1f%%</span>'
+                          % ("up" if s["change"] > 0 else "down",
+                             html.escape(s["commit"]), s["change"])
+                          for s in result["steps"])
+        out.append("<div><h3>%s %s</h3>%s<br>%s</div>"
+                   % (html.escape(result["key"][1]),
+                      html.escape(result["key"][2]), chart(result), steps))
+
+    out.append("</body></html>")
+    with open(path, "w") as f:
+        f.write("\n".join(out) + "\n")
+
+
+def report(args):
+    commits, series, runs = load(args.store)
+    if not commits:
+        print("%s is empty" % args.store, file=sys.stderr)
+        return 0
+    results = analyze(commits, series, args.threshold, args.min_change)
+
+    current, suspected, culprits = 0, 0, []
+    for result in results:
+        for s in result["steps"]:
+            flag = ""
+            # the last level reaches the latest commit
+            if (s["change"] > 0 and s is result["steps"][-1]
+                    and result["commits"][-1] == commits[-1]):
+                head = runs[result["key"]][commits[-1]]
+                limit = s["before"] * (1 + args.min_change / 100)
+                if len(result["values"]) - s["index"] >= 2:
+                    flag = "  REGRESSION"
+                elif len(head) < 2:
+                    flag = "  SUSPECTED REGRESSION (one run)"
+                elif all(v >= limit for v in head):
+                    flag = "  REGRESSION"
+                else:
+                    flag = "  (outlier run)"
+                if "REGRESSION" in flag:
+                    current += 1
+                    suspected += "SUSPECTED" in flag
+                    if s["commit"] not in culprits:
+                        culprits.append(s["commit"])
+            print("%-8s %-28s %-12s %s %+6.1f%% (%.4g -> %.4g)%s"
+                  % (result["key"][0], result["key"][1], result["key"][2],
+                     s["commit"], s["change"], s["before"], s["after"],
+                     flag))
+
+    if args.html:
+        write_html(args.html, results, commits)
+        print("wrote %s" % args.html, file=sys.stderr)
+    print("%d series over %d commits, %d regressed (%d suspected)%s"
+          % (len(results), len(commits), current, suspected,
+             " at " + ", ".join(culprits) if culprits else ""))
+    return 1 if current else 0
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__.split("\n\n")[0],
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+    commands = parser.add_subparsers(dest="command", required=True)
+
+    run_parser = commands.add_parser("run", help="benchmark the checked out tree")
+    run_parser.add_argument("--store", default=STORE)
+    run_parser.add_argument("--only", choices=("samples", "micro"))
+
+    report_parser = commands.add_parser("report", help="find change points")
+    report_parser.add_argument("--store", default=STORE)
+    report_parser.add_argument("--html")
+    report_parser.add_argument("--threshold", type=float, default=5.0)
+    report_parser.add_argument("--min-change", type=float, default=3.0)
+
+    args = parser.parse_args()
+    if args.command == "run":
+        run(args)
+        return 0
+    return report(args)
+
+
+if __name__ == "__main__":
+    sys.exit(main())